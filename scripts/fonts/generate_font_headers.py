@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Regenerates the embedded font headers in src/gui/assets/fonts.
+
+Both fonts are cut down to the glyphs the GUI can show and stored LZ4
+compressed; src/gui/font_data.cpp inflates them once at runtime.
+
+  text font  printable ASCII and Latin-1 for ids, host names and paths, plus
+             every character of the strings in localization.h
+  icon font  the ICON_FA_* icons referenced anywhere under src/gui
+
+Run it again after adding strings to localization.h or using a new icon:
+
+  pip install fonttools lz4
+  python3 scripts/fonts/generate_font_headers.py \\
+      --text-font OPPOSans-Regular.ttf --icon-font fa-solid-900.ttf
+"""
+
+import argparse
+import io
+import pathlib
+import re
+
+import lz4.block
+from fontTools import subset
+from fontTools.ttLib import TTFont
+
+ROOT = pathlib.Path(__file__).resolve().parents[2]
+GUI_DIR = ROOT / "src" / "gui"
+FONTS_DIR = GUI_DIR / "assets" / "fonts"
+ICONS_HEADER = GUI_DIR / "assets" / "icons" / "IconsFontAwesome6.h"
+LOCALIZATION_HEADER = GUI_DIR / "assets" / "localization" / "localization.h"
+
+
+def text_codepoints():
+    codepoints = set(range(0x20, 0x7F)) | set(range(0xA0, 0x100))
+    source = LOCALIZATION_HEADER.read_text(encoding="utf-8")
+    for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', source):
+        codepoints.update(ord(c) for c in literal)
+    return codepoints
+
+
+def icon_codepoints():
+    defines = {}
+    for name, value in re.findall(r"#define (ICON_FA_\w+)\s+\"([^\"]+)\"",
+                                  ICONS_HEADER.read_text(encoding="utf-8")):
+        text = value.encode("latin-1").decode("unicode_escape")
+        text = text.encode("latin-1").decode("utf-8")
+        defines[name] = ord(text)
+
+    used = set()
+    for path in GUI_DIR.rglob("*"):
+        if path.suffix not in (".cpp", ".mm", ".h") or "assets" in path.parts:
+            continue
+        used.update(re.findall(r"ICON_FA_\w+", path.read_text(encoding="utf-8")))
+    return {defines[name] for name in used if name in defines}
+
+
+def subset_font(path, codepoints):
+    font = TTFont(path)
+    missing = sorted(codepoints - set(font.getBestCmap()))
+    if missing:
+        # a cut down source font silently drops these, show which
+        print(f"{pathlib.Path(path).name}: {len(missing)} of "
+              f"{len(codepoints)} codepoints have no glyph: " +
+              "".join(chr(c) for c in missing))
+    options = subset.Options()
+    options.layout_features = ["*"]
+    options.name_IDs = ["*"]
+    options.notdef_outline = True
+    subsetter = subset.Subsetter(options)
+    subsetter.populate(unicodes=codepoints)
+    subsetter.subset(font)
+    out = io.BytesIO()
+    font.save(out)
+    return out.getvalue()
+
+
+def write_header(name, guard, data, author_date):
+    compressed = lz4.block.compress(data, mode="high_compression",
+                                    compression=12, store_size=False)
+    lines = []
+    for i in range(0, len(compressed), 12):
+        chunk = compressed[i:i + 12]
+        lines.append("    " + ", ".join("0x%02x" % b for b in chunk))
+    body = ",\n".join(lines)
+    header = f"""/*
+ * @Author: DI JUNKUN
+ * @Date: {author_date}
+ * Copyright (c) 2024 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Generated by scripts/fonts/generate_font_headers.py, do not edit.
+
+#ifndef {guard}
+#define {guard}
+
+unsigned char {name}_ttf_lz4[] = {{
+{body}}};
+unsigned int {name}_ttf_lz4_len = {len(compressed)};
+unsigned int {name}_ttf_len = {len(data)};
+
+#endif
+"""
+    (FONTS_DIR / f"{name}.h").write_text(header, encoding="utf-8")
+    print(f"{name}: {len(data)} bytes, {len(compressed)} compressed")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--text-font", required=True)
+    parser.add_argument("--icon-font", required=True)
+    args = parser.parse_args()
+
+    write_header("OPPOSans_Regular", "_OPPOSANS_REGULAR_H_",
+                 subset_font(args.text_font, text_codepoints()), "2024-12-02")
+    write_header("fa_solid_900", "_FA_SOLID_900_H_",
+                 subset_font(args.icon_font, icon_codepoints()), "2024-11-11")
+
+
+if __name__ == "__main__":
+    main()
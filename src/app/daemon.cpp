@@ -82,6 +82,10 @@ void Daemon::stop() { running_ = false; }
 
 bool Daemon::isRunning() const { return running_; }
 
+void Daemon::addChildArg(const std::string& arg) {
+  child_args_.push_back(arg);
+}
+
 bool Daemon::start(MainLoopFunc loop) {
 #ifdef _WIN32
   running_ = true;
@@ -218,6 +222,9 @@ bool Daemon::runWithRestart(MainLoopFunc loop) {
     PROCESS_INFORMATION pi = {0};
 
     std::string cmd_line = "\"" + exe_path + "\" --child";
+    for (const auto& arg : child_args_) {
+      cmd_line += " " + arg;
+    }
     std::vector<char> cmd_line_buf(cmd_line.begin(), cmd_line.end());
     cmd_line_buf.push_back('\0');
 
@@ -262,7 +269,14 @@ bool Daemon::runWithRestart(MainLoopFunc loop) {
     // linux: use fork + exec to create child process
     pid_t pid = fork();
     if (pid == 0) {
-      execl(exe_path.c_str(), exe_path.c_str(), "--child", nullptr);
+      std::vector<char*> argv;
+      argv.push_back(const_cast<char*>(exe_path.c_str()));
+      argv.push_back(const_cast<char*>("--child"));
+      for (auto& arg : child_args_) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+      execv(exe_path.c_str(), argv.data());
       _exit(1);  // exec failed
     } else if (pid > 0) {
       int status = 0;
@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 #define DAEMON_DEFAULT_RESTART_DELAY_MS 1000
 
@@ -18,6 +19,9 @@ class Daemon {
 
   Daemon(const std::string& name);
 
+  // passed to the child process after --child
+  void addChildArg(const std::string& arg);
+
   bool start(MainLoopFunc loop);
 
   void stop();
@@ -26,6 +30,7 @@ class Daemon {
 
  private:
   std::string name_;
+  std::vector<std::string> child_args_;
   bool runWithRestart(MainLoopFunc loop);
 
 #ifdef _WIN32
@@ -18,21 +18,18 @@
 int main(int argc, char* argv[]) {
   // check if running as child process
   bool is_child = false;
+  // host only, no windows: --headless or enable_headless in config.ini
+  bool headless_arg = false;
   for (int i = 1; i < argc; i++) {
     if (strcmp(argv[i], "--child") == 0) {
       is_child = true;
-      break;
+    } else if (strcmp(argv[i], "--headless") == 0) {
+      headless_arg = true;
     }
   }
 
-  if (is_child) {
-    // child process: run render directly
-    crossdesk::Render render;
-    render.Run();
-    return 0;
-  }
-
   bool enable_daemon = false;
+  bool headless = headless_arg;
   auto path_manager = std::make_unique<crossdesk::PathManager>("CrossDesk");
   if (path_manager) {
     std::string cert_path =
@@ -41,16 +38,34 @@ int main(int argc, char* argv[]) {
     crossdesk::ConfigCenter config_center(cache_path + "/config.ini",
                                           cert_path);
     enable_daemon = config_center.IsEnableDaemon();
+    headless = headless || config_center.IsEnableHeadless();
+  }
+
+  auto run_render = [headless]() {
+    crossdesk::Render render;
+    if (headless) {
+      render.RunHeadless();
+    } else {
+      render.Run();
+    }
+  };
+
+  if (is_child) {
+    // child process: run render directly
+    run_render();
+    return 0;
   }
 
   if (enable_daemon) {
     // start daemon with restart monitoring
     Daemon daemon("CrossDesk");
+    if (headless_arg) {
+      daemon.addChildArg("--headless");
+    }
 
     // define main loop function: run render and stop daemon on normal exit
-    Daemon::MainLoopFunc main_loop = [&daemon]() {
-      crossdesk::Render render;
-      render.Run();
+    Daemon::MainLoopFunc main_loop = [&daemon, &run_render]() {
+      run_render();
       daemon.stop();
     };
 
@@ -60,7 +75,6 @@ int main(int argc, char* argv[]) {
   }
 
   // run without daemon: direct execution
-  crossdesk::Render render;
-  render.Run();
+  run_render();
   return 0;
-}
\ No newline at end of file
+}
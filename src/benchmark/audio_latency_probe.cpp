@@ -0,0 +1,340 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Measures the speaker capture path against a loopback that needs no sound
+// hardware: a null sink is loaded for the run, a click is played into it
+// every --interval-ms and SpeakerCapturerLinux records its monitor. For every
+// latency target it reports
+//
+//   delivery  time from the click reaching the sink to the capture callback
+//   stamp     capture timestamp of the click minus the time it reached the
+//             sink, how far the frame timestamps are off
+//
+// and finally how long a Stop()/Start() cycle takes with the context kept
+// alive. The click reaches the sink when the playback latency reported just
+// before writing it has passed.
+//
+// usage: audio_latency_probe [--targets 5,10,20,40] [--clicks N]
+//                            [--interval-ms N] [--restarts N]
+
+#include <pulse/pulseaudio.h>
+#include <pulse/simple.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "speaker_capturer_linux.h"
+
+namespace {
+
+constexpr char kSinkName[] = "crossdesk_probe";
+constexpr int kRate = 48000;
+constexpr int kChannels = 2;
+constexpr int kChunkFrames = kRate / 100;
+constexpr int kClickFrames = 48;
+constexpr int16_t kClickLevel = 30000;
+constexpr int16_t kDetectLevel = 16000;
+
+int64_t NowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// loads and unloads the null sink on a private context
+class NullSink {
+ public:
+  ~NullSink() { Unload(); }
+
+  bool Load() {
+    mainloop_ = pa_threaded_mainloop_new();
+    if (!mainloop_ || pa_threaded_mainloop_start(mainloop_) < 0) {
+      return false;
+    }
+    pa_threaded_mainloop_lock(mainloop_);
+    context_ =
+        pa_context_new(pa_threaded_mainloop_get_api(mainloop_), "probe");
+    pa_context_set_state_callback(
+        context_,
+        [](pa_context*, void* u) {
+          pa_threaded_mainloop_signal(static_cast<pa_threaded_mainloop*>(u),
+                                      0);
+        },
+        mainloop_);
+    bool ok =
+        pa_context_connect(context_, nullptr, PA_CONTEXT_NOFLAGS, nullptr) >= 0;
+    while (ok && pa_context_get_state(context_) != PA_CONTEXT_READY) {
+      if (!PA_CONTEXT_IS_GOOD(pa_context_get_state(context_))) {
+        ok = false;
+        break;
+      }
+      pa_threaded_mainloop_wait(mainloop_);
+    }
+
+    if (ok) {
+      char args[256];
+      snprintf(args, sizeof(args),
+               "sink_name=%s format=s16le rate=%d channels=%d "
+               "sink_properties=device.description=CrossDeskProbe",
+               kSinkName, kRate, kChannels);
+      Wait(pa_context_load_module(
+          context_, "module-null-sink", args,
+          [](pa_context*, uint32_t index, void* u) {
+            auto* self = static_cast<NullSink*>(u);
+            self->module_ = index;
+            pa_threaded_mainloop_signal(self->mainloop_, 0);
+          },
+          this));
+      ok = module_ != PA_INVALID_INDEX;
+    }
+    pa_threaded_mainloop_unlock(mainloop_);
+    return ok;
+  }
+
+  void Unload() {
+    if (!mainloop_) {
+      return;
+    }
+    pa_threaded_mainloop_lock(mainloop_);
+    if (module_ != PA_INVALID_INDEX) {
+      Wait(pa_context_unload_module(
+          context_, module_,
+          [](pa_context*, int, void* u) {
+            pa_threaded_mainloop_signal(static_cast<pa_threaded_mainloop*>(u),
+                                        0);
+          },
+          mainloop_));
+      module_ = PA_INVALID_INDEX;
+    }
+    if (context_) {
+      pa_context_disconnect(context_);
+      pa_context_unref(context_);
+      context_ = nullptr;
+    }
+    pa_threaded_mainloop_unlock(mainloop_);
+    pa_threaded_mainloop_stop(mainloop_);
+    pa_threaded_mainloop_free(mainloop_);
+    mainloop_ = nullptr;
+  }
+
+ private:
+  void Wait(pa_operation* operation) {
+    if (!operation) {
+      return;
+    }
+    while (pa_operation_get_state(operation) == PA_OPERATION_RUNNING) {
+      pa_threaded_mainloop_wait(mainloop_);
+    }
+    pa_operation_unref(operation);
+  }
+
+ private:
+  pa_threaded_mainloop* mainloop_ = nullptr;
+  pa_context* context_ = nullptr;
+  uint32_t module_ = PA_INVALID_INDEX;
+};
+
+struct Detection {
+  int64_t stamp_us;    // capture timestamp of the click sample
+  int64_t arrival_us;  // when the callback saw it
+};
+
+struct Summary {
+  double median = 0;
+  double p95 = 0;
+  double max = 0;
+};
+
+Summary Summarize(std::vector<double> values) {
+  Summary summary;
+  if (values.empty()) {
+    return summary;
+  }
+  std::sort(values.begin(), values.end());
+  summary.median = values[values.size() / 2];
+  summary.p95 = values[std::min(values.size() - 1, values.size() * 95 / 100)];
+  summary.max = values.back();
+  return summary;
+}
+
+// plays silence with a click every interval, returns when the sink has
+// consumed each click
+std::vector<int64_t> PlayClicks(int clicks, int interval_ms) {
+  std::vector<int64_t> played;
+  pa_sample_spec ss = {PA_SAMPLE_S16LE, kRate, kChannels};
+  pa_buffer_attr attr = {(uint32_t)-1, (uint32_t)-1, (uint32_t)-1,
+                         (uint32_t)-1, (uint32_t)-1};
+  attr.tlength = static_cast<uint32_t>(pa_usec_to_bytes(20 * 1000, &ss));
+  int error = 0;
+  pa_simple* playback =
+      pa_simple_new(nullptr, "audio_latency_probe", PA_STREAM_PLAYBACK,
+                    kSinkName, "click", &ss, nullptr, &attr, &error);
+  if (!playback) {
+    fprintf(stderr, "playback stream: %s\n", pa_strerror(error));
+    return played;
+  }
+
+  std::vector<int16_t> silence(kChunkFrames * kChannels, 0);
+  std::vector<int16_t> click = silence;
+  for (int i = 0; i < kClickFrames * kChannels; ++i) {
+    click[i] = (i / kChannels) % 2 ? -kClickLevel : kClickLevel;
+  }
+
+  int chunks_per_click = (std::max)(interval_ms / 10, 1);
+  // a short lead-in so the capture stream is running before the first click
+  for (int chunk = 0; chunk < (clicks + 1) * chunks_per_click; ++chunk) {
+    bool is_click = chunk >= chunks_per_click && chunk % chunks_per_click == 0;
+    if (is_click) {
+      pa_usec_t latency = pa_simple_get_latency(playback, &error);
+      played.push_back(NowUs() + static_cast<int64_t>(latency));
+    }
+    const std::vector<int16_t>& data = is_click ? click : silence;
+    pa_simple_write(playback, data.data(), data.size() * sizeof(int16_t),
+                    &error);
+  }
+  pa_simple_drain(playback, &error);
+  pa_simple_free(playback);
+  return played;
+}
+
+void RunTarget(crossdesk::SpeakerCapturerLinux& capturer,
+               std::vector<Detection>& detections, std::mutex& mutex,
+               uint32_t target_ms, int clicks, int interval_ms) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    detections.clear();
+  }
+  capturer.SetLatencyTarget(target_ms);
+  if (capturer.Start() != 0) {
+    fprintf(stderr, "capture did not start\n");
+    return;
+  }
+  std::vector<int64_t> played = PlayClicks(clicks, interval_ms);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  crossdesk::SpeakerCapturerLinux::Stats stats = capturer.GetStats();
+  capturer.Stop();
+
+  std::vector<double> delivery;
+  std::vector<double> stamp;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int64_t play_us : played) {
+      // the detection closest to the click, within half an interval
+      const Detection* best = nullptr;
+      for (const Detection& detection : detections) {
+        int64_t error = std::llabs(detection.stamp_us - play_us);
+        if (error < interval_ms * 500 &&
+            (!best || error < std::llabs(best->stamp_us - play_us))) {
+          best = &detection;
+        }
+      }
+      if (best) {
+        delivery.push_back((best->arrival_us - play_us) / 1000.0);
+        stamp.push_back((best->stamp_us - play_us) / 1000.0);
+      }
+    }
+  }
+
+  Summary d = Summarize(delivery);
+  Summary s = Summarize(stamp);
+  printf("%8u %6zu/%-4zu %9.1f %7.1f %7.1f %9.1f %7.1f %9.1f %9.1f\n",
+         target_ms, delivery.size(), played.size(), d.median, d.p95, d.max,
+         s.median, s.max, stats.fragment_us / 1000.0,
+         stats.latency_us / 1000.0);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<uint32_t> targets = {5, 10, 20, 40};
+  int clicks = 20;
+  int interval_ms = 200;
+  int restarts = 20;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    const char* value = argv[i + 1];
+    if (strcmp(argv[i], "--targets") == 0) {
+      targets.clear();
+      std::stringstream list(value);
+      std::string item;
+      while (std::getline(list, item, ',')) {
+        targets.push_back(static_cast<uint32_t>(std::atoi(item.c_str())));
+      }
+    } else if (strcmp(argv[i], "--clicks") == 0) {
+      clicks = std::atoi(value);
+    } else if (strcmp(argv[i], "--interval-ms") == 0) {
+      interval_ms = (std::max)(std::atoi(value), 50);
+    } else if (strcmp(argv[i], "--restarts") == 0) {
+      restarts = std::atoi(value);
+    }
+  }
+
+  NullSink sink;
+  if (!sink.Load()) {
+    fprintf(stderr, "could not load module-null-sink\n");
+    return 1;
+  }
+
+  std::vector<Detection> detections;
+  std::mutex mutex;
+  int64_t last_detection_us = 0;
+  crossdesk::SpeakerCapturerLinux capturer;
+  capturer.SetSourceName(std::string(kSinkName) + ".monitor");
+  capturer.Init([&](unsigned char* data, size_t size, const char*,
+                    const crossdesk::AudioFormat& format,
+                    int64_t timestamp_us) {
+    const int16_t* pcm = reinterpret_cast<const int16_t*>(data);
+    size_t samples = size / sizeof(int16_t);
+    for (size_t i = 0; i < samples; ++i) {
+      if (pcm[i] > kDetectLevel || pcm[i] < -kDetectLevel) {
+        int64_t stamp_us = timestamp_us + static_cast<int64_t>(
+                                              i / format.channels) *
+                                              1000000 / format.sample_rate;
+        // one detection per click
+        if (stamp_us - last_detection_us > interval_ms * 500) {
+          std::lock_guard<std::mutex> lock(mutex);
+          detections.push_back({stamp_us, NowUs()});
+          last_detection_us = stamp_us;
+        }
+        break;
+      }
+    }
+  });
+
+  printf("%8s %11s %9s %7s %7s %9s %7s %9s %9s\n", "target", "detected",
+         "deliv ms", "p95", "max", "stamp ms", "max", "frag ms", "src ms");
+  for (uint32_t target : targets) {
+    RunTarget(capturer, detections, mutex, target, clicks, interval_ms);
+  }
+
+  std::vector<double> restart_ms;
+  for (int i = 0; i < restarts; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    capturer.Stop();
+    if (capturer.Start() != 0) {
+      fprintf(stderr, "restart %d failed\n", i);
+      break;
+    }
+    restart_ms.push_back(std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - start)
+                             .count());
+  }
+  capturer.Destroy();
+
+  Summary r = Summarize(restart_ms);
+  printf("restart  %zu cycles: median %.2f ms, p95 %.2f ms, max %.2f ms\n",
+         restart_ms.size(), r.median, r.p95, r.max);
+  return 0;
+}
@@ -0,0 +1,558 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Runs the audio path end to end without sound hardware or a network and
+// reports mouth-to-ear latency, its jitter and the CPU it costs per stream.
+//
+// Each stream is the synthetic SpeakerCapturer (picked through
+// SpeakerCapturerFactory) -> the host's SilenceGate -> the send callback
+// into a simulated link with delay, jitter and loss -> the viewer's
+// AudioPlayout -> a simulated output device that plays 10 ms per period in
+// real time. Mouth time is the onset of an impulse or tone burst as the
+// capturer generated it, ear time is when the device plays it.
+//
+// Every profile runs --streams streams side by side for --seconds.
+//
+// usage: audio_pipeline_bench [--profile NAME] [--streams N] [--seconds N]
+//                             [--signal impulse|tone] [--period-ms N]
+//                             [--delay-ms N] [--jitter-ms N] [--loss P]
+//                             [--no-dtx] [--seed N]
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "audio_playout.h"
+#include "silence_gate.h"
+#include "speaker_capturer_factory.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using crossdesk::AudioFormat;
+using crossdesk::AudioPlayout;
+using crossdesk::SilenceGate;
+using crossdesk::SpeakerCapturerSynthetic;
+
+constexpr int kDevicePeriodMs = 10;
+
+struct NetworkProfile {
+  std::string name;
+  double delay_ms;
+  double jitter_ms;
+  double loss;
+};
+
+struct BenchConfig {
+  int streams = 4;
+  int seconds = 10;
+  bool dtx = true;
+  uint64_t seed = 20261019;
+  SpeakerCapturerSynthetic::Config signal;
+};
+
+double ProcessCpuSeconds() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel,
+                       &user)) {
+    return 0;
+  }
+  auto to_seconds = [](const FILETIME& t) {
+    ULARGE_INTEGER v;
+    v.LowPart = t.dwLowDateTime;
+    v.HighPart = t.dwHighDateTime;
+    return v.QuadPart / 1e7;
+  };
+  return to_seconds(kernel) + to_seconds(user);
+#else
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+         usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+#endif
+}
+
+int64_t NowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+// The output device: a queue like SDL's audio stream, drained by one 10 ms
+// period at a time in real time.
+class SimDevice {
+ public:
+  SimDevice(int16_t threshold, int refractory_ms)
+      : threshold_(threshold), refractory_us_(refractory_ms * 1000) {}
+
+  void Start() {
+    running_ = true;
+    thread_ = std::thread(&SimDevice::PlayLoop, this);
+  }
+
+  void Stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  void Put(const int16_t* pcm, size_t samples, const AudioFormat& format) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (format != format_) {
+      queue_.clear();
+      format_ = format;
+    }
+    queue_.insert(queue_.end(), pcm, pcm + samples);
+  }
+
+  size_t QueuedBytes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size() * sizeof(int16_t);
+  }
+
+  std::vector<int64_t> EarTimes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ear_times_;
+  }
+
+  uint64_t Underruns() { return underruns_; }
+
+ private:
+  void PlayLoop() {
+    Clock::time_point next = Clock::now();
+    int64_t last_onset_us = 0;
+    std::vector<int16_t> period;
+    while (running_) {
+      next += std::chrono::milliseconds(kDevicePeriodMs);
+      std::this_thread::sleep_until(next);
+      int64_t play_us = NowUs();
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      size_t frames =
+          static_cast<size_t>(format_.sample_rate) * kDevicePeriodMs / 1000;
+      size_t samples = frames * format_.channels;
+      if (queue_.size() < samples) {
+        // plays what there is and silence after it
+        if (!queue_.empty()) {
+          ++underruns_;
+        }
+        samples = queue_.size();
+      }
+      period.assign(queue_.begin(), queue_.begin() + samples);
+      queue_.erase(queue_.begin(), queue_.begin() + samples);
+
+      for (size_t i = 0; i < period.size(); ++i) {
+        if (period[i] > threshold_ || period[i] < -threshold_) {
+          int64_t onset_us =
+              play_us + static_cast<int64_t>(i / format_.channels) * 1000000 /
+                            format_.sample_rate;
+          if (onset_us - last_onset_us > refractory_us_) {
+            ear_times_.push_back(onset_us);
+            last_onset_us = onset_us;
+          }
+          i += format_.channels;
+        }
+      }
+    }
+  }
+
+ private:
+  int16_t threshold_;
+  int64_t refractory_us_;
+  std::atomic<bool> running_{false};
+  std::thread thread_;
+  std::mutex mutex_;
+  AudioFormat format_{48000, 2};
+  std::deque<int16_t> queue_;
+  std::vector<int64_t> ear_times_;
+  std::atomic<uint64_t> underruns_{0};
+};
+
+// Host to viewer: frames arrive after delay plus jitter, in order, some are
+// lost. The viewer side runs on the link thread like the transport callback.
+class SimLink {
+ public:
+  using Receiver = std::function<void(const int16_t*, size_t,
+                                      const AudioFormat&)>;
+
+  SimLink(const NetworkProfile& profile, uint64_t seed, Receiver receiver)
+      : profile_(profile), rng_(seed), receiver_(std::move(receiver)) {}
+
+  void Start() {
+    running_ = true;
+    thread_ = std::thread(&SimLink::DeliverLoop, this);
+  }
+
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  void Send(const int16_t* pcm, size_t samples, const AudioFormat& format) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (std::uniform_real_distribution<double>(0, 1)(rng_) < profile_.loss) {
+      return;
+    }
+    double delay_ms =
+        profile_.delay_ms +
+        std::uniform_real_distribution<double>(0, profile_.jitter_ms)(rng_);
+    Clock::time_point at =
+        Clock::now() + std::chrono::microseconds(
+                           static_cast<int64_t>(delay_ms * 1000));
+    // the transport keeps the order
+    at = (std::max)(at, last_at_);
+    last_at_ = at;
+    queue_.push_back({at, std::vector<int16_t>(pcm, pcm + samples), format});
+    cv_.notify_all();
+  }
+
+ private:
+  struct Packet {
+    Clock::time_point at;
+    std::vector<int16_t> pcm;
+    AudioFormat format;
+  };
+
+  void DeliverLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+      if (queue_.empty()) {
+        cv_.wait(lock);
+        continue;
+      }
+      if (Clock::now() < queue_.front().at) {
+        cv_.wait_until(lock, queue_.front().at);
+        continue;
+      }
+      Packet packet = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      receiver_(packet.pcm.data(), packet.pcm.size(), packet.format);
+      lock.lock();
+    }
+  }
+
+ private:
+  NetworkProfile profile_;
+  std::mt19937_64 rng_;
+  Receiver receiver_;
+  bool running_ = false;
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Packet> queue_;
+  Clock::time_point last_at_;
+};
+
+struct StreamResult {
+  std::vector<double> latency_ms;
+  size_t events = 0;
+  uint64_t frames_sent = 0;
+  uint64_t frames_captured = 0;
+  uint64_t device_underruns = 0;
+  AudioPlayout::Stats playout;
+  double host_us = 0;    // gate and send, per captured frame
+  double viewer_us = 0;  // playout, per received frame
+};
+
+class Stream {
+ public:
+  Stream(const BenchConfig& config, const NetworkProfile& profile,
+         uint64_t seed)
+      : config_(config),
+        device_(config.signal.amplitude / 4, config.signal.period_ms / 2),
+        link_(profile, seed,
+              [this](const int16_t* pcm, size_t samples,
+                     const AudioFormat& format) {
+                OnReceive(pcm, samples, format);
+              }) {
+    crossdesk::SpeakerCapturerFactory factory;
+    capturer_.reset(static_cast<SpeakerCapturerSynthetic*>(
+        factory.Create(crossdesk::SpeakerCapturerFactory::Synthetic)));
+    capturer_->Configure(config.signal);
+    capturer_->Init([this](unsigned char* data, size_t size, const char*,
+                           const AudioFormat& format, int64_t) {
+      OnCapture(reinterpret_cast<const int16_t*>(data),
+                size / sizeof(int16_t), format);
+    });
+  }
+
+  void Start() {
+    device_.Start();
+    link_.Start();
+    capturer_->Start();
+  }
+
+  void Stop() {
+    capturer_->Stop();
+    link_.Stop();
+    device_.Stop();
+  }
+
+  StreamResult Result() {
+    StreamResult result;
+    std::vector<int64_t> mouth = capturer_->EventTimes();
+    std::vector<int64_t> ear = device_.EarTimes();
+    // an event counts once it had a full period to come out
+    int64_t horizon = ear.empty() ? 0 : ear.back();
+    int64_t window_us = config_.signal.period_ms * 1000;
+    size_t e = 0;
+    for (int64_t m : mouth) {
+      if (m + window_us > horizon) {
+        break;
+      }
+      ++result.events;
+      while (e < ear.size() && ear[e] < m) {
+        ++e;
+      }
+      if (e < ear.size() && ear[e] - m < window_us) {
+        result.latency_ms.push_back((ear[e] - m) / 1000.0);
+        ++e;
+      }
+    }
+    result.frames_sent = frames_sent_;
+    result.frames_captured = frames_captured_;
+    result.device_underruns = device_.Underruns();
+    result.playout = playout_.GetStats();
+    result.host_us = frames_captured_ ? host_ns_ / 1000.0 / frames_captured_
+                                      : 0;
+    result.viewer_us =
+        frames_received_ ? viewer_ns_ / 1000.0 / frames_received_ : 0;
+    return result;
+  }
+
+ private:
+  void OnCapture(const int16_t* pcm, size_t samples,
+                 const AudioFormat& format) {
+    auto start = Clock::now();
+    ++frames_captured_;
+    auto send = [&](const int16_t* out, int) {
+      ++frames_sent_;
+      link_.Send(out, samples, format);
+    };
+    if (config_.dtx) {
+      gate_.Process(pcm, samples, send);
+    } else {
+      send(pcm, 0);
+    }
+    host_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - start)
+                    .count();
+  }
+
+  void OnReceive(const int16_t* pcm, size_t samples,
+                 const AudioFormat& format) {
+    auto start = Clock::now();
+    ++frames_received_;
+    size_t out_frames = 0;
+    const int16_t* out = playout_.Process(
+        pcm, samples / format.channels, format.channels, format.sample_rate,
+        device_.QueuedBytes(), &out_frames);
+    if (out_frames > 0) {
+      device_.Put(out, out_frames * format.channels, format);
+    }
+    viewer_ns_ += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      Clock::now() - start)
+                      .count();
+  }
+
+ private:
+  BenchConfig config_;
+  std::unique_ptr<SpeakerCapturerSynthetic> capturer_;
+  SilenceGate gate_;
+  AudioPlayout playout_;
+  SimDevice device_;
+  SimLink link_;
+
+  // capture thread
+  uint64_t frames_captured_ = 0;
+  uint64_t frames_sent_ = 0;
+  int64_t host_ns_ = 0;
+  // link thread
+  uint64_t frames_received_ = 0;
+  int64_t viewer_ns_ = 0;
+};
+
+double Percentile(std::vector<double> values, double p) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t index = static_cast<size_t>(p * (values.size() - 1));
+  return values[index];
+}
+
+void RunProfile(const BenchConfig& config, const NetworkProfile& profile) {
+  std::vector<std::unique_ptr<Stream>> streams;
+  for (int i = 0; i < config.streams; ++i) {
+    streams.push_back(
+        std::make_unique<Stream>(config, profile, config.seed + i));
+  }
+
+  double cpu_start = ProcessCpuSeconds();
+  auto wall_start = Clock::now();
+  for (auto& stream : streams) {
+    stream->Start();
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(config.seconds));
+  for (auto& stream : streams) {
+    stream->Stop();
+  }
+  double wall =
+      std::chrono::duration<double>(Clock::now() - wall_start).count();
+  double cpu = ProcessCpuSeconds() - cpu_start;
+
+  std::vector<double> latency;
+  size_t events = 0;
+  uint64_t sent = 0;
+  uint64_t captured = 0;
+  uint64_t underruns = 0;
+  uint64_t concealed = 0;
+  double host_us = 0;
+  double viewer_us = 0;
+  for (auto& stream : streams) {
+    StreamResult result = stream->Result();
+    latency.insert(latency.end(), result.latency_ms.begin(),
+                   result.latency_ms.end());
+    events += result.events;
+    sent += result.frames_sent;
+    captured += result.frames_captured;
+    underruns += result.device_underruns;
+    concealed += result.playout.stretched + result.playout.compressed +
+                 result.playout.dropped + result.playout.underruns;
+    host_us += result.host_us / streams.size();
+    viewer_us += result.viewer_us / streams.size();
+  }
+
+  double mean = 0;
+  for (double v : latency) {
+    mean += v / latency.size();
+  }
+  double variance = 0;
+  for (double v : latency) {
+    variance += (v - mean) * (v - mean) / latency.size();
+  }
+
+  printf(
+      "%-8s %5zu/%-5zu %7.1f %7.1f %7.1f %7.1f %6.1f %6.1f %8llu %6llu "
+      "%7.2f %7.2f %7.3f\n",
+      profile.name.c_str(), latency.size(), events, Percentile(latency, 0.5),
+      Percentile(latency, 0.95), Percentile(latency, 1.0),
+      std::sqrt(variance), captured ? 100.0 * sent / captured : 0.0,
+      captured ? 100.0 * concealed / captured : 0.0,
+      static_cast<unsigned long long>(concealed),
+      static_cast<unsigned long long>(underruns), host_us, viewer_us,
+      100.0 * cpu / wall / config.streams);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  BenchConfig config;
+  config.signal.period_ms = 500;
+  std::string profile_name;
+  NetworkProfile custom{"custom", 0, 0, 0};
+  bool has_custom = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--no-dtx") == 0) {
+      config.dtx = false;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      break;
+    }
+    const char* value = argv[++i];
+    if (strcmp(argv[i - 1], "--profile") == 0) {
+      profile_name = value;
+    } else if (strcmp(argv[i - 1], "--streams") == 0) {
+      config.streams = (std::max)(std::atoi(value), 1);
+    } else if (strcmp(argv[i - 1], "--seconds") == 0) {
+      config.seconds = (std::max)(std::atoi(value), 1);
+    } else if (strcmp(argv[i - 1], "--signal") == 0) {
+      config.signal.signal = strcmp(value, "tone") == 0
+                                 ? SpeakerCapturerSynthetic::Signal::ToneBurst
+                                 : SpeakerCapturerSynthetic::Signal::Impulse;
+    } else if (strcmp(argv[i - 1], "--period-ms") == 0) {
+      config.signal.period_ms = (std::max)(std::atoi(value), 50);
+    } else if (strcmp(argv[i - 1], "--seed") == 0) {
+      config.seed = static_cast<uint64_t>(std::atoll(value));
+    } else if (strcmp(argv[i - 1], "--delay-ms") == 0) {
+      custom.delay_ms = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--jitter-ms") == 0) {
+      custom.jitter_ms = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--loss") == 0) {
+      custom.loss = std::atof(value);
+      has_custom = true;
+    }
+  }
+
+  //                                  name       delay jitter loss
+  std::vector<NetworkProfile> profiles = {{"local", 0, 0, 0},
+                                          {"lan", 2, 1, 0},
+                                          {"wan", 40, 10, 0.001},
+                                          {"jittery", 60, 40, 0.01}};
+  if (has_custom) {
+    profiles = {custom};
+  } else if (!profile_name.empty()) {
+    profiles.erase(std::remove_if(profiles.begin(), profiles.end(),
+                                  [&](const NetworkProfile& p) {
+                                    return p.name != profile_name;
+                                  }),
+                   profiles.end());
+    if (profiles.empty()) {
+      fprintf(stderr, "unknown profile %s\n", profile_name.c_str());
+      return 1;
+    }
+  }
+
+  printf("%d streams, %d s, %s every %d ms, dtx %s\n", config.streams,
+         config.seconds,
+         config.signal.signal == SpeakerCapturerSynthetic::Signal::Impulse
+             ? "impulse"
+             : "tone burst",
+         config.signal.period_ms, config.dtx ? "on" : "off");
+  printf(
+      "%-8s %11s %7s %7s %7s %7s %6s %6s %8s %6s %7s %7s %7s\n", "profile",
+      "heard", "m2e p50", "p95", "max", "jitter", "sent%", "conc%",
+      "concealed", "dev-ur", "host us", "view us", "cpu%/st");
+  for (const NetworkProfile& profile : profiles) {
+    RunProfile(config, profile);
+  }
+  return 0;
+}
@@ -0,0 +1,540 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Measures FileSender -> FileReceiver throughput in process for several kinds
+// of payload, with and without chunk compression and integrity checks
+// (chunk CRC + streaming digest), and a directory tree of
+// small files sent file by file versus as one session, and an updated build
+// artifact sent in full versus as a delta against the receiver's old copy.
+// Also times the remote file browser on one huge directory.
+//
+// usage: file_transfer_bench [--size-mb N] [--link-mbps N] [--tree-files N]
+//                            [--list-entries N]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "file_browser.h"
+#include "file_transfer.h"
+
+namespace {
+
+using crossdesk::FileBrowserClient;
+using crossdesk::FileBrowserHost;
+using crossdesk::FileListEntry;
+using crossdesk::FileListError;
+using crossdesk::FileListPageHeader;
+using crossdesk::FileReceiver;
+using crossdesk::FileSender;
+using crossdesk::FileTransferAck;
+
+struct Sample {
+  const char* name;
+  std::string (*generate)(size_t size, std::mt19937_64& rng);
+};
+
+std::string GenerateLog(size_t size, std::mt19937_64& rng) {
+  static const char* levels[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+  static const char* modules[] = {"render", "peer", "file_transfer",
+                                  "clipboard", "screen_capturer"};
+  std::string out;
+  out.reserve(size + 256);
+  uint64_t ts = 1760000000000ULL;
+  while (out.size() < size) {
+    ts += rng() % 50;
+    char line[256];
+    int len = snprintf(line, sizeof(line),
+                       "[%llu] [%s] [%s] connection %u state changed, "
+                       "bitrate=%u kbps rtt=%u ms\n",
+                       static_cast<unsigned long long>(ts), levels[rng() % 4],
+                       modules[rng() % 5], static_cast<unsigned>(rng() % 64),
+                       static_cast<unsigned>(rng() % 20000),
+                       static_cast<unsigned>(rng() % 300));
+    out.append(line, static_cast<size_t>(len));
+  }
+  out.resize(size);
+  return out;
+}
+
+std::string GenerateCsv(size_t size, std::mt19937_64& rng) {
+  std::string out = "id,timestamp,user,width,height,fps,bitrate\n";
+  out.reserve(size + 128);
+  uint64_t id = 0;
+  while (out.size() < size) {
+    char line[128];
+    int len = snprintf(line, sizeof(line), "%llu,%llu,user%03u,%u,%u,%u,%u\n",
+                       static_cast<unsigned long long>(id),
+                       static_cast<unsigned long long>(1760000000 + id * 3),
+                       static_cast<unsigned>(rng() % 200),
+                       rng() % 2 ? 1920u : 1280u, rng() % 2 ? 1080u : 720u,
+                       rng() % 2 ? 30u : 60u,
+                       static_cast<unsigned>(rng() % 8000));
+    out.append(line, static_cast<size_t>(len));
+    ++id;
+  }
+  out.resize(size);
+  return out;
+}
+
+std::string GenerateSource(size_t size, std::mt19937_64& rng) {
+  static const char* lines[] = {
+      "#include <string>\n",
+      "namespace crossdesk {\n",
+      "  if (!props || !props->peer_) {\n",
+      "    LOG_ERROR(\"invalid props or peer\");\n",
+      "    return -1;\n",
+      "  }\n",
+      "  std::lock_guard<std::mutex> lock(mutex_);\n",
+      "  for (auto& [remote_id, props] : client_properties_) {\n",
+      "}  // namespace crossdesk\n",
+      "\n"};
+  std::string out;
+  out.reserve(size + 64);
+  while (out.size() < size) {
+    out += lines[rng() % (sizeof(lines) / sizeof(lines[0]))];
+  }
+  out.resize(size);
+  return out;
+}
+
+std::string GenerateRandom(size_t size, std::mt19937_64& rng) {
+  std::string out(size, '\0');
+  for (size_t i = 0; i + 8 <= size; i += 8) {
+    uint64_t v = rng();
+    memcpy(&out[i], &v, 8);
+  }
+  return out;
+}
+
+std::string GenerateZeros(size_t size, std::mt19937_64&) {
+  return std::string(size, '\0');
+}
+
+struct Result {
+  uint64_t raw_bytes = 0;
+  uint64_t wire_bytes = 0;
+  double seconds = 0;
+  bool verified = false;
+};
+
+bool SameContent(const std::filesystem::path& a,
+                 const std::filesystem::path& b) {
+  std::ifstream fa(a, std::ios::binary);
+  std::ifstream fb(b, std::ios::binary);
+  std::vector<char> ba(1 << 20), bb(1 << 20);
+  while (fa && fb) {
+    fa.read(ba.data(), ba.size());
+    fb.read(bb.data(), bb.size());
+    if (fa.gcount() != fb.gcount() ||
+        memcmp(ba.data(), bb.data(), static_cast<size_t>(fa.gcount())) != 0) {
+      return false;
+    }
+  }
+  return fa.eof() && fb.eof();
+}
+
+Result RunOnce(const std::filesystem::path& src,
+               const std::filesystem::path& out_dir, bool compression,
+               bool integrity) {
+  Result result;
+  std::filesystem::remove_all(out_dir);
+  FileReceiver receiver(out_dir);
+
+  // as advertised by the receiver's capability hello
+  uint32_t peer_caps = FileReceiver::CapabilitiesAck().flags;
+  if (!integrity) {
+    peer_caps &= ~crossdesk::kFileAckIntegrity;
+  }
+  bool acked_verified = !integrity;
+  receiver.SetOnSendAck([&](const FileTransferAck& ack) -> int {
+    FileSender::OnFeedback(reinterpret_cast<const char*>(&ack), sizeof(ack));
+    if (ack.flags & crossdesk::kFileAckCompleted) {
+      acked_verified = acked_verified ||
+                       (ack.flags & crossdesk::kFileAckVerified) != 0;
+    }
+    return 0;
+  });
+  receiver.SetOnSendFeedback([](const char* data, size_t size) {
+    FileSender::OnFeedback(data, size);
+    return 0;
+  });
+
+  FileSender sender;
+  sender.SetCompressionEnabled(compression);
+  sender.SetPeerCapabilities([&peer_caps]() { return peer_caps; });
+
+  auto start = std::chrono::steady_clock::now();
+  int ret = sender.SendFile(
+      src, src.filename().string(),
+      [&](const char* data, size_t size) -> int {
+        result.wire_bytes += size;
+        return receiver.OnData(data, size) ? 0 : -1;
+      });
+  auto end = std::chrono::steady_clock::now();
+
+  result.seconds = std::chrono::duration<double>(end - start).count();
+  result.raw_bytes = std::filesystem::file_size(src);
+  result.verified = ret == 0 && acked_verified &&
+                    SameContent(src, out_dir / src.filename().string());
+  return result;
+}
+
+bool SameTree(const std::filesystem::path& a, const std::filesystem::path& b) {
+  size_t count = 0;
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(a)) {
+    std::filesystem::path other =
+        b / std::filesystem::relative(entry.path(), a);
+    if (entry.is_directory()) {
+      if (!std::filesystem::is_directory(other)) {
+        return false;
+      }
+    } else if (!SameContent(entry.path(), other)) {
+      return false;
+    }
+    ++count;
+  }
+  size_t other_count = 0;
+  for ([[maybe_unused]] const auto& entry :
+       std::filesystem::recursive_directory_iterator(b)) {
+    ++other_count;
+  }
+  return count == other_count;
+}
+
+void GenerateTree(const std::filesystem::path& root, size_t files,
+                  std::mt19937_64& rng) {
+  std::filesystem::remove_all(root);
+  for (size_t i = 0; i < files; ++i) {
+    std::filesystem::path dir = root / ("dir" + std::to_string(i % 16)) /
+                                ("sub" + std::to_string(i % 7));
+    std::filesystem::create_directories(dir);
+    size_t size = (i % 50 == 0) ? 256 * 1024 + rng() % (1024 * 1024)
+                                : rng() % (8 * 1024);
+    std::string content = GenerateSource(size, rng);
+    std::ofstream ofs(dir / ("file" + std::to_string(i) + ".cpp"),
+                      std::ios::binary);
+    ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+  std::filesystem::create_directories(root / "empty");
+}
+
+struct TreeResult {
+  uint64_t messages = 0;
+  uint64_t acks = 0;
+  uint64_t wire_bytes = 0;
+  double seconds = 0;
+  bool verified = false;
+};
+
+TreeResult RunTree(const std::filesystem::path& src,
+                   const std::filesystem::path& out_dir, bool session) {
+  TreeResult result;
+  std::filesystem::remove_all(out_dir);
+  FileReceiver receiver(out_dir);
+
+  uint32_t peer_caps = 0;
+  auto on_ack = [&](const FileTransferAck& ack) -> int {
+    ++result.acks;
+    peer_caps = ack.flags;
+    FileSender::OnFeedback(reinterpret_cast<const char*>(&ack), sizeof(ack));
+    return 0;
+  };
+  receiver.SetOnSendAck(on_ack);
+  FileReceiver* target = &receiver;
+  FileTransferAck hello = FileReceiver::CapabilitiesAck();
+  peer_caps = hello.flags;
+
+  FileSender sender;
+  sender.SetPeerCapabilities([&peer_caps]() { return peer_caps; });
+  auto send = [&](const char* data, size_t size) -> int {
+    ++result.messages;
+    result.wire_bytes += size;
+    return target->OnData(data, size) ? 0 : -1;
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  int ret = 0;
+  if (session) {
+    ret = sender.SendSession(FileSender::CollectEntries({src}), send);
+  } else {
+    // what a per-file sender has to do: one transfer per regular file. A
+    // single file carries a plain name only, so each directory gets its own
+    // receiver.
+    for (const auto& entry :
+         std::filesystem::recursive_directory_iterator(src)) {
+      std::filesystem::path relative =
+          std::filesystem::relative(entry.path(), src);
+      if (entry.is_directory()) {
+        std::filesystem::create_directories(out_dir / src.filename() /
+                                            relative);
+        continue;
+      }
+      FileReceiver dir_receiver(out_dir / src.filename() /
+                                relative.parent_path());
+      dir_receiver.SetOnSendAck(on_ack);
+      target = &dir_receiver;
+      ret = sender.SendFile(entry.path(), entry.path().filename().string(),
+                            send);
+      target = &receiver;
+      if (ret != 0) {
+        break;
+      }
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  result.seconds = std::chrono::duration<double>(end - start).count();
+  result.verified = ret == 0 && SameTree(src, out_dir / src.filename());
+  return result;
+}
+
+// an old and a new version of a build artifact: a few bytes inserted and
+// removed, a region rewritten and some data appended.
+void GenerateArtifacts(const std::filesystem::path& old_path,
+                       const std::filesystem::path& new_path, size_t size,
+                       std::mt19937_64& rng) {
+  std::string old_content = GenerateRandom(size, rng);
+  std::string new_content = old_content;
+  new_content.insert(size / 10, GenerateSource(100, rng));
+  size_t rewrite = std::min<size_t>(64 * 1024, size / 4);
+  new_content.replace(size / 2, rewrite, GenerateRandom(rewrite, rng));
+  new_content.erase(size * 8 / 10, std::min<size_t>(4096, size / 10));
+  new_content += GenerateRandom(1024 * 1024, rng);
+
+  std::ofstream(old_path, std::ios::binary)
+      .write(old_content.data(),
+             static_cast<std::streamsize>(old_content.size()));
+  std::ofstream(new_path, std::ios::binary)
+      .write(new_content.data(),
+             static_cast<std::streamsize>(new_content.size()));
+}
+
+Result RunDelta(const std::filesystem::path& old_path,
+                const std::filesystem::path& new_path,
+                const std::filesystem::path& out_dir, bool delta) {
+  Result result;
+  std::filesystem::remove_all(out_dir);
+  std::filesystem::create_directories(out_dir);
+  std::filesystem::path target = out_dir / "artifact.bin";
+  if (delta) {
+    std::filesystem::copy_file(old_path, target);
+  }
+
+  FileReceiver receiver(out_dir);
+  receiver.SetOnSendAck([](const FileTransferAck& ack) -> int {
+    FileSender::OnFeedback(reinterpret_cast<const char*>(&ack), sizeof(ack));
+    return 0;
+  });
+  receiver.SetOnSendFeedback([&result](const char* data, size_t size) {
+    // signature pages travel back to the sender
+    result.wire_bytes += size;
+    FileSender::OnFeedback(data, size);
+    return 0;
+  });
+
+  FileSender sender;
+  sender.SetPeerCapabilities(
+      []() { return FileReceiver::CapabilitiesAck().flags; });
+  auto send = [&](const char* data, size_t size) -> int {
+    result.wire_bytes += size;
+    return receiver.OnData(data, size) ? 0 : -1;
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  int ret = delta ? sender.SendFileDelta(new_path, "artifact.bin", send)
+                  : sender.SendFile(new_path, "artifact.bin", send);
+  auto end = std::chrono::steady_clock::now();
+
+  result.seconds = std::chrono::duration<double>(end - start).count();
+  result.raw_bytes = std::filesystem::file_size(new_path);
+  // a verified delta replaces the receiver's copy
+  result.verified = ret == 0 && SameContent(new_path, target);
+  return result;
+}
+
+struct ListResult {
+  double read_seconds = 0;
+  double encode_seconds = 0;
+  double decode_seconds = 0;
+  uint64_t pages = 0;
+  uint64_t wire_bytes = 0;
+  size_t entries = 0;
+  bool verified = false;
+};
+
+ListResult RunListing(const std::filesystem::path& dir) {
+  ListResult result;
+  std::vector<FileListEntry> entries;
+
+  auto start = std::chrono::steady_clock::now();
+  FileListError error = FileBrowserHost::ReadDirectory(dir.string(), entries);
+  auto read_end = std::chrono::steady_clock::now();
+  if (error != FileListError::None) {
+    return result;
+  }
+
+  std::vector<std::vector<char>> pages;
+  FileBrowserHost::EncodePages(1, 1, dir.generic_string(), entries, 0, 0, 0,
+                               48 * 1024, [&](const char* data, size_t size) {
+                                 pages.emplace_back(data, data + size);
+                                 return 0;
+                               });
+  auto encode_end = std::chrono::steady_clock::now();
+
+  std::vector<FileListEntry> decoded;
+  decoded.reserve(entries.size());
+  bool decoded_ok = true;
+  for (const auto& page : pages) {
+    FileListPageHeader header{};
+    std::string path;
+    std::vector<FileListEntry> page_entries;
+    decoded_ok &= FileBrowserClient::DecodePage(page.data(), page.size(),
+                                                header, path, page_entries);
+    decoded.insert(decoded.end(), page_entries.begin(), page_entries.end());
+    result.wire_bytes += page.size();
+  }
+  auto decode_end = std::chrono::steady_clock::now();
+
+  result.read_seconds = std::chrono::duration<double>(read_end - start).count();
+  result.encode_seconds =
+      std::chrono::duration<double>(encode_end - read_end).count();
+  result.decode_seconds =
+      std::chrono::duration<double>(decode_end - encode_end).count();
+  result.pages = pages.size();
+  result.entries = entries.size();
+  result.verified = decoded_ok && decoded.size() == entries.size();
+  for (size_t i = 0; result.verified && i < entries.size(); ++i) {
+    result.verified = decoded[i].name == entries[i].name &&
+                      decoded[i].size == entries[i].size &&
+                      decoded[i].type == entries[i].type;
+  }
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t size_mb = 64;
+  double link_mbps = 100.0;
+  size_t tree_files = 2000;
+  size_t list_entries = 100000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--size-mb") == 0) {
+      size_mb = static_cast<size_t>(std::atoll(argv[i + 1]));
+    } else if (strcmp(argv[i], "--link-mbps") == 0) {
+      link_mbps = std::atof(argv[i + 1]);
+    } else if (strcmp(argv[i], "--tree-files") == 0) {
+      tree_files = static_cast<size_t>(std::atoll(argv[i + 1]));
+    } else if (strcmp(argv[i], "--list-entries") == 0) {
+      list_entries = static_cast<size_t>(std::atoll(argv[i + 1]));
+    }
+  }
+
+  const Sample samples[] = {{"log", GenerateLog},
+                            {"csv", GenerateCsv},
+                            {"source", GenerateSource},
+                            {"random", GenerateRandom},
+                            {"zeros", GenerateZeros}};
+
+  std::filesystem::path work_dir =
+      std::filesystem::temp_directory_path() / "crossdesk_file_bench";
+  std::filesystem::create_directories(work_dir);
+  std::mt19937_64 rng(20261019);
+
+  printf("payload %zu MB, simulated link %.0f Mbps\n", size_mb, link_mbps);
+  printf("%-8s %-5s %-6s %10s %8s %12s %14s %s\n", "type", "codec", "check",
+         "wire MB", "ratio", "cpu MB/s", "effective MB/s", "verified");
+
+  for (const Sample& sample : samples) {
+    std::filesystem::path src = work_dir / (std::string(sample.name) + ".dat");
+    {
+      std::string content = sample.generate(size_mb * 1024 * 1024, rng);
+      std::ofstream ofs(src, std::ios::binary | std::ios::trunc);
+      ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    for (int mode = 0; mode < 4; ++mode) {
+      bool compression = (mode & 1) != 0;
+      bool integrity = (mode & 2) != 0;
+      Result r = RunOnce(src, work_dir / "out", compression, integrity);
+      double raw_mb = r.raw_bytes / (1024.0 * 1024.0);
+      double wire_mb = r.wire_bytes / (1024.0 * 1024.0);
+      // the slower of CPU and wire time bounds what the user actually sees
+      double link_seconds = r.wire_bytes * 8.0 / (link_mbps * 1000 * 1000);
+      double effective_seconds = std::max(r.seconds, link_seconds);
+      printf("%-8s %-5s %-6s %10.1f %8.2f %12.1f %14.1f %s\n", sample.name,
+             compression ? "lz4" : "none", integrity ? "yes" : "no", wire_mb,
+             r.wire_bytes ? static_cast<double>(r.raw_bytes) / r.wire_bytes
+                          : 0.0,
+             r.seconds > 0 ? raw_mb / r.seconds : 0.0,
+             effective_seconds > 0 ? raw_mb / effective_seconds : 0.0,
+             r.verified ? "yes" : "NO");
+    }
+    std::filesystem::remove(src);
+  }
+
+  std::filesystem::path tree = work_dir / "tree";
+  GenerateTree(tree, tree_files, rng);
+  printf("\ntree of %zu files\n", tree_files);
+  printf("%-8s %10s %8s %10s %10s %s\n", "mode", "messages", "acks",
+         "wire MB", "seconds", "verified");
+  for (bool session : {false, true}) {
+    TreeResult r = RunTree(tree, work_dir / "tree_out", session);
+    printf("%-8s %10llu %8llu %10.1f %10.3f %s\n",
+           session ? "session" : "per-file",
+           static_cast<unsigned long long>(r.messages),
+           static_cast<unsigned long long>(r.acks),
+           r.wire_bytes / (1024.0 * 1024.0), r.seconds,
+           r.verified ? "yes" : "NO");
+  }
+
+  std::filesystem::path old_artifact = work_dir / "artifact_old.bin";
+  std::filesystem::path new_artifact = work_dir / "artifact_new.bin";
+  GenerateArtifacts(old_artifact, new_artifact, size_mb * 1024 * 1024, rng);
+  printf("\nupdated %zu MB artifact\n", size_mb);
+  printf("%-8s %10s %10s %14s %s\n", "mode", "wire MB", "seconds",
+         "effective MB/s", "verified");
+  for (bool delta : {false, true}) {
+    Result r = RunDelta(old_artifact, new_artifact, work_dir / "delta_out",
+                        delta);
+    double link_seconds = r.wire_bytes * 8.0 / (link_mbps * 1000 * 1000);
+    double effective_seconds = std::max(r.seconds, link_seconds);
+    printf("%-8s %10.1f %10.3f %14.1f %s\n", delta ? "delta" : "full",
+           r.wire_bytes / (1024.0 * 1024.0), r.seconds,
+           effective_seconds > 0
+               ? r.raw_bytes / (1024.0 * 1024.0) / effective_seconds
+               : 0.0,
+           r.verified ? "yes" : "NO");
+  }
+
+  std::filesystem::path big_dir = work_dir / "big_dir";
+  std::filesystem::create_directories(big_dir);
+  for (size_t i = 0; i < list_entries; ++i) {
+    char name[64];
+    snprintf(name, sizeof(name), "IMG_%08zu.jpg", i);
+    std::ofstream(big_dir / name, std::ios::binary) << i;
+  }
+  ListResult l = RunListing(big_dir);
+  printf("\nlisting of %zu entries\n", l.entries);
+  printf("%10s %10s %10s %8s %10s %10s %s\n", "read ms", "encode ms",
+         "decode ms", "pages", "wire KB", "B/entry", "verified");
+  printf("%10.1f %10.1f %10.1f %8llu %10.1f %10.1f %s\n",
+         l.read_seconds * 1000, l.encode_seconds * 1000,
+         l.decode_seconds * 1000, static_cast<unsigned long long>(l.pages),
+         l.wire_bytes / 1024.0,
+         l.entries ? static_cast<double>(l.wire_bytes) / l.entries : 0.0,
+         l.verified ? "yes" : "NO");
+
+  std::filesystem::remove_all(work_dir);
+  return 0;
+}
@@ -0,0 +1,626 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Runs FileSender::SendFile -> FileReceiver::OnData through a simulated data
+// channel and reports throughput, CPU per GB and ACK overhead, then compares
+// the received file byte for byte with the source.
+//
+// The channel models what the reliable "file" label gives the application: a
+// packet link with latency, bandwidth, loss, reordering and duplication below
+// an ordered, reliable delivery layer. Lost packets are retransmitted one
+// round trip later, reordered packets are held back until the gap is filled
+// and duplicates are dropped, so these faults cost time and bandwidth but
+// never reach the receiver. Corruption is injected above the transport, one
+// payload byte of a file chunk is flipped, which exercises the chunk CRC and
+// NACK repair path.
+//
+// Time is simulated: the sender and the receiver each advance their own clock
+// by the CPU time they actually spend, the link adds serialization and
+// propagation delay. Large sizes use sparse files, the receiver writes them
+// out in full, so --max-size-gb 50 needs 50 GB of free disk.
+//
+// Every profile runs once at --size-mb, then the size sweep runs over
+// --profile. Any of the channel flags defines a "custom" profile that
+// replaces it.
+//
+// usage: file_transfer_fault_bench [--profile NAME] [--size-mb N]
+//                                  [--max-size-gb N] [--latency-ms N]
+//                                  [--bandwidth-mbps N] [--loss P]
+//                                  [--reorder P] [--duplicate P]
+//                                  [--corrupt P] [--no-compression]
+//                                  [--seed N]
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "file_transfer.h"
+
+namespace {
+
+using crossdesk::FileChunkHeader;
+using crossdesk::FileReceiver;
+using crossdesk::FileSender;
+using crossdesk::FileTransferAck;
+
+// DTLS/SCTP payload per packet and the headers added to it
+constexpr size_t kPacketPayload = 1200;
+constexpr size_t kPacketOverhead = 48;
+// the transport buffers this much before SendReliableDataFrame blocks
+constexpr double kSendBufferBytes = 4.0 * 1024 * 1024;
+
+struct ChannelConfig {
+  std::string name;
+  double latency_ms = 0;      // one way
+  double bandwidth_mbps = 0;  // 0 means unlimited
+  double loss = 0;            // per packet
+  double reorder = 0;         // per packet
+  double duplicate = 0;       // per packet
+  double corrupt = 0;         // per file chunk
+};
+
+double ProcessCpuSeconds() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel,
+                       &user)) {
+    return 0;
+  }
+  auto to_seconds = [](const FILETIME& t) {
+    ULARGE_INTEGER v;
+    v.LowPart = t.dwLowDateTime;
+    v.HighPart = t.dwHighDateTime;
+    return v.QuadPart / 1e7;
+  };
+  return to_seconds(kernel) + to_seconds(user);
+#else
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+         usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+#endif
+}
+
+double RealSeconds() {
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// One direction of the channel. Messages are cut into packets that share the
+// link's bandwidth, a message is delivered once all of its packets and every
+// message sent before it have arrived.
+class SimLink {
+ public:
+  struct Stats {
+    uint64_t messages = 0;
+    uint64_t bytes = 0;       // application bytes
+    uint64_t wire_bytes = 0;  // including headers, retransmissions, duplicates
+    uint64_t packets = 0;
+    uint64_t retransmitted = 0;
+    uint64_t reordered = 0;
+    uint64_t duplicated = 0;
+  };
+
+ public:
+  SimLink(const ChannelConfig& config, uint64_t seed)
+      : config_(config), rng_(seed) {}
+
+  // returns the time the receiver gets a message of `size` bytes sent at
+  // `now`, seconds.
+  double Transmit(double now, size_t size) {
+    double latency = config_.latency_ms / 1000.0;
+    double arrived = now;
+    size_t remaining = (std::max)(size, static_cast<size_t>(1));
+    ++stats_.messages;
+    stats_.bytes += size;
+
+    while (remaining > 0) {
+      size_t payload = (std::min)(remaining, kPacketPayload);
+      remaining -= payload;
+      double serialize = SerializeSeconds(payload);
+      double sent = (std::max)(now, link_free_) + serialize;
+      link_free_ = sent;
+      Account(payload);
+      double arrival = sent + latency;
+
+      // the loss is noticed about one round trip after the packet was due,
+      // the resend takes the next free slot on the link
+      while (Chance(config_.loss)) {
+        ++stats_.retransmitted;
+        link_free_ += serialize;
+        Account(payload);
+        arrival = (std::max)(arrival + 2 * latency + serialize,
+                             link_free_ + latency);
+      }
+      if (Chance(config_.duplicate)) {
+        ++stats_.duplicated;
+        link_free_ += serialize;
+        Account(payload);
+      }
+      if (Chance(config_.reorder)) {
+        ++stats_.reordered;
+        std::uniform_real_distribution<double> extra(
+            0.0, (std::max)(0.002, latency * 0.5));
+        arrival += extra(rng_);
+      }
+      arrived = (std::max)(arrived, arrival);
+    }
+
+    last_delivery_ = (std::max)(last_delivery_, arrived);
+    return last_delivery_;
+  }
+
+  // time the link has worked off everything sent so far.
+  double BusyUntil() const { return link_free_; }
+
+  double SecondsPerByte() const {
+    return config_.bandwidth_mbps > 0
+               ? 8.0 / (config_.bandwidth_mbps * 1000 * 1000)
+               : 0.0;
+  }
+
+  bool Chance(double p) {
+    if (p <= 0) {
+      return false;
+    }
+    return std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < p;
+  }
+
+  std::mt19937_64& Rng() { return rng_; }
+
+  const Stats& GetStats() const { return stats_; }
+
+ private:
+  double SerializeSeconds(size_t payload) const {
+    return (payload + kPacketOverhead) * SecondsPerByte();
+  }
+
+  void Account(size_t payload) {
+    ++stats_.packets;
+    stats_.wire_bytes += payload + kPacketOverhead;
+  }
+
+ private:
+  ChannelConfig config_;
+  std::mt19937_64 rng_;
+  double link_free_ = 0;
+  double last_delivery_ = 0;
+  Stats stats_;
+};
+
+struct RunResult {
+  uint64_t file_size = 0;
+  SimLink::Stats forward;
+  SimLink::Stats backward;
+  uint64_t acks = 0;
+  uint64_t corrupted = 0;
+  double sim_seconds = 0;
+  double wall_seconds = 0;
+  double cpu_seconds = 0;
+  bool completed = false;
+  bool verified = false;
+};
+
+// Drives one transfer. Sender and receiver run on this thread, messages wait
+// in a queue ordered by their arrival time until the side they go to has
+// caught up with it.
+class SimTransfer {
+ public:
+  SimTransfer(const ChannelConfig& config, uint64_t seed,
+              const std::filesystem::path& out_dir)
+      : config_(config),
+        forward_(config, seed),
+        backward_(config, seed ^ 0x9E3779B97F4A7C15ull),
+        receiver_(out_dir) {
+    receiver_.SetOnSendAck([this](const FileTransferAck& ack) -> int {
+      ++result_.acks;
+      Reply(reinterpret_cast<const char*>(&ack), sizeof(ack));
+      return 0;
+    });
+    receiver_.SetOnSendFeedback([this](const char* data, size_t size) -> int {
+      Reply(data, size);
+      return 0;
+    });
+  }
+
+  RunResult Run(const std::filesystem::path& src, bool compression) {
+    result_.file_size = std::filesystem::file_size(src);
+
+    FileSender sender;
+    sender.SetCompressionEnabled(compression);
+    // as advertised by the receiver's capability hello
+    uint32_t peer_caps = FileReceiver::CapabilitiesAck().flags;
+    sender.SetPeerCapabilities([peer_caps]() { return peer_caps; });
+    file_id_ = FileSender::NextFileId();
+
+    double cpu_start = ProcessCpuSeconds();
+    double wall_start = RealSeconds();
+    last_sender_exit_ = wall_start;
+
+    int ret = sender.SendFile(
+        src, src.filename().string(),
+        [this](const char* data, size_t size) -> int {
+          return Send(data, size);
+        },
+        64 * 1024, file_id_);
+
+    // the sender is done, work off everything still on the way
+    if (ret == 0) {
+      sender_clock_ += RealSeconds() - last_sender_exit_;
+      while (!events_.empty() && !result_.completed) {
+        Dispatch();
+      }
+    }
+
+    result_.wall_seconds = RealSeconds() - wall_start;
+    result_.cpu_seconds = ProcessCpuSeconds() - cpu_start;
+    result_.forward = forward_.GetStats();
+    result_.backward = backward_.GetStats();
+    return result_;
+  }
+
+ private:
+  struct Event {
+    double time;
+    uint64_t sequence;
+    bool to_receiver;
+    std::vector<char> data;
+  };
+
+  struct Later {
+    bool operator()(const Event& a, const Event& b) const {
+      if (a.time != b.time) {
+        return a.time > b.time;
+      }
+      return a.sequence > b.sequence;
+    }
+  };
+
+  int Send(const char* data, size_t size) {
+    double enter = RealSeconds();
+    if (!dispatching_) {
+      sender_clock_ += enter - last_sender_exit_;
+    }
+
+    // a full send buffer blocks the sender until the link drained it
+    double spb = forward_.SecondsPerByte();
+    if (spb > 0) {
+      double drained_at = forward_.BusyUntil() - kSendBufferBytes * spb;
+      sender_clock_ = (std::max)(sender_clock_, drained_at);
+    }
+
+    std::vector<char> message(data, data + size);
+    MaybeCorrupt(message);
+    double arrival = forward_.Transmit(sender_clock_, size);
+    events_.push({arrival, sequence_++, true, std::move(message)});
+
+    // resends triggered by feedback come back in here, they only queue
+    if (!dispatching_) {
+      while (!events_.empty() && events_.top().time <= sender_clock_) {
+        Dispatch();
+      }
+      last_sender_exit_ = RealSeconds();
+    }
+    return 0;
+  }
+
+  // flip one payload byte of a file chunk that carries data.
+  void MaybeCorrupt(std::vector<char>& message) {
+    if (message.size() < sizeof(FileChunkHeader) ||
+        !forward_.Chance(config_.corrupt)) {
+      return;
+    }
+    FileChunkHeader header;
+    memcpy(&header, message.data(), sizeof(header));
+    if (header.magic != crossdesk::kFileChunkMagic || header.chunk_size == 0 ||
+        message.size() < header.chunk_size) {
+      return;
+    }
+    size_t payload_start = message.size() - header.chunk_size;
+    size_t at = payload_start + std::uniform_int_distribution<size_t>(
+                                    0, header.chunk_size - 1)(forward_.Rng());
+    message[at] = static_cast<char>(message[at] ^ 0x5A);
+    ++result_.corrupted;
+  }
+
+  void Reply(const char* data, size_t size) {
+    // sent partway through the receiver's processing of the current message
+    double now = receiver_clock_ + (RealSeconds() - receiver_start_);
+    double arrival = backward_.Transmit(now, size);
+    events_.push({arrival, sequence_++, false,
+                  std::vector<char>(data, data + size)});
+  }
+
+  void Dispatch() {
+    Event event = events_.top();
+    events_.pop();
+    dispatching_ = true;
+
+    if (event.to_receiver) {
+      receiver_clock_ = (std::max)(receiver_clock_, event.time);
+      receiver_start_ = RealSeconds();
+      receiver_.OnData(event.data.data(), event.data.size());
+      receiver_clock_ += RealSeconds() - receiver_start_;
+    } else {
+      sender_clock_ = (std::max)(sender_clock_, event.time);
+      double start = RealSeconds();
+      if (!FileSender::OnFeedback(event.data.data(), event.data.size()) &&
+          event.data.size() == sizeof(FileTransferAck)) {
+        FileTransferAck ack;
+        memcpy(&ack, event.data.data(), sizeof(ack));
+        if (ack.magic == crossdesk::kFileAckMagic && ack.file_id == file_id_ &&
+            (ack.flags & crossdesk::kFileAckCompleted)) {
+          result_.completed = (ack.flags & crossdesk::kFileAckError) == 0;
+          result_.sim_seconds = event.time;
+        }
+      }
+      sender_clock_ += RealSeconds() - start;
+    }
+
+    dispatching_ = false;
+  }
+
+ private:
+  ChannelConfig config_;
+  SimLink forward_;
+  SimLink backward_;
+  FileReceiver receiver_;
+  uint32_t file_id_ = 0;
+
+  std::priority_queue<Event, std::vector<Event>, Later> events_;
+  uint64_t sequence_ = 0;
+  bool dispatching_ = false;
+
+  double sender_clock_ = 0;
+  double receiver_clock_ = 0;
+  double last_sender_exit_ = 0;
+  double receiver_start_ = 0;  // real time the current OnData began
+
+  RunResult result_;
+};
+
+bool SameContent(const std::filesystem::path& a,
+                 const std::filesystem::path& b) {
+  std::error_code ec;
+  if (std::filesystem::file_size(a, ec) != std::filesystem::file_size(b, ec) ||
+      ec) {
+    return false;
+  }
+  std::ifstream fa(a, std::ios::binary);
+  std::ifstream fb(b, std::ios::binary);
+  std::vector<char> ba(1 << 20), bb(1 << 20);
+  while (fa && fb) {
+    fa.read(ba.data(), ba.size());
+    fb.read(bb.data(), bb.size());
+    if (fa.gcount() != fb.gcount() ||
+        memcmp(ba.data(), bb.data(), static_cast<size_t>(fa.gcount())) != 0) {
+      return false;
+    }
+  }
+  return fa.eof() && fb.eof();
+}
+
+// small files are random, large ones sparse with random blocks scattered
+// over them so a misplaced chunk still shows up in the comparison.
+void GenerateFile(const std::filesystem::path& path, uint64_t size,
+                  std::mt19937_64& rng) {
+  constexpr uint64_t kDenseLimit = 64ull * 1024 * 1024;
+  constexpr uint64_t kMarkerStride = 256ull * 1024 * 1024;
+  constexpr size_t kMarkerSize = 4096;
+
+  std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+  auto write_random = [&](uint64_t count) {
+    std::vector<char> block(1 << 20);
+    while (count > 0) {
+      size_t n = static_cast<size_t>((std::min<uint64_t>)(count, block.size()));
+      for (size_t i = 0; i < n; i += 8) {
+        uint64_t v = rng();
+        memcpy(block.data() + i, &v, (std::min)(static_cast<size_t>(8), n - i));
+      }
+      ofs.write(block.data(), static_cast<std::streamsize>(n));
+      count -= n;
+    }
+  };
+
+  if (size <= kDenseLimit) {
+    write_random(size);
+    return;
+  }
+
+  ofs.close();
+  std::filesystem::resize_file(path, size);
+  ofs.open(path, std::ios::binary | std::ios::in | std::ios::out);
+  for (uint64_t at = 0; at < size; at += kMarkerStride) {
+    ofs.seekp(static_cast<std::streamoff>(at));
+    write_random((std::min<uint64_t>)(kMarkerSize, size - at));
+  }
+  uint64_t tail = (std::min<uint64_t>)(kMarkerSize, size);
+  ofs.seekp(static_cast<std::streamoff>(size - tail));
+  write_random(tail);
+}
+
+std::string FormatSize(uint64_t size) {
+  char buf[32];
+  if (size >= 1024ull * 1024 * 1024) {
+    snprintf(buf, sizeof(buf), "%.0f GB", size / (1024.0 * 1024 * 1024));
+  } else if (size >= 1024 * 1024) {
+    snprintf(buf, sizeof(buf), "%.0f MB", size / (1024.0 * 1024));
+  } else {
+    snprintf(buf, sizeof(buf), "%llu B", static_cast<unsigned long long>(size));
+  }
+  return buf;
+}
+
+void PrintHeader() {
+  printf("%-8s %9s %9s %8s %7s %8s %7s %9s %9s %9s %8s %s\n", "profile",
+         "size", "wire MB", "acks", "ack %", "resent", "corrupt", "sim s",
+         "MB/s", "wall s", "cpu s/GB", "verified");
+}
+
+void PrintResult(const std::string& profile, const RunResult& r) {
+  double size_mb = r.file_size / (1024.0 * 1024.0);
+  double ack_pct = r.forward.wire_bytes
+                       ? 100.0 * r.backward.wire_bytes / r.forward.wire_bytes
+                       : 0.0;
+  double gb = r.file_size / (1024.0 * 1024.0 * 1024.0);
+  printf("%-8s %9s %9.1f %8llu %7.3f %8llu %7llu %9.3f %9.1f %9.3f %8.2f %s\n",
+         profile.c_str(), FormatSize(r.file_size).c_str(),
+         r.forward.wire_bytes / (1024.0 * 1024.0),
+         static_cast<unsigned long long>(r.acks), ack_pct,
+         static_cast<unsigned long long>(r.forward.retransmitted),
+         static_cast<unsigned long long>(r.corrupted), r.sim_seconds,
+         r.sim_seconds > 0 ? size_mb / r.sim_seconds : 0.0, r.wall_seconds,
+         gb > 0.001 ? r.cpu_seconds / gb : 0.0,
+         r.completed && r.verified ? "yes" : "NO");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string profile_name = "lossy";
+  size_t size_mb = 64;
+  double max_size_gb = 1;
+  bool compression = true;
+  uint64_t seed = 20261019;
+  ChannelConfig custom;
+  custom.name = "custom";
+  bool has_custom = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--no-compression") == 0) {
+      compression = false;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      break;
+    }
+    const char* value = argv[++i];
+    if (strcmp(argv[i - 1], "--profile") == 0) {
+      profile_name = value;
+    } else if (strcmp(argv[i - 1], "--size-mb") == 0) {
+      size_mb = static_cast<size_t>(std::atoll(value));
+    } else if (strcmp(argv[i - 1], "--max-size-gb") == 0) {
+      max_size_gb = std::atof(value);
+    } else if (strcmp(argv[i - 1], "--seed") == 0) {
+      seed = static_cast<uint64_t>(std::atoll(value));
+    } else if (strcmp(argv[i - 1], "--latency-ms") == 0) {
+      custom.latency_ms = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--bandwidth-mbps") == 0) {
+      custom.bandwidth_mbps = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--loss") == 0) {
+      custom.loss = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--reorder") == 0) {
+      custom.reorder = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--duplicate") == 0) {
+      custom.duplicate = std::atof(value);
+      has_custom = true;
+    } else if (strcmp(argv[i - 1], "--corrupt") == 0) {
+      custom.corrupt = std::atof(value);
+      has_custom = true;
+    }
+  }
+
+  //              name      latency  Mbps   loss   reorder dup    corrupt
+  std::vector<ChannelConfig> profiles = {
+      {"ideal", 0, 0, 0, 0, 0, 0},
+      {"lan", 0.5, 1000, 0, 0, 0, 0},
+      {"wan", 30, 100, 0.001, 0.001, 0, 0},
+      {"lossy", 40, 50, 0.02, 0.01, 0.005, 0.001},
+      {"mobile", 80, 10, 0.05, 0.05, 0.01, 0.001}};
+  if (has_custom) {
+    profiles.push_back(custom);
+    profile_name = custom.name;
+  }
+
+  const ChannelConfig* sweep_profile = nullptr;
+  for (const ChannelConfig& profile : profiles) {
+    if (profile.name == profile_name) {
+      sweep_profile = &profile;
+    }
+  }
+  if (!sweep_profile) {
+    fprintf(stderr, "unknown profile %s\n", profile_name.c_str());
+    return 1;
+  }
+
+  std::filesystem::path work_dir =
+      std::filesystem::temp_directory_path() / "crossdesk_fault_bench";
+  std::filesystem::remove_all(work_dir);
+  std::filesystem::create_directories(work_dir);
+  std::mt19937_64 rng(seed);
+  bool all_verified = true;
+
+  auto run = [&](const ChannelConfig& config, uint64_t size) {
+    std::filesystem::path src = work_dir / "source.bin";
+    std::filesystem::path out_dir = work_dir / "out";
+    GenerateFile(src, size, rng);
+    std::filesystem::remove_all(out_dir);
+
+    RunResult r;
+    {
+      SimTransfer transfer(config, rng(), out_dir);
+      r = transfer.Run(src, compression);
+    }
+    r.verified = SameContent(src, out_dir / src.filename());
+    all_verified = all_verified && r.completed && r.verified;
+    PrintResult(config.name, r);
+
+    std::filesystem::remove_all(out_dir);
+    std::filesystem::remove(src);
+  };
+
+  printf("%zu MB over every channel profile, compression %s\n", size_mb,
+         compression ? "on" : "off");
+  PrintHeader();
+  for (const ChannelConfig& profile : profiles) {
+    run(profile, static_cast<uint64_t>(size_mb) * 1024 * 1024);
+  }
+
+  // sizes around the 64 KB chunk boundary, up to sparse 50 GB
+  const uint64_t sizes[] = {0,
+                            1,
+                            64 * 1024 - 1,
+                            64 * 1024,
+                            64 * 1024 + 1,
+                            1024 * 1024 + 7,
+                            64ull * 1024 * 1024,
+                            1024ull * 1024 * 1024,
+                            50ull * 1024 * 1024 * 1024};
+  printf("\nsize sweep over %s (sizes above %g GB skipped)\n",
+         sweep_profile->name.c_str(), max_size_gb);
+  PrintHeader();
+  for (uint64_t size : sizes) {
+    if (size > max_size_gb * 1024 * 1024 * 1024) {
+      continue;
+    }
+    run(*sweep_profile, size);
+  }
+
+  std::filesystem::remove_all(work_dir);
+  return all_verified ? 0 : 1;
+}
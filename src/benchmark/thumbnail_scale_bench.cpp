@@ -0,0 +1,192 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+// Times the thumbnail downscale of one NV12 frame: the fused box filter in
+// ScaleNv12ToRgba against the former libyuv path (NV12 -> I420 copy of the
+// full frame, I420Scale, I420ToABGR, then the letterbox copy). Reports the
+// time per thumbnail and the PSNR between the two outputs for several
+// source sizes.
+//
+// usage: thumbnail_scale_bench [--iterations N] [--width N] [--height N]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "libyuv.h"
+#include "nv12_scale.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kThumbnailWidth = 160;
+constexpr int kThumbnailHeight = 90;
+
+// the implementation ScaleNv12ToRgba replaced
+void ScaleNv12ToABGRLibyuv(const uint8_t* src, int src_w, int src_h,
+                           uint8_t* dst_rgba, int dst_w, int dst_h) {
+  const uint8_t* y = src;
+  const uint8_t* uv = y + src_w * src_h;
+
+  float src_aspect = float(src_w) / src_h;
+  float dst_aspect = float(dst_w) / dst_h;
+  int fit_w = dst_w, fit_h = dst_h;
+  if (src_aspect > dst_aspect) {
+    fit_h = int(dst_w / src_aspect);
+  } else {
+    fit_w = int(dst_h * src_aspect);
+  }
+
+  std::vector<uint8_t> y_i420(src_w * src_h);
+  std::vector<uint8_t> u_i420((src_w / 2) * (src_h / 2));
+  std::vector<uint8_t> v_i420((src_w / 2) * (src_h / 2));
+  libyuv::NV12ToI420(y, src_w, uv, src_w, y_i420.data(), src_w, u_i420.data(),
+                     src_w / 2, v_i420.data(), src_w / 2, src_w, src_h);
+
+  std::vector<uint8_t> y_fit(fit_w * fit_h);
+  std::vector<uint8_t> u_fit((fit_w + 1) / 2 * (fit_h + 1) / 2);
+  std::vector<uint8_t> v_fit((fit_w + 1) / 2 * (fit_h + 1) / 2);
+  libyuv::I420Scale(y_i420.data(), src_w, u_i420.data(), src_w / 2,
+                    v_i420.data(), src_w / 2, src_w, src_h, y_fit.data(), fit_w,
+                    u_fit.data(), (fit_w + 1) / 2, v_fit.data(),
+                    (fit_w + 1) / 2, fit_w, fit_h, libyuv::kFilterBilinear);
+
+  std::vector<uint8_t> abgr(fit_w * fit_h * 4);
+  libyuv::I420ToABGR(y_fit.data(), fit_w, u_fit.data(), (fit_w + 1) / 2,
+                     v_fit.data(), (fit_w + 1) / 2, abgr.data(), fit_w * 4,
+                     fit_w, fit_h);
+
+  memset(dst_rgba, 0, dst_w * dst_h * 4);
+  for (int i = 0; i < dst_w * dst_h; ++i) {
+    dst_rgba[i * 4 + 3] = 0xFF;
+  }
+
+  for (int row = 0; row < fit_h; ++row) {
+    int dst_offset =
+        ((row + (dst_h - fit_h) / 2) * dst_w + (dst_w - fit_w) / 2) * 4;
+    memcpy(dst_rgba + dst_offset, abgr.data() + row * fit_w * 4, fit_w * 4);
+  }
+}
+
+// desktop-like content: flat panels, gradients and noisy text-sized detail
+std::vector<uint8_t> GenerateFrame(int width, int height, std::mt19937& rng) {
+  std::vector<uint8_t> frame(static_cast<size_t>(width) * height * 3 / 2);
+  std::uniform_int_distribution<int> noise(-40, 40);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      int value = (x * 255 / width + y * 128 / height) & 0xFF;
+      if ((y / 24) % 3 == 1 && x > width / 8 && x < width * 7 / 8) {
+        value = std::min(235, std::max(16, value + noise(rng)));
+      }
+      frame[static_cast<size_t>(y) * width + x] = static_cast<uint8_t>(value);
+    }
+  }
+  uint8_t* uv = frame.data() + static_cast<size_t>(width) * height;
+  for (int y = 0; y < height / 2; ++y) {
+    for (int x = 0; x < width / 2; ++x) {
+      uv[static_cast<size_t>(y) * width + 2 * x] =
+          static_cast<uint8_t>(128 + (x * 64 / width) - 16);
+      uv[static_cast<size_t>(y) * width + 2 * x + 1] =
+          static_cast<uint8_t>(128 - (y * 64 / height) + 16);
+    }
+  }
+  return frame;
+}
+
+double Psnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+  double sum = 0;
+  size_t count = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (i % 4 == 3) {
+      continue;
+    }
+    double diff = double(a[i]) - double(b[i]);
+    sum += diff * diff;
+    ++count;
+  }
+  if (sum == 0) {
+    return INFINITY;
+  }
+  return 10.0 * std::log10(255.0 * 255.0 / (sum / count));
+}
+
+template <typename Scale>
+double MicrosPerCall(Scale scale, int iterations) {
+  auto start = Clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    scale();
+  }
+  return std::chrono::duration<double, std::micro>(Clock::now() - start)
+             .count() /
+         iterations;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int iterations = 50;
+  int width = 0;
+  int height = 0;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "--iterations") == 0) {
+      iterations = std::max(1, std::atoi(argv[i + 1]));
+    } else if (strcmp(argv[i], "--width") == 0) {
+      width = std::atoi(argv[i + 1]) & ~1;
+    } else if (strcmp(argv[i], "--height") == 0) {
+      height = std::atoi(argv[i + 1]) & ~1;
+    }
+  }
+
+  struct Size {
+    int width;
+    int height;
+  };
+  std::vector<Size> sizes = {
+      {1280, 720}, {1920, 1080}, {2560, 1440}, {3840, 2160}, {2560, 1600}};
+  if (width > 0 && height > 0) {
+    sizes = {{width, height}};
+  }
+
+  std::mt19937 rng(20261019);
+  printf("thumbnail %dx%d, %d iterations\n", kThumbnailWidth, kThumbnailHeight,
+         iterations);
+  printf("%-11s %12s %12s %8s %9s\n", "source", "libyuv us", "fused us",
+         "speedup", "psnr dB");
+
+  for (const Size& size : sizes) {
+    std::vector<uint8_t> frame = GenerateFrame(size.width, size.height, rng);
+    std::vector<uint8_t> reference(kThumbnailWidth * kThumbnailHeight * 4);
+    std::vector<uint8_t> fused(reference.size());
+
+    double libyuv_us = MicrosPerCall(
+        [&]() {
+          ScaleNv12ToABGRLibyuv(frame.data(), size.width, size.height,
+                                reference.data(), kThumbnailWidth,
+                                kThumbnailHeight);
+        },
+        iterations);
+    double fused_us = MicrosPerCall(
+        [&]() {
+          crossdesk::ScaleNv12ToRgba(frame.data(), size.width, size.height,
+                                     fused.data(), kThumbnailWidth,
+                                     kThumbnailHeight);
+        },
+        iterations);
+
+    char source[32];
+    snprintf(source, sizeof(source), "%dx%d", size.width, size.height);
+    printf("%-11s %12.1f %12.1f %7.1fx %9.1f\n", source, libyuv_us, fused_us,
+           libyuv_us / fused_us, Psnr(reference, fused));
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+#include "crc32c.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <nmmintrin.h>
+#define CROSSDESK_CRC32C_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <nmmintrin.h>
+#define CROSSDESK_CRC32C_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#define CROSSDESK_CRC32C_ARM64 1
+#if defined(__ARM_FEATURE_CRC32)
+#define CROSSDESK_CRC32C_TARGET
+#elif defined(__clang__)
+#define CROSSDESK_CRC32C_TARGET __attribute__((target("crc")))
+#else
+#define CROSSDESK_CRC32C_TARGET __attribute__((target("+crc")))
+#endif
+#endif
+
+namespace crossdesk {
+
+namespace {
+constexpr uint32_t kPolynomial = 0x82F63B78;  // reversed Castagnoli
+
+using Table = std::array<std::array<uint32_t, 256>, 8>;
+
+Table MakeTable() {
+  Table table{};
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+    }
+    table[0][i] = crc;
+  }
+  for (uint32_t i = 0; i < 256; ++i) {
+    for (size_t slice = 1; slice < 8; ++slice) {
+      uint32_t prev = table[slice - 1][i];
+      table[slice][i] = (prev >> 8) ^ table[0][prev & 0xFF];
+    }
+  }
+  return table;
+}
+
+uint32_t Crc32cTable(uint32_t crc, const unsigned char* p, size_t size) {
+  static const Table table = MakeTable();
+  while (size >= 8) {
+    uint32_t low = 0;
+    uint32_t high = 0;
+    memcpy(&low, p, 4);
+    memcpy(&high, p + 4, 4);
+    low ^= crc;
+    crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^
+          table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+          table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^
+          table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+    p += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = (crc >> 8) ^ table[0][(crc ^ *p++) & 0xFF];
+  }
+  return crc;
+}
+
+#if defined(CROSSDESK_CRC32C_X86)
+bool HasHardwareCrc() {
+#if defined(_MSC_VER)
+  int info[4] = {0};
+  __cpuid(info, 1);
+  return (info[2] & (1 << 20)) != 0;
+#else
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+  return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) != 0;
+#endif
+}
+
+#if !defined(_MSC_VER)
+__attribute__((target("sse4.2")))
+#endif
+uint32_t Crc32cHardware(uint32_t crc, const unsigned char* p, size_t size) {
+#if defined(__x86_64__) || defined(_M_X64)
+  uint64_t crc64 = crc;
+  while (size >= 8) {
+    uint64_t v = 0;
+    memcpy(&v, p, 8);
+    crc64 = _mm_crc32_u64(crc64, v);
+    p += 8;
+    size -= 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+#endif
+  while (size >= 4) {
+    uint32_t v = 0;
+    memcpy(&v, p, 4);
+    crc = _mm_crc32_u32(crc, v);
+    p += 4;
+    size -= 4;
+  }
+  while (size-- > 0) {
+    crc = _mm_crc32_u8(crc, *p++);
+  }
+  return crc;
+}
+#elif defined(CROSSDESK_CRC32C_ARM64)
+bool HasHardwareCrc() {
+#if defined(__APPLE__)
+  return true;  // every Apple arm64 CPU has the CRC extension
+#elif defined(__linux__)
+  return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+  return false;
+#endif
+}
+
+CROSSDESK_CRC32C_TARGET uint32_t Crc32cHardware(uint32_t crc,
+                                                const unsigned char* p,
+                                                size_t size) {
+  while (size >= 8) {
+    uint64_t v = 0;
+    memcpy(&v, p, 8);
+    crc = __crc32cd(crc, v);
+    p += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    crc = __crc32cb(crc, *p++);
+  }
+  return crc;
+}
+#endif
+}  // namespace
+
+uint32_t Crc32c(uint32_t crc, const void* data, size_t size) {
+  const unsigned char* p = static_cast<const unsigned char*>(data);
+  crc = ~crc;
+#if defined(CROSSDESK_CRC32C_X86) || defined(CROSSDESK_CRC32C_ARM64)
+  static const bool hardware = HasHardwareCrc();
+  if (hardware) {
+    return ~Crc32cHardware(crc, p, size);
+  }
+#endif
+  return ~Crc32cTable(crc, p, size);
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,22 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _CRC32C_H_
+#define _CRC32C_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crossdesk {
+
+// CRC-32C (Castagnoli). Uses the SSE4.2 / ARMv8 CRC instructions when the
+// CPU has them, a slice-by-8 table otherwise. Pass the previous result as
+// `crc` to continue a running checksum, 0 to start a new one.
+uint32_t Crc32c(uint32_t crc, const void* data, size_t size);
+
+}  // namespace crossdesk
+
+#endif
@@ -0,0 +1,60 @@
+#include "startup_trace.h"
+
+#include "rd_log.h"
+
+namespace crossdesk {
+
+StartupTrace::Scope::Scope(StartupTrace& trace, const char* name)
+    : trace_(trace), name_(name), start_(std::chrono::steady_clock::now()) {}
+
+StartupTrace::Scope::~Scope() {
+  trace_.Record(name_, start_, std::chrono::steady_clock::now());
+}
+
+StartupTrace::StartupTrace() : start_(std::chrono::steady_clock::now()) {}
+
+void StartupTrace::Record(const std::string& name,
+                          std::chrono::steady_clock::time_point start,
+                          std::chrono::steady_clock::time_point end) {
+  Stage stage;
+  stage.name = name;
+  stage.start_ms = SinceStartMs(start);
+  stage.duration_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
+          .count();
+  LOG_INFO("Startup stage [{}] took {} ms, started at {} ms", stage.name,
+           stage.duration_ms, stage.start_ms);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.push_back(std::move(stage));
+}
+
+void StartupTrace::MarkFirstFrame() {
+  int64_t first_frame_ms = SinceStartMs(std::chrono::steady_clock::now());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (first_frame_ms_ >= 0) {
+      return;
+    }
+    first_frame_ms_ = first_frame_ms;
+  }
+  LOG_INFO("Startup: first frame after {} ms", first_frame_ms);
+}
+
+int64_t StartupTrace::TimeToFirstFrameMs() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return first_frame_ms_;
+}
+
+std::vector<StartupTrace::Stage> StartupTrace::Stages() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stages_;
+}
+
+int64_t StartupTrace::SinceStartMs(
+    std::chrono::steady_clock::time_point time) const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(time - start_)
+      .count();
+}
+
+}  // namespace crossdesk
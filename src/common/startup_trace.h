@@ -0,0 +1,70 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _STARTUP_TRACE_H_
+#define _STARTUP_TRACE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace crossdesk {
+
+// Durations of the startup stages, measured from the construction of the
+// trace. Every finished stage is logged with its duration and its offset
+// from the start; stages may run on any thread.
+class StartupTrace {
+ public:
+  struct Stage {
+    std::string name;
+    int64_t start_ms = 0;
+    int64_t duration_ms = 0;
+  };
+
+  // records the stage from its construction to its destruction
+  class Scope {
+   public:
+    Scope(StartupTrace& trace, const char* name);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    StartupTrace& trace_;
+    const char* name_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+ public:
+  StartupTrace();
+
+  void Record(const std::string& name,
+              std::chrono::steady_clock::time_point start,
+              std::chrono::steady_clock::time_point end);
+
+  // the first call records the time to first frame and logs the summary
+  void MarkFirstFrame();
+  // -1 until the first frame
+  int64_t TimeToFirstFrameMs();
+
+  std::vector<Stage> Stages();
+
+ private:
+  int64_t SinceStartMs(std::chrono::steady_clock::time_point time) const;
+
+ private:
+  const std::chrono::steady_clock::time_point start_;
+  std::mutex mutex_;
+  std::vector<Stage> stages_;
+  int64_t first_frame_ms_ = -1;
+};
+
+}  // namespace crossdesk
+
+#endif
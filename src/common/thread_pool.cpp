@@ -0,0 +1,50 @@
+#include "thread_pool.h"
+
+namespace crossdesk {
+
+ThreadPool::ThreadPool(size_t thread_num) {
+  if (thread_num == 0) {
+    thread_num = std::thread::hardware_concurrency();
+  }
+  if (thread_num == 0) {
+    thread_num = 1;
+  }
+
+  workers_.reserve(thread_num);
+  for (size_t i = 0; i < thread_num; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (auto& worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      // drain pending tasks before exiting so no future is left broken
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+}  // namespace crossdesk
@@ -39,6 +39,10 @@ int ConfigCenter::Load() {
   hardware_video_codec_ = ini_.GetBoolValue(section_, "hardware_video_codec",
                                             hardware_video_codec_);
 
+  file_transfer_limit_ = static_cast<FILE_TRANSFER_LIMIT>(
+      ini_.GetLongValue(section_, "file_transfer_limit",
+                        static_cast<long>(file_transfer_limit_)));
+
   enable_turn_ = ini_.GetBoolValue(section_, "enable_turn", enable_turn_);
   enable_srtp_ = ini_.GetBoolValue(section_, "enable_srtp", enable_srtp_);
   enable_self_hosted_ =
@@ -139,6 +143,15 @@ int ConfigCenter::Load() {
   enable_autostart_ =
       ini_.GetBoolValue(section_, "enable_autostart", enable_autostart_);
   enable_daemon_ = ini_.GetBoolValue(section_, "enable_daemon", enable_daemon_);
+  enable_headless_ =
+      ini_.GetBoolValue(section_, "enable_headless", enable_headless_);
+  const char* headless_password_value =
+      ini_.GetValue(section_, "headless_password", nullptr);
+  if (headless_password_value != nullptr) {
+    headless_password_ = headless_password_value;
+  } else {
+    headless_password_ = "";
+  }
   enable_minimize_to_tray_ = ini_.GetBoolValue(
       section_, "enable_minimize_to_tray", enable_minimize_to_tray_);
 
@@ -154,6 +167,8 @@ int ConfigCenter::Save() {
   ini_.SetLongValue(section_, "video_encode_format",
                     static_cast<long>(video_encode_format_));
   ini_.SetBoolValue(section_, "hardware_video_codec", hardware_video_codec_);
+  ini_.SetLongValue(section_, "file_transfer_limit",
+                    static_cast<long>(file_transfer_limit_));
   ini_.SetBoolValue(section_, "enable_turn", enable_turn_);
   ini_.SetBoolValue(section_, "enable_srtp", enable_srtp_);
   ini_.SetBoolValue(section_, "enable_self_hosted", enable_self_hosted_);
@@ -182,6 +197,7 @@ int ConfigCenter::Save() {
 
   ini_.SetBoolValue(section_, "enable_autostart", enable_autostart_);
   ini_.SetBoolValue(section_, "enable_daemon", enable_daemon_);
+  ini_.SetBoolValue(section_, "enable_headless", enable_headless_);
   ini_.SetBoolValue(section_, "enable_minimize_to_tray",
                     enable_minimize_to_tray_);
 
@@ -249,6 +265,18 @@ int ConfigCenter::SetHardwareVideoCodec(bool hardware_video_codec) {
   return 0;
 }
 
+int ConfigCenter::SetFileTransferLimit(
+    FILE_TRANSFER_LIMIT file_transfer_limit) {
+  file_transfer_limit_ = file_transfer_limit;
+  ini_.SetLongValue(section_, "file_transfer_limit",
+                    static_cast<long>(file_transfer_limit_));
+  SI_Error rc = ini_.SaveFile(config_path_.c_str());
+  if (rc < 0) {
+    return -1;
+  }
+  return 0;
+}
+
 int ConfigCenter::SetTurn(bool enable_turn) {
   enable_turn_ = enable_turn;
   ini_.SetBoolValue(section_, "enable_turn", enable_turn_);
@@ -491,6 +519,31 @@ int ConfigCenter::SetDaemon(bool enable_daemon) {
   return 0;
 }
 
+int ConfigCenter::SetHeadless(bool enable_headless) {
+  enable_headless_ = enable_headless;
+
+  ini_.SetBoolValue(section_, "enable_headless", enable_headless_);
+  SI_Error rc = ini_.SaveFile(config_path_.c_str());
+  if (rc < 0) {
+    return -1;
+  }
+
+  return 0;
+}
+
+int ConfigCenter::ClearHeadlessPassword() {
+  // the password lives on in the encrypted cache, not as plain text here
+  headless_password_.clear();
+
+  ini_.Delete(section_, "headless_password", false);
+  SI_Error rc = ini_.SaveFile(config_path_.c_str());
+  if (rc < 0) {
+    return -1;
+  }
+
+  return 0;
+}
+
 // getters
 
 ConfigCenter::LANGUAGE ConfigCenter::GetLanguage() const { return language_; }
@@ -511,6 +564,23 @@ bool ConfigCenter::IsHardwareVideoCodec() const {
   return hardware_video_codec_;
 }
 
+ConfigCenter::FILE_TRANSFER_LIMIT ConfigCenter::GetFileTransferLimit() const {
+  return file_transfer_limit_;
+}
+
+uint32_t ConfigCenter::GetFileTransferLimitBps() const {
+  switch (file_transfer_limit_) {
+    case FILE_TRANSFER_LIMIT::MBPS_1:
+      return 1000 * 1000;
+    case FILE_TRANSFER_LIMIT::MBPS_5:
+      return 5 * 1000 * 1000;
+    case FILE_TRANSFER_LIMIT::MBPS_20:
+      return 20 * 1000 * 1000;
+    default:
+      return 0;
+  }
+}
+
 bool ConfigCenter::IsEnableTurn() const { return enable_turn_; }
 
 bool ConfigCenter::IsEnableSrtp() const { return enable_srtp_; }
@@ -556,4 +626,10 @@ bool ConfigCenter::IsMinimizeToTray() const { return enable_minimize_to_tray_; }
 bool ConfigCenter::IsEnableAutostart() const { return enable_autostart_; }
 
 bool ConfigCenter::IsEnableDaemon() const { return enable_daemon_; }
+
+bool ConfigCenter::IsEnableHeadless() const { return enable_headless_; }
+
+std::string ConfigCenter::GetHeadlessPassword() const {
+  return headless_password_;
+}
 }  // namespace crossdesk
\ No newline at end of file
@@ -7,6 +7,7 @@
 #ifndef _CONFIG_CENTER_H_
 #define _CONFIG_CENTER_H_
 
+#include <cstdint>
 #include <string>
 
 #include "SimpleIni.h"
@@ -19,6 +20,12 @@ class ConfigCenter {
   enum class VIDEO_QUALITY { LOW = 0, MEDIUM = 1, HIGH = 2 };
   enum class VIDEO_FRAME_RATE { FPS_30 = 0, FPS_60 = 1 };
   enum class VIDEO_ENCODE_FORMAT { H264 = 0, AV1 = 1 };
+  enum class FILE_TRANSFER_LIMIT {
+    UNLIMITED = 0,
+    MBPS_1 = 1,
+    MBPS_5 = 2,
+    MBPS_20 = 3
+  };
 
  public:
   explicit ConfigCenter(
@@ -32,6 +39,7 @@ class ConfigCenter {
   int SetVideoFrameRate(VIDEO_FRAME_RATE video_frame_rate);
   int SetVideoEncodeFormat(VIDEO_ENCODE_FORMAT video_encode_format);
   int SetHardwareVideoCodec(bool hardware_video_codec);
+  int SetFileTransferLimit(FILE_TRANSFER_LIMIT file_transfer_limit);
   int SetTurn(bool enable_turn);
   int SetSrtp(bool enable_srtp);
   int SetServerHost(const std::string& signal_server_host);
@@ -46,6 +54,8 @@ class ConfigCenter {
   int SetMinimizeToTray(bool enable_minimize_to_tray);
   int SetAutostart(bool enable_autostart);
   int SetDaemon(bool enable_daemon);
+  int SetHeadless(bool enable_headless);
+  int ClearHeadlessPassword();
 
   // read config
 
@@ -54,6 +64,9 @@ class ConfigCenter {
   VIDEO_FRAME_RATE GetVideoFrameRate() const;
   VIDEO_ENCODE_FORMAT GetVideoEncodeFormat() const;
   bool IsHardwareVideoCodec() const;
+  FILE_TRANSFER_LIMIT GetFileTransferLimit() const;
+  // bits per second, 0 means unlimited
+  uint32_t GetFileTransferLimitBps() const;
   bool IsEnableTurn() const;
   bool IsEnableSrtp() const;
   std::string GetSignalServerHost() const;
@@ -70,6 +83,10 @@ class ConfigCenter {
   bool IsMinimizeToTray() const;
   bool IsEnableAutostart() const;
   bool IsEnableDaemon() const;
+  // host only, without any window
+  bool IsEnableHeadless() const;
+  // connection password a headless host takes over once, empty if not set
+  std::string GetHeadlessPassword() const;
 
   int Load();
   int Save();
@@ -84,6 +101,7 @@ class ConfigCenter {
   VIDEO_FRAME_RATE video_frame_rate_ = VIDEO_FRAME_RATE::FPS_60;
   VIDEO_ENCODE_FORMAT video_encode_format_ = VIDEO_ENCODE_FORMAT::H264;
   bool hardware_video_codec_ = false;
+  FILE_TRANSFER_LIMIT file_transfer_limit_ = FILE_TRANSFER_LIMIT::UNLIMITED;
   bool enable_turn_ = true;
   bool enable_srtp_ = false;
   std::string signal_server_host_ = "";
@@ -102,6 +120,8 @@ class ConfigCenter {
   bool enable_minimize_to_tray_ = false;
   bool enable_autostart_ = false;
   bool enable_daemon_ = false;
+  bool enable_headless_ = false;
+  std::string headless_password_ = "";
 };
 }  // namespace crossdesk
 #endif
\ No newline at end of file
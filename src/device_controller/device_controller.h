@@ -23,6 +23,8 @@ typedef enum {
   audio_capture,
   host_infomation,
   display_id,
+  audio_clock,
+  microphone,
 } ControlType;
 typedef enum {
   move = 0,
@@ -59,14 +61,23 @@ typedef struct {
   int* bottom;
 } HostInfo;
 
+// what the viewer's microphone frames carry, S16LE interleaved, 0 channels
+// when it stops.
+typedef struct {
+  int sample_rate;
+  int channels;
+} AudioFormatInfo;
+
 struct RemoteAction {
   ControlType type;
   union {
     Mouse m;
     Key k;
     HostInfo i;
+    AudioFormatInfo f;
     bool a;
     int d;
+    int64_t t;
   };
 
   // parse
@@ -96,6 +107,13 @@ struct RemoteAction {
       case ControlType::display_id:
         j["display_id"] = a.d;
         break;
+      case ControlType::audio_clock:
+        j["audio_clock"] = a.t;
+        break;
+      case ControlType::microphone:
+        j["microphone"] = {{"sample_rate", a.f.sample_rate},
+                           {"channels", a.f.channels}};
+        break;
       case ControlType::host_infomation: {
         json displays = json::array();
         for (size_t idx = 0; idx < a.i.display_num; idx++) {
@@ -137,6 +155,13 @@ struct RemoteAction {
         case ControlType::display_id:
           out.d = j.at("display_id").get<int>();
           break;
+        case ControlType::audio_clock:
+          out.t = j.at("audio_clock").get<int64_t>();
+          break;
+        case ControlType::microphone:
+          out.f.sample_rate = j.at("microphone").at("sample_rate").get<int>();
+          out.f.channels = j.at("microphone").at("channels").get<int>();
+          break;
         case ControlType::host_infomation: {
           std::string host_name =
               j.at("host_info").at("host_name").get<std::string>();
@@ -4,867 +4,656 @@
  * Copyright (c) 2024 by DI JUNKUN, All Rights Reserved.
  */
 
+// Generated by scripts/fonts/generate_font_headers.py, do not edit.
+
 #ifndef _OPPOSANS_REGULAR_H_
 #define _OPPOSANS_REGULAR_H_
 
-unsigned char OPPOSans_Regular_ttf[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x80, 0x00, 0x03, 0x00, 0x50,
-    0x4f, 0x53, 0x2f, 0x32, 0xef, 0x60, 0x17, 0xf2, 0x00, 0x00, 0x01, 0x58,
-    0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0x8f, 0xc8, 0x3d, 0x11,
-    0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x05, 0x12, 0x67, 0x61, 0x73, 0x70,
-    0x00, 0x18, 0x00, 0x27, 0x00, 0x00, 0x9d, 0x3c, 0x00, 0x00, 0x00, 0x10,
-    0x67, 0x6c, 0x79, 0x66, 0xb2, 0xb2, 0xb5, 0x89, 0x00, 0x00, 0x0d, 0xc8,
-    0x00, 0x00, 0x86, 0xac, 0x68, 0x65, 0x61, 0x64, 0x27, 0x1e, 0xbe, 0xce,
-    0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-    0x09, 0x9e, 0x02, 0x59, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
-    0x68, 0x6d, 0x74, 0x78, 0xc6, 0xe0, 0x22, 0x0b, 0x00, 0x00, 0x01, 0xb8,
-    0x00, 0x00, 0x03, 0x78, 0x6c, 0x6f, 0x63, 0x61, 0x00, 0x34, 0x07, 0x20,
-    0x00, 0x00, 0x0a, 0x4c, 0x00, 0x00, 0x03, 0x7c, 0x6d, 0x61, 0x78, 0x70,
-    0x02, 0x73, 0x02, 0x37, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x20,
-    0x6e, 0x61, 0x6d, 0x65, 0x90, 0x1a, 0x92, 0xad, 0x00, 0x00, 0x94, 0x74,
-    0x00, 0x00, 0x02, 0x6f, 0x70, 0x6f, 0x73, 0x74, 0x87, 0x5c, 0x15, 0x05,
-    0x00, 0x00, 0x96, 0xe4, 0x00, 0x00, 0x06, 0x56, 0x70, 0x72, 0x65, 0x70,
-    0x70, 0x02, 0x04, 0x12, 0x00, 0x00, 0x0a, 0x44, 0x00, 0x00, 0x00, 0x08,
-    0x76, 0x68, 0x65, 0x61, 0x04, 0xf4, 0x01, 0x85, 0x00, 0x00, 0x9d, 0x4c,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x3d,
-    0xf9, 0x0d, 0x0b, 0x35, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x03, 0x03, 0xe8,
-    0x00, 0x00, 0x00, 0x00, 0xe0, 0xdf, 0xc1, 0x3d, 0x00, 0x00, 0x00, 0x00,
-    0xe1, 0x84, 0xae, 0xc7, 0xfe, 0x5e, 0xfe, 0xfa, 0x07, 0x43, 0x04, 0xae,
-    0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x03, 0xfa, 0xff, 0x06, 0x00, 0x00, 0x04, 0x02,
-    0xfe, 0x5e, 0xfe, 0x72, 0x07, 0x43, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xde, 0x01, 0x54, 0x00, 0x2a, 0x00, 0x58,
-    0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x20, 0x00, 0x60, 0x00, 0x60,
-    0x01, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x03, 0xb0,
-    0x01, 0x90, 0x00, 0x05, 0x00, 0x08, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00,
-    0x00, 0x4b, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00, 0x01, 0x5e, 0x00, 0x32,
-    0x01, 0x21, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x04, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0xa0, 0x00, 0x02, 0xbf, 0x18, 0xef, 0x7c, 0xfa, 0x00, 0x00,
-    0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x48, 0x4e, 0x59, 0x49, 0x01, 0x40,
-    0x00, 0x20, 0xff, 0xff, 0x03, 0x52, 0xff, 0x6a, 0x00, 0x00, 0x03, 0xfa,
-    0x00, 0xfa, 0x00, 0x04, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f,
-    0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x02, 0x56, 0x00, 0x5c,
-    0x00, 0xe7, 0x00, 0x00, 0x02, 0xc6, 0x00, 0x05, 0x02, 0xa0, 0x00, 0x3e,
-    0x02, 0xdb, 0x00, 0x22, 0x02, 0xd9, 0x00, 0x3e, 0x02, 0x77, 0x00, 0x3e,
-    0x02, 0x5c, 0x00, 0x3e, 0x03, 0x03, 0x00, 0x22, 0x02, 0xe3, 0x00, 0x3e,
-    0x00, 0xe0, 0x00, 0x3e, 0x01, 0xf9, 0x00, 0x04, 0x02, 0x7a, 0x00, 0x3e,
-    0x02, 0x2f, 0x00, 0x3e, 0x03, 0x84, 0x00, 0x3e, 0x02, 0xf0, 0x00, 0x3e,
-    0x03, 0x02, 0x00, 0x22, 0x02, 0x89, 0x00, 0x3e, 0x03, 0x02, 0x00, 0x22,
-    0x02, 0xb7, 0x00, 0x3e, 0x02, 0x91, 0x00, 0x0c, 0x02, 0x79, 0x00, 0x0d,
-    0x02, 0xce, 0x00, 0x3c, 0x02, 0xc6, 0x00, 0x05, 0x03, 0xf7, 0x00, 0x1a,
-    0x02, 0x91, 0xff, 0xf4, 0x02, 0x87, 0xff, 0xff, 0x02, 0x8f, 0x00, 0x25,
-    0x02, 0x14, 0x00, 0x1c, 0x02, 0x41, 0x00, 0x34, 0x02, 0x0b, 0x00, 0x19,
-    0x02, 0x41, 0x00, 0x19, 0x02, 0x22, 0x00, 0x19, 0x01, 0x4c, 0x00, 0x08,
-    0x02, 0x41, 0x00, 0x1a, 0x02, 0x35, 0x00, 0x34, 0x00, 0xc7, 0x00, 0x26,
-    0x00, 0xc4, 0xff, 0xbb, 0x01, 0xed, 0x00, 0x34, 0x00, 0xc7, 0x00, 0x34,
-    0x03, 0x55, 0x00, 0x34, 0x02, 0x35, 0x00, 0x34, 0x02, 0x2e, 0x00, 0x19,
-    0x02, 0x41, 0x00, 0x34, 0x02, 0x41, 0x00, 0x19, 0x01, 0x73, 0x00, 0x34,
-    0x01, 0xe5, 0x00, 0x0d, 0x01, 0x5e, 0x00, 0x08, 0x02, 0x2f, 0x00, 0x32,
-    0x01, 0xff, 0x00, 0x0b, 0x03, 0x1b, 0x00, 0x15, 0x01, 0xdd, 0xff, 0xf8,
-    0x02, 0x00, 0x00, 0x0b, 0x01, 0xd6, 0x00, 0x16, 0x03, 0xbe, 0x00, 0x3a,
-    0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x68, 0x03, 0xbe, 0x00, 0x2c,
-    0x03, 0xbe, 0x00, 0x35, 0x03, 0xbe, 0x00, 0x1e, 0x03, 0xbe, 0x00, 0x15,
-    0x03, 0xbe, 0x00, 0x19, 0x03, 0xbe, 0x00, 0x12, 0x03, 0xbe, 0x00, 0x13,
-    0x03, 0xbe, 0x00, 0x11, 0x03, 0xbe, 0x00, 0x1b, 0x03, 0xbe, 0x00, 0x1e,
-    0x03, 0xbe, 0x00, 0x37, 0x03, 0xbe, 0x00, 0x2d, 0x03, 0xbe, 0x00, 0x6f,
-    0x03, 0xbe, 0x00, 0x1d, 0x03, 0xbe, 0x00, 0x20, 0x03, 0xbe, 0x00, 0x26,
-    0x03, 0xbe, 0x00, 0x35, 0x03, 0xbe, 0x00, 0x3a, 0x03, 0xbe, 0x00, 0x27,
-    0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x1b, 0x03, 0xbe, 0x00, 0x24,
+unsigned char OPPOSans_Regular_ttf_lz4[] = {
+    0xf0, 0xa9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x50, 0x4f, 0x53, 0x2f, 0x32, 0x6e, 0xf5, 0x01, 0xd8, 0x00, 0x00,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0xa6, 0x8d,
+    0x1e, 0x35, 0x00, 0x00, 0x05, 0x30, 0x00, 0x00, 0x04, 0xe0, 0x67, 0x61,
+    0x73, 0x70, 0x00, 0x18, 0x00, 0x27, 0x00, 0x00, 0x93, 0xa0, 0x00, 0x00,
+    0x00, 0x10, 0x67, 0x6c, 0x79, 0x66, 0x2d, 0xe7, 0x5d, 0x10, 0x00, 0x00,
+    0x0b, 0xd8, 0x00, 0x00, 0x85, 0xd2, 0x68, 0x65, 0x61, 0x64, 0x2a, 0x8d,
+    0x12, 0x5c, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68,
+    0x65, 0x61, 0x07, 0x95, 0x03, 0xd2, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00,
+    0x00, 0x24, 0x68, 0x6d, 0x74, 0x78, 0xc6, 0xe0, 0x22, 0x0b, 0x00, 0x00,
+    0x01, 0xb8, 0x00, 0x00, 0x03, 0x78, 0x6c, 0x6f, 0x63, 0x61, 0xfa, 0x7e,
+    0xd9, 0xa7, 0x00, 0x00, 0x0a, 0x18, 0x00, 0x00, 0x01, 0xbe, 0x6d, 0x61,
+    0x78, 0x70, 0x02, 0x4c, 0x01, 0x0d, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00,
+    0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x23, 0xcc, 0x46, 0xf9, 0x00, 0x00,
+    0x91, 0xac, 0x00, 0x00, 0x01, 0xd2, 0x70, 0x6f, 0x73, 0x74, 0xff, 0x9f,
+    0x00, 0x32, 0x00, 0x00, 0x93, 0x80, 0x20, 0x00, 0xf0, 0x0d, 0x70, 0x72,
+    0x65, 0x70, 0x70, 0x02, 0x04, 0x12, 0x00, 0x00, 0x0a, 0x10, 0x00, 0x00,
+    0x00, 0x08, 0x76, 0x68, 0x65, 0x61, 0x04, 0xf4, 0x01, 0x85, 0x00, 0x00,
+    0x93, 0xb0, 0x70, 0x00, 0x01, 0xdc, 0x00, 0xf0, 0x08, 0x03, 0x0a, 0x3d,
+    0xb3, 0xf6, 0xaa, 0x00, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x03, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xdf, 0xc1, 0x3d, 0x08, 0x00, 0xf1, 0x04,
+    0xe6, 0xfc, 0x03, 0x6e, 0xff, 0xbb, 0xff, 0x25, 0x03, 0xdd, 0x03, 0x6b,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x38, 0x00,
+    0xe1, 0x03, 0xfa, 0xff, 0x06, 0x00, 0x00, 0x04, 0x02, 0xff, 0xbb, 0xff,
+    0xeb, 0x03, 0xdd, 0x4a, 0x00, 0x08, 0x01, 0x00, 0x31, 0xde, 0x00, 0x01,
+    0x06, 0x00, 0x31, 0x83, 0x00, 0x09, 0x10, 0x00, 0xd1, 0x02, 0x00, 0x04,
+    0x00, 0x20, 0x00, 0x60, 0x00, 0x60, 0x01, 0x00, 0x00, 0x08, 0x12, 0x00,
+    0xc0, 0x04, 0x03, 0xb0, 0x01, 0x90, 0x00, 0x05, 0x00, 0x08, 0x02, 0x8a,
+    0x02, 0x4e, 0x01, 0x12, 0x4b, 0x08, 0x00, 0x60, 0x01, 0x5e, 0x00, 0x32,
+    0x01, 0x21, 0x32, 0x00, 0x40, 0x06, 0x00, 0x04, 0x01, 0x01, 0x00, 0x00,
+    0xa4, 0x00, 0x17, 0x08, 0x5b, 0x00, 0xe0, 0x48, 0x4e, 0x59, 0x49, 0x01,
+    0x40, 0x00, 0x20, 0x9a, 0xd8, 0x03, 0x52, 0xff, 0x6a, 0x8a, 0x00, 0x21,
+    0x00, 0xfa, 0x94, 0x00, 0x00, 0x35, 0x00, 0x30, 0x0f, 0x03, 0x00, 0xfa,
+    0x00, 0xf3, 0x39, 0x00, 0x03, 0x02, 0x56, 0x00, 0x5c, 0x00, 0xe7, 0x00,
+    0x00, 0x02, 0xc6, 0x00, 0x05, 0x02, 0xa0, 0x00, 0x3e, 0x02, 0xdb, 0x00,
+    0x22, 0x02, 0xd9, 0x00, 0x3e, 0x02, 0x77, 0x00, 0x3e, 0x02, 0x5c, 0x00,
+    0x3e, 0x03, 0x03, 0x00, 0x22, 0x02, 0xe3, 0x00, 0x3e, 0x00, 0xe0, 0x00,
+    0x3e, 0x01, 0xf9, 0x00, 0x04, 0x02, 0x7a, 0x00, 0x3e, 0x02, 0x2f, 0x00,
+    0x3e, 0x03, 0x84, 0x00, 0x3e, 0x02, 0xf0, 0x00, 0x3e, 0x03, 0x02, 0x00,
+    0x22, 0x02, 0x89, 0x08, 0x00, 0xf0, 0x00, 0xb7, 0x00, 0x3e, 0x02, 0x91,
+    0x00, 0x0c, 0x02, 0x79, 0x00, 0x0d, 0x02, 0xce, 0x00, 0x3c, 0x54, 0x00,
+    0xf1, 0x2b, 0x03, 0xf7, 0x00, 0x1a, 0x02, 0x91, 0xff, 0xf4, 0x02, 0x87,
+    0xff, 0xff, 0x02, 0x8f, 0x00, 0x25, 0x02, 0x14, 0x00, 0x1c, 0x02, 0x41,
+    0x00, 0x34, 0x02, 0x0b, 0x00, 0x19, 0x02, 0x41, 0x00, 0x19, 0x02, 0x22,
+    0x00, 0x19, 0x01, 0x4c, 0x00, 0x08, 0x02, 0x41, 0x00, 0x1a, 0x02, 0x35,
+    0x00, 0x34, 0x00, 0xc7, 0x00, 0x26, 0x00, 0xc4, 0xff, 0xbb, 0x01, 0xed,
+    0x0c, 0x00, 0x50, 0x34, 0x03, 0x55, 0x00, 0x34, 0x18, 0x00, 0x21, 0x02,
+    0x2e, 0x30, 0x00, 0x10, 0x34, 0x34, 0x00, 0xf3, 0x45, 0x01, 0x73, 0x00,
+    0x34, 0x01, 0xe5, 0x00, 0x0d, 0x01, 0x5e, 0x00, 0x08, 0x02, 0x2f, 0x00,
+    0x32, 0x01, 0xff, 0x00, 0x0b, 0x03, 0x1b, 0x00, 0x15, 0x01, 0xdd, 0xff,
+    0xf8, 0x02, 0x00, 0x00, 0x0b, 0x01, 0xd6, 0x00, 0x16, 0x03, 0xbe, 0x00,
+    0x3a, 0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x68, 0x03, 0xbe, 0x00,
+    0x2c, 0x03, 0xbe, 0x00, 0x35, 0x03, 0xbe, 0x00, 0x1e, 0x03, 0xbe, 0x00,
+    0x15, 0x03, 0xbe, 0x00, 0x19, 0x03, 0xbe, 0x00, 0x12, 0x03, 0xbe, 0x00,
+    0x13, 0x03, 0xbe, 0x00, 0x11, 0x03, 0xbe, 0x00, 0x1b, 0x1c, 0x00, 0xf3,
+    0x06, 0x37, 0x03, 0xbe, 0x00, 0x2d, 0x03, 0xbe, 0x00, 0x6f, 0x03, 0xbe,
+    0x00, 0x1d, 0x03, 0xbe, 0x00, 0x20, 0x03, 0xbe, 0x00, 0x26, 0x3c, 0x00,
+    0x00, 0x50, 0x00, 0x13, 0x27, 0x54, 0x00, 0x00, 0x30, 0x00, 0xd3, 0x24,
     0x03, 0xbe, 0x00, 0x87, 0x03, 0xbe, 0x00, 0x31, 0x03, 0xbe, 0x00, 0x16,
-    0x03, 0xbe, 0x00, 0x16, 0x03, 0xbe, 0x00, 0x24, 0x03, 0xbe, 0x00, 0x11,
-    0x03, 0xbe, 0x00, 0x21, 0x03, 0xbe, 0x00, 0x22, 0x03, 0xbe, 0x00, 0x23,
-    0x03, 0xbe, 0x00, 0x31, 0x03, 0xbe, 0x00, 0x3c, 0x03, 0xbe, 0x00, 0x37,
-    0x03, 0xbe, 0x00, 0x3f, 0x03, 0xbe, 0x00, 0x3a, 0x03, 0xbe, 0x00, 0x55,
-    0x03, 0xbe, 0x00, 0x29, 0x03, 0xbe, 0x00, 0x18, 0x03, 0xbe, 0x00, 0x1f,
-    0x03, 0xbe, 0x00, 0x68, 0x03, 0xbe, 0x00, 0x48, 0x03, 0xbe, 0x00, 0x19,
-    0x03, 0xbe, 0x00, 0x14, 0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x2e,
-    0x03, 0xbe, 0x00, 0x17, 0x03, 0xbe, 0x00, 0x1e, 0x03, 0xbe, 0x00, 0x14,
-    0x03, 0xbe, 0x00, 0x22, 0x03, 0xbe, 0x00, 0x27, 0x03, 0xbe, 0x00, 0x25,
-    0x03, 0xbe, 0x00, 0x22, 0x03, 0xbe, 0x00, 0x24, 0x03, 0xbe, 0x00, 0x26,
-    0x03, 0xbe, 0x00, 0x20, 0x03, 0xbe, 0x00, 0x1e, 0x03, 0xbe, 0x00, 0x1a,
-    0x03, 0xbe, 0x00, 0x26, 0x03, 0xbe, 0x00, 0x1b, 0x03, 0xbe, 0x00, 0x2e,
-    0x03, 0xbe, 0x00, 0x5c, 0x03, 0xbe, 0x00, 0x33, 0x03, 0xbe, 0x00, 0x30,
-    0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x29, 0x03, 0xbe, 0x00, 0x24,
-    0x03, 0xbe, 0x00, 0x19, 0x03, 0xbe, 0x00, 0x15, 0x03, 0xbe, 0x00, 0x13,
-    0x03, 0xbe, 0x00, 0x17, 0x03, 0xbe, 0x00, 0x14, 0x03, 0xbe, 0x00, 0x25,
-    0x03, 0xbe, 0x00, 0x2e, 0x03, 0xbe, 0x00, 0x2b, 0x03, 0xbe, 0x00, 0x31,
-    0x03, 0xbe, 0x00, 0x27, 0x03, 0xbe, 0x00, 0x1d, 0x03, 0xbe, 0x00, 0x38,
-    0x03, 0xbe, 0x00, 0x35, 0x03, 0xbe, 0x00, 0x23, 0x03, 0xbe, 0x00, 0x39,
-    0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x25, 0x03, 0xbe, 0x00, 0x11,
-    0x03, 0xbe, 0x00, 0x16, 0x03, 0xbe, 0x00, 0x17, 0x03, 0xbe, 0x00, 0x20,
-    0x03, 0xbe, 0x00, 0x3c, 0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x1e,
-    0x03, 0xbe, 0x00, 0x2c, 0x03, 0xbe, 0x00, 0x2b, 0x03, 0xbe, 0x00, 0x28,
-    0x03, 0xbe, 0x00, 0x25, 0x03, 0xbe, 0x00, 0x21, 0x03, 0xbe, 0x00, 0x26,
-    0x03, 0xbe, 0x00, 0x29, 0x03, 0xbe, 0x00, 0x61, 0x03, 0xbe, 0x00, 0x35,
-    0x03, 0xbe, 0x00, 0x8f, 0x03, 0xbe, 0x00, 0x2d, 0x03, 0xbe, 0x00, 0x0c,
-    0x03, 0xbe, 0x00, 0x1a, 0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x2e,
-    0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x33, 0x03, 0xbe, 0x00, 0x2d,
-    0x03, 0xbe, 0x00, 0x2f, 0x03, 0xbe, 0x00, 0x2c, 0x03, 0xbe, 0x00, 0x2c,
-    0x03, 0xbe, 0x00, 0x2f, 0x03, 0xbe, 0x00, 0x1c, 0x03, 0xbe, 0x00, 0x20,
-    0x03, 0xbe, 0x00, 0x21, 0x03, 0xbe, 0x00, 0x1a, 0x03, 0xbe, 0x00, 0x23,
-    0x03, 0xbe, 0x00, 0x24, 0x03, 0xbe, 0x00, 0x22, 0x03, 0xbe, 0x00, 0x1f,
-    0x03, 0xbe, 0x00, 0x25, 0x03, 0xbe, 0x00, 0x19, 0x03, 0xbe, 0x00, 0x1f,
-    0x03, 0xbe, 0x00, 0x19, 0x03, 0xbe, 0x00, 0x31, 0x03, 0xbe, 0x00, 0x21,
-    0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x5f,
-    0x03, 0xbe, 0x00, 0x5f, 0x03, 0xbe, 0x00, 0x63, 0x03, 0xbe, 0x00, 0x52,
-    0x03, 0xbe, 0x00, 0x5a, 0x03, 0xbe, 0x00, 0x1e, 0x03, 0xbe, 0x00, 0x3c,
-    0x03, 0xbe, 0x00, 0x37, 0x03, 0xbe, 0x00, 0x1b, 0x03, 0xbe, 0x00, 0x21,
-    0x03, 0xbe, 0x00, 0x39, 0x02, 0x6f, 0x00, 0x1e, 0x01, 0x8b, 0x00, 0x17,
-    0x02, 0x4d, 0x00, 0x21, 0x02, 0x3d, 0x00, 0x14, 0x02, 0x62, 0x00, 0x1b,
-    0x02, 0x42, 0x00, 0x16, 0x02, 0x55, 0x00, 0x20, 0x01, 0xff, 0x00, 0x09,
-    0x02, 0x60, 0x00, 0x21, 0x02, 0x56, 0x00, 0x15, 0x00, 0xc4, 0x00, 0x20,
-    0x00, 0xcc, 0x00, 0x20, 0x00, 0xe5, 0x00, 0x2f, 0x01, 0xf4, 0x00, 0x0a,
-    0x01, 0xb3, 0x00, 0x20, 0x01, 0xb9, 0x00, 0x00, 0x01, 0xb9, 0x00, 0x00,
-    0x01, 0x63, 0x00, 0x28, 0x02, 0x83, 0xff, 0xf4, 0x04, 0x02, 0x00, 0x28,
-    0x03, 0x64, 0x00, 0x22, 0x01, 0x54, 0x00, 0x7d, 0x02, 0x89, 0x00, 0x1a,
-    0x02, 0x2b, 0x00, 0x17, 0x03, 0x6f, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x05, 0x06,
-    0x00, 0x00, 0x01, 0x26, 0x01, 0x00, 0x00, 0x07, 0x00, 0x26, 0x00, 0x20,
-    0x00, 0x25, 0x00, 0x3a, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5f, 0x00, 0x7a,
-    0x00, 0x7c, 0x00, 0xa9, 0x4e, 0x22, 0x4e, 0x2a, 0x4e, 0x2d, 0x4e, 0x66,
-    0x4e, 0x8e, 0x4e, 0xe4, 0x4e, 0xf6, 0x4f, 0x20, 0x4f, 0x4f, 0x4f, 0xe1,
-    0x51, 0x65, 0x51, 0x6d, 0x51, 0x73, 0x51, 0xfa, 0x52, 0x17, 0x52, 0x20,
-    0x52, 0x30, 0x52, 0x36, 0x52, 0x6a, 0x52, 0xa1, 0x53, 0x05, 0x53, 0x16,
-    0x53, 0xd6, 0x53, 0xe3, 0x53, 0xef, 0x54, 0x0e, 0x54, 0x2f, 0x56, 0x68,
-    0x57, 0x28, 0x57, 0x30, 0x57, 0x40, 0x59, 0x0d, 0x59, 0x27, 0x59, 0x31,
-    0x5b, 0x57, 0x5b, 0x88, 0x5b, 0x8c, 0x5b, 0x98, 0x5b, 0xc6, 0x5b, 0xf9,
-    0x5c, 0x0f, 0x5d, 0xf2, 0x5e, 0x27, 0x5e, 0xa6, 0x5e, 0xfa, 0x5f, 0x00,
-    0x5f, 0x0f, 0x5f, 0x84, 0x60, 0x3b, 0x62, 0x10, 0x62, 0x58, 0x62, 0xa4,
-    0x62, 0xe9, 0x63, 0x07, 0x63, 0x6e, 0x63, 0xa5, 0x63, 0xa7, 0x65, 0x48,
-    0x65, 0x70, 0x65, 0x87, 0x65, 0xb0, 0x65, 0xe0, 0x65, 0xf6, 0x66, 0xf4,
-    0x67, 0x00, 0x67, 0x0d, 0x67, 0x1f, 0x67, 0x2a, 0x67, 0x2c, 0x67, 0x3a,
-    0x67, 0x43, 0x67, 0x7f, 0x68, 0x3c, 0x68, 0x4c, 0x6b, 0x64, 0x6c, 0x42,
-    0x6d, 0x88, 0x72, 0x48, 0x73, 0x87, 0x75, 0x1f, 0x75, 0x28, 0x75, 0x3b,
-    0x76, 0xd8, 0x77, 0xe5, 0x78, 0x01, 0x78, 0x6c, 0x78, 0x6e, 0x7a, 0x0b,
-    0x7a, 0xcb, 0x7a, 0xef, 0x7b, 0x26, 0x7b, 0x49, 0x7b, 0xa1, 0x7c, 0xfb,
-    0x7e, 0xb9, 0x7e, 0xdf, 0x7e, 0xe7, 0x7f, 0x16, 0x7f, 0x51, 0x7f, 0x6e,
-    0x81, 0xea, 0x82, 0xf1, 0x89, 0xc6, 0x89, 0xe3, 0x8a, 0x00, 0x8b, 0xa1,
-    0x8b, 0xa4, 0x8b, 0xb0, 0x8b, 0xbf, 0x8b, 0xc1, 0x8b, 0xed, 0x8b, 0xf7,
-    0x8d, 0x25, 0x8d, 0x28, 0x8d, 0x34, 0x8d, 0xef, 0x8f, 0x93, 0x8f, 0xd1,
-    0x8f, 0xdc, 0x8f, 0xde, 0x90, 0x00, 0x90, 0x09, 0x90, 0x1a, 0x91, 0x4d,
-    0x91, 0xc7, 0x91, 0xcd, 0x91, 0xcf, 0x95, 0xee, 0x96, 0x1f, 0x96, 0x50,
-    0x96, 0x64, 0x96, 0xc6, 0x97, 0x62, 0x97, 0xf3, 0x98, 0x91, 0x9a, 0x8c,
-    0x9a, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x24, 0x00, 0x2a,
-    0x00, 0x3f, 0x00, 0x5c, 0x00, 0x5f, 0x00, 0x61, 0x00, 0x7c, 0x00, 0xa9,
-    0x4e, 0x22, 0x4e, 0x2a, 0x4e, 0x2d, 0x4e, 0x66, 0x4e, 0x8e, 0x4e, 0xe4,
-    0x4e, 0xf6, 0x4f, 0x20, 0x4f, 0x4d, 0x4f, 0xe1, 0x51, 0x65, 0x51, 0x6d,
-    0x51, 0x73, 0x51, 0xfa, 0x52, 0x17, 0x52, 0x20, 0x52, 0x30, 0x52, 0x36,
-    0x52, 0x6a, 0x52, 0xa1, 0x53, 0x05, 0x53, 0x16, 0x53, 0xd6, 0x53, 0xe3,
-    0x53, 0xef, 0x54, 0x0e, 0x54, 0x2f, 0x56, 0x68, 0x57, 0x28, 0x57, 0x30,
-    0x57, 0x40, 0x59, 0x0d, 0x59, 0x27, 0x59, 0x31, 0x5b, 0x57, 0x5b, 0x88,
-    0x5b, 0x8c, 0x5b, 0x98, 0x5b, 0xc6, 0x5b, 0xf9, 0x5c, 0x0f, 0x5d, 0xf2,
-    0x5e, 0x27, 0x5e, 0xa6, 0x5e, 0xfa, 0x5f, 0x00, 0x5f, 0x0f, 0x5f, 0x84,
-    0x60, 0x3b, 0x62, 0x10, 0x62, 0x58, 0x62, 0xa4, 0x62, 0xe9, 0x63, 0x07,
-    0x63, 0x6e, 0x63, 0xa5, 0x63, 0xa7, 0x65, 0x48, 0x65, 0x70, 0x65, 0x87,
-    0x65, 0xb0, 0x65, 0xe0, 0x65, 0xf6, 0x66, 0xf4, 0x67, 0x00, 0x67, 0x0d,
-    0x67, 0x1f, 0x67, 0x2a, 0x67, 0x2c, 0x67, 0x3a, 0x67, 0x43, 0x67, 0x7f,
-    0x68, 0x3c, 0x68, 0x4c, 0x6b, 0x63, 0x6c, 0x42, 0x6d, 0x88, 0x72, 0x48,
-    0x73, 0x87, 0x75, 0x1f, 0x75, 0x28, 0x75, 0x3b, 0x76, 0xd8, 0x77, 0xe5,
-    0x78, 0x01, 0x78, 0x6c, 0x78, 0x6e, 0x7a, 0x0b, 0x7a, 0xcb, 0x7a, 0xef,
-    0x7b, 0x26, 0x7b, 0x49, 0x7b, 0xa1, 0x7c, 0xfb, 0x7e, 0xb9, 0x7e, 0xdf,
-    0x7e, 0xe7, 0x7f, 0x16, 0x7f, 0x51, 0x7f, 0x6e, 0x81, 0xea, 0x82, 0xf1,
-    0x89, 0xc6, 0x89, 0xe3, 0x8a, 0x00, 0x8b, 0xa1, 0x8b, 0xa4, 0x8b, 0xb0,
-    0x8b, 0xbe, 0x8b, 0xc1, 0x8b, 0xed, 0x8b, 0xf7, 0x8d, 0x25, 0x8d, 0x28,
-    0x8d, 0x34, 0x8d, 0xef, 0x8f, 0x93, 0x8f, 0xd1, 0x8f, 0xdb, 0x8f, 0xde,
-    0x90, 0x00, 0x90, 0x09, 0x90, 0x1a, 0x91, 0x4d, 0x91, 0xc7, 0x91, 0xcd,
-    0x91, 0xcf, 0x95, 0xed, 0x96, 0x1f, 0x96, 0x50, 0x96, 0x64, 0x96, 0xc6,
-    0x97, 0x62, 0x97, 0xf3, 0x98, 0x91, 0x9a, 0x8c, 0x9a, 0xd8, 0xff, 0xff,
-    0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x78,
-    0xff, 0xbb, 0x00, 0x5e, 0x00, 0x30, 0xb2, 0x14, 0xb2, 0x0d, 0xb2, 0x0b,
-    0xb1, 0xd3, 0xb1, 0xac, 0xb1, 0x57, 0xb1, 0x46, 0xb1, 0x1d, 0xb0, 0xf1,
-    0xb0, 0x60, 0xae, 0xdd, 0xae, 0xd6, 0xae, 0xd1, 0xae, 0x4b, 0xae, 0x2f,
-    0xae, 0x27, 0xae, 0x18, 0xae, 0x13, 0xad, 0xe0, 0xad, 0xaa, 0xad, 0x47,
-    0xad, 0x37, 0xac, 0x78, 0xac, 0x6c, 0xac, 0x61, 0xac, 0x43, 0xac, 0x23,
-    0xa9, 0xeb, 0xa9, 0x2c, 0xa9, 0x25, 0xa9, 0x16, 0xa7, 0x4a, 0xa7, 0x31,
-    0xa7, 0x28, 0xa5, 0x03, 0xa4, 0xd3, 0xa4, 0xd0, 0xa4, 0xc5, 0xa4, 0x98,
-    0xa4, 0x66, 0xa4, 0x51, 0xa2, 0x6f, 0xa2, 0x3b, 0xa1, 0xbd, 0xa1, 0x6a,
-    0xa1, 0x65, 0xa1, 0x57, 0xa0, 0xe3, 0xa0, 0x2d, 0x9e, 0x59, 0x9e, 0x12,
-    0x9d, 0xc7, 0x9d, 0x83, 0x9d, 0x66, 0x9d, 0x00, 0x9c, 0xca, 0x9c, 0xc9,
-    0x9b, 0x29, 0x9b, 0x02, 0x9a, 0xec, 0x9a, 0xc4, 0x9a, 0x95, 0x9a, 0x80,
-    0x99, 0x83, 0x99, 0x78, 0x99, 0x6c, 0x99, 0x5b, 0x99, 0x51, 0x99, 0x50,
-    0x99, 0x43, 0x99, 0x3b, 0x99, 0x00, 0x98, 0x44, 0x98, 0x35, 0x95, 0x1f,
-    0x94, 0x42, 0x92, 0xfd, 0x8e, 0x3e, 0x8d, 0x00, 0x8b, 0x69, 0x8b, 0x61,
-    0x8b, 0x4f, 0x89, 0xb3, 0x88, 0xa7, 0x88, 0x8c, 0x88, 0x22, 0x88, 0x21,
-    0x86, 0x85, 0x85, 0xc6, 0x85, 0xa3, 0x85, 0x6d, 0x85, 0x4b, 0x84, 0xf4,
-    0x83, 0x9b, 0x81, 0xde, 0x81, 0xb9, 0x81, 0xb2, 0x81, 0x84, 0x81, 0x4a,
-    0x81, 0x2e, 0x7e, 0xb3, 0x7d, 0xad, 0x76, 0xd9, 0x76, 0xbd, 0x76, 0xa1,
-    0x75, 0x01, 0x74, 0xff, 0x74, 0xf4, 0x74, 0xe7, 0x74, 0xe6, 0x74, 0xbb,
-    0x74, 0xb2, 0x73, 0x85, 0x73, 0x83, 0x73, 0x78, 0x72, 0xbe, 0x71, 0x1b,
-    0x70, 0xde, 0x70, 0xd5, 0x70, 0xd4, 0x70, 0xb3, 0x70, 0xab, 0x70, 0x9b,
-    0x6f, 0x69, 0x6e, 0xf0, 0x6e, 0xeb, 0x6e, 0xea, 0x6a, 0xcd, 0x6a, 0x9d,
-    0x6a, 0x6d, 0x6a, 0x5a, 0x69, 0xf9, 0x69, 0x5e, 0x68, 0xce, 0x68, 0x31,
-    0x66, 0x37, 0x65, 0xec, 0x00, 0x01, 0x00, 0x00, 0x01, 0x24, 0x01, 0x26,
-    0x01, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xdb, 0x00, 0xdd, 0x00, 0xd3, 0x00, 0xdc, 0x00, 0xd0, 0x00, 0xd6,
-    0x00, 0xcf, 0x00, 0xd4, 0x00, 0xc5, 0x00, 0xc6, 0x00, 0xc7, 0x00, 0xc8,
-    0x00, 0xc9, 0x00, 0xca, 0x00, 0xcb, 0x00, 0xcc, 0x00, 0xcd, 0x00, 0xce,
-    0x00, 0xd1, 0x00, 0xd2, 0x00, 0xd8, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
-    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-    0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x00,
-    0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x04, 0x8d, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x01, 0x70,
-    0x00, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x01, 0xd0, 0x00, 0x00, 0x02, 0x38,
-    0x00, 0x00, 0x02, 0x68, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0xb8,
-    0x00, 0x00, 0x02, 0xec, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x03, 0x44,
-    0x00, 0x00, 0x03, 0x74, 0x00, 0x00, 0x03, 0xcc, 0x00, 0x00, 0x04, 0x10,
-    0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x04, 0xe0, 0x00, 0x00, 0x05, 0x60,
-    0x00, 0x00, 0x05, 0x84, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x05, 0xe8,
-    0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x06, 0x58, 0x00, 0x00, 0x06, 0x88,
-    0x00, 0x00, 0x06, 0xb8, 0x00, 0x00, 0x07, 0x48, 0x00, 0x00, 0x07, 0xa8,
-    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x08, 0xc4,
-    0x00, 0x00, 0x09, 0x08, 0x00, 0x00, 0x09, 0x88, 0x00, 0x00, 0x09, 0xd4,
-    0x00, 0x00, 0x0a, 0x0c, 0x00, 0x00, 0x0a, 0x60, 0x00, 0x00, 0x0a, 0x90,
-    0x00, 0x00, 0x0a, 0xa8, 0x00, 0x00, 0x0b, 0x18, 0x00, 0x00, 0x0b, 0x60,
-    0x00, 0x00, 0x0b, 0xb8, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x0c, 0x78,
-    0x00, 0x00, 0x0c, 0xb4, 0x00, 0x00, 0x0d, 0x30, 0x00, 0x00, 0x0d, 0x74,
-    0x00, 0x00, 0x0d, 0xbc, 0x00, 0x00, 0x0d, 0xe0, 0x00, 0x00, 0x0e, 0x18,
-    0x00, 0x00, 0x0e, 0x4c, 0x00, 0x00, 0x0e, 0x8c, 0x00, 0x00, 0x0e, 0xbc,
-    0x00, 0x00, 0x0f, 0x68, 0x00, 0x00, 0x0f, 0xbc, 0x00, 0x00, 0x10, 0x04,
-    0x00, 0x00, 0x10, 0xa8, 0x00, 0x00, 0x11, 0x08, 0x00, 0x00, 0x11, 0xac,
-    0x00, 0x00, 0x12, 0x28, 0x00, 0x00, 0x12, 0xdc, 0x00, 0x00, 0x13, 0x84,
-    0x00, 0x00, 0x14, 0x74, 0x00, 0x00, 0x14, 0xf8, 0x00, 0x00, 0x15, 0x90,
-    0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x17, 0x20,
-    0x00, 0x00, 0x17, 0x70, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x19, 0x30,
-    0x00, 0x00, 0x1a, 0x08, 0x00, 0x00, 0x1a, 0xc8, 0x00, 0x00, 0x1c, 0x00,
-    0x00, 0x00, 0x1c, 0xe0, 0x00, 0x00, 0x1d, 0xcc, 0x00, 0x00, 0x1e, 0x7c,
-    0x00, 0x00, 0x1f, 0x48, 0x00, 0x00, 0x1f, 0x74, 0x00, 0x00, 0x1f, 0xd8,
-    0x00, 0x00, 0x20, 0x44, 0x00, 0x00, 0x20, 0xbc, 0x00, 0x00, 0x21, 0x98,
-    0x00, 0x00, 0x22, 0x14, 0x00, 0x00, 0x23, 0x08, 0x00, 0x00, 0x23, 0x7c,
-    0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x24, 0x9c, 0x00, 0x00, 0x25, 0x24,
-    0x00, 0x00, 0x25, 0xbc, 0x00, 0x00, 0x26, 0x54, 0x00, 0x00, 0x27, 0x28,
-    0x00, 0x00, 0x27, 0x94, 0x00, 0x00, 0x28, 0xd0, 0x00, 0x00, 0x29, 0x88,
-    0x00, 0x00, 0x2a, 0x08, 0x00, 0x00, 0x2a, 0x84, 0x00, 0x00, 0x2b, 0x44,
-    0x00, 0x00, 0x2c, 0x08, 0x00, 0x00, 0x2d, 0x08, 0x00, 0x00, 0x2d, 0x74,
-    0x00, 0x00, 0x2e, 0x40, 0x00, 0x00, 0x2e, 0xf8, 0x00, 0x00, 0x30, 0x0c,
-    0x00, 0x00, 0x31, 0x1c, 0x00, 0x00, 0x31, 0xfc, 0x00, 0x00, 0x32, 0xb8,
-    0x00, 0x00, 0x33, 0x94, 0x00, 0x00, 0x34, 0x90, 0x00, 0x00, 0x35, 0x64,
-    0x00, 0x00, 0x36, 0xac, 0x00, 0x00, 0x37, 0xa8, 0x00, 0x00, 0x38, 0xd0,
-    0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x3a, 0xbc, 0x00, 0x00, 0x3c, 0x08,
-    0x00, 0x00, 0x3c, 0xbc, 0x00, 0x00, 0x3d, 0x4c, 0x00, 0x00, 0x3e, 0x04,
-    0x00, 0x00, 0x3e, 0xec, 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00, 0x40, 0xf8,
-    0x00, 0x00, 0x41, 0x70, 0x00, 0x00, 0x41, 0xe8, 0x00, 0x00, 0x42, 0xd0,
-    0x00, 0x00, 0x43, 0x8c, 0x00, 0x00, 0x44, 0x6c, 0x00, 0x00, 0x45, 0x4c,
-    0x00, 0x00, 0x45, 0xe8, 0x00, 0x00, 0x46, 0x2c, 0x00, 0x00, 0x46, 0xdc,
-    0x00, 0x00, 0x47, 0xc8, 0x00, 0x00, 0x48, 0xd4, 0x00, 0x00, 0x49, 0xac,
-    0x00, 0x00, 0x4b, 0x04, 0x00, 0x00, 0x4b, 0x68, 0x00, 0x00, 0x4c, 0x00,
-    0x00, 0x00, 0x4c, 0x70, 0x00, 0x00, 0x4d, 0x78, 0x00, 0x00, 0x4e, 0x18,
-    0x00, 0x00, 0x4e, 0xd0, 0x00, 0x00, 0x4f, 0xb0, 0x00, 0x00, 0x50, 0xb0,
-    0x00, 0x00, 0x51, 0x6c, 0x00, 0x00, 0x51, 0xe8, 0x00, 0x00, 0x53, 0x04,
-    0x00, 0x00, 0x54, 0x08, 0x00, 0x00, 0x55, 0x10, 0x00, 0x00, 0x55, 0xf8,
-    0x00, 0x00, 0x57, 0x10, 0x00, 0x00, 0x58, 0x20, 0x00, 0x00, 0x59, 0xb0,
-    0x00, 0x00, 0x5a, 0xec, 0x00, 0x00, 0x5c, 0x3c, 0x00, 0x00, 0x5d, 0x00,
-    0x00, 0x00, 0x5d, 0xa8, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x00, 0x5e, 0xac,
-    0x00, 0x00, 0x5f, 0xb4, 0x00, 0x00, 0x61, 0x0c, 0x00, 0x00, 0x61, 0x78,
-    0x00, 0x00, 0x61, 0xf0, 0x00, 0x00, 0x62, 0x94, 0x00, 0x00, 0x63, 0x54,
-    0x00, 0x00, 0x64, 0x3c, 0x00, 0x00, 0x65, 0x20, 0x00, 0x00, 0x65, 0xac,
-    0x00, 0x00, 0x66, 0x6c, 0x00, 0x00, 0x67, 0x50, 0x00, 0x00, 0x68, 0x1c,
-    0x00, 0x00, 0x68, 0xec, 0x00, 0x00, 0x69, 0x88, 0x00, 0x00, 0x6a, 0x70,
-    0x00, 0x00, 0x6b, 0xb4, 0x00, 0x00, 0x6c, 0x70, 0x00, 0x00, 0x6d, 0x40,
-    0x00, 0x00, 0x6e, 0x3c, 0x00, 0x00, 0x6f, 0x08, 0x00, 0x00, 0x70, 0x00,
-    0x00, 0x00, 0x71, 0x10, 0x00, 0x00, 0x72, 0x18, 0x00, 0x00, 0x73, 0x18,
-    0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x74, 0xbc, 0x00, 0x00, 0x75, 0x68,
-    0x00, 0x00, 0x76, 0x24, 0x00, 0x00, 0x76, 0xb4, 0x00, 0x00, 0x77, 0x58,
-    0x00, 0x00, 0x78, 0x38, 0x00, 0x00, 0x79, 0x54, 0x00, 0x00, 0x7a, 0x40,
-    0x00, 0x00, 0x7a, 0xc0, 0x00, 0x00, 0x7b, 0x70, 0x00, 0x00, 0x7c, 0x68,
-    0x00, 0x00, 0x7d, 0xa0, 0x00, 0x00, 0x7e, 0x44, 0x00, 0x00, 0x7e, 0x90,
-    0x00, 0x00, 0x7e, 0xbc, 0x00, 0x00, 0x7f, 0x28, 0x00, 0x00, 0x7f, 0x84,
-    0x00, 0x00, 0x7f, 0xc4, 0x00, 0x00, 0x80, 0x28, 0x00, 0x00, 0x80, 0x9c,
-    0x00, 0x00, 0x80, 0xcc, 0x00, 0x00, 0x81, 0x64, 0x00, 0x00, 0x81, 0xd8,
-    0x00, 0x00, 0x82, 0x04, 0x00, 0x00, 0x82, 0x40, 0x00, 0x00, 0x82, 0x8c,
-    0x00, 0x00, 0x83, 0x08, 0x00, 0x00, 0x83, 0x44, 0x00, 0x00, 0x83, 0x60,
-    0x00, 0x00, 0x83, 0x7c, 0x00, 0x00, 0x83, 0x98, 0x00, 0x00, 0x83, 0xb4,
-    0x00, 0x00, 0x84, 0x84, 0x00, 0x00, 0x85, 0x30, 0x00, 0x00, 0x85, 0x48,
-    0x00, 0x00, 0x85, 0xe0, 0x00, 0x00, 0x86, 0x08, 0x00, 0x00, 0x86, 0xac,
-    0x00, 0x02, 0x00, 0x5c, 0xff, 0x7d, 0x01, 0xfa, 0x03, 0x60, 0x00, 0x03,
-    0x00, 0x07, 0x00, 0x00, 0x13, 0x21, 0x11, 0x21, 0x25, 0x11, 0x21, 0x11,
-    0x5c, 0x01, 0x9e, 0xfe, 0x62, 0x01, 0x88, 0xfe, 0x8e, 0x03, 0x60, 0xfc,
-    0x1d, 0x16, 0x03, 0xb7, 0xfc, 0x49, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05,
-    0x00, 0x00, 0x02, 0xc0, 0x03, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00,
-    0x01, 0x33, 0x01, 0x23, 0x27, 0x21, 0x07, 0x23, 0x01, 0x0b, 0x01, 0x01,
+    0x04, 0x00, 0x13, 0x24, 0x50, 0x00, 0x93, 0x21, 0x03, 0xbe, 0x00, 0x22,
+    0x03, 0xbe, 0x00, 0x23, 0x20, 0x00, 0x13, 0x3c, 0x5c, 0x00, 0x13, 0x3f,
+    0x48, 0x00, 0xd3, 0x55, 0x03, 0xbe, 0x00, 0x29, 0x03, 0xbe, 0x00, 0x18,
+    0x03, 0xbe, 0x00, 0x1f, 0xa4, 0x00, 0x13, 0x48, 0x98, 0x00, 0xd3, 0x14,
+    0x03, 0xbe, 0x00, 0x30, 0x03, 0xbe, 0x00, 0x2e, 0x03, 0xbe, 0x00, 0x17,
+    0x98, 0x00, 0x13, 0x14, 0x50, 0x00, 0x00, 0x80, 0x00, 0x13, 0x25, 0x0c,
+    0x00, 0x13, 0x24, 0x9c, 0x00, 0x13, 0x20, 0x24, 0x00, 0x13, 0x1a, 0x10,
+    0x00, 0x13, 0x1b, 0x3c, 0x00, 0x53, 0x5c, 0x03, 0xbe, 0x00, 0x33, 0x4c,
+    0x00, 0x13, 0x1c, 0x70, 0x00, 0x13, 0x24, 0x64, 0x00, 0x13, 0x15, 0xfc,
+    0x00, 0x13, 0x17, 0x5c, 0x00, 0x13, 0x25, 0x34, 0x00, 0x13, 0x2b, 0xb0,
+    0x00, 0x13, 0x27, 0x00, 0x01, 0x13, 0x38, 0xfc, 0x00, 0x00, 0xc8, 0x00,
+    0x13, 0x39, 0x4c, 0x00, 0x13, 0x25, 0xe4, 0x00, 0x13, 0x16, 0x40, 0x00,
+    0x13, 0x20, 0xe0, 0x00, 0x13, 0x1c, 0x88, 0x00, 0x13, 0x2c, 0x48, 0x00,
+    0x13, 0x28, 0x2c, 0x00, 0x13, 0x21, 0x98, 0x00, 0x00, 0x80, 0x00, 0x13,
+    0x61, 0x50, 0x00, 0x13, 0x8f, 0x68, 0x01, 0x13, 0x0c, 0xb8, 0x00, 0x04,
+    0xf0, 0x00, 0x13, 0x30, 0xb4, 0x00, 0x00, 0x1c, 0x00, 0x13, 0x2f, 0x4c,
+    0x00, 0x13, 0x2c, 0x0c, 0x00, 0x13, 0x1c, 0x6c, 0x00, 0x13, 0x21, 0x34,
+    0x00, 0x13, 0x23, 0xd0, 0x00, 0x13, 0x22, 0x44, 0x01, 0x13, 0x25, 0xdc,
+    0x00, 0x13, 0x1f, 0x08, 0x00, 0x13, 0x31, 0x2c, 0x00, 0x13, 0x30, 0x04,
+    0x00, 0x13, 0x5f, 0x04, 0x00, 0x93, 0x63, 0x03, 0xbe, 0x00, 0x52, 0x03,
+    0xbe, 0x00, 0x5a, 0xb0, 0x00, 0x04, 0x9c, 0x01, 0x13, 0x1b, 0x30, 0x00,
+    0xf1, 0x32, 0x39, 0x02, 0x6f, 0x00, 0x1e, 0x01, 0x8b, 0x00, 0x17, 0x02,
+    0x4d, 0x00, 0x21, 0x02, 0x3d, 0x00, 0x14, 0x02, 0x62, 0x00, 0x1b, 0x02,
+    0x42, 0x00, 0x16, 0x02, 0x55, 0x00, 0x20, 0x01, 0xff, 0x00, 0x09, 0x02,
+    0x60, 0x00, 0x21, 0x02, 0x56, 0x00, 0x15, 0x00, 0xc4, 0x00, 0x20, 0x00,
+    0xcc, 0x00, 0x20, 0x00, 0xe5, 0x00, 0x2f, 0x01, 0xf4, 0x00, 0x0a, 0x01,
+    0xb3, 0x00, 0x20, 0x01, 0xb9, 0x00, 0x00, 0x04, 0x00, 0xf1, 0x10, 0x63,
+    0x00, 0x28, 0x02, 0x83, 0xff, 0xf4, 0x04, 0x02, 0x00, 0x28, 0x03, 0x64,
+    0x00, 0x22, 0x01, 0x54, 0x00, 0x7d, 0x02, 0x89, 0x00, 0x1a, 0x02, 0x2b,
+    0x00, 0x17, 0x03, 0x6f, 0x00, 0x2d, 0x8a, 0x03, 0x11, 0x03, 0x8e, 0x03,
+    0xa0, 0x0c, 0x00, 0x04, 0x04, 0xd4, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x3c,
+    0x04, 0xf1, 0xff, 0x1f, 0x2c, 0x00, 0x20, 0x00, 0x25, 0x00, 0x2f, 0x00,
+    0x39, 0x00, 0x3a, 0x00, 0x40, 0x00, 0x5a, 0x00, 0x5c, 0x00, 0x5f, 0x00,
+    0x7a, 0x00, 0x7c, 0x00, 0xa9, 0x4e, 0x22, 0x4e, 0x2a, 0x4e, 0x2d, 0x4e,
+    0x66, 0x4e, 0x8e, 0x4e, 0xe4, 0x4e, 0xf6, 0x4f, 0x20, 0x4f, 0x4f, 0x4f,
+    0xe1, 0x51, 0x65, 0x51, 0x6d, 0x51, 0x73, 0x51, 0xfa, 0x52, 0x17, 0x52,
+    0x20, 0x52, 0x30, 0x52, 0x36, 0x52, 0x6a, 0x52, 0xa1, 0x53, 0x05, 0x53,
+    0x16, 0x53, 0xd6, 0x53, 0xe3, 0x53, 0xef, 0x54, 0x0e, 0x54, 0x2f, 0x56,
+    0x68, 0x57, 0x28, 0x57, 0x30, 0x57, 0x40, 0x59, 0x0d, 0x59, 0x27, 0x59,
+    0x31, 0x5b, 0x57, 0x5b, 0x88, 0x5b, 0x8c, 0x5b, 0x98, 0x5b, 0xc6, 0x5b,
+    0xf9, 0x5c, 0x0f, 0x5d, 0xf2, 0x5e, 0x27, 0x5e, 0xa6, 0x5e, 0xfa, 0x5f,
+    0x00, 0x5f, 0x0f, 0x5f, 0x84, 0x60, 0x3b, 0x62, 0x10, 0x62, 0x58, 0x62,
+    0xa4, 0x62, 0xe9, 0x63, 0x07, 0x63, 0x6e, 0x63, 0xa5, 0x63, 0xa7, 0x65,
+    0x48, 0x65, 0x70, 0x65, 0x87, 0x65, 0xb0, 0x65, 0xe0, 0x65, 0xf6, 0x66,
+    0xf4, 0x67, 0x00, 0x67, 0x0d, 0x67, 0x1f, 0x67, 0x2a, 0x67, 0x2c, 0x67,
+    0x3a, 0x67, 0x43, 0x67, 0x7f, 0x68, 0x3c, 0x68, 0x4c, 0x6b, 0x64, 0x6c,
+    0x42, 0x6d, 0x88, 0x72, 0x48, 0x73, 0x87, 0x75, 0x1f, 0x75, 0x28, 0x75,
+    0x3b, 0x76, 0xd8, 0x77, 0xe5, 0x78, 0x01, 0x78, 0x6c, 0x78, 0x6e, 0x7a,
+    0x0b, 0x7a, 0xcb, 0x7a, 0xef, 0x7b, 0x26, 0x7b, 0x49, 0x7b, 0xa1, 0x7c,
+    0xfb, 0x7e, 0xb9, 0x7e, 0xdf, 0x7e, 0xe7, 0x7f, 0x16, 0x7f, 0x51, 0x7f,
+    0x6e, 0x81, 0xea, 0x82, 0xf1, 0x89, 0xc6, 0x89, 0xe3, 0x8a, 0x00, 0x8b,
+    0xa1, 0x8b, 0xa4, 0x8b, 0xb0, 0x8b, 0xbf, 0x8b, 0xc1, 0x8b, 0xed, 0x8b,
+    0xf7, 0x8d, 0x25, 0x8d, 0x28, 0x8d, 0x34, 0x8d, 0xef, 0x8f, 0x93, 0x8f,
+    0xd1, 0x8f, 0xdc, 0x8f, 0xde, 0x90, 0x00, 0x90, 0x09, 0x90, 0x1a, 0x91,
+    0x4d, 0x91, 0xc7, 0x91, 0xcd, 0x91, 0xcf, 0x95, 0xee, 0x96, 0x1f, 0x96,
+    0x50, 0x96, 0x64, 0x96, 0xc6, 0x97, 0x62, 0x97, 0xf3, 0x98, 0x91, 0x9a,
+    0x8c, 0x9a, 0xd8, 0xff, 0xff, 0xc4, 0x04, 0xb1, 0x24, 0x00, 0x2a, 0x00,
+    0x30, 0x00, 0x3a, 0x00, 0x3f, 0x00, 0x41, 0x2e, 0x01, 0x1f, 0x61, 0x2e,
+    0x01, 0x02, 0x1f, 0x4d, 0x2e, 0x01, 0x70, 0x1f, 0x63, 0x2e, 0x01, 0x30,
+    0x2e, 0xbe, 0x8b, 0x2e, 0x01, 0x1d, 0xdb, 0x2e, 0x01, 0x1f, 0xed, 0x2e,
+    0x01, 0x01, 0x21, 0xff, 0xe1, 0x19, 0x06, 0xf0, 0xff, 0x15, 0x95, 0x00,
+    0x97, 0x00, 0x00, 0xff, 0xc1, 0x00, 0x79, 0x00, 0x78, 0xff, 0xbb, 0x00,
+    0x5e, 0x00, 0x30, 0xb2, 0x14, 0xb2, 0x0d, 0xb2, 0x0b, 0xb1, 0xd3, 0xb1,
+    0xac, 0xb1, 0x57, 0xb1, 0x46, 0xb1, 0x1d, 0xb0, 0xf1, 0xb0, 0x60, 0xae,
+    0xdd, 0xae, 0xd6, 0xae, 0xd1, 0xae, 0x4b, 0xae, 0x2f, 0xae, 0x27, 0xae,
+    0x18, 0xae, 0x13, 0xad, 0xe0, 0xad, 0xaa, 0xad, 0x47, 0xad, 0x37, 0xac,
+    0x78, 0xac, 0x6c, 0xac, 0x61, 0xac, 0x43, 0xac, 0x23, 0xa9, 0xeb, 0xa9,
+    0x2c, 0xa9, 0x25, 0xa9, 0x16, 0xa7, 0x4a, 0xa7, 0x31, 0xa7, 0x28, 0xa5,
+    0x03, 0xa4, 0xd3, 0xa4, 0xd0, 0xa4, 0xc5, 0xa4, 0x98, 0xa4, 0x66, 0xa4,
+    0x51, 0xa2, 0x6f, 0xa2, 0x3b, 0xa1, 0xbd, 0xa1, 0x6a, 0xa1, 0x65, 0xa1,
+    0x57, 0xa0, 0xe3, 0xa0, 0x2d, 0x9e, 0x59, 0x9e, 0x12, 0x9d, 0xc7, 0x9d,
+    0x83, 0x9d, 0x66, 0x9d, 0x00, 0x9c, 0xca, 0x9c, 0xc9, 0x9b, 0x29, 0x9b,
+    0x02, 0x9a, 0xec, 0x9a, 0xc4, 0x9a, 0x95, 0x9a, 0x80, 0x99, 0x83, 0x99,
+    0x78, 0x99, 0x6c, 0x99, 0x5b, 0x99, 0x51, 0x99, 0x50, 0x99, 0x43, 0x99,
+    0x3b, 0x99, 0x00, 0x98, 0x44, 0x98, 0x35, 0x95, 0x1f, 0x94, 0x42, 0x92,
+    0xfd, 0x8e, 0x3e, 0x8d, 0x00, 0x8b, 0x69, 0x8b, 0x61, 0x8b, 0x4f, 0x89,
+    0xb3, 0x88, 0xa7, 0x88, 0x8c, 0x88, 0x22, 0x88, 0x21, 0x86, 0x85, 0x85,
+    0xc6, 0x85, 0xa3, 0x85, 0x6d, 0x85, 0x4b, 0x84, 0xf4, 0x83, 0x9b, 0x81,
+    0xde, 0x81, 0xb9, 0x81, 0xb2, 0x81, 0x84, 0x81, 0x4a, 0x81, 0x2e, 0x7e,
+    0xb3, 0x7d, 0xad, 0x76, 0xd9, 0x76, 0xbd, 0x76, 0xa1, 0x75, 0x01, 0x74,
+    0xff, 0x74, 0xf4, 0x74, 0xe7, 0x74, 0xe6, 0x74, 0xbb, 0x74, 0xb2, 0x73,
+    0x85, 0x73, 0x83, 0x73, 0x78, 0x72, 0xbe, 0x71, 0x1b, 0x70, 0xde, 0x70,
+    0xd5, 0x70, 0xd4, 0x70, 0xb3, 0x70, 0xab, 0x70, 0x9b, 0x6f, 0x69, 0x6e,
+    0xf0, 0x6e, 0xeb, 0x6e, 0xea, 0x6a, 0xcd, 0x6a, 0x9d, 0x6a, 0x6d, 0x6a,
+    0x5a, 0x69, 0xf9, 0x69, 0x5e, 0x68, 0xce, 0x68, 0x31, 0x66, 0x37, 0x65,
+    0xec, 0x98, 0x03, 0x41, 0x01, 0x2a, 0x01, 0x2c, 0xc5, 0x07, 0x2f, 0x32,
+    0x00, 0x01, 0x00, 0xff, 0x0e, 0xf1, 0xff, 0xcb, 0xdb, 0x00, 0xdd, 0x00,
+    0xd3, 0x00, 0xdc, 0x00, 0xd0, 0x00, 0xd6, 0x00, 0xcf, 0x00, 0xd4, 0x00,
+    0xd2, 0x00, 0xd8, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x04, 0x8d, 0x00,
+    0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x30, 0x00, 0x65, 0x00, 0x91, 0x00,
+    0xb5, 0x00, 0xce, 0x00, 0xe4, 0x01, 0x17, 0x01, 0x2e, 0x01, 0x3a, 0x01,
+    0x56, 0x01, 0x70, 0x01, 0x7f, 0x01, 0x9a, 0x01, 0xb1, 0x01, 0xdd, 0x01,
+    0xfe, 0x02, 0x35, 0x02, 0x65, 0x02, 0xa5, 0x02, 0xb7, 0x02, 0xd5, 0x02,
+    0xe8, 0x03, 0x04, 0x03, 0x20, 0x03, 0x37, 0x03, 0x4e, 0x03, 0x95, 0x03,
+    0xc5, 0x03, 0xf1, 0x04, 0x20, 0x04, 0x52, 0x04, 0x73, 0x04, 0xb2, 0x04,
+    0xd7, 0x04, 0xf2, 0x05, 0x1b, 0x05, 0x33, 0x05, 0x3f, 0x05, 0x77, 0x05,
+    0x9b, 0x05, 0xc6, 0x05, 0xf6, 0x06, 0x26, 0x06, 0x44, 0x06, 0x81, 0x06,
+    0xa2, 0x06, 0xc6, 0x06, 0xd8, 0x06, 0xf4, 0x07, 0x0d, 0x07, 0x2d, 0x07,
+    0x44, 0x07, 0x99, 0x07, 0xc2, 0x07, 0xe6, 0x08, 0x38, 0x08, 0x67, 0x08,
+    0xb9, 0x08, 0xf6, 0x09, 0x4f, 0x09, 0xa2, 0x0a, 0x19, 0x0a, 0x5a, 0x0a,
+    0xa5, 0x0a, 0xdc, 0x0b, 0x1b, 0x0b, 0x6b, 0x0b, 0x92, 0x0b, 0xeb, 0x0c,
+    0x71, 0x0c, 0xdd, 0x0d, 0x3d, 0x0d, 0xd8, 0x0e, 0x47, 0x0e, 0xbc, 0x0f,
+    0x14, 0x0f, 0x79, 0x0f, 0x8f, 0x0f, 0xc1, 0x0f, 0xf7, 0x10, 0x33, 0x10,
+    0xa1, 0x10, 0xdf, 0x11, 0x59, 0x11, 0x92, 0x11, 0xf3, 0x12, 0x21, 0x12,
+    0x65, 0x12, 0xb1, 0x12, 0xfd, 0x13, 0x67, 0x13, 0x9c, 0x14, 0x3a, 0x14,
+    0x96, 0x14, 0xd5, 0x15, 0x13, 0x15, 0x73, 0x15, 0xd4, 0x16, 0x53, 0x16,
+    0x88, 0x16, 0xee, 0x17, 0x49, 0x17, 0xd3, 0x18, 0x5a, 0x18, 0xca, 0x19,
+    0x28, 0x19, 0x96, 0x1a, 0x14, 0x1a, 0x7d, 0x1b, 0x21, 0x1b, 0x9f, 0x1c,
+    0x32, 0x1c, 0xe9, 0x1d, 0x26, 0x1d, 0xcb, 0x1e, 0x25, 0x1e, 0x6d, 0x1e,
+    0xc9, 0x1f, 0x3c, 0x1f, 0xbc, 0x20, 0x42, 0x20, 0x7e, 0x20, 0xba, 0x21,
+    0x2d, 0x21, 0x8b, 0x21, 0xfa, 0x22, 0x6a, 0x22, 0xb7, 0x22, 0xd8, 0x23,
+    0x2f, 0x23, 0xa5, 0x24, 0x2b, 0x24, 0x96, 0x25, 0x42, 0x25, 0x73, 0x25,
+    0xbe, 0x25, 0xf5, 0x26, 0x79, 0x26, 0xc8, 0x27, 0x23, 0x27, 0x93, 0x28,
+    0x12, 0x28, 0x70, 0x28, 0xae, 0x29, 0x3c, 0x29, 0xbd, 0x2a, 0x40, 0x2a,
+    0xb3, 0x2b, 0x3f, 0x2b, 0xc7, 0x2c, 0x8f, 0x2d, 0x2c, 0x2d, 0xd4, 0x2e,
+    0x36, 0x2e, 0x89, 0x2e, 0xb9, 0x2f, 0x0a, 0x2f, 0x8e, 0x30, 0x3a, 0x30,
+    0x6f, 0x30, 0xab, 0x30, 0xfc, 0x31, 0x5c, 0x31, 0xd0, 0x32, 0x41, 0x32,
+    0x86, 0x32, 0xe5, 0x33, 0x57, 0x33, 0xbc, 0x34, 0x23, 0x34, 0x70, 0x34,
+    0xe4, 0x35, 0x85, 0x35, 0xe2, 0x36, 0x4a, 0x36, 0xc7, 0x37, 0x2d, 0x37,
+    0xa8, 0x38, 0x2f, 0x38, 0xb3, 0x39, 0x33, 0x39, 0xa8, 0x3a, 0x03, 0x3a,
+    0x58, 0x3a, 0xb5, 0x3a, 0xfc, 0x3b, 0x4d, 0x3b, 0xbd, 0x3c, 0x4a, 0x3c,
+    0xbf, 0x3c, 0xff, 0x3d, 0x56, 0x3d, 0xd2, 0x3e, 0x6e, 0x3e, 0xbf, 0x3e,
+    0xe5, 0x3e, 0xfb, 0x3f, 0x30, 0x3f, 0x5e, 0x3f, 0x7e, 0x3f, 0xb0, 0x3f,
+    0xe9, 0x40, 0x00, 0x40, 0x4b, 0x40, 0x85, 0x40, 0x9b, 0x40, 0xb8, 0x40,
+    0xde, 0x41, 0x1c, 0x41, 0x3a, 0x41, 0x47, 0x41, 0x54, 0x41, 0x61, 0x41,
+    0x6e, 0x41, 0xd6, 0x42, 0x2b, 0x42, 0x37, 0x42, 0x83, 0x42, 0x97, 0x42,
+    0xe9, 0x92, 0x0a, 0xf0, 0x21, 0x5c, 0xff, 0x7d, 0x01, 0xfa, 0x03, 0x60,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x21, 0x11, 0x21, 0x25, 0x11,
+    0x21, 0x11, 0x5c, 0x01, 0x9e, 0xfe, 0x62, 0x01, 0x88, 0xfe, 0x8e, 0x03,
+    0x60, 0xfc, 0x1d, 0x16, 0x03, 0xb7, 0xfc, 0x49, 0x00, 0x02, 0x00, 0x05,
+    0x00, 0x00, 0x02, 0xc0, 0x03, 0xc6, 0x06, 0xf0, 0x2a, 0x0a, 0x00, 0x00,
+    0x01, 0x33, 0x01, 0x23, 0x27, 0x21, 0x07, 0x23, 0x01, 0x03, 0x03, 0x01,
     0x1c, 0x8d, 0x01, 0x17, 0x6a, 0x49, 0xfe, 0xab, 0x4a, 0x69, 0x01, 0xe8,
     0x8b, 0x8b, 0x03, 0x00, 0xfd, 0x00, 0xcf, 0xcf, 0x01, 0x28, 0x01, 0x88,
-    0xfe, 0x78, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x84,
-    0x03, 0x00, 0x00, 0x0e, 0x00, 0x17, 0x00, 0x20, 0x00, 0x00, 0x01, 0x32,
-    0x16, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x21,
-    0x11, 0x01, 0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x11, 0x13, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x15, 0x01, 0x7a, 0x6d, 0x84, 0x44,
-    0x37, 0x43, 0x51, 0x86, 0x78, 0xfe, 0xb8, 0x01, 0x31, 0x5d, 0x56, 0x5b,
-    0x5a, 0xcb, 0xc9, 0x53, 0x4d, 0x4c, 0x54, 0xc9, 0x03, 0x00, 0x66, 0x5d,
-    0x3e, 0x57, 0x12, 0x11, 0x61, 0x49, 0x65, 0x76, 0x03, 0x00, 0xfd, 0x58,
-    0x46, 0x41, 0x40, 0x49, 0xfe, 0xf0, 0x01, 0x65, 0x3e, 0x3b, 0x39, 0x3a,
-    0xec, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22, 0xff, 0xf0, 0x02, 0xc5,
-    0x03, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x04, 0x2e, 0x01, 0x35, 0x34, 0x3e,
-    0x01, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x23, 0x01, 0x19,
-    0x9f, 0x58, 0x58, 0x9f, 0x67, 0x7a, 0xa9, 0x1f, 0x60, 0x17, 0x71, 0x5a,
-    0x76, 0x83, 0x83, 0x76, 0x5c, 0x74, 0x15, 0x60, 0x1e, 0xaa, 0x7d, 0x10,
-    0x61, 0xb6, 0x79, 0x7a, 0xb5, 0x61, 0x81, 0x74, 0x1a, 0x55, 0x5c, 0xa1,
-    0x91, 0x90, 0xa2, 0x60, 0x5b, 0x18, 0x79, 0x88, 0x00, 0x02, 0x00, 0x3e,
-    0x00, 0x00, 0x02, 0xb8, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x00,
-    0x01, 0x32, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x01, 0x23, 0x21, 0x11, 0x01,
-    0x32, 0x36, 0x35, 0x34, 0x26, 0x2b, 0x01, 0x11, 0x01, 0x49, 0x71, 0xa5,
-    0x59, 0x59, 0xa5, 0x71, 0xfe, 0xf5, 0x01, 0x09, 0x84, 0x88, 0x88, 0x84,
-    0xa5, 0x03, 0x00, 0x5c, 0xad, 0x77, 0x77, 0xad, 0x5c, 0x03, 0x00, 0xfd,
-    0x5a, 0x97, 0x8f, 0x8f, 0x98, 0xfd, 0xb3, 0x00, 0x00, 0x01, 0x00, 0x3e,
-    0x00, 0x00, 0x02, 0x53, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x02, 0x49,
-    0xfe, 0x59, 0x01, 0x8a, 0xfe, 0x76, 0x01, 0xb1, 0xfd, 0xeb, 0x02, 0x0b,
-    0x02, 0xa7, 0xe7, 0x59, 0xfe, 0xf3, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x49, 0x03, 0x00, 0x00, 0x09,
-    0x00, 0x00, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x23, 0x11, 0x21,
-    0x02, 0x49, 0xfe, 0x59, 0x01, 0x90, 0xfe, 0x70, 0x64, 0x02, 0x0b, 0x02,
-    0xa7, 0xf5, 0x59, 0xfe, 0xa7, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22,
-    0xff, 0xf0, 0x02, 0xd0, 0x03, 0x10, 0x00, 0x20, 0x00, 0x00, 0x04, 0x2e,
-    0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2e, 0x01,
-    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x21, 0x35,
-    0x21, 0x11, 0x23, 0x27, 0x0e, 0x01, 0x23, 0x01, 0x0b, 0x97, 0x52, 0x58,
+    0xfe, 0x78, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x84, 0x03, 0x00,
+    0x00, 0x0e, 0x00, 0x17, 0x00, 0x20, 0x70, 0x03, 0x60, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x16, 0x06, 0x00, 0xd3, 0x23, 0x21, 0x11, 0x01, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x13, 0x09, 0x00, 0xf0, 0x28, 0x15,
+    0x01, 0x7a, 0x6d, 0x84, 0x44, 0x37, 0x43, 0x51, 0x86, 0x78, 0xfe, 0xb8,
+    0x01, 0x31, 0x5d, 0x56, 0x5b, 0x5a, 0xcb, 0xc9, 0x53, 0x4d, 0x4c, 0x54,
+    0xc9, 0x03, 0x00, 0x66, 0x5d, 0x3e, 0x57, 0x12, 0x11, 0x61, 0x49, 0x65,
+    0x76, 0x03, 0x00, 0xfd, 0x58, 0x46, 0x41, 0x40, 0x49, 0xfe, 0xf0, 0x01,
+    0x65, 0x3e, 0x3b, 0x39, 0x3a, 0xec, 0x70, 0x07, 0xf1, 0x48, 0x22, 0xff,
+    0xf0, 0x02, 0xc5, 0x03, 0x10, 0x00, 0x1b, 0x00, 0x00, 0x04, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x23, 0x01, 0x19, 0x9f, 0x58, 0x58, 0x9f, 0x67, 0x7a, 0xa9, 0x1f, 0x60,
+    0x17, 0x71, 0x5a, 0x76, 0x83, 0x83, 0x76, 0x5c, 0x74, 0x15, 0x60, 0x1e,
+    0xaa, 0x7d, 0x10, 0x61, 0xb6, 0x79, 0x7a, 0xb5, 0x61, 0x81, 0x74, 0x1a,
+    0x55, 0x5c, 0xa1, 0x91, 0x90, 0xa2, 0x60, 0x5b, 0x18, 0x79, 0x88, 0x00,
+    0x02, 0xc2, 0x00, 0x71, 0xb8, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x13, 0xc0,
+    0x00, 0x00, 0xbb, 0x00, 0x09, 0xbc, 0x00, 0xf0, 0x14, 0x01, 0x49, 0x71,
+    0xa5, 0x59, 0x59, 0xa5, 0x71, 0xfe, 0xf5, 0x01, 0x09, 0x84, 0x88, 0x88,
+    0x84, 0xa5, 0x03, 0x00, 0x5c, 0xad, 0x77, 0x77, 0xad, 0x5c, 0x03, 0x00,
+    0xfd, 0x5a, 0x97, 0x8f, 0x8f, 0x98, 0xfd, 0xb3, 0xa0, 0x00, 0x00, 0x48,
+    0x00, 0x40, 0x53, 0x03, 0x00, 0x00, 0xda, 0x0c, 0x61, 0x21, 0x15, 0x21,
+    0x15, 0x21, 0x11, 0x04, 0x00, 0xf4, 0x08, 0x02, 0x49, 0xfe, 0x59, 0x01,
+    0x8a, 0xfe, 0x76, 0x01, 0xb1, 0xfd, 0xeb, 0x02, 0x0b, 0x02, 0xa7, 0xe7,
+    0x59, 0xfe, 0xf3, 0x5a, 0x03, 0x00, 0x32, 0x00, 0x55, 0x49, 0x03, 0x00,
+    0x00, 0x09, 0x32, 0x00, 0x13, 0x23, 0x30, 0x00, 0x40, 0x90, 0xfe, 0x70,
+    0x64, 0x2d, 0x00, 0x64, 0xf5, 0x59, 0xfe, 0xa7, 0x03, 0x00, 0xfe, 0x00,
+    0x5f, 0xd0, 0x03, 0x10, 0x00, 0x20, 0xfe, 0x00, 0x07, 0x60, 0x21, 0x35,
+    0x21, 0x11, 0x23, 0x27, 0x03, 0x01, 0xf4, 0x26, 0x0b, 0x97, 0x52, 0x58,
     0x9f, 0x68, 0x77, 0xa6, 0x23, 0x60, 0x18, 0x71, 0x57, 0x77, 0x83, 0x7c,
     0x74, 0x6b, 0x86, 0x05, 0xfe, 0xff, 0x01, 0x64, 0x54, 0x0c, 0x29, 0x84,
     0x54, 0x10, 0x61, 0xb5, 0x7a, 0x7a, 0xb5, 0x61, 0x7a, 0x6f, 0x1b, 0x51,
     0x55, 0xa1, 0x91, 0x91, 0xa1, 0x7f, 0x6c, 0x59, 0xfe, 0x6e, 0x7b, 0x44,
-    0x47, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0xa4,
-    0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x21, 0x23, 0x11, 0x21, 0x11, 0x23,
-    0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x02, 0xa4, 0x64, 0xfe, 0x62, 0x64,
-    0x64, 0x01, 0x9e, 0x64, 0x01, 0x67, 0xfe, 0x99, 0x03, 0x00, 0xfe, 0xc0,
-    0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xa2,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x33, 0x11, 0x33, 0x11, 0x3e, 0x64,
-    0x03, 0x00, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x04, 0xff, 0xf3, 0x01, 0xbd,
-    0x03, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x16, 0x26, 0x27, 0x37, 0x1e, 0x01,
-    0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x8a, 0x74,
-    0x12, 0x64, 0x08, 0x3a, 0x37, 0x3a, 0x3f, 0x63, 0x77, 0x65, 0x0d, 0x58,
-    0x51, 0x1d, 0x2d, 0x3e, 0x4b, 0x50, 0x02, 0x17, 0xfd, 0xe5, 0x77, 0x7b,
-    0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x8f, 0x03, 0x00, 0x00, 0x0a,
-    0x00, 0x00, 0x13, 0x33, 0x11, 0x01, 0x33, 0x09, 0x01, 0x23, 0x01, 0x11,
-    0x23, 0x3e, 0x64, 0x01, 0x5e, 0x81, 0xfe, 0x88, 0x01, 0x86, 0x88, 0xfe,
-    0x9b, 0x64, 0x03, 0x00, 0xfe, 0xaa, 0x01, 0x56, 0xfe, 0x94, 0xfe, 0x6c,
-    0x01, 0x76, 0xfe, 0x8a, 0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x29,
-    0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 0x37, 0x21, 0x15, 0x21, 0x11, 0x33,
-    0xa2, 0x01, 0x87, 0xfe, 0x15, 0x64, 0x5a, 0x5a, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x3e, 0x00, 0x00, 0x03, 0x46, 0x03, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x13, 0x33, 0x1b, 0x01, 0x33, 0x11, 0x23, 0x11, 0x03, 0x23,
-    0x03, 0x11, 0x23, 0x3e, 0xa5, 0xe0, 0xe1, 0xa2, 0x61, 0xe0, 0x85, 0xe1,
-    0x61, 0x03, 0x00, 0xfd, 0x58, 0x02, 0xa8, 0xfd, 0x00, 0x02, 0xa7, 0xfd,
-    0x59, 0x02, 0xa7, 0xfd, 0x59, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3e,
-    0x00, 0x00, 0x02, 0xb2, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x13, 0x33,
-    0x01, 0x11, 0x33, 0x11, 0x23, 0x01, 0x11, 0x23, 0x3e, 0xa3, 0x01, 0x6e,
-    0x63, 0xa0, 0xfe, 0x90, 0x64, 0x03, 0x00, 0xfd, 0x53, 0x02, 0xad, 0xfd,
-    0x00, 0x02, 0xb0, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22,
-    0xff, 0xf0, 0x02, 0xe0, 0x03, 0x10, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00,
-    0x04, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15,
-    0x14, 0x0e, 0x01, 0x23, 0x02, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0x01, 0x19, 0x9f, 0x58, 0x58, 0x9f, 0x68, 0x68,
-    0x9e, 0x59, 0x59, 0x9e, 0x68, 0xfa, 0x83, 0x77, 0x76, 0x84, 0x83, 0x77,
-    0x77, 0x83, 0x10, 0x61, 0xb6, 0x79, 0x7a, 0xb5, 0x61, 0x61, 0xb5, 0x7a,
-    0x79, 0xb6, 0x61, 0x01, 0x00, 0xa2, 0xa2, 0x90, 0x91, 0xa1, 0xa1, 0x91,
-    0x00, 0x02, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x76, 0x03, 0x00, 0x00, 0x0a,
-    0x00, 0x12, 0x00, 0x00, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x2b, 0x01,
-    0x11, 0x23, 0x11, 0x01, 0x32, 0x36, 0x35, 0x34, 0x2b, 0x01, 0x11, 0x01,
-    0x66, 0x80, 0x90, 0x90, 0x80, 0xc4, 0x64, 0x01, 0x22, 0x5a, 0x5b, 0xb5,
-    0xbe, 0x03, 0x00, 0x7c, 0x6f, 0x6f, 0x7a, 0xfe, 0xd4, 0x03, 0x00, 0xfe,
-    0x85, 0x4a, 0x46, 0x91, 0xfe, 0xdf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x22,
-    0xff, 0xe1, 0x02, 0xe0, 0x03, 0x10, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
-    0x04, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15,
-    0x14, 0x06, 0x07, 0x17, 0x23, 0x27, 0x06, 0x23, 0x02, 0x16, 0x33, 0x32,
-    0x37, 0x27, 0x33, 0x17, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0x01, 0x19, 0x9f, 0x58, 0x58, 0x9f, 0x68, 0x68, 0x9e, 0x59, 0x38, 0x33,
-    0x63, 0x75, 0x33, 0x4e, 0x61, 0xfa, 0x83, 0x77, 0x3e, 0x2f, 0x90, 0x76,
-    0x61, 0x46, 0x83, 0x77, 0x77, 0x83, 0x10, 0x61, 0xb6, 0x79, 0x7a, 0xb5,
-    0x61, 0x61, 0xb5, 0x7a, 0x5f, 0x9a, 0x36, 0x70, 0x3b, 0x2c, 0x01, 0x00,
-    0xa2, 0x17, 0xa4, 0x6e, 0x4f, 0x96, 0x91, 0xa1, 0xa1, 0x91, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x86, 0x03, 0x00, 0x00, 0x15,
-    0x00, 0x1d, 0x00, 0x00, 0x01, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x1e,
-    0x02, 0x1f, 0x01, 0x23, 0x27, 0x2e, 0x02, 0x2b, 0x01, 0x11, 0x23, 0x11,
-    0x01, 0x32, 0x36, 0x35, 0x34, 0x2b, 0x01, 0x11, 0x01, 0x8b, 0x77, 0x84,
-    0x55, 0x42, 0x2b, 0x2f, 0x17, 0x0d, 0x16, 0x66, 0x10, 0x0b, 0x1c, 0x3e,
-    0x39, 0xcd, 0x64, 0x01, 0x4d, 0x4d, 0x4c, 0x9a, 0xe8, 0x03, 0x00, 0x72,
-    0x62, 0x45, 0x69, 0x12, 0x0e, 0x39, 0x52, 0x4d, 0x86, 0x7b, 0x4c, 0x56,
-    0x2c, 0xfe, 0xb7, 0x03, 0x00, 0xfe, 0xa2, 0x46, 0x3e, 0x81, 0xfe, 0xfb,
-    0x00, 0x01, 0x00, 0x0c, 0xff, 0xf0, 0x02, 0x79, 0x03, 0x0e, 0x00, 0x2a,
-    0x00, 0x00, 0x16, 0x26, 0x27, 0x37, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32,
-    0x16, 0x17, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1e, 0x01,
-    0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x01, 0x23, 0xd1, 0xac, 0x19,
-    0x67, 0x10, 0x71, 0x66, 0x5a, 0x62, 0x4f, 0x5d, 0x4d, 0x85, 0x73, 0x46,
-    0x81, 0x54, 0x72, 0x9e, 0x1e, 0x5f, 0x17, 0x69, 0x55, 0x5a, 0x58, 0x1c,
-    0x48, 0x42, 0x50, 0x7d, 0x7e, 0x46, 0x82, 0x57, 0x10, 0x7a, 0x67, 0x1d,
-    0x4b, 0x57, 0x4c, 0x3e, 0x3a, 0x35, 0x0d, 0x0b, 0x13, 0x6b, 0x56, 0x3e,
-    0x64, 0x3b, 0x6a, 0x5c, 0x1b, 0x40, 0x46, 0x4b, 0x33, 0x22, 0x2e, 0x20,
-    0x0a, 0x0c, 0x13, 0x68, 0x5b, 0x44, 0x6a, 0x3b, 0x00, 0x01, 0x00, 0x0d,
-    0x00, 0x00, 0x02, 0x6c, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x01, 0x23,
-    0x11, 0x23, 0x11, 0x23, 0x35, 0x21, 0x02, 0x6c, 0xfe, 0x63, 0xfe, 0x02,
-    0x5f, 0x02, 0xa7, 0xfd, 0x59, 0x02, 0xa7, 0x59, 0x00, 0x01, 0x00, 0x3c,
-    0xff, 0xf0, 0x02, 0x91, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x16, 0x26,
-    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33,
-    0x11, 0x14, 0x06, 0x23, 0xde, 0xa2, 0x64, 0x65, 0x62, 0x61, 0x66, 0x63,
-    0xa2, 0x88, 0x10, 0xa0, 0x92, 0x01, 0xde, 0xfe, 0x28, 0x6f, 0x6b, 0x6b,
-    0x6f, 0x01, 0xd8, 0xfe, 0x22, 0x92, 0xa0, 0x00, 0x00, 0x01, 0x00, 0x05,
-    0x00, 0x00, 0x02, 0xc0, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x13, 0x33,
-    0x1b, 0x01, 0x33, 0x01, 0x23, 0x05, 0x6d, 0xf2, 0xf3, 0x69, 0xfe, 0xe9,
-    0x8d, 0x03, 0x00, 0xfd, 0x53, 0x02, 0xad, 0xfd, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x03, 0xdd, 0x03, 0x00, 0x00, 0x0c,
-    0x00, 0x00, 0x13, 0x33, 0x1b, 0x01, 0x33, 0x1b, 0x01, 0x33, 0x03, 0x23,
-    0x0b, 0x01, 0x23, 0x1a, 0x68, 0x96, 0x9b, 0x93, 0x9c, 0x95, 0x66, 0xa9,
-    0x9f, 0x98, 0x99, 0xa0, 0x03, 0x00, 0xfd, 0x48, 0x02, 0xb8, 0xfd, 0x46,
-    0x02, 0xba, 0xfd, 0x00, 0x02, 0xae, 0xfd, 0x52, 0x00, 0x01, 0xff, 0xf4,
-    0x00, 0x00, 0x02, 0x9d, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x01, 0x03,
-    0x33, 0x1b, 0x01, 0x33, 0x03, 0x01, 0x23, 0x0b, 0x01, 0x23, 0x01, 0x0a,
-    0xfc, 0x75, 0xc7, 0xc7, 0x72, 0xfa, 0x01, 0x14, 0x73, 0xe1, 0xe1, 0x74,
-    0x01, 0x94, 0x01, 0x6c, 0xfe, 0xdc, 0x01, 0x24, 0xfe, 0x95, 0xfe, 0x6b,
-    0x01, 0x4b, 0xfe, 0xb5, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x02, 0x87,
-    0x03, 0x00, 0x00, 0x08, 0x00, 0x00, 0x09, 0x01, 0x33, 0x1b, 0x01, 0x33,
-    0x01, 0x11, 0x23, 0x01, 0x10, 0xfe, 0xef, 0x72, 0xd4, 0xd3, 0x6f, 0xfe,
+    0x47, 0x92, 0x00, 0x12, 0xa4, 0xc4, 0x00, 0x30, 0x21, 0x23, 0x11, 0x90,
+    0x00, 0xf2, 0x0a, 0x33, 0x11, 0x21, 0x11, 0x33, 0x02, 0xa4, 0x64, 0xfe,
+    0x62, 0x64, 0x64, 0x01, 0x9e, 0x64, 0x01, 0x67, 0xfe, 0x99, 0x03, 0x00,
+    0xfe, 0xc0, 0x01, 0x40, 0x2e, 0x00, 0xe0, 0x00, 0xa2, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x33, 0x11, 0x33, 0x11, 0x3e, 0x64, 0x1c, 0x02, 0xf0,
+    0x04, 0x00, 0x01, 0x00, 0x04, 0xff, 0xf3, 0x01, 0xbd, 0x03, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x16, 0x26, 0x27, 0x37, 0x16, 0x9e, 0x00, 0xf3, 0x12,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x8a, 0x74, 0x12, 0x64, 0x08,
+    0x3a, 0x37, 0x3a, 0x3f, 0x63, 0x77, 0x65, 0x0d, 0x58, 0x51, 0x1d, 0x2d,
+    0x3e, 0x4b, 0x50, 0x02, 0x17, 0xfd, 0xe5, 0x77, 0x7b, 0x7e, 0x00, 0x11,
+    0x8f, 0x8a, 0x01, 0xf3, 0x18, 0x00, 0x13, 0x33, 0x11, 0x01, 0x33, 0x01,
+    0x01, 0x23, 0x01, 0x11, 0x23, 0x3e, 0x64, 0x01, 0x5e, 0x81, 0xfe, 0x88,
+    0x01, 0x86, 0x88, 0xfe, 0x9b, 0x64, 0x03, 0x00, 0xfe, 0xaa, 0x01, 0x56,
+    0xfe, 0x94, 0xfe, 0x6c, 0x01, 0x76, 0xfe, 0x8a, 0x34, 0x00, 0x30, 0x29,
+    0x03, 0x00, 0xbe, 0x02, 0x10, 0x37, 0x42, 0x01, 0xa3, 0x33, 0xa2, 0x01,
+    0x87, 0xfe, 0x15, 0x64, 0x5a, 0x5a, 0x03, 0xd0, 0x00, 0x60, 0x03, 0x46,
+    0x03, 0x00, 0x00, 0x0c, 0x52, 0x00, 0xf0, 0x06, 0x13, 0x13, 0x33, 0x11,
+    0x23, 0x11, 0x03, 0x23, 0x03, 0x11, 0x23, 0x3e, 0xa5, 0xe0, 0xe1, 0xa2,
+    0x61, 0xe0, 0x85, 0xe1, 0x61, 0x6b, 0x02, 0x80, 0x02, 0xa8, 0xfd, 0x00,
+    0x02, 0xa7, 0xfd, 0x59, 0x04, 0x00, 0x04, 0x06, 0x01, 0x12, 0xb2, 0x98,
+    0x01, 0x61, 0x13, 0x33, 0x01, 0x11, 0x33, 0x11, 0x87, 0x00, 0x70, 0xa3,
+    0x01, 0x6e, 0x63, 0xa0, 0xfe, 0x90, 0xe5, 0x00, 0x90, 0x53, 0x02, 0xad,
+    0xfd, 0x00, 0x02, 0xb0, 0xfd, 0x50, 0x62, 0x03, 0x00, 0x9a, 0x01, 0x5a,
+    0xe0, 0x03, 0x10, 0x00, 0x0f, 0x9a, 0x02, 0x02, 0x47, 0x02, 0x11, 0x02,
+    0xfc, 0x00, 0x11, 0x34, 0xa6, 0x01, 0x02, 0x9a, 0x02, 0xf3, 0x01, 0x68,
+    0x68, 0x9e, 0x59, 0x59, 0x9e, 0x68, 0xfa, 0x83, 0x77, 0x76, 0x84, 0x83,
+    0x77, 0x77, 0x83, 0x97, 0x02, 0xf3, 0x00, 0x61, 0xb5, 0x7a, 0x79, 0xb6,
+    0x61, 0x01, 0x00, 0xa2, 0xa2, 0x90, 0x91, 0xa1, 0xa1, 0x91, 0x98, 0x02,
+    0x11, 0x76, 0x0e, 0x01, 0x14, 0x12, 0x58, 0x03, 0x42, 0x23, 0x23, 0x11,
+    0x23, 0x98, 0x02, 0x00, 0x97, 0x02, 0xf1, 0x0f, 0x66, 0x80, 0x90, 0x90,
+    0x80, 0xc4, 0x64, 0x01, 0x22, 0x5a, 0x5b, 0xb5, 0xbe, 0x03, 0x00, 0x7c,
+    0x6f, 0x6f, 0x7a, 0xfe, 0xd4, 0x03, 0x00, 0xfe, 0x85, 0x4a, 0x46, 0x91,
+    0xfe, 0xdf, 0x9a, 0x00, 0x11, 0xe1, 0x9a, 0x00, 0x3c, 0x13, 0x00, 0x23,
+    0x9a, 0x00, 0x42, 0x07, 0x17, 0x23, 0x27, 0x9e, 0x00, 0x4e, 0x37, 0x27,
+    0x33, 0x17, 0xa2, 0x00, 0xfa, 0x01, 0x38, 0x33, 0x63, 0x75, 0x33, 0x4e,
+    0x61, 0xfa, 0x83, 0x77, 0x3e, 0x2f, 0x90, 0x76, 0x61, 0x46, 0xaa, 0x00,
+    0xe7, 0x5f, 0x9a, 0x36, 0x70, 0x3b, 0x2c, 0x01, 0x00, 0xa2, 0x17, 0xa4,
+    0x6e, 0x4f, 0x96, 0xb0, 0x00, 0x20, 0x86, 0x03, 0x32, 0x06, 0x15, 0x1d,
+    0x08, 0x04, 0x8a, 0x1e, 0x02, 0x17, 0x17, 0x23, 0x27, 0x2e, 0x02, 0xb9,
+    0x00, 0xf8, 0x30, 0x8b, 0x77, 0x84, 0x55, 0x42, 0x2b, 0x2f, 0x17, 0x0d,
+    0x16, 0x66, 0x10, 0x0b, 0x1c, 0x3e, 0x39, 0xcd, 0x64, 0x01, 0x4d, 0x4d,
+    0x4c, 0x9a, 0xe8, 0x03, 0x00, 0x72, 0x62, 0x45, 0x69, 0x12, 0x0e, 0x39,
+    0x52, 0x4d, 0x86, 0x7b, 0x4c, 0x56, 0x2c, 0xfe, 0xb7, 0x03, 0x00, 0xfe,
+    0xa2, 0x46, 0x3e, 0x81, 0xfe, 0xfb, 0x00, 0x01, 0x00, 0x0c, 0xff, 0xf0,
+    0x02, 0x79, 0x03, 0x0e, 0x00, 0x2a, 0x56, 0x02, 0x5e, 0x34, 0x26, 0x27,
+    0x27, 0x26, 0x0f, 0x03, 0x33, 0x16, 0x17, 0x17, 0x81, 0x01, 0xf1, 0x40,
+    0xd1, 0xac, 0x19, 0x67, 0x10, 0x71, 0x66, 0x5a, 0x62, 0x4f, 0x5d, 0x4d,
+    0x85, 0x73, 0x46, 0x81, 0x54, 0x72, 0x9e, 0x1e, 0x5f, 0x17, 0x69, 0x55,
+    0x5a, 0x58, 0x1c, 0x48, 0x42, 0x50, 0x7d, 0x7e, 0x46, 0x82, 0x57, 0x10,
+    0x7a, 0x67, 0x1d, 0x4b, 0x57, 0x4c, 0x3e, 0x3a, 0x35, 0x0d, 0x0b, 0x13,
+    0x6b, 0x56, 0x3e, 0x64, 0x3b, 0x6a, 0x5c, 0x1b, 0x40, 0x46, 0x4b, 0x33,
+    0x22, 0x2e, 0x20, 0x0a, 0x0c, 0x13, 0x68, 0x5b, 0x44, 0x6a, 0x3b, 0x00,
+    0x01, 0x00, 0x0d, 0x00, 0x00, 0x02, 0x6c, 0x20, 0x05, 0x20, 0x00, 0x01,
+    0xcf, 0x00, 0xa2, 0x23, 0x35, 0x21, 0x02, 0x6c, 0xfe, 0x63, 0xfe, 0x02,
+    0x5f, 0x3c, 0x02, 0xd0, 0x59, 0x00, 0x01, 0x00, 0x3c, 0xff, 0xf0, 0x02,
+    0x91, 0x03, 0x00, 0x00, 0x11, 0xa4, 0x00, 0x01, 0xf3, 0x02, 0x07, 0xfc,
+    0x02, 0xf0, 0x0c, 0xde, 0xa2, 0x64, 0x65, 0x62, 0x61, 0x66, 0x63, 0xa2,
+    0x88, 0x10, 0xa0, 0x92, 0x01, 0xde, 0xfe, 0x28, 0x6f, 0x6b, 0x6b, 0x6f,
+    0x01, 0xd8, 0xfe, 0x22, 0x92, 0xa0, 0x76, 0x02, 0x04, 0x80, 0x05, 0x13,
+    0x06, 0xac, 0x02, 0xa4, 0x01, 0x23, 0x05, 0x6d, 0xf2, 0xf3, 0x69, 0xfe,
+    0xe9, 0x8d, 0x72, 0x02, 0x00, 0x26, 0x00, 0x56, 0x1a, 0x00, 0x00, 0x03,
+    0xdd, 0xd2, 0x02, 0x00, 0x03, 0x00, 0xf3, 0x1b, 0x03, 0x23, 0x03, 0x03,
+    0x23, 0x1a, 0x68, 0x96, 0x9b, 0x93, 0x9c, 0x95, 0x66, 0xa9, 0x9f, 0x98,
+    0x99, 0xa0, 0x03, 0x00, 0xfd, 0x48, 0x02, 0xb8, 0xfd, 0x46, 0x02, 0xba,
+    0xfd, 0x00, 0x02, 0xae, 0xfd, 0x52, 0x00, 0x01, 0xff, 0xf4, 0x00, 0x00,
+    0x02, 0x9d, 0x9e, 0x04, 0x11, 0x03, 0x36, 0x00, 0x10, 0x01, 0x37, 0x00,
+    0xf0, 0x11, 0x01, 0x0a, 0xfc, 0x75, 0xc7, 0xc7, 0x72, 0xfa, 0x01, 0x14,
+    0x73, 0xe1, 0xe1, 0x74, 0x01, 0x94, 0x01, 0x6c, 0xfe, 0xdc, 0x01, 0x24,
+    0xfe, 0x95, 0xfe, 0x6b, 0x01, 0x4b, 0xfe, 0xb5, 0x00, 0x01, 0xa6, 0x0b,
+    0x31, 0x02, 0x87, 0x03, 0xd0, 0x10, 0x21, 0x01, 0x01, 0x97, 0x00, 0xf2,
+    0x12, 0x11, 0x23, 0x01, 0x10, 0xfe, 0xef, 0x72, 0xd4, 0xd3, 0x6f, 0xfe,
     0xed, 0x64, 0x01, 0x47, 0x01, 0xb9, 0xfe, 0xa6, 0x01, 0x5a, 0xfe, 0x46,
-    0xfe, 0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x02, 0x6a,
-    0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x37, 0x01, 0x21, 0x35, 0x21, 0x15,
-    0x01, 0x21, 0x15, 0x21, 0x25, 0x01, 0xc8, 0xfe, 0x41, 0x02, 0x3c, 0xfe,
-    0x36, 0x01, 0xc8, 0xfd, 0xbd, 0x57, 0x02, 0x50, 0x59, 0x56, 0xfd, 0xb0,
-    0x5a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1c, 0xff, 0xf2, 0x01, 0xe9,
-    0x02, 0x20, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x00, 0x16, 0x26, 0x35, 0x34,
-    0x36, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
-    0x27, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x16, 0x1d, 0x01, 0x14, 0x17,
-    0x23, 0x26, 0x27, 0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x0e, 0x01, 0x0f, 0x01, 0x0e, 0x01, 0x15, 0x7f, 0x63, 0x65, 0x5d,
-    0x2b, 0x40, 0x3a, 0x44, 0x35, 0x41, 0x42, 0x0e, 0x58, 0x0f, 0x78, 0x60,
-    0x36, 0x56, 0x1c, 0x30, 0x09, 0x59, 0x07, 0x03, 0x1c, 0x5e, 0x3a, 0x58,
-    0x39, 0x2f, 0x49, 0x58, 0x0d, 0x31, 0x33, 0x27, 0x3a, 0x37, 0x0e, 0x4f,
-    0x45, 0x46, 0x4e, 0x11, 0x08, 0x0a, 0x1d, 0x21, 0x27, 0x2e, 0x3d, 0x2f,
-    0x15, 0x45, 0x62, 0x1e, 0x1b, 0x2e, 0x55, 0xd7, 0x6d, 0x20, 0x27, 0x1f,
-    0x26, 0x2e, 0x75, 0x26, 0x51, 0x4f, 0x36, 0x0f, 0x16, 0x0a, 0x07, 0x0d,
-    0x25, 0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0xff, 0xf1, 0x02, 0x27,
-    0x03, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00, 0x04, 0x26, 0x27, 0x15,
-    0x23, 0x11, 0x33, 0x11, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15, 0x14,
-    0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-    0x22, 0x06, 0x15, 0x01, 0x0c, 0x5f, 0x1f, 0x5a, 0x5f, 0x1e, 0x5c, 0x3a,
-    0x42, 0x65, 0x39, 0x39, 0x65, 0x41, 0xbb, 0x59, 0x4b, 0x48, 0x50, 0x50,
-    0x48, 0x4b, 0x59, 0x0f, 0x32, 0x2e, 0x51, 0x03, 0x00, 0xfe, 0xc5, 0x2b,
-    0x2f, 0x43, 0x7f, 0x55, 0x55, 0x7f, 0x43, 0xbd, 0x6a, 0x67, 0x5d, 0x5d,
-    0x67, 0x6a, 0x5a, 0x00, 0x00, 0x01, 0x00, 0x19, 0xff, 0xf1, 0x01, 0xfd,
-    0x02, 0x20, 0x00, 0x1b, 0x00, 0x00, 0x16, 0x2e, 0x01, 0x35, 0x34, 0x3e,
-    0x01, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15,
-    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x23, 0xca, 0x71,
-    0x40, 0x40, 0x71, 0x4a, 0x55, 0x79, 0x18, 0x59, 0x10, 0x48, 0x35, 0x4a,
-    0x53, 0x53, 0x4a, 0x37, 0x4b, 0x0e, 0x59, 0x16, 0x7c, 0x57, 0x0f, 0x45,
-    0x7f, 0x54, 0x54, 0x7e, 0x45, 0x59, 0x4e, 0x15, 0x32, 0x37, 0x68, 0x5c,
-    0x5c, 0x69, 0x3d, 0x38, 0x17, 0x53, 0x5e, 0x00, 0x00, 0x02, 0x00, 0x19,
-    0xff, 0xf1, 0x02, 0x0c, 0x03, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x00,
-    0x16, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x11,
-    0x33, 0x11, 0x23, 0x35, 0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0xb8, 0x66, 0x39, 0x39, 0x66,
-    0x41, 0x3a, 0x5c, 0x1f, 0x5e, 0x5a, 0x1e, 0x60, 0x3c, 0x81, 0x50, 0x48,
-    0x4c, 0x58, 0x58, 0x4c, 0x48, 0x50, 0x0f, 0x43, 0x7f, 0x55, 0x55, 0x7f,
-    0x43, 0x2f, 0x2b, 0x01, 0x3b, 0xfd, 0x00, 0x51, 0x2e, 0x32, 0xba, 0x67,
-    0x6a, 0x5a, 0x5a, 0x6a, 0x67, 0x5d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19,
-    0xff, 0xf1, 0x02, 0x0b, 0x02, 0x20, 0x00, 0x17, 0x00, 0x1e, 0x00, 0x00,
-    0x16, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15,
-    0x14, 0x07, 0x21, 0x1e, 0x01, 0x33, 0x32, 0x37, 0x17, 0x0e, 0x01, 0x23,
-    0x13, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0xcc, 0x73, 0x40, 0x41, 0x74,
-    0x49, 0x41, 0x6f, 0x44, 0x02, 0xfe, 0x6e, 0x06, 0x54, 0x48, 0x6c, 0x23,
-    0x5a, 0x1a, 0x7a, 0x55, 0x94, 0x09, 0x4c, 0x42, 0x40, 0x4f, 0x0d, 0x0f,
-    0x45, 0x7f, 0x54, 0x54, 0x7e, 0x45, 0x3b, 0x76, 0x57, 0x11, 0x14, 0x53,
-    0x5c, 0x66, 0x18, 0x4d, 0x54, 0x01, 0x4f, 0x45, 0x4a, 0x4a, 0x45, 0x00,
-    0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x01, 0x4c, 0x03, 0x0b, 0x00, 0x15,
-    0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17,
-    0x15, 0x26, 0x23, 0x22, 0x06, 0x1d, 0x01, 0x33, 0x15, 0x23, 0x11, 0x23,
-    0x60, 0x58, 0x58, 0x4e, 0x4a, 0x30, 0x24, 0x1d, 0x2a, 0x23, 0x24, 0x80,
-    0x80, 0x5e, 0x01, 0xc0, 0x4f, 0x5e, 0x4b, 0x53, 0x0b, 0x51, 0x0c, 0x2b,
-    0x30, 0x51, 0x4f, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1a,
-    0xff, 0x25, 0x02, 0x0d, 0x02, 0x1f, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x00,
-    0x16, 0x26, 0x27, 0x37, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x0e,
-    0x01, 0x23, 0x22, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x16,
-    0x17, 0x35, 0x33, 0x11, 0x14, 0x06, 0x23, 0x02, 0x16, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0xb1, 0x78, 0x16, 0x5c, 0x0b,
-    0x4a, 0x3e, 0x4a, 0x53, 0x1f, 0x5c, 0x3a, 0x40, 0x66, 0x3a, 0x39, 0x66,
-    0x40, 0x3c, 0x5f, 0x1e, 0x5b, 0x89, 0x74, 0x98, 0x4f, 0x49, 0x4c, 0x58,
-    0x58, 0x4c, 0x49, 0x4f, 0xdb, 0x4d, 0x3d, 0x22, 0x27, 0x36, 0x4d, 0x55,
-    0x45, 0x2b, 0x2c, 0x40, 0x7b, 0x53, 0x52, 0x7a, 0x41, 0x2f, 0x2d, 0x4c,
-    0xfe, 0x06, 0x75, 0x7b, 0x01, 0x94, 0x62, 0x65, 0x56, 0x55, 0x65, 0x62,
-    0x58, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x02, 0x03,
-    0x03, 0x00, 0x00, 0x16, 0x00, 0x00, 0x13, 0x33, 0x11, 0x3e, 0x01, 0x33,
-    0x32, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
-    0x0e, 0x01, 0x1d, 0x01, 0x23, 0x34, 0x5f, 0x1e, 0x60, 0x3a, 0x5c, 0x5c,
-    0x5e, 0x34, 0x3c, 0x27, 0x48, 0x15, 0x0f, 0x0f, 0x5f, 0x03, 0x00, 0xfe,
-    0xb8, 0x2e, 0x39, 0x70, 0x62, 0xfe, 0xb3, 0x01, 0x39, 0x4a, 0x48, 0x2b,
-    0x25, 0x1b, 0x49, 0x3b, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x26,
-    0x00, 0x00, 0x00, 0xa2, 0x03, 0x0a, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00,
-    0x33, 0x23, 0x11, 0x33, 0x26, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-    0x23, 0x22, 0x26, 0x35, 0x93, 0x5f, 0x5f, 0x6d, 0x22, 0x1c, 0x1c, 0x22,
-    0x22, 0x1c, 0x1c, 0x22, 0x02, 0x0f, 0xd9, 0x22, 0x22, 0x1b, 0x1c, 0x21,
-    0x21, 0x1c, 0x00, 0x00, 0x00, 0x02, 0xff, 0xbb, 0xff, 0x2c, 0x00, 0xa0,
-    0x03, 0x0a, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x07, 0x16, 0x33, 0x32,
-    0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x23, 0x22, 0x27, 0x12, 0x36,
-    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x45, 0x19,
-    0x23, 0x22, 0x19, 0x5e, 0x47, 0x47, 0x2a, 0x1d, 0x69, 0x22, 0x1b, 0x1d,
-    0x22, 0x22, 0x1d, 0x1b, 0x22, 0x7c, 0x0a, 0x21, 0x2e, 0x02, 0x46, 0xfd,
-    0xaf, 0x4e, 0x44, 0x09, 0x03, 0xb3, 0x22, 0x22, 0x1b, 0x1c, 0x21, 0x21,
-    0x1c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x01, 0xfa,
-    0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x13, 0x33, 0x11, 0x37, 0x33, 0x07,
-    0x01, 0x23, 0x03, 0x11, 0x23, 0x34, 0x5f, 0xd4, 0x7a, 0xea, 0x01, 0x03,
-    0x7b, 0xec, 0x5f, 0x03, 0x00, 0xfe, 0x34, 0xdb, 0xed, 0xfe, 0xde, 0x01,
-    0x0b, 0xfe, 0xf5, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x00, 0x93,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x33, 0x23, 0x11, 0x33, 0x93, 0x5f,
-    0x5f, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x03, 0x23,
-    0x02, 0x1e, 0x00, 0x26, 0x00, 0x00, 0x13, 0x33, 0x15, 0x3e, 0x01, 0x33,
-    0x32, 0x16, 0x17, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x11,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x1d, 0x01, 0x23, 0x11, 0x34,
-    0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x1d, 0x01, 0x23, 0x34, 0x5a, 0x1a,
-    0x57, 0x32, 0x3b, 0x50, 0x11, 0x1a, 0x5b, 0x35, 0x52, 0x5a, 0x5e, 0x30,
-    0x32, 0x24, 0x3e, 0x13, 0x13, 0x5e, 0x31, 0x31, 0x25, 0x3f, 0x11, 0x13,
-    0x5f, 0x02, 0x0f, 0x54, 0x2d, 0x36, 0x36, 0x33, 0x2e, 0x3b, 0x67, 0x5e,
-    0xfe, 0xa7, 0x01, 0x49, 0x42, 0x3e, 0x2f, 0x28, 0x2c, 0x5b, 0xeb, 0x01,
-    0x49, 0x42, 0x3e, 0x2f, 0x28, 0x30, 0x58, 0xea, 0x00, 0x01, 0x00, 0x34,
-    0x00, 0x00, 0x02, 0x03, 0x02, 0x1f, 0x00, 0x16, 0x00, 0x00, 0x13, 0x33,
-    0x15, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x1d, 0x01, 0x23, 0x34, 0x5a, 0x1e,
-    0x62, 0x3d, 0x5c, 0x5c, 0x5e, 0x34, 0x3c, 0x26, 0x47, 0x17, 0x0f, 0x0f,
-    0x5f, 0x02, 0x0f, 0x5e, 0x32, 0x3c, 0x70, 0x62, 0xfe, 0xb3, 0x01, 0x39,
-    0x4a, 0x48, 0x2b, 0x25, 0x1b, 0x49, 0x3c, 0xdb, 0x00, 0x02, 0x00, 0x19,
-    0xff, 0xf1, 0x02, 0x15, 0x02, 0x20, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x00,
-    0x16, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15,
-    0x14, 0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
-    0x23, 0x22, 0x06, 0x15, 0xcc, 0x72, 0x41, 0x41, 0x72, 0x4b, 0x4a, 0x73,
-    0x41, 0x41, 0x73, 0x4a, 0xa0, 0x55, 0x4b, 0x4b, 0x55, 0x55, 0x4b, 0x4b,
-    0x55, 0x0f, 0x45, 0x7f, 0x54, 0x54, 0x7e, 0x45, 0x45, 0x7e, 0x54, 0x54,
-    0x7f, 0x45, 0xbc, 0x68, 0x68, 0x5c, 0x5b, 0x68, 0x68, 0x5b, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x34, 0xff, 0x35, 0x02, 0x27, 0x02, 0x1f, 0x00, 0x12,
-    0x00, 0x1e, 0x00, 0x00, 0x13, 0x33, 0x15, 0x3e, 0x01, 0x33, 0x32, 0x1e,
-    0x01, 0x15, 0x14, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x11, 0x23, 0x12,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x34,
-    0x5a, 0x1f, 0x5f, 0x3c, 0x41, 0x65, 0x39, 0x39, 0x65, 0x42, 0x3a, 0x5c,
-    0x1e, 0x5f, 0x59, 0x59, 0x4b, 0x48, 0x50, 0x50, 0x48, 0x4b, 0x59, 0x02,
-    0x0f, 0x51, 0x2e, 0x33, 0x43, 0x7f, 0x55, 0x55, 0x7f, 0x43, 0x2f, 0x2b,
-    0xfe, 0xea, 0x01, 0x79, 0x6a, 0x67, 0x5d, 0x5d, 0x67, 0x6a, 0x5a, 0x00,
-    0x00, 0x02, 0x00, 0x19, 0xff, 0x35, 0x02, 0x0c, 0x02, 0x1f, 0x00, 0x12,
-    0x00, 0x1e, 0x00, 0x00, 0x25, 0x0e, 0x01, 0x23, 0x22, 0x2e, 0x01, 0x35,
-    0x34, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x35, 0x33, 0x11, 0x23, 0x00,
-    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x01,
-    0xae, 0x1f, 0x5c, 0x3a, 0x41, 0x66, 0x39, 0x39, 0x66, 0x40, 0x3c, 0x60,
-    0x1e, 0x5a, 0x5e, 0xfe, 0xc9, 0x50, 0x48, 0x4c, 0x58, 0x58, 0x4c, 0x48,
-    0x50, 0x4b, 0x2b, 0x2f, 0x43, 0x7f, 0x55, 0x55, 0x7f, 0x43, 0x33, 0x2e,
-    0x51, 0xfd, 0x26, 0x01, 0x76, 0x67, 0x6a, 0x5a, 0x5a, 0x6a, 0x67, 0x5d,
-    0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x01, 0x6f, 0x02, 0x17, 0x00, 0x11,
-    0x00, 0x00, 0x13, 0x33, 0x15, 0x3e, 0x01, 0x33, 0x32, 0x17, 0x15, 0x26,
-    0x23, 0x22, 0x06, 0x07, 0x06, 0x1d, 0x01, 0x23, 0x34, 0x5a, 0x17, 0x5c,
-    0x3c, 0x20, 0x12, 0x15, 0x20, 0x35, 0x4e, 0x13, 0x11, 0x5f, 0x02, 0x0f,
-    0x6b, 0x30, 0x43, 0x05, 0x5a, 0x05, 0x33, 0x2e, 0x2b, 0x5a, 0xd7, 0x00,
-    0x00, 0x01, 0x00, 0x0d, 0xff, 0xf0, 0x01, 0xd2, 0x02, 0x20, 0x00, 0x28,
-    0x00, 0x00, 0x16, 0x26, 0x27, 0x37, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32,
-    0x16, 0x17, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x1f,
-    0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x23, 0x9a, 0x7c, 0x11, 0x5d, 0x0b,
-    0x49, 0x41, 0x39, 0x3d, 0x30, 0x3b, 0x36, 0x63, 0x55, 0x34, 0x5e, 0x3e,
-    0x56, 0x73, 0x15, 0x58, 0x0f, 0x42, 0x39, 0x38, 0x37, 0x2d, 0x3a, 0x39,
-    0x5e, 0x5b, 0x72, 0x61, 0x10, 0x5a, 0x49, 0x17, 0x2e, 0x3c, 0x2f, 0x24,
-    0x24, 0x20, 0x08, 0x08, 0x0e, 0x4c, 0x3e, 0x2d, 0x49, 0x2b, 0x4f, 0x43,
-    0x15, 0x27, 0x30, 0x2c, 0x1f, 0x1f, 0x22, 0x09, 0x08, 0x0f, 0x4b, 0x42,
-    0x4b, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0xff, 0xf1, 0x01, 0x4e,
-    0x02, 0xd0, 0x00, 0x15, 0x00, 0x00, 0x16, 0x26, 0x35, 0x11, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x14, 0x16, 0x33, 0x32,
-    0x37, 0x15, 0x06, 0x23, 0xa6, 0x46, 0x58, 0x58, 0x5e, 0x86, 0x86, 0x22,
-    0x25, 0x29, 0x20, 0x26, 0x36, 0x0f, 0x4a, 0x45, 0x01, 0x40, 0x4f, 0xc1,
-    0xc1, 0x4f, 0xfe, 0xce, 0x2a, 0x23, 0x10, 0x51, 0x0f, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x32, 0xff, 0xf1, 0x01, 0xfa, 0x02, 0x0f, 0x00, 0x16,
-    0x00, 0x00, 0x16, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x33, 0x32,
-    0x36, 0x37, 0x3e, 0x01, 0x3d, 0x01, 0x33, 0x11, 0x23, 0x35, 0x0e, 0x01,
-    0x23, 0x8c, 0x5a, 0x5e, 0x34, 0x3a, 0x26, 0x45, 0x15, 0x0f, 0x0f, 0x5e,
-    0x5a, 0x1e, 0x61, 0x3a, 0x0f, 0x6e, 0x62, 0x01, 0x4e, 0xfe, 0xc1, 0x46,
-    0x45, 0x2b, 0x25, 0x1b, 0x47, 0x3c, 0xdc, 0xfd, 0xf1, 0x5d, 0x30, 0x3c,
-    0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x01, 0xf4, 0x02, 0x0f, 0x00, 0x06,
-    0x00, 0x00, 0x13, 0x33, 0x1b, 0x01, 0x33, 0x03, 0x23, 0x0b, 0x66, 0x8e,
-    0x90, 0x65, 0xb4, 0x87, 0x02, 0x0f, 0xfe, 0x40, 0x01, 0xc0, 0xfd, 0xf1,
-    0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x03, 0x06, 0x02, 0x0f, 0x00, 0x0c,
-    0x00, 0x00, 0x13, 0x33, 0x1b, 0x01, 0x33, 0x1b, 0x01, 0x33, 0x03, 0x23,
-    0x0b, 0x01, 0x23, 0x15, 0x64, 0x65, 0x74, 0x76, 0x72, 0x69, 0x63, 0x87,
-    0x84, 0x6f, 0x73, 0x83, 0x02, 0x0f, 0xfe, 0x42, 0x01, 0xbe, 0xfe, 0x42,
-    0x01, 0xbe, 0xfd, 0xf1, 0x01, 0xb5, 0xfe, 0x4b, 0x00, 0x01, 0xff, 0xf8,
-    0x00, 0x00, 0x01, 0xe4, 0x02, 0x0f, 0x00, 0x0b, 0x00, 0x00, 0x13, 0x03,
-    0x33, 0x17, 0x37, 0x33, 0x03, 0x13, 0x23, 0x27, 0x07, 0x23, 0xb3, 0xb4,
-    0x6b, 0x85, 0x84, 0x6b, 0xb5, 0xbb, 0x6b, 0x8a, 0x8b, 0x6c, 0x01, 0x0c,
-    0x01, 0x03, 0xc0, 0xc0, 0xfe, 0xfd, 0xfe, 0xf4, 0xcc, 0xcc, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x0b, 0xff, 0x2c, 0x01, 0xf5, 0x02, 0x0f, 0x00, 0x10,
-    0x00, 0x00, 0x16, 0x27, 0x35, 0x16, 0x33, 0x32, 0x36, 0x37, 0x03, 0x33,
-    0x1b, 0x01, 0x33, 0x03, 0x0e, 0x01, 0x23, 0x4f, 0x22, 0x1b, 0x29, 0x26,
+    0xfe, 0xba, 0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x02, 0x6a, 0x3a, 0x03,
+    0x60, 0x37, 0x01, 0x21, 0x35, 0x21, 0x15, 0xd8, 0x04, 0xf0, 0x06, 0x25,
+    0x01, 0xc8, 0xfe, 0x41, 0x02, 0x3c, 0xfe, 0x36, 0x01, 0xc8, 0xfd, 0xbd,
+    0x57, 0x02, 0x50, 0x59, 0x56, 0xfd, 0xb0, 0x5a, 0x3a, 0x03, 0xb1, 0x1c,
+    0xff, 0xf2, 0x01, 0xe9, 0x02, 0x20, 0x00, 0x21, 0x00, 0x2f, 0x30, 0x01,
+    0x53, 0x34, 0x36, 0x37, 0x37, 0x36, 0x8c, 0x02, 0x22, 0x07, 0x27, 0xd3,
+    0x01, 0x70, 0x16, 0x15, 0x15, 0x14, 0x17, 0x23, 0x26, 0xd7, 0x04, 0x11,
+    0x26, 0x4c, 0x01, 0xf0, 0x55, 0x35, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06,
+    0x15, 0x7f, 0x63, 0x65, 0x5d, 0x2b, 0x40, 0x3a, 0x44, 0x35, 0x41, 0x42,
+    0x0e, 0x58, 0x0f, 0x78, 0x60, 0x36, 0x56, 0x1c, 0x30, 0x09, 0x59, 0x07,
+    0x03, 0x1c, 0x5e, 0x3a, 0x58, 0x39, 0x2f, 0x49, 0x58, 0x0d, 0x31, 0x33,
+    0x27, 0x3a, 0x37, 0x0e, 0x4f, 0x45, 0x46, 0x4e, 0x11, 0x08, 0x0a, 0x1d,
+    0x21, 0x27, 0x2e, 0x3d, 0x2f, 0x15, 0x45, 0x62, 0x1e, 0x1b, 0x2e, 0x55,
+    0xd7, 0x6d, 0x20, 0x27, 0x1f, 0x26, 0x2e, 0x75, 0x26, 0x51, 0x4f, 0x36,
+    0x0f, 0x16, 0x0a, 0x07, 0x0d, 0x25, 0x25, 0x00, 0x02, 0x00, 0x34, 0xff,
+    0xf1, 0x02, 0x27, 0x03, 0x00, 0x00, 0x12, 0x00, 0x1e, 0x2e, 0x03, 0x20,
+    0x27, 0x15, 0xfd, 0x04, 0x07, 0xcb, 0x03, 0x18, 0x26, 0xcb, 0x03, 0xf0,
+    0x20, 0x0c, 0x5f, 0x1f, 0x5a, 0x5f, 0x1e, 0x5c, 0x3a, 0x42, 0x65, 0x39,
+    0x39, 0x65, 0x41, 0xbb, 0x59, 0x4b, 0x48, 0x50, 0x50, 0x48, 0x4b, 0x59,
+    0x0f, 0x32, 0x2e, 0x51, 0x03, 0x00, 0xfe, 0xc5, 0x2b, 0x2f, 0x43, 0x7f,
+    0x55, 0x55, 0x7f, 0x43, 0xbd, 0x6a, 0x67, 0x5d, 0x5d, 0x67, 0x6a, 0x5a,
+    0xba, 0x01, 0x70, 0x19, 0xff, 0xf1, 0x01, 0xfd, 0x02, 0x20, 0x26, 0x04,
+    0x1f, 0x16, 0xc0, 0x06, 0x08, 0xf0, 0x21, 0xca, 0x71, 0x40, 0x40, 0x71,
+    0x4a, 0x55, 0x79, 0x18, 0x59, 0x10, 0x48, 0x35, 0x4a, 0x53, 0x53, 0x4a,
+    0x37, 0x4b, 0x0e, 0x59, 0x16, 0x7c, 0x57, 0x0f, 0x45, 0x7f, 0x54, 0x54,
+    0x7e, 0x45, 0x59, 0x4e, 0x15, 0x32, 0x37, 0x68, 0x5c, 0x5c, 0x69, 0x3d,
+    0x38, 0x17, 0x53, 0x5e, 0x00, 0x00, 0x02, 0x58, 0x00, 0x24, 0x02, 0x0c,
+    0xb8, 0x00, 0x07, 0x5a, 0x00, 0x00, 0xb8, 0x04, 0x1b, 0x35, 0xb8, 0x00,
+    0xf2, 0x09, 0xb8, 0x66, 0x39, 0x39, 0x66, 0x41, 0x3a, 0x5c, 0x1f, 0x5e,
+    0x5a, 0x1e, 0x60, 0x3c, 0x81, 0x50, 0x48, 0x4c, 0x58, 0x58, 0x4c, 0x48,
+    0x50, 0x0f, 0xae, 0x00, 0xf3, 0x02, 0x2f, 0x2b, 0x01, 0x3b, 0xfd, 0x00,
+    0x51, 0x2e, 0x32, 0xba, 0x67, 0x6a, 0x5a, 0x5a, 0x6a, 0x67, 0x5d, 0x5e,
+    0x00, 0x59, 0x0b, 0x02, 0x20, 0x00, 0x17, 0x5e, 0x00, 0x00, 0x13, 0x01,
+    0x20, 0x07, 0x21, 0x83, 0x03, 0x01, 0xb4, 0x00, 0x21, 0x13, 0x26, 0xb3,
+    0x01, 0xf3, 0x0d, 0xcc, 0x73, 0x40, 0x41, 0x74, 0x49, 0x41, 0x6f, 0x44,
+    0x02, 0xfe, 0x6e, 0x06, 0x54, 0x48, 0x6c, 0x23, 0x5a, 0x1a, 0x7a, 0x55,
+    0x94, 0x09, 0x4c, 0x42, 0x40, 0x4f, 0x0d, 0xbf, 0x00, 0xf0, 0x02, 0x3b,
+    0x76, 0x57, 0x11, 0x14, 0x53, 0x5c, 0x66, 0x18, 0x4d, 0x54, 0x01, 0x4f,
+    0x45, 0x4a, 0x4a, 0x45, 0x1a, 0x01, 0x00, 0x5c, 0x02, 0xf1, 0x03, 0x4c,
+    0x03, 0x0b, 0x00, 0x15, 0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x17, 0x15, 0xb1, 0x00, 0xf0, 0x14, 0x15, 0x33, 0x15,
+    0x23, 0x11, 0x23, 0x60, 0x58, 0x58, 0x4e, 0x4a, 0x30, 0x24, 0x1d, 0x2a,
+    0x23, 0x24, 0x80, 0x80, 0x5e, 0x01, 0xc0, 0x4f, 0x5e, 0x4b, 0x53, 0x0b,
+    0x51, 0x0c, 0x2b, 0x30, 0x51, 0x4f, 0xfe, 0x40, 0x04, 0x01, 0x9a, 0x1a,
+    0xff, 0x25, 0x02, 0x0d, 0x02, 0x1f, 0x00, 0x1e, 0x1e, 0x04, 0x00, 0xff,
+    0x00, 0x16, 0x22, 0x12, 0x01, 0x11, 0x35, 0x87, 0x03, 0x08, 0x93, 0x05,
+    0xf0, 0x0c, 0xb1, 0x78, 0x16, 0x5c, 0x0b, 0x4a, 0x3e, 0x4a, 0x53, 0x1f,
+    0x5c, 0x3a, 0x40, 0x66, 0x3a, 0x39, 0x66, 0x40, 0x3c, 0x5f, 0x1e, 0x5b,
+    0x89, 0x74, 0x98, 0x4f, 0x49, 0x1a, 0x01, 0xf0, 0x14, 0x49, 0x4f, 0xdb,
+    0x4d, 0x3d, 0x22, 0x27, 0x36, 0x4d, 0x55, 0x45, 0x2b, 0x2c, 0x40, 0x7b,
+    0x53, 0x52, 0x7a, 0x41, 0x2f, 0x2d, 0x4c, 0xfe, 0x06, 0x75, 0x7b, 0x01,
+    0x94, 0x62, 0x65, 0x56, 0x55, 0x65, 0x62, 0x58, 0xc0, 0x00, 0x91, 0x34,
+    0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x16, 0xb8, 0x06, 0x01, 0x6c,
+    0x00, 0x41, 0x15, 0x11, 0x23, 0x11, 0xc8, 0x02, 0x00, 0xab, 0x02, 0xf0,
+    0x17, 0x15, 0x23, 0x34, 0x5f, 0x1e, 0x60, 0x3a, 0x5c, 0x5c, 0x5e, 0x34,
+    0x3c, 0x27, 0x48, 0x15, 0x0f, 0x0f, 0x5f, 0x03, 0x00, 0xfe, 0xb8, 0x2e,
+    0x39, 0x70, 0x62, 0xfe, 0xb3, 0x01, 0x39, 0x4a, 0x48, 0x2b, 0x25, 0x1b,
+    0x49, 0x3b, 0xdc, 0xc8, 0x00, 0x11, 0x26, 0x52, 0x07, 0x30, 0x0a, 0x00,
+    0x03, 0x3c, 0x07, 0x51, 0x33, 0x23, 0x11, 0x33, 0x26, 0x4d, 0x00, 0x10,
+    0x14, 0xc7, 0x00, 0x90, 0x35, 0x93, 0x5f, 0x5f, 0x6d, 0x22, 0x1c, 0x1c,
+    0x22, 0x04, 0x00, 0xb0, 0x02, 0x0f, 0xd9, 0x22, 0x22, 0x1b, 0x1c, 0x21,
+    0x21, 0x1c, 0x00, 0x9e, 0x14, 0xc7, 0x2c, 0x00, 0xa0, 0x03, 0x0a, 0x00,
+    0x0d, 0x00, 0x19, 0x00, 0x00, 0x07, 0x72, 0x04, 0x37, 0x22, 0x27, 0x12,
+    0x40, 0x00, 0xf4, 0x11, 0x45, 0x19, 0x23, 0x22, 0x19, 0x5e, 0x47, 0x47,
+    0x2a, 0x1d, 0x69, 0x22, 0x1b, 0x1d, 0x22, 0x22, 0x1d, 0x1b, 0x22, 0x7c,
+    0x0a, 0x21, 0x2e, 0x02, 0x46, 0xfd, 0xaf, 0x4e, 0x44, 0x09, 0x03, 0xb3,
+    0x51, 0x00, 0x02, 0xd2, 0x00, 0x25, 0x01, 0xfa, 0x8a, 0x07, 0x40, 0x37,
+    0x33, 0x07, 0x01, 0x36, 0x07, 0x90, 0x34, 0x5f, 0xd4, 0x7a, 0xea, 0x01,
+    0x03, 0x7b, 0xec, 0xc0, 0x00, 0x93, 0x34, 0xdb, 0xed, 0xfe, 0xde, 0x01,
+    0x0b, 0xfe, 0xf5, 0x30, 0x00, 0x22, 0x00, 0x93, 0x0a, 0x08, 0x00, 0xb6,
+    0x00, 0x53, 0x93, 0x5f, 0x5f, 0x03, 0x00, 0x18, 0x00, 0x60, 0x03, 0x23,
+    0x02, 0x1e, 0x00, 0x26, 0x48, 0x00, 0x12, 0x15, 0x86, 0x01, 0x0c, 0x20,
+    0x01, 0x28, 0x15, 0x15, 0x0b, 0x00, 0xf2, 0x23, 0x34, 0x5a, 0x1a, 0x57,
+    0x32, 0x3b, 0x50, 0x11, 0x1a, 0x5b, 0x35, 0x52, 0x5a, 0x5e, 0x30, 0x32,
+    0x24, 0x3e, 0x13, 0x13, 0x5e, 0x31, 0x31, 0x25, 0x3f, 0x11, 0x13, 0x5f,
+    0x02, 0x0f, 0x54, 0x2d, 0x36, 0x36, 0x33, 0x2e, 0x3b, 0x67, 0x5e, 0xfe,
+    0xa7, 0x01, 0x49, 0x42, 0x3e, 0x2f, 0x28, 0x2c, 0x5b, 0xeb, 0x09, 0x00,
+    0x34, 0x30, 0x58, 0xea, 0x8a, 0x01, 0x46, 0x02, 0x1f, 0x00, 0x16, 0x70,
+    0x00, 0x0c, 0x8a, 0x01, 0x41, 0x5a, 0x1e, 0x62, 0x3d, 0x8a, 0x01, 0xb8,
+    0x26, 0x47, 0x17, 0x0f, 0x0f, 0x5f, 0x02, 0x0f, 0x5e, 0x32, 0x3c, 0x89,
+    0x01, 0x23, 0x3c, 0xdb, 0xf6, 0x02, 0x5a, 0x15, 0x02, 0x20, 0x00, 0x0f,
+    0xae, 0x03, 0x0e, 0x09, 0x04, 0xf0, 0x02, 0xcc, 0x72, 0x41, 0x41, 0x72,
+    0x4b, 0x4a, 0x73, 0x41, 0x41, 0x73, 0x4a, 0xa0, 0x55, 0x4b, 0x4b, 0x55,
+    0x04, 0x00, 0x03, 0xec, 0x02, 0xe1, 0x45, 0x7e, 0x54, 0x54, 0x7f, 0x45,
+    0xbc, 0x68, 0x68, 0x5c, 0x5b, 0x68, 0x68, 0x5b, 0x62, 0x04, 0x52, 0x35,
+    0x02, 0x27, 0x02, 0x1f, 0xaa, 0x03, 0x04, 0xa0, 0x00, 0x02, 0x54, 0x00,
+    0x67, 0x22, 0x26, 0x27, 0x11, 0x23, 0x12, 0x59, 0x00, 0x60, 0x34, 0x5a,
+    0x1f, 0x5f, 0x3c, 0x41, 0x5e, 0x04, 0x64, 0x42, 0x3a, 0x5c, 0x1e, 0x5f,
+    0x59, 0x62, 0x04, 0x54, 0x02, 0x0f, 0x51, 0x2e, 0x33, 0xaf, 0x03, 0x45,
+    0xfe, 0xea, 0x01, 0x79, 0x62, 0x04, 0x00, 0xb6, 0x00, 0x34, 0x35, 0x02,
+    0x0c, 0x60, 0x00, 0x1d, 0x25, 0xfc, 0x02, 0x28, 0x23, 0x00, 0xc2, 0x04,
+    0x70, 0xae, 0x1f, 0x5c, 0x3a, 0x41, 0x66, 0x39, 0xf3, 0x02, 0x64, 0x60,
+    0x1e, 0x5a, 0x5e, 0xfe, 0xc9, 0x0d, 0x04, 0x14, 0x4b, 0xbd, 0x04, 0x74,
+    0x33, 0x2e, 0x51, 0xfd, 0x26, 0x01, 0x76, 0x0c, 0x04, 0x02, 0x16, 0x02,
+    0x55, 0x6f, 0x02, 0x17, 0x00, 0x11, 0xbe, 0x00, 0x27, 0x17, 0x15, 0xb9,
+    0x01, 0xf0, 0x0b, 0x17, 0x5c, 0x3c, 0x20, 0x12, 0x15, 0x20, 0x35, 0x4e,
+    0x13, 0x11, 0x5f, 0x02, 0x0f, 0x6b, 0x30, 0x43, 0x05, 0x5a, 0x05, 0x33,
+    0x2e, 0x2b, 0x5a, 0xd7, 0x00, 0x3e, 0x07, 0x8f, 0xff, 0xf0, 0x01, 0xd2,
+    0x02, 0x20, 0x00, 0x28, 0xbe, 0x07, 0x10, 0x03, 0xbd, 0x07, 0xf0, 0x35,
+    0x23, 0x9a, 0x7c, 0x11, 0x5d, 0x0b, 0x49, 0x41, 0x39, 0x3d, 0x30, 0x3b,
+    0x36, 0x63, 0x55, 0x34, 0x5e, 0x3e, 0x56, 0x73, 0x15, 0x58, 0x0f, 0x42,
+    0x39, 0x38, 0x37, 0x2d, 0x3a, 0x39, 0x5e, 0x5b, 0x72, 0x61, 0x10, 0x5a,
+    0x49, 0x17, 0x2e, 0x3c, 0x2f, 0x24, 0x24, 0x20, 0x08, 0x08, 0x0e, 0x4c,
+    0x3e, 0x2d, 0x49, 0x2b, 0x4f, 0x43, 0x15, 0x27, 0x30, 0x2c, 0x1f, 0x1f,
+    0x22, 0x09, 0x08, 0x0f, 0x4b, 0x42, 0x4b, 0x5c, 0x5e, 0x04, 0x82, 0xff,
+    0xf1, 0x01, 0x4e, 0x02, 0xd0, 0x00, 0x15, 0x94, 0x07, 0x00, 0x61, 0x04,
+    0x11, 0x33, 0x57, 0x04, 0x10, 0x14, 0xbf, 0x04, 0xf0, 0x11, 0x15, 0x06,
+    0x23, 0xa6, 0x46, 0x58, 0x58, 0x5e, 0x86, 0x86, 0x22, 0x25, 0x29, 0x20,
+    0x26, 0x36, 0x0f, 0x4a, 0x45, 0x01, 0x40, 0x4f, 0xc1, 0xc1, 0x4f, 0xfe,
+    0xce, 0x2a, 0x23, 0x10, 0x51, 0x0f, 0xbc, 0x00, 0x99, 0x32, 0xff, 0xf1,
+    0x01, 0xfa, 0x02, 0x0f, 0x00, 0x16, 0xd6, 0x07, 0x00, 0xab, 0x06, 0x13,
+    0x35, 0x64, 0x05, 0xf1, 0x16, 0x8c, 0x5a, 0x5e, 0x34, 0x3a, 0x26, 0x45,
+    0x15, 0x0f, 0x0f, 0x5e, 0x5a, 0x1e, 0x61, 0x3a, 0x0f, 0x6e, 0x62, 0x01,
+    0x4e, 0xfe, 0xc1, 0x46, 0x45, 0x2b, 0x25, 0x1b, 0x47, 0x3c, 0xdc, 0xfd,
+    0xf1, 0x5d, 0x30, 0x3c, 0x00, 0x01, 0x7c, 0x07, 0x35, 0xf4, 0x02, 0x0f,
+    0xe2, 0x07, 0xf0, 0x04, 0x03, 0x23, 0x0b, 0x66, 0x8e, 0x90, 0x65, 0xb4,
+    0x87, 0x02, 0x0f, 0xfe, 0x40, 0x01, 0xc0, 0xfd, 0xf1, 0x00, 0x01, 0xa6,
+    0x00, 0x4d, 0x03, 0x06, 0x02, 0x0f, 0xe0, 0x07, 0xf0, 0x04, 0x15, 0x64,
+    0x65, 0x74, 0x76, 0x72, 0x69, 0x63, 0x87, 0x84, 0x6f, 0x73, 0x83, 0x02,
+    0x0f, 0xfe, 0x42, 0x01, 0xbe, 0x04, 0x00, 0xf0, 0x01, 0xfd, 0xf1, 0x01,
+    0xb5, 0xfe, 0x4b, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xe4, 0x02,
+    0x0f, 0x64, 0x00, 0xf0, 0x15, 0x13, 0x03, 0x33, 0x17, 0x37, 0x33, 0x03,
+    0x13, 0x23, 0x27, 0x07, 0x23, 0xb3, 0xb4, 0x6b, 0x85, 0x84, 0x6b, 0xb5,
+    0xbb, 0x6b, 0x8a, 0x8b, 0x6c, 0x01, 0x0c, 0x01, 0x03, 0xc0, 0xc0, 0xfe,
+    0xfd, 0xfe, 0xf4, 0xcc, 0xcc, 0x8e, 0x00, 0xd1, 0xff, 0x2c, 0x01, 0xf5,
+    0x02, 0x0f, 0x00, 0x10, 0x00, 0x00, 0x16, 0x27, 0x35, 0xd2, 0x00, 0x02,
+    0x19, 0x08, 0xf0, 0x17, 0x06, 0x06, 0x23, 0x4f, 0x22, 0x1b, 0x29, 0x26,
     0x28, 0x11, 0xc5, 0x66, 0x90, 0x8f, 0x65, 0xd5, 0x1d, 0x4a, 0x46, 0xd4,
     0x09, 0x52, 0x0c, 0x31, 0x3c, 0x02, 0x27, 0xfe, 0x50, 0x01, 0xb0, 0xfd,
-    0xae, 0x4e, 0x43, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x01, 0xc0,
-    0x02, 0x0f, 0x00, 0x09, 0x00, 0x00, 0x37, 0x01, 0x21, 0x35, 0x21, 0x15,
-    0x01, 0x21, 0x15, 0x21, 0x16, 0x01, 0x2f, 0xfe, 0xd4, 0x01, 0xa0, 0xfe,
-    0xd1, 0x01, 0x36, 0xfe, 0x56, 0x4c, 0x01, 0x74, 0x4f, 0x4a, 0xfe, 0x8c,
-    0x51, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3a, 0xff, 0xd2, 0x03, 0x86,
-    0x03, 0x33, 0x00, 0x34, 0x00, 0x00, 0x01, 0x35, 0x06, 0x07, 0x27, 0x36,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x04, 0x05, 0x27, 0x36,
-    0x37, 0x36, 0x37, 0x36, 0x37, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x01,
-    0xb6, 0xb3, 0x83, 0x11, 0xa3, 0xbb, 0xe4, 0x7d, 0x14, 0x92, 0xa5, 0x01,
-    0x33, 0xfe, 0xcd, 0x01, 0x7b, 0xfe, 0x44, 0x24, 0x2e, 0x47, 0x30, 0x6a,
-    0x90, 0x71, 0x3a, 0x47, 0x28, 0x3f, 0x38, 0x42, 0x55, 0x22, 0x42, 0x17,
-    0x20, 0xfe, 0xeb, 0xfe, 0x9e, 0x10, 0x26, 0x1a, 0x2d, 0x46, 0x22, 0x20,
-    0xfe, 0xde, 0x01, 0x7c, 0xfe, 0xcd, 0x02, 0x3d, 0x77, 0x0d, 0x02, 0x51,
-    0x03, 0x11, 0x12, 0x17, 0x54, 0x15, 0x0f, 0x7e, 0x50, 0x7f, 0x55, 0x2b,
-    0x30, 0x4b, 0x23, 0x01, 0x07, 0x06, 0x05, 0x49, 0x23, 0x39, 0x32, 0x45,
-    0x5a, 0x29, 0x3c, 0x1e, 0x25, 0x15, 0x0b, 0x5d, 0x03, 0x14, 0x1e, 0x4b,
-    0x22, 0x25, 0x55, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1c,
-    0xff, 0xde, 0x03, 0xa1, 0x03, 0x5a, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00,
-    0x01, 0x11, 0x23, 0x11, 0x24, 0x37, 0x36, 0x37, 0x33, 0x16, 0x05, 0x07,
-    0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x27, 0x02, 0x0b, 0x5a,
-    0xfe, 0xf1, 0x72, 0x67, 0x3e, 0x49, 0x99, 0x01, 0x06, 0x3a, 0x80, 0x5b,
-    0x70, 0x3e, 0x41, 0x59, 0x6f, 0x7f, 0x3a, 0x02, 0x20, 0xfd, 0xbe, 0x02,
-    0x42, 0x03, 0x6f, 0x64, 0x64, 0xe7, 0xa1, 0x58, 0x57, 0x56, 0x6b, 0x5b,
-    0x59, 0x56, 0x6d, 0x53, 0x54, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x68,
-    0xff, 0xdd, 0x03, 0x54, 0x03, 0x51, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x11,
-    0x21, 0x11, 0x01, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0x01, 0xb0,
-    0x5b, 0x01, 0x49, 0xfe, 0xb7, 0x5b, 0xfe, 0xb8, 0x01, 0x48, 0xee, 0x02,
-    0x3a, 0xf1, 0x02, 0x9d, 0xb4, 0xb4, 0xfe, 0x5f, 0xfe, 0xe1, 0x01, 0x1f,
-    0x01, 0xa1, 0xfe, 0xb5, 0xf6, 0xf6, 0xf6, 0xf6, 0x00, 0x02, 0x00, 0x2c,
-    0xff, 0xd6, 0x03, 0x90, 0x03, 0x5f, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00,
-    0x01, 0x15, 0x21, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x07,
-    0x26, 0x27, 0x03, 0x33, 0x0e, 0x01, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23,
-    0x22, 0x2f, 0x01, 0x16, 0x3b, 0x01, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x21,
-    0x11, 0x23, 0x11, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x33, 0x35, 0x01,
-    0x37, 0x23, 0x15, 0x01, 0xa3, 0x01, 0x5a, 0x10, 0x49, 0x26, 0x34, 0x2f,
-    0x45, 0x4b, 0x1f, 0x38, 0x22, 0x39, 0x18, 0x88, 0x05, 0x09, 0x08, 0x06,
-    0x1a, 0x32, 0x2e, 0x35, 0x34, 0x20, 0x10, 0x13, 0x36, 0x2d, 0x1f, 0x23,
-    0x1d, 0x0e, 0x04, 0x0a, 0x04, 0xfe, 0x96, 0x56, 0xfe, 0xdf, 0x01, 0x21,
-    0xe1, 0xe1, 0x01, 0x40, 0x11, 0xfb, 0x03, 0x53, 0x95, 0x0c, 0x39, 0x16,
-    0x46, 0x1c, 0x34, 0x39, 0x1f, 0x48, 0x22, 0x2d, 0xfe, 0xf2, 0x68, 0x70,
-    0x38, 0x2a, 0x2c, 0x15, 0x05, 0x05, 0x01, 0x59, 0x03, 0x02, 0x09, 0x18,
-    0x1c, 0x48, 0x4e, 0xfe, 0x7f, 0x01, 0x81, 0x59, 0xb9, 0x55, 0x95, 0xfe,
-    0x5d, 0xb9, 0xb9, 0x00, 0x00, 0x01, 0x00, 0x35, 0xff, 0xe9, 0x03, 0x86,
-    0x03, 0x19, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x16, 0x0e, 0x01, 0x07, 0x06, 0x2b, 0x01, 0x27, 0x16, 0x37,
-    0x3e, 0x02, 0x35, 0x11, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x03, 0x41,
-    0xfe, 0xd8, 0x01, 0x6d, 0xfe, 0x93, 0x01, 0x13, 0x32, 0x31, 0x29, 0x3f,
-    0x1f, 0x12, 0x39, 0x42, 0x1a, 0x15, 0x08, 0xfe, 0x78, 0x01, 0x88, 0xfe,
-    0xbe, 0x03, 0x19, 0x53, 0xd9, 0x56, 0xfe, 0xd1, 0x2e, 0x31, 0x18, 0x04,
-    0x04, 0x5f, 0x05, 0x02, 0x01, 0x07, 0x15, 0x19, 0x01, 0x1c, 0x56, 0xd9,
-    0x53, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1e, 0xff, 0xcc, 0x03, 0x9c,
-    0x03, 0x59, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x04, 0x37, 0x36, 0x37,
-    0x33, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x17, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x36, 0x37, 0x21, 0x01, 0xd1,
-    0x2f, 0x27, 0x16, 0x47, 0x14, 0x29, 0x1f, 0x23, 0x44, 0xfe, 0xde, 0x6d,
-    0x68, 0x4b, 0x4c, 0x44, 0x6e, 0x64, 0x81, 0x2f, 0x7a, 0x6f, 0x64, 0x41,
-    0x38, 0x67, 0x6c, 0x83, 0x33, 0x68, 0x02, 0x92, 0x6f, 0x70, 0x51, 0x2a,
-    0x33, 0x61, 0x86, 0x67, 0x66, 0x2a, 0x4f, 0x80, 0x22, 0x64, 0x58, 0xfd,
-    0xe2, 0x02, 0x68, 0x39, 0x2d, 0x23, 0x38, 0x21, 0x30, 0x26, 0x26, 0x39,
-    0x49, 0x5e, 0x59, 0x6e, 0x73, 0x5c, 0x53, 0x3f, 0x56, 0x3f, 0x5f, 0x55,
-    0x61, 0x52, 0x59, 0x5e, 0x48, 0x51, 0x58, 0x60, 0x7d, 0x5c, 0x2d, 0x1b,
-    0x51, 0x41, 0x44, 0x35, 0x2a, 0x51, 0x1e, 0x40, 0x12, 0x52, 0x61, 0x00,
-    0x00, 0x02, 0x00, 0x15, 0xff, 0xd9, 0x03, 0x91, 0x03, 0x52, 0x00, 0x1a,
-    0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x23, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33,
-    0x15, 0x23, 0x11, 0x23, 0x11, 0x21, 0x35, 0x26, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x02, 0x46, 0x8c, 0x1f,
-    0x1d, 0x56, 0x48, 0x2e, 0x58, 0x0c, 0x16, 0x72, 0x57, 0xd2, 0xd2, 0xf4,
-    0xf4, 0x57, 0xfe, 0xe2, 0xd5, 0x37, 0x3c, 0x1d, 0x5a, 0x19, 0x2a, 0x58,
-    0x1f, 0x22, 0x4c, 0x01, 0x5f, 0xdc, 0x60, 0x41, 0x1f, 0x99, 0xd1, 0x11,
-    0x32, 0x52, 0xc4, 0xc4, 0x53, 0xdc, 0x55, 0xfe, 0xcf, 0x01, 0x31, 0x55,
-    0x7f, 0x7b, 0x88, 0x71, 0x13, 0x55, 0x6b, 0xfd, 0x5d, 0x01, 0xe2, 0x3a,
-    0x37, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19, 0xff, 0xcb, 0x03, 0x8f,
-    0x03, 0x58, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x00, 0x01, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x21, 0x15, 0x21, 0x0f, 0x01, 0x21, 0x15, 0x21, 0x06, 0x07,
-    0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37,
-    0x16, 0x1f, 0x01, 0x36, 0x37, 0x05, 0x35, 0x36, 0x37, 0x23, 0x35, 0x33,
-    0x3f, 0x01, 0x23, 0x35, 0x06, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11, 0x23,
-    0x11, 0x06, 0x07, 0x27, 0x01, 0xf6, 0x0f, 0x09, 0x56, 0x09, 0x0c, 0x01,
-    0x1d, 0xfe, 0xd2, 0x0c, 0x0c, 0x01, 0x69, 0xfe, 0x81, 0x14, 0x09, 0x01,
-    0x54, 0x48, 0x3d, 0x53, 0x2c, 0x26, 0x43, 0x91, 0xa2, 0x3d, 0x22, 0x59,
-    0x86, 0x0d, 0x3e, 0x2d, 0xfe, 0xb4, 0x12, 0x0e, 0x92, 0xa9, 0x0e, 0x0b,
-    0x8e, 0xff, 0x75, 0x28, 0x55, 0x2c, 0x25, 0x53, 0x1f, 0x2b, 0x43, 0x02,
-    0xd3, 0x48, 0x3d, 0x0a, 0x3a, 0x41, 0x50, 0x31, 0x34, 0x51, 0x43, 0x19,
-    0x4f, 0x76, 0x4e, 0x2a, 0x1b, 0x4e, 0x30, 0x49, 0x49, 0x15, 0x46, 0x1d,
-    0x41, 0x06, 0x4e, 0x4e, 0x01, 0x4c, 0x2f, 0x33, 0x51, 0x39, 0x2c, 0x50,
-    0xe2, 0xec, 0x76, 0x15, 0x7c, 0x50, 0xfd, 0x66, 0x01, 0xf7, 0x37, 0x3f,
-    0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0xff, 0xe3, 0x03, 0x8b,
-    0x03, 0x59, 0x00, 0x09, 0x00, 0x16, 0x00, 0x21, 0x00, 0x2f, 0x00, 0x00,
-    0x00, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x04, 0x37,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x01,
-    0x21, 0x36, 0x13, 0x17, 0x0e, 0x01, 0x07, 0x33, 0x15, 0x21, 0x13, 0x33,
-    0x26, 0x27, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x07, 0x33, 0x15, 0x21,
-    0x01, 0xdd, 0x20, 0x23, 0x0f, 0x53, 0x14, 0x1d, 0x1c, 0x20, 0x51, 0xfe,
-    0x99, 0x38, 0x33, 0x24, 0x59, 0x23, 0x29, 0x56, 0x22, 0x22, 0x49, 0x01,
-    0x0b, 0x01, 0x35, 0x4f, 0x3f, 0x59, 0x2b, 0x40, 0x24, 0xe1, 0xfd, 0x92,
-    0x1b, 0xf7, 0x05, 0x0e, 0x0f, 0x0c, 0x59, 0x11, 0x0e, 0x14, 0x0a, 0xf6,
-    0xfd, 0xbf, 0x01, 0xea, 0x73, 0x7e, 0x49, 0x18, 0x5e, 0x6b, 0x67, 0x5b,
-    0x17, 0x3c, 0x79, 0x6e, 0x72, 0x14, 0x6c, 0x62, 0xfd, 0x6e, 0x01, 0xe2,
-    0x3d, 0x30, 0x3b, 0xfe, 0xc4, 0xde, 0x01, 0x0c, 0x17, 0x9d, 0xd5, 0x61,
-    0x52, 0x02, 0xb4, 0x15, 0x2c, 0x30, 0x1b, 0x14, 0x28, 0x2e, 0x48, 0x02,
-    0x52, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0xff, 0xd0, 0x03, 0x98,
-    0x03, 0x58, 0x00, 0x0c, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x49, 0x00, 0x00,
-    0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11, 0x23, 0x11, 0x06, 0x07,
-    0x27, 0x00, 0x36, 0x35, 0x11, 0x3e, 0x01, 0x37, 0x17, 0x06, 0x07, 0x16,
-    0x17, 0x33, 0x15, 0x23, 0x14, 0x17, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32,
-    0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x26,
-    0x27, 0x23, 0x11, 0x36, 0x37, 0x17, 0x06, 0x07, 0x27, 0x01, 0x26, 0x27,
-    0x06, 0x07, 0x15, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x2f, 0x01,
-    0x26, 0x27, 0x60, 0x32, 0x33, 0x27, 0x53, 0x24, 0x29, 0x54, 0x1d, 0x29,
-    0x45, 0x01, 0x44, 0x0e, 0x80, 0xfe, 0x6a, 0x15, 0x4c, 0x64, 0x03, 0x07,
-    0xc7, 0xbf, 0x02, 0x14, 0x24, 0x09, 0x17, 0x08, 0x08, 0x0c, 0x07, 0x0c,
-    0x06, 0x45, 0x0d, 0x14, 0x1f, 0x30, 0x48, 0x32, 0x2a, 0x13, 0xb7, 0x52,
-    0x4b, 0x1d, 0x6c, 0x98, 0x29, 0x01, 0x23, 0x07, 0x03, 0x67, 0x3f, 0x74,
-    0x15, 0x1e, 0x1f, 0x11, 0x3d, 0x12, 0x12, 0x0e, 0x1c, 0x13, 0x02, 0x03,
-    0x6e, 0x6b, 0x7c, 0x17, 0x73, 0x5e, 0xfd, 0x68, 0x01, 0xf2, 0x35, 0x3d,
-    0x37, 0xfe, 0xce, 0x18, 0x14, 0x02, 0x71, 0x08, 0x23, 0x17, 0x55, 0x11,
-    0x10, 0x7a, 0x58, 0x53, 0x07, 0x10, 0xa4, 0x61, 0x19, 0x1e, 0x17, 0x1a,
-    0x26, 0x26, 0x21, 0x43, 0x2d, 0x53, 0x01, 0x8c, 0x78, 0xb7, 0xfe, 0xf5,
-    0x34, 0x41, 0x50, 0x56, 0x54, 0x41, 0x01, 0xa2, 0x52, 0x74, 0x0d, 0x04,
-    0xb5, 0xfe, 0x82, 0x15, 0x23, 0x23, 0x1c, 0x2f, 0x1c, 0x16, 0x13, 0x24,
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x11, 0xff, 0xdf, 0x03, 0x88,
-    0x03, 0x60, 0x00, 0x1d, 0x00, 0x2a, 0x00, 0x00, 0x25, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x21, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15,
-    0x21, 0x35, 0x02, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11, 0x23, 0x11,
-    0x06, 0x07, 0x27, 0x02, 0x23, 0xd9, 0xd9, 0xf0, 0x01, 0x12, 0x1e, 0x0c,
-    0x19, 0x4d, 0x12, 0x16, 0x1a, 0x0a, 0x37, 0x01, 0x0e, 0xf8, 0xd8, 0xd8,
-    0x01, 0x0e, 0xfd, 0x95, 0xc4, 0x2f, 0x3b, 0x26, 0x58, 0x2b, 0x26, 0x54,
-    0x1e, 0x24, 0x49, 0x54, 0xf1, 0x55, 0xc8, 0x53, 0x41, 0x1b, 0x30, 0x1f,
-    0x1e, 0x2c, 0x33, 0x1c, 0x12, 0x53, 0xc8, 0x55, 0xf1, 0x53, 0x53, 0x01,
-    0xa0, 0x65, 0x7c, 0x78, 0x16, 0x7d, 0x57, 0xfd, 0x7c, 0x01, 0xda, 0x36,
-    0x37, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1b, 0xff, 0xda, 0x03, 0x8b,
-    0x03, 0x52, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x21, 0x00, 0x25,
-    0x00, 0x29, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x24, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x01, 0x21, 0x27,
-    0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x21, 0x15, 0x21, 0x17, 0x21,
-    0x15, 0x21, 0x35, 0x21, 0x15, 0x21, 0x01, 0x35, 0x21, 0x15, 0x03, 0x4a,
-    0xfe, 0x0b, 0xfe, 0xff, 0x39, 0x34, 0x1e, 0x54, 0x23, 0x23, 0x54, 0x14,
-    0x24, 0x46, 0x01, 0x0c, 0x01, 0x0a, 0x09, 0x0c, 0x0c, 0x52, 0x0f, 0x0f,
-    0x08, 0x03, 0x01, 0x00, 0xfd, 0x9c, 0x35, 0x01, 0xe6, 0xfe, 0x1a, 0x01,
-    0xe6, 0xfe, 0x1a, 0x01, 0x99, 0xfe, 0xb4, 0x01, 0x2c, 0xfe, 0xc9, 0x01,
-    0x37, 0xc7, 0x79, 0x71, 0x74, 0x13, 0x77, 0x55, 0xfd, 0x68, 0x01, 0xea,
-    0x25, 0x3c, 0x37, 0x01, 0x4a, 0x18, 0x29, 0x1c, 0x11, 0x1f, 0x2e, 0x16,
-    0x0b, 0x4e, 0xd9, 0x49, 0xda, 0x49, 0xfe, 0x3f, 0x99, 0x99, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x1e, 0xff, 0xde, 0x03, 0x95, 0x03, 0x5a, 0x00, 0x1f,
-    0x00, 0x00, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x37,
-    0x16, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x07, 0x2e,
-    0x01, 0x27, 0x26, 0x27, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x88, 0x99,
-    0x2e, 0x44, 0x19, 0x13, 0x14, 0x2b, 0x42, 0x38, 0x3e, 0x2f, 0x24, 0x31,
-    0x10, 0x38, 0x46, 0x2f, 0x76, 0x50, 0x40, 0x51, 0x7c, 0x2f, 0x43, 0x33,
-    0x1e, 0x26, 0x31, 0xa3, 0x6a, 0x43, 0x7c, 0xaf, 0x59, 0x7f, 0x7d, 0x1e,
-    0x14, 0x39, 0x28, 0x47, 0x25, 0x38, 0x20, 0x4d, 0x3b, 0xa8, 0x76, 0x4d,
-    0x80, 0x3a, 0x52, 0x40, 0x8c, 0x51, 0x75, 0x8d, 0x58, 0x4b, 0x60, 0xc4,
-    0x55, 0x4a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x37, 0xff, 0xdc, 0x03, 0x86,
-    0x03, 0x50, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x01, 0x26,
-    0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x21, 0x15, 0x21,
-    0x35, 0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01,
-    0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x01, 0xce, 0x07,
-    0x17, 0x17, 0x12, 0x57, 0x19, 0x14, 0x17, 0x0b, 0x28, 0x01, 0x81, 0xfc,
-    0xb1, 0x53, 0x40, 0x42, 0x2c, 0x5a, 0x2a, 0x49, 0x50, 0x43, 0x4f, 0x02,
-    0x40, 0x3e, 0x4e, 0x4f, 0x2a, 0x56, 0x23, 0x54, 0x52, 0x36, 0x02, 0x81,
-    0x1b, 0x37, 0x3d, 0x23, 0x1d, 0x31, 0x32, 0x39, 0x27, 0x0c, 0x58, 0x58,
-    0xfd, 0xee, 0x75, 0x75, 0x76, 0x20, 0x71, 0x85, 0x8c, 0x51, 0x37, 0x01,
-    0xc0, 0x53, 0x86, 0x88, 0x60, 0x32, 0x55, 0x91, 0x93, 0x49, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x2d, 0xff, 0xcf, 0x03, 0x84, 0x03, 0x60, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x17, 0x16, 0x1f, 0x01, 0x07, 0x33, 0x36, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x0f, 0x01, 0x33, 0x15, 0x21, 0x1d, 0x01, 0x21, 0x15,
-    0x21, 0x1e, 0x01, 0x17, 0x07, 0x24, 0x27, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33,
-    0x26, 0x27, 0x26, 0x27, 0x37, 0x01, 0x35, 0x1e, 0x1e, 0x0c, 0x0d, 0x42,
-    0xc3, 0x1d, 0x20, 0x31, 0x20, 0x52, 0x1f, 0x2f, 0x1f, 0xc3, 0xfe, 0xc5,
-    0x01, 0x6b, 0xfe, 0x9d, 0x28, 0xbc, 0x92, 0x29, 0xfe, 0xe5, 0x67, 0x18,
-    0x22, 0x60, 0xe1, 0x31, 0x71, 0x9e, 0x25, 0x29, 0x10, 0xfe, 0xa5, 0x01,
-    0x69, 0xfe, 0xc5, 0xcb, 0x1f, 0x13, 0x1e, 0x1b, 0x49, 0x03, 0x3d, 0x2a,
-    0x2a, 0x14, 0x14, 0x27, 0x22, 0x2a, 0x41, 0x38, 0x30, 0x33, 0x3c, 0x26,
-    0x55, 0x9f, 0x01, 0x5a, 0x68, 0x94, 0x26, 0x59, 0x56, 0xcb, 0x2d, 0x28,
-    0x6f, 0x5e, 0x54, 0x29, 0x63, 0x31, 0x38, 0x33, 0x5a, 0xa0, 0x55, 0x32,
-    0x1a, 0x2c, 0x22, 0x2c, 0x00, 0x01, 0x00, 0x6f, 0xff, 0xf1, 0x03, 0x51,
-    0x03, 0x54, 0x00, 0x17, 0x00, 0x00, 0x13, 0x11, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x15, 0x33, 0x11, 0x33, 0x11, 0x33, 0x35, 0x33, 0x11, 0x21, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x21, 0x11, 0xc6, 0xed, 0xfe, 0xd6, 0x58, 0xd2,
-    0x57, 0xd3, 0x58, 0xfe, 0xd5, 0xee, 0x59, 0xfd, 0x1e, 0x01, 0x63, 0xfe,
-    0xe6, 0x01, 0x60, 0x01, 0x53, 0xfd, 0x01, 0x55, 0xfe, 0xab, 0xfd, 0xfe,
-    0xad, 0xfe, 0xa0, 0x01, 0x1c, 0xfe, 0x8c, 0x01, 0x72, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x1d, 0xff, 0xcb, 0x03, 0x61, 0x03, 0x47, 0x00, 0x03,
-    0x00, 0x28, 0x00, 0x37, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x00, 0x37,
-    0x36, 0x37, 0x23, 0x35, 0x21, 0x15, 0x23, 0x06, 0x07, 0x33, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x23, 0x06, 0x07, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x27, 0x04,
-    0x33, 0x32, 0x3e, 0x01, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x07, 0x06,
-    0x23, 0x27, 0x02, 0xa0, 0x57, 0xfe, 0x1c, 0x34, 0x33, 0x18, 0x96, 0x01,
-    0xd9, 0xe8, 0x13, 0x12, 0xe6, 0x01, 0x2c, 0x5a, 0x56, 0xa9, 0x3f, 0xa3,
-    0x51, 0x50, 0x28, 0xab, 0x13, 0x14, 0x15, 0x17, 0x2f, 0x14, 0x37, 0x18,
-    0x26, 0x0e, 0x15, 0x20, 0x2b, 0x44, 0x02, 0x74, 0x36, 0x1f, 0x1a, 0x0a,
-    0x57, 0x2d, 0x3b, 0x31, 0x54, 0x12, 0x02, 0xed, 0xfd, 0xcb, 0x02, 0x35,
-    0xfe, 0xa2, 0x6e, 0x6b, 0x65, 0x53, 0x53, 0x49, 0x33, 0x4e, 0xc2, 0x82,
-    0x7a, 0x7a, 0x46, 0x6e, 0x70, 0x6f, 0xa3, 0x2d, 0x26, 0x0f, 0x14, 0x26,
-    0x17, 0x43, 0x19, 0x23, 0x0d, 0x11, 0x37, 0x36, 0x37, 0xf2, 0x06, 0x17,
-    0x1b, 0x02, 0xd2, 0xfd, 0x12, 0x3d, 0x31, 0x07, 0x05, 0x61, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x20, 0xff, 0xdb, 0x03, 0x5f, 0x03, 0x44, 0x00, 0x03,
-    0x00, 0x42, 0x00, 0x46, 0x00, 0x4a, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x11,
-    0x23, 0x11, 0x00, 0x37, 0x36, 0x37, 0x23, 0x35, 0x33, 0x35, 0x11, 0x33,
-    0x11, 0x33, 0x35, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x06,
-    0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x23, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x06,
-    0x07, 0x0e, 0x01, 0x07, 0x27, 0x13, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23,
-    0x15, 0x12, 0x33, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x01,
-    0x07, 0x06, 0x2f, 0x01, 0x02, 0xd4, 0x46, 0xfd, 0xc4, 0x0c, 0x0e, 0x01,
-    0x41, 0x42, 0xce, 0x36, 0xd1, 0x35, 0x35, 0x1b, 0x28, 0x19, 0x28, 0x0f,
-    0x14, 0x1b, 0x13, 0x0a, 0x43, 0x02, 0x0e, 0x0b, 0x29, 0x45, 0x2a, 0x0d,
-    0x0a, 0x01, 0x36, 0x1b, 0x28, 0x20, 0x20, 0x0e, 0x17, 0x14, 0x13, 0x0c,
-    0x3e, 0x02, 0x0e, 0x09, 0x1f, 0x1a, 0x45, 0xd5, 0x3e, 0x01, 0x45, 0x43,
-    0xf5, 0x38, 0x15, 0x13, 0x06, 0x4b, 0x0d, 0x25, 0x26, 0x2d, 0x41, 0x0e,
-    0x02, 0xec, 0xfd, 0xd2, 0x02, 0x2e, 0xfd, 0x73, 0x4b, 0x4b, 0x9b, 0x4d,
-    0x03, 0x01, 0x43, 0xfe, 0xba, 0x03, 0x01, 0x43, 0xfe, 0xba, 0x4d, 0xfe,
-    0xc1, 0x30, 0x2a, 0x06, 0x04, 0x54, 0x02, 0x01, 0x0d, 0x1b, 0x01, 0x28,
-    0xaa, 0x53, 0x54, 0x64, 0x1b, 0x60, 0x53, 0x53, 0x94, 0xfe, 0xcd, 0x30,
-    0x2a, 0x08, 0x04, 0x54, 0x03, 0x01, 0x0d, 0x19, 0x01, 0x21, 0xa6, 0x54,
-    0x32, 0x58, 0x30, 0x20, 0x01, 0xe1, 0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0x53,
-    0x01, 0x09, 0x16, 0x1a, 0x02, 0xda, 0xfd, 0x18, 0x2a, 0x2e, 0x19, 0x05,
-    0x07, 0x02, 0x52, 0x00, 0x00, 0x03, 0x00, 0x26, 0xff, 0xde, 0x03, 0x5c,
-    0x03, 0x45, 0x00, 0x34, 0x00, 0x38, 0x00, 0x47, 0x00, 0x00, 0x36, 0x37,
-    0x35, 0x23, 0x35, 0x33, 0x35, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x23, 0x35, 0x21, 0x15, 0x23, 0x06, 0x07, 0x06, 0x07, 0x36,
-    0x3f, 0x01, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x07, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x01, 0x33, 0x11, 0x23, 0x16, 0x33, 0x3e, 0x02, 0x35,
-    0x11, 0x33, 0x11, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x82, 0x80, 0xb9,
-    0xb8, 0x7a, 0x3b, 0x0d, 0x0d, 0x0f, 0x1c, 0x2d, 0x1a, 0x1a, 0x9e, 0x01,
-    0xe4, 0xe6, 0x21, 0x16, 0x30, 0x21, 0x47, 0x50, 0x58, 0x23, 0x1d, 0x3d,
-    0x19, 0x2b, 0x0c, 0x29, 0x17, 0x42, 0x0f, 0x0f, 0x75, 0xb9, 0xb8, 0x6a,
-    0x63, 0x04, 0x6e, 0x91, 0x9c, 0x60, 0x08, 0x02, 0x28, 0x53, 0x53, 0x56,
-    0x2d, 0x19, 0x16, 0x08, 0x54, 0x2d, 0x37, 0x3f, 0x36, 0x11, 0x5b, 0x0b,
-    0x8c, 0x54, 0x80, 0x06, 0x02, 0x4b, 0x01, 0x0f, 0x1d, 0x43, 0x24, 0x2a,
-    0x53, 0x53, 0x34, 0x1f, 0x43, 0x26, 0x03, 0x06, 0x07, 0x36, 0x24, 0x2b,
-    0x1c, 0x41, 0x11, 0x3a, 0x2e, 0x2b, 0x1e, 0x17, 0x09, 0x85, 0x54, 0x83,
-    0x0b, 0x11, 0x56, 0x0f, 0x0e, 0x10, 0x02, 0x53, 0x02, 0x9b, 0xfd, 0xc3,
-    0x80, 0x01, 0x07, 0x16, 0x19, 0x02, 0xd7, 0xfd, 0x0d, 0x38, 0x30, 0x06,
-    0x06, 0x02, 0x5a, 0x00, 0x00, 0x03, 0x00, 0x35, 0xff, 0xcd, 0x03, 0x65,
-    0x03, 0x4a, 0x00, 0x03, 0x00, 0x34, 0x00, 0x43, 0x00, 0x00, 0x01, 0x11,
-    0x23, 0x11, 0x05, 0x33, 0x35, 0x23, 0x06, 0x07, 0x27, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x33, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33,
-    0x3e, 0x01, 0x3d, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
-    0x33, 0x35, 0x23, 0x00, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x11, 0x33, 0x11,
-    0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x02, 0xbd, 0x52, 0xfd, 0xca, 0xe5,
+    0xae, 0x4e, 0x43, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x4a, 0x01, 0xc0, 0x02,
+    0x0f, 0xec, 0x07, 0xf0, 0x06, 0x16, 0x01, 0x2f, 0xfe, 0xd4, 0x01, 0xa0,
+    0xfe, 0xd1, 0x01, 0x36, 0xfe, 0x56, 0x4c, 0x01, 0x74, 0x4f, 0x4a, 0xfe,
+    0x8c, 0x51, 0x2e, 0x00, 0x71, 0x3a, 0xff, 0xd2, 0x03, 0x86, 0x03, 0x33,
+    0x44, 0x02, 0x10, 0x35, 0xde, 0x07, 0x10, 0x37, 0xef, 0x06, 0x32, 0x07,
+    0x15, 0x21, 0x02, 0x00, 0x40, 0x06, 0x07, 0x06, 0x07, 0x13, 0x00, 0x00,
+    0x1b, 0x02, 0x10, 0x17, 0x0b, 0x02, 0x31, 0x27, 0x04, 0x05, 0x24, 0x00,
+    0x00, 0xd7, 0x0c, 0x00, 0x02, 0x00, 0xf2, 0x57, 0x01, 0xb6, 0xb3, 0x83,
+    0x11, 0xa3, 0xbb, 0xe4, 0x7d, 0x14, 0x92, 0xa5, 0x01, 0x33, 0xfe, 0xcd,
+    0x01, 0x7b, 0xfe, 0x44, 0x24, 0x2e, 0x47, 0x30, 0x6a, 0x90, 0x71, 0x3a,
+    0x47, 0x28, 0x3f, 0x38, 0x42, 0x55, 0x22, 0x42, 0x17, 0x20, 0xfe, 0xeb,
+    0xfe, 0x9e, 0x10, 0x26, 0x1a, 0x2d, 0x46, 0x22, 0x20, 0xfe, 0xde, 0x01,
+    0x7c, 0xfe, 0xcd, 0x02, 0x3d, 0x77, 0x0d, 0x02, 0x51, 0x03, 0x11, 0x12,
+    0x17, 0x54, 0x15, 0x0f, 0x7e, 0x50, 0x7f, 0x55, 0x2b, 0x30, 0x4b, 0x23,
+    0x01, 0x07, 0x06, 0x05, 0x49, 0x23, 0x39, 0x32, 0x45, 0x5a, 0x29, 0x3c,
+    0x1e, 0x25, 0x15, 0x0b, 0x5d, 0x03, 0x14, 0x1e, 0x4b, 0x22, 0x25, 0x55,
+    0x7f, 0x50, 0x96, 0x08, 0xf0, 0x0c, 0xde, 0x03, 0xa1, 0x03, 0x5a, 0x00,
+    0x03, 0x00, 0x14, 0x00, 0x00, 0x01, 0x11, 0x23, 0x11, 0x24, 0x37, 0x36,
+    0x37, 0x33, 0x16, 0x05, 0x07, 0x26, 0x27, 0x26, 0x27, 0xa8, 0x00, 0xf0,
+    0x1e, 0x27, 0x02, 0x0b, 0x5a, 0xfe, 0xf1, 0x72, 0x67, 0x3e, 0x49, 0x99,
+    0x01, 0x06, 0x3a, 0x80, 0x5b, 0x70, 0x3e, 0x41, 0x59, 0x6f, 0x7f, 0x3a,
+    0x02, 0x20, 0xfd, 0xbe, 0x02, 0x42, 0x03, 0x6f, 0x64, 0x64, 0xe7, 0xa1,
+    0x58, 0x57, 0x56, 0x6b, 0x5b, 0x59, 0x56, 0x6d, 0x53, 0x54, 0x14, 0x05,
+    0xb1, 0x68, 0xff, 0xdd, 0x03, 0x54, 0x03, 0x51, 0x00, 0x0b, 0x00, 0x0f,
+    0x64, 0x0e, 0x20, 0x35, 0x33, 0x19, 0x0e, 0x10, 0x11, 0x61, 0x0d, 0xf1,
+    0x27, 0x01, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0x01, 0xb0, 0x5b,
+    0x01, 0x49, 0xfe, 0xb7, 0x5b, 0xfe, 0xb8, 0x01, 0x48, 0xee, 0x02, 0x3a,
+    0xf1, 0x02, 0x9d, 0xb4, 0xb4, 0xfe, 0x5f, 0xfe, 0xe1, 0x01, 0x1f, 0x01,
+    0xa1, 0xfe, 0xb5, 0xf6, 0xf6, 0xf6, 0xf6, 0x00, 0x02, 0x00, 0x2c, 0xff,
+    0xd6, 0x03, 0x90, 0x03, 0x5f, 0x00, 0x30, 0x46, 0x01, 0x36, 0x15, 0x21,
+    0x27, 0x2e, 0x01, 0x80, 0x03, 0x33, 0x06, 0x06, 0x07, 0x0e, 0x02, 0x07,
+    0xf4, 0x05, 0x90, 0x27, 0x16, 0x33, 0x33, 0x3e, 0x02, 0x37, 0x36, 0x37,
+    0x63, 0x00, 0x00, 0x3c, 0x01, 0x00, 0xf3, 0x02, 0xf0, 0x55, 0x01, 0x37,
+    0x23, 0x15, 0x01, 0xa3, 0x01, 0x5a, 0x10, 0x49, 0x26, 0x34, 0x2f, 0x45,
+    0x4b, 0x1f, 0x38, 0x22, 0x39, 0x18, 0x88, 0x05, 0x09, 0x08, 0x06, 0x1a,
+    0x32, 0x2e, 0x35, 0x34, 0x20, 0x10, 0x13, 0x36, 0x2d, 0x1f, 0x23, 0x1d,
+    0x0e, 0x04, 0x0a, 0x04, 0xfe, 0x96, 0x56, 0xfe, 0xdf, 0x01, 0x21, 0xe1,
+    0xe1, 0x01, 0x40, 0x11, 0xfb, 0x03, 0x53, 0x95, 0x0c, 0x39, 0x16, 0x46,
+    0x1c, 0x34, 0x39, 0x1f, 0x48, 0x22, 0x2d, 0xfe, 0xf2, 0x68, 0x70, 0x38,
+    0x2a, 0x2c, 0x15, 0x05, 0x05, 0x01, 0x59, 0x03, 0x02, 0x09, 0x18, 0x1c,
+    0x48, 0x4e, 0xfe, 0x7f, 0x01, 0x81, 0x59, 0xb9, 0x55, 0x95, 0xfe, 0x5d,
+    0xb9, 0xb9, 0xe8, 0x01, 0x91, 0x35, 0xff, 0xe9, 0x03, 0x86, 0x03, 0x19,
+    0x00, 0x1c, 0xa2, 0x00, 0x01, 0xd5, 0x0e, 0xe2, 0x16, 0x06, 0x06, 0x07,
+    0x06, 0x23, 0x23, 0x27, 0x16, 0x37, 0x3e, 0x02, 0x35, 0x11, 0xcf, 0x01,
+    0xf0, 0x24, 0x03, 0x41, 0xfe, 0xd8, 0x01, 0x6d, 0xfe, 0x93, 0x01, 0x13,
+    0x32, 0x31, 0x29, 0x3f, 0x1f, 0x12, 0x39, 0x42, 0x1a, 0x15, 0x08, 0xfe,
+    0x78, 0x01, 0x88, 0xfe, 0xbe, 0x03, 0x19, 0x53, 0xd9, 0x56, 0xfe, 0xd1,
+    0x2e, 0x31, 0x18, 0x04, 0x04, 0x5f, 0x05, 0x02, 0x01, 0x07, 0x15, 0x19,
+    0x01, 0x1c, 0x56, 0xd9, 0x53, 0x4a, 0x01, 0xb0, 0x1e, 0xff, 0xcc, 0x03,
+    0x9c, 0x03, 0x59, 0x00, 0x09, 0x00, 0x1c, 0x34, 0x0a, 0x11, 0x00, 0xfd,
+    0x00, 0x00, 0x07, 0x01, 0x11, 0x04, 0xa4, 0x01, 0x04, 0x0f, 0x00, 0x01,
+    0xa6, 0x01, 0x54, 0x17, 0x21, 0x15, 0x06, 0x07, 0x20, 0x00, 0xf0, 0x58,
+    0x16, 0x17, 0x17, 0x36, 0x37, 0x21, 0x01, 0xd1, 0x2f, 0x27, 0x16, 0x47,
+    0x14, 0x29, 0x1f, 0x23, 0x44, 0xfe, 0xde, 0x6d, 0x68, 0x4b, 0x4c, 0x44,
+    0x6e, 0x64, 0x81, 0x2f, 0x7a, 0x6f, 0x64, 0x41, 0x38, 0x67, 0x6c, 0x83,
+    0x33, 0x68, 0x02, 0x92, 0x6f, 0x70, 0x51, 0x2a, 0x33, 0x61, 0x86, 0x67,
+    0x66, 0x2a, 0x4f, 0x80, 0x22, 0x64, 0x58, 0xfd, 0xe2, 0x02, 0x68, 0x39,
+    0x2d, 0x23, 0x38, 0x21, 0x30, 0x26, 0x26, 0x39, 0x49, 0x5e, 0x59, 0x6e,
+    0x73, 0x5c, 0x53, 0x3f, 0x56, 0x3f, 0x5f, 0x55, 0x61, 0x52, 0x59, 0x5e,
+    0x48, 0x51, 0x58, 0x60, 0x7d, 0x5c, 0x2d, 0x1b, 0x51, 0x41, 0x44, 0x35,
+    0x2a, 0x51, 0x1e, 0x40, 0x12, 0x52, 0x61, 0x40, 0x02, 0xb0, 0x15, 0xff,
+    0xd9, 0x03, 0x91, 0x03, 0x52, 0x00, 0x1a, 0x00, 0x27, 0xec, 0x01, 0x10,
+    0x23, 0xed, 0x02, 0x00, 0xeb, 0x02, 0x03, 0x77, 0x04, 0x01, 0xd2, 0x08,
+    0x00, 0x98, 0x01, 0x12, 0x26, 0x02, 0x03, 0x30, 0x11, 0x23, 0x11, 0x53,
+    0x02, 0xf1, 0x32, 0x46, 0x8c, 0x1f, 0x1d, 0x56, 0x48, 0x2e, 0x58, 0x0c,
+    0x16, 0x72, 0x57, 0xd2, 0xd2, 0xf4, 0xf4, 0x57, 0xfe, 0xe2, 0xd5, 0x37,
+    0x3c, 0x1d, 0x5a, 0x19, 0x2a, 0x58, 0x1f, 0x22, 0x4c, 0x01, 0x5f, 0xdc,
+    0x60, 0x41, 0x1f, 0x99, 0xd1, 0x11, 0x32, 0x52, 0xc4, 0xc4, 0x53, 0xdc,
+    0x55, 0xfe, 0xcf, 0x01, 0x31, 0x55, 0x7f, 0x7b, 0x88, 0x71, 0x13, 0x55,
+    0x6b, 0xfd, 0x5d, 0x01, 0xe2, 0x3a, 0x37, 0x2d, 0x00, 0x06, 0xc1, 0xcb,
+    0x03, 0x8f, 0x03, 0x58, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x00, 0x01, 0x5e,
+    0x00, 0x51, 0x21, 0x15, 0x21, 0x07, 0x07, 0x60, 0x03, 0x0d, 0x0e, 0x01,
+    0xc7, 0x05, 0x35, 0x36, 0x37, 0x23, 0x35, 0x33, 0x37, 0x37, 0x23, 0x35,
+    0x06, 0x8a, 0x00, 0xf1, 0x63, 0x01, 0xf6, 0x0f, 0x09, 0x56, 0x09, 0x0c,
+    0x01, 0x1d, 0xfe, 0xd2, 0x0c, 0x0c, 0x01, 0x69, 0xfe, 0x81, 0x14, 0x09,
+    0x01, 0x54, 0x48, 0x3d, 0x53, 0x2c, 0x26, 0x43, 0x91, 0xa2, 0x3d, 0x22,
+    0x59, 0x86, 0x0d, 0x3e, 0x2d, 0xfe, 0xb4, 0x12, 0x0e, 0x92, 0xa9, 0x0e,
+    0x0b, 0x8e, 0xff, 0x75, 0x28, 0x55, 0x2c, 0x25, 0x53, 0x1f, 0x2b, 0x43,
+    0x02, 0xd3, 0x48, 0x3d, 0x0a, 0x3a, 0x41, 0x50, 0x31, 0x34, 0x51, 0x43,
+    0x19, 0x4f, 0x76, 0x4e, 0x2a, 0x1b, 0x4e, 0x30, 0x49, 0x49, 0x15, 0x46,
+    0x1d, 0x41, 0x06, 0x4e, 0x4e, 0x01, 0x4c, 0x2f, 0x33, 0x51, 0x39, 0x2c,
+    0x50, 0xe2, 0xec, 0x76, 0x15, 0x7c, 0x50, 0xfd, 0x66, 0x01, 0xf7, 0x37,
+    0x3f, 0x38, 0x00, 0x00, 0x04, 0x00, 0x12, 0xff, 0xe3, 0x03, 0x8b, 0xd0,
+    0x01, 0x3e, 0x16, 0x00, 0x21, 0xd2, 0x01, 0x06, 0x95, 0x00, 0xc4, 0x21,
+    0x36, 0x13, 0x17, 0x06, 0x06, 0x07, 0x33, 0x15, 0x21, 0x13, 0x33, 0xc3,
+    0x00, 0x00, 0x0e, 0x00, 0xf0, 0x52, 0x01, 0xdd, 0x20, 0x23, 0x0f, 0x53,
+    0x14, 0x1d, 0x1c, 0x20, 0x51, 0xfe, 0x99, 0x38, 0x33, 0x24, 0x59, 0x23,
+    0x29, 0x56, 0x22, 0x22, 0x49, 0x01, 0x0b, 0x01, 0x35, 0x4f, 0x3f, 0x59,
+    0x2b, 0x40, 0x24, 0xe1, 0xfd, 0x92, 0x1b, 0xf7, 0x05, 0x0e, 0x0f, 0x0c,
+    0x59, 0x11, 0x0e, 0x14, 0x0a, 0xf6, 0xfd, 0xbf, 0x01, 0xea, 0x73, 0x7e,
+    0x49, 0x18, 0x5e, 0x6b, 0x67, 0x5b, 0x17, 0x3c, 0x79, 0x6e, 0x72, 0x14,
+    0x6c, 0x62, 0xfd, 0x6e, 0x01, 0xe2, 0x3d, 0x30, 0x3b, 0xfe, 0xc4, 0xde,
+    0x01, 0x0c, 0x17, 0x9d, 0xd5, 0x61, 0x52, 0x02, 0xb4, 0x15, 0x2c, 0x30,
+    0x1b, 0x14, 0x28, 0x2e, 0x48, 0x02, 0x52, 0xa6, 0x00, 0xf8, 0x03, 0x13,
+    0xff, 0xd0, 0x03, 0x98, 0x03, 0x58, 0x00, 0x0c, 0x00, 0x38, 0x00, 0x3e,
+    0x00, 0x49, 0x00, 0x00, 0x12, 0x9c, 0x00, 0x51, 0x00, 0x36, 0x35, 0x11,
+    0x36, 0x10, 0x00, 0x91, 0x16, 0x17, 0x33, 0x15, 0x23, 0x14, 0x17, 0x16,
+    0x17, 0xde, 0x06, 0x02, 0x24, 0x00, 0x81, 0x06, 0x07, 0x22, 0x27, 0x26,
+    0x27, 0x23, 0x11, 0x0d, 0x00, 0x20, 0x27, 0x01, 0x9c, 0x02, 0x23, 0x15,
+    0x13, 0xa9, 0x02, 0xf0, 0x83, 0x27, 0x26, 0x27, 0x60, 0x32, 0x33, 0x27,
+    0x53, 0x24, 0x29, 0x54, 0x1d, 0x29, 0x45, 0x01, 0x44, 0x0e, 0x80, 0xfe,
+    0x6a, 0x15, 0x4c, 0x64, 0x03, 0x07, 0xc7, 0xbf, 0x02, 0x14, 0x24, 0x09,
+    0x17, 0x08, 0x08, 0x0c, 0x07, 0x0c, 0x06, 0x45, 0x0d, 0x14, 0x1f, 0x30,
+    0x48, 0x32, 0x2a, 0x13, 0xb7, 0x52, 0x4b, 0x1d, 0x6c, 0x98, 0x29, 0x01,
+    0x23, 0x07, 0x03, 0x67, 0x3f, 0x74, 0x15, 0x1e, 0x1f, 0x11, 0x3d, 0x12,
+    0x12, 0x0e, 0x1c, 0x13, 0x02, 0x03, 0x6e, 0x6b, 0x7c, 0x17, 0x73, 0x5e,
+    0xfd, 0x68, 0x01, 0xf2, 0x35, 0x3d, 0x37, 0xfe, 0xce, 0x18, 0x14, 0x02,
+    0x71, 0x08, 0x23, 0x17, 0x55, 0x11, 0x10, 0x7a, 0x58, 0x53, 0x07, 0x10,
+    0xa4, 0x61, 0x19, 0x1e, 0x17, 0x1a, 0x26, 0x26, 0x21, 0x43, 0x2d, 0x53,
+    0x01, 0x8c, 0x78, 0xb7, 0xfe, 0xf5, 0x34, 0x41, 0x50, 0x56, 0x54, 0x41,
+    0x01, 0xa2, 0x52, 0x74, 0x0d, 0x04, 0xb5, 0xfe, 0x82, 0x15, 0x23, 0x23,
+    0x1c, 0x2f, 0x1c, 0x16, 0x13, 0x24, 0x12, 0xc0, 0x02, 0x90, 0x11, 0xff,
+    0xdf, 0x03, 0x88, 0x03, 0x60, 0x00, 0x1d, 0x4c, 0x0b, 0x11, 0x25, 0x3d,
+    0x04, 0x26, 0x23, 0x35, 0x6c, 0x04, 0x12, 0x21, 0xc3, 0x02, 0x00, 0xda,
+    0x03, 0x29, 0x35, 0x02, 0xc3, 0x02, 0xf0, 0x4d, 0x23, 0xd9, 0xd9, 0xf0,
+    0x01, 0x12, 0x1e, 0x0c, 0x19, 0x4d, 0x12, 0x16, 0x1a, 0x0a, 0x37, 0x01,
+    0x0e, 0xf8, 0xd8, 0xd8, 0x01, 0x0e, 0xfd, 0x95, 0xc4, 0x2f, 0x3b, 0x26,
+    0x58, 0x2b, 0x26, 0x54, 0x1e, 0x24, 0x49, 0x54, 0xf1, 0x55, 0xc8, 0x53,
+    0x41, 0x1b, 0x30, 0x1f, 0x1e, 0x2c, 0x33, 0x1c, 0x12, 0x53, 0xc8, 0x55,
+    0xf1, 0x53, 0x53, 0x01, 0xa0, 0x65, 0x7c, 0x78, 0x16, 0x7d, 0x57, 0xfd,
+    0x7c, 0x01, 0xda, 0x36, 0x37, 0x32, 0x00, 0x06, 0x00, 0x1b, 0xff, 0xda,
+    0x03, 0x8b, 0x03, 0x52, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1d, 0x00, 0x21,
+    0x00, 0x25, 0x00, 0x29, 0x8a, 0x05, 0x3a, 0x21, 0x11, 0x24, 0x14, 0x02,
+    0x04, 0x94, 0x00, 0x60, 0x21, 0x15, 0x21, 0x17, 0x21, 0x15, 0x83, 0x06,
+    0xf1, 0x1b, 0x21, 0x01, 0x35, 0x21, 0x15, 0x03, 0x4a, 0xfe, 0x0b, 0xfe,
+    0xff, 0x39, 0x34, 0x1e, 0x54, 0x23, 0x23, 0x54, 0x14, 0x24, 0x46, 0x01,
+    0x0c, 0x01, 0x0a, 0x09, 0x0c, 0x0c, 0x52, 0x0f, 0x0f, 0x08, 0x03, 0x01,
+    0x00, 0xfd, 0x9c, 0x35, 0x01, 0xe6, 0xfe, 0x1a, 0x04, 0x00, 0xf2, 0x2a,
+    0x99, 0xfe, 0xb4, 0x01, 0x2c, 0xfe, 0xc9, 0x01, 0x37, 0xc7, 0x79, 0x71,
+    0x74, 0x13, 0x77, 0x55, 0xfd, 0x68, 0x01, 0xea, 0x25, 0x3c, 0x37, 0x01,
+    0x4a, 0x18, 0x29, 0x1c, 0x11, 0x1f, 0x2e, 0x16, 0x0b, 0x4e, 0xd9, 0x49,
+    0xda, 0x49, 0xfe, 0x3f, 0x99, 0x99, 0x00, 0x01, 0x00, 0x1e, 0xff, 0xde,
+    0x03, 0x95, 0x03, 0x5a, 0x00, 0x1f, 0x00, 0x00, 0x36, 0xab, 0x06, 0x02,
+    0x7f, 0x00, 0x11, 0x16, 0xf1, 0x01, 0x00, 0xbe, 0x08, 0x02, 0x7a, 0x04,
+    0xf7, 0x48, 0x06, 0x07, 0x27, 0x88, 0x99, 0x2e, 0x44, 0x19, 0x13, 0x14,
+    0x2b, 0x42, 0x38, 0x3e, 0x2f, 0x24, 0x31, 0x10, 0x38, 0x46, 0x2f, 0x76,
+    0x50, 0x40, 0x51, 0x7c, 0x2f, 0x43, 0x33, 0x1e, 0x26, 0x31, 0xa3, 0x6a,
+    0x43, 0x7c, 0xaf, 0x59, 0x7f, 0x7d, 0x1e, 0x14, 0x39, 0x28, 0x47, 0x25,
+    0x38, 0x20, 0x4d, 0x3b, 0xa8, 0x76, 0x4d, 0x80, 0x3a, 0x52, 0x40, 0x8c,
+    0x51, 0x75, 0x8d, 0x58, 0x4b, 0x60, 0xc4, 0x55, 0x4a, 0x00, 0x03, 0x00,
+    0x37, 0xff, 0xdc, 0x03, 0x86, 0x03, 0x50, 0x00, 0x0e, 0x00, 0x18, 0x00,
+    0x22, 0x00, 0x00, 0x01, 0x26, 0x81, 0x01, 0x23, 0x21, 0x35, 0x81, 0x02,
+    0x00, 0x06, 0x01, 0x05, 0xf5, 0x04, 0xf1, 0x46, 0x01, 0xce, 0x07, 0x17,
+    0x17, 0x12, 0x57, 0x19, 0x14, 0x17, 0x0b, 0x28, 0x01, 0x81, 0xfc, 0xb1,
+    0x53, 0x40, 0x42, 0x2c, 0x5a, 0x2a, 0x49, 0x50, 0x43, 0x4f, 0x02, 0x40,
+    0x3e, 0x4e, 0x4f, 0x2a, 0x56, 0x23, 0x54, 0x52, 0x36, 0x02, 0x81, 0x1b,
+    0x37, 0x3d, 0x23, 0x1d, 0x31, 0x32, 0x39, 0x27, 0x0c, 0x58, 0x58, 0xfd,
+    0xee, 0x75, 0x75, 0x76, 0x20, 0x71, 0x85, 0x8c, 0x51, 0x37, 0x01, 0xc0,
+    0x53, 0x86, 0x88, 0x60, 0x32, 0x55, 0x91, 0x93, 0x49, 0x00, 0x01, 0x00,
+    0x2d, 0xff, 0xcf, 0x03, 0x84, 0x03, 0x60, 0x00, 0x32, 0x92, 0x03, 0x00,
+    0x6b, 0x03, 0x03, 0xcf, 0x02, 0x00, 0x74, 0x03, 0x10, 0x15, 0xfc, 0x01,
+    0x00, 0xf2, 0x00, 0x12, 0x24, 0x69, 0x05, 0x16, 0x36, 0xa6, 0x07, 0x02,
+    0x9c, 0x03, 0xf2, 0x5f, 0x01, 0x35, 0x1e, 0x1e, 0x0c, 0x0d, 0x42, 0xc3,
+    0x1d, 0x20, 0x31, 0x20, 0x52, 0x1f, 0x2f, 0x1f, 0xc3, 0xfe, 0xc5, 0x01,
+    0x6b, 0xfe, 0x9d, 0x28, 0xbc, 0x92, 0x29, 0xfe, 0xe5, 0x67, 0x18, 0x22,
+    0x60, 0xe1, 0x31, 0x71, 0x9e, 0x25, 0x29, 0x10, 0xfe, 0xa5, 0x01, 0x69,
+    0xfe, 0xc5, 0xcb, 0x1f, 0x13, 0x1e, 0x1b, 0x49, 0x03, 0x3d, 0x2a, 0x2a,
+    0x14, 0x14, 0x27, 0x22, 0x2a, 0x41, 0x38, 0x30, 0x33, 0x3c, 0x26, 0x55,
+    0x9f, 0x01, 0x5a, 0x68, 0x94, 0x26, 0x59, 0x56, 0xcb, 0x2d, 0x28, 0x6f,
+    0x5e, 0x54, 0x29, 0x63, 0x31, 0x38, 0x33, 0x5a, 0xa0, 0x55, 0x32, 0x1a,
+    0x2c, 0x22, 0x2c, 0x00, 0x01, 0x00, 0x6f, 0xff, 0xf1, 0x03, 0x51, 0x03,
+    0x54, 0x00, 0x17, 0x00, 0x00, 0x13, 0xa3, 0x14, 0x10, 0x15, 0x82, 0x14,
+    0x21, 0x33, 0x35, 0x0c, 0x00, 0x01, 0x12, 0x00, 0xf0, 0x18, 0xc6, 0xed,
+    0xfe, 0xd6, 0x58, 0xd2, 0x57, 0xd3, 0x58, 0xfe, 0xd5, 0xee, 0x59, 0xfd,
+    0x1e, 0x01, 0x63, 0xfe, 0xe6, 0x01, 0x60, 0x01, 0x53, 0xfd, 0x01, 0x55,
+    0xfe, 0xab, 0xfd, 0xfe, 0xad, 0xfe, 0xa0, 0x01, 0x1c, 0xfe, 0x8c, 0x01,
+    0x72, 0x56, 0x06, 0xd2, 0x1d, 0xff, 0xcb, 0x03, 0x61, 0x03, 0x47, 0x00,
+    0x03, 0x00, 0x28, 0x00, 0x37, 0xf4, 0x07, 0x20, 0x00, 0x37, 0x1d, 0x05,
+    0x72, 0x21, 0x15, 0x23, 0x06, 0x07, 0x33, 0x07, 0xe6, 0x00, 0x00, 0x12,
+    0x00, 0x27, 0x06, 0x07, 0x64, 0x06, 0x52, 0x27, 0x04, 0x33, 0x32, 0x36,
+    0x6b, 0x0d, 0x00, 0xe1, 0x06, 0xf8, 0x6e, 0x27, 0x02, 0xa0, 0x57, 0xfe,
+    0x1c, 0x34, 0x33, 0x18, 0x96, 0x01, 0xd9, 0xe8, 0x13, 0x12, 0xe6, 0x01,
+    0x2c, 0x5a, 0x56, 0xa9, 0x3f, 0xa3, 0x51, 0x50, 0x28, 0xab, 0x13, 0x14,
+    0x15, 0x17, 0x2f, 0x14, 0x37, 0x18, 0x26, 0x0e, 0x15, 0x20, 0x2b, 0x44,
+    0x02, 0x74, 0x36, 0x1f, 0x1a, 0x0a, 0x57, 0x2d, 0x3b, 0x31, 0x54, 0x12,
+    0x02, 0xed, 0xfd, 0xcb, 0x02, 0x35, 0xfe, 0xa2, 0x6e, 0x6b, 0x65, 0x53,
+    0x53, 0x49, 0x33, 0x4e, 0xc2, 0x82, 0x7a, 0x7a, 0x46, 0x6e, 0x70, 0x6f,
+    0xa3, 0x2d, 0x26, 0x0f, 0x14, 0x26, 0x17, 0x43, 0x19, 0x23, 0x0d, 0x11,
+    0x37, 0x36, 0x37, 0xf2, 0x06, 0x17, 0x1b, 0x02, 0xd2, 0xfd, 0x12, 0x3d,
+    0x31, 0x07, 0x05, 0x61, 0x00, 0x05, 0x00, 0x20, 0xff, 0xdb, 0x03, 0x5f,
+    0x03, 0x44, 0x00, 0x03, 0x00, 0x42, 0x00, 0x46, 0x00, 0x4a, 0x00, 0x5a,
+    0xb6, 0x00, 0x10, 0x33, 0x93, 0x00, 0x02, 0x05, 0x00, 0x23, 0x15, 0x23,
+    0x9c, 0x00, 0x20, 0x16, 0x33, 0xaa, 0x00, 0x16, 0x23, 0xca, 0x00, 0x0c,
+    0x18, 0x00, 0x00, 0xb7, 0x02, 0x13, 0x13, 0x8d, 0x08, 0x41, 0x12, 0x33,
+    0x3e, 0x02, 0xd7, 0x00, 0x00, 0xb9, 0x07, 0xf1, 0x48, 0x27, 0x27, 0x02,
+    0xd4, 0x46, 0xfd, 0xc4, 0x0c, 0x0e, 0x01, 0x41, 0x42, 0xce, 0x36, 0xd1,
+    0x35, 0x35, 0x1b, 0x28, 0x19, 0x28, 0x0f, 0x14, 0x1b, 0x13, 0x0a, 0x43,
+    0x02, 0x0e, 0x0b, 0x29, 0x45, 0x2a, 0x0d, 0x0a, 0x01, 0x36, 0x1b, 0x28,
+    0x20, 0x20, 0x0e, 0x17, 0x14, 0x13, 0x0c, 0x3e, 0x02, 0x0e, 0x09, 0x1f,
+    0x1a, 0x45, 0xd5, 0x3e, 0x01, 0x45, 0x43, 0xf5, 0x38, 0x15, 0x13, 0x06,
+    0x4b, 0x0d, 0x25, 0x26, 0x2d, 0x41, 0x0e, 0x02, 0xec, 0xfd, 0xd2, 0x02,
+    0x2e, 0xfd, 0x73, 0x4b, 0x4b, 0x9b, 0x4d, 0x03, 0x01, 0x43, 0xfe, 0xba,
+    0x05, 0x00, 0xf0, 0x32, 0x4d, 0xfe, 0xc1, 0x30, 0x2a, 0x06, 0x04, 0x54,
+    0x02, 0x01, 0x0d, 0x1b, 0x01, 0x28, 0xaa, 0x53, 0x54, 0x64, 0x1b, 0x60,
+    0x53, 0x53, 0x94, 0xfe, 0xcd, 0x30, 0x2a, 0x08, 0x04, 0x54, 0x03, 0x01,
+    0x0d, 0x19, 0x01, 0x21, 0xa6, 0x54, 0x32, 0x58, 0x30, 0x20, 0x01, 0xe1,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0x53, 0x01, 0x09, 0x16, 0x1a, 0x02, 0xda,
+    0xfd, 0x18, 0x2a, 0x2e, 0x19, 0x05, 0x07, 0x02, 0x52, 0xbe, 0x01, 0xf1,
+    0x02, 0x26, 0xff, 0xde, 0x03, 0x5c, 0x03, 0x45, 0x00, 0x34, 0x00, 0x38,
+    0x00, 0x47, 0x00, 0x00, 0x36, 0x37, 0xb3, 0x04, 0x03, 0xe8, 0x00, 0x05,
+    0xc6, 0x01, 0x00, 0x5f, 0x0a, 0x02, 0x5e, 0x0a, 0x02, 0xc1, 0x01, 0x11,
+    0x07, 0xc5, 0x04, 0x05, 0x46, 0x03, 0x45, 0x33, 0x11, 0x23, 0x16, 0xf6,
+    0x00, 0x00, 0xf5, 0x00, 0xf0, 0x6f, 0x82, 0x80, 0xb9, 0xb8, 0x7a, 0x3b,
+    0x0d, 0x0d, 0x0f, 0x1c, 0x2d, 0x1a, 0x1a, 0x9e, 0x01, 0xe4, 0xe6, 0x21,
+    0x16, 0x30, 0x21, 0x47, 0x50, 0x58, 0x23, 0x1d, 0x3d, 0x19, 0x2b, 0x0c,
+    0x29, 0x17, 0x42, 0x0f, 0x0f, 0x75, 0xb9, 0xb8, 0x6a, 0x63, 0x04, 0x6e,
+    0x91, 0x9c, 0x60, 0x08, 0x02, 0x28, 0x53, 0x53, 0x56, 0x2d, 0x19, 0x16,
+    0x08, 0x54, 0x2d, 0x37, 0x3f, 0x36, 0x11, 0x5b, 0x0b, 0x8c, 0x54, 0x80,
+    0x06, 0x02, 0x4b, 0x01, 0x0f, 0x1d, 0x43, 0x24, 0x2a, 0x53, 0x53, 0x34,
+    0x1f, 0x43, 0x26, 0x03, 0x06, 0x07, 0x36, 0x24, 0x2b, 0x1c, 0x41, 0x11,
+    0x3a, 0x2e, 0x2b, 0x1e, 0x17, 0x09, 0x85, 0x54, 0x83, 0x0b, 0x11, 0x56,
+    0x0f, 0x0e, 0x10, 0x02, 0x53, 0x02, 0x9b, 0xfd, 0xc3, 0x80, 0x01, 0x07,
+    0x16, 0x19, 0x02, 0xd7, 0xfd, 0x0d, 0x38, 0x30, 0x06, 0x06, 0x02, 0x5a,
+    0xd8, 0x00, 0x60, 0x35, 0xff, 0xcd, 0x03, 0x65, 0x03, 0x0c, 0x04, 0x32,
+    0x34, 0x00, 0x43, 0xe0, 0x01, 0x2e, 0x05, 0x33, 0x4f, 0x08, 0x02, 0x04,
+    0x00, 0x07, 0xce, 0x01, 0x11, 0x35, 0x9d, 0x14, 0x00, 0xbb, 0x17, 0x3b,
+    0x35, 0x23, 0x00, 0xa2, 0x02, 0xf0, 0x59, 0xbd, 0x52, 0xfd, 0xca, 0xe5,
     0x6e, 0x10, 0x18, 0x4a, 0x3a, 0x19, 0x4e, 0x0e, 0x08, 0x55, 0x52, 0xb9,
     0xb9, 0xcd, 0xcd, 0xb4, 0x1f, 0x2f, 0x1c, 0x29, 0x0e, 0x24, 0x0f, 0x14,
     0x0d, 0x67, 0x52, 0x6a, 0x4c, 0xb6, 0xe5, 0x02, 0x80, 0x15, 0x24, 0x1b,
@@ -873,142 +662,123 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x81, 0x4d, 0x69, 0x4e, 0x58, 0xf4, 0x30, 0x28, 0x06, 0x04, 0x4d, 0x02,
     0x02, 0x0e, 0x16, 0x96, 0xfe, 0xaf, 0x01, 0x51, 0xfe, 0xf2, 0x01, 0x5d,
     0x58, 0xfe, 0x6b, 0x05, 0x16, 0x1c, 0x02, 0xe1, 0xfd, 0x09, 0x39, 0x31,
-    0x07, 0x04, 0x56, 0x00, 0x00, 0x07, 0x00, 0x3a, 0xff, 0xce, 0x03, 0x7f,
+    0x07, 0x04, 0x56, 0x26, 0x15, 0xf4, 0x08, 0x3a, 0xff, 0xce, 0x03, 0x7f,
     0x03, 0x5f, 0x00, 0x23, 0x00, 0x39, 0x00, 0x4c, 0x00, 0x50, 0x00, 0x54,
-    0x00, 0x58, 0x00, 0x68, 0x00, 0x00, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x21,
-    0x35, 0x21, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01,
-    0x16, 0x33, 0x32, 0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x21, 0x0e, 0x01,
-    0x07, 0x06, 0x07, 0x27, 0x03, 0x33, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x33, 0x36, 0x07, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x33,
-    0x15, 0x21, 0x17, 0x21, 0x11, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16,
-    0x33, 0x3a, 0x01, 0x36, 0x3d, 0x01, 0x23, 0x15, 0x23, 0x25, 0x35, 0x23,
-    0x15, 0x37, 0x35, 0x23, 0x15, 0x25, 0x33, 0x15, 0x23, 0x16, 0x37, 0x3e,
-    0x02, 0x3d, 0x01, 0x33, 0x15, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01,
-    0x92, 0x62, 0x22, 0x3b, 0x16, 0xfe, 0xf9, 0x02, 0xf0, 0x06, 0x12, 0x07,
-    0x19, 0x32, 0x2e, 0x3a, 0x2a, 0x1e, 0x0e, 0x0f, 0x42, 0x20, 0x17, 0x0a,
-    0x1e, 0x1a, 0x0c, 0x04, 0x08, 0x05, 0xfe, 0xcd, 0x0e, 0x35, 0x2b, 0x52,
-    0x9c, 0x1b, 0x0d, 0xea, 0x0d, 0x10, 0x10, 0x48, 0x0e, 0x17, 0x12, 0x05,
-    0xbc, 0x23, 0x06, 0x17, 0x1a, 0x47, 0x1f, 0x13, 0x03, 0xe8, 0xfc, 0xbb,
-    0x40, 0x01, 0x64, 0x20, 0x2e, 0x46, 0x20, 0x0f, 0x18, 0x19, 0x07, 0x31,
-    0x0a, 0xc4, 0x50, 0x01, 0x14, 0xc4, 0xc4, 0xc4, 0x01, 0x71, 0x4b, 0x4b,
-    0x57, 0x2f, 0x16, 0x13, 0x06, 0x4e, 0x0e, 0x26, 0x26, 0x51, 0x29, 0x0e,
-    0x2a, 0x1d, 0x12, 0x21, 0x3d, 0x45, 0x69, 0x57, 0x1e, 0x21, 0x11, 0x05,
-    0x05, 0x01, 0x52, 0x04, 0x01, 0x02, 0x05, 0x0e, 0x11, 0x2a, 0x35, 0x33,
-    0x48, 0x1b, 0x38, 0x1b, 0x4d, 0x02, 0xdd, 0x15, 0x1b, 0x17, 0x1b, 0x12,
-    0x25, 0x1f, 0x0c, 0x2a, 0x07, 0x1d, 0x27, 0x23, 0x2b, 0x15, 0x04, 0x41,
-    0x30, 0xfe, 0xfd, 0x30, 0x27, 0x07, 0x04, 0x02, 0x3d, 0x03, 0x11, 0x15,
-    0x0a, 0x69, 0x9f, 0x2c, 0x2c, 0x60, 0x2b, 0x2b, 0x58, 0xeb, 0x29, 0x01,
-    0x01, 0x07, 0x15, 0x19, 0xed, 0xfa, 0x27, 0x2a, 0x15, 0x05, 0x05, 0x01,
-    0x49, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x27, 0xff, 0xcb, 0x03, 0x98,
-    0x03, 0x61, 0x00, 0x1a, 0x00, 0x3f, 0x00, 0x44, 0x00, 0x00, 0x12, 0x37,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07,
-    0x24, 0x2f, 0x01, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x06, 0x07,
-    0x27, 0x12, 0x37, 0x36, 0x37, 0x23, 0x35, 0x33, 0x36, 0x37, 0x17, 0x07,
-    0x21, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x16,
-    0x33, 0x32, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x21, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x00, 0x17, 0x36, 0x37, 0x21, 0x89, 0x46, 0x4b, 0x28, 0x4c, 0x19,
-    0x12, 0x01, 0xc5, 0x61, 0x8b, 0x7f, 0xdd, 0x18, 0xfe, 0xfa, 0x8f, 0x0a,
-    0x9c, 0xfe, 0x20, 0xcd, 0x95, 0x4d, 0x46, 0x40, 0x45, 0x38, 0xa3, 0x3a,
-    0x25, 0x11, 0xe1, 0xf3, 0x01, 0x0a, 0x59, 0x0b, 0x01, 0x67, 0x06, 0x0e,
-    0x06, 0x18, 0x35, 0x32, 0x27, 0x44, 0x24, 0x10, 0x10, 0x33, 0x2a, 0x3a,
-    0x30, 0x12, 0x03, 0x0b, 0x04, 0xfe, 0xe6, 0x17, 0x37, 0x4b, 0xa8, 0x2f,
-    0x01, 0x49, 0x5f, 0x76, 0x53, 0xfe, 0x8b, 0x02, 0x8b, 0x48, 0x4e, 0x40,
-    0x22, 0x27, 0x16, 0x47, 0x5d, 0x4e, 0x2e, 0x26, 0x54, 0x34, 0x42, 0x05,
-    0x47, 0x40, 0x53, 0x2a, 0x3a, 0x30, 0x43, 0x40, 0x31, 0x3d, 0xfe, 0x07,
-    0x3d, 0x29, 0x33, 0x4e, 0x09, 0x58, 0x01, 0x60, 0x8d, 0x60, 0x26, 0x2a,
-    0x16, 0x06, 0x04, 0x01, 0x54, 0x03, 0x07, 0x13, 0x18, 0x3c, 0x4f, 0x56,
-    0x3b, 0x4b, 0x4b, 0x4c, 0x02, 0x53, 0x31, 0x38, 0x49, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x1c, 0xff, 0xe6, 0x03, 0x86, 0x03, 0x57, 0x00, 0x48,
-    0x00, 0x4c, 0x00, 0x00, 0x12, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15,
-    0x14, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x3e,
-    0x02, 0x37, 0x3e, 0x01, 0x3d, 0x01, 0x21, 0x06, 0x07, 0x21, 0x11, 0x21,
-    0x15, 0x14, 0x16, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37,
-    0x36, 0x3f, 0x01, 0x36, 0x35, 0x17, 0x06, 0x07, 0x06, 0x07, 0x0e, 0x01,
-    0x07, 0x06, 0x23, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x11,
-    0x06, 0x07, 0x27, 0x05, 0x35, 0x21, 0x15, 0x64, 0x76, 0x22, 0x58, 0x11,
-    0x0e, 0x01, 0xf8, 0x06, 0x05, 0x02, 0x1a, 0x39, 0x34, 0x26, 0x44, 0x10,
-    0x3e, 0x2d, 0x1e, 0x1a, 0x0a, 0x03, 0x04, 0x05, 0xfe, 0x32, 0x1a, 0x2d,
-    0x01, 0x7b, 0xfe, 0xa3, 0x04, 0x08, 0x0f, 0x35, 0x49, 0x86, 0x8d, 0x36,
-    0x37, 0x13, 0x12, 0x08, 0x05, 0x06, 0x54, 0x08, 0x07, 0x09, 0x15, 0x0f,
-    0x36, 0x30, 0x5a, 0x88, 0xaa, 0x3f, 0x30, 0x35, 0x0e, 0x0e, 0x0b, 0x01,
-    0x19, 0x17, 0x42, 0x01, 0xce, 0xfe, 0xf7, 0x02, 0x48, 0xb7, 0x58, 0x1a,
-    0x28, 0x1e, 0x2f, 0x7b, 0xf7, 0x46, 0x2a, 0x2f, 0x19, 0x04, 0x03, 0x5c,
-    0x03, 0x01, 0x09, 0x1b, 0x21, 0x2b, 0xca, 0x56, 0x24, 0x2d, 0x3f, 0xfe,
-    0xc3, 0x7a, 0x16, 0x16, 0x08, 0x0c, 0x03, 0x04, 0x03, 0x03, 0x0a, 0x09,
-    0x29, 0x23, 0x26, 0x02, 0x19, 0x3c, 0x23, 0x2f, 0x15, 0x0f, 0x0f, 0x03,
-    0x05, 0x02, 0x04, 0x04, 0x0f, 0x0e, 0x0e, 0x30, 0x26, 0x01, 0x85, 0x1e,
-    0x17, 0x3c, 0xad, 0x98, 0x98, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1b,
-    0xff, 0xda, 0x03, 0x89, 0x03, 0x58, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x00,
-    0x00, 0x37, 0x11, 0x33, 0x11, 0x37, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01,
-    0x15, 0x1e, 0x02, 0x3b, 0x01, 0x32, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x02,
-    0x3d, 0x01, 0x06, 0x07, 0x27, 0x26, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x01, 0x7e, 0x5f, 0x59, 0x0a, 0x7f,
-    0x72, 0x44, 0x80, 0x8f, 0x30, 0x01, 0x0c, 0x1f, 0x25, 0x32, 0x25, 0x0d,
-    0x1d, 0x1c, 0x04, 0x0a, 0x01, 0x56, 0x04, 0x07, 0x06, 0x1a, 0x32, 0x2c,
-    0x18, 0x2e, 0x3d, 0x18, 0x36, 0x3a, 0x18, 0x48, 0x4a, 0x36, 0xaf, 0x46,
-    0x48, 0x23, 0x56, 0x2b, 0x33, 0x59, 0x25, 0x2e, 0x48, 0x01, 0x4f, 0x49,
-    0x01, 0xb4, 0xfe, 0x94, 0x09, 0x6c, 0x86, 0x3e, 0x8f, 0x7c, 0x27, 0xda,
-    0x1f, 0x1b, 0x07, 0x01, 0x02, 0x1c, 0x1f, 0x56, 0x0f, 0x17, 0x3e, 0x2b,
-    0x2e, 0x34, 0x19, 0x03, 0x01, 0x01, 0x01, 0x19, 0x39, 0x35, 0xa9, 0x36,
-    0x2f, 0x4d, 0xcb, 0x84, 0x8b, 0x70, 0x1b, 0x79, 0x68, 0xfd, 0x7e, 0x01,
-    0xde, 0x3e, 0x40, 0x36, 0x00, 0x06, 0x00, 0x24, 0xff, 0xd6, 0x03, 0xa2,
-    0x03, 0x2b, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39,
-    0x00, 0x40, 0x00, 0x00, 0x24, 0x37, 0x2e, 0x01, 0x27, 0x23, 0x35, 0x21,
-    0x15, 0x0e, 0x01, 0x07, 0x06, 0x15, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x24, 0x37, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x15, 0x23, 0x35, 0x07, 0x06, 0x07, 0x27, 0x37,
-    0x36, 0x3f, 0x01, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x37, 0x35,
-    0x23, 0x15, 0x04, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x23, 0x02, 0x47, 0x40,
-    0x29, 0x37, 0x10, 0x1a, 0x01, 0x6a, 0x17, 0x3a, 0x2c, 0x02, 0x42, 0x78,
-    0x39, 0x71, 0x40, 0x3f, 0x6e, 0x3e, 0xfe, 0x67, 0x41, 0x37, 0x01, 0xa8,
-    0x30, 0x14, 0x3c, 0x05, 0x27, 0x2e, 0x51, 0x4b, 0x96, 0x56, 0x0a, 0xf1,
-    0x13, 0x24, 0x19, 0x9e, 0x9e, 0x9e, 0x9e, 0x9e, 0x01, 0xac, 0x27, 0x1d,
-    0x1e, 0x2c, 0x12, 0xad, 0x8d, 0x64, 0x4f, 0xd9, 0x90, 0x52, 0x52, 0x90,
-    0xcf, 0x54, 0x04, 0x01, 0x64, 0x5d, 0x4a, 0x65, 0x58, 0x5a, 0x65, 0x44,
-    0x73, 0x09, 0x02, 0x37, 0x50, 0x50, 0xfe, 0x04, 0x04, 0x0f, 0x56, 0x0b,
-    0x0a, 0xb1, 0xa0, 0x0f, 0x1d, 0x07, 0x57, 0x24, 0x03, 0x08, 0x05, 0x7d,
-    0x9b, 0xe9, 0x79, 0x79, 0xc6, 0x7c, 0x7c, 0x28, 0xab, 0x42, 0x46, 0xaa,
-    0x6f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x87, 0x00, 0x17, 0x03, 0x36,
-    0x02, 0xfb, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11,
-    0x01, 0x11, 0x21, 0x11, 0x03, 0x36, 0xfd, 0x51, 0x02, 0x54, 0xfe, 0x06,
-    0x02, 0xfb, 0xfd, 0x1c, 0x02, 0xe4, 0xfd, 0x72, 0x02, 0x37, 0xfd, 0xc9,
-    0x00, 0x03, 0x00, 0x31, 0xff, 0xe4, 0x03, 0x90, 0x03, 0x1b, 0x00, 0x15,
-    0x00, 0x19, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x15, 0x23, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x23, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x37, 0x3e, 0x02, 0x35,
-    0x11, 0x21, 0x35, 0x17, 0x21, 0x11, 0x21, 0x25, 0x35, 0x23, 0x15, 0x03,
-    0x90, 0x7c, 0x2c, 0x39, 0x3f, 0x37, 0x20, 0x10, 0x32, 0x2d, 0x18, 0x0a,
-    0x17, 0x15, 0x08, 0xfd, 0x73, 0x68, 0x01, 0x90, 0xfe, 0x70, 0x01, 0x3e,
-    0xeb, 0x03, 0x1b, 0x52, 0xfd, 0x97, 0x3d, 0x32, 0x06, 0x07, 0x01, 0x5a,
-    0x04, 0x01, 0x01, 0x08, 0x17, 0x19, 0x02, 0x54, 0x52, 0xd6, 0xfe, 0x62,
-    0x53, 0xfa, 0xfa, 0x00, 0x00, 0x03, 0x00, 0x16, 0xff, 0xe5, 0x03, 0x7c,
-    0x03, 0x40, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x00, 0x01, 0x11,
-    0x21, 0x11, 0x06, 0x37, 0x36, 0x3d, 0x01, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x15, 0x21, 0x15, 0x21, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x25, 0x35, 0x21, 0x15, 0x03, 0x2f, 0xfd, 0xf4, 0xc1, 0x1b, 0x1a,
-    0xa4, 0xaf, 0xc0, 0x8a, 0x15, 0x7f, 0xb7, 0x9c, 0x8c, 0x02, 0x91, 0xfd,
-    0x6f, 0x02, 0x1e, 0x1e, 0x4a, 0x4d, 0x02, 0xc3, 0xfe, 0x9c, 0x01, 0x7a,
-    0xfe, 0x84, 0x01, 0x7c, 0xf5, 0x6d, 0x69, 0xbf, 0xef, 0x02, 0x0d, 0x10,
-    0x18, 0x58, 0x11, 0x10, 0x0d, 0x03, 0x76, 0x50, 0xaa, 0x76, 0x7c, 0x70,
-    0x33, 0x36, 0xdc, 0xdc, 0x00, 0x04, 0x00, 0x16, 0xff, 0xfa, 0x03, 0x59,
-    0x03, 0x5c, 0x00, 0x03, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x00,
-    0x01, 0x11, 0x21, 0x11, 0x06, 0x37, 0x36, 0x3d, 0x01, 0x21, 0x27, 0x26,
-    0x27, 0x37, 0x16, 0x1f, 0x01, 0x21, 0x11, 0x21, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x03, 0x46, 0xfd,
-    0xc6, 0xaa, 0x1b, 0x1c, 0x01, 0x42, 0x06, 0x08, 0x11, 0x58, 0x06, 0x15,
-    0x0a, 0x01, 0x20, 0xfd, 0x98, 0x03, 0x1b, 0x1c, 0x51, 0x50, 0x02, 0xec,
-    0xfd, 0xef, 0x01, 0xfd, 0xfe, 0x75, 0x01, 0x69, 0xfe, 0x91, 0x01, 0x6f,
-    0xce, 0x63, 0x64, 0xa3, 0xef, 0x11, 0x1a, 0x2a, 0x13, 0x0e, 0x3a, 0x20,
-    0xfe, 0xdd, 0x96, 0x5c, 0x68, 0x7d, 0x32, 0x01, 0xf5, 0x84, 0x84, 0xfe,
-    0x28, 0xd0, 0xd0, 0x00, 0x00, 0x06, 0x00, 0x24, 0xff, 0xf7, 0x03, 0x96,
+    0x00, 0x58, 0x00, 0x68, 0x00, 0x00, 0x2e, 0x04, 0x08, 0xaf, 0x0a, 0x22,
+    0x32, 0x37, 0xb0, 0x0a, 0x11, 0x06, 0x8d, 0x01, 0x24, 0x03, 0x33, 0xec,
+    0x04, 0x35, 0x33, 0x36, 0x07, 0x76, 0x04, 0x22, 0x17, 0x21, 0x9a, 0x01,
+    0x00, 0x2f, 0x00, 0x10, 0x32, 0xe6, 0x00, 0xe1, 0x15, 0x23, 0x25, 0x35,
+    0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x25, 0x33, 0x15, 0x23, 0x5d, 0x0a,
+    0x33, 0x35, 0x33, 0x15, 0xb4, 0x02, 0xf0, 0x99, 0x92, 0x62, 0x22, 0x3b,
+    0x16, 0xfe, 0xf9, 0x02, 0xf0, 0x06, 0x12, 0x07, 0x19, 0x32, 0x2e, 0x3a,
+    0x2a, 0x1e, 0x0e, 0x0f, 0x42, 0x20, 0x17, 0x0a, 0x1e, 0x1a, 0x0c, 0x04,
+    0x08, 0x05, 0xfe, 0xcd, 0x0e, 0x35, 0x2b, 0x52, 0x9c, 0x1b, 0x0d, 0xea,
+    0x0d, 0x10, 0x10, 0x48, 0x0e, 0x17, 0x12, 0x05, 0xbc, 0x23, 0x06, 0x17,
+    0x1a, 0x47, 0x1f, 0x13, 0x03, 0xe8, 0xfc, 0xbb, 0x40, 0x01, 0x64, 0x20,
+    0x2e, 0x46, 0x20, 0x0f, 0x18, 0x19, 0x07, 0x31, 0x0a, 0xc4, 0x50, 0x01,
+    0x14, 0xc4, 0xc4, 0xc4, 0x01, 0x71, 0x4b, 0x4b, 0x57, 0x2f, 0x16, 0x13,
+    0x06, 0x4e, 0x0e, 0x26, 0x26, 0x51, 0x29, 0x0e, 0x2a, 0x1d, 0x12, 0x21,
+    0x3d, 0x45, 0x69, 0x57, 0x1e, 0x21, 0x11, 0x05, 0x05, 0x01, 0x52, 0x04,
+    0x01, 0x02, 0x05, 0x0e, 0x11, 0x2a, 0x35, 0x33, 0x48, 0x1b, 0x38, 0x1b,
+    0x4d, 0x02, 0xdd, 0x15, 0x1b, 0x17, 0x1b, 0x12, 0x25, 0x1f, 0x0c, 0x2a,
+    0x07, 0x1d, 0x27, 0x23, 0x2b, 0x15, 0x04, 0x41, 0x30, 0xfe, 0xfd, 0x30,
+    0x27, 0x07, 0x04, 0x02, 0x3d, 0x03, 0x11, 0x15, 0x0a, 0x69, 0x9f, 0x2c,
+    0x2c, 0x60, 0x2b, 0x2b, 0x58, 0xeb, 0x29, 0x01, 0xde, 0x0a, 0x40, 0xed,
+    0xfa, 0x27, 0x2a, 0x53, 0x0b, 0x10, 0x49, 0xf6, 0x01, 0xd5, 0x27, 0xff,
+    0xcb, 0x03, 0x98, 0x03, 0x61, 0x00, 0x1a, 0x00, 0x3f, 0x00, 0x44, 0x6a,
+    0x08, 0x03, 0xbd, 0x09, 0x31, 0x24, 0x27, 0x27, 0xff, 0x01, 0x01, 0x7e,
+    0x04, 0x12, 0x12, 0xed, 0x03, 0x4a, 0x36, 0x37, 0x17, 0x07, 0x4d, 0x01,
+    0x02, 0x62, 0x01, 0x01, 0x4b, 0x01, 0x10, 0x00, 0xf6, 0x0a, 0xf2, 0x78,
+    0x89, 0x46, 0x4b, 0x28, 0x4c, 0x19, 0x12, 0x01, 0xc5, 0x61, 0x8b, 0x7f,
+    0xdd, 0x18, 0xfe, 0xfa, 0x8f, 0x0a, 0x9c, 0xfe, 0x20, 0xcd, 0x95, 0x4d,
+    0x46, 0x40, 0x45, 0x38, 0xa3, 0x3a, 0x25, 0x11, 0xe1, 0xf3, 0x01, 0x0a,
+    0x59, 0x0b, 0x01, 0x67, 0x06, 0x0e, 0x06, 0x18, 0x35, 0x32, 0x27, 0x44,
+    0x24, 0x10, 0x10, 0x33, 0x2a, 0x3a, 0x30, 0x12, 0x03, 0x0b, 0x04, 0xfe,
+    0xe6, 0x17, 0x37, 0x4b, 0xa8, 0x2f, 0x01, 0x49, 0x5f, 0x76, 0x53, 0xfe,
+    0x8b, 0x02, 0x8b, 0x48, 0x4e, 0x40, 0x22, 0x27, 0x16, 0x47, 0x5d, 0x4e,
+    0x2e, 0x26, 0x54, 0x34, 0x42, 0x05, 0x47, 0x40, 0x53, 0x2a, 0x3a, 0x30,
+    0x43, 0x40, 0x31, 0x3d, 0xfe, 0x07, 0x3d, 0x29, 0x33, 0x4e, 0x09, 0x58,
+    0x01, 0x60, 0x8d, 0x60, 0x26, 0x2a, 0x16, 0x06, 0x04, 0x01, 0x54, 0x03,
+    0x07, 0x13, 0x18, 0x3c, 0x4f, 0x56, 0x3b, 0x4b, 0x4b, 0x4c, 0x02, 0x53,
+    0x31, 0x38, 0x49, 0x5c, 0x0d, 0xc3, 0xe6, 0x03, 0x86, 0x03, 0x57, 0x00,
+    0x48, 0x00, 0x4c, 0x00, 0x00, 0x12, 0xdb, 0x00, 0x13, 0x14, 0xbe, 0x00,
+    0x10, 0x27, 0x82, 0x03, 0x00, 0x56, 0x0f, 0x00, 0x1d, 0x02, 0x00, 0x3e,
+    0x1b, 0x11, 0x14, 0x5b, 0x07, 0x21, 0x33, 0x32, 0xc8, 0x03, 0x31, 0x37,
+    0x36, 0x35, 0xac, 0x03, 0x01, 0x4d, 0x0c, 0x30, 0x26, 0x27, 0x26, 0x03,
+    0x00, 0x10, 0x37, 0x08, 0x08, 0xf0, 0x83, 0x05, 0x35, 0x21, 0x15, 0x64,
+    0x76, 0x22, 0x58, 0x11, 0x0e, 0x01, 0xf8, 0x06, 0x05, 0x02, 0x1a, 0x39,
+    0x34, 0x26, 0x44, 0x10, 0x3e, 0x2d, 0x1e, 0x1a, 0x0a, 0x03, 0x04, 0x05,
+    0xfe, 0x32, 0x1a, 0x2d, 0x01, 0x7b, 0xfe, 0xa3, 0x04, 0x08, 0x0f, 0x35,
+    0x49, 0x86, 0x8d, 0x36, 0x37, 0x13, 0x12, 0x08, 0x05, 0x06, 0x54, 0x08,
+    0x07, 0x09, 0x15, 0x0f, 0x36, 0x30, 0x5a, 0x88, 0xaa, 0x3f, 0x30, 0x35,
+    0x0e, 0x0e, 0x0b, 0x01, 0x19, 0x17, 0x42, 0x01, 0xce, 0xfe, 0xf7, 0x02,
+    0x48, 0xb7, 0x58, 0x1a, 0x28, 0x1e, 0x2f, 0x7b, 0xf7, 0x46, 0x2a, 0x2f,
+    0x19, 0x04, 0x03, 0x5c, 0x03, 0x01, 0x09, 0x1b, 0x21, 0x2b, 0xca, 0x56,
+    0x24, 0x2d, 0x3f, 0xfe, 0xc3, 0x7a, 0x16, 0x16, 0x08, 0x0c, 0x03, 0x04,
+    0x03, 0x03, 0x0a, 0x09, 0x29, 0x23, 0x26, 0x02, 0x19, 0x3c, 0x23, 0x2f,
+    0x15, 0x0f, 0x0f, 0x03, 0x05, 0x02, 0x04, 0x04, 0x0f, 0x0e, 0x0e, 0x30,
+    0x26, 0x01, 0x85, 0x1e, 0x17, 0x3c, 0xad, 0x98, 0x98, 0xea, 0x00, 0x00,
+    0xc4, 0x08, 0x11, 0x89, 0x8c, 0x0b, 0x00, 0xc6, 0x28, 0x43, 0x37, 0x11,
+    0x33, 0x11, 0x41, 0x07, 0x40, 0x15, 0x1e, 0x02, 0x33, 0xd3, 0x00, 0x03,
+    0x51, 0x07, 0x03, 0xb8, 0x01, 0x30, 0x2e, 0x02, 0x35, 0xb3, 0x04, 0x19,
+    0x26, 0xe1, 0x08, 0xf0, 0x77, 0x7e, 0x5f, 0x59, 0x0a, 0x7f, 0x72, 0x44,
+    0x80, 0x8f, 0x30, 0x01, 0x0c, 0x1f, 0x25, 0x32, 0x25, 0x0d, 0x1d, 0x1c,
+    0x04, 0x0a, 0x01, 0x56, 0x04, 0x07, 0x06, 0x1a, 0x32, 0x2c, 0x18, 0x2e,
+    0x3d, 0x18, 0x36, 0x3a, 0x18, 0x48, 0x4a, 0x36, 0xaf, 0x46, 0x48, 0x23,
+    0x56, 0x2b, 0x33, 0x59, 0x25, 0x2e, 0x48, 0x01, 0x4f, 0x49, 0x01, 0xb4,
+    0xfe, 0x94, 0x09, 0x6c, 0x86, 0x3e, 0x8f, 0x7c, 0x27, 0xda, 0x1f, 0x1b,
+    0x07, 0x01, 0x02, 0x1c, 0x1f, 0x56, 0x0f, 0x17, 0x3e, 0x2b, 0x2e, 0x34,
+    0x19, 0x03, 0x01, 0x01, 0x01, 0x19, 0x39, 0x35, 0xa9, 0x36, 0x2f, 0x4d,
+    0xcb, 0x84, 0x8b, 0x70, 0x1b, 0x79, 0x68, 0xfd, 0x7e, 0x01, 0xde, 0x3e,
+    0x40, 0x36, 0x00, 0x06, 0x00, 0x24, 0xff, 0xd6, 0x03, 0xa2, 0x03, 0x2b,
+    0x00, 0x15, 0x00, 0x2a, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x40,
+    0x00, 0x00, 0x24, 0x37, 0x26, 0x26, 0x27, 0x41, 0x05, 0x10, 0x06, 0xe4,
+    0x11, 0x00, 0x38, 0x05, 0x00, 0x79, 0x02, 0x31, 0x24, 0x37, 0x11, 0x55,
+    0x05, 0x12, 0x11, 0xc2, 0x0f, 0x20, 0x23, 0x35, 0x6a, 0x02, 0x00, 0xa2,
+    0x01, 0x03, 0x8f, 0x03, 0x00, 0x04, 0x00, 0x10, 0x04, 0xe8, 0x13, 0xf0,
+    0x1e, 0x37, 0x23, 0x02, 0x47, 0x40, 0x29, 0x37, 0x10, 0x1a, 0x01, 0x6a,
+    0x17, 0x3a, 0x2c, 0x02, 0x42, 0x78, 0x39, 0x71, 0x40, 0x3f, 0x6e, 0x3e,
+    0xfe, 0x67, 0x41, 0x37, 0x01, 0xa8, 0x30, 0x14, 0x3c, 0x05, 0x27, 0x2e,
+    0x51, 0x4b, 0x96, 0x56, 0x0a, 0xf1, 0x13, 0x24, 0x19, 0x9e, 0x01, 0x00,
+    0xf0, 0x32, 0x01, 0xac, 0x27, 0x1d, 0x1e, 0x2c, 0x12, 0xad, 0x8d, 0x64,
+    0x4f, 0xd9, 0x90, 0x52, 0x52, 0x90, 0xcf, 0x54, 0x04, 0x01, 0x64, 0x5d,
+    0x4a, 0x65, 0x58, 0x5a, 0x65, 0x44, 0x73, 0x09, 0x02, 0x37, 0x50, 0x50,
+    0xfe, 0x04, 0x04, 0x0f, 0x56, 0x0b, 0x0a, 0xb1, 0xa0, 0x0f, 0x1d, 0x07,
+    0x57, 0x24, 0x03, 0x08, 0x05, 0x7d, 0x9b, 0xe9, 0x79, 0x79, 0xc6, 0x7c,
+    0x7c, 0x28, 0xab, 0x42, 0x46, 0xaa, 0x6f, 0x7a, 0x01, 0x72, 0x87, 0x00,
+    0x17, 0x03, 0x36, 0x02, 0xfb, 0xf2, 0x1e, 0x00, 0x36, 0x0a, 0x00, 0x04,
+    0x00, 0xf0, 0x0d, 0x03, 0x36, 0xfd, 0x51, 0x02, 0x54, 0xfe, 0x06, 0x02,
+    0xfb, 0xfd, 0x1c, 0x02, 0xe4, 0xfd, 0x72, 0x02, 0x37, 0xfd, 0xc9, 0x00,
+    0x03, 0x00, 0x31, 0xff, 0xe4, 0x03, 0x90, 0x7e, 0x28, 0x21, 0x00, 0x19,
+    0xb6, 0x1a, 0x05, 0x30, 0x07, 0x03, 0x95, 0x04, 0x00, 0xaf, 0x0e, 0x40,
+    0x17, 0x21, 0x11, 0x21, 0x6a, 0x04, 0xf0, 0x04, 0x03, 0x90, 0x7c, 0x2c,
+    0x39, 0x3f, 0x37, 0x20, 0x10, 0x32, 0x2d, 0x18, 0x0a, 0x17, 0x15, 0x08,
+    0xfd, 0x73, 0x68, 0xa8, 0x1d, 0xf0, 0x0e, 0x01, 0x3e, 0xeb, 0x03, 0x1b,
+    0x52, 0xfd, 0x97, 0x3d, 0x32, 0x06, 0x07, 0x01, 0x5a, 0x04, 0x01, 0x01,
+    0x08, 0x17, 0x19, 0x02, 0x54, 0x52, 0xd6, 0xfe, 0x62, 0x53, 0xfa, 0xfa,
+    0xd2, 0x03, 0xd2, 0x16, 0xff, 0xe5, 0x03, 0x7c, 0x03, 0x40, 0x00, 0x03,
+    0x00, 0x1a, 0x00, 0x1e, 0x92, 0x00, 0x55, 0x06, 0x37, 0x36, 0x35, 0x35,
+    0x21, 0x0c, 0x04, 0x00, 0x11, 0x20, 0x27, 0x25, 0xbd, 0x0a, 0xf7, 0x3d,
+    0x2f, 0xfd, 0xf4, 0xc1, 0x1b, 0x1a, 0xa4, 0xaf, 0xc0, 0x8a, 0x15, 0x7f,
+    0xb7, 0x9c, 0x8c, 0x02, 0x91, 0xfd, 0x6f, 0x02, 0x1e, 0x1e, 0x4a, 0x4d,
+    0x02, 0xc3, 0xfe, 0x9c, 0x01, 0x7a, 0xfe, 0x84, 0x01, 0x7c, 0xf5, 0x6d,
+    0x69, 0xbf, 0xef, 0x02, 0x0d, 0x10, 0x18, 0x58, 0x11, 0x10, 0x0d, 0x03,
+    0x76, 0x50, 0xaa, 0x76, 0x7c, 0x70, 0x33, 0x36, 0xdc, 0xdc, 0x00, 0x04,
+    0x00, 0x16, 0xff, 0xfa, 0x03, 0x59, 0x03, 0x5c, 0x00, 0x03, 0x00, 0x18,
+    0x00, 0x1c, 0x00, 0x20, 0x6e, 0x00, 0x03, 0x2d, 0x0b, 0x00, 0xcd, 0x00,
+    0x02, 0xf2, 0x06, 0x00, 0xb1, 0x11, 0x00, 0x70, 0x00, 0xf1, 0x33, 0x46,
+    0xfd, 0xc6, 0xaa, 0x1b, 0x1c, 0x01, 0x42, 0x06, 0x08, 0x11, 0x58, 0x06,
+    0x15, 0x0a, 0x01, 0x20, 0xfd, 0x98, 0x03, 0x1b, 0x1c, 0x51, 0x50, 0x02,
+    0xec, 0xfd, 0xef, 0x01, 0xfd, 0xfe, 0x75, 0x01, 0x69, 0xfe, 0x91, 0x01,
+    0x6f, 0xce, 0x63, 0x64, 0xa3, 0xef, 0x11, 0x1a, 0x2a, 0x13, 0x0e, 0x3a,
+    0x20, 0xfe, 0xdd, 0x96, 0x5c, 0x68, 0x7d, 0x32, 0x01, 0xf5, 0x84, 0x84,
+    0xfe, 0x28, 0xd0, 0xd0, 0x00, 0x3e, 0x02, 0xf1, 0x02, 0xf7, 0x03, 0x96,
     0x03, 0x31, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3f, 0x00, 0x43,
-    0x00, 0x47, 0x00, 0x00, 0x01, 0x26, 0x27, 0x23, 0x06, 0x07, 0x06, 0x07,
-    0x33, 0x11, 0x21, 0x35, 0x07, 0x27, 0x36, 0x3f, 0x01, 0x21, 0x35, 0x21,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x23,
-    0x35, 0x21, 0x15, 0x23, 0x30, 0x17, 0x16, 0x17, 0x07, 0x33, 0x15, 0x21,
-    0x1e, 0x01, 0x17, 0x07, 0x27, 0x15, 0x21, 0x11, 0x01, 0x21, 0x15, 0x21,
-    0x37, 0x35, 0x23, 0x15, 0x13, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15,
-    0x13, 0x35, 0x23, 0x15, 0x02, 0xd6, 0x97, 0x58, 0x1e, 0x19, 0x21, 0x39,
+    0x00, 0x47, 0xb4, 0x0a, 0x01, 0x79, 0x07, 0x40, 0x33, 0x11, 0x21, 0x35,
+    0xb6, 0x04, 0x00, 0xf6, 0x05, 0x02, 0xbb, 0x06, 0x01, 0x26, 0x0a, 0x01,
+    0x44, 0x02, 0x10, 0x30, 0x8e, 0x07, 0x12, 0x33, 0x4f, 0x0a, 0x40, 0x27,
+    0x15, 0x21, 0x11, 0x44, 0x12, 0x00, 0x40, 0x02, 0x04, 0x8b, 0x08, 0x00,
+    0x08, 0x00, 0xf2, 0x6c, 0x02, 0xd6, 0x97, 0x58, 0x1e, 0x19, 0x21, 0x39,
     0x80, 0xde, 0xfe, 0xbe, 0x2d, 0x21, 0xd9, 0x4f, 0x09, 0xfe, 0xf3, 0x01,
     0x4b, 0x14, 0x0a, 0x59, 0x0b, 0x0d, 0xa7, 0x08, 0x0b, 0x11, 0x1d, 0x21,
     0x76, 0x01, 0x4b, 0xb8, 0x21, 0x13, 0x13, 0x1b, 0xb1, 0xfe, 0xe0, 0x31,
@@ -1018,284 +788,234 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x07, 0x46, 0x23, 0x2b, 0x0e, 0x25, 0x1b, 0x09, 0x07, 0x10, 0x15, 0x20,
     0xf6, 0xf6, 0x1b, 0x0e, 0x13, 0x19, 0x46, 0x23, 0x33, 0x12, 0x50, 0x0a,
     0xfb, 0x01, 0x1b, 0x02, 0x1f, 0xf6, 0x44, 0x6e, 0x6e, 0xfd, 0xbd, 0x91,
-    0x91, 0x91, 0x91, 0x02, 0x43, 0x6e, 0x6e, 0x00, 0x00, 0x02, 0x00, 0x11,
-    0xff, 0xe6, 0x03, 0x79, 0x03, 0x5c, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x00,
-    0x25, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x21, 0x15, 0x21, 0x35, 0x02, 0x37, 0x36, 0x37, 0x23, 0x35, 0x21, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x21, 0x06, 0x07, 0x06, 0x07, 0x11,
-    0x23, 0x11, 0x06, 0x07, 0x27, 0x02, 0x21, 0xd7, 0xd7, 0x55, 0xde, 0xde,
-    0x01, 0x02, 0xfd, 0xac, 0x95, 0x58, 0x28, 0x15, 0xef, 0x01, 0x15, 0x14,
-    0x14, 0x59, 0x11, 0x11, 0x01, 0xd0, 0xfe, 0x0e, 0x28, 0x2d, 0x0e, 0x1e,
-    0x56, 0x32, 0x30, 0x3d, 0x63, 0xfc, 0x53, 0xa3, 0xa3, 0x53, 0xfc, 0x51,
-    0x51, 0x01, 0x39, 0x8d, 0x41, 0x2d, 0x54, 0x30, 0x41, 0x12, 0x34, 0x2b,
-    0x54, 0x55, 0x4b, 0x16, 0x2c, 0xfe, 0x31, 0x01, 0x64, 0x37, 0x2c, 0x45,
-    0x00, 0x01, 0x00, 0x21, 0xff, 0xf1, 0x03, 0x91, 0x03, 0x4f, 0x00, 0x54,
-    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x15, 0x37, 0x35, 0x33, 0x15,
-    0x37, 0x35, 0x33, 0x15, 0x37, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x2f,
-    0x01, 0x17, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x07, 0x11,
-    0x23, 0x11, 0x07, 0x11, 0x14, 0x1e, 0x01, 0x17, 0x16, 0x33, 0x37, 0x3e,
-    0x02, 0x37, 0x36, 0x35, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x2e, 0x02, 0x35, 0x11, 0x07, 0x27, 0x23, 0x11, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x11, 0x23, 0x35, 0xa0,
-    0x52, 0x5f, 0x34, 0x52, 0x66, 0x51, 0xc7, 0x03, 0x08, 0x03, 0x0e, 0x20,
-    0x20, 0x24, 0x27, 0x10, 0x14, 0x1a, 0x09, 0x11, 0x0e, 0x05, 0x02, 0x04,
-    0x02, 0x73, 0x51, 0x66, 0x0a, 0x1e, 0x20, 0x14, 0x4c, 0x5f, 0x28, 0x1f,
-    0x0e, 0x04, 0x06, 0x54, 0x01, 0x08, 0x06, 0x19, 0x35, 0x35, 0x32, 0x48,
-    0x4d, 0x2e, 0x36, 0x39, 0x16, 0x3a, 0x14, 0x45, 0x48, 0x1f, 0x0f, 0x3f,
-    0x51, 0x4f, 0x4c, 0x1c, 0x3a, 0x45, 0x6b, 0x02, 0x4e, 0xef, 0xef, 0x48,
-    0x12, 0xdf, 0xc3, 0x24, 0xf7, 0xdc, 0x45, 0xec, 0x72, 0x27, 0x29, 0x14,
-    0x05, 0x07, 0x02, 0x57, 0x01, 0x02, 0x06, 0x13, 0x16, 0x5f, 0x76, 0x28,
-    0xfe, 0x7d, 0x01, 0x67, 0x23, 0xfe, 0xb6, 0x21, 0x1f, 0x0d, 0x01, 0x01,
-    0x01, 0x03, 0x09, 0x19, 0x1f, 0x2e, 0x1f, 0x17, 0x2b, 0x34, 0x2b, 0x2b,
-    0x13, 0x04, 0x02, 0x02, 0x04, 0x1a, 0x34, 0x2e, 0x01, 0x4d, 0x14, 0x4f,
-    0xfe, 0xc8, 0x1e, 0x0f, 0x52, 0x1e, 0x20, 0x1e, 0x16, 0x4c, 0x11, 0x1a,
-    0x01, 0x58, 0x53, 0x00, 0x00, 0x02, 0x00, 0x22, 0x00, 0x09, 0x03, 0x8c,
-    0x03, 0x51, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x00, 0x25, 0x11, 0x33, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x35,
-    0x26, 0x37, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x11, 0x36, 0x37, 0x1f, 0x01, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x8c,
-    0x56, 0x7c, 0x5a, 0xb4, 0xb4, 0xd4, 0xfd, 0x81, 0xae, 0x42, 0x66, 0x66,
-    0x57, 0x68, 0x68, 0x38, 0x23, 0x06, 0x0c, 0x3b, 0x5c, 0x6c, 0x2c, 0x14,
-    0x5f, 0x02, 0x3c, 0xfd, 0xc4, 0x02, 0xf2, 0xfe, 0xeb, 0x55, 0xfe, 0x78,
-    0x56, 0x56, 0x42, 0x16, 0x01, 0x57, 0x58, 0xe4, 0xe4, 0x58, 0xfe, 0xc7,
-    0x14, 0x11, 0x1d, 0x38, 0x19, 0x1f, 0x24, 0x09, 0x54, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x23, 0xff, 0xd2, 0x03, 0x8b, 0x03, 0x5b, 0x00, 0x03,
-    0x00, 0x31, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21,
-    0x26, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x21, 0x06, 0x07,
-    0x21, 0x11, 0x21, 0x17, 0x06, 0x07, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17,
-    0x07, 0x2e, 0x01, 0x27, 0x0e, 0x01, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27,
-    0x06, 0x07, 0x27, 0x36, 0x37, 0x23, 0x11, 0x06, 0x07, 0x27, 0x05, 0x35,
-    0x21, 0x15, 0x16, 0x17, 0x36, 0x37, 0x21, 0x01, 0x01, 0x01, 0xc3, 0xfe,
-    0x3d, 0x99, 0x33, 0x3e, 0x21, 0x52, 0x0d, 0x13, 0x02, 0x40, 0xfd, 0x92,
-    0x1c, 0x10, 0x02, 0x49, 0xfe, 0x2b, 0x2b, 0x0d, 0x10, 0x01, 0xdf, 0x68,
-    0x6d, 0x76, 0xb7, 0x1b, 0x69, 0xc6, 0x4c, 0x51, 0xc4, 0x83, 0x1c, 0xc0,
-    0x8c, 0x51, 0x4b, 0x40, 0x53, 0x30, 0x95, 0x58, 0x70, 0x26, 0x27, 0x3b,
-    0x02, 0xa1, 0xfe, 0x3d, 0x8f, 0x62, 0x6f, 0x52, 0xfe, 0x8a, 0x02, 0x0a,
-    0x39, 0x40, 0x43, 0x54, 0x41, 0x1b, 0x19, 0x20, 0x48, 0x28, 0x13, 0xfe,
-    0xce, 0x16, 0x12, 0x11, 0x42, 0x4f, 0x2f, 0x22, 0x13, 0x4c, 0x0f, 0x2f,
-    0x1c, 0x1d, 0x2d, 0x16, 0x48, 0x1b, 0x27, 0x26, 0x35, 0x36, 0x2f, 0x3f,
-    0x53, 0x6e, 0x01, 0x04, 0x2b, 0x24, 0x3c, 0xb0, 0x3a, 0x3a, 0xf1, 0x26,
-    0x28, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x31, 0xff, 0xda, 0x03, 0x8f,
-    0x03, 0x53, 0x00, 0x1a, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x1e, 0x01, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x21, 0x35, 0x01, 0xae, 0x5d,
-    0x01, 0x6b, 0xfe, 0x93, 0x22, 0xbd, 0xa7, 0x38, 0x89, 0xba, 0x30, 0x1e,
-    0x38, 0x6b, 0xb3, 0x3f, 0x58, 0x94, 0x33, 0x50, 0x0c, 0xfe, 0x9b, 0x02,
-    0x6f, 0xe4, 0xe4, 0x56, 0x07, 0x99, 0xed, 0x5f, 0x52, 0x54, 0xce, 0x75,
-    0x51, 0x4e, 0x8e, 0x6b, 0x4e, 0x31, 0x7f, 0x4a, 0x73, 0x84, 0x56, 0x00,
-    0x00, 0x01, 0x00, 0x3c, 0xff, 0xca, 0x03, 0x87, 0x03, 0x4e, 0x00, 0x29,
-    0x00, 0x00, 0x01, 0x37, 0x23, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x17,
-    0x06, 0x07, 0x33, 0x37, 0x33, 0x07, 0x21, 0x15, 0x21, 0x07, 0x15, 0x21,
-    0x15, 0x21, 0x16, 0x17, 0x16, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x21, 0x35, 0x01, 0xb5, 0x02, 0xc3,
-    0x28, 0x26, 0x4e, 0x2d, 0x48, 0x16, 0x57, 0x10, 0x14, 0xa2, 0x02, 0x5d,
-    0x02, 0x01, 0x33, 0xfe, 0xcd, 0x02, 0x01, 0x62, 0xfe, 0xa7, 0x26, 0x43,
-    0x5a, 0xa8, 0x31, 0x89, 0xb5, 0x33, 0x15, 0x1e, 0x5d, 0xe6, 0x33, 0x9b,
-    0xb2, 0x1d, 0xfe, 0xa0, 0x01, 0xb5, 0xa4, 0x57, 0x3a, 0x2e, 0x45, 0xa6,
-    0x51, 0x17, 0x35, 0x38, 0xa0, 0xa0, 0x55, 0x9e, 0x06, 0x57, 0x5e, 0x43,
-    0x59, 0x3e, 0x5a, 0x3b, 0x97, 0x66, 0x2a, 0x2a, 0x7f, 0x67, 0x55, 0x42,
-    0x9d, 0x60, 0x57, 0x00, 0x00, 0x02, 0x00, 0x37, 0xff, 0xe2, 0x03, 0x84,
-    0x03, 0x57, 0x00, 0x10, 0x00, 0x31, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x21,
-    0x15, 0x23, 0x35, 0x21, 0x15, 0x23, 0x35, 0x21, 0x26, 0x27, 0x26, 0x27,
-    0x37, 0x01, 0x21, 0x35, 0x36, 0x37, 0x21, 0x35, 0x21, 0x15, 0x06, 0x07,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x22,
-    0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x21, 0x02, 0x01,
-    0x12, 0x0a, 0x01, 0x49, 0x58, 0xfd, 0xa1, 0x58, 0x01, 0x66, 0x01, 0x07,
-    0x03, 0x16, 0x5a, 0xfe, 0x41, 0x01, 0x80, 0x60, 0x48, 0xfe, 0x72, 0x02,
-    0x1a, 0x75, 0x66, 0x01, 0x74, 0xfe, 0x8c, 0x11, 0x2b, 0x2a, 0x33, 0x2d,
-    0x16, 0x0c, 0x11, 0x3c, 0x19, 0x25, 0x1d, 0x09, 0xfe, 0x80, 0x03, 0x3e,
-    0x3b, 0x1c, 0xd5, 0x82, 0x81, 0xd4, 0x04, 0x15, 0x08, 0x39, 0x16, 0xfd,
-    0xf0, 0x35, 0x2f, 0x39, 0x50, 0x50, 0x59, 0x34, 0x10, 0x56, 0x95, 0x2a,
-    0x2e, 0x17, 0x05, 0x06, 0x01, 0x5b, 0x04, 0x06, 0x16, 0x1c, 0x7f, 0x00,
-    0x00, 0x03, 0x00, 0x3f, 0xff, 0xe1, 0x03, 0x80, 0x03, 0x59, 0x00, 0x18,
-    0x00, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x2f, 0x01, 0x16, 0x33,
-    0x32, 0x3e, 0x01, 0x35, 0x11, 0x21, 0x35, 0x13, 0x21, 0x2f, 0x01, 0x37,
-    0x1f, 0x01, 0x21, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23, 0x17, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x02, 0x69, 0x59, 0xbe, 0xbe,
-    0x13, 0x2f, 0x2e, 0x40, 0x30, 0x20, 0x13, 0x36, 0x35, 0x28, 0x1d, 0x0a,
-    0xfd, 0xd6, 0x20, 0x01, 0x60, 0x09, 0x17, 0x59, 0x1d, 0x0b, 0x01, 0x42,
-    0x59, 0xfd, 0xad, 0x57, 0x99, 0x2a, 0x38, 0x3d, 0x27, 0x42, 0x26, 0x3c,
-    0x23, 0x3c, 0x01, 0xe8, 0x81, 0x81, 0x55, 0xfe, 0xce, 0x2d, 0x31, 0x18,
-    0x04, 0x06, 0x01, 0x61, 0x03, 0x06, 0x17, 0x20, 0x01, 0x16, 0x55, 0x01,
-    0x08, 0x19, 0x3c, 0x14, 0x49, 0x20, 0xc7, 0x71, 0x73, 0xa1, 0x24, 0x38,
-    0x3d, 0x30, 0x42, 0x31, 0x3f, 0x25, 0x36, 0x00, 0x00, 0x03, 0x00, 0x3a,
+    0x91, 0x91, 0x91, 0x02, 0x43, 0x6e, 0x6e, 0x10, 0x0d, 0x94, 0xe6, 0x03,
+    0x79, 0x03, 0x5c, 0x00, 0x0f, 0x00, 0x28, 0x10, 0x0d, 0x19, 0x33, 0x02,
+    0x0d, 0x13, 0x23, 0xd7, 0x00, 0x03, 0xc7, 0x01, 0x03, 0x0e, 0x0d, 0xf1,
+    0x42, 0x21, 0xd7, 0xd7, 0x55, 0xde, 0xde, 0x01, 0x02, 0xfd, 0xac, 0x95,
+    0x58, 0x28, 0x15, 0xef, 0x01, 0x15, 0x14, 0x14, 0x59, 0x11, 0x11, 0x01,
+    0xd0, 0xfe, 0x0e, 0x28, 0x2d, 0x0e, 0x1e, 0x56, 0x32, 0x30, 0x3d, 0x63,
+    0xfc, 0x53, 0xa3, 0xa3, 0x53, 0xfc, 0x51, 0x51, 0x01, 0x39, 0x8d, 0x41,
+    0x2d, 0x54, 0x30, 0x41, 0x12, 0x34, 0x2b, 0x54, 0x55, 0x4b, 0x16, 0x2c,
+    0xfe, 0x31, 0x01, 0x64, 0x37, 0x2c, 0x45, 0x00, 0x01, 0x00, 0x21, 0xff,
+    0xf1, 0x03, 0x91, 0x03, 0x4f, 0x00, 0x54, 0x00, 0x00, 0x13, 0x76, 0x00,
+    0x23, 0x37, 0x35, 0x04, 0x00, 0x02, 0x3a, 0x04, 0x34, 0x27, 0x27, 0x17,
+    0xf1, 0x05, 0x00, 0x78, 0x00, 0x40, 0x07, 0x11, 0x14, 0x16, 0x32, 0x05,
+    0x01, 0x4f, 0x07, 0x19, 0x35, 0x5e, 0x04, 0x24, 0x11, 0x07, 0x85, 0x0e,
+    0x00, 0x42, 0x06, 0x00, 0xc2, 0x03, 0xf1, 0x85, 0xa0, 0x52, 0x5f, 0x34,
+    0x52, 0x66, 0x51, 0xc7, 0x03, 0x08, 0x03, 0x0e, 0x20, 0x20, 0x24, 0x27,
+    0x10, 0x14, 0x1a, 0x09, 0x11, 0x0e, 0x05, 0x02, 0x04, 0x02, 0x73, 0x51,
+    0x66, 0x0a, 0x1e, 0x20, 0x14, 0x4c, 0x5f, 0x28, 0x1f, 0x0e, 0x04, 0x06,
+    0x54, 0x01, 0x08, 0x06, 0x19, 0x35, 0x35, 0x32, 0x48, 0x4d, 0x2e, 0x36,
+    0x39, 0x16, 0x3a, 0x14, 0x45, 0x48, 0x1f, 0x0f, 0x3f, 0x51, 0x4f, 0x4c,
+    0x1c, 0x3a, 0x45, 0x6b, 0x02, 0x4e, 0xef, 0xef, 0x48, 0x12, 0xdf, 0xc3,
+    0x24, 0xf7, 0xdc, 0x45, 0xec, 0x72, 0x27, 0x29, 0x14, 0x05, 0x07, 0x02,
+    0x57, 0x01, 0x02, 0x06, 0x13, 0x16, 0x5f, 0x76, 0x28, 0xfe, 0x7d, 0x01,
+    0x67, 0x23, 0xfe, 0xb6, 0x21, 0x1f, 0x0d, 0x01, 0x01, 0x01, 0x03, 0x09,
+    0x19, 0x1f, 0x2e, 0x1f, 0x17, 0x2b, 0x34, 0x2b, 0x2b, 0x13, 0x04, 0x02,
+    0x02, 0x04, 0x1a, 0x34, 0x2e, 0x01, 0x4d, 0x14, 0x4f, 0xfe, 0xc8, 0x1e,
+    0x0f, 0x52, 0x1e, 0x20, 0x1e, 0x16, 0x4c, 0x11, 0x1a, 0x01, 0x58, 0x53,
+    0x50, 0x1f, 0x80, 0x00, 0x09, 0x03, 0x8c, 0x03, 0x51, 0x00, 0x0f, 0x4e,
+    0x1c, 0x11, 0x25, 0xce, 0x0b, 0x02, 0xca, 0x0a, 0x20, 0x33, 0x15, 0x35,
+    0x11, 0x06, 0xc1, 0x15, 0x00, 0xcf, 0x00, 0x03, 0xbf, 0x09, 0xf0, 0x2b,
+    0x8c, 0x56, 0x7c, 0x5a, 0xb4, 0xb4, 0xd4, 0xfd, 0x81, 0xae, 0x42, 0x66,
+    0x66, 0x57, 0x68, 0x68, 0x38, 0x23, 0x06, 0x0c, 0x3b, 0x5c, 0x6c, 0x2c,
+    0x14, 0x5f, 0x02, 0x3c, 0xfd, 0xc4, 0x02, 0xf2, 0xfe, 0xeb, 0x55, 0xfe,
+    0x78, 0x56, 0x56, 0x42, 0x16, 0x01, 0x57, 0x58, 0xe4, 0xe4, 0x58, 0xfe,
+    0xc7, 0x14, 0x11, 0x1d, 0x38, 0x19, 0x1f, 0x24, 0x09, 0x54, 0xe0, 0x0f,
+    0x91, 0x23, 0xff, 0xd2, 0x03, 0x8b, 0x03, 0x5b, 0x00, 0x03, 0xfa, 0x04,
+    0x30, 0x3a, 0x00, 0x00, 0xcf, 0x14, 0x14, 0x26, 0x7a, 0x07, 0x02, 0x8d,
+    0x06, 0x16, 0x17, 0x42, 0x11, 0x00, 0x8d, 0x1c, 0x05, 0x86, 0x07, 0x00,
+    0x4b, 0x0b, 0x03, 0x85, 0x06, 0x11, 0x16, 0x63, 0x12, 0xf2, 0x6f, 0x01,
+    0x01, 0xc3, 0xfe, 0x3d, 0x99, 0x33, 0x3e, 0x21, 0x52, 0x0d, 0x13, 0x02,
+    0x40, 0xfd, 0x92, 0x1c, 0x10, 0x02, 0x49, 0xfe, 0x2b, 0x2b, 0x0d, 0x10,
+    0x01, 0xdf, 0x68, 0x6d, 0x76, 0xb7, 0x1b, 0x69, 0xc6, 0x4c, 0x51, 0xc4,
+    0x83, 0x1c, 0xc0, 0x8c, 0x51, 0x4b, 0x40, 0x53, 0x30, 0x95, 0x58, 0x70,
+    0x26, 0x27, 0x3b, 0x02, 0xa1, 0xfe, 0x3d, 0x8f, 0x62, 0x6f, 0x52, 0xfe,
+    0x8a, 0x02, 0x0a, 0x39, 0x40, 0x43, 0x54, 0x41, 0x1b, 0x19, 0x20, 0x48,
+    0x28, 0x13, 0xfe, 0xce, 0x16, 0x12, 0x11, 0x42, 0x4f, 0x2f, 0x22, 0x13,
+    0x4c, 0x0f, 0x2f, 0x1c, 0x1d, 0x2d, 0x16, 0x48, 0x1b, 0x27, 0x26, 0x35,
+    0x36, 0x2f, 0x3f, 0x53, 0x6e, 0x01, 0x04, 0x2b, 0x24, 0x3c, 0xb0, 0x3a,
+    0x3a, 0xf1, 0x26, 0x28, 0x33, 0x00, 0x01, 0x00, 0x31, 0xff, 0xda, 0x03,
+    0x8f, 0x03, 0x53, 0x00, 0x1a, 0x5e, 0x14, 0x00, 0x78, 0x13, 0x03, 0x93,
+    0x0e, 0x08, 0xa2, 0x0d, 0xf1, 0x24, 0x01, 0xae, 0x5d, 0x01, 0x6b, 0xfe,
+    0x93, 0x22, 0xbd, 0xa7, 0x38, 0x89, 0xba, 0x30, 0x1e, 0x38, 0x6b, 0xb3,
+    0x3f, 0x58, 0x94, 0x33, 0x50, 0x0c, 0xfe, 0x9b, 0x02, 0x6f, 0xe4, 0xe4,
+    0x56, 0x07, 0x99, 0xed, 0x5f, 0x52, 0x54, 0xce, 0x75, 0x51, 0x4e, 0x8e,
+    0x6b, 0x4e, 0x31, 0x7f, 0x4a, 0x73, 0x84, 0x56, 0x00, 0xd4, 0x1e, 0x51,
+    0xca, 0x03, 0x87, 0x03, 0x4e, 0x84, 0x0f, 0x11, 0x37, 0x7f, 0x0a, 0x02,
+    0xc5, 0x03, 0x21, 0x37, 0x33, 0x5e, 0x12, 0x01, 0x0d, 0x0e, 0x19, 0x17,
+    0x6d, 0x00, 0x00, 0x6b, 0x00, 0xf0, 0x01, 0xb5, 0x02, 0xc3, 0x28, 0x26,
+    0x4e, 0x2d, 0x48, 0x16, 0x57, 0x10, 0x14, 0xa2, 0x02, 0x5d, 0x02, 0xb4,
+    0x15, 0xf0, 0x2b, 0x02, 0x01, 0x62, 0xfe, 0xa7, 0x26, 0x43, 0x5a, 0xa8,
+    0x31, 0x89, 0xb5, 0x33, 0x15, 0x1e, 0x5d, 0xe6, 0x33, 0x9b, 0xb2, 0x1d,
+    0xfe, 0xa0, 0x01, 0xb5, 0xa4, 0x57, 0x3a, 0x2e, 0x45, 0xa6, 0x51, 0x17,
+    0x35, 0x38, 0xa0, 0xa0, 0x55, 0x9e, 0x06, 0x57, 0x5e, 0x43, 0x59, 0x3e,
+    0x5a, 0x3b, 0x97, 0x66, 0x2a, 0x2a, 0x7f, 0x67, 0x55, 0x42, 0x9d, 0x60,
+    0x57, 0x18, 0x02, 0xb0, 0x37, 0xff, 0xe2, 0x03, 0x84, 0x03, 0x57, 0x00,
+    0x10, 0x00, 0x31, 0x96, 0x0e, 0x51, 0x17, 0x21, 0x15, 0x23, 0x35, 0x04,
+    0x00, 0x02, 0x74, 0x0e, 0x21, 0x21, 0x35, 0x57, 0x0a, 0x13, 0x15, 0x54,
+    0x16, 0x01, 0x08, 0x0a, 0x04, 0x11, 0x09, 0x00, 0x00, 0x05, 0xf0, 0x46,
+    0x02, 0x01, 0x12, 0x0a, 0x01, 0x49, 0x58, 0xfd, 0xa1, 0x58, 0x01, 0x66,
+    0x01, 0x07, 0x03, 0x16, 0x5a, 0xfe, 0x41, 0x01, 0x80, 0x60, 0x48, 0xfe,
+    0x72, 0x02, 0x1a, 0x75, 0x66, 0x01, 0x74, 0xfe, 0x8c, 0x11, 0x2b, 0x2a,
+    0x33, 0x2d, 0x16, 0x0c, 0x11, 0x3c, 0x19, 0x25, 0x1d, 0x09, 0xfe, 0x80,
+    0x03, 0x3e, 0x3b, 0x1c, 0xd5, 0x82, 0x81, 0xd4, 0x04, 0x15, 0x08, 0x39,
+    0x16, 0xfd, 0xf0, 0x35, 0x2f, 0x39, 0x50, 0x50, 0x59, 0x34, 0x10, 0x56,
+    0x95, 0x2a, 0x2e, 0x17, 0x05, 0x06, 0x01, 0x5b, 0x04, 0x06, 0x16, 0x1c,
+    0x7f, 0xe0, 0x05, 0xd2, 0x3f, 0xff, 0xe1, 0x03, 0x80, 0x03, 0x59, 0x00,
+    0x18, 0x00, 0x26, 0x00, 0x30, 0x80, 0x01, 0x02, 0x78, 0x0d, 0x05, 0x49,
+    0x06, 0x20, 0x36, 0x36, 0x48, 0x06, 0x55, 0x13, 0x21, 0x27, 0x27, 0x37,
+    0xb7, 0x00, 0x15, 0x17, 0x49, 0x0e, 0xf0, 0x45, 0x02, 0x69, 0x59, 0xbe,
+    0xbe, 0x13, 0x2f, 0x2e, 0x40, 0x30, 0x20, 0x13, 0x36, 0x35, 0x28, 0x1d,
+    0x0a, 0xfd, 0xd6, 0x20, 0x01, 0x60, 0x09, 0x17, 0x59, 0x1d, 0x0b, 0x01,
+    0x42, 0x59, 0xfd, 0xad, 0x57, 0x99, 0x2a, 0x38, 0x3d, 0x27, 0x42, 0x26,
+    0x3c, 0x23, 0x3c, 0x01, 0xe8, 0x81, 0x81, 0x55, 0xfe, 0xce, 0x2d, 0x31,
+    0x18, 0x04, 0x06, 0x01, 0x61, 0x03, 0x06, 0x17, 0x20, 0x01, 0x16, 0x55,
+    0x01, 0x08, 0x19, 0x3c, 0x14, 0x49, 0x20, 0xc7, 0x71, 0x73, 0xa1, 0x24,
+    0x38, 0x3d, 0x30, 0x42, 0x31, 0x3f, 0x25, 0x36, 0x98, 0x00, 0xda, 0x3a,
     0xff, 0xc6, 0x03, 0x7e, 0x03, 0x57, 0x00, 0x0f, 0x00, 0x41, 0x00, 0x45,
-    0x00, 0x00, 0x00, 0x1f, 0x01, 0x21, 0x15, 0x23, 0x35, 0x21, 0x15, 0x23,
-    0x35, 0x21, 0x27, 0x26, 0x27, 0x37, 0x00, 0x36, 0x37, 0x3e, 0x01, 0x37,
-    0x35, 0x23, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x1e, 0x01, 0x17, 0x16,
-    0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x2e, 0x02, 0x3d, 0x01, 0x23, 0x07, 0x0e, 0x01,
-    0x07, 0x0e, 0x01, 0x07, 0x27, 0x13, 0x21, 0x15, 0x21, 0x02, 0x04, 0x0d,
-    0x0b, 0x01, 0x4b, 0x54, 0xfd, 0x96, 0x55, 0x01, 0x6b, 0x07, 0x0e, 0x0b,
-    0x57, 0xfe, 0x8e, 0x5b, 0x1a, 0x16, 0x16, 0x03, 0xdc, 0x03, 0x24, 0xfe,
-    0xff, 0x06, 0x12, 0x14, 0x39, 0x21, 0x13, 0x12, 0x08, 0x03, 0x06, 0x01,
-    0x52, 0x02, 0x05, 0x06, 0x16, 0x2b, 0x27, 0x28, 0x1d, 0x1c, 0x28, 0x2b,
-    0x2d, 0x11, 0x94, 0x01, 0x03, 0x1f, 0x1f, 0x20, 0x69, 0x4e, 0x30, 0x8c,
-    0x02, 0x2d, 0xfd, 0xd3, 0x03, 0x39, 0x2b, 0x21, 0xca, 0x7a, 0x7b, 0xcb,
-    0x16, 0x29, 0x1a, 0x11, 0xfc, 0xd7, 0x32, 0x1f, 0x1c, 0x48, 0x32, 0x0c,
-    0x52, 0x52, 0xa8, 0x1a, 0x18, 0x0a, 0x02, 0x02, 0x01, 0x02, 0x08, 0x17,
-    0x1a, 0x33, 0x19, 0x17, 0x32, 0x22, 0x29, 0x2c, 0x13, 0x03, 0x02, 0x02,
-    0x02, 0x17, 0x34, 0x31, 0xb8, 0x12, 0x3f, 0x61, 0x25, 0x28, 0x40, 0x1c,
-    0x51, 0x02, 0x1a, 0x4e, 0x00, 0x03, 0x00, 0x55, 0xff, 0xed, 0x03, 0x69,
-    0x03, 0x57, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x00, 0x01, 0x15,
-    0x21, 0x15, 0x21, 0x11, 0x21, 0x11, 0x23, 0x35, 0x21, 0x2f, 0x01, 0x37,
-    0x16, 0x1f, 0x01, 0x21, 0x15, 0x23, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21,
-    0x15, 0x01, 0x35, 0x21, 0x15, 0x03, 0x05, 0xfe, 0x02, 0x02, 0x18, 0xfd,
-    0x91, 0x5b, 0x01, 0x63, 0x05, 0x14, 0x5b, 0x09, 0x10, 0x07, 0x01, 0x4f,
-    0x5a, 0xfd, 0xa1, 0x02, 0x17, 0xfe, 0x40, 0x01, 0xa6, 0xfe, 0x5a, 0x02,
-    0x52, 0xf4, 0x54, 0xfe, 0xe3, 0x02, 0x51, 0xb7, 0x12, 0x3f, 0x11, 0x16,
-    0x33, 0x19, 0xb7, 0x67, 0x53, 0xfd, 0xe7, 0x84, 0x84, 0x01, 0x71, 0x5c,
-    0x5c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x29, 0xff, 0xef, 0x03, 0x8e,
-    0x03, 0x5c, 0x00, 0x0b, 0x00, 0x36, 0x00, 0x41, 0x00, 0x5e, 0x00, 0x68,
-    0x00, 0x00, 0x37, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
-    0x21, 0x35, 0x36, 0x37, 0x35, 0x33, 0x15, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x3e, 0x01,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x3f, 0x01, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x13, 0x21, 0x27, 0x26, 0x27,
-    0x37, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x21, 0x15, 0x23, 0x35, 0x21, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x23, 0x15, 0x23,
-    0x05, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0xeb, 0xca,
-    0x53, 0xca, 0x54, 0xfd, 0x71, 0x14, 0x69, 0x53, 0x34, 0x0d, 0x8e, 0x78,
-    0x35, 0x78, 0x9d, 0x1f, 0x34, 0x0d, 0x1b, 0x2c, 0x25, 0x1b, 0x2c, 0x24,
-    0x1b, 0x05, 0x08, 0x04, 0x51, 0x08, 0x04, 0x08, 0x1d, 0x31, 0x2d, 0x2e,
-    0x36, 0x36, 0x2e, 0x3b, 0x18, 0x0b, 0x08, 0x5b, 0x7c, 0x1f, 0x33, 0x29,
-    0x0f, 0x1e, 0x0c, 0x41, 0x21, 0x1d, 0x20, 0x27, 0x3c, 0x1f, 0x01, 0x5e,
-    0x07, 0x12, 0x05, 0x4f, 0x0b, 0x0d, 0x05, 0x07, 0x02, 0x01, 0x53, 0x56,
-    0xfe, 0x9c, 0x1d, 0x23, 0x2a, 0x1e, 0x2f, 0x21, 0x27, 0x2b, 0x1e, 0x26,
-    0xe6, 0x56, 0x02, 0x9d, 0x1a, 0x37, 0x2b, 0x18, 0x39, 0x11, 0x2e, 0x21,
-    0x2f, 0xd9, 0x9a, 0xb6, 0xb6, 0xa0, 0xf0, 0xea, 0x8d, 0x29, 0xd8, 0xb5,
-    0x19, 0x07, 0x49, 0x75, 0x39, 0x75, 0x54, 0x11, 0x17, 0x08, 0x02, 0x02,
-    0x02, 0x02, 0x10, 0x18, 0x21, 0x28, 0x1b, 0x38, 0x14, 0x25, 0x25, 0x0f,
-    0x02, 0x02, 0x02, 0x03, 0x15, 0x08, 0x12, 0x25, 0x24, 0x4c, 0x93, 0x33,
-    0x15, 0x29, 0x16, 0x29, 0x35, 0x28, 0x2a, 0x29, 0x35, 0x01, 0x47, 0x12,
-    0x2e, 0x0a, 0x13, 0x15, 0x24, 0x0d, 0x11, 0x06, 0xb4, 0x67, 0x12, 0x1a,
-    0x1e, 0x1a, 0x3d, 0x1d, 0x1d, 0x22, 0x13, 0x32, 0x68, 0x1b, 0x14, 0x3b,
-    0x2c, 0x1f, 0x37, 0x18, 0x33, 0x26, 0x2d, 0x00, 0x00, 0x03, 0x00, 0x18,
-    0xff, 0xe0, 0x03, 0x90, 0x03, 0x4e, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x38,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x11, 0x21,
-    0x35, 0x00, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17, 0x36, 0x37, 0x21,
-    0x35, 0x21, 0x07, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07,
-    0x27, 0x01, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x02,
-    0xc6, 0x5b, 0x6f, 0x6f, 0x2b, 0x37, 0x3f, 0x4b, 0x12, 0x32, 0x29, 0x1f,
-    0x1c, 0x0d, 0xfe, 0xf5, 0xfe, 0x9f, 0x6b, 0x22, 0x61, 0x45, 0x43, 0x44,
-    0x48, 0x2a, 0x16, 0xfe, 0xef, 0x01, 0x68, 0x01, 0x1c, 0x3f, 0x6c, 0x25,
-    0x4c, 0x3c, 0x35, 0x49, 0x77, 0x47, 0x01, 0xe1, 0x1a, 0x37, 0x31, 0x17,
-    0x49, 0x1b, 0x2a, 0x2e, 0x1f, 0x02, 0x94, 0xba, 0xba, 0x53, 0xfe, 0x18,
-    0x3a, 0x32, 0x06, 0x07, 0x02, 0x60, 0x03, 0x06, 0x16, 0x1a, 0x01, 0xcc,
-    0x53, 0xfd, 0xe0, 0x99, 0x48, 0x8c, 0x4e, 0x33, 0x4d, 0x62, 0x6a, 0x7b,
-    0x54, 0x55, 0xa4, 0x95, 0x9f, 0x47, 0x34, 0x6a, 0x53, 0x8b, 0x85, 0x3a,
-    0x01, 0xdb, 0x1d, 0x50, 0x48, 0x2f, 0x30, 0x36, 0x41, 0x49, 0x28, 0x00,
-    0x00, 0x03, 0x00, 0x1f, 0xff, 0xe2, 0x03, 0xa0, 0x03, 0x44, 0x00, 0x09,
-    0x00, 0x19, 0x00, 0x23, 0x00, 0x00, 0x12, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x27, 0x04, 0x33, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11,
-    0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01, 0x01, 0x16, 0x17, 0x16, 0x17,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x5e, 0x38, 0x2d, 0x16, 0x5b, 0x20, 0x32,
-    0x30, 0x42, 0x51, 0x01, 0x14, 0x47, 0x1c, 0x17, 0x07, 0x5c, 0x12, 0x2e,
-    0x2b, 0x32, 0x55, 0x12, 0x01, 0xb8, 0x2c, 0x4d, 0x48, 0x1b, 0x59, 0x1b,
-    0x47, 0x46, 0x2d, 0x01, 0x1e, 0x99, 0x82, 0x63, 0x16, 0x82, 0x87, 0x82,
-    0x7e, 0x2a, 0x63, 0x02, 0x08, 0x17, 0x1d, 0x02, 0xc2, 0xfd, 0x27, 0x2f,
-    0x33, 0x1a, 0x05, 0x08, 0x02, 0x64, 0x02, 0x5b, 0x4a, 0xb4, 0xa8, 0x62,
-    0x25, 0x5f, 0xad, 0xad, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x68,
-    0xff, 0xeb, 0x03, 0x7a, 0x03, 0x20, 0x00, 0x28, 0x00, 0x00, 0x13, 0x15,
-    0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x21, 0x15, 0x14, 0x1e, 0x01, 0x17,
-    0x16, 0x3b, 0x01, 0x32, 0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x02, 0x35, 0x11,
-    0xd9, 0x01, 0xf4, 0xfd, 0x9b, 0x02, 0xc0, 0xfd, 0xb1, 0x0c, 0x23, 0x29,
-    0x26, 0x59, 0x46, 0xa2, 0x1b, 0x29, 0x23, 0x0f, 0x06, 0x07, 0x01, 0x5e,
-    0x02, 0x0b, 0x0a, 0x1b, 0x39, 0x3e, 0x31, 0xa7, 0xc3, 0x20, 0x41, 0x3e,
-    0x18, 0x02, 0x6a, 0x7f, 0xdd, 0x58, 0xfe, 0x73, 0xed, 0x28, 0x22, 0x0e,
-    0x03, 0x02, 0x02, 0x03, 0x0c, 0x1f, 0x25, 0x4e, 0x10, 0x1e, 0x15, 0x50,
-    0x3c, 0x35, 0x16, 0x04, 0x03, 0x03, 0x05, 0x19, 0x3f, 0x40, 0x01, 0xdf,
-    0x00, 0x03, 0x00, 0x48, 0xff, 0xd3, 0x03, 0x90, 0x03, 0x55, 0x00, 0x0f,
-    0x00, 0x28, 0x00, 0x40, 0x00, 0x00, 0x01, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x33, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x33, 0x11, 0x05, 0x33,
-    0x35, 0x33, 0x15, 0x33, 0x11, 0x14, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33,
-    0x32, 0x36, 0x35, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x04,
-    0x37, 0x3e, 0x01, 0x3f, 0x01, 0x33, 0x07, 0x14, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x27, 0x02,
-    0x9f, 0xd8, 0xd8, 0xb2, 0x4e, 0xfc, 0x4c, 0x95, 0xfd, 0xf8, 0x79, 0x4d,
-    0x7a, 0x37, 0x16, 0x20, 0x0c, 0x1c, 0x04, 0x0a, 0x05, 0x33, 0x47, 0x34,
-    0x48, 0x01, 0xaf, 0x36, 0x19, 0x15, 0x01, 0x01, 0x4e, 0x01, 0x0a, 0x3a,
-    0x3b, 0x57, 0x24, 0x36, 0x2d, 0x49, 0x31, 0x2e, 0x0b, 0x0d, 0x46, 0x9a,
-    0x2d, 0x03, 0x55, 0x5b, 0x4e, 0x5d, 0xfe, 0x6b, 0x01, 0x46, 0xfe, 0xba,
-    0x01, 0x95, 0x01, 0x06, 0xa4, 0xa3, 0xa3, 0xfe, 0x25, 0x3e, 0x06, 0x03,
-    0x51, 0x02, 0x0a, 0x11, 0x01, 0x6a, 0xfd, 0x76, 0x02, 0x8a, 0xfe, 0x2c,
-    0x38, 0x48, 0x20, 0x59, 0x3d, 0x81, 0x8e, 0x38, 0x2c, 0x28, 0x33, 0x47,
-    0x26, 0x42, 0x32, 0x3c, 0x2a, 0x24, 0x15, 0x11, 0x59, 0x44, 0x4a, 0x00,
-    0x00, 0x05, 0x00, 0x19, 0xff, 0xd1, 0x03, 0x89, 0x03, 0x5c, 0x00, 0x0f,
-    0x00, 0x23, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x35,
-    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x35,
-    0x23, 0x35, 0x02, 0x37, 0x36, 0x35, 0x11, 0x21, 0x26, 0x27, 0x37, 0x16,
-    0x17, 0x21, 0x15, 0x21, 0x15, 0x06, 0x07, 0x06, 0x07, 0x27, 0x24, 0x37,
-    0x26, 0x27, 0x23, 0x35, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x06, 0x07, 0x27, 0x24, 0x17, 0x36, 0x37, 0x21, 0x25, 0x35, 0x23,
-    0x15, 0x01, 0x5a, 0x53, 0xe2, 0x53, 0x98, 0x98, 0xfe, 0x78, 0x85, 0x7f,
-    0x12, 0x14, 0x01, 0x5d, 0x10, 0x10, 0x59, 0x18, 0x0e, 0x01, 0x45, 0xfd,
-    0x54, 0x01, 0x19, 0x15, 0x3b, 0x4e, 0x01, 0x32, 0x72, 0x50, 0x4a, 0x35,
-    0x02, 0x38, 0x47, 0x71, 0x71, 0xaa, 0x1c, 0xd4, 0x83, 0x88, 0xcc, 0x21,
-    0x01, 0x24, 0x4b, 0x65, 0x40, 0xfe, 0xd3, 0x01, 0x07, 0xe2, 0x02, 0x4f,
-    0x45, 0x45, 0x45, 0x45, 0x4a, 0x8c, 0x8c, 0x4a, 0xfe, 0x15, 0x5b, 0x5c,
-    0xb5, 0x01, 0x27, 0x30, 0x23, 0x12, 0x34, 0x31, 0x4d, 0xf3, 0xb8, 0x65,
-    0x5a, 0x6f, 0x28, 0x46, 0x27, 0x37, 0x5d, 0x48, 0x48, 0x55, 0x44, 0x25,
-    0x14, 0x52, 0x24, 0x3b, 0x39, 0x2b, 0x51, 0x8e, 0x28, 0x2f, 0x43, 0xc5,
-    0x46, 0x46, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14, 0xff, 0xd7, 0x03, 0x89,
-    0x03, 0x55, 0x00, 0x27, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5d, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x23, 0x35, 0x02, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17, 0x36,
-    0x37, 0x23, 0x35, 0x36, 0x37, 0x23, 0x35, 0x21, 0x15, 0x06, 0x07, 0x33,
-    0x15, 0x06, 0x0f, 0x01, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x01, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x02, 0x20,
-    0xb7, 0xb7, 0x4a, 0xd0, 0x4c, 0x4c, 0xd0, 0xe2, 0xe2, 0x01, 0x05, 0xfe,
-    0xfb, 0x4a, 0xeb, 0xeb, 0xbc, 0xbc, 0xb7, 0xb7, 0xd9, 0xe4, 0x31, 0x36,
-    0x1e, 0x42, 0x18, 0x21, 0x22, 0x13, 0xaf, 0x52, 0x4f, 0xa8, 0x01, 0x05,
-    0x46, 0x5b, 0x9f, 0x1c, 0x30, 0x01, 0x1e, 0x1d, 0x39, 0x9a, 0x64, 0x1b,
-    0x38, 0x79, 0x5b, 0x0d, 0x48, 0x62, 0x2b, 0x50, 0x6a, 0xa9, 0x43, 0x20,
-    0x17, 0x29, 0x4f, 0x3e, 0x02, 0xdc, 0x86, 0x86, 0x86, 0x02, 0x86, 0x43,
-    0x42, 0x4a, 0x4a, 0x85, 0x42, 0x85, 0x43, 0x45, 0x43, 0x47, 0x56, 0x56,
-    0x47, 0x43, 0x45, 0x43, 0x43, 0x42, 0x42, 0xfd, 0xd5, 0x53, 0x50, 0x76,
-    0x19, 0x54, 0x3c, 0x52, 0x6e, 0x48, 0x54, 0x6e, 0x49, 0x49, 0x66, 0x5b,
-    0x47, 0xa1, 0x68, 0x03, 0x20, 0x11, 0x21, 0x22, 0x04, 0x01, 0x0a, 0x54,
-    0x06, 0x02, 0x04, 0x29, 0x2b, 0x14, 0x16, 0x42, 0x55, 0x3a, 0x01, 0xf1,
-    0x42, 0x42, 0x84, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30,
-    0xff, 0xc6, 0x03, 0x8c, 0x03, 0x17, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x00,
-    0x01, 0x15, 0x23, 0x11, 0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x21, 0x06,
-    0x07, 0x0e, 0x01, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x23, 0x35,
-    0x33, 0x3d, 0x01, 0x23, 0x35, 0x01, 0x11, 0x23, 0x1d, 0x01, 0x03, 0x61,
-    0xa4, 0xcf, 0xcf, 0x5a, 0xfe, 0xff, 0x08, 0x1d, 0x16, 0x5d, 0x3f, 0x42,
-    0x3a, 0x53, 0x12, 0x19, 0x06, 0xd7, 0xda, 0xb0, 0x02, 0x09, 0xfe, 0x03,
-    0x17, 0x55, 0xfe, 0xfe, 0x56, 0xfe, 0x73, 0x01, 0x8d, 0x7a, 0x4d, 0x37,
-    0x72, 0x34, 0x43, 0x2d, 0x63, 0x2e, 0x3a, 0x69, 0x56, 0x06, 0xfc, 0x55,
-    0xfe, 0xa9, 0x01, 0x02, 0xf5, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2e,
-    0xff, 0xdd, 0x03, 0x82, 0x03, 0x53, 0x00, 0x11, 0x00, 0x42, 0x00, 0x00,
-    0x01, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x06, 0x07,
-    0x27, 0x36, 0x37, 0x11, 0x23, 0x35, 0x27, 0x21, 0x34, 0x27, 0x2e, 0x01,
-    0x35, 0x33, 0x15, 0x14, 0x17, 0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x33, 0x15, 0x21, 0x1e, 0x01, 0x17, 0x16, 0x37,
-    0x32, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23,
-    0x22, 0x26, 0x27, 0x26, 0x02, 0x27, 0x21, 0x01, 0xee, 0xa0, 0x82, 0x43,
-    0x05, 0x23, 0x85, 0x48, 0x7a, 0x73, 0x0d, 0x5c, 0x6a, 0xa3, 0x1d, 0x01,
-    0xd3, 0x02, 0x01, 0x02, 0x5b, 0x02, 0xa3, 0x1a, 0x13, 0x28, 0x18, 0x36,
-    0x2a, 0x18, 0x1b, 0x1e, 0x2c, 0x63, 0xfe, 0xe6, 0x0c, 0x34, 0x28, 0x18,
-    0x1b, 0x09, 0x11, 0x09, 0x09, 0x0b, 0x4d, 0x0b, 0x12, 0x13, 0x1d, 0x15,
-    0x1e, 0x28, 0x45, 0x21, 0x28, 0x38, 0x09, 0xfe, 0x29, 0x01, 0xd7, 0x54,
-    0xf6, 0x13, 0x10, 0x59, 0x07, 0x14, 0x0b, 0x11, 0x0a, 0x56, 0x05, 0x0f,
-    0x01, 0x03, 0x54, 0xda, 0x0d, 0x1e, 0x22, 0x3f, 0x16, 0x20, 0x22, 0x60,
-    0x1e, 0x13, 0x28, 0x14, 0x34, 0x23, 0x18, 0x1a, 0x20, 0x2c, 0x55, 0xbd,
-    0xf3, 0x46, 0x28, 0x02, 0x1a, 0x21, 0x22, 0x3f, 0x20, 0x40, 0x34, 0x3b,
-    0x1b, 0x15, 0x30, 0x3d, 0x4b, 0x01, 0x0a, 0xbd, 0x00, 0x04, 0x00, 0x17,
-    0xff, 0xdb, 0x03, 0x9c, 0x03, 0x52, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x22,
-    0x00, 0x37, 0x00, 0x00, 0x25, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15,
-    0x21, 0x15, 0x21, 0x35, 0x02, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11,
-    0x23, 0x11, 0x06, 0x07, 0x27, 0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x04, 0x37, 0x21, 0x35, 0x21, 0x15, 0x06, 0x07, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x07, 0x06, 0x07, 0x27,
-    0x02, 0x32, 0xc6, 0x01, 0xe5, 0xc9, 0x01, 0x01, 0xfd, 0xa0, 0xcf, 0x44,
+    0x32, 0x01, 0x00, 0x31, 0x01, 0x10, 0x00, 0xc1, 0x18, 0x00, 0x2c, 0x0d,
+    0x01, 0x2e, 0x01, 0x00, 0x37, 0x04, 0x02, 0x85, 0x0b, 0x0a, 0x94, 0x08,
+    0x33, 0x23, 0x07, 0x06, 0x1c, 0x0e, 0xf3, 0x7f, 0x21, 0x15, 0x21, 0x02,
+    0x04, 0x0d, 0x0b, 0x01, 0x4b, 0x54, 0xfd, 0x96, 0x55, 0x01, 0x6b, 0x07,
+    0x0e, 0x0b, 0x57, 0xfe, 0x8e, 0x5b, 0x1a, 0x16, 0x16, 0x03, 0xdc, 0x03,
+    0x24, 0xfe, 0xff, 0x06, 0x12, 0x14, 0x39, 0x21, 0x13, 0x12, 0x08, 0x03,
+    0x06, 0x01, 0x52, 0x02, 0x05, 0x06, 0x16, 0x2b, 0x27, 0x28, 0x1d, 0x1c,
+    0x28, 0x2b, 0x2d, 0x11, 0x94, 0x01, 0x03, 0x1f, 0x1f, 0x20, 0x69, 0x4e,
+    0x30, 0x8c, 0x02, 0x2d, 0xfd, 0xd3, 0x03, 0x39, 0x2b, 0x21, 0xca, 0x7a,
+    0x7b, 0xcb, 0x16, 0x29, 0x1a, 0x11, 0xfc, 0xd7, 0x32, 0x1f, 0x1c, 0x48,
+    0x32, 0x0c, 0x52, 0x52, 0xa8, 0x1a, 0x18, 0x0a, 0x02, 0x02, 0x01, 0x02,
+    0x08, 0x17, 0x1a, 0x33, 0x19, 0x17, 0x32, 0x22, 0x29, 0x2c, 0x13, 0x03,
+    0x02, 0x02, 0x02, 0x17, 0x34, 0x31, 0xb8, 0x12, 0x3f, 0x61, 0x25, 0x28,
+    0x40, 0x1c, 0x51, 0x02, 0x1a, 0x4e, 0x00, 0x03, 0x00, 0x55, 0xff, 0xed,
+    0x03, 0x69, 0x03, 0x57, 0x00, 0x16, 0x4c, 0x07, 0x02, 0x67, 0x25, 0x10,
+    0x11, 0xd3, 0x00, 0x02, 0xde, 0x06, 0x01, 0xe2, 0x00, 0x05, 0xdc, 0x06,
+    0xf0, 0x28, 0x05, 0xfe, 0x02, 0x02, 0x18, 0xfd, 0x91, 0x5b, 0x01, 0x63,
+    0x05, 0x14, 0x5b, 0x09, 0x10, 0x07, 0x01, 0x4f, 0x5a, 0xfd, 0xa1, 0x02,
+    0x17, 0xfe, 0x40, 0x01, 0xa6, 0xfe, 0x5a, 0x02, 0x52, 0xf4, 0x54, 0xfe,
+    0xe3, 0x02, 0x51, 0xb7, 0x12, 0x3f, 0x11, 0x16, 0x33, 0x19, 0xb7, 0x67,
+    0x53, 0xfd, 0xe7, 0x84, 0x84, 0x01, 0x71, 0x5c, 0x5c, 0x4e, 0x24, 0xf0,
+    0x00, 0x29, 0xff, 0xef, 0x03, 0x8e, 0x03, 0x5c, 0x00, 0x0b, 0x00, 0x36,
+    0x00, 0x41, 0x00, 0x5e, 0xba, 0x0c, 0x21, 0x37, 0x15, 0x79, 0x04, 0x10,
+    0x35, 0x88, 0x04, 0x10, 0x36, 0x85, 0x05, 0x05, 0xc2, 0x07, 0x03, 0xa6,
+    0x0a, 0x0a, 0xd3, 0x09, 0x23, 0x26, 0x27, 0x21, 0x04, 0x05, 0xac, 0x11,
+    0x25, 0x13, 0x21, 0x33, 0x12, 0x01, 0xa9, 0x00, 0x15, 0x16, 0xed, 0x14,
+    0x45, 0x23, 0x15, 0x23, 0x05, 0x0e, 0x00, 0xf0, 0xaf, 0xeb, 0xca, 0x53,
+    0xca, 0x54, 0xfd, 0x71, 0x14, 0x69, 0x53, 0x34, 0x0d, 0x8e, 0x78, 0x35,
+    0x78, 0x9d, 0x1f, 0x34, 0x0d, 0x1b, 0x2c, 0x25, 0x1b, 0x2c, 0x24, 0x1b,
+    0x05, 0x08, 0x04, 0x51, 0x08, 0x04, 0x08, 0x1d, 0x31, 0x2d, 0x2e, 0x36,
+    0x36, 0x2e, 0x3b, 0x18, 0x0b, 0x08, 0x5b, 0x7c, 0x1f, 0x33, 0x29, 0x0f,
+    0x1e, 0x0c, 0x41, 0x21, 0x1d, 0x20, 0x27, 0x3c, 0x1f, 0x01, 0x5e, 0x07,
+    0x12, 0x05, 0x4f, 0x0b, 0x0d, 0x05, 0x07, 0x02, 0x01, 0x53, 0x56, 0xfe,
+    0x9c, 0x1d, 0x23, 0x2a, 0x1e, 0x2f, 0x21, 0x27, 0x2b, 0x1e, 0x26, 0xe6,
+    0x56, 0x02, 0x9d, 0x1a, 0x37, 0x2b, 0x18, 0x39, 0x11, 0x2e, 0x21, 0x2f,
+    0xd9, 0x9a, 0xb6, 0xb6, 0xa0, 0xf0, 0xea, 0x8d, 0x29, 0xd8, 0xb5, 0x19,
+    0x07, 0x49, 0x75, 0x39, 0x75, 0x54, 0x11, 0x17, 0x08, 0x02, 0x02, 0x02,
+    0x02, 0x10, 0x18, 0x21, 0x28, 0x1b, 0x38, 0x14, 0x25, 0x25, 0x0f, 0x02,
+    0x02, 0x02, 0x03, 0x15, 0x08, 0x12, 0x25, 0x24, 0x4c, 0x93, 0x33, 0x15,
+    0x29, 0x16, 0x29, 0x35, 0x28, 0x2a, 0x29, 0x35, 0x01, 0x47, 0x12, 0x2e,
+    0x0a, 0x13, 0x15, 0x24, 0x0d, 0x11, 0x06, 0xb4, 0x67, 0x12, 0x1a, 0x1e,
+    0x1a, 0x3d, 0x1d, 0x1d, 0x22, 0x13, 0x32, 0x68, 0x1b, 0x14, 0x3b, 0x2c,
+    0x1f, 0x37, 0x18, 0x33, 0x26, 0x2d, 0x00, 0x7c, 0x08, 0xc8, 0xff, 0xe0,
+    0x03, 0x90, 0x03, 0x4e, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x38, 0x12, 0x03,
+    0x27, 0x07, 0x06, 0x10, 0x03, 0x13, 0x00, 0xee, 0x19, 0x01, 0xb7, 0x03,
+    0x13, 0x07, 0x9d, 0x16, 0x09, 0xd2, 0x12, 0xf0, 0x5d, 0x02, 0xc6, 0x5b,
+    0x6f, 0x6f, 0x2b, 0x37, 0x3f, 0x4b, 0x12, 0x32, 0x29, 0x1f, 0x1c, 0x0d,
+    0xfe, 0xf5, 0xfe, 0x9f, 0x6b, 0x22, 0x61, 0x45, 0x43, 0x44, 0x48, 0x2a,
+    0x16, 0xfe, 0xef, 0x01, 0x68, 0x01, 0x1c, 0x3f, 0x6c, 0x25, 0x4c, 0x3c,
+    0x35, 0x49, 0x77, 0x47, 0x01, 0xe1, 0x1a, 0x37, 0x31, 0x17, 0x49, 0x1b,
+    0x2a, 0x2e, 0x1f, 0x02, 0x94, 0xba, 0xba, 0x53, 0xfe, 0x18, 0x3a, 0x32,
+    0x06, 0x07, 0x02, 0x60, 0x03, 0x06, 0x16, 0x1a, 0x01, 0xcc, 0x53, 0xfd,
+    0xe0, 0x99, 0x48, 0x8c, 0x4e, 0x33, 0x4d, 0x62, 0x6a, 0x7b, 0x54, 0x55,
+    0xa4, 0x95, 0x9f, 0x47, 0x34, 0x6a, 0x53, 0x8b, 0x85, 0x3a, 0x01, 0xdb,
+    0x1d, 0x50, 0x48, 0x2f, 0x30, 0x36, 0x41, 0x49, 0x28, 0xb8, 0x00, 0xb0,
+    0x1f, 0xff, 0xe2, 0x03, 0xa0, 0x03, 0x44, 0x00, 0x09, 0x00, 0x19, 0x32,
+    0x25, 0x06, 0x65, 0x13, 0x1a, 0x04, 0x11, 0x11, 0x06, 0xa2, 0x00, 0xf0,
+    0x39, 0x5e, 0x38, 0x2d, 0x16, 0x5b, 0x20, 0x32, 0x30, 0x42, 0x51, 0x01,
+    0x14, 0x47, 0x1c, 0x17, 0x07, 0x5c, 0x12, 0x2e, 0x2b, 0x32, 0x55, 0x12,
+    0x01, 0xb8, 0x2c, 0x4d, 0x48, 0x1b, 0x59, 0x1b, 0x47, 0x46, 0x2d, 0x01,
+    0x1e, 0x99, 0x82, 0x63, 0x16, 0x82, 0x87, 0x82, 0x7e, 0x2a, 0x63, 0x02,
+    0x08, 0x17, 0x1d, 0x02, 0xc2, 0xfd, 0x27, 0x2f, 0x33, 0x1a, 0x05, 0x08,
+    0x02, 0x64, 0x02, 0x5b, 0x4a, 0xb4, 0xa8, 0x62, 0x25, 0x5f, 0xad, 0xad,
+    0x4f, 0x68, 0x05, 0x61, 0x68, 0xff, 0xeb, 0x03, 0x7a, 0x03, 0x22, 0x1d,
+    0x21, 0x13, 0x15, 0x4f, 0x13, 0x13, 0x11, 0x99, 0x03, 0x14, 0x33, 0x21,
+    0x0f, 0x0a, 0xd2, 0x07, 0xf1, 0x43, 0xd9, 0x01, 0xf4, 0xfd, 0x9b, 0x02,
+    0xc0, 0xfd, 0xb1, 0x0c, 0x23, 0x29, 0x26, 0x59, 0x46, 0xa2, 0x1b, 0x29,
+    0x23, 0x0f, 0x06, 0x07, 0x01, 0x5e, 0x02, 0x0b, 0x0a, 0x1b, 0x39, 0x3e,
+    0x31, 0xa7, 0xc3, 0x20, 0x41, 0x3e, 0x18, 0x02, 0x6a, 0x7f, 0xdd, 0x58,
+    0xfe, 0x73, 0xed, 0x28, 0x22, 0x0e, 0x03, 0x02, 0x02, 0x03, 0x0c, 0x1f,
+    0x25, 0x4e, 0x10, 0x1e, 0x15, 0x50, 0x3c, 0x35, 0x16, 0x04, 0x03, 0x03,
+    0x05, 0x19, 0x3f, 0x40, 0x01, 0xdf, 0x00, 0x03, 0x00, 0x48, 0xff, 0xd3,
+    0x03, 0x90, 0x03, 0x55, 0xe4, 0x08, 0x10, 0x40, 0x58, 0x03, 0x01, 0x56,
+    0x10, 0x04, 0x48, 0x10, 0x00, 0x78, 0x10, 0x00, 0x61, 0x13, 0x12, 0x14,
+    0xa5, 0x0d, 0x00, 0x5f, 0x20, 0x03, 0x64, 0x10, 0x10, 0x04, 0xf5, 0x02,
+    0x5a, 0x37, 0x33, 0x07, 0x14, 0x07, 0x7c, 0x19, 0xf0, 0x5d, 0x02, 0x9f,
+    0xd8, 0xd8, 0xb2, 0x4e, 0xfc, 0x4c, 0x95, 0xfd, 0xf8, 0x79, 0x4d, 0x7a,
+    0x37, 0x16, 0x20, 0x0c, 0x1c, 0x04, 0x0a, 0x05, 0x33, 0x47, 0x34, 0x48,
+    0x01, 0xaf, 0x36, 0x19, 0x15, 0x01, 0x01, 0x4e, 0x01, 0x0a, 0x3a, 0x3b,
+    0x57, 0x24, 0x36, 0x2d, 0x49, 0x31, 0x2e, 0x0b, 0x0d, 0x46, 0x9a, 0x2d,
+    0x03, 0x55, 0x5b, 0x4e, 0x5d, 0xfe, 0x6b, 0x01, 0x46, 0xfe, 0xba, 0x01,
+    0x95, 0x01, 0x06, 0xa4, 0xa3, 0xa3, 0xfe, 0x25, 0x3e, 0x06, 0x03, 0x51,
+    0x02, 0x0a, 0x11, 0x01, 0x6a, 0xfd, 0x76, 0x02, 0x8a, 0xfe, 0x2c, 0x38,
+    0x48, 0x20, 0x59, 0x3d, 0x81, 0x8e, 0x38, 0x2c, 0x28, 0x33, 0x47, 0x26,
+    0x42, 0x32, 0x3c, 0x2a, 0x24, 0x15, 0x11, 0x59, 0x44, 0x4a, 0xae, 0x03,
+    0x51, 0x19, 0xff, 0xd1, 0x03, 0x89, 0xa4, 0x09, 0x11, 0x23, 0xc2, 0x07,
+    0x13, 0x3e, 0x76, 0x02, 0x03, 0xaa, 0x09, 0x00, 0x03, 0x1b, 0x20, 0x02,
+    0x37, 0x76, 0x02, 0x01, 0x72, 0x02, 0x20, 0x21, 0x15, 0x27, 0x06, 0x01,
+    0xca, 0x0c, 0x03, 0xdf, 0x0c, 0x15, 0x07, 0xdc, 0x0c, 0x00, 0x8f, 0x02,
+    0x10, 0x25, 0x91, 0x1b, 0xf1, 0x6f, 0x5a, 0x53, 0xe2, 0x53, 0x98, 0x98,
+    0xfe, 0x78, 0x85, 0x7f, 0x12, 0x14, 0x01, 0x5d, 0x10, 0x10, 0x59, 0x18,
+    0x0e, 0x01, 0x45, 0xfd, 0x54, 0x01, 0x19, 0x15, 0x3b, 0x4e, 0x01, 0x32,
+    0x72, 0x50, 0x4a, 0x35, 0x02, 0x38, 0x47, 0x71, 0x71, 0xaa, 0x1c, 0xd4,
+    0x83, 0x88, 0xcc, 0x21, 0x01, 0x24, 0x4b, 0x65, 0x40, 0xfe, 0xd3, 0x01,
+    0x07, 0xe2, 0x02, 0x4f, 0x45, 0x45, 0x45, 0x45, 0x4a, 0x8c, 0x8c, 0x4a,
+    0xfe, 0x15, 0x5b, 0x5c, 0xb5, 0x01, 0x27, 0x30, 0x23, 0x12, 0x34, 0x31,
+    0x4d, 0xf3, 0xb8, 0x65, 0x5a, 0x6f, 0x28, 0x46, 0x27, 0x37, 0x5d, 0x48,
+    0x48, 0x55, 0x44, 0x25, 0x14, 0x52, 0x24, 0x3b, 0x39, 0x2b, 0x51, 0x8e,
+    0x28, 0x2f, 0x43, 0xc5, 0x46, 0x46, 0x00, 0x04, 0x00, 0x14, 0xff, 0xd7,
+    0x03, 0x89, 0x03, 0x55, 0x00, 0x27, 0x00, 0x55, 0x00, 0x59, 0x00, 0x5d,
+    0x3a, 0x1a, 0x03, 0xe9, 0x08, 0x00, 0xc2, 0x00, 0x05, 0x74, 0x17, 0x23,
+    0x15, 0x23, 0x92, 0x17, 0x04, 0x04, 0x00, 0x14, 0x02, 0x46, 0x03, 0x22,
+    0x23, 0x35, 0xed, 0x12, 0x00, 0x26, 0x19, 0x20, 0x06, 0x07, 0x91, 0x01,
+    0x02, 0x97, 0x04, 0x02, 0x8d, 0x04, 0x03, 0x8e, 0x04, 0x13, 0x01, 0xa0,
+    0x0d, 0xf0, 0x7c, 0x02, 0x20, 0xb7, 0xb7, 0x4a, 0xd0, 0x4c, 0x4c, 0xd0,
+    0xe2, 0xe2, 0x01, 0x05, 0xfe, 0xfb, 0x4a, 0xeb, 0xeb, 0xbc, 0xbc, 0xb7,
+    0xb7, 0xd9, 0xe4, 0x31, 0x36, 0x1e, 0x42, 0x18, 0x21, 0x22, 0x13, 0xaf,
+    0x52, 0x4f, 0xa8, 0x01, 0x05, 0x46, 0x5b, 0x9f, 0x1c, 0x30, 0x01, 0x1e,
+    0x1d, 0x39, 0x9a, 0x64, 0x1b, 0x38, 0x79, 0x5b, 0x0d, 0x48, 0x62, 0x2b,
+    0x50, 0x6a, 0xa9, 0x43, 0x20, 0x17, 0x29, 0x4f, 0x3e, 0x02, 0xdc, 0x86,
+    0x86, 0x86, 0x02, 0x86, 0x43, 0x42, 0x4a, 0x4a, 0x85, 0x42, 0x85, 0x43,
+    0x45, 0x43, 0x47, 0x56, 0x56, 0x47, 0x43, 0x45, 0x43, 0x43, 0x42, 0x42,
+    0xfd, 0xd5, 0x53, 0x50, 0x76, 0x19, 0x54, 0x3c, 0x52, 0x6e, 0x48, 0x54,
+    0x6e, 0x49, 0x49, 0x66, 0x5b, 0x47, 0xa1, 0x68, 0x03, 0x20, 0x11, 0x21,
+    0x22, 0x04, 0x01, 0x0a, 0x54, 0x06, 0x02, 0x04, 0x29, 0x2b, 0x14, 0x16,
+    0x42, 0x55, 0x3a, 0x01, 0xf1, 0x42, 0x42, 0x84, 0x43, 0x43, 0xdc, 0x07,
+    0xb2, 0x30, 0xff, 0xc6, 0x03, 0x8c, 0x03, 0x17, 0x00, 0x1c, 0x00, 0x21,
+    0x86, 0x0d, 0x03, 0x25, 0x1b, 0x02, 0x7c, 0x06, 0x23, 0x36, 0x36, 0xd8,
+    0x14, 0xf1, 0x3f, 0x35, 0x23, 0x35, 0x01, 0x11, 0x23, 0x15, 0x15, 0x03,
+    0x61, 0xa4, 0xcf, 0xcf, 0x5a, 0xfe, 0xff, 0x08, 0x1d, 0x16, 0x5d, 0x3f,
+    0x42, 0x3a, 0x53, 0x12, 0x19, 0x06, 0xd7, 0xda, 0xb0, 0x02, 0x09, 0xfe,
+    0x03, 0x17, 0x55, 0xfe, 0xfe, 0x56, 0xfe, 0x73, 0x01, 0x8d, 0x7a, 0x4d,
+    0x37, 0x72, 0x34, 0x43, 0x2d, 0x63, 0x2e, 0x3a, 0x69, 0x56, 0x06, 0xfc,
+    0x55, 0xfe, 0xa9, 0x01, 0x02, 0xf5, 0x0d, 0x00, 0x02, 0x00, 0x2e, 0xff,
+    0xdd, 0x03, 0x82, 0x03, 0x53, 0x00, 0x11, 0x00, 0x42, 0x6a, 0x00, 0x02,
+    0x03, 0x14, 0x05, 0x15, 0x0b, 0x60, 0x27, 0x21, 0x34, 0x27, 0x26, 0x26,
+    0x48, 0x12, 0x14, 0x17, 0x68, 0x1a, 0x05, 0xa1, 0x0c, 0x26, 0x16, 0x37,
+    0xd5, 0x19, 0x01, 0xb2, 0x21, 0xf1, 0x7a, 0x26, 0x02, 0x27, 0x21, 0x01,
+    0xee, 0xa0, 0x82, 0x43, 0x05, 0x23, 0x85, 0x48, 0x7a, 0x73, 0x0d, 0x5c,
+    0x6a, 0xa3, 0x1d, 0x01, 0xd3, 0x02, 0x01, 0x02, 0x5b, 0x02, 0xa3, 0x1a,
+    0x13, 0x28, 0x18, 0x36, 0x2a, 0x18, 0x1b, 0x1e, 0x2c, 0x63, 0xfe, 0xe6,
+    0x0c, 0x34, 0x28, 0x18, 0x1b, 0x09, 0x11, 0x09, 0x09, 0x0b, 0x4d, 0x0b,
+    0x12, 0x13, 0x1d, 0x15, 0x1e, 0x28, 0x45, 0x21, 0x28, 0x38, 0x09, 0xfe,
+    0x29, 0x01, 0xd7, 0x54, 0xf6, 0x13, 0x10, 0x59, 0x07, 0x14, 0x0b, 0x11,
+    0x0a, 0x56, 0x05, 0x0f, 0x01, 0x03, 0x54, 0xda, 0x0d, 0x1e, 0x22, 0x3f,
+    0x16, 0x20, 0x22, 0x60, 0x1e, 0x13, 0x28, 0x14, 0x34, 0x23, 0x18, 0x1a,
+    0x20, 0x2c, 0x55, 0xbd, 0xf3, 0x46, 0x28, 0x02, 0x1a, 0x21, 0x22, 0x3f,
+    0x20, 0x40, 0x34, 0x3b, 0x1b, 0x15, 0x30, 0x3d, 0x4b, 0x01, 0x0a, 0xbd,
+    0x00, 0x04, 0x00, 0x17, 0xff, 0xdb, 0x03, 0x9c, 0x03, 0x52, 0x00, 0x0b,
+    0x24, 0x18, 0x12, 0x37, 0x9e, 0x0c, 0x1f, 0x21, 0x9c, 0x19, 0x01, 0x07,
+    0xcb, 0x04, 0x03, 0x25, 0x09, 0x05, 0xb0, 0x03, 0x01, 0xaf, 0x03, 0xf0,
+    0x59, 0x32, 0xc6, 0x01, 0xe5, 0xc9, 0x01, 0x01, 0xfd, 0xa0, 0xcf, 0x44,
     0x43, 0x2b, 0x49, 0x2c, 0x35, 0x56, 0x24, 0x29, 0x3a, 0x62, 0x2e, 0x34,
     0x2c, 0x46, 0x34, 0x44, 0x32, 0x3d, 0x38, 0x02, 0x07, 0x8a, 0xfe, 0xbb,
     0x01, 0xba, 0x39, 0x48, 0x39, 0x21, 0x6e, 0x21, 0x2f, 0x33, 0x57, 0x46,
@@ -1303,381 +1023,307 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x01, 0x1e, 0x56, 0x5a, 0x4e, 0x25, 0x53, 0x4a, 0xfe, 0x2c, 0x01, 0x69,
     0x29, 0x27, 0x40, 0x01, 0x70, 0x34, 0x38, 0x42, 0x2f, 0x4a, 0x4a, 0x37,
     0x36, 0x40, 0x3d, 0x9f, 0x54, 0x4f, 0x48, 0x3e, 0x1b, 0x13, 0x3d, 0x17,
-    0x4a, 0x27, 0x2f, 0x28, 0x16, 0x10, 0x4f, 0x3a, 0x4f, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x1e, 0xff, 0xed, 0x03, 0x8e, 0x03, 0x5c, 0x00, 0x18,
-    0x00, 0x22, 0x00, 0x26, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x55, 0x00, 0x00,
-    0x00, 0x17, 0x16, 0x17, 0x07, 0x33, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x33, 0x11, 0x21, 0x11, 0x33, 0x26, 0x27, 0x26, 0x27,
-    0x37, 0x00, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01,
-    0x35, 0x21, 0x15, 0x17, 0x33, 0x15, 0x14, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07,
-    0x2b, 0x01, 0x2e, 0x01, 0x35, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x01, 0x48, 0x1a, 0x18, 0x0c, 0x36, 0xbe, 0x16, 0x1e, 0x1f, 0x18,
-    0x4b, 0x15, 0x23, 0x09, 0x0a, 0xab, 0xfd, 0x6c, 0xa3, 0x13, 0x0a, 0x18,
-    0x11, 0x4a, 0xfe, 0xff, 0x25, 0x22, 0x11, 0x4f, 0x13, 0x21, 0x1d, 0x23,
-    0x4b, 0x02, 0xb0, 0xfe, 0x18, 0x20, 0x55, 0x15, 0x22, 0x0f, 0x3b, 0x3c,
-    0x0d, 0x24, 0x18, 0x04, 0x07, 0x02, 0x53, 0x04, 0x08, 0x07, 0x1b, 0x34,
-    0x2f, 0x5b, 0x5f, 0x3d, 0x33, 0xcd, 0x17, 0x27, 0x1b, 0x1d, 0x45, 0x15,
-    0x21, 0x20, 0x1b, 0x01, 0x73, 0x20, 0x2b, 0x26, 0x17, 0x4c, 0x12, 0x2c,
-    0x29, 0x1a, 0x03, 0x46, 0x26, 0x26, 0x17, 0x1d, 0x17, 0x2a, 0x2b, 0x2a,
-    0x2b, 0x23, 0x2f, 0x0e, 0x0b, 0xfe, 0x9f, 0x01, 0x61, 0x22, 0x11, 0x24,
-    0x15, 0x29, 0xfc, 0xff, 0x53, 0x50, 0x36, 0x1d, 0x39, 0x4f, 0x41, 0x3d,
-    0x27, 0x01, 0x7e, 0xc0, 0xc0, 0x8f, 0xaf, 0x21, 0x15, 0x02, 0x01, 0x01,
-    0x02, 0x12, 0x1b, 0x2f, 0x21, 0x17, 0x31, 0x2a, 0x23, 0x27, 0x12, 0x03,
-    0x03, 0x2f, 0x3a, 0x01, 0x09, 0x19, 0x32, 0x23, 0x2e, 0x31, 0x24, 0x2d,
-    0x2c, 0x20, 0x06, 0x2f, 0x4a, 0x43, 0x36, 0x29, 0x2d, 0x4f, 0x4c, 0x28,
-    0x00, 0x01, 0x00, 0x14, 0xff, 0xd4, 0x03, 0x9c, 0x03, 0x5d, 0x00, 0x58,
-    0x00, 0x00, 0x00, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x2f, 0x01, 0x16,
-    0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x36, 0x37, 0x36, 0x35, 0x11, 0x21, 0x27, 0x37, 0x16, 0x17, 0x33, 0x26,
-    0x2f, 0x02, 0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x33, 0x15, 0x21, 0x16,
-    0x17, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x16, 0x17, 0x1e, 0x01, 0x33,
-    0x32, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26,
-    0x27, 0x21, 0x15, 0x33, 0x01, 0xc3, 0x07, 0x07, 0x05, 0x14, 0x29, 0x26,
-    0x2e, 0x33, 0x12, 0x36, 0x1a, 0x19, 0x14, 0x09, 0x03, 0x07, 0x02, 0x98,
-    0x03, 0x16, 0x16, 0x3f, 0x52, 0x3d, 0x17, 0x17, 0x01, 0x7e, 0x0b, 0x55,
-    0x04, 0x06, 0x92, 0x16, 0x13, 0x12, 0x26, 0x3b, 0x20, 0x1c, 0x23, 0x12,
-    0x2c, 0x78, 0xfe, 0xdf, 0x11, 0x20, 0x47, 0x2e, 0x50, 0x43, 0x58, 0x0b,
-    0x10, 0x0f, 0x17, 0x1d, 0x0d, 0x10, 0x13, 0x0b, 0x0d, 0x0c, 0x4c, 0x11,
-    0x11, 0x0f, 0x1e, 0x15, 0x14, 0x17, 0x13, 0x12, 0x21, 0x35, 0x1e, 0x46,
-    0x64, 0x3a, 0x73, 0x4c, 0x2f, 0x1c, 0xfe, 0xd0, 0xf0, 0x01, 0x87, 0x85,
-    0x46, 0x2e, 0x31, 0x18, 0x05, 0x06, 0x02, 0x56, 0x04, 0x01, 0x02, 0x08,
-    0x17, 0x1d, 0x51, 0x80, 0x96, 0x5e, 0x68, 0x6e, 0x2a, 0x61, 0x5f, 0x61,
-    0xa1, 0x01, 0x00, 0x95, 0x01, 0x4c, 0x4a, 0x1b, 0x16, 0x13, 0x27, 0x32,
-    0x1e, 0x1c, 0x25, 0x18, 0x26, 0x53, 0xbb, 0x80, 0x72, 0x93, 0x1c, 0xbe,
-    0x80, 0x0f, 0x28, 0x1a, 0x2a, 0x20, 0x17, 0x1f, 0x28, 0x39, 0x20, 0x4a,
-    0x2a, 0x21, 0x25, 0x08, 0x0d, 0x09, 0x0e, 0x49, 0x42, 0x4d, 0x4b, 0x43,
-    0x52, 0x5a, 0x8b, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22,
-    0xff, 0xde, 0x03, 0x8b, 0x03, 0x50, 0x00, 0x4c, 0x00, 0x00, 0x13, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x37, 0x35, 0x06,
-    0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x15, 0x25,
-    0x17, 0x05, 0x15, 0x14, 0x16, 0x3b, 0x01, 0x32, 0x3e, 0x01, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x0f, 0x01, 0x27, 0x2e, 0x01, 0x3d,
-    0x01, 0x07, 0x27, 0x07, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2f, 0x01,
-    0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x06, 0x07, 0x27, 0x36, 0x37, 0x35,
-    0x23, 0x35, 0xbd, 0x57, 0x68, 0x68, 0x29, 0x25, 0x0e, 0x96, 0x2e, 0x3d,
-    0x1e, 0x62, 0x84, 0x73, 0x5d, 0x22, 0x67, 0x70, 0x1f, 0x01, 0x23, 0x09,
-    0xfe, 0xd4, 0x19, 0x1a, 0x53, 0x16, 0x17, 0x0d, 0x03, 0x06, 0x02, 0x55,
-    0x02, 0x08, 0x07, 0x16, 0x2b, 0x2a, 0x41, 0x5a, 0x37, 0x2b, 0x92, 0x08,
-    0x58, 0x28, 0x32, 0x13, 0x3b, 0x13, 0x11, 0x1e, 0x2e, 0x1c, 0x0d, 0x5a,
-    0x28, 0x19, 0x43, 0x58, 0x7e, 0x02, 0xa5, 0xab, 0xab, 0x54, 0x83, 0x10,
-    0x12, 0x44, 0x15, 0xd4, 0x08, 0x0a, 0x56, 0x0c, 0x1d, 0x1a, 0x1e, 0x52,
-    0x21, 0x18, 0x07, 0xdb, 0x29, 0x56, 0x2b, 0xf0, 0x25, 0x1d, 0x07, 0x1b,
-    0x1d, 0x22, 0x40, 0x16, 0x34, 0x36, 0x33, 0x30, 0x11, 0x01, 0x01, 0x01,
-    0x01, 0x39, 0x4a, 0xf6, 0x15, 0x47, 0x26, 0xfe, 0xde, 0x39, 0x30, 0x06,
-    0x03, 0x03, 0x01, 0x5f, 0x03, 0x0e, 0x1c, 0xee, 0x21, 0x0d, 0x54, 0x14,
-    0x20, 0xa4, 0x54, 0x00, 0x00, 0x03, 0x00, 0x27, 0xff, 0xcd, 0x03, 0x6a,
-    0x03, 0x54, 0x00, 0x22, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x00, 0x13, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x37, 0x17, 0x06, 0x07, 0x11, 0x14,
-    0x06, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x06,
-    0x31, 0x06, 0x07, 0x27, 0x36, 0x37, 0x35, 0x23, 0x35, 0x00, 0x37, 0x36,
-    0x35, 0x11, 0x33, 0x27, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x02, 0x33, 0x11,
-    0x21, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x35, 0x21, 0x15, 0x14, 0x07,
-    0xb0, 0x54, 0x69, 0x69, 0x5c, 0x12, 0x1a, 0x54, 0x23, 0x30, 0x28, 0x33,
-    0x10, 0x20, 0x24, 0x1a, 0x0c, 0x2a, 0x41, 0x08, 0x16, 0x23, 0x66, 0x71,
-    0x01, 0x22, 0x19, 0x18, 0xc8, 0x0b, 0x12, 0x0a, 0x55, 0x09, 0x0d, 0x08,
-    0x0e, 0xb6, 0xfe, 0x7c, 0x06, 0x12, 0x17, 0x4f, 0x50, 0x01, 0xfd, 0xfe,
-    0xd4, 0x01, 0x02, 0xa8, 0xa4, 0xa4, 0x54, 0x98, 0x23, 0x55, 0x0c, 0x20,
-    0xfe, 0xec, 0x35, 0x2c, 0x06, 0x06, 0x02, 0x58, 0x03, 0x0e, 0x19, 0xe5,
-    0x0e, 0x15, 0x02, 0x59, 0x08, 0x23, 0xb5, 0x54, 0xfd, 0xbf, 0x58, 0x5d,
-    0xb6, 0x01, 0x04, 0x21, 0x35, 0x16, 0x12, 0x14, 0x26, 0x18, 0x2c, 0xfe,
-    0x8e, 0x72, 0x47, 0x64, 0x7a, 0x31, 0x01, 0xba, 0xcc, 0xa2, 0x1c, 0x0e,
-    0x00, 0x04, 0x00, 0x25, 0xff, 0xd9, 0x03, 0x8f, 0x03, 0x50, 0x00, 0x22,
-    0x00, 0x36, 0x00, 0x48, 0x00, 0x4d, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x06,
-    0x07, 0x27, 0x36, 0x37, 0x35, 0x23, 0x35, 0x01, 0x33, 0x35, 0x23, 0x35,
-    0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x23, 0x12, 0x37, 0x26, 0x27, 0x23, 0x35, 0x21, 0x15, 0x06,
-    0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x17, 0x36,
-    0x37, 0x21, 0xae, 0x50, 0x60, 0x60, 0x1b, 0x2c, 0x14, 0x1d, 0x3e, 0x21,
-    0x29, 0x22, 0x39, 0x11, 0x2a, 0x14, 0x14, 0x0f, 0x05, 0x49, 0x2a, 0x16,
-    0x40, 0x49, 0x74, 0x01, 0x0e, 0xf6, 0xcd, 0xcd, 0x51, 0xcc, 0xcc, 0xf4,
-    0xf4, 0x51, 0xf6, 0x83, 0x58, 0x52, 0x3e, 0x23, 0x01, 0xe4, 0x34, 0x69,
-    0x5d, 0x7b, 0x1d, 0xa8, 0x5f, 0x64, 0x91, 0x1d, 0xc7, 0x4d, 0x5b, 0x2f,
-    0xfe, 0xf6, 0x02, 0xa7, 0xa9, 0xa9, 0x53, 0x81, 0x0c, 0x16, 0x55, 0x10,
-    0x1d, 0xfe, 0xd8, 0x31, 0x28, 0x05, 0x05, 0x57, 0x04, 0x05, 0x10, 0x14,
-    0xeb, 0x20, 0x0e, 0x57, 0x17, 0x20, 0xa5, 0x53, 0xfe, 0x17, 0x5f, 0x4d,
-    0x5b, 0x5b, 0x4d, 0x5f, 0x50, 0x95, 0x95, 0x01, 0x93, 0x2a, 0x43, 0x68,
-    0x4d, 0x4d, 0x5c, 0x50, 0x2d, 0x20, 0x4c, 0x34, 0x36, 0x37, 0x31, 0x4a,
-    0xac, 0x35, 0x3b, 0x47, 0x00, 0x05, 0x00, 0x22, 0xff, 0xe0, 0x03, 0x7d,
-    0x03, 0x4b, 0x00, 0x03, 0x00, 0x25, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x53,
-    0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x04, 0x37, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x11, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x36, 0x3d,
-    0x01, 0x06, 0x07, 0x27, 0x01, 0x33, 0x15, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x15, 0x14, 0x1e, 0x01, 0x17, 0x32, 0x37, 0x3e,
-    0x02, 0x3f, 0x01, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x27,
-    0x2e, 0x02, 0x35, 0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x03,
-    0x4d, 0xfe, 0x37, 0xfe, 0xe7, 0x41, 0x75, 0x75, 0x55, 0x67, 0x67, 0x2d,
-    0x30, 0x0f, 0x2a, 0x42, 0x25, 0x30, 0x2f, 0x30, 0x10, 0x26, 0x1e, 0x1d,
-    0x0e, 0x49, 0x2b, 0x16, 0x01, 0x61, 0x53, 0x4c, 0x4f, 0x74, 0x52, 0x1a,
-    0x60, 0x63, 0x69, 0x4f, 0x0d, 0x25, 0x2d, 0x8a, 0x1c, 0x22, 0x1d, 0x0a,
-    0x03, 0x04, 0x52, 0x02, 0x05, 0x06, 0x18, 0x38, 0x39, 0x24, 0x59, 0x45,
-    0x46, 0x44, 0x18, 0x01, 0x76, 0xfe, 0xdb, 0x01, 0x25, 0xfe, 0xdb, 0x01,
-    0xa1, 0xfe, 0x4f, 0x01, 0xb1, 0x1a, 0x18, 0xb7, 0x52, 0xa3, 0xa3, 0x52,
-    0x9a, 0x0f, 0x14, 0x54, 0x13, 0x18, 0xfe, 0xf4, 0x36, 0x31, 0x06, 0x07,
-    0x02, 0x59, 0x04, 0x0f, 0x1c, 0xe0, 0x19, 0x0b, 0x57, 0x01, 0xd2, 0x80,
-    0x0f, 0x16, 0x20, 0x1b, 0x4b, 0x21, 0x19, 0x19, 0x11, 0x11, 0x1b, 0x16,
-    0x07, 0x01, 0x01, 0x02, 0x08, 0x13, 0x15, 0x35, 0x15, 0x25, 0x19, 0x25,
-    0x25, 0x12, 0x03, 0x03, 0x01, 0x01, 0x14, 0x30, 0x31, 0xfd, 0xe4, 0x64,
-    0x64, 0xb1, 0x67, 0x67, 0x00, 0x04, 0x00, 0x24, 0xff, 0xdc, 0x03, 0x8f,
-    0x03, 0x4c, 0x00, 0x1d, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x35,
-    0x11, 0x21, 0x15, 0x21, 0x1d, 0x01, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x33, 0x11, 0x21, 0x11, 0x24, 0x37, 0x35, 0x23, 0x35, 0x33,
-    0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x11, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01,
-    0x3d, 0x01, 0x06, 0x07, 0x27, 0x01, 0x35, 0x21, 0x15, 0x01, 0x35, 0x23,
-    0x15, 0x02, 0x6f, 0xb2, 0x06, 0x11, 0x17, 0x46, 0x4d, 0x40, 0x1a, 0x18,
-    0x01, 0xfc, 0xfe, 0x56, 0xaf, 0x52, 0xce, 0xce, 0x98, 0xfe, 0x7c, 0xfe,
-    0x7c, 0x53, 0x6b, 0x6b, 0x53, 0x54, 0x54, 0x24, 0x26, 0x11, 0x16, 0x45,
-    0x22, 0x28, 0x2d, 0x35, 0x0f, 0x20, 0x0f, 0x20, 0x13, 0x06, 0x3c, 0x2e,
-    0x16, 0x02, 0xf2, 0xfe, 0xaa, 0x01, 0x49, 0xe4, 0x01, 0x24, 0x5a, 0x77,
-    0x47, 0x6d, 0x77, 0x2b, 0x66, 0x72, 0x63, 0xc6, 0x01, 0x18, 0xf5, 0x2c,
-    0x36, 0x5a, 0x5a, 0x4b, 0x5a, 0xfe, 0xca, 0x01, 0x36, 0x5e, 0x20, 0xad,
-    0x52, 0xab, 0xab, 0x52, 0x89, 0x10, 0x13, 0x54, 0x0b, 0x21, 0xfe, 0xdf,
-    0x2f, 0x2d, 0x06, 0x07, 0x02, 0x55, 0x02, 0x02, 0x0f, 0x17, 0xe8, 0x19,
-    0x10, 0x59, 0x01, 0x01, 0x5f, 0x5f, 0xfd, 0xc4, 0x9d, 0x9d, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x26, 0xff, 0xd6, 0x03, 0x8f, 0x03, 0x56, 0x00, 0x22,
-    0x00, 0x40, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x00, 0x13, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07, 0x11,
-    0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d,
-    0x01, 0x06, 0x07, 0x27, 0x36, 0x37, 0x35, 0x23, 0x35, 0x00, 0x36, 0x37,
-    0x26, 0x27, 0x36, 0x37, 0x23, 0x35, 0x33, 0x36, 0x37, 0x17, 0x06, 0x0f,
-    0x01, 0x21, 0x15, 0x23, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x0e,
-    0x01, 0x07, 0x27, 0x13, 0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x23, 0x35,
-    0x33, 0x2f, 0x01, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x33, 0x15,
-    0x23, 0x17, 0x0f, 0x02, 0x33, 0x15, 0x21, 0x12, 0x17, 0x36, 0x37, 0x23,
-    0x06, 0x07, 0x12, 0x17, 0x16, 0x17, 0x07, 0x33, 0x37, 0x36, 0x37, 0x23,
-    0xa5, 0x4e, 0x60, 0x60, 0x2a, 0x19, 0x14, 0x16, 0x41, 0x22, 0x28, 0x36,
-    0x2b, 0x10, 0x20, 0x25, 0x14, 0x0f, 0x05, 0x41, 0x2a, 0x14, 0x3f, 0x40,
-    0x6a, 0x01, 0x30, 0x8d, 0x30, 0x66, 0x47, 0x1b, 0x1b, 0x76, 0x98, 0x18,
-    0x0a, 0x4f, 0x10, 0x03, 0x09, 0x01, 0x5c, 0x68, 0x26, 0x37, 0x83, 0x4a,
-    0x2c, 0x5c, 0x85, 0x36, 0xac, 0x67, 0x1c, 0x34, 0x99, 0x17, 0x03, 0x13,
-    0x15, 0x42, 0x82, 0xde, 0x03, 0x0a, 0x07, 0x05, 0x56, 0x0e, 0x08, 0x02,
-    0x05, 0xcf, 0x8b, 0x42, 0x0f, 0x19, 0x14, 0xa8, 0xfd, 0xbf, 0xcd, 0x55,
-    0x34, 0x21, 0xbd, 0x15, 0x0e, 0x18, 0x13, 0x19, 0x0d, 0x23, 0x76, 0x29,
-    0x15, 0x0e, 0xeb, 0x02, 0xa3, 0xa6, 0xa6, 0x4e, 0x99, 0x12, 0x0d, 0x4f,
-    0x0b, 0x1c, 0xfe, 0xe2, 0x30, 0x2a, 0x05, 0x06, 0x02, 0x56, 0x03, 0x04,
-    0x10, 0x14, 0xe8, 0x18, 0x0d, 0x52, 0x12, 0x18, 0xb7, 0x4e, 0xfd, 0x8f,
-    0x2b, 0x19, 0x2e, 0x18, 0x2f, 0x3a, 0x4d, 0x3c, 0x1f, 0x14, 0x2b, 0x07,
-    0x15, 0x4d, 0x60, 0x3d, 0x3c, 0x2f, 0x47, 0x3c, 0x3d, 0x23, 0x40, 0x14,
-    0x4e, 0x01, 0xfa, 0x28, 0x05, 0x21, 0x1a, 0x24, 0x4b, 0x0c, 0x1f, 0x16,
-    0x0d, 0x11, 0x2a, 0x1b, 0x06, 0x14, 0x4b, 0x19, 0x1f, 0x32, 0x22, 0x4c,
-    0xfe, 0xfd, 0x26, 0x34, 0x46, 0x2e, 0x17, 0x01, 0xb5, 0x21, 0x26, 0x19,
-    0x15, 0x44, 0x25, 0x23, 0x00, 0x05, 0x00, 0x20, 0xff, 0xdf, 0x03, 0x98,
-    0x03, 0x51, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x38, 0x00, 0x4a, 0x00, 0x54,
-    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x37, 0x17,
-    0x06, 0x07, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2f, 0x01, 0x16, 0x33,
-    0x3e, 0x02, 0x3d, 0x01, 0x06, 0x07, 0x27, 0x36, 0x37, 0x35, 0x23, 0x35,
-    0x01, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x21,
-    0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x13, 0x33,
-    0x26, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x33, 0x15, 0x23,
-    0x35, 0x21, 0x15, 0x23, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0xa3, 0x52, 0x4f, 0x4f, 0x37, 0x17, 0x12, 0x3c, 0x25, 0x31,
-    0x12, 0x30, 0x13, 0x10, 0x1b, 0x25, 0x14, 0x0f, 0x06, 0x4a, 0x20, 0x19,
-    0x34, 0x4f, 0x6e, 0x01, 0x08, 0xfd, 0xbc, 0x01, 0xcf, 0xbb, 0xf6, 0xfd,
-    0xb5, 0x48, 0x3d, 0x33, 0x26, 0x37, 0x32, 0x2d, 0x2f, 0x48, 0x32, 0x17,
-    0xe1, 0x03, 0x06, 0x06, 0x10, 0x52, 0x0c, 0x0b, 0x03, 0x0c, 0xdd, 0x50,
-    0xfe, 0x8b, 0x52, 0x01, 0x4e, 0x30, 0x46, 0x4e, 0x25, 0x32, 0x25, 0x4c,
-    0x4f, 0x26, 0x02, 0xa5, 0xaa, 0xaa, 0x53, 0x8a, 0x1a, 0x53, 0x0a, 0x1b,
-    0xfe, 0xeb, 0x39, 0x30, 0x08, 0x03, 0x02, 0x01, 0x57, 0x03, 0x01, 0x06,
-    0x12, 0x15, 0xe3, 0x20, 0x09, 0x57, 0x0f, 0x22, 0xae, 0x53, 0xfd, 0xac,
-    0xb3, 0x52, 0x52, 0xb3, 0x51, 0x01, 0xcd, 0x34, 0x2b, 0x29, 0x3b, 0x33,
-    0x26, 0x29, 0x35, 0x43, 0x01, 0x3e, 0x0f, 0x0e, 0x17, 0x28, 0x11, 0x19,
-    0x26, 0x08, 0x26, 0xc1, 0x71, 0x71, 0x34, 0x1c, 0x37, 0x3e, 0x25, 0x44,
-    0x25, 0x3e, 0x40, 0x18, 0x00, 0x05, 0x00, 0x1e, 0xff, 0xcd, 0x03, 0x9d,
-    0x03, 0x53, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x38, 0x00, 0x54, 0x00, 0x5a,
-    0x00, 0x00, 0x13, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x33,
-    0x15, 0x21, 0x35, 0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x12, 0x3f, 0x01, 0x26, 0x27, 0x37, 0x16, 0x17, 0x36, 0x37, 0x17,
-    0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06,
-    0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x24,
-    0x37, 0x27, 0x26, 0x27, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x21, 0x15, 0x23, 0x06, 0x0f, 0x01, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x06, 0x07, 0x27, 0x12, 0x17, 0x36, 0x37, 0x23, 0x07, 0xe8, 0x0e, 0x06,
-    0x11, 0x52, 0x0d, 0x09, 0x0b, 0x09, 0xa3, 0xfe, 0x54, 0x1a, 0x23, 0x1d,
-    0x24, 0x48, 0x20, 0x24, 0x25, 0x38, 0x3d, 0x78, 0x4a, 0x0e, 0x48, 0x2c,
-    0x3a, 0x25, 0x40, 0x1e, 0x16, 0x47, 0x27, 0x2b, 0x2a, 0x3d, 0x35, 0x1d,
-    0x35, 0x1a, 0x3f, 0x05, 0x1a, 0x1b, 0x2b, 0x44, 0x2c, 0x41, 0x1a, 0x44,
-    0x04, 0x25, 0x61, 0x41, 0x38, 0x02, 0x04, 0x4c, 0x01, 0x3f, 0x1f, 0x0f,
-    0x40, 0x32, 0x24, 0x20, 0x17, 0x53, 0x14, 0x17, 0x01, 0x17, 0x45, 0x20,
-    0x4b, 0x09, 0x52, 0x76, 0x39, 0x75, 0x4e, 0x4f, 0x84, 0x3c, 0xd0, 0x40,
-    0x3c, 0x18, 0x9f, 0x0d, 0x02, 0xca, 0x2a, 0x15, 0x33, 0x10, 0x24, 0x21,
-    0x1e, 0x1f, 0x56, 0x56, 0xfe, 0xf5, 0x37, 0x29, 0x49, 0x22, 0x3f, 0x37,
-    0x3a, 0x43, 0x33, 0xfe, 0xdd, 0x64, 0x14, 0x58, 0x28, 0x34, 0x20, 0x48,
-    0x3d, 0x4a, 0x16, 0x37, 0x3d, 0x2d, 0x2e, 0x3d, 0x28, 0x47, 0x2c, 0x2f,
-    0x08, 0x29, 0x5b, 0x51, 0x53, 0x3d, 0x37, 0x27, 0x55, 0x06, 0x35, 0x5e,
-    0x30, 0x42, 0x61, 0x66, 0x02, 0x6f, 0x82, 0x1d, 0x36, 0x5b, 0x60, 0x53,
-    0x5f, 0x12, 0x4c, 0x40, 0x54, 0xec, 0x86, 0x11, 0x73, 0x57, 0x47, 0x5d,
-    0x68, 0x61, 0x62, 0x43, 0x01, 0x90, 0x74, 0x7b, 0xb8, 0x20, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x1a, 0xff, 0xd0, 0x03, 0x94, 0x03, 0x52, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x6e, 0x00, 0x75,
-    0x00, 0x00, 0x01, 0x15, 0x33, 0x15, 0x23, 0x15, 0x16, 0x17, 0x07, 0x26,
-    0x2f, 0x02, 0x15, 0x23, 0x35, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x23, 0x35, 0x33, 0x35, 0x02, 0x37, 0x26, 0x27, 0x36, 0x3f, 0x01, 0x23,
-    0x35, 0x33, 0x36, 0x37, 0x17, 0x06, 0x07, 0x33, 0x15, 0x06, 0x07, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x13, 0x17, 0x16, 0x17, 0x07,
-    0x26, 0x27, 0x26, 0x27, 0x12, 0x17, 0x36, 0x37, 0x23, 0x06, 0x07, 0x12,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x12, 0x37, 0x27,
-    0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x21, 0x15, 0x23, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x06, 0x07, 0x27, 0x12, 0x17, 0x37, 0x36, 0x37, 0x23, 0x07, 0x01,
-    0x44, 0xae, 0xae, 0x64, 0x46, 0x2b, 0x13, 0x38, 0x16, 0x1e, 0x4d, 0x1a,
-    0x27, 0x2d, 0x40, 0x2f, 0x68, 0x43, 0x92, 0xc4, 0x4b, 0x44, 0x59, 0x3d,
-    0x0c, 0x16, 0x0c, 0x59, 0x7b, 0x0f, 0x0f, 0x4e, 0x08, 0x0c, 0xd5, 0x22,
-    0x39, 0x3d, 0x18, 0x2d, 0x2c, 0x3a, 0x53, 0xa7, 0x26, 0x61, 0x30, 0x1b,
-    0x0f, 0x3a, 0x07, 0x22, 0x1e, 0x0f, 0xaf, 0x3e, 0x2d, 0x1c, 0x9d, 0x0a,
-    0x14, 0xb1, 0x1a, 0x1f, 0x0b, 0x3b, 0x0b, 0x22, 0x1d, 0x16, 0x36, 0xd5,
-    0x45, 0x07, 0x36, 0x1a, 0x02, 0x12, 0x42, 0x35, 0x21, 0x2b, 0x12, 0x53,
-    0x13, 0x18, 0x01, 0x04, 0x45, 0x0c, 0x30, 0x28, 0x05, 0x02, 0x43, 0x77,
-    0x3b, 0x6b, 0x43, 0x41, 0x77, 0x3e, 0xb7, 0x3b, 0x01, 0x38, 0x14, 0x8f,
-    0x0a, 0x03, 0x4b, 0xc9, 0x46, 0x04, 0x3d, 0x40, 0x39, 0x13, 0x30, 0x11,
-    0x16, 0x5d, 0x83, 0x27, 0x24, 0x2f, 0x28, 0x3e, 0x39, 0x55, 0x46, 0xc9,
-    0xfc, 0xfa, 0x23, 0x2f, 0x14, 0x15, 0x2a, 0x16, 0x48, 0x22, 0x29, 0x16,
-    0x17, 0x1e, 0x44, 0x4f, 0x3e, 0x20, 0x0e, 0x45, 0x1e, 0x1f, 0x3a, 0x36,
-    0x49, 0x03, 0x1e, 0x3f, 0x27, 0x1a, 0x25, 0x0e, 0x33, 0x2c, 0x11, 0xfd,
-    0xa6, 0x1e, 0x2a, 0x3d, 0x14, 0x24, 0x02, 0x05, 0x25, 0x2d, 0x18, 0x28,
-    0x13, 0x31, 0x28, 0x15, 0x28, 0xfd, 0xb4, 0x6a, 0x0d, 0x6c, 0x88, 0x05,
-    0x1e, 0x31, 0x5b, 0x56, 0x6c, 0x52, 0x0e, 0x4a, 0x44, 0x55, 0x7d, 0xbb,
-    0x4c, 0x0b, 0x02, 0x61, 0x5b, 0x44, 0x5b, 0x5a, 0x59, 0x5c, 0x40, 0x01,
-    0x95, 0x7d, 0x02, 0x7a, 0xbd, 0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x26,
-    0xff, 0xd3, 0x03, 0x95, 0x03, 0x55, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x00,
-    0x00, 0x1f, 0x01, 0x1e, 0x01, 0x17, 0x21, 0x15, 0x23, 0x06, 0x07, 0x16,
-    0x17, 0x07, 0x24, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x35, 0x21, 0x27, 0x26, 0x27, 0x37, 0x02, 0x17, 0x36, 0x37, 0x21, 0x01,
-    0xf4, 0x12, 0x07, 0x03, 0x06, 0x03, 0x01, 0x61, 0x97, 0x3e, 0x85, 0x87,
-    0xee, 0x2b, 0xfe, 0xff, 0x8b, 0x88, 0xff, 0x31, 0xeb, 0x89, 0x82, 0x45,
-    0x91, 0x01, 0x79, 0x0e, 0x0b, 0x10, 0x59, 0x84, 0x75, 0x72, 0x35, 0xfe,
-    0xae, 0x03, 0x3f, 0x37, 0x18, 0x0b, 0x16, 0x0b, 0x55, 0xf0, 0x91, 0x6c,
-    0x4c, 0x5e, 0x62, 0x74, 0x74, 0x67, 0x5a, 0x52, 0x6f, 0x8f, 0xf2, 0x55,
-    0x32, 0x27, 0x26, 0x12, 0xfe, 0x52, 0x7b, 0x78, 0xcb, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x1b, 0xff, 0xca, 0x03, 0x8f, 0x03, 0x59, 0x00, 0x34,
-    0x00, 0x3c, 0x00, 0x49, 0x00, 0x53, 0x00, 0x70, 0x00, 0x00, 0x13, 0x27,
-    0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x33, 0x15, 0x23, 0x17, 0x06, 0x0f,
-    0x01, 0x06, 0x07, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x14,
-    0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01,
-    0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x26, 0x2f, 0x01, 0x26, 0x27,
-    0x37, 0x23, 0x35, 0x02, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x07, 0x27, 0x12,
-    0x17, 0x16, 0x17, 0x16, 0x17, 0x07, 0x33, 0x36, 0x37, 0x36, 0x37, 0x23,
-    0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x16, 0x37,
-    0x36, 0x35, 0x11, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x15, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x15, 0x14, 0x07, 0x0e,
-    0x01, 0x07, 0x27, 0xf7, 0x08, 0x09, 0x0c, 0x52, 0x0e, 0x07, 0x0b, 0xa0,
-    0x7d, 0x46, 0x0d, 0x13, 0x09, 0x04, 0x07, 0x7b, 0xb7, 0xad, 0xad, 0x1f,
-    0x2a, 0x25, 0x2e, 0x0f, 0x1d, 0x1c, 0x11, 0x0d, 0x05, 0xba, 0xba, 0xc5,
-    0x82, 0x06, 0x04, 0x0e, 0x0f, 0x13, 0x3e, 0x6c, 0x0f, 0x3b, 0x13, 0x45,
-    0x17, 0x3d, 0x1e, 0x42, 0xa0, 0x0a, 0x08, 0x0e, 0x0a, 0x10, 0x2f, 0x69,
-    0x0b, 0x10, 0x1c, 0x06, 0xb2, 0xd5, 0x16, 0x1a, 0x23, 0x0b, 0x3d, 0x1d,
-    0x0f, 0x1b, 0x15, 0x9b, 0x14, 0x16, 0x4c, 0x62, 0x57, 0x3e, 0x1e, 0x2b,
-    0x5f, 0x56, 0x30, 0x01, 0x25, 0x64, 0x52, 0x6f, 0x18, 0x0b, 0x31, 0x22,
-    0x50, 0x02, 0xf7, 0x18, 0x24, 0x1a, 0x0c, 0x21, 0x1e, 0x23, 0x4b, 0x17,
-    0x26, 0x28, 0x12, 0x0b, 0x0d, 0x4c, 0x5d, 0x50, 0xda, 0x31, 0x2b, 0x06,
-    0x04, 0x54, 0x03, 0x05, 0x11, 0x14, 0xc5, 0x50, 0x5d, 0x4c, 0x0e, 0x07,
-    0x20, 0x21, 0x1f, 0x1a, 0x4b, 0xfd, 0x6c, 0x70, 0x38, 0x1b, 0x3d, 0x77,
-    0x29, 0x26, 0x02, 0x70, 0x11, 0x0e, 0x1c, 0x12, 0x27, 0x18, 0x15, 0x25,
-    0x40, 0x15, 0xfe, 0x5d, 0x1c, 0x28, 0x30, 0x15, 0x2d, 0x32, 0x17, 0x2c,
-    0x19, 0x89, 0x60, 0x5f, 0xb8, 0x01, 0x28, 0x05, 0x15, 0x13, 0x17, 0x50,
-    0x11, 0x17, 0x12, 0x05, 0x9c, 0x51, 0xfe, 0x20, 0x01, 0xe0, 0x01, 0xb1,
-    0x6d, 0x34, 0x70, 0x32, 0x29, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2e,
-    0xff, 0xd3, 0x03, 0x7b, 0x03, 0x1c, 0x00, 0x1b, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x15, 0x21, 0x07, 0x06, 0x07, 0x21, 0x15, 0x21, 0x06, 0x07, 0x0e,
-    0x01, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x21, 0x35, 0x21, 0x36,
-    0x3f, 0x01, 0x21, 0x35, 0x01, 0x33, 0x11, 0x14, 0x16, 0x1f, 0x01, 0x32,
-    0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x35, 0x03, 0x43, 0xfe, 0xad, 0x04,
-    0x02, 0x04, 0x01, 0x95, 0xfe, 0x5e, 0x1b, 0x35, 0x2b, 0x8e, 0x68, 0x3a,
-    0x5f, 0x82, 0x28, 0x2b, 0x17, 0xfe, 0xc9, 0x01, 0x47, 0x06, 0x01, 0x03,
-    0xfe, 0xe7, 0x01, 0x69, 0x58, 0x0f, 0x1d, 0x42, 0x22, 0x24, 0x13, 0x10,
-    0x08, 0x03, 0x07, 0x01, 0x55, 0x01, 0x0a, 0x06, 0x14, 0x2d, 0x2d, 0x15,
-    0x35, 0x3e, 0x36, 0x35, 0x25, 0x03, 0x1c, 0x53, 0x71, 0x25, 0x24, 0x54,
-    0x82, 0x57, 0x48, 0x84, 0x43, 0x51, 0x38, 0x74, 0x42, 0x49, 0x60, 0x54,
-    0x34, 0x1d, 0x69, 0x53, 0xfe, 0x78, 0xfe, 0xe7, 0x21, 0x13, 0x01, 0x01,
-    0x02, 0x01, 0x07, 0x13, 0x17, 0x41, 0x2b, 0x14, 0x1a, 0x4f, 0x2d, 0x2d,
-    0x15, 0x03, 0x01, 0x03, 0x04, 0x33, 0x3e, 0x00, 0x00, 0x05, 0x00, 0x5c,
-    0xff, 0xe1, 0x03, 0x8f, 0x03, 0x4e, 0x00, 0x16, 0x00, 0x1a, 0x00, 0x1e,
-    0x00, 0x22, 0x00, 0x2c, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e,
-    0x01, 0x35, 0x11, 0x21, 0x35, 0x25, 0x21, 0x11, 0x21, 0x37, 0x35, 0x23,
-    0x15, 0x13, 0x35, 0x23, 0x15, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x02, 0xc7, 0x5c, 0x6c, 0x6c, 0x2b, 0x39, 0x2f, 0x60,
-    0x13, 0x33, 0x2f, 0x24, 0x1b, 0x09, 0xfe, 0xe0, 0xfe, 0xb5, 0x01, 0x32,
-    0xfe, 0xce, 0xe0, 0x8e, 0x8e, 0x8e, 0x01, 0x59, 0x1b, 0x2d, 0x28, 0x17,
-    0x4b, 0x18, 0x26, 0x30, 0x16, 0x02, 0x95, 0xb9, 0xb9, 0x57, 0xfe, 0x1c,
-    0x3b, 0x33, 0x06, 0x05, 0x62, 0x03, 0x05, 0x15, 0x1c, 0x01, 0xc8, 0x57,
-    0x76, 0xfd, 0x29, 0x54, 0xfb, 0xfb, 0x01, 0x4d, 0xe0, 0xe0, 0x37, 0x25,
-    0x53, 0x42, 0x3d, 0x2a, 0x3b, 0x46, 0x58, 0x1e, 0x00, 0x06, 0x00, 0x33,
-    0xff, 0xca, 0x03, 0x8e, 0x03, 0x29, 0x00, 0x22, 0x00, 0x27, 0x00, 0x2b,
-    0x00, 0x30, 0x00, 0x35, 0x00, 0x39, 0x00, 0x00, 0x01, 0x35, 0x21, 0x35,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x06, 0x07, 0x16, 0x17, 0x1e,
-    0x01, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x26, 0x27, 0x0e, 0x01, 0x07, 0x27,
-    0x36, 0x37, 0x26, 0x27, 0x37, 0x23, 0x11, 0x01, 0x3d, 0x01, 0x23, 0x15,
-    0x37, 0x35, 0x23, 0x15, 0x12, 0x17, 0x36, 0x37, 0x23, 0x25, 0x35, 0x23,
-    0x1d, 0x01, 0x37, 0x35, 0x23, 0x15, 0x01, 0xb4, 0xfe, 0x98, 0x03, 0x2a,
-    0xfe, 0x96, 0x01, 0x29, 0xfe, 0xd1, 0x0d, 0x2a, 0x1e, 0x0f, 0x4e, 0xc3,
-    0x81, 0x15, 0x7f, 0xc6, 0x51, 0x2d, 0x21, 0x35, 0xa3, 0x6a, 0x20, 0xbe,
-    0x55, 0x4c, 0x47, 0x30, 0x56, 0x01, 0x27, 0xd0, 0xd0, 0xd0, 0x56, 0x48,
-    0x20, 0x0b, 0xb0, 0x01, 0xe2, 0xd3, 0xd3, 0xd3, 0x02, 0x91, 0x4b, 0x4d,
-    0x4d, 0x4b, 0xfe, 0x89, 0x51, 0x41, 0x0c, 0x05, 0x1c, 0x1b, 0x02, 0x56,
-    0x06, 0x1d, 0x1d, 0x10, 0x10, 0x2d, 0x3c, 0x15, 0x4f, 0x23, 0x38, 0x32,
-    0x47, 0x2d, 0x01, 0x77, 0xfe, 0xd3, 0x0b, 0x45, 0x50, 0x97, 0x4c, 0x4c,
-    0xfe, 0xe0, 0x2c, 0x2e, 0x3d, 0x4a, 0x50, 0x47, 0x09, 0x97, 0x4c, 0x4c,
-    0x00, 0x09, 0x00, 0x30, 0xff, 0xd6, 0x03, 0x90, 0x03, 0x38, 0x00, 0x03,
-    0x00, 0x19, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f,
-    0x00, 0x41, 0x00, 0x46, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x03, 0x21,
-    0x15, 0x21, 0x11, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x15, 0x23, 0x35,
-    0x0f, 0x01, 0x06, 0x07, 0x27, 0x37, 0x11, 0x23, 0x12, 0x3f, 0x01, 0x35,
-    0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x25, 0x35,
-    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x00, 0x37, 0x26, 0x27, 0x23, 0x35,
-    0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27,
-    0x36, 0x17, 0x36, 0x37, 0x23, 0x03, 0x16, 0xfd, 0x92, 0x78, 0x03, 0x5e,
-    0xfe, 0x3f, 0x16, 0x18, 0x0c, 0x04, 0x35, 0x09, 0x4e, 0x1c, 0x3f, 0x9c,
-    0x4a, 0x08, 0x50, 0x56, 0xc8, 0x27, 0x60, 0xab, 0xab, 0xab, 0xab, 0xab,
-    0x01, 0xf1, 0xfe, 0x35, 0x01, 0xcb, 0xfe, 0x35, 0x01, 0x3b, 0x3d, 0x41,
-    0x2a, 0x17, 0x01, 0x64, 0x2d, 0x48, 0x44, 0x6d, 0x25, 0x73, 0x4f, 0x44,
-    0x5b, 0x2c, 0x97, 0x32, 0x3a, 0x1e, 0xab, 0x03, 0x38, 0xfe, 0xe7, 0x01,
-    0x19, 0xfe, 0xb6, 0x42, 0xfe, 0xd6, 0x04, 0x04, 0x03, 0x48, 0x09, 0x01,
-    0x65, 0x59, 0x04, 0x09, 0x14, 0x06, 0x47, 0x05, 0x01, 0x58, 0xfe, 0xb4,
-    0x06, 0x0f, 0x3d, 0x55, 0x91, 0x41, 0x41, 0x7e, 0x40, 0x40, 0xf1, 0x32,
-    0x32, 0x69, 0x31, 0x31, 0xfd, 0x83, 0x32, 0x4b, 0x6e, 0x41, 0x44, 0x67,
-    0x4f, 0x33, 0x2a, 0x47, 0x30, 0x40, 0x3a, 0x2f, 0x42, 0xc8, 0x3a, 0x3f,
-    0x47, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1c, 0xff, 0xd5, 0x03, 0x94,
-    0x03, 0x24, 0x00, 0x22, 0x00, 0x3e, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4d,
-    0x00, 0x52, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x27,
-    0x16, 0x3b, 0x01, 0x3e, 0x01, 0x37, 0x36, 0x27, 0x23, 0x15, 0x21, 0x15,
-    0x06, 0x0f, 0x01, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x15,
-    0x23, 0x11, 0x21, 0x00, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x11, 0x21, 0x11,
-    0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d,
-    0x01, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x35, 0x23, 0x1d, 0x01,
-    0x37, 0x35, 0x23, 0x15, 0x00, 0x37, 0x26, 0x27, 0x23, 0x11, 0x36, 0x17,
-    0x36, 0x37, 0x23, 0x03, 0x57, 0x06, 0x03, 0x2b, 0x38, 0x33, 0x47, 0x0f,
-    0x2f, 0x28, 0x1f, 0x18, 0x0f, 0x02, 0x03, 0x01, 0xf3, 0x01, 0x54, 0x1e,
-    0x53, 0x04, 0x3c, 0x69, 0x30, 0x61, 0x45, 0x38, 0x55, 0x21, 0x4d, 0x01,
-    0x94, 0xfc, 0xdc, 0x1c, 0x09, 0x0c, 0x0a, 0x01, 0x19, 0x28, 0x32, 0x2a,
-    0x27, 0x11, 0x17, 0x24, 0x17, 0x15, 0x08, 0x84, 0x03, 0x0d, 0x10, 0x2d,
-    0x4d, 0x01, 0x1e, 0x81, 0x81, 0x81, 0x01, 0x99, 0x3a, 0x43, 0x24, 0x15,
-    0x7a, 0x33, 0x3d, 0x1c, 0xa6, 0x02, 0xe0, 0x60, 0x30, 0x26, 0x06, 0x05,
-    0x51, 0x03, 0x01, 0x0e, 0x17, 0x23, 0x21, 0xef, 0x4b, 0x85, 0x70, 0x06,
-    0x41, 0x3e, 0x46, 0x40, 0x4b, 0x3c, 0x40, 0x27, 0x3e, 0x03, 0x4f, 0xfc,
-    0xff, 0x45, 0x27, 0x32, 0x83, 0x62, 0x01, 0x7d, 0xfd, 0x30, 0x36, 0x2e,
-    0x06, 0x05, 0x55, 0x03, 0x06, 0x13, 0x16, 0xad, 0x4f, 0x46, 0x51, 0x57,
-    0x22, 0x01, 0x68, 0x97, 0x5b, 0x3c, 0xe2, 0x93, 0x93, 0xfe, 0x2b, 0x3c,
-    0x64, 0x91, 0xfe, 0xa2, 0xf3, 0x4f, 0x52, 0x68, 0x00, 0x09, 0x00, 0x29,
-    0xff, 0xd0, 0x03, 0x60, 0x03, 0x49, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x21,
-    0x00, 0x25, 0x00, 0x29, 0x00, 0x33, 0x00, 0x4f, 0x00, 0x55, 0x00, 0x59,
-    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x12, 0x37,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x35, 0x23, 0x15,
-    0x37, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x13, 0x16, 0x1f, 0x01,
-    0x16, 0x17, 0x07, 0x26, 0x2f, 0x01, 0x16, 0x37, 0x3e, 0x01, 0x35, 0x11,
-    0x21, 0x11, 0x14, 0x06, 0x07, 0x06, 0x23, 0x2f, 0x01, 0x17, 0x32, 0x3e,
-    0x01, 0x3d, 0x01, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x01, 0x35,
-    0x23, 0x15, 0x14, 0x07, 0x37, 0x35, 0x23, 0x15, 0x87, 0x4d, 0xa0, 0x4d,
+    0x4a, 0x27, 0x2f, 0x28, 0x16, 0x10, 0x4f, 0x3a, 0x4f, 0x2c, 0x0e, 0x31,
+    0x1e, 0xff, 0xed, 0x5a, 0x07, 0x00, 0xb4, 0x00, 0x73, 0x26, 0x00, 0x41,
+    0x00, 0x4b, 0x00, 0x55, 0xf8, 0x1b, 0x15, 0x33, 0x5f, 0x01, 0x01, 0xc7,
+    0x17, 0x11, 0x26, 0xa7, 0x08, 0x05, 0xea, 0x18, 0x00, 0xd2, 0x07, 0x4d,
+    0x17, 0x33, 0x15, 0x14, 0x6d, 0x07, 0x65, 0x23, 0x23, 0x26, 0x26, 0x35,
+    0x13, 0xd1, 0x00, 0x16, 0x25, 0x12, 0x19, 0xf0, 0xa2, 0x48, 0x1a, 0x18,
+    0x0c, 0x36, 0xbe, 0x16, 0x1e, 0x1f, 0x18, 0x4b, 0x15, 0x23, 0x09, 0x0a,
+    0xab, 0xfd, 0x6c, 0xa3, 0x13, 0x0a, 0x18, 0x11, 0x4a, 0xfe, 0xff, 0x25,
+    0x22, 0x11, 0x4f, 0x13, 0x21, 0x1d, 0x23, 0x4b, 0x02, 0xb0, 0xfe, 0x18,
+    0x20, 0x55, 0x15, 0x22, 0x0f, 0x3b, 0x3c, 0x0d, 0x24, 0x18, 0x04, 0x07,
+    0x02, 0x53, 0x04, 0x08, 0x07, 0x1b, 0x34, 0x2f, 0x5b, 0x5f, 0x3d, 0x33,
+    0xcd, 0x17, 0x27, 0x1b, 0x1d, 0x45, 0x15, 0x21, 0x20, 0x1b, 0x01, 0x73,
+    0x20, 0x2b, 0x26, 0x17, 0x4c, 0x12, 0x2c, 0x29, 0x1a, 0x03, 0x46, 0x26,
+    0x26, 0x17, 0x1d, 0x17, 0x2a, 0x2b, 0x2a, 0x2b, 0x23, 0x2f, 0x0e, 0x0b,
+    0xfe, 0x9f, 0x01, 0x61, 0x22, 0x11, 0x24, 0x15, 0x29, 0xfc, 0xff, 0x53,
+    0x50, 0x36, 0x1d, 0x39, 0x4f, 0x41, 0x3d, 0x27, 0x01, 0x7e, 0xc0, 0xc0,
+    0x8f, 0xaf, 0x21, 0x15, 0x02, 0x01, 0x01, 0x02, 0x12, 0x1b, 0x2f, 0x21,
+    0x17, 0x31, 0x2a, 0x23, 0x27, 0x12, 0x03, 0x03, 0x2f, 0x3a, 0x01, 0x09,
+    0x19, 0x32, 0x23, 0x2e, 0x31, 0x24, 0x2d, 0x2c, 0x20, 0x06, 0x2f, 0x4a,
+    0x43, 0x36, 0x29, 0x2d, 0x4f, 0x4c, 0x28, 0x00, 0x01, 0x00, 0x14, 0xff,
+    0xd4, 0x03, 0x9c, 0x03, 0x5d, 0x00, 0x24, 0x3a, 0x04, 0xda, 0x0d, 0x03,
+    0x90, 0x09, 0x04, 0xb4, 0x17, 0x00, 0xbe, 0x04, 0x00, 0x8f, 0x02, 0x46,
+    0x33, 0x26, 0x2f, 0x02, 0x96, 0x02, 0x12, 0x17, 0xbf, 0x02, 0x0a, 0x73,
+    0x1c, 0x14, 0x06, 0xf3, 0x03, 0x03, 0xa7, 0x0c, 0xf0, 0x5a, 0x21, 0x15,
+    0x33, 0x01, 0xc3, 0x07, 0x07, 0x05, 0x14, 0x29, 0x26, 0x2e, 0x33, 0x12,
+    0x36, 0x1a, 0x19, 0x14, 0x09, 0x03, 0x07, 0x02, 0x98, 0x03, 0x16, 0x16,
+    0x3f, 0x52, 0x3d, 0x17, 0x17, 0x01, 0x7e, 0x0b, 0x55, 0x04, 0x06, 0x92,
+    0x16, 0x13, 0x12, 0x26, 0x3b, 0x20, 0x1c, 0x23, 0x12, 0x2c, 0x78, 0xfe,
+    0xdf, 0x11, 0x20, 0x47, 0x2e, 0x50, 0x43, 0x58, 0x0b, 0x10, 0x0f, 0x17,
+    0x1d, 0x0d, 0x10, 0x13, 0x0b, 0x0d, 0x0c, 0x4c, 0x11, 0x11, 0x0f, 0x1e,
+    0x15, 0x14, 0x17, 0x13, 0x12, 0x21, 0x35, 0x1e, 0x46, 0x64, 0x3a, 0x73,
+    0x4c, 0x2f, 0x1c, 0xfe, 0xd0, 0xf0, 0x01, 0x87, 0x85, 0x46, 0x2e, 0x31,
+    0x18, 0x05, 0x06, 0x02, 0x56, 0x04, 0x01, 0xe1, 0x06, 0xf2, 0x30, 0x51,
+    0x80, 0x96, 0x5e, 0x68, 0x6e, 0x2a, 0x61, 0x5f, 0x61, 0xa1, 0x01, 0x00,
+    0x95, 0x01, 0x4c, 0x4a, 0x1b, 0x16, 0x13, 0x27, 0x32, 0x1e, 0x1c, 0x25,
+    0x18, 0x26, 0x53, 0xbb, 0x80, 0x72, 0x93, 0x1c, 0xbe, 0x80, 0x0f, 0x28,
+    0x1a, 0x2a, 0x20, 0x17, 0x1f, 0x28, 0x39, 0x20, 0x4a, 0x2a, 0x21, 0x25,
+    0x08, 0x0d, 0x09, 0x0e, 0x49, 0x42, 0x4d, 0x4b, 0x43, 0x52, 0x5a, 0x8b,
+    0xff, 0x7e, 0xec, 0x2e, 0x74, 0xde, 0x03, 0x8b, 0x03, 0x50, 0x00, 0x4c,
+    0xf6, 0x0e, 0x01, 0xa6, 0x03, 0x17, 0x37, 0x37, 0x22, 0x70, 0x07, 0x15,
+    0x25, 0x17, 0x05, 0x15, 0x14, 0x1a, 0x07, 0x07, 0x09, 0x02, 0x10, 0x07,
+    0xbb, 0x03, 0x41, 0x35, 0x07, 0x27, 0x07, 0x6b, 0x08, 0x03, 0x6c, 0x08,
+    0x01, 0x58, 0x13, 0x01, 0xe9, 0x0a, 0xf0, 0x58, 0xbd, 0x57, 0x68, 0x68,
+    0x29, 0x25, 0x0e, 0x96, 0x2e, 0x3d, 0x1e, 0x62, 0x84, 0x73, 0x5d, 0x22,
+    0x67, 0x70, 0x1f, 0x01, 0x23, 0x09, 0xfe, 0xd4, 0x19, 0x1a, 0x53, 0x16,
+    0x17, 0x0d, 0x03, 0x06, 0x02, 0x55, 0x02, 0x08, 0x07, 0x16, 0x2b, 0x2a,
+    0x41, 0x5a, 0x37, 0x2b, 0x92, 0x08, 0x58, 0x28, 0x32, 0x13, 0x3b, 0x13,
+    0x11, 0x1e, 0x2e, 0x1c, 0x0d, 0x5a, 0x28, 0x19, 0x43, 0x58, 0x7e, 0x02,
+    0xa5, 0xab, 0xab, 0x54, 0x83, 0x10, 0x12, 0x44, 0x15, 0xd4, 0x08, 0x0a,
+    0x56, 0x0c, 0x1d, 0x1a, 0x1e, 0x52, 0x21, 0x18, 0x07, 0xdb, 0x29, 0x56,
+    0x2b, 0xf0, 0x25, 0x1d, 0x07, 0x1b, 0x1d, 0x22, 0x40, 0x16, 0x34, 0x36,
+    0x33, 0x30, 0x11, 0xcf, 0x3b, 0xf2, 0x0b, 0x39, 0x4a, 0xf6, 0x15, 0x47,
+    0x26, 0xfe, 0xde, 0x39, 0x30, 0x06, 0x03, 0x03, 0x01, 0x5f, 0x03, 0x0e,
+    0x1c, 0xee, 0x21, 0x0d, 0x54, 0x14, 0x20, 0xa4, 0x54, 0xe4, 0x15, 0x71,
+    0xcd, 0x03, 0x6a, 0x03, 0x54, 0x00, 0x22, 0x50, 0x1e, 0x05, 0xe4, 0x00,
+    0x01, 0xaf, 0x03, 0x05, 0x25, 0x09, 0x00, 0xb9, 0x00, 0x14, 0x31, 0xbb,
+    0x00, 0x10, 0x00, 0xff, 0x01, 0x02, 0x17, 0x17, 0x37, 0x1f, 0x02, 0x33,
+    0xc3, 0x11, 0xf9, 0x71, 0x14, 0x07, 0xb0, 0x54, 0x69, 0x69, 0x5c, 0x12,
+    0x1a, 0x54, 0x23, 0x30, 0x28, 0x33, 0x10, 0x20, 0x24, 0x1a, 0x0c, 0x2a,
+    0x41, 0x08, 0x16, 0x23, 0x66, 0x71, 0x01, 0x22, 0x19, 0x18, 0xc8, 0x0b,
+    0x12, 0x0a, 0x55, 0x09, 0x0d, 0x08, 0x0e, 0xb6, 0xfe, 0x7c, 0x06, 0x12,
+    0x17, 0x4f, 0x50, 0x01, 0xfd, 0xfe, 0xd4, 0x01, 0x02, 0xa8, 0xa4, 0xa4,
+    0x54, 0x98, 0x23, 0x55, 0x0c, 0x20, 0xfe, 0xec, 0x35, 0x2c, 0x06, 0x06,
+    0x02, 0x58, 0x03, 0x0e, 0x19, 0xe5, 0x0e, 0x15, 0x02, 0x59, 0x08, 0x23,
+    0xb5, 0x54, 0xfd, 0xbf, 0x58, 0x5d, 0xb6, 0x01, 0x04, 0x21, 0x35, 0x16,
+    0x12, 0x14, 0x26, 0x18, 0x2c, 0xfe, 0x8e, 0x72, 0x47, 0x64, 0x7a, 0x31,
+    0x01, 0xba, 0xcc, 0xa2, 0x1c, 0x0e, 0x00, 0x04, 0x00, 0x25, 0xff, 0xd9,
+    0x03, 0x8f, 0x03, 0x50, 0x00, 0x22, 0x00, 0x36, 0x00, 0x48, 0x00, 0x4d,
+    0xa2, 0x01, 0x03, 0xbf, 0x00, 0x02, 0x24, 0x08, 0x07, 0x79, 0x01, 0x12,
+    0x01, 0xac, 0x06, 0x05, 0xb0, 0x18, 0x00, 0xc4, 0x06, 0x1d, 0x12, 0x7b,
+    0x07, 0x10, 0x36, 0x7b, 0x07, 0xf2, 0x7f, 0xae, 0x50, 0x60, 0x60, 0x1b,
+    0x2c, 0x14, 0x1d, 0x3e, 0x21, 0x29, 0x22, 0x39, 0x11, 0x2a, 0x14, 0x14,
+    0x0f, 0x05, 0x49, 0x2a, 0x16, 0x40, 0x49, 0x74, 0x01, 0x0e, 0xf6, 0xcd,
+    0xcd, 0x51, 0xcc, 0xcc, 0xf4, 0xf4, 0x51, 0xf6, 0x83, 0x58, 0x52, 0x3e,
+    0x23, 0x01, 0xe4, 0x34, 0x69, 0x5d, 0x7b, 0x1d, 0xa8, 0x5f, 0x64, 0x91,
+    0x1d, 0xc7, 0x4d, 0x5b, 0x2f, 0xfe, 0xf6, 0x02, 0xa7, 0xa9, 0xa9, 0x53,
+    0x81, 0x0c, 0x16, 0x55, 0x10, 0x1d, 0xfe, 0xd8, 0x31, 0x28, 0x05, 0x05,
+    0x57, 0x04, 0x05, 0x10, 0x14, 0xeb, 0x20, 0x0e, 0x57, 0x17, 0x20, 0xa5,
+    0x53, 0xfe, 0x17, 0x5f, 0x4d, 0x5b, 0x5b, 0x4d, 0x5f, 0x50, 0x95, 0x95,
+    0x01, 0x93, 0x2a, 0x43, 0x68, 0x4d, 0x4d, 0x5c, 0x50, 0x2d, 0x20, 0x4c,
+    0x34, 0x36, 0x37, 0x31, 0x4a, 0xac, 0x35, 0x3b, 0x47, 0x00, 0x05, 0x00,
+    0x22, 0xff, 0xe0, 0x03, 0x7d, 0x03, 0x4b, 0x00, 0x03, 0x00, 0x25, 0x00,
+    0x4b, 0x00, 0x4f, 0x00, 0x53, 0x40, 0x13, 0x12, 0x04, 0x52, 0x1a, 0x0c,
+    0xe7, 0x00, 0x07, 0x5f, 0x02, 0x17, 0x01, 0x0c, 0x0c, 0x01, 0xb3, 0x09,
+    0x01, 0xb0, 0x09, 0x05, 0xaf, 0x09, 0x00, 0xae, 0x09, 0x00, 0xad, 0x01,
+    0x01, 0xe0, 0x13, 0xf0, 0x23, 0x4d, 0xfe, 0x37, 0xfe, 0xe7, 0x41, 0x75,
+    0x75, 0x55, 0x67, 0x67, 0x2d, 0x30, 0x0f, 0x2a, 0x42, 0x25, 0x30, 0x2f,
+    0x30, 0x10, 0x26, 0x1e, 0x1d, 0x0e, 0x49, 0x2b, 0x16, 0x01, 0x61, 0x53,
+    0x4c, 0x4f, 0x74, 0x52, 0x1a, 0x60, 0x63, 0x69, 0x4f, 0x0d, 0x25, 0x2d,
+    0x8a, 0x1c, 0x22, 0x1d, 0x0a, 0x03, 0x04, 0x50, 0x0d, 0xf3, 0x61, 0x18,
+    0x38, 0x39, 0x24, 0x59, 0x45, 0x46, 0x44, 0x18, 0x01, 0x76, 0xfe, 0xdb,
+    0x01, 0x25, 0xfe, 0xdb, 0x01, 0xa1, 0xfe, 0x4f, 0x01, 0xb1, 0x1a, 0x18,
+    0xb7, 0x52, 0xa3, 0xa3, 0x52, 0x9a, 0x0f, 0x14, 0x54, 0x13, 0x18, 0xfe,
+    0xf4, 0x36, 0x31, 0x06, 0x07, 0x02, 0x59, 0x04, 0x0f, 0x1c, 0xe0, 0x19,
+    0x0b, 0x57, 0x01, 0xd2, 0x80, 0x0f, 0x16, 0x20, 0x1b, 0x4b, 0x21, 0x19,
+    0x19, 0x11, 0x11, 0x1b, 0x16, 0x07, 0x01, 0x01, 0x02, 0x08, 0x13, 0x15,
+    0x35, 0x15, 0x25, 0x19, 0x25, 0x25, 0x12, 0x03, 0x03, 0x01, 0x01, 0x14,
+    0x30, 0x31, 0xfd, 0xe4, 0x64, 0x64, 0xb1, 0x67, 0x67, 0x00, 0x04, 0x00,
+    0x24, 0xff, 0xdc, 0x03, 0x8f, 0x03, 0x4c, 0x00, 0x1d, 0x00, 0x40, 0x00,
+    0x44, 0x00, 0x48, 0xba, 0x22, 0x05, 0x7a, 0x04, 0x00, 0xf6, 0x1d, 0x05,
+    0xc2, 0x01, 0x01, 0x8a, 0x1f, 0x0f, 0x14, 0x01, 0x08, 0x03, 0x15, 0x01,
+    0x00, 0x86, 0x0d, 0x00, 0x6b, 0x08, 0xff, 0x79, 0x6f, 0xb2, 0x06, 0x11,
+    0x17, 0x46, 0x4d, 0x40, 0x1a, 0x18, 0x01, 0xfc, 0xfe, 0x56, 0xaf, 0x52,
+    0xce, 0xce, 0x98, 0xfe, 0x7c, 0xfe, 0x7c, 0x53, 0x6b, 0x6b, 0x53, 0x54,
+    0x54, 0x24, 0x26, 0x11, 0x16, 0x45, 0x22, 0x28, 0x2d, 0x35, 0x0f, 0x20,
+    0x0f, 0x20, 0x13, 0x06, 0x3c, 0x2e, 0x16, 0x02, 0xf2, 0xfe, 0xaa, 0x01,
+    0x49, 0xe4, 0x01, 0x24, 0x5a, 0x77, 0x47, 0x6d, 0x77, 0x2b, 0x66, 0x72,
+    0x63, 0xc6, 0x01, 0x18, 0xf5, 0x2c, 0x36, 0x5a, 0x5a, 0x4b, 0x5a, 0xfe,
+    0xca, 0x01, 0x36, 0x5e, 0x20, 0xad, 0x52, 0xab, 0xab, 0x52, 0x89, 0x10,
+    0x13, 0x54, 0x0b, 0x21, 0xfe, 0xdf, 0x2f, 0x2d, 0x06, 0x07, 0x02, 0x55,
+    0x02, 0x02, 0x0f, 0x17, 0xe8, 0x19, 0x10, 0x59, 0x01, 0x01, 0x5f, 0x5f,
+    0xfd, 0xc4, 0x9d, 0x9d, 0x00, 0x05, 0x00, 0x26, 0xff, 0xd6, 0x03, 0x8f,
+    0x03, 0x56, 0x00, 0x22, 0x00, 0x40, 0x00, 0x5d, 0x00, 0x64, 0x00, 0x6e,
+    0xac, 0x02, 0x01, 0x1c, 0x27, 0xac, 0x02, 0x01, 0x96, 0x0c, 0x04, 0x59,
+    0x19, 0x20, 0x06, 0x07, 0xef, 0x20, 0x04, 0xa3, 0x02, 0x00, 0xc2, 0x0d,
+    0x04, 0xbb, 0x14, 0x25, 0x33, 0x27, 0xa4, 0x1a, 0xa1, 0x15, 0x23, 0x17,
+    0x0f, 0x02, 0x33, 0x15, 0x21, 0x12, 0x17, 0xad, 0x05, 0x11, 0x12, 0x9b,
+    0x05, 0x00, 0xb9, 0x05, 0xf0, 0x63, 0xa5, 0x4e, 0x60, 0x60, 0x2a, 0x19,
+    0x14, 0x16, 0x41, 0x22, 0x28, 0x36, 0x2b, 0x10, 0x20, 0x25, 0x14, 0x0f,
+    0x05, 0x41, 0x2a, 0x14, 0x3f, 0x40, 0x6a, 0x01, 0x30, 0x8d, 0x30, 0x66,
+    0x47, 0x1b, 0x1b, 0x76, 0x98, 0x18, 0x0a, 0x4f, 0x10, 0x03, 0x09, 0x01,
+    0x5c, 0x68, 0x26, 0x37, 0x83, 0x4a, 0x2c, 0x5c, 0x85, 0x36, 0xac, 0x67,
+    0x1c, 0x34, 0x99, 0x17, 0x03, 0x13, 0x15, 0x42, 0x82, 0xde, 0x03, 0x0a,
+    0x07, 0x05, 0x56, 0x0e, 0x08, 0x02, 0x05, 0xcf, 0x8b, 0x42, 0x0f, 0x19,
+    0x14, 0xa8, 0xfd, 0xbf, 0xcd, 0x55, 0x34, 0x21, 0xbd, 0x15, 0x0e, 0x18,
+    0x13, 0x19, 0x0d, 0x23, 0x76, 0x29, 0x15, 0x0e, 0xeb, 0x02, 0xa3, 0xa6,
+    0xa6, 0x4e, 0x99, 0x12, 0x0d, 0x4f, 0x0b, 0x1c, 0xfe, 0xe2, 0x30, 0x2a,
+    0x86, 0x05, 0xf1, 0x3f, 0x03, 0x04, 0x10, 0x14, 0xe8, 0x18, 0x0d, 0x52,
+    0x12, 0x18, 0xb7, 0x4e, 0xfd, 0x8f, 0x2b, 0x19, 0x2e, 0x18, 0x2f, 0x3a,
+    0x4d, 0x3c, 0x1f, 0x14, 0x2b, 0x07, 0x15, 0x4d, 0x60, 0x3d, 0x3c, 0x2f,
+    0x47, 0x3c, 0x3d, 0x23, 0x40, 0x14, 0x4e, 0x01, 0xfa, 0x28, 0x05, 0x21,
+    0x1a, 0x24, 0x4b, 0x0c, 0x1f, 0x16, 0x0d, 0x11, 0x2a, 0x1b, 0x06, 0x14,
+    0x4b, 0x19, 0x1f, 0x32, 0x22, 0x4c, 0xfe, 0xfd, 0x26, 0x34, 0x46, 0x2e,
+    0x17, 0x01, 0xb5, 0x21, 0x26, 0x19, 0x15, 0x44, 0x25, 0x23, 0x6c, 0x1e,
+    0x71, 0xdf, 0x03, 0x98, 0x03, 0x51, 0x00, 0x22, 0xce, 0x0d, 0x3e, 0x4a,
+    0x00, 0x54, 0xb2, 0x04, 0x02, 0x6c, 0x05, 0x2b, 0x3e, 0x02, 0xf3, 0x03,
+    0x02, 0x2b, 0x22, 0x26, 0x21, 0x12, 0x01, 0x0f, 0x06, 0x54, 0x09, 0x12,
+    0x33, 0x8c, 0x10, 0x06, 0xad, 0x07, 0xf0, 0x95, 0xa3, 0x52, 0x4f, 0x4f,
+    0x37, 0x17, 0x12, 0x3c, 0x25, 0x31, 0x12, 0x30, 0x13, 0x10, 0x1b, 0x25,
+    0x14, 0x0f, 0x06, 0x4a, 0x20, 0x19, 0x34, 0x4f, 0x6e, 0x01, 0x08, 0xfd,
+    0xbc, 0x01, 0xcf, 0xbb, 0xf6, 0xfd, 0xb5, 0x48, 0x3d, 0x33, 0x26, 0x37,
+    0x32, 0x2d, 0x2f, 0x48, 0x32, 0x17, 0xe1, 0x03, 0x06, 0x06, 0x10, 0x52,
+    0x0c, 0x0b, 0x03, 0x0c, 0xdd, 0x50, 0xfe, 0x8b, 0x52, 0x01, 0x4e, 0x30,
+    0x46, 0x4e, 0x25, 0x32, 0x25, 0x4c, 0x4f, 0x26, 0x02, 0xa5, 0xaa, 0xaa,
+    0x53, 0x8a, 0x1a, 0x53, 0x0a, 0x1b, 0xfe, 0xeb, 0x39, 0x30, 0x08, 0x03,
+    0x02, 0x01, 0x57, 0x03, 0x01, 0x06, 0x12, 0x15, 0xe3, 0x20, 0x09, 0x57,
+    0x0f, 0x22, 0xae, 0x53, 0xfd, 0xac, 0xb3, 0x52, 0x52, 0xb3, 0x51, 0x01,
+    0xcd, 0x34, 0x2b, 0x29, 0x3b, 0x33, 0x26, 0x29, 0x35, 0x43, 0x01, 0x3e,
+    0x0f, 0x0e, 0x17, 0x28, 0x11, 0x19, 0x26, 0x08, 0x26, 0xc1, 0x71, 0x71,
+    0x34, 0x1c, 0x37, 0x3e, 0x25, 0x44, 0x25, 0x3e, 0x40, 0x18, 0x00, 0x05,
+    0x00, 0x1e, 0xff, 0xcd, 0x03, 0x9d, 0x03, 0x53, 0x00, 0x0c, 0x00, 0x16,
+    0x00, 0x38, 0x00, 0x54, 0x68, 0x1f, 0x16, 0x13, 0xc2, 0x00, 0x08, 0x88,
+    0x21, 0x24, 0x12, 0x37, 0x88, 0x0b, 0x17, 0x17, 0x97, 0x27, 0x03, 0x3b,
+    0x02, 0x21, 0x07, 0x06, 0x6d, 0x0c, 0x00, 0x6e, 0x09, 0x04, 0xc2, 0x06,
+    0x01, 0x58, 0x02, 0x05, 0xfc, 0x04, 0x01, 0x3c, 0x02, 0xf1, 0xaf, 0x07,
+    0xe8, 0x0e, 0x06, 0x11, 0x52, 0x0d, 0x09, 0x0b, 0x09, 0xa3, 0xfe, 0x54,
+    0x1a, 0x23, 0x1d, 0x24, 0x48, 0x20, 0x24, 0x25, 0x38, 0x3d, 0x78, 0x4a,
+    0x0e, 0x48, 0x2c, 0x3a, 0x25, 0x40, 0x1e, 0x16, 0x47, 0x27, 0x2b, 0x2a,
+    0x3d, 0x35, 0x1d, 0x35, 0x1a, 0x3f, 0x05, 0x1a, 0x1b, 0x2b, 0x44, 0x2c,
+    0x41, 0x1a, 0x44, 0x04, 0x25, 0x61, 0x41, 0x38, 0x02, 0x04, 0x4c, 0x01,
+    0x3f, 0x1f, 0x0f, 0x40, 0x32, 0x24, 0x20, 0x17, 0x53, 0x14, 0x17, 0x01,
+    0x17, 0x45, 0x20, 0x4b, 0x09, 0x52, 0x76, 0x39, 0x75, 0x4e, 0x4f, 0x84,
+    0x3c, 0xd0, 0x40, 0x3c, 0x18, 0x9f, 0x0d, 0x02, 0xca, 0x2a, 0x15, 0x33,
+    0x10, 0x24, 0x21, 0x1e, 0x1f, 0x56, 0x56, 0xfe, 0xf5, 0x37, 0x29, 0x49,
+    0x22, 0x3f, 0x37, 0x3a, 0x43, 0x33, 0xfe, 0xdd, 0x64, 0x14, 0x58, 0x28,
+    0x34, 0x20, 0x48, 0x3d, 0x4a, 0x16, 0x37, 0x3d, 0x2d, 0x2e, 0x3d, 0x28,
+    0x47, 0x2c, 0x2f, 0x08, 0x29, 0x5b, 0x51, 0x53, 0x3d, 0x37, 0x27, 0x55,
+    0x06, 0x35, 0x5e, 0x30, 0x42, 0x61, 0x66, 0x02, 0x6f, 0x82, 0x1d, 0x36,
+    0x5b, 0x60, 0x53, 0x5f, 0x12, 0x4c, 0x40, 0x54, 0xec, 0x86, 0x11, 0x73,
+    0x57, 0x47, 0x5d, 0x68, 0x61, 0x62, 0x43, 0x01, 0x90, 0x74, 0x7b, 0xb8,
+    0x20, 0x00, 0x07, 0x00, 0x1a, 0xff, 0xd0, 0x03, 0x94, 0xf2, 0x26, 0xb4,
+    0x35, 0x00, 0x3e, 0x00, 0x45, 0x00, 0x4f, 0x00, 0x6e, 0x00, 0x75, 0x46,
+    0x0e, 0x00, 0xe3, 0x00, 0x53, 0x2f, 0x02, 0x15, 0x23, 0x35, 0x4e, 0x04,
+    0x00, 0x37, 0x04, 0x11, 0x02, 0x64, 0x03, 0x05, 0x65, 0x03, 0x17, 0x33,
+    0x06, 0x06, 0x14, 0x13, 0x10, 0x02, 0x04, 0x4f, 0x03, 0x07, 0x62, 0x01,
+    0x04, 0x51, 0x11, 0x05, 0x41, 0x01, 0x02, 0x7c, 0x11, 0x04, 0x43, 0x01,
+    0x10, 0x37, 0x44, 0x01, 0xf0, 0xd0, 0x01, 0x44, 0xae, 0xae, 0x64, 0x46,
+    0x2b, 0x13, 0x38, 0x16, 0x1e, 0x4d, 0x1a, 0x27, 0x2d, 0x40, 0x2f, 0x68,
+    0x43, 0x92, 0xc4, 0x4b, 0x44, 0x59, 0x3d, 0x0c, 0x16, 0x0c, 0x59, 0x7b,
+    0x0f, 0x0f, 0x4e, 0x08, 0x0c, 0xd5, 0x22, 0x39, 0x3d, 0x18, 0x2d, 0x2c,
+    0x3a, 0x53, 0xa7, 0x26, 0x61, 0x30, 0x1b, 0x0f, 0x3a, 0x07, 0x22, 0x1e,
+    0x0f, 0xaf, 0x3e, 0x2d, 0x1c, 0x9d, 0x0a, 0x14, 0xb1, 0x1a, 0x1f, 0x0b,
+    0x3b, 0x0b, 0x22, 0x1d, 0x16, 0x36, 0xd5, 0x45, 0x07, 0x36, 0x1a, 0x02,
+    0x12, 0x42, 0x35, 0x21, 0x2b, 0x12, 0x53, 0x13, 0x18, 0x01, 0x04, 0x45,
+    0x0c, 0x30, 0x28, 0x05, 0x02, 0x43, 0x77, 0x3b, 0x6b, 0x43, 0x41, 0x77,
+    0x3e, 0xb7, 0x3b, 0x01, 0x38, 0x14, 0x8f, 0x0a, 0x03, 0x4b, 0xc9, 0x46,
+    0x04, 0x3d, 0x40, 0x39, 0x13, 0x30, 0x11, 0x16, 0x5d, 0x83, 0x27, 0x24,
+    0x2f, 0x28, 0x3e, 0x39, 0x55, 0x46, 0xc9, 0xfc, 0xfa, 0x23, 0x2f, 0x14,
+    0x15, 0x2a, 0x16, 0x48, 0x22, 0x29, 0x16, 0x17, 0x1e, 0x44, 0x4f, 0x3e,
+    0x20, 0x0e, 0x45, 0x1e, 0x1f, 0x3a, 0x36, 0x49, 0x03, 0x1e, 0x3f, 0x27,
+    0x1a, 0x25, 0x0e, 0x33, 0x2c, 0x11, 0xfd, 0xa6, 0x1e, 0x2a, 0x3d, 0x14,
+    0x24, 0x02, 0x05, 0x25, 0x2d, 0x18, 0x28, 0x13, 0x31, 0x28, 0x15, 0x28,
+    0xfd, 0xb4, 0x6a, 0x0d, 0x6c, 0x88, 0x05, 0x1e, 0x31, 0x5b, 0x56, 0x6c,
+    0x52, 0x0e, 0x4a, 0x44, 0x55, 0x7d, 0xbb, 0x4c, 0x0b, 0x02, 0x61, 0x5b,
+    0x44, 0x5b, 0x5a, 0x59, 0x5c, 0x40, 0x01, 0x95, 0x7d, 0x02, 0x7a, 0xbd,
+    0x18, 0x24, 0x30, 0xa1, 0xff, 0xd3, 0x03, 0x95, 0x03, 0x55, 0x00, 0x1d,
+    0x00, 0x22, 0xd6, 0x13, 0x02, 0x4e, 0x12, 0x03, 0x20, 0x1e, 0x03, 0xf2,
+    0x09, 0x03, 0xe4, 0x13, 0x11, 0x02, 0x92, 0x16, 0xf0, 0x36, 0xf4, 0x12,
+    0x07, 0x03, 0x06, 0x03, 0x01, 0x61, 0x97, 0x3e, 0x85, 0x87, 0xee, 0x2b,
+    0xfe, 0xff, 0x8b, 0x88, 0xff, 0x31, 0xeb, 0x89, 0x82, 0x45, 0x91, 0x01,
+    0x79, 0x0e, 0x0b, 0x10, 0x59, 0x84, 0x75, 0x72, 0x35, 0xfe, 0xae, 0x03,
+    0x3f, 0x37, 0x18, 0x0b, 0x16, 0x0b, 0x55, 0xf0, 0x91, 0x6c, 0x4c, 0x5e,
+    0x62, 0x74, 0x74, 0x67, 0x5a, 0x52, 0x6f, 0x8f, 0xf2, 0x55, 0x32, 0x27,
+    0x26, 0x12, 0xfe, 0x52, 0x7b, 0x78, 0xcb, 0x66, 0x0f, 0xf5, 0x02, 0x1b,
+    0xff, 0xca, 0x03, 0x8f, 0x03, 0x59, 0x00, 0x34, 0x00, 0x3c, 0x00, 0x49,
+    0x00, 0x53, 0x00, 0x70, 0x0e, 0x03, 0x01, 0x06, 0x05, 0x01, 0x47, 0x0d,
+    0x04, 0xe3, 0x07, 0x09, 0x09, 0x08, 0x03, 0xae, 0x0e, 0x22, 0x26, 0x27,
+    0x3d, 0x05, 0x11, 0x02, 0xea, 0x32, 0x00, 0xb3, 0x01, 0x15, 0x16, 0xf7,
+    0x0b, 0x16, 0x23, 0xc1, 0x0b, 0x10, 0x16, 0x72, 0x06, 0x08, 0x1e, 0x1b,
+    0x01, 0x6b, 0x10, 0x21, 0x15, 0x14, 0x46, 0x03, 0xf1, 0xb4, 0xf7, 0x08,
+    0x09, 0x0c, 0x52, 0x0e, 0x07, 0x0b, 0xa0, 0x7d, 0x46, 0x0d, 0x13, 0x09,
+    0x04, 0x07, 0x7b, 0xb7, 0xad, 0xad, 0x1f, 0x2a, 0x25, 0x2e, 0x0f, 0x1d,
+    0x1c, 0x11, 0x0d, 0x05, 0xba, 0xba, 0xc5, 0x82, 0x06, 0x04, 0x0e, 0x0f,
+    0x13, 0x3e, 0x6c, 0x0f, 0x3b, 0x13, 0x45, 0x17, 0x3d, 0x1e, 0x42, 0xa0,
+    0x0a, 0x08, 0x0e, 0x0a, 0x10, 0x2f, 0x69, 0x0b, 0x10, 0x1c, 0x06, 0xb2,
+    0xd5, 0x16, 0x1a, 0x23, 0x0b, 0x3d, 0x1d, 0x0f, 0x1b, 0x15, 0x9b, 0x14,
+    0x16, 0x4c, 0x62, 0x57, 0x3e, 0x1e, 0x2b, 0x5f, 0x56, 0x30, 0x01, 0x25,
+    0x64, 0x52, 0x6f, 0x18, 0x0b, 0x31, 0x22, 0x50, 0x02, 0xf7, 0x18, 0x24,
+    0x1a, 0x0c, 0x21, 0x1e, 0x23, 0x4b, 0x17, 0x26, 0x28, 0x12, 0x0b, 0x0d,
+    0x4c, 0x5d, 0x50, 0xda, 0x31, 0x2b, 0x06, 0x04, 0x54, 0x03, 0x05, 0x11,
+    0x14, 0xc5, 0x50, 0x5d, 0x4c, 0x0e, 0x07, 0x20, 0x21, 0x1f, 0x1a, 0x4b,
+    0xfd, 0x6c, 0x70, 0x38, 0x1b, 0x3d, 0x77, 0x29, 0x26, 0x02, 0x70, 0x11,
+    0x0e, 0x1c, 0x12, 0x27, 0x18, 0x15, 0x25, 0x40, 0x15, 0xfe, 0x5d, 0x1c,
+    0x28, 0x30, 0x15, 0x2d, 0x32, 0x17, 0x2c, 0x19, 0x89, 0x60, 0x5f, 0xb8,
+    0x01, 0x28, 0x05, 0x15, 0x13, 0x17, 0x50, 0x11, 0x17, 0x12, 0x05, 0x9c,
+    0x51, 0xfe, 0x20, 0x01, 0xe0, 0x01, 0xb1, 0x6d, 0x34, 0x70, 0x32, 0x29,
+    0x00, 0x86, 0x0e, 0x91, 0xd3, 0x03, 0x7b, 0x03, 0x1c, 0x00, 0x1b, 0x00,
+    0x38, 0xc6, 0x14, 0x14, 0x07, 0x3e, 0x1a, 0x07, 0x4f, 0x25, 0x01, 0x31,
+    0x1b, 0x30, 0x01, 0x33, 0x11, 0x10, 0x2f, 0x0c, 0x00, 0x12, 0x00, 0xe9,
+    0x0a, 0xf0, 0x5d, 0x03, 0x43, 0xfe, 0xad, 0x04, 0x02, 0x04, 0x01, 0x95,
+    0xfe, 0x5e, 0x1b, 0x35, 0x2b, 0x8e, 0x68, 0x3a, 0x5f, 0x82, 0x28, 0x2b,
+    0x17, 0xfe, 0xc9, 0x01, 0x47, 0x06, 0x01, 0x03, 0xfe, 0xe7, 0x01, 0x69,
+    0x58, 0x0f, 0x1d, 0x42, 0x22, 0x24, 0x13, 0x10, 0x08, 0x03, 0x07, 0x01,
+    0x55, 0x01, 0x0a, 0x06, 0x14, 0x2d, 0x2d, 0x15, 0x35, 0x3e, 0x36, 0x35,
+    0x25, 0x03, 0x1c, 0x53, 0x71, 0x25, 0x24, 0x54, 0x82, 0x57, 0x48, 0x84,
+    0x43, 0x51, 0x38, 0x74, 0x42, 0x49, 0x60, 0x54, 0x34, 0x1d, 0x69, 0x53,
+    0xfe, 0x78, 0xfe, 0xe7, 0x21, 0x13, 0x01, 0x01, 0x02, 0x01, 0x07, 0x13,
+    0x17, 0x41, 0x2b, 0x14, 0x1a, 0x4f, 0x2d, 0x2d, 0x15, 0x03, 0x01, 0x03,
+    0x04, 0x33, 0x3e, 0xfe, 0x01, 0x73, 0x5c, 0xff, 0xe1, 0x03, 0x8f, 0x03,
+    0x4e, 0x7c, 0x15, 0x3a, 0x22, 0x00, 0x2c, 0xda, 0x13, 0x16, 0x23, 0xda,
+    0x13, 0x35, 0x25, 0x21, 0x11, 0xc5, 0x1b, 0x16, 0x25, 0xce, 0x13, 0xf0,
+    0x4f, 0xc7, 0x5c, 0x6c, 0x6c, 0x2b, 0x39, 0x2f, 0x60, 0x13, 0x33, 0x2f,
+    0x24, 0x1b, 0x09, 0xfe, 0xe0, 0xfe, 0xb5, 0x01, 0x32, 0xfe, 0xce, 0xe0,
+    0x8e, 0x8e, 0x8e, 0x01, 0x59, 0x1b, 0x2d, 0x28, 0x17, 0x4b, 0x18, 0x26,
+    0x30, 0x16, 0x02, 0x95, 0xb9, 0xb9, 0x57, 0xfe, 0x1c, 0x3b, 0x33, 0x06,
+    0x05, 0x62, 0x03, 0x05, 0x15, 0x1c, 0x01, 0xc8, 0x57, 0x76, 0xfd, 0x29,
+    0x54, 0xfb, 0xfb, 0x01, 0x4d, 0xe0, 0xe0, 0x37, 0x25, 0x53, 0x42, 0x3d,
+    0x2a, 0x3b, 0x46, 0x58, 0x1e, 0x00, 0x06, 0x00, 0x33, 0xff, 0xca, 0x03,
+    0x8e, 0x03, 0x29, 0x00, 0x22, 0x00, 0x27, 0x00, 0x2b, 0x00, 0x30, 0xb4,
+    0x1e, 0x00, 0x92, 0x00, 0x11, 0x21, 0xd1, 0x16, 0x01, 0xe7, 0x1c, 0x08,
+    0x98, 0x27, 0x03, 0x19, 0x03, 0x53, 0x37, 0x23, 0x11, 0x01, 0x35, 0x04,
+    0x11, 0x01, 0x62, 0x04, 0x00, 0xec, 0x11, 0x01, 0x0e, 0x00, 0xf1, 0x5b,
+    0x01, 0xb4, 0xfe, 0x98, 0x03, 0x2a, 0xfe, 0x96, 0x01, 0x29, 0xfe, 0xd1,
+    0x0d, 0x2a, 0x1e, 0x0f, 0x4e, 0xc3, 0x81, 0x15, 0x7f, 0xc6, 0x51, 0x2d,
+    0x21, 0x35, 0xa3, 0x6a, 0x20, 0xbe, 0x55, 0x4c, 0x47, 0x30, 0x56, 0x01,
+    0x27, 0xd0, 0xd0, 0xd0, 0x56, 0x48, 0x20, 0x0b, 0xb0, 0x01, 0xe2, 0xd3,
+    0xd3, 0xd3, 0x02, 0x91, 0x4b, 0x4d, 0x4d, 0x4b, 0xfe, 0x89, 0x51, 0x41,
+    0x0c, 0x05, 0x1c, 0x1b, 0x02, 0x56, 0x06, 0x1d, 0x1d, 0x10, 0x10, 0x2d,
+    0x3c, 0x15, 0x4f, 0x23, 0x38, 0x32, 0x47, 0x2d, 0x01, 0x77, 0xfe, 0xd3,
+    0x0b, 0x45, 0x50, 0x97, 0x4c, 0x4c, 0xfe, 0xe0, 0x2c, 0x2e, 0x3d, 0x4a,
+    0x50, 0x47, 0x09, 0x97, 0x4c, 0x4c, 0x00, 0x09, 0x00, 0x30, 0xc6, 0x2d,
+    0x91, 0x38, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1f, 0x00, 0x23, 0xbe, 0x00,
+    0x52, 0x2f, 0x00, 0x41, 0x00, 0x46, 0x6e, 0x0a, 0x10, 0x03, 0xbd, 0x00,
+    0x15, 0x37, 0x5b, 0x1f, 0x01, 0x5c, 0x1f, 0x39, 0x11, 0x23, 0x12, 0x5e,
+    0x1f, 0x13, 0x25, 0x4d, 0x0a, 0x1f, 0x00, 0x45, 0x0b, 0x02, 0xf0, 0x0d,
+    0x23, 0x03, 0x16, 0xfd, 0x92, 0x78, 0x03, 0x5e, 0xfe, 0x3f, 0x16, 0x18,
+    0x0c, 0x04, 0x35, 0x09, 0x4e, 0x1c, 0x3f, 0x9c, 0x4a, 0x08, 0x50, 0x56,
+    0xc8, 0x27, 0x60, 0xab, 0x01, 0x00, 0xf0, 0x52, 0x01, 0xf1, 0xfe, 0x35,
+    0x01, 0xcb, 0xfe, 0x35, 0x01, 0x3b, 0x3d, 0x41, 0x2a, 0x17, 0x01, 0x64,
+    0x2d, 0x48, 0x44, 0x6d, 0x25, 0x73, 0x4f, 0x44, 0x5b, 0x2c, 0x97, 0x32,
+    0x3a, 0x1e, 0xab, 0x03, 0x38, 0xfe, 0xe7, 0x01, 0x19, 0xfe, 0xb6, 0x42,
+    0xfe, 0xd6, 0x04, 0x04, 0x03, 0x48, 0x09, 0x01, 0x65, 0x59, 0x04, 0x09,
+    0x14, 0x06, 0x47, 0x05, 0x01, 0x58, 0xfe, 0xb4, 0x06, 0x0f, 0x3d, 0x55,
+    0x91, 0x41, 0x41, 0x7e, 0x40, 0x40, 0xf1, 0x32, 0x32, 0x69, 0x31, 0x31,
+    0xfd, 0x83, 0x32, 0x4b, 0x6e, 0x41, 0x44, 0x67, 0x4f, 0x33, 0x2a, 0x47,
+    0x30, 0x40, 0x3a, 0x2f, 0x42, 0xc8, 0x3a, 0x3f, 0x47, 0xe6, 0x0f, 0xb1,
+    0x1c, 0xff, 0xd5, 0x03, 0x94, 0x03, 0x24, 0x00, 0x22, 0x00, 0x3e, 0x0e,
+    0x1e, 0x30, 0x4d, 0x00, 0x52, 0x5e, 0x49, 0x13, 0x06, 0x2a, 0x02, 0x10,
+    0x33, 0xe6, 0x02, 0x10, 0x27, 0xaa, 0x10, 0x06, 0x06, 0x07, 0x00, 0x72,
+    0x37, 0x10, 0x21, 0x97, 0x18, 0x00, 0x45, 0x02, 0x1a, 0x11, 0x41, 0x04,
+    0x03, 0xf1, 0x0c, 0x03, 0xac, 0x01, 0x01, 0xf8, 0x00, 0x12, 0x11, 0xec,
+    0x00, 0xf5, 0x91, 0x57, 0x06, 0x03, 0x2b, 0x38, 0x33, 0x47, 0x0f, 0x2f,
+    0x28, 0x1f, 0x18, 0x0f, 0x02, 0x03, 0x01, 0xf3, 0x01, 0x54, 0x1e, 0x53,
+    0x04, 0x3c, 0x69, 0x30, 0x61, 0x45, 0x38, 0x55, 0x21, 0x4d, 0x01, 0x94,
+    0xfc, 0xdc, 0x1c, 0x09, 0x0c, 0x0a, 0x01, 0x19, 0x28, 0x32, 0x2a, 0x27,
+    0x11, 0x17, 0x24, 0x17, 0x15, 0x08, 0x84, 0x03, 0x0d, 0x10, 0x2d, 0x4d,
+    0x01, 0x1e, 0x81, 0x81, 0x81, 0x01, 0x99, 0x3a, 0x43, 0x24, 0x15, 0x7a,
+    0x33, 0x3d, 0x1c, 0xa6, 0x02, 0xe0, 0x60, 0x30, 0x26, 0x06, 0x05, 0x51,
+    0x03, 0x01, 0x0e, 0x17, 0x23, 0x21, 0xef, 0x4b, 0x85, 0x70, 0x06, 0x41,
+    0x3e, 0x46, 0x40, 0x4b, 0x3c, 0x40, 0x27, 0x3e, 0x03, 0x4f, 0xfc, 0xff,
+    0x45, 0x27, 0x32, 0x83, 0x62, 0x01, 0x7d, 0xfd, 0x30, 0x36, 0x2e, 0x06,
+    0x05, 0x55, 0x03, 0x06, 0x13, 0x16, 0xad, 0x4f, 0x46, 0x51, 0x57, 0x22,
+    0x01, 0x68, 0x97, 0x5b, 0x3c, 0xe2, 0x93, 0x93, 0xfe, 0x2b, 0x3c, 0x64,
+    0x91, 0xfe, 0xa2, 0xf3, 0x4f, 0x52, 0x68, 0x00, 0x09, 0x00, 0x29, 0xff,
+    0xd0, 0x03, 0x60, 0x03, 0x49, 0x00, 0x13, 0xc2, 0x2a, 0x31, 0x33, 0x00,
+    0x4f, 0xdc, 0x13, 0x26, 0x00, 0x13, 0x9a, 0x14, 0x01, 0xd4, 0x1c, 0x00,
+    0x44, 0x32, 0x07, 0xd1, 0x29, 0x07, 0xe8, 0x01, 0x14, 0x13, 0xae, 0x26,
+    0x29, 0x27, 0x16, 0x16, 0x01, 0x25, 0x27, 0x17, 0x16, 0x01, 0x03, 0x32,
+    0x00, 0x20, 0x14, 0x07, 0x30, 0x00, 0xf0, 0x09, 0x87, 0x4d, 0xa0, 0x4d,
     0x47, 0x47, 0x49, 0xfe, 0x21, 0x5c, 0x41, 0x11, 0x26, 0x1d, 0x31, 0x3f,
-    0x2f, 0x28, 0x1b, 0x33, 0x3c, 0x01, 0x4b, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+    0x2f, 0x28, 0x1b, 0x33, 0x3c, 0x01, 0x4b, 0xa0, 0x01, 0x00, 0xf1, 0x67,
     0x91, 0x14, 0x16, 0x10, 0x2d, 0x0f, 0x37, 0x15, 0x24, 0x3c, 0xcf, 0x16,
     0x0c, 0x0b, 0x01, 0x35, 0x23, 0x32, 0x19, 0x28, 0x22, 0x11, 0x46, 0x1a,
     0x16, 0x06, 0xa3, 0x06, 0x0b, 0x0a, 0x31, 0x29, 0x4a, 0x01, 0x62, 0x9b,
@@ -1687,293 +1333,232 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x50, 0x50, 0xfe, 0x76, 0x10, 0x15, 0x0f, 0x2d, 0x12, 0x3a, 0x1b, 0x21,
     0x3a, 0x32, 0x4e, 0x2d, 0x8f, 0x70, 0x01, 0x43, 0xfd, 0x3e, 0x3c, 0x31,
     0x07, 0x04, 0x01, 0x58, 0x03, 0x08, 0x15, 0x18, 0x8e, 0x3c, 0x31, 0x2d,
-    0x5c, 0x37, 0x33, 0x01, 0x4b, 0x9a, 0x36, 0x28, 0x3c, 0xe7, 0x99, 0x99,
-    0x00, 0x01, 0x00, 0x24, 0xff, 0xe1, 0x03, 0x97, 0x03, 0x51, 0x00, 0x25,
-    0x00, 0x00, 0x01, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x11, 0x23, 0x11, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x36, 0x37, 0x21, 0x35, 0x01, 0xb4, 0xfe, 0xd3, 0x01, 0x2d, 0x55, 0x01,
-    0x2d, 0xfe, 0xd3, 0x01, 0x6c, 0xfe, 0xe1, 0x30, 0x4a, 0x64, 0x63, 0x36,
-    0x69, 0x5f, 0x5f, 0x31, 0x55, 0x2f, 0x61, 0x55, 0x73, 0x38, 0x6f, 0x5c,
-    0x47, 0x2f, 0xfe, 0xe4, 0x01, 0xe5, 0x96, 0x52, 0x84, 0x84, 0x52, 0x96,
-    0x54, 0x52, 0x4c, 0x64, 0x35, 0x4d, 0x40, 0x65, 0x67, 0x6e, 0xfe, 0x5a,
-    0x01, 0xa7, 0x73, 0x67, 0x58, 0x46, 0x4a, 0x3d, 0x5e, 0x49, 0x53, 0x54,
-    0x00, 0x01, 0x00, 0x19, 0xff, 0xd9, 0x03, 0xa2, 0x03, 0x50, 0x00, 0x27,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x23, 0x11, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x35, 0x23, 0x35, 0x33, 0x11, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x36, 0x37, 0x36, 0x37, 0x21, 0x35, 0x01, 0xb0, 0x5b, 0x01, 0x65, 0xfe,
-    0xf2, 0x2f, 0x48, 0x5c, 0x6d, 0x44, 0x68, 0x5f, 0x5c, 0x2a, 0x06, 0xc7,
-    0xc7, 0x5b, 0xc3, 0xc3, 0x06, 0x2e, 0x52, 0x5b, 0x71, 0x45, 0x6f, 0x59,
-    0x48, 0x2d, 0xfe, 0xf9, 0x02, 0xb9, 0x97, 0x97, 0x56, 0x7b, 0x68, 0x85,
-    0x51, 0x50, 0x59, 0x92, 0x90, 0x8e, 0xfe, 0x6f, 0x55, 0xa4, 0xa4, 0x55,
-    0x01, 0x91, 0x93, 0x81, 0x8e, 0x6d, 0x48, 0x60, 0x87, 0x6c, 0x74, 0x56,
-    0x00, 0x02, 0x00, 0x15, 0xff, 0xd3, 0x03, 0x96, 0x03, 0x4f, 0x00, 0x1f,
-    0x00, 0x4c, 0x00, 0x00, 0x01, 0x15, 0x33, 0x15, 0x23, 0x15, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x17, 0x11, 0x23, 0x11,
-    0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x23, 0x35, 0x33, 0x35,
-    0x12, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x11, 0x21, 0x11, 0x14, 0x1e, 0x01,
-    0x1f, 0x01, 0x32, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x23,
-    0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x01, 0x0c, 0x7e, 0x7e,
-    0x2b, 0x2e, 0x31, 0x11, 0x39, 0x17, 0x26, 0x0d, 0x01, 0x18, 0x01, 0x53,
-    0x02, 0x2d, 0x35, 0x40, 0x39, 0x37, 0x1d, 0x14, 0x80, 0x83, 0x9b, 0x30,
-    0x0e, 0x11, 0x0e, 0x01, 0x46, 0x03, 0x09, 0x0a, 0x09, 0x08, 0x0a, 0x0b,
-    0x09, 0x01, 0x06, 0x01, 0x52, 0x04, 0x04, 0x04, 0x14, 0x21, 0x1c, 0x0e,
-    0x19, 0x19, 0x0e, 0x27, 0x22, 0x9c, 0x0f, 0x12, 0x0f, 0x33, 0x29, 0x4e,
-    0x03, 0x4f, 0xae, 0x54, 0x3b, 0x28, 0x33, 0x36, 0x1b, 0x37, 0x22, 0x2d,
-    0x10, 0x01, 0x1b, 0x01, 0xfe, 0x2d, 0x01, 0xb3, 0x05, 0x6c, 0x5b, 0x2e,
-    0x5d, 0x7f, 0x44, 0x42, 0x54, 0xae, 0xfc, 0xe4, 0x4f, 0x2b, 0x34, 0x89,
-    0x68, 0x01, 0x44, 0xfd, 0x67, 0x17, 0x15, 0x07, 0x02, 0x01, 0x03, 0x03,
-    0x15, 0x1d, 0x36, 0x45, 0x16, 0x5b, 0x2c, 0x2a, 0x2e, 0x13, 0x02, 0x01,
-    0x01, 0x03, 0x32, 0x42, 0x02, 0x5a, 0xef, 0x6a, 0x97, 0x3b, 0x35, 0x5b,
-    0x33, 0x31, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0xff, 0xd1, 0x03, 0xa3,
-    0x03, 0x55, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x3a, 0x00, 0x00, 0x01, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x2f, 0x01,
-    0x11, 0x23, 0x11, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x23,
-    0x35, 0x33, 0x35, 0x00, 0x37, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x35,
-    0x21, 0x15, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x12, 0x16, 0x1f, 0x01, 0x36, 0x37, 0x21, 0x01, 0x14, 0x7a,
-    0x7a, 0x2b, 0x37, 0x37, 0x11, 0x3f, 0x15, 0x2c, 0x2a, 0x55, 0x01, 0x33,
-    0x34, 0x44, 0x43, 0x32, 0x21, 0x13, 0x82, 0x85, 0x01, 0x23, 0x5f, 0x18,
-    0x0a, 0x2c, 0x37, 0x16, 0x1f, 0x01, 0xd8, 0x34, 0x64, 0x10, 0x09, 0x57,
-    0x9e, 0x3b, 0x98, 0x5b, 0x62, 0x9c, 0x3d, 0xd7, 0x32, 0x28, 0x0f, 0x5e,
-    0x2b, 0xfe, 0xfa, 0x03, 0x55, 0xb4, 0x54, 0x30, 0x29, 0x3a, 0x3e, 0x18,
-    0x3b, 0x22, 0x33, 0x33, 0xfe, 0x24, 0x01, 0xb0, 0x02, 0x79, 0x54, 0x33,
-    0x65, 0x75, 0x46, 0x44, 0x54, 0xb4, 0xfd, 0x38, 0x71, 0x26, 0x14, 0x50,
-    0xbc, 0x7e, 0x55, 0x54, 0xfc, 0xa3, 0x1a, 0x0c, 0x70, 0x6b, 0x4f, 0x70,
-    0x71, 0x72, 0x72, 0x4a, 0x02, 0x3a, 0xa8, 0x49, 0x1a, 0x91, 0xe7, 0x00,
-    0x00, 0x03, 0x00, 0x17, 0xff, 0xcf, 0x03, 0x99, 0x03, 0x50, 0x00, 0x1d,
-    0x00, 0x42, 0x00, 0x47, 0x00, 0x00, 0x13, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x11, 0x23, 0x11,
-    0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x23, 0x35, 0x33, 0x35,
-    0x12, 0x37, 0x36, 0x3d, 0x01, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x15, 0x21, 0x15, 0x06, 0x0f, 0x01, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x23, 0x06, 0x07, 0x0e, 0x01, 0x07,
-    0x27, 0x00, 0x17, 0x36, 0x37, 0x23, 0xfe, 0x70, 0x70, 0x2f, 0x22, 0x28,
-    0x11, 0x37, 0x14, 0x1d, 0x10, 0x12, 0x4f, 0x01, 0x25, 0x2d, 0x45, 0x36,
-    0x2f, 0x16, 0x16, 0x6b, 0x72, 0xa7, 0x1d, 0x1c, 0xd9, 0xf3, 0x12, 0x6b,
-    0x61, 0x5d, 0x63, 0x01, 0x7c, 0x2e, 0x54, 0x0a, 0x4c, 0x7c, 0x33, 0x7f,
-    0x4d, 0x58, 0x89, 0x33, 0x8e, 0x51, 0x56, 0x2c, 0x02, 0x03, 0x1b, 0x10,
-    0x34, 0x28, 0x4d, 0x01, 0x4e, 0x43, 0x48, 0x23, 0xd1, 0x03, 0x50, 0xae,
-    0x51, 0x2d, 0x2d, 0x28, 0x2d, 0x1b, 0x3a, 0x1e, 0x22, 0x14, 0x14, 0xfe,
-    0x23, 0x01, 0xb7, 0x03, 0x64, 0x56, 0x2d, 0x5d, 0x76, 0x36, 0x49, 0x51,
-    0xae, 0xfd, 0x26, 0x6e, 0x6f, 0xb4, 0xf6, 0x0f, 0x30, 0x56, 0x15, 0x0d,
-    0x0d, 0x09, 0x6d, 0x50, 0xbb, 0x74, 0x0e, 0x54, 0x3f, 0x4e, 0x4b, 0x57,
-    0x58, 0x4e, 0x4c, 0x4b, 0x52, 0x7b, 0xbc, 0xbb, 0x70, 0x3d, 0x71, 0x3d,
-    0x2e, 0x01, 0x56, 0x65, 0x65, 0x92, 0x00, 0x00, 0x00, 0x04, 0x00, 0x14,
-    0xff, 0xe0, 0x03, 0x96, 0x03, 0x61, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x3f,
-    0x00, 0x47, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x24, 0x37, 0x36, 0x37,
-    0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x36, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x06, 0x07, 0x27,
-    0x37, 0x23, 0x15, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x31, 0x11, 0x23,
-    0x11, 0x06, 0x07, 0x27, 0x05, 0x35, 0x21, 0x15, 0x12, 0x17, 0x36, 0x37,
-    0x23, 0x06, 0x0f, 0x01, 0x03, 0x35, 0xfe, 0x5b, 0xfe, 0xc5, 0x20, 0x1d,
-    0x11, 0x70, 0x73, 0x50, 0x60, 0x34, 0x26, 0x32, 0x1f, 0x50, 0x0c, 0x15,
-    0x01, 0x1d, 0x3c, 0x62, 0x5d, 0x8a, 0x1c, 0xa6, 0x68, 0x5e, 0x7e, 0x20,
-    0x18, 0x20, 0x92, 0x5c, 0x33, 0x2e, 0x1e, 0x2b, 0x3d, 0x12, 0x5b, 0x42,
-    0x31, 0x39, 0x18, 0x13, 0x0f, 0x50, 0x29, 0x29, 0x40, 0x02, 0xd0, 0xfe,
-    0xfc, 0x47, 0x42, 0x50, 0x34, 0xea, 0x04, 0x03, 0x07, 0x01, 0x4d, 0xfe,
-    0xa9, 0x01, 0x57, 0x2e, 0x4f, 0x46, 0x44, 0x52, 0xb0, 0xb0, 0x4d, 0x3a,
-    0x3d, 0x4a, 0x47, 0x19, 0x1d, 0x28, 0x4c, 0x6c, 0x58, 0x35, 0x21, 0x51,
-    0x2e, 0x44, 0x42, 0x2f, 0x0c, 0x08, 0x50, 0x2f, 0x3a, 0x2c, 0x3d, 0x27,
-    0x2d, 0x3a, 0x13, 0x1c, 0x41, 0x3d, 0x34, 0x21, 0x17, 0x12, 0xfe, 0x10,
-    0x01, 0xaa, 0x67, 0x4e, 0x31, 0xc2, 0xb9, 0xb9, 0x02, 0x11, 0x33, 0x42,
-    0x52, 0x08, 0x04, 0x0b, 0x00, 0x03, 0x00, 0x25, 0xff, 0xd5, 0x03, 0x96,
-    0x03, 0x57, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x00, 0x01, 0x35,
-    0x21, 0x11, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x23, 0x15, 0x23, 0x35, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x36, 0x37, 0x21, 0x35, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
-    0x01, 0xb5, 0xfe, 0xea, 0x01, 0x06, 0x55, 0x01, 0x6a, 0xfe, 0x96, 0x01,
-    0x25, 0xfe, 0xeb, 0x01, 0x6a, 0xfe, 0xf0, 0x2f, 0x2e, 0x58, 0x7d, 0x1f,
-    0x7c, 0x5d, 0x5b, 0x38, 0x01, 0x55, 0x03, 0x39, 0x50, 0x61, 0x81, 0x22,
-    0xb7, 0x74, 0xfe, 0xfb, 0x02, 0x7d, 0xfe, 0x2d, 0x01, 0xd3, 0xfe, 0x2d,
-    0x01, 0x15, 0x3d, 0x01, 0x48, 0xbd, 0x3e, 0x46, 0x39, 0xfe, 0xb8, 0x3d,
-    0x49, 0x2b, 0x1a, 0x32, 0x1e, 0x4b, 0x26, 0x37, 0x37, 0x4c, 0xf7, 0xf7,
-    0x46, 0x33, 0x3d, 0x28, 0x4b, 0x2a, 0x69, 0x49, 0x82, 0x3e, 0x3e, 0x80,
-    0x3d, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x0b, 0x03, 0x8e,
-    0x03, 0x0f, 0x00, 0x13, 0x00, 0x00, 0x37, 0x11, 0x33, 0x11, 0x33, 0x11,
-    0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15,
-    0x21, 0x35, 0xbd, 0x58, 0xc4, 0xfe, 0x83, 0x03, 0x14, 0xfe, 0xc3, 0x01,
-    0x1d, 0xfe, 0xe3, 0x01, 0x5b, 0xfc, 0xa0, 0x61, 0x01, 0xdf, 0xfe, 0x21,
-    0x02, 0x57, 0x57, 0x57, 0xe1, 0x57, 0xfe, 0xe1, 0x56, 0x56, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x2b, 0xff, 0xf5, 0x03, 0x88, 0x03, 0x51, 0x00, 0x15,
-    0x00, 0x37, 0x00, 0x00, 0x36, 0x37, 0x11, 0x33, 0x11, 0x3f, 0x01, 0x11,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x01, 0x33, 0x11, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x11, 0x14, 0x1e, 0x01, 0x33, 0x32, 0x3e, 0x01, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x22, 0x2e, 0x01, 0x35, 0x4a,
-    0x30, 0x55, 0x4d, 0x1c, 0x56, 0x7c, 0x7c, 0x5f, 0x20, 0x0a, 0x60, 0x8f,
-    0x95, 0x59, 0x0f, 0x01, 0xfc, 0x56, 0x32, 0x1d, 0x3e, 0x38, 0x3c, 0x3e,
-    0x4f, 0x39, 0x3b, 0x0a, 0x23, 0x2a, 0x28, 0x20, 0x0d, 0x03, 0x07, 0x02,
-    0x53, 0x03, 0x0a, 0x06, 0x1c, 0x42, 0x43, 0x4c, 0x48, 0x19, 0x5e, 0x0a,
-    0x02, 0x41, 0xfd, 0xd1, 0x11, 0x06, 0x02, 0xb1, 0xff, 0x56, 0xfe, 0xb9,
-    0x19, 0x0a, 0x5c, 0x1e, 0x1d, 0x23, 0x0d, 0x58, 0x02, 0xf7, 0xfe, 0xb5,
-    0x25, 0x19, 0x35, 0x38, 0x46, 0x3e, 0x3e, 0x2e, 0x2a, 0xfe, 0xf6, 0x1d,
-    0x19, 0x09, 0x08, 0x1b, 0x22, 0x3f, 0x33, 0x19, 0x2e, 0x51, 0x32, 0x30,
-    0x15, 0x01, 0x16, 0x35, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x31,
-    0xff, 0xdf, 0x03, 0x9c, 0x03, 0x5b, 0x00, 0x43, 0x00, 0x4d, 0x00, 0x00,
-    0x01, 0x35, 0x33, 0x15, 0x33, 0x26, 0x2f, 0x01, 0x26, 0x27, 0x37, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x33, 0x15, 0x21, 0x15, 0x16, 0x17, 0x36, 0x37,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x11, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x22, 0x2f,
-    0x01, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x36, 0x37, 0x36, 0x37, 0x35, 0x21, 0x35, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x01, 0xb5, 0x57, 0xba, 0x17, 0x1e,
-    0x24, 0x18, 0x05, 0x35, 0x22, 0x26, 0x27, 0x19, 0x27, 0x94, 0xfe, 0x92,
-    0x26, 0x35, 0x29, 0x21, 0x3f, 0x28, 0x42, 0x23, 0x4e, 0x22, 0x30, 0x12,
-    0x68, 0x8b, 0x34, 0xa6, 0x5f, 0x2e, 0x29, 0x13, 0x30, 0x2d, 0x21, 0x26,
-    0x17, 0x0c, 0x11, 0x28, 0x29, 0x20, 0x1b, 0x08, 0x42, 0x3e, 0x72, 0x60,
-    0x32, 0x5e, 0x7c, 0x6e, 0x3c, 0xfe, 0x98, 0x70, 0x19, 0x38, 0x30, 0x1b,
-    0x41, 0x15, 0x33, 0x2b, 0x26, 0x02, 0xbc, 0x97, 0x97, 0x16, 0x19, 0x1f,
-    0x14, 0x05, 0x38, 0x1b, 0x20, 0x21, 0x19, 0x2a, 0x53, 0x1c, 0x68, 0x53,
-    0x25, 0x24, 0x40, 0x34, 0x38, 0x2e, 0x4e, 0x22, 0x2a, 0x16, 0x76, 0x48,
-    0x4f, 0x63, 0x7b, 0x3c, 0x4b, 0xfe, 0xca, 0x2a, 0x30, 0x19, 0x05, 0x04,
-    0x01, 0x5f, 0x04, 0x07, 0x15, 0x19, 0xc0, 0x36, 0x2d, 0x54, 0x35, 0x50,
-    0x2f, 0x58, 0x4f, 0x34, 0xcb, 0x53, 0x69, 0x18, 0x42, 0x37, 0x28, 0x39,
-    0x21, 0x40, 0x36, 0x24, 0x00, 0x08, 0x00, 0x27, 0xff, 0xde, 0x03, 0x6f,
-    0x03, 0x52, 0x00, 0x09, 0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x3f,
-    0x00, 0x43, 0x00, 0x47, 0x00, 0x51, 0x00, 0x00, 0x36, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07,
-    0x26, 0x27, 0x26, 0x27, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27,
-    0x17, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x14, 0x0e, 0x01, 0x07, 0x06,
-    0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x21, 0x15, 0x23,
-    0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x00, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x69, 0x20, 0x23, 0x0d, 0x53, 0x13,
-    0x1b, 0x27, 0x16, 0x55, 0x0c, 0x26, 0x35, 0x3a, 0x20, 0x35, 0x17, 0x3e,
-    0x36, 0x26, 0x5b, 0x20, 0x3b, 0x36, 0x22, 0x31, 0x21, 0x33, 0x3e, 0x1f,
-    0x01, 0x1b, 0x2b, 0x1e, 0x28, 0x1e, 0x40, 0x19, 0x29, 0x32, 0x17, 0x1d,
-    0xd6, 0x57, 0xd6, 0x0f, 0x26, 0x27, 0x36, 0x3d, 0x11, 0x1e, 0x2c, 0x20,
-    0x18, 0x08, 0xfe, 0xa8, 0x55, 0x01, 0xad, 0xfe, 0xa8, 0x01, 0x58, 0xfe,
-    0xa8, 0x01, 0x28, 0x21, 0x2f, 0x13, 0x40, 0x24, 0x21, 0x20, 0x2a, 0x3c,
-    0x3f, 0x69, 0x6f, 0x44, 0x17, 0x5d, 0x5b, 0x77, 0x33, 0x1d, 0x02, 0x6d,
-    0x16, 0x2a, 0x2c, 0x20, 0x46, 0x17, 0x33, 0x2b, 0x19, 0x01, 0x11, 0x11,
-    0x2d, 0x26, 0x1f, 0x49, 0x20, 0x28, 0x2e, 0x14, 0x3f, 0x28, 0x24, 0x2a,
-    0x2a, 0x36, 0x25, 0x2d, 0x37, 0x17, 0xb4, 0x01, 0x06, 0xfe, 0xfa, 0xfe,
-    0x0d, 0x2a, 0x2c, 0x17, 0x05, 0x07, 0x02, 0x58, 0x03, 0x05, 0x14, 0x1a,
-    0x39, 0xc5, 0x01, 0x14, 0x5f, 0x5f, 0xaf, 0x5c, 0x5c, 0x01, 0x16, 0x29,
-    0x35, 0x1e, 0x33, 0x31, 0x26, 0x27, 0x28, 0x3a, 0x00, 0x02, 0x00, 0x1d,
-    0xff, 0xd0, 0x03, 0x9f, 0x03, 0x4e, 0x00, 0x40, 0x00, 0x45, 0x00, 0x00,
-    0x01, 0x11, 0x33, 0x15, 0x23, 0x15, 0x14, 0x07, 0x33, 0x11, 0x36, 0x37,
-    0x3e, 0x01, 0x37, 0x11, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x07, 0x15, 0x21,
-    0x15, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07,
-    0x27, 0x36, 0x37, 0x26, 0x27, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27, 0x15,
-    0x23, 0x11, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x35,
-    0x11, 0x33, 0x15, 0x33, 0x11, 0x00, 0x17, 0x36, 0x37, 0x23, 0x01, 0x67,
-    0x41, 0xe7, 0x01, 0xa6, 0x2a, 0x15, 0x0f, 0x0d, 0x01, 0xeb, 0xb0, 0x16,
-    0x4f, 0xc0, 0x54, 0x01, 0x56, 0x20, 0x4f, 0x04, 0x0a, 0x47, 0x6f, 0x32,
-    0x6b, 0x4a, 0x4e, 0x7d, 0x34, 0x80, 0x50, 0x52, 0x1f, 0x08, 0x02, 0x17,
-    0x1a, 0x3d, 0x3a, 0x51, 0x57, 0x05, 0x0a, 0x12, 0x30, 0x50, 0x2d, 0x14,
-    0x12, 0x51, 0x56, 0x01, 0x66, 0x3d, 0x42, 0x18, 0xb2, 0x03, 0x4e, 0xfe,
-    0xf9, 0x4f, 0x41, 0x1e, 0x0f, 0xfe, 0xad, 0x4e, 0x57, 0x3c, 0x8d, 0x5e,
-    0x01, 0x00, 0x13, 0x2c, 0x55, 0x13, 0x1d, 0x07, 0x6e, 0x4f, 0xaf, 0x7a,
-    0x07, 0x0e, 0x5b, 0x45, 0x47, 0x49, 0x5e, 0x5a, 0x51, 0x45, 0x4d, 0x5d,
-    0x85, 0xb5, 0xb6, 0x6d, 0x77, 0x69, 0x1d, 0x2f, 0x01, 0x55, 0x63, 0x3b,
-    0x6a, 0x61, 0x24, 0x58, 0x61, 0x68, 0xb3, 0x01, 0x75, 0xf6, 0x01, 0x07,
-    0xfe, 0x1d, 0x69, 0x69, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x38,
-    0xff, 0xd9, 0x03, 0x86, 0x03, 0x56, 0x00, 0x09, 0x00, 0x15, 0x00, 0x4e,
-    0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x00, 0x12, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x07, 0x21, 0x35, 0x33, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x23, 0x35, 0x21, 0x13, 0x21, 0x27, 0x26, 0x27, 0x37,
-    0x16, 0x1f, 0x01, 0x21, 0x15, 0x21, 0x17, 0x06, 0x07, 0x36, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x07, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x36, 0x37, 0x21, 0x1f, 0x01, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27,
-    0x04, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x72, 0x3c, 0x33, 0x2c,
-    0x2c, 0x32, 0x2f, 0x31, 0x46, 0x27, 0x02, 0x01, 0x80, 0x52, 0x01, 0x7c,
-    0xfe, 0x84, 0x52, 0xfe, 0x80, 0x14, 0x01, 0x71, 0x04, 0x09, 0x10, 0x59,
-    0x0d, 0x0f, 0x07, 0x01, 0x56, 0xfe, 0x79, 0x0d, 0x31, 0x40, 0x58, 0x2c,
-    0x37, 0x1d, 0x3a, 0x33, 0x4f, 0x59, 0x30, 0x4b, 0x21, 0x2f, 0x19, 0x16,
-    0x18, 0x38, 0x29, 0x15, 0x24, 0x1a, 0x41, 0x0e, 0x0d, 0x1d, 0x5f, 0x0b,
-    0x71, 0x64, 0x0a, 0x28, 0x1a, 0x38, 0x47, 0x1d, 0x54, 0x3c, 0x0c, 0x1a,
-    0x18, 0x29, 0x36, 0xfe, 0xad, 0x35, 0x49, 0x2d, 0x18, 0x37, 0x26, 0x22,
-    0x1b, 0x27, 0x02, 0x6f, 0x2d, 0x2d, 0x20, 0x31, 0x29, 0x33, 0x30, 0x29,
-    0x2a, 0x37, 0x2c, 0x2d, 0x35, 0x30, 0x2e, 0x1d, 0x3a, 0x32, 0x32, 0x01,
-    0x73, 0x26, 0x20, 0x21, 0x43, 0x26, 0x1d, 0x21, 0x23, 0x4a, 0x87, 0x3f,
-    0x3f, 0x50, 0xaa, 0xaa, 0x02, 0x76, 0x0b, 0x1d, 0x24, 0x11, 0x1c, 0x2e,
-    0x13, 0x4f, 0x07, 0x3e, 0x31, 0x04, 0x05, 0x39, 0x23, 0x2e, 0x3a, 0x4d,
-    0x55, 0x20, 0x04, 0x03, 0x04, 0x03, 0x21, 0x20, 0x2c, 0x34, 0x22, 0x36,
-    0x2d, 0x29, 0x1b, 0x17, 0x03, 0x08, 0x01, 0x08, 0x03, 0x4e, 0x05, 0x15,
-    0x29, 0x44, 0x03, 0x06, 0x02, 0x42, 0x01, 0x15, 0x23, 0x42, 0x19, 0x3a,
-    0x25, 0x19, 0x3c, 0x28, 0x1d, 0x19, 0x1e, 0x24, 0x21, 0x23, 0x1c, 0x39,
-    0x28, 0x24, 0x23, 0x17, 0x40, 0x44, 0x18, 0x1e, 0x23, 0x26, 0x41, 0x18,
-    0x2a, 0x23, 0x1d, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x04, 0x03, 0x87,
-    0x03, 0x4f, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x35, 0x23, 0x06, 0x07, 0x27,
-    0x3e, 0x01, 0x37, 0x17, 0x06, 0x07, 0x33, 0x35, 0x33, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x01, 0xc4, 0xd9, 0x28, 0x40, 0x4e, 0x3e, 0x54, 0x1b, 0x58,
-    0x0f, 0x1c, 0xb5, 0x5b, 0x01, 0x43, 0xfe, 0xbd, 0x01, 0x23, 0xfe, 0xdd,
-    0x01, 0x68, 0xfc, 0xc3, 0x01, 0x7a, 0xfe, 0xdc, 0x01, 0x8d, 0xb7, 0x59,
-    0x5e, 0x2e, 0x56, 0xb4, 0x69, 0x12, 0x39, 0x49, 0xb5, 0xb5, 0x56, 0xb7,
-    0x55, 0xdf, 0x55, 0x55, 0xdf, 0x55, 0x00, 0x00, 0x00, 0x05, 0x00, 0x23,
-    0xff, 0xcd, 0x03, 0x4b, 0x03, 0x20, 0x00, 0x1f, 0x00, 0x24, 0x00, 0x28,
-    0x00, 0x2c, 0x00, 0x30, 0x00, 0x00, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x35,
-    0x11, 0x21, 0x11, 0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32,
-    0x3e, 0x01, 0x3d, 0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x01, 0x35, 0x23, 0x1d, 0x01, 0x37, 0x35, 0x23, 0x15, 0x05,
-    0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x43, 0x27, 0x0a, 0x0b, 0x08,
-    0x02, 0xc4, 0x29, 0x3a, 0x22, 0x4f, 0x11, 0x22, 0x1e, 0x27, 0x1d, 0x0a,
-    0xe1, 0x57, 0xe2, 0x04, 0x0b, 0x16, 0x41, 0x51, 0x01, 0x99, 0xde, 0xde,
-    0xde, 0x02, 0x16, 0xe1, 0xe1, 0xe1, 0x29, 0x51, 0x2a, 0x28, 0x65, 0x49,
-    0x01, 0xa6, 0xfd, 0x3c, 0x3c, 0x33, 0x07, 0x05, 0x5d, 0x04, 0x05, 0x14,
-    0x1b, 0x85, 0xfe, 0xf8, 0x01, 0x08, 0x37, 0x31, 0x62, 0x5c, 0x2e, 0x01,
-    0x4e, 0x95, 0x7e, 0x17, 0xe8, 0x9b, 0x9b, 0xe8, 0x95, 0x95, 0xe8, 0x9b,
-    0x9b, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x39, 0xff, 0xf7, 0x03, 0x85,
-    0x03, 0x1f, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17,
-    0x00, 0x1b, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x11, 0x21, 0x11, 0x33, 0x11,
-    0x21, 0x11, 0x27, 0x21, 0x15, 0x21, 0x17, 0x21, 0x11, 0x21, 0x37, 0x35,
-    0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x05, 0x35, 0x23, 0x15, 0x37, 0x35,
-    0x23, 0x15, 0xbc, 0x02, 0x44, 0x55, 0xfd, 0x12, 0x2e, 0x03, 0x4c, 0xfc,
-    0xb4, 0xc8, 0x01, 0xbb, 0xfe, 0x45, 0xb6, 0x66, 0x66, 0x66, 0x01, 0x1c,
-    0x67, 0x67, 0x67, 0x02, 0x56, 0xfd, 0xf3, 0x02, 0x0d, 0xfd, 0xa1, 0x02,
-    0x5f, 0xc9, 0x4f, 0x49, 0xfe, 0x0e, 0x4b, 0x8e, 0x8e, 0xd7, 0x86, 0x86,
-    0xd7, 0x8e, 0x8e, 0xd7, 0x86, 0x86, 0x00, 0x00, 0x00, 0x06, 0x00, 0x30,
-    0xff, 0xf1, 0x03, 0x8e, 0x03, 0x5d, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x49,
-    0x00, 0x4d, 0x00, 0x55, 0x00, 0x59, 0x00, 0x00, 0x37, 0x35, 0x07, 0x27,
-    0x36, 0x37, 0x36, 0x37, 0x23, 0x35, 0x33, 0x3d, 0x01, 0x33, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x0f, 0x01, 0x21, 0x15, 0x33, 0x15, 0x23, 0x15, 0x14,
-    0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01,
-    0x21, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x21, 0x15, 0x33, 0x15, 0x21, 0x35, 0x21, 0x35,
-    0x23, 0x15, 0x01, 0x26, 0x27, 0x26, 0x27, 0x37, 0x23, 0x15, 0x13, 0x35,
-    0x23, 0x15, 0x12, 0x17, 0x16, 0x17, 0x07, 0x33, 0x35, 0x23, 0x01, 0x35,
-    0x23, 0x15, 0x8e, 0x0f, 0x3c, 0x4a, 0x1f, 0x14, 0x08, 0x8b, 0x93, 0xc2,
-    0x0b, 0x0b, 0x06, 0x5d, 0x09, 0x0e, 0x04, 0x01, 0x1e, 0x77, 0x77, 0x23,
-    0x32, 0x25, 0x46, 0x0e, 0x1e, 0x1c, 0x20, 0x17, 0x07, 0xfe, 0xf2, 0x12,
-    0x34, 0x1b, 0x28, 0x2c, 0x1a, 0x27, 0x2d, 0x1d, 0x27, 0x82, 0x0a, 0x27,
-    0x1f, 0x34, 0x02, 0x93, 0x5e, 0xfc, 0xa2, 0x01, 0x27, 0x75, 0x01, 0x28,
-    0x1c, 0x1b, 0x19, 0x2c, 0x25, 0x8e, 0xf2, 0x71, 0x2e, 0x2b, 0x20, 0x25,
-    0x27, 0x9b, 0xf2, 0x01, 0x14, 0x73, 0x3a, 0xd0, 0x0c, 0x40, 0x36, 0x2f,
-    0x1d, 0x26, 0x4b, 0x17, 0xc2, 0x1e, 0x1e, 0x17, 0x10, 0x19, 0x21, 0x09,
-    0xd9, 0x4b, 0x44, 0x38, 0x2d, 0x06, 0x05, 0x4b, 0x03, 0x04, 0x11, 0x17,
-    0x40, 0x0a, 0x25, 0x13, 0x21, 0x3c, 0x19, 0x1c, 0x22, 0x13, 0x35, 0x45,
-    0x33, 0x2b, 0x2c, 0xdd, 0x49, 0x49, 0x99, 0x99, 0x01, 0xf7, 0x1a, 0x14,
-    0x13, 0x1f, 0x2e, 0x8e, 0xfe, 0x09, 0x99, 0x99, 0x02, 0x7c, 0x1f, 0x16,
-    0x20, 0x30, 0x8e, 0xfd, 0x7b, 0x99, 0x99, 0x00, 0x00, 0x03, 0x00, 0x25,
-    0xff, 0xd2, 0x03, 0x53, 0x03, 0x52, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x30,
-    0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x00, 0x37, 0x36, 0x37, 0x23, 0x35,
-    0x33, 0x35, 0x23, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x06, 0x07, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x2f, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x25,
-    0x11, 0x23, 0x11, 0x03, 0x53, 0xfe, 0xa0, 0xfe, 0x94, 0x2f, 0x25, 0x09,
-    0xb6, 0xba, 0x32, 0x1e, 0x23, 0x4a, 0x26, 0x21, 0x21, 0x11, 0x52, 0x11,
-    0x10, 0xe7, 0x83, 0x94, 0x97, 0x04, 0x0a, 0x24, 0x30, 0x3a, 0x17, 0x45,
-    0x15, 0x38, 0x2f, 0x04, 0x19, 0x4c, 0x39, 0x45, 0x02, 0xdb, 0xbb, 0x02,
-    0xfd, 0xfd, 0x19, 0x02, 0xe7, 0xfd, 0x71, 0x68, 0x51, 0x59, 0x54, 0xb3,
-    0x4a, 0x3f, 0x27, 0x46, 0x51, 0x53, 0x43, 0x12, 0x3b, 0x2b, 0x53, 0xb3,
-    0x54, 0x2b, 0x32, 0x25, 0x3d, 0x4a, 0x24, 0x36, 0x23, 0x4b, 0x3c, 0x09,
-    0x3e, 0x71, 0x3d, 0x3b, 0x57, 0x02, 0x49, 0xfd, 0xb7, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x11, 0xff, 0xde, 0x03, 0x70, 0x03, 0x22, 0x00, 0x11,
-    0x00, 0x15, 0x00, 0x19, 0x00, 0x38, 0x00, 0x00, 0x12, 0x37, 0x36, 0x37,
-    0x23, 0x35, 0x21, 0x15, 0x23, 0x06, 0x07, 0x33, 0x11, 0x23, 0x11, 0x06,
-    0x07, 0x27, 0x05, 0x11, 0x23, 0x11, 0x37, 0x21, 0x15, 0x21, 0x13, 0x21,
-    0x03, 0x33, 0x0e, 0x01, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x2f, 0x01, 0x16,
-    0x33, 0x32, 0x37, 0x3e, 0x02, 0x37, 0x36, 0x35, 0x21, 0x13, 0x17, 0x07,
+    0x5c, 0x37, 0x33, 0x01, 0x4b, 0x9a, 0x36, 0x28, 0x3c, 0xe7, 0x3a, 0x2b,
+    0x70, 0x24, 0xff, 0xe1, 0x03, 0x97, 0x03, 0x51, 0xd0, 0x1d, 0x12, 0x01,
+    0x27, 0x2a, 0x04, 0xf7, 0x31, 0x05, 0x1d, 0x04, 0x01, 0xa7, 0x12, 0x02,
+    0xdd, 0x07, 0x00, 0xf6, 0x04, 0xf1, 0x34, 0xb4, 0xfe, 0xd3, 0x01, 0x2d,
+    0x55, 0x01, 0x2d, 0xfe, 0xd3, 0x01, 0x6c, 0xfe, 0xe1, 0x30, 0x4a, 0x64,
+    0x63, 0x36, 0x69, 0x5f, 0x5f, 0x31, 0x55, 0x2f, 0x61, 0x55, 0x73, 0x38,
+    0x6f, 0x5c, 0x47, 0x2f, 0xfe, 0xe4, 0x01, 0xe5, 0x96, 0x52, 0x84, 0x84,
+    0x52, 0x96, 0x54, 0x52, 0x4c, 0x64, 0x35, 0x4d, 0x40, 0x65, 0x67, 0x6e,
+    0xfe, 0x5a, 0x01, 0xa7, 0x73, 0x67, 0x58, 0x46, 0x4a, 0x3d, 0x5e, 0x49,
+    0x53, 0x54, 0x72, 0x39, 0x52, 0xd9, 0x03, 0xa2, 0x03, 0x50, 0x88, 0x2f,
+    0x19, 0x33, 0x70, 0x00, 0x23, 0x23, 0x11, 0x88, 0x0e, 0x00, 0x7e, 0x01,
+    0x07, 0x7a, 0x00, 0x00, 0x88, 0x31, 0xf1, 0x2f, 0x65, 0xfe, 0xf2, 0x2f,
+    0x48, 0x5c, 0x6d, 0x44, 0x68, 0x5f, 0x5c, 0x2a, 0x06, 0xc7, 0xc7, 0x5b,
+    0xc3, 0xc3, 0x06, 0x2e, 0x52, 0x5b, 0x71, 0x45, 0x6f, 0x59, 0x48, 0x2d,
+    0xfe, 0xf9, 0x02, 0xb9, 0x97, 0x97, 0x56, 0x7b, 0x68, 0x85, 0x51, 0x50,
+    0x59, 0x92, 0x90, 0x8e, 0xfe, 0x6f, 0x55, 0xa4, 0xa4, 0x55, 0x01, 0x91,
+    0x93, 0x81, 0x8e, 0x6d, 0x48, 0x60, 0x87, 0x6c, 0x74, 0x56, 0x02, 0x30,
+    0x96, 0xd3, 0x03, 0x96, 0x03, 0x4f, 0x00, 0x1f, 0x00, 0x4c, 0x06, 0x09,
+    0x03, 0x79, 0x00, 0x20, 0x26, 0x17, 0xa8, 0x1f, 0x03, 0x86, 0x29, 0x00,
+    0x18, 0x07, 0x15, 0x12, 0xf1, 0x02, 0x00, 0xb6, 0x3c, 0x0e, 0x46, 0x1a,
+    0x20, 0x26, 0x35, 0xfc, 0x06, 0x03, 0xea, 0x01, 0xfb, 0x8a, 0x0c, 0x7e,
+    0x7e, 0x2b, 0x2e, 0x31, 0x11, 0x39, 0x17, 0x26, 0x0d, 0x01, 0x18, 0x01,
+    0x53, 0x02, 0x2d, 0x35, 0x40, 0x39, 0x37, 0x1d, 0x14, 0x80, 0x83, 0x9b,
+    0x30, 0x0e, 0x11, 0x0e, 0x01, 0x46, 0x03, 0x09, 0x0a, 0x09, 0x08, 0x0a,
+    0x0b, 0x09, 0x01, 0x06, 0x01, 0x52, 0x04, 0x04, 0x04, 0x14, 0x21, 0x1c,
+    0x0e, 0x19, 0x19, 0x0e, 0x27, 0x22, 0x9c, 0x0f, 0x12, 0x0f, 0x33, 0x29,
+    0x4e, 0x03, 0x4f, 0xae, 0x54, 0x3b, 0x28, 0x33, 0x36, 0x1b, 0x37, 0x22,
+    0x2d, 0x10, 0x01, 0x1b, 0x01, 0xfe, 0x2d, 0x01, 0xb3, 0x05, 0x6c, 0x5b,
+    0x2e, 0x5d, 0x7f, 0x44, 0x42, 0x54, 0xae, 0xfc, 0xe4, 0x4f, 0x2b, 0x34,
+    0x89, 0x68, 0x01, 0x44, 0xfd, 0x67, 0x17, 0x15, 0x07, 0x02, 0x01, 0x03,
+    0x03, 0x15, 0x1d, 0x36, 0x45, 0x16, 0x5b, 0x2c, 0x2a, 0x2e, 0x13, 0x02,
+    0x01, 0x01, 0x03, 0x32, 0x42, 0x02, 0x5a, 0xef, 0x6a, 0x97, 0x3b, 0x35,
+    0x5b, 0x33, 0x31, 0x00, 0x03, 0x00, 0x13, 0xff, 0xd1, 0x03, 0xa3, 0x03,
+    0x55, 0x00, 0x1c, 0x00, 0x33, 0x00, 0x3a, 0xe8, 0x00, 0x1b, 0x27, 0xe5,
+    0x00, 0x00, 0xb1, 0x03, 0x04, 0x4b, 0x24, 0x08, 0xb4, 0x09, 0x03, 0x97,
+    0x31, 0xf0, 0x5e, 0x14, 0x7a, 0x7a, 0x2b, 0x37, 0x37, 0x11, 0x3f, 0x15,
+    0x2c, 0x2a, 0x55, 0x01, 0x33, 0x34, 0x44, 0x43, 0x32, 0x21, 0x13, 0x82,
+    0x85, 0x01, 0x23, 0x5f, 0x18, 0x0a, 0x2c, 0x37, 0x16, 0x1f, 0x01, 0xd8,
+    0x34, 0x64, 0x10, 0x09, 0x57, 0x9e, 0x3b, 0x98, 0x5b, 0x62, 0x9c, 0x3d,
+    0xd7, 0x32, 0x28, 0x0f, 0x5e, 0x2b, 0xfe, 0xfa, 0x03, 0x55, 0xb4, 0x54,
+    0x30, 0x29, 0x3a, 0x3e, 0x18, 0x3b, 0x22, 0x33, 0x33, 0xfe, 0x24, 0x01,
+    0xb0, 0x02, 0x79, 0x54, 0x33, 0x65, 0x75, 0x46, 0x44, 0x54, 0xb4, 0xfd,
+    0x38, 0x71, 0x26, 0x14, 0x50, 0xbc, 0x7e, 0x55, 0x54, 0xfc, 0xa3, 0x1a,
+    0x0c, 0x70, 0x6b, 0x4f, 0x70, 0x71, 0x72, 0x72, 0x4a, 0x02, 0x3a, 0xa8,
+    0x49, 0x1a, 0x91, 0xe7, 0x82, 0x11, 0xb0, 0x17, 0xff, 0xcf, 0x03, 0x99,
+    0x03, 0x50, 0x00, 0x1d, 0x00, 0x42, 0xaa, 0x22, 0x1a, 0x13, 0xa4, 0x01,
+    0x0c, 0xa2, 0x01, 0x02, 0xae, 0x23, 0x04, 0x8e, 0x08, 0x07, 0xb1, 0x04,
+    0x22, 0x36, 0x37, 0xe3, 0x22, 0x03, 0x6a, 0x27, 0xf1, 0x76, 0x23, 0xfe,
+    0x70, 0x70, 0x2f, 0x22, 0x28, 0x11, 0x37, 0x14, 0x1d, 0x10, 0x12, 0x4f,
+    0x01, 0x25, 0x2d, 0x45, 0x36, 0x2f, 0x16, 0x16, 0x6b, 0x72, 0xa7, 0x1d,
+    0x1c, 0xd9, 0xf3, 0x12, 0x6b, 0x61, 0x5d, 0x63, 0x01, 0x7c, 0x2e, 0x54,
+    0x0a, 0x4c, 0x7c, 0x33, 0x7f, 0x4d, 0x58, 0x89, 0x33, 0x8e, 0x51, 0x56,
+    0x2c, 0x02, 0x03, 0x1b, 0x10, 0x34, 0x28, 0x4d, 0x01, 0x4e, 0x43, 0x48,
+    0x23, 0xd1, 0x03, 0x50, 0xae, 0x51, 0x2d, 0x2d, 0x28, 0x2d, 0x1b, 0x3a,
+    0x1e, 0x22, 0x14, 0x14, 0xfe, 0x23, 0x01, 0xb7, 0x03, 0x64, 0x56, 0x2d,
+    0x5d, 0x76, 0x36, 0x49, 0x51, 0xae, 0xfd, 0x26, 0x6e, 0x6f, 0xb4, 0xf6,
+    0x0f, 0x30, 0x56, 0x15, 0x0d, 0x0d, 0x09, 0x6d, 0x50, 0xbb, 0x74, 0x0e,
+    0x54, 0x3f, 0x4e, 0x4b, 0x57, 0x58, 0x4e, 0x4c, 0x4b, 0x52, 0x7b, 0xbc,
+    0xbb, 0x70, 0x3d, 0x71, 0x3d, 0x2e, 0x01, 0x56, 0x65, 0x65, 0x92, 0x4c,
+    0x18, 0x71, 0xe0, 0x03, 0x96, 0x03, 0x61, 0x00, 0x03, 0x8c, 0x23, 0x16,
+    0x47, 0x3c, 0x2f, 0x04, 0xb3, 0x0f, 0x05, 0x43, 0x0b, 0x05, 0x8b, 0x01,
+    0x05, 0xd1, 0x20, 0x00, 0x8c, 0x1c, 0x02, 0x07, 0x01, 0x25, 0x31, 0x11,
+    0xda, 0x20, 0x03, 0x8c, 0x0b, 0xf0, 0x76, 0x07, 0x03, 0x35, 0xfe, 0x5b,
+    0xfe, 0xc5, 0x20, 0x1d, 0x11, 0x70, 0x73, 0x50, 0x60, 0x34, 0x26, 0x32,
+    0x1f, 0x50, 0x0c, 0x15, 0x01, 0x1d, 0x3c, 0x62, 0x5d, 0x8a, 0x1c, 0xa6,
+    0x68, 0x5e, 0x7e, 0x20, 0x18, 0x20, 0x92, 0x5c, 0x33, 0x2e, 0x1e, 0x2b,
+    0x3d, 0x12, 0x5b, 0x42, 0x31, 0x39, 0x18, 0x13, 0x0f, 0x50, 0x29, 0x29,
+    0x40, 0x02, 0xd0, 0xfe, 0xfc, 0x47, 0x42, 0x50, 0x34, 0xea, 0x04, 0x03,
+    0x07, 0x01, 0x4d, 0xfe, 0xa9, 0x01, 0x57, 0x2e, 0x4f, 0x46, 0x44, 0x52,
+    0xb0, 0xb0, 0x4d, 0x3a, 0x3d, 0x4a, 0x47, 0x19, 0x1d, 0x28, 0x4c, 0x6c,
+    0x58, 0x35, 0x21, 0x51, 0x2e, 0x44, 0x42, 0x2f, 0x0c, 0x08, 0x50, 0x2f,
+    0x3a, 0x2c, 0x3d, 0x27, 0x2d, 0x3a, 0x13, 0x1c, 0x41, 0x3d, 0x34, 0x21,
+    0x17, 0x12, 0xfe, 0x10, 0x01, 0xaa, 0x67, 0x4e, 0x31, 0xc2, 0xb9, 0xb9,
+    0x02, 0x11, 0x33, 0x42, 0x52, 0x08, 0x04, 0x0b, 0x9e, 0x11, 0xc1, 0xff,
+    0xd5, 0x03, 0x96, 0x03, 0x57, 0x00, 0x29, 0x00, 0x2d, 0x00, 0x31, 0x54,
+    0x04, 0x15, 0x11, 0x54, 0x04, 0x1a, 0x11, 0x58, 0x04, 0x01, 0xe4, 0x03,
+    0x03, 0xdf, 0x00, 0x24, 0x21, 0x35, 0x38, 0x07, 0xf1, 0x50, 0x01, 0xb5,
+    0xfe, 0xea, 0x01, 0x06, 0x55, 0x01, 0x6a, 0xfe, 0x96, 0x01, 0x25, 0xfe,
+    0xeb, 0x01, 0x6a, 0xfe, 0xf0, 0x2f, 0x2e, 0x58, 0x7d, 0x1f, 0x7c, 0x5d,
+    0x5b, 0x38, 0x01, 0x55, 0x03, 0x39, 0x50, 0x61, 0x81, 0x22, 0xb7, 0x74,
+    0xfe, 0xfb, 0x02, 0x7d, 0xfe, 0x2d, 0x01, 0xd3, 0xfe, 0x2d, 0x01, 0x15,
+    0x3d, 0x01, 0x48, 0xbd, 0x3e, 0x46, 0x39, 0xfe, 0xb8, 0x3d, 0x49, 0x2b,
+    0x1a, 0x32, 0x1e, 0x4b, 0x26, 0x37, 0x37, 0x4c, 0xf7, 0xf7, 0x46, 0x33,
+    0x3d, 0x28, 0x4b, 0x2a, 0x69, 0x49, 0x82, 0x3e, 0x3e, 0x80, 0x3d, 0x3d,
+    0x00, 0x01, 0x00, 0x2e, 0x00, 0x0b, 0x03, 0x8e, 0x03, 0xe6, 0x35, 0x12,
+    0x37, 0x88, 0x2e, 0x26, 0x35, 0x21, 0x98, 0x00, 0xf0, 0x11, 0x35, 0xbd,
+    0x58, 0xc4, 0xfe, 0x83, 0x03, 0x14, 0xfe, 0xc3, 0x01, 0x1d, 0xfe, 0xe3,
+    0x01, 0x5b, 0xfc, 0xa0, 0x61, 0x01, 0xdf, 0xfe, 0x21, 0x02, 0x57, 0x57,
+    0x57, 0xe1, 0x57, 0xfe, 0xe1, 0x56, 0x3c, 0x04, 0x90, 0x2b, 0xff, 0xf5,
+    0x03, 0x88, 0x03, 0x51, 0x00, 0x15, 0xd0, 0x17, 0x11, 0x36, 0x38, 0x28,
+    0x25, 0x37, 0x11, 0xef, 0x22, 0x04, 0xad, 0x2c, 0x05, 0x1e, 0x0b, 0x00,
+    0x36, 0x04, 0x09, 0x04, 0x15, 0x00, 0xf3, 0x39, 0xf0, 0x57, 0x4a, 0x30,
+    0x55, 0x4d, 0x1c, 0x56, 0x7c, 0x7c, 0x5f, 0x20, 0x0a, 0x60, 0x8f, 0x95,
+    0x59, 0x0f, 0x01, 0xfc, 0x56, 0x32, 0x1d, 0x3e, 0x38, 0x3c, 0x3e, 0x4f,
+    0x39, 0x3b, 0x0a, 0x23, 0x2a, 0x28, 0x20, 0x0d, 0x03, 0x07, 0x02, 0x53,
+    0x03, 0x0a, 0x06, 0x1c, 0x42, 0x43, 0x4c, 0x48, 0x19, 0x5e, 0x0a, 0x02,
+    0x41, 0xfd, 0xd1, 0x11, 0x06, 0x02, 0xb1, 0xff, 0x56, 0xfe, 0xb9, 0x19,
+    0x0a, 0x5c, 0x1e, 0x1d, 0x23, 0x0d, 0x58, 0x02, 0xf7, 0xfe, 0xb5, 0x25,
+    0x19, 0x35, 0x38, 0x46, 0x3e, 0x3e, 0x2e, 0x2a, 0xfe, 0xf6, 0x1d, 0x19,
+    0x09, 0x08, 0x1b, 0x22, 0x3f, 0x33, 0x19, 0x2e, 0x51, 0x32, 0x30, 0x15,
+    0x01, 0x16, 0x35, 0x38, 0xc8, 0x0a, 0xb3, 0x31, 0xff, 0xdf, 0x03, 0x9c,
+    0x03, 0x5b, 0x00, 0x43, 0x00, 0x4d, 0x0e, 0x0a, 0x28, 0x26, 0x27, 0x36,
+    0x19, 0x01, 0x14, 0x23, 0x03, 0xab, 0x00, 0x05, 0x5e, 0x03, 0x0c, 0x9b,
+    0x21, 0x05, 0x7f, 0x05, 0x46, 0x35, 0x21, 0x35, 0x17, 0xbd, 0x17, 0xf1,
+    0x8a, 0xb5, 0x57, 0xba, 0x17, 0x1e, 0x24, 0x18, 0x05, 0x35, 0x22, 0x26,
+    0x27, 0x19, 0x27, 0x94, 0xfe, 0x92, 0x26, 0x35, 0x29, 0x21, 0x3f, 0x28,
+    0x42, 0x23, 0x4e, 0x22, 0x30, 0x12, 0x68, 0x8b, 0x34, 0xa6, 0x5f, 0x2e,
+    0x29, 0x13, 0x30, 0x2d, 0x21, 0x26, 0x17, 0x0c, 0x11, 0x28, 0x29, 0x20,
+    0x1b, 0x08, 0x42, 0x3e, 0x72, 0x60, 0x32, 0x5e, 0x7c, 0x6e, 0x3c, 0xfe,
+    0x98, 0x70, 0x19, 0x38, 0x30, 0x1b, 0x41, 0x15, 0x33, 0x2b, 0x26, 0x02,
+    0xbc, 0x97, 0x97, 0x16, 0x19, 0x1f, 0x14, 0x05, 0x38, 0x1b, 0x20, 0x21,
+    0x19, 0x2a, 0x53, 0x1c, 0x68, 0x53, 0x25, 0x24, 0x40, 0x34, 0x38, 0x2e,
+    0x4e, 0x22, 0x2a, 0x16, 0x76, 0x48, 0x4f, 0x63, 0x7b, 0x3c, 0x4b, 0xfe,
+    0xca, 0x2a, 0x30, 0x19, 0x05, 0x04, 0x01, 0x5f, 0x04, 0x07, 0x15, 0x19,
+    0xc0, 0x36, 0x2d, 0x54, 0x35, 0x50, 0x2f, 0x58, 0x4f, 0x34, 0xcb, 0x53,
+    0x69, 0x18, 0x42, 0x37, 0x28, 0x39, 0x21, 0x40, 0x36, 0x24, 0x00, 0x08,
+    0x00, 0x27, 0xff, 0xde, 0x03, 0x6f, 0x03, 0x52, 0x00, 0x09, 0xd4, 0x07,
+    0x13, 0x27, 0xe6, 0x26, 0x10, 0x51, 0xa6, 0x01, 0x05, 0xe0, 0x10, 0x05,
+    0xbe, 0x00, 0x0f, 0x8f, 0x18, 0x01, 0x12, 0x17, 0xcb, 0x24, 0x27, 0x14,
+    0x06, 0x78, 0x12, 0x00, 0x04, 0x11, 0x04, 0x1b, 0x14, 0x06, 0xeb, 0x18,
+    0xf0, 0x9d, 0x69, 0x20, 0x23, 0x0d, 0x53, 0x13, 0x1b, 0x27, 0x16, 0x55,
+    0x0c, 0x26, 0x35, 0x3a, 0x20, 0x35, 0x17, 0x3e, 0x36, 0x26, 0x5b, 0x20,
+    0x3b, 0x36, 0x22, 0x31, 0x21, 0x33, 0x3e, 0x1f, 0x01, 0x1b, 0x2b, 0x1e,
+    0x28, 0x1e, 0x40, 0x19, 0x29, 0x32, 0x17, 0x1d, 0xd6, 0x57, 0xd6, 0x0f,
+    0x26, 0x27, 0x36, 0x3d, 0x11, 0x1e, 0x2c, 0x20, 0x18, 0x08, 0xfe, 0xa8,
+    0x55, 0x01, 0xad, 0xfe, 0xa8, 0x01, 0x58, 0xfe, 0xa8, 0x01, 0x28, 0x21,
+    0x2f, 0x13, 0x40, 0x24, 0x21, 0x20, 0x2a, 0x3c, 0x3f, 0x69, 0x6f, 0x44,
+    0x17, 0x5d, 0x5b, 0x77, 0x33, 0x1d, 0x02, 0x6d, 0x16, 0x2a, 0x2c, 0x20,
+    0x46, 0x17, 0x33, 0x2b, 0x19, 0x01, 0x11, 0x11, 0x2d, 0x26, 0x1f, 0x49,
+    0x20, 0x28, 0x2e, 0x14, 0x3f, 0x28, 0x24, 0x2a, 0x2a, 0x36, 0x25, 0x2d,
+    0x37, 0x17, 0xb4, 0x01, 0x06, 0xfe, 0xfa, 0xfe, 0x0d, 0x2a, 0x2c, 0x17,
+    0x05, 0x07, 0x02, 0x58, 0x03, 0x05, 0x14, 0x1a, 0x39, 0xc5, 0x01, 0x14,
+    0x5f, 0x5f, 0xaf, 0x5c, 0x5c, 0x01, 0x16, 0x29, 0x35, 0x1e, 0x33, 0x31,
+    0x26, 0x27, 0x28, 0x3a, 0x00, 0x02, 0x00, 0x1d, 0xff, 0xd0, 0x03, 0x9f,
+    0x03, 0x4e, 0x00, 0x40, 0x00, 0x45, 0x5e, 0x04, 0x01, 0xf1, 0x0d, 0x31,
+    0x07, 0x33, 0x11, 0x53, 0x22, 0x12, 0x11, 0xde, 0x0d, 0x03, 0x64, 0x1d,
+    0x0c, 0x2b, 0x05, 0x01, 0xe6, 0x09, 0x07, 0x5a, 0x14, 0x00, 0x58, 0x1e,
+    0x01, 0x3c, 0x05, 0xf0, 0x70, 0x01, 0x67, 0x41, 0xe7, 0x01, 0xa6, 0x2a,
+    0x15, 0x0f, 0x0d, 0x01, 0xeb, 0xb0, 0x16, 0x4f, 0xc0, 0x54, 0x01, 0x56,
+    0x20, 0x4f, 0x04, 0x0a, 0x47, 0x6f, 0x32, 0x6b, 0x4a, 0x4e, 0x7d, 0x34,
+    0x80, 0x50, 0x52, 0x1f, 0x08, 0x02, 0x17, 0x1a, 0x3d, 0x3a, 0x51, 0x57,
+    0x05, 0x0a, 0x12, 0x30, 0x50, 0x2d, 0x14, 0x12, 0x51, 0x56, 0x01, 0x66,
+    0x3d, 0x42, 0x18, 0xb2, 0x03, 0x4e, 0xfe, 0xf9, 0x4f, 0x41, 0x1e, 0x0f,
+    0xfe, 0xad, 0x4e, 0x57, 0x3c, 0x8d, 0x5e, 0x01, 0x00, 0x13, 0x2c, 0x55,
+    0x13, 0x1d, 0x07, 0x6e, 0x4f, 0xaf, 0x7a, 0x07, 0x0e, 0x5b, 0x45, 0x47,
+    0x49, 0x5e, 0x5a, 0x51, 0x45, 0x4d, 0x5d, 0x85, 0xb5, 0xb6, 0x6d, 0x77,
+    0x69, 0x1d, 0x2f, 0x01, 0x55, 0x63, 0x3b, 0x6a, 0x61, 0x24, 0x58, 0x61,
+    0x68, 0xb3, 0x01, 0x75, 0xf6, 0x01, 0x07, 0xfe, 0x1d, 0x69, 0x69, 0x8e,
+    0xb4, 0x0a, 0xf8, 0x04, 0x38, 0xff, 0xd9, 0x03, 0x86, 0x03, 0x56, 0x00,
+    0x09, 0x00, 0x15, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x06,
+    0x20, 0x13, 0x07, 0x65, 0x04, 0x00, 0xba, 0x12, 0x04, 0xcb, 0x21, 0x01,
+    0x7c, 0x34, 0x02, 0xbb, 0x3a, 0x1e, 0x17, 0xc4, 0x3a, 0x06, 0x3a, 0x32,
+    0x05, 0x62, 0x08, 0x14, 0x17, 0x0e, 0x02, 0x15, 0x04, 0x58, 0x00, 0x06,
+    0xf4, 0x02, 0xf1, 0xc4, 0x72, 0x3c, 0x33, 0x2c, 0x2c, 0x32, 0x2f, 0x31,
+    0x46, 0x27, 0x02, 0x01, 0x80, 0x52, 0x01, 0x7c, 0xfe, 0x84, 0x52, 0xfe,
+    0x80, 0x14, 0x01, 0x71, 0x04, 0x09, 0x10, 0x59, 0x0d, 0x0f, 0x07, 0x01,
+    0x56, 0xfe, 0x79, 0x0d, 0x31, 0x40, 0x58, 0x2c, 0x37, 0x1d, 0x3a, 0x33,
+    0x4f, 0x59, 0x30, 0x4b, 0x21, 0x2f, 0x19, 0x16, 0x18, 0x38, 0x29, 0x15,
+    0x24, 0x1a, 0x41, 0x0e, 0x0d, 0x1d, 0x5f, 0x0b, 0x71, 0x64, 0x0a, 0x28,
+    0x1a, 0x38, 0x47, 0x1d, 0x54, 0x3c, 0x0c, 0x1a, 0x18, 0x29, 0x36, 0xfe,
+    0xad, 0x35, 0x49, 0x2d, 0x18, 0x37, 0x26, 0x22, 0x1b, 0x27, 0x02, 0x6f,
+    0x2d, 0x2d, 0x20, 0x31, 0x29, 0x33, 0x30, 0x29, 0x2a, 0x37, 0x2c, 0x2d,
+    0x35, 0x30, 0x2e, 0x1d, 0x3a, 0x32, 0x32, 0x01, 0x73, 0x26, 0x20, 0x21,
+    0x43, 0x26, 0x1d, 0x21, 0x23, 0x4a, 0x87, 0x3f, 0x3f, 0x50, 0xaa, 0xaa,
+    0x02, 0x76, 0x0b, 0x1d, 0x24, 0x11, 0x1c, 0x2e, 0x13, 0x4f, 0x07, 0x3e,
+    0x31, 0x04, 0x05, 0x39, 0x23, 0x2e, 0x3a, 0x4d, 0x55, 0x20, 0x04, 0x03,
+    0x04, 0x03, 0x21, 0x20, 0x2c, 0x34, 0x22, 0x36, 0x2d, 0x29, 0x1b, 0x17,
+    0x03, 0x08, 0x01, 0x08, 0x03, 0x4e, 0x05, 0x15, 0x29, 0x44, 0x03, 0x06,
+    0x02, 0x42, 0x01, 0x15, 0x23, 0x42, 0x19, 0x3a, 0x25, 0x19, 0x3c, 0x28,
+    0x1d, 0x19, 0x1e, 0x24, 0x21, 0x23, 0x1c, 0x39, 0x28, 0x24, 0x23, 0x17,
+    0x40, 0x44, 0x18, 0x1e, 0x23, 0x26, 0x41, 0x18, 0x2a, 0x23, 0x1d, 0x14,
+    0x3a, 0x41, 0x00, 0x04, 0x03, 0x87, 0x10, 0x09, 0x04, 0x10, 0x39, 0x05,
+    0xc2, 0x30, 0x16, 0x21, 0x02, 0x00, 0x02, 0xe7, 0x3b, 0xf0, 0x36, 0xc4,
+    0xd9, 0x28, 0x40, 0x4e, 0x3e, 0x54, 0x1b, 0x58, 0x0f, 0x1c, 0xb5, 0x5b,
+    0x01, 0x43, 0xfe, 0xbd, 0x01, 0x23, 0xfe, 0xdd, 0x01, 0x68, 0xfc, 0xc3,
+    0x01, 0x7a, 0xfe, 0xdc, 0x01, 0x8d, 0xb7, 0x59, 0x5e, 0x2e, 0x56, 0xb4,
+    0x69, 0x12, 0x39, 0x49, 0xb5, 0xb5, 0x56, 0xb7, 0x55, 0xdf, 0x55, 0x55,
+    0xdf, 0x55, 0x00, 0x05, 0x00, 0x23, 0xff, 0xcd, 0x03, 0x4b, 0x03, 0x20,
+    0x00, 0x1f, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2c, 0x88, 0x25, 0x1e, 0x36,
+    0x49, 0x0c, 0x04, 0x1c, 0x31, 0x0a, 0x4d, 0x0c, 0x13, 0x05, 0x6d, 0x0b,
+    0xf0, 0x3f, 0x43, 0x27, 0x0a, 0x0b, 0x08, 0x02, 0xc4, 0x29, 0x3a, 0x22,
+    0x4f, 0x11, 0x22, 0x1e, 0x27, 0x1d, 0x0a, 0xe1, 0x57, 0xe2, 0x04, 0x0b,
+    0x16, 0x41, 0x51, 0x01, 0x99, 0xde, 0xde, 0xde, 0x02, 0x16, 0xe1, 0xe1,
+    0xe1, 0x29, 0x51, 0x2a, 0x28, 0x65, 0x49, 0x01, 0xa6, 0xfd, 0x3c, 0x3c,
+    0x33, 0x07, 0x05, 0x5d, 0x04, 0x05, 0x14, 0x1b, 0x85, 0xfe, 0xf8, 0x01,
+    0x08, 0x37, 0x31, 0x62, 0x5c, 0x2e, 0x01, 0x4e, 0x95, 0x7e, 0x17, 0xe8,
+    0x9b, 0x9b, 0xe8, 0x95, 0x95, 0xe8, 0x9b, 0x9b, 0x02, 0x31, 0x93, 0x39,
+    0xff, 0xf7, 0x03, 0x85, 0x03, 0x1f, 0x00, 0x07, 0xfa, 0x3b, 0x50, 0x17,
+    0x00, 0x1b, 0x00, 0x1f, 0xb2, 0x34, 0x11, 0x21, 0xa2, 0x34, 0x11, 0x27,
+    0xb8, 0x36, 0x02, 0x2b, 0x0f, 0x08, 0x89, 0x00, 0xf1, 0x20, 0xbc, 0x02,
+    0x44, 0x55, 0xfd, 0x12, 0x2e, 0x03, 0x4c, 0xfc, 0xb4, 0xc8, 0x01, 0xbb,
+    0xfe, 0x45, 0xb6, 0x66, 0x66, 0x66, 0x01, 0x1c, 0x67, 0x67, 0x67, 0x02,
+    0x56, 0xfd, 0xf3, 0x02, 0x0d, 0xfd, 0xa1, 0x02, 0x5f, 0xc9, 0x4f, 0x49,
+    0xfe, 0x0e, 0x4b, 0x8e, 0x8e, 0xd7, 0x86, 0x86, 0xd7, 0x06, 0x00, 0xf2,
+    0x03, 0x00, 0x06, 0x00, 0x30, 0xff, 0xf1, 0x03, 0x8e, 0x03, 0x5d, 0x00,
+    0x3d, 0x00, 0x41, 0x00, 0x49, 0x00, 0x4d, 0x6c, 0x0c, 0x26, 0x37, 0x35,
+    0xc8, 0x08, 0x34, 0x35, 0x33, 0x37, 0xd4, 0x16, 0x0d, 0xa2, 0x11, 0x08,
+    0x8c, 0x24, 0x11, 0x06, 0x8e, 0x10, 0x00, 0x9a, 0x0c, 0x01, 0x9a, 0x3c,
+    0x03, 0xa1, 0x24, 0x00, 0xcd, 0x0f, 0x02, 0xdc, 0x16, 0x20, 0x35, 0x23,
+    0x3c, 0x01, 0xf1, 0x87, 0x8e, 0x0f, 0x3c, 0x4a, 0x1f, 0x14, 0x08, 0x8b,
+    0x93, 0xc2, 0x0b, 0x0b, 0x06, 0x5d, 0x09, 0x0e, 0x04, 0x01, 0x1e, 0x77,
+    0x77, 0x23, 0x32, 0x25, 0x46, 0x0e, 0x1e, 0x1c, 0x20, 0x17, 0x07, 0xfe,
+    0xf2, 0x12, 0x34, 0x1b, 0x28, 0x2c, 0x1a, 0x27, 0x2d, 0x1d, 0x27, 0x82,
+    0x0a, 0x27, 0x1f, 0x34, 0x02, 0x93, 0x5e, 0xfc, 0xa2, 0x01, 0x27, 0x75,
+    0x01, 0x28, 0x1c, 0x1b, 0x19, 0x2c, 0x25, 0x8e, 0xf2, 0x71, 0x2e, 0x2b,
+    0x20, 0x25, 0x27, 0x9b, 0xf2, 0x01, 0x14, 0x73, 0x3a, 0xd0, 0x0c, 0x40,
+    0x36, 0x2f, 0x1d, 0x26, 0x4b, 0x17, 0xc2, 0x1e, 0x1e, 0x17, 0x10, 0x19,
+    0x21, 0x09, 0xd9, 0x4b, 0x44, 0x38, 0x2d, 0x06, 0x05, 0x4b, 0x03, 0x04,
+    0x11, 0x17, 0x40, 0x0a, 0x25, 0x13, 0x21, 0x3c, 0x19, 0x1c, 0x22, 0x13,
+    0x35, 0x45, 0x33, 0x2b, 0x2c, 0xdd, 0x49, 0x49, 0x99, 0x99, 0x01, 0xf7,
+    0x1a, 0x14, 0x13, 0x1f, 0x2e, 0x8e, 0xfe, 0x09, 0x99, 0x99, 0x02, 0x7c,
+    0x1f, 0x16, 0x20, 0x30, 0x8e, 0xfd, 0x7b, 0x99, 0x99, 0x00, 0x1e, 0x08,
+    0x31, 0xd2, 0x03, 0x53, 0x3e, 0x38, 0x01, 0x08, 0x02, 0x00, 0xfc, 0x08,
+    0x04, 0x18, 0x35, 0x16, 0x23, 0x3f, 0x14, 0x03, 0xa8, 0x12, 0x05, 0x09,
+    0x1f, 0x02, 0xa4, 0x15, 0x10, 0x25, 0x21, 0x4a, 0xf0, 0x4a, 0x53, 0xfe,
+    0xa0, 0xfe, 0x94, 0x2f, 0x25, 0x09, 0xb6, 0xba, 0x32, 0x1e, 0x23, 0x4a,
+    0x26, 0x21, 0x21, 0x11, 0x52, 0x11, 0x10, 0xe7, 0x83, 0x94, 0x97, 0x04,
+    0x0a, 0x24, 0x30, 0x3a, 0x17, 0x45, 0x15, 0x38, 0x2f, 0x04, 0x19, 0x4c,
+    0x39, 0x45, 0x02, 0xdb, 0xbb, 0x02, 0xfd, 0xfd, 0x19, 0x02, 0xe7, 0xfd,
+    0x71, 0x68, 0x51, 0x59, 0x54, 0xb3, 0x4a, 0x3f, 0x27, 0x46, 0x51, 0x53,
+    0x43, 0x12, 0x3b, 0x2b, 0x53, 0xb3, 0x54, 0x2b, 0x32, 0x25, 0x3d, 0x4a,
+    0x24, 0x36, 0x23, 0x4b, 0x3c, 0x09, 0x3e, 0x71, 0x3d, 0x3b, 0x57, 0x02,
+    0x49, 0xfd, 0xb7, 0x6c, 0x2a, 0x91, 0x11, 0xff, 0xde, 0x03, 0x70, 0x03,
+    0x22, 0x00, 0x11, 0x74, 0x2e, 0x12, 0x38, 0x60, 0x04, 0x04, 0x6a, 0x36,
+    0x03, 0x72, 0x09, 0x30, 0x11, 0x23, 0x11, 0xcc, 0x4a, 0x25, 0x13, 0x21,
+    0xd6, 0x3d, 0x06, 0x25, 0x33, 0xf1, 0x6e, 0x35, 0x21, 0x13, 0x17, 0x07,
     0x33, 0x13, 0x21, 0x46, 0x39, 0x29, 0x15, 0x81, 0x01, 0x5d, 0x85, 0x17,
     0x24, 0x9f, 0xfb, 0x1c, 0x10, 0x40, 0x01, 0x19, 0x61, 0xc5, 0x01, 0x5a,
     0xfe, 0xa6, 0x24, 0x01, 0x7e, 0x21, 0x61, 0x01, 0x08, 0x08, 0x04, 0x15,
@@ -1983,149 +1568,115 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x2e, 0x18, 0x38, 0xc0, 0x01, 0x34, 0xfe, 0xcc, 0x83, 0x58, 0x02, 0x7f,
     0xfe, 0x99, 0x74, 0x98, 0x51, 0x2d, 0x2f, 0x19, 0x05, 0x06, 0x02, 0x5a,
     0x04, 0x01, 0x02, 0x09, 0x18, 0x1e, 0x67, 0x87, 0x01, 0x45, 0x06, 0xea,
-    0x01, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0xff, 0xcf, 0x03, 0x96,
-    0x03, 0x28, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x37, 0x00, 0x3c, 0x00, 0x40,
-    0x00, 0x45, 0x00, 0x49, 0x00, 0x00, 0x01, 0x15, 0x23, 0x06, 0x07, 0x33,
-    0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x36, 0x37, 0x23, 0x35, 0x13, 0x11,
-    0x23, 0x11, 0x16, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17, 0x36, 0x37, 0x23,
-    0x11, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11, 0x23,
-    0x06, 0x07, 0x1e, 0x01, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x01, 0x3d, 0x01, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x05,
-    0x35, 0x23, 0x1d, 0x01, 0x37, 0x35, 0x23, 0x15, 0x01, 0x73, 0x70, 0x19,
-    0x1e, 0x90, 0xe4, 0x18, 0x0e, 0x3c, 0x70, 0x2d, 0x70, 0xcf, 0x4e, 0xfb,
-    0x44, 0x36, 0x2d, 0x3f, 0x26, 0x35, 0x15, 0x08, 0xbc, 0xc0, 0xd4, 0x02,
-    0x04, 0xe2, 0xba, 0xbd, 0x09, 0x21, 0x2e, 0x87, 0x65, 0x16, 0x60, 0x8c,
-    0x35, 0x10, 0x07, 0x4f, 0x98, 0x25, 0x01, 0x1f, 0x71, 0x71, 0x71, 0x01,
-    0x2a, 0x6b, 0x6b, 0x6b, 0x03, 0x10, 0x4c, 0x67, 0x53, 0xfe, 0x32, 0x01,
-    0x14, 0x2c, 0x16, 0x35, 0xbe, 0xc3, 0x4c, 0xfd, 0x75, 0x01, 0x3a, 0xfe,
-    0xc6, 0x46, 0x2e, 0x32, 0x46, 0x2d, 0x3c, 0x2f, 0x29, 0x44, 0x01, 0x81,
-    0x49, 0x4a, 0x4a, 0x49, 0xfe, 0x7f, 0x64, 0x39, 0x1a, 0x1f, 0x0a, 0x52,
-    0x0c, 0x24, 0x1c, 0x08, 0x05, 0x41, 0x2b, 0x4e, 0x01, 0x43, 0x09, 0x4b,
-    0x54, 0x9b, 0x51, 0x51, 0x9b, 0x54, 0x53, 0x01, 0x9b, 0x51, 0x51, 0x00,
-    0x00, 0x08, 0x00, 0x17, 0xff, 0xcf, 0x03, 0x68, 0x03, 0x5f, 0x00, 0x0f,
-    0x00, 0x13, 0x00, 0x3c, 0x00, 0x42, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x50,
-    0x00, 0x54, 0x00, 0x00, 0x01, 0x15, 0x23, 0x06, 0x07, 0x33, 0x11, 0x23,
-    0x11, 0x06, 0x07, 0x27, 0x36, 0x37, 0x23, 0x35, 0x13, 0x11, 0x23, 0x11,
-    0x16, 0x37, 0x36, 0x3d, 0x01, 0x07, 0x27, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x33, 0x15, 0x06, 0x07, 0x33, 0x11, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f,
-    0x01, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01, 0x23, 0x15, 0x23, 0x35, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x36, 0x37, 0x23, 0x06, 0x07, 0x13,
-    0x35, 0x23, 0x15, 0x14, 0x07, 0x37, 0x35, 0x23, 0x15, 0x05, 0x35, 0x23,
-    0x15, 0x37, 0x35, 0x23, 0x15, 0x01, 0x7d, 0x80, 0x16, 0x20, 0x8e, 0xde,
-    0x0e, 0x13, 0x3f, 0x6a, 0x2e, 0x6d, 0xca, 0x4a, 0xb5, 0x12, 0x12, 0x17,
-    0x38, 0x85, 0x4a, 0x4e, 0x10, 0x0f, 0xe2, 0x28, 0x25, 0x89, 0x0e, 0x21,
-    0x1f, 0x23, 0x2b, 0x10, 0x22, 0x1d, 0x16, 0x0b, 0x75, 0x4d, 0x7b, 0x06,
-    0x04, 0x11, 0x3c, 0x4c, 0x01, 0x38, 0x1e, 0x2f, 0xa4, 0x13, 0x2a, 0x7a,
-    0x73, 0x02, 0x75, 0x73, 0x01, 0x35, 0x75, 0x75, 0x75, 0x03, 0x13, 0x54,
-    0x61, 0x5c, 0xfe, 0x2c, 0x01, 0x1e, 0x1c, 0x1e, 0x33, 0xb6, 0xc4, 0x54,
-    0xfd, 0x6c, 0x01, 0x30, 0xfe, 0xd0, 0x30, 0x45, 0x4a, 0x8b, 0xac, 0x18,
-    0x37, 0x8e, 0x9d, 0x18, 0x23, 0x1a, 0x46, 0x34, 0x2a, 0xfd, 0xec, 0x28,
-    0x2b, 0x15, 0x05, 0x06, 0x02, 0x54, 0x02, 0x0e, 0x1b, 0x52, 0xba, 0xba,
-    0x23, 0x12, 0x4d, 0x5d, 0x29, 0x02, 0x6e, 0x1e, 0x38, 0x1e, 0x38, 0xfe,
-    0x99, 0x63, 0x11, 0x20, 0x32, 0xb5, 0x62, 0x62, 0xb5, 0x63, 0x63, 0xb5,
-    0x62, 0x62, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0xff, 0xd9, 0x03, 0x8c,
-    0x03, 0x3e, 0x00, 0x13, 0x00, 0x36, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x33, 0x15, 0x21, 0x37, 0x33, 0x35, 0x23, 0x35, 0x24, 0x37, 0x23, 0x35,
-    0x33, 0x35, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x2f,
-    0x01, 0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x01, 0x21, 0x11, 0x21, 0x25,
-    0x35, 0x21, 0x15, 0x02, 0x48, 0xc8, 0x01, 0xed, 0xd3, 0xbc, 0xbc, 0xf2,
-    0xfd, 0xbd, 0x01, 0xfe, 0xbb, 0xfe, 0xea, 0x34, 0x76, 0x7b, 0x27, 0x3b,
-    0x15, 0x3a, 0x5d, 0x60, 0x29, 0x1d, 0x2d, 0x49, 0x71, 0x71, 0x1c, 0x30,
-    0x21, 0x18, 0x3b, 0x17, 0x20, 0x13, 0x50, 0x23, 0x2b, 0x42, 0x01, 0x75,
-    0x01, 0xb9, 0xfe, 0x47, 0x01, 0x65, 0xfe, 0xee, 0x01, 0x0b, 0x6b, 0x51,
-    0x51, 0x6b, 0x50, 0x6a, 0x53, 0x53, 0x6a, 0x50, 0x4c, 0x9f, 0x52, 0x72,
-    0x07, 0x09, 0x51, 0x08, 0x13, 0x18, 0x10, 0x52, 0x0e, 0x12, 0x84, 0x52,
-    0x2e, 0x1d, 0x38, 0x27, 0x26, 0x31, 0x25, 0x29, 0x19, 0xfe, 0x7d, 0x01,
-    0x5f, 0x5a, 0x50, 0x33, 0x02, 0x61, 0xfe, 0xea, 0x4b, 0x7f, 0x7f, 0x00,
-    0x00, 0x03, 0x00, 0x3c, 0x00, 0x04, 0x03, 0x84, 0x03, 0x56, 0x00, 0x0b,
-    0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x25, 0x36, 0x12, 0x37, 0x17, 0x0e,
-    0x01, 0x07, 0x21, 0x15, 0x21, 0x35, 0x13, 0x21, 0x27, 0x26, 0x27, 0x37,
-    0x16, 0x17, 0x16, 0x17, 0x21, 0x15, 0x21, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x01, 0xf3, 0x31, 0x61, 0x1d, 0x5d, 0x23,
-    0x59, 0x2d, 0x01, 0x2e, 0xfc, 0xb8, 0x1c, 0x01, 0x6c, 0x10, 0x0d, 0x0b,
-    0x5b, 0x0e, 0x0c, 0x0d, 0x05, 0x01, 0x45, 0xfc, 0xf0, 0xbd, 0x23, 0x29,
-    0x24, 0x1a, 0x58, 0x12, 0x28, 0x2b, 0x21, 0x5a, 0x6b, 0x01, 0x10, 0x6e,
-    0x1b, 0x78, 0xf6, 0x60, 0x56, 0x56, 0x02, 0x65, 0x3c, 0x2e, 0x1b, 0x12,
-    0x25, 0x2b, 0x2a, 0x1d, 0x56, 0x29, 0x51, 0x79, 0x61, 0x5f, 0x23, 0x48,
-    0x79, 0x7e, 0x4e, 0x00, 0x00, 0x06, 0x00, 0x1c, 0xff, 0xdc, 0x03, 0x79,
-    0x03, 0x54, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x2f, 0x00, 0x39, 0x00, 0x55,
-    0x00, 0x5d, 0x00, 0x00, 0x01, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35,
-    0x33, 0x15, 0x33, 0x35, 0x00, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x37, 0x3e, 0x01, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x13, 0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17,
-    0x07, 0x33, 0x15, 0x21, 0x17, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x05, 0x21, 0x15, 0x23, 0x0f, 0x01, 0x33, 0x11, 0x14, 0x06,
-    0x07, 0x06, 0x23, 0x27, 0x23, 0x35, 0x23, 0x11, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x11, 0x33, 0x3f, 0x01, 0x23, 0x01, 0x32, 0x3e, 0x01, 0x3d, 0x01,
-    0x23, 0x15, 0x02, 0x80, 0x81, 0x4b, 0xfe, 0x1e, 0x4a, 0x81, 0xfe, 0x0d,
-    0x63, 0x18, 0x17, 0x18, 0x07, 0x48, 0x06, 0x1d, 0x13, 0x16, 0x17, 0x0f,
-    0x1e, 0x0f, 0x0b, 0x2e, 0x63, 0x52, 0x3f, 0x0f, 0x0f, 0x78, 0x09, 0x08,
-    0x0e, 0x08, 0x48, 0x0d, 0x0b, 0x0f, 0x03, 0x33, 0x8e, 0xfe, 0xe2, 0x4c,
-    0x11, 0x13, 0x12, 0x0a, 0x42, 0x06, 0x16, 0x11, 0x13, 0x01, 0x1a, 0x02,
-    0x2a, 0xfc, 0x0e, 0x0b, 0xfe, 0x20, 0x2b, 0x32, 0x27, 0x0e, 0x2b, 0x49,
-    0x49, 0x4c, 0x4a, 0xb1, 0x0d, 0x0c, 0xd8, 0x01, 0x97, 0x18, 0x13, 0x06,
-    0x4a, 0x03, 0x54, 0xbf, 0x8a, 0xd1, 0xd1, 0x8a, 0xbf, 0xfd, 0x23, 0x17,
-    0x4f, 0x7d, 0x7d, 0x61, 0x08, 0x50, 0x92, 0x5e, 0x50, 0x06, 0x05, 0x08,
-    0x05, 0x51, 0x0f, 0x15, 0x12, 0x0a, 0x4b, 0x02, 0x3e, 0x2b, 0x19, 0x34,
-    0x16, 0x11, 0x1e, 0x2a, 0x34, 0x18, 0x0b, 0x4d, 0x2e, 0x3f, 0x69, 0x5f,
-    0x4a, 0x11, 0x2b, 0x80, 0x61, 0x47, 0x1f, 0x48, 0x2e, 0x21, 0xfe, 0xd3,
-    0x32, 0x2c, 0x05, 0x04, 0x4c, 0xfe, 0xfe, 0xf4, 0x01, 0x0c, 0xfe, 0xb8,
-    0x01, 0x92, 0x27, 0x28, 0xfe, 0x69, 0x05, 0x11, 0x15, 0xd3, 0xfe, 0x00,
-    0x00, 0x05, 0x00, 0x1e, 0xff, 0xda, 0x03, 0x86, 0x03, 0x5b, 0x00, 0x17,
-    0x00, 0x22, 0x00, 0x36, 0x00, 0x40, 0x00, 0x53, 0x00, 0x00, 0x01, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x14, 0x06, 0x07, 0x06, 0x2b, 0x01,
-    0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x11, 0x21, 0x35, 0x06, 0x37,
-    0x17, 0x06, 0x07, 0x11, 0x23, 0x11, 0x06, 0x07, 0x27, 0x12, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x33, 0x15, 0x23, 0x16, 0x17, 0x07, 0x2e, 0x01,
-    0x27, 0x23, 0x06, 0x07, 0x27, 0x05, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x12, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x23,
-    0x16, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x23, 0x06, 0x07, 0x27, 0x02, 0xa9,
-    0x56, 0x87, 0x87, 0x29, 0x3a, 0x29, 0x3b, 0x20, 0x11, 0x4a, 0x13, 0x23,
-    0x1a, 0x08, 0xfe, 0x90, 0x95, 0x4f, 0x4e, 0x1f, 0x16, 0x56, 0x25, 0x33,
-    0x40, 0x42, 0x30, 0x38, 0x11, 0x51, 0x0e, 0x14, 0xe8, 0x95, 0x26, 0x0c,
-    0x47, 0x0a, 0x2e, 0x12, 0x21, 0x35, 0x39, 0x46, 0x01, 0x85, 0x2d, 0x27,
-    0x2e, 0x14, 0x46, 0x19, 0x2b, 0x29, 0x23, 0x76, 0x4b, 0x1b, 0x4f, 0x12,
-    0x0d, 0x01, 0x0d, 0x9b, 0x24, 0x14, 0x44, 0x0f, 0x32, 0x16, 0x34, 0x25,
-    0x2e, 0x4a, 0x01, 0xc6, 0x60, 0x60, 0x52, 0xfe, 0xde, 0x3a, 0x31, 0x06,
-    0x04, 0x5e, 0x04, 0x06, 0x14, 0x1b, 0x01, 0x08, 0x52, 0x2e, 0xa9, 0x23,
-    0x3e, 0x25, 0xfe, 0x1f, 0x01, 0x5f, 0x33, 0x36, 0x39, 0x01, 0x78, 0x50,
-    0x5e, 0x2c, 0x1d, 0x23, 0x25, 0x4d, 0x37, 0x18, 0x26, 0x13, 0x4a, 0x18,
-    0x56, 0x40, 0x32, 0xd6, 0x2d, 0x30, 0x35, 0x1e, 0x3d, 0x26, 0x35, 0x34,
-    0x23, 0x01, 0x4f, 0x90, 0x48, 0x1b, 0x2f, 0x1b, 0x4e, 0x2c, 0x1b, 0x2d,
-    0x18, 0x43, 0x19, 0x49, 0x41, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2c,
-    0xff, 0xde, 0x03, 0x7e, 0x03, 0x5c, 0x00, 0x35, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x35, 0x21, 0x35, 0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x0e, 0x01, 0x07,
-    0x06, 0x23, 0x22, 0x2f, 0x01, 0x17, 0x16, 0x33, 0x32, 0x37, 0x32, 0x3e,
-    0x01, 0x3d, 0x01, 0x21, 0x1e, 0x01, 0x17, 0x07, 0x2e, 0x01, 0x27, 0x37,
-    0x23, 0x35, 0x21, 0x35, 0x21, 0x35, 0x12, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x33, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x23, 0x16, 0x17,
-    0x07, 0x26, 0x27, 0x23, 0x06, 0x07, 0x27, 0x36, 0x37, 0x23, 0x16, 0x17,
-    0x07, 0x2e, 0x01, 0x27, 0x23, 0x06, 0x07, 0x27, 0x01, 0xab, 0xfe, 0xd1,
-    0x01, 0x2f, 0x59, 0x01, 0x34, 0xfe, 0xcc, 0x01, 0x7a, 0xba, 0x9b, 0x9b,
-    0x11, 0x2b, 0x28, 0x31, 0x34, 0x1d, 0x0e, 0x10, 0x1c, 0x28, 0x10, 0x15,
-    0x09, 0x1c, 0x17, 0x07, 0xfe, 0xa5, 0x22, 0x57, 0x19, 0x32, 0x19, 0x70,
-    0x24, 0x1e, 0x8d, 0x02, 0x17, 0xfd, 0xca, 0x27, 0x53, 0x19, 0x54, 0x0e,
-    0x12, 0xe4, 0x34, 0x20, 0x52, 0x0a, 0x16, 0x01, 0x16, 0xac, 0x20, 0x0f,
-    0x44, 0x1e, 0x29, 0x38, 0x19, 0x18, 0x4b, 0x0a, 0x12, 0x95, 0x20, 0x12,
-    0x46, 0x0d, 0x28, 0x10, 0x1e, 0x29, 0x37, 0x45, 0x01, 0xa3, 0x4f, 0x46,
-    0x36, 0x36, 0x46, 0x4f, 0x49, 0x4c, 0x4b, 0x70, 0x27, 0x2d, 0x17, 0x04,
-    0x06, 0x01, 0x53, 0x01, 0x02, 0x01, 0x07, 0x15, 0x19, 0x5e, 0x17, 0x41,
-    0x14, 0x3d, 0x19, 0x52, 0x15, 0x29, 0x4b, 0x4c, 0x49, 0x01, 0x02, 0x7c,
-    0x3b, 0x19, 0x1c, 0x22, 0x44, 0x4c, 0x4d, 0x15, 0x16, 0x2a, 0x49, 0x2b,
-    0x1c, 0x27, 0x35, 0x39, 0x28, 0x21, 0x22, 0x0d, 0x1a, 0x2f, 0x1f, 0x23,
-    0x18, 0x43, 0x16, 0x3e, 0x3f, 0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x2b,
-    0xff, 0xea, 0x03, 0x7c, 0x03, 0x5f, 0x00, 0x07, 0x00, 0x42, 0x00, 0x46,
-    0x00, 0x4a, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11,
-    0x26, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x33, 0x15, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x21, 0x15, 0x23, 0x16, 0x1f, 0x01, 0x07, 0x26, 0x27, 0x23,
-    0x06, 0x07, 0x27, 0x16, 0x1f, 0x01, 0x21, 0x15, 0x23, 0x35, 0x21, 0x15,
-    0x23, 0x35, 0x21, 0x27, 0x2e, 0x01, 0x27, 0x37, 0x27, 0x30, 0x37, 0x23,
-    0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x23, 0x06, 0x07, 0x27, 0x01,
-    0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x03, 0x08, 0xfd, 0xfe, 0x02,
-    0x1b, 0xfd, 0x8d, 0x4e, 0x24, 0x2b, 0x19, 0x54, 0x0e, 0x12, 0xec, 0x2a,
+    0x01, 0x14, 0x00, 0x07, 0x00, 0x16, 0xff, 0xcf, 0x03, 0x96, 0x03, 0x28,
+    0xc6, 0x02, 0x31, 0x37, 0x00, 0x3c, 0xf8, 0x05, 0x11, 0x49, 0x40, 0x21,
+    0x05, 0xb6, 0x00, 0x00, 0xc6, 0x00, 0x55, 0x13, 0x11, 0x23, 0x11, 0x16,
+    0x90, 0x22, 0x15, 0x11, 0x04, 0x18, 0x00, 0x73, 0x03, 0x07, 0x23, 0x39,
+    0x15, 0x27, 0x83, 0x11, 0x15, 0x05, 0x7e, 0x11, 0xf0, 0x6b, 0x73, 0x70,
+    0x19, 0x1e, 0x90, 0xe4, 0x18, 0x0e, 0x3c, 0x70, 0x2d, 0x70, 0xcf, 0x4e,
+    0xfb, 0x44, 0x36, 0x2d, 0x3f, 0x26, 0x35, 0x15, 0x08, 0xbc, 0xc0, 0xd4,
+    0x02, 0x04, 0xe2, 0xba, 0xbd, 0x09, 0x21, 0x2e, 0x87, 0x65, 0x16, 0x60,
+    0x8c, 0x35, 0x10, 0x07, 0x4f, 0x98, 0x25, 0x01, 0x1f, 0x71, 0x71, 0x71,
+    0x01, 0x2a, 0x6b, 0x6b, 0x6b, 0x03, 0x10, 0x4c, 0x67, 0x53, 0xfe, 0x32,
+    0x01, 0x14, 0x2c, 0x16, 0x35, 0xbe, 0xc3, 0x4c, 0xfd, 0x75, 0x01, 0x3a,
+    0xfe, 0xc6, 0x46, 0x2e, 0x32, 0x46, 0x2d, 0x3c, 0x2f, 0x29, 0x44, 0x01,
+    0x81, 0x49, 0x4a, 0x4a, 0x49, 0xfe, 0x7f, 0x64, 0x39, 0x1a, 0x1f, 0x0a,
+    0x52, 0x0c, 0x24, 0x1c, 0x08, 0x05, 0x41, 0x2b, 0x4e, 0x01, 0x43, 0x09,
+    0x4b, 0x54, 0x9b, 0x51, 0x51, 0x9b, 0x54, 0x53, 0x01, 0x9b, 0x51, 0x51,
+    0xdc, 0x48, 0x00, 0x10, 0x0c, 0x31, 0x68, 0x03, 0x5f, 0xe0, 0x00, 0x53,
+    0x3c, 0x00, 0x42, 0x00, 0x48, 0xb2, 0x34, 0x0f, 0xe2, 0x00, 0x04, 0x10,
+    0x36, 0x66, 0x1e, 0x05, 0xbb, 0x16, 0x09, 0xd3, 0x07, 0x01, 0x99, 0x34,
+    0x04, 0xb0, 0x10, 0x01, 0x36, 0x0b, 0x15, 0x13, 0x9f, 0x0f, 0x04, 0xe1,
+    0x03, 0xf0, 0x7e, 0x01, 0x7d, 0x80, 0x16, 0x20, 0x8e, 0xde, 0x0e, 0x13,
+    0x3f, 0x6a, 0x2e, 0x6d, 0xca, 0x4a, 0xb5, 0x12, 0x12, 0x17, 0x38, 0x85,
+    0x4a, 0x4e, 0x10, 0x0f, 0xe2, 0x28, 0x25, 0x89, 0x0e, 0x21, 0x1f, 0x23,
+    0x2b, 0x10, 0x22, 0x1d, 0x16, 0x0b, 0x75, 0x4d, 0x7b, 0x06, 0x04, 0x11,
+    0x3c, 0x4c, 0x01, 0x38, 0x1e, 0x2f, 0xa4, 0x13, 0x2a, 0x7a, 0x73, 0x02,
+    0x75, 0x73, 0x01, 0x35, 0x75, 0x75, 0x75, 0x03, 0x13, 0x54, 0x61, 0x5c,
+    0xfe, 0x2c, 0x01, 0x1e, 0x1c, 0x1e, 0x33, 0xb6, 0xc4, 0x54, 0xfd, 0x6c,
+    0x01, 0x30, 0xfe, 0xd0, 0x30, 0x45, 0x4a, 0x8b, 0xac, 0x18, 0x37, 0x8e,
+    0x9d, 0x18, 0x23, 0x1a, 0x46, 0x34, 0x2a, 0xfd, 0xec, 0x28, 0x2b, 0x15,
+    0x05, 0x06, 0x02, 0x54, 0x02, 0x0e, 0x1b, 0x52, 0xba, 0xba, 0x23, 0x12,
+    0x4d, 0x5d, 0x29, 0x02, 0x6e, 0x1e, 0x38, 0x1e, 0x38, 0xfe, 0x99, 0x63,
+    0x11, 0x20, 0x32, 0xb5, 0x62, 0x62, 0xb5, 0x63, 0x63, 0xb5, 0x62, 0x62,
+    0xb4, 0x5a, 0xa4, 0xff, 0xd9, 0x03, 0x8c, 0x03, 0x3e, 0x00, 0x13, 0x00,
+    0x36, 0x3c, 0x25, 0x04, 0xbd, 0x19, 0x01, 0xc1, 0x19, 0x10, 0x37, 0xc9,
+    0x01, 0x11, 0x24, 0x42, 0x03, 0x07, 0xba, 0x41, 0x0b, 0xef, 0x0d, 0x01,
+    0x92, 0x3b, 0x20, 0x11, 0x21, 0xc9, 0x08, 0xf1, 0x58, 0x02, 0x48, 0xc8,
+    0x01, 0xed, 0xd3, 0xbc, 0xbc, 0xf2, 0xfd, 0xbd, 0x01, 0xfe, 0xbb, 0xfe,
+    0xea, 0x34, 0x76, 0x7b, 0x27, 0x3b, 0x15, 0x3a, 0x5d, 0x60, 0x29, 0x1d,
+    0x2d, 0x49, 0x71, 0x71, 0x1c, 0x30, 0x21, 0x18, 0x3b, 0x17, 0x20, 0x13,
+    0x50, 0x23, 0x2b, 0x42, 0x01, 0x75, 0x01, 0xb9, 0xfe, 0x47, 0x01, 0x65,
+    0xfe, 0xee, 0x01, 0x0b, 0x6b, 0x51, 0x51, 0x6b, 0x50, 0x6a, 0x53, 0x53,
+    0x6a, 0x50, 0x4c, 0x9f, 0x52, 0x72, 0x07, 0x09, 0x51, 0x08, 0x13, 0x18,
+    0x10, 0x52, 0x0e, 0x12, 0x84, 0x52, 0x2e, 0x1d, 0x38, 0x27, 0x26, 0x31,
+    0x25, 0x29, 0x19, 0xfe, 0x7d, 0x01, 0x5f, 0x5a, 0x50, 0x33, 0x02, 0x61,
+    0xfe, 0xea, 0x4b, 0x7f, 0x7e, 0x2b, 0x73, 0x3c, 0x00, 0x04, 0x03, 0x84,
+    0x03, 0x56, 0x04, 0x23, 0x41, 0x00, 0x25, 0x36, 0x12, 0x7e, 0x08, 0x00,
+    0x50, 0x06, 0x19, 0x13, 0x21, 0x3c, 0x06, 0x59, 0x0a, 0xf2, 0x36, 0xf3,
+    0x31, 0x61, 0x1d, 0x5d, 0x23, 0x59, 0x2d, 0x01, 0x2e, 0xfc, 0xb8, 0x1c,
+    0x01, 0x6c, 0x10, 0x0d, 0x0b, 0x5b, 0x0e, 0x0c, 0x0d, 0x05, 0x01, 0x45,
+    0xfc, 0xf0, 0xbd, 0x23, 0x29, 0x24, 0x1a, 0x58, 0x12, 0x28, 0x2b, 0x21,
+    0x5a, 0x6b, 0x01, 0x10, 0x6e, 0x1b, 0x78, 0xf6, 0x60, 0x56, 0x56, 0x02,
+    0x65, 0x3c, 0x2e, 0x1b, 0x12, 0x25, 0x2b, 0x2a, 0x1d, 0x56, 0x29, 0x51,
+    0x79, 0x61, 0x5f, 0x23, 0x48, 0x79, 0x7e, 0x4e, 0xe4, 0x12, 0x91, 0xdc,
+    0x03, 0x79, 0x03, 0x54, 0x00, 0x0b, 0x00, 0x20, 0xf4, 0x57, 0x11, 0x55,
+    0xb8, 0x25, 0x03, 0x22, 0x2a, 0x20, 0x33, 0x15, 0xf7, 0x0e, 0x05, 0x19,
+    0x08, 0x2e, 0x37, 0x36, 0x05, 0x1b, 0x01, 0x23, 0x0b, 0x06, 0x99, 0x00,
+    0x64, 0x05, 0x21, 0x15, 0x23, 0x07, 0x07, 0xac, 0x37, 0x15, 0x23, 0xc8,
+    0x37, 0x00, 0xa3, 0x3f, 0x12, 0x01, 0xbe, 0x06, 0xf1, 0x98, 0x15, 0x02,
+    0x80, 0x81, 0x4b, 0xfe, 0x1e, 0x4a, 0x81, 0xfe, 0x0d, 0x63, 0x18, 0x17,
+    0x18, 0x07, 0x48, 0x06, 0x1d, 0x13, 0x16, 0x17, 0x0f, 0x1e, 0x0f, 0x0b,
+    0x2e, 0x63, 0x52, 0x3f, 0x0f, 0x0f, 0x78, 0x09, 0x08, 0x0e, 0x08, 0x48,
+    0x0d, 0x0b, 0x0f, 0x03, 0x33, 0x8e, 0xfe, 0xe2, 0x4c, 0x11, 0x13, 0x12,
+    0x0a, 0x42, 0x06, 0x16, 0x11, 0x13, 0x01, 0x1a, 0x02, 0x2a, 0xfc, 0x0e,
+    0x0b, 0xfe, 0x20, 0x2b, 0x32, 0x27, 0x0e, 0x2b, 0x49, 0x49, 0x4c, 0x4a,
+    0xb1, 0x0d, 0x0c, 0xd8, 0x01, 0x97, 0x18, 0x13, 0x06, 0x4a, 0x03, 0x54,
+    0xbf, 0x8a, 0xd1, 0xd1, 0x8a, 0xbf, 0xfd, 0x23, 0x17, 0x4f, 0x7d, 0x7d,
+    0x61, 0x08, 0x50, 0x92, 0x5e, 0x50, 0x06, 0x05, 0x08, 0x05, 0x51, 0x0f,
+    0x15, 0x12, 0x0a, 0x4b, 0x02, 0x3e, 0x2b, 0x19, 0x34, 0x16, 0x11, 0x1e,
+    0x2a, 0x34, 0x18, 0x0b, 0x4d, 0x2e, 0x3f, 0x69, 0x5f, 0x4a, 0x11, 0x2b,
+    0x80, 0x61, 0x47, 0x1f, 0x48, 0x2e, 0x21, 0xfe, 0xd3, 0x32, 0x2c, 0x05,
+    0x04, 0x4c, 0xfe, 0xfe, 0xf4, 0x01, 0x0c, 0xfe, 0xb8, 0x01, 0x92, 0x27,
+    0x28, 0xfe, 0x69, 0x05, 0x11, 0x15, 0xd3, 0xfe, 0x00, 0x3a, 0x1b, 0x71,
+    0xda, 0x03, 0x86, 0x03, 0x5b, 0x00, 0x17, 0x2a, 0x20, 0x3b, 0x40, 0x00,
+    0x53, 0x2e, 0x16, 0x07, 0x2f, 0x16, 0x1d, 0x06, 0xa8, 0x24, 0x00, 0xd0,
+    0x37, 0x01, 0x2e, 0x04, 0x00, 0xb1, 0x05, 0x06, 0x19, 0x2b, 0x04, 0x31,
+    0x36, 0x07, 0x1d, 0x00, 0xf1, 0x89, 0x02, 0xa9, 0x56, 0x87, 0x87, 0x29,
+    0x3a, 0x29, 0x3b, 0x20, 0x11, 0x4a, 0x13, 0x23, 0x1a, 0x08, 0xfe, 0x90,
+    0x95, 0x4f, 0x4e, 0x1f, 0x16, 0x56, 0x25, 0x33, 0x40, 0x42, 0x30, 0x38,
+    0x11, 0x51, 0x0e, 0x14, 0xe8, 0x95, 0x26, 0x0c, 0x47, 0x0a, 0x2e, 0x12,
+    0x21, 0x35, 0x39, 0x46, 0x01, 0x85, 0x2d, 0x27, 0x2e, 0x14, 0x46, 0x19,
+    0x2b, 0x29, 0x23, 0x76, 0x4b, 0x1b, 0x4f, 0x12, 0x0d, 0x01, 0x0d, 0x9b,
+    0x24, 0x14, 0x44, 0x0f, 0x32, 0x16, 0x34, 0x25, 0x2e, 0x4a, 0x01, 0xc6,
+    0x60, 0x60, 0x52, 0xfe, 0xde, 0x3a, 0x31, 0x06, 0x04, 0x5e, 0x04, 0x06,
+    0x14, 0x1b, 0x01, 0x08, 0x52, 0x2e, 0xa9, 0x23, 0x3e, 0x25, 0xfe, 0x1f,
+    0x01, 0x5f, 0x33, 0x36, 0x39, 0x01, 0x78, 0x50, 0x5e, 0x2c, 0x1d, 0x23,
+    0x25, 0x4d, 0x37, 0x18, 0x26, 0x13, 0x4a, 0x18, 0x56, 0x40, 0x32, 0xd6,
+    0x2d, 0x30, 0x35, 0x1e, 0x3d, 0x26, 0x35, 0x34, 0x23, 0x01, 0x4f, 0x90,
+    0x48, 0x1b, 0x2f, 0x1b, 0x4e, 0x2c, 0x1b, 0x2d, 0x18, 0x43, 0x19, 0x49,
+    0x41, 0x28, 0xae, 0x43, 0x9c, 0xde, 0x03, 0x7e, 0x03, 0x5c, 0x00, 0x35,
+    0x00, 0x5b, 0xf8, 0x12, 0x04, 0x23, 0x19, 0x03, 0x08, 0x0d, 0x01, 0xd1,
+    0x24, 0x03, 0x87, 0x07, 0x02, 0xdb, 0x00, 0x21, 0x37, 0x23, 0x30, 0x00,
+    0x13, 0x12, 0x0e, 0x01, 0x08, 0xf8, 0x00, 0x12, 0x27, 0xc5, 0x06, 0x07,
+    0x04, 0x01, 0x70, 0x01, 0xab, 0xfe, 0xd1, 0x01, 0x2f, 0x59, 0xc9, 0x05,
+    0xf1, 0x4e, 0x01, 0x7a, 0xba, 0x9b, 0x9b, 0x11, 0x2b, 0x28, 0x31, 0x34,
+    0x1d, 0x0e, 0x10, 0x1c, 0x28, 0x10, 0x15, 0x09, 0x1c, 0x17, 0x07, 0xfe,
+    0xa5, 0x22, 0x57, 0x19, 0x32, 0x19, 0x70, 0x24, 0x1e, 0x8d, 0x02, 0x17,
+    0xfd, 0xca, 0x27, 0x53, 0x19, 0x54, 0x0e, 0x12, 0xe4, 0x34, 0x20, 0x52,
+    0x0a, 0x16, 0x01, 0x16, 0xac, 0x20, 0x0f, 0x44, 0x1e, 0x29, 0x38, 0x19,
+    0x18, 0x4b, 0x0a, 0x12, 0x95, 0x20, 0x12, 0x46, 0x0d, 0x28, 0x10, 0x1e,
+    0x29, 0x37, 0x45, 0x01, 0xa3, 0x4f, 0x46, 0x36, 0x36, 0x46, 0x4f, 0x49,
+    0x4c, 0x4b, 0x70, 0x27, 0x2d, 0x17, 0x04, 0x06, 0x01, 0x53, 0x01, 0x8b,
+    0x43, 0xf3, 0x2a, 0x5e, 0x17, 0x41, 0x14, 0x3d, 0x19, 0x52, 0x15, 0x29,
+    0x4b, 0x4c, 0x49, 0x01, 0x02, 0x7c, 0x3b, 0x19, 0x1c, 0x22, 0x44, 0x4c,
+    0x4d, 0x15, 0x16, 0x2a, 0x49, 0x2b, 0x1c, 0x27, 0x35, 0x39, 0x28, 0x21,
+    0x22, 0x0d, 0x1a, 0x2f, 0x1f, 0x23, 0x18, 0x43, 0x16, 0x3e, 0x3f, 0x30,
+    0x00, 0x04, 0x00, 0x2b, 0xff, 0xea, 0x03, 0x7c, 0x03, 0x5f, 0x00, 0x07,
+    0xaa, 0x3c, 0x05, 0x16, 0x44, 0x2d, 0x26, 0x37, 0xdd, 0x00, 0x04, 0xde,
+    0x00, 0x18, 0x16, 0xab, 0x2e, 0x00, 0x0e, 0x01, 0x20, 0x27, 0x30, 0xf0,
+    0x00, 0x05, 0xfe, 0x00, 0x05, 0xe0, 0x2d, 0xa0, 0x08, 0xfd, 0xfe, 0x02,
+    0x1b, 0xfd, 0x8d, 0x4e, 0x24, 0x2b, 0xd3, 0x00, 0xf0, 0x69, 0xec, 0x2a,
     0x21, 0x53, 0x16, 0x04, 0x01, 0x10, 0xa9, 0x0f, 0x17, 0x0d, 0x40, 0x1c,
     0x32, 0x30, 0x16, 0x17, 0x31, 0x08, 0x19, 0x0e, 0x01, 0x50, 0x59, 0xfd,
     0x9d, 0x58, 0x01, 0x69, 0x05, 0x06, 0x0f, 0x03, 0x49, 0x1d, 0x18, 0x97,
@@ -2135,66 +1686,49 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x18, 0x32, 0x07, 0x47, 0x11, 0x1f, 0x11, 0x2b, 0x2c, 0x40, 0x28, 0x1f,
     0x18, 0x0a, 0x28, 0x17, 0x8f, 0x4b, 0x4b, 0x8f, 0x08, 0x0b, 0x18, 0x05,
     0x19, 0x0e, 0x21, 0x02, 0x18, 0x20, 0x09, 0x29, 0x33, 0x39, 0x3d, 0x38,
-    0x32, 0xfd, 0xaf, 0x55, 0x55, 0x01, 0x1b, 0x41, 0x41, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x28, 0xff, 0xe0, 0x03, 0x96, 0x03, 0x32, 0x00, 0x45,
-    0x00, 0x4f, 0x00, 0x59, 0x00, 0x00, 0x13, 0x32, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x0f, 0x01, 0x17, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x32, 0x37, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x15, 0x14, 0x0e, 0x01, 0x07,
-    0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x06, 0x07,
-    0x27, 0x32, 0x37, 0x36, 0x37, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36,
-    0x37, 0x06, 0x23, 0x27, 0x10, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27,
-    0xab, 0x69, 0xbe, 0xfd, 0x6d, 0x14, 0x8d, 0xef, 0x10, 0x12, 0x55, 0x5e,
-    0xa7, 0x4e, 0x52, 0x4e, 0x39, 0x5b, 0x71, 0x74, 0x5f, 0x4b, 0xa8, 0x5a,
-    0x2e, 0x2c, 0x30, 0x3a, 0x24, 0x45, 0x3f, 0x28, 0x3d, 0x13, 0x19, 0x5a,
-    0xa3, 0x11, 0x2b, 0x2b, 0x25, 0x3e, 0x10, 0x23, 0x2d, 0x19, 0x14, 0x07,
-    0x9b, 0xae, 0x0a, 0x20, 0x2e, 0x6f, 0x89, 0xa8, 0x86, 0x0b, 0x1a, 0x21,
-    0x10, 0x55, 0x5e, 0x89, 0x6f, 0x0d, 0x44, 0x48, 0x2e, 0x36, 0x26, 0x4f,
-    0x50, 0x47, 0x2e, 0x02, 0x5a, 0x56, 0x36, 0x39, 0x4f, 0x30, 0x36, 0x50,
-    0x46, 0x44, 0x03, 0x07, 0x0a, 0x11, 0x10, 0x4c, 0x12, 0x10, 0x01, 0x13,
-    0x4f, 0x39, 0x02, 0x08, 0x3e, 0x49, 0x3a, 0x55, 0x4e, 0x52, 0x32, 0x0a,
-    0x05, 0x05, 0x2e, 0x2b, 0x34, 0x1e, 0x45, 0x43, 0x35, 0x36, 0x1c, 0x1b,
-    0x06, 0x07, 0xb8, 0x2b, 0x2e, 0x17, 0x05, 0x05, 0x5b, 0x03, 0x08, 0x17,
-    0x1b, 0x9c, 0x06, 0x02, 0x52, 0x0d, 0x2b, 0x5b, 0x08, 0x02, 0x49, 0x01,
-    0x09, 0x09, 0x33, 0x4f, 0x07, 0x50, 0xfd, 0x58, 0x32, 0x34, 0x2d, 0x3c,
-    0x25, 0x3b, 0x3a, 0x29, 0x44, 0xba, 0x31, 0x24, 0x24, 0x3d, 0x43, 0x2f,
-    0x31, 0x30, 0x24, 0x00, 0x00, 0x03, 0x00, 0x25, 0xff, 0xce, 0x03, 0x9f,
-    0x03, 0x57, 0x00, 0x43, 0x00, 0x4e, 0x00, 0x53, 0x00, 0x00, 0x01, 0x26,
-    0x27, 0x26, 0x27, 0x37, 0x16, 0x17, 0x16, 0x17, 0x07, 0x21, 0x15, 0x23,
-    0x02, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x26, 0x27, 0x23, 0x35, 0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x06, 0x07, 0x27,
-    0x3e, 0x01, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x36, 0x37, 0x36, 0x37, 0x17, 0x35, 0x00, 0x37, 0x36, 0x37, 0x1f, 0x01,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x00, 0x17, 0x36, 0x37, 0x23, 0x02, 0x60,
-    0x0b, 0x0c, 0x09, 0x13, 0x4d, 0x0e, 0x11, 0x12, 0x05, 0x45, 0x01, 0x21,
-    0x5c, 0x29, 0x5e, 0x5b, 0x9b, 0x32, 0xa2, 0x5b, 0x5e, 0xa2, 0x37, 0xa4,
-    0x5e, 0x65, 0x20, 0x2d, 0x2e, 0x31, 0x44, 0x25, 0x5b, 0x62, 0x01, 0x59,
-    0x3a, 0x57, 0x3f, 0x0e, 0x12, 0x18, 0x0c, 0x24, 0x37, 0x6f, 0x2d, 0x0d,
-    0x0c, 0x12, 0x0a, 0x1e, 0x26, 0x2c, 0x19, 0x49, 0x25, 0x22, 0x2c, 0x1e,
-    0x3c, 0x33, 0x1c, 0x20, 0x45, 0xfe, 0xd0, 0x81, 0x69, 0x4c, 0x01, 0x02,
-    0x3f, 0x71, 0x66, 0x47, 0x10, 0x02, 0x01, 0x4c, 0x4b, 0x20, 0xd5, 0x02,
-    0xb8, 0x29, 0x1b, 0x1d, 0x2a, 0x14, 0x1f, 0x2b, 0x30, 0x17, 0x0e, 0x51,
-    0xfe, 0xfd, 0x8d, 0x66, 0x48, 0x55, 0x56, 0x67, 0x65, 0x5e, 0x4d, 0x50,
-    0x6b, 0x9c, 0xf5, 0x20, 0x59, 0x4f, 0x6f, 0x2b, 0x0c, 0x17, 0x56, 0x11,
-    0x08, 0x0f, 0x06, 0x54, 0x03, 0x12, 0x15, 0x2f, 0x5a, 0x0a, 0x04, 0x4f,
-    0x01, 0x0b, 0x0d, 0x2b, 0x4b, 0x52, 0x41, 0x1e, 0x52, 0x39, 0x4e, 0x26,
-    0x03, 0x07, 0x32, 0x43, 0x24, 0x2c, 0xfd, 0xb8, 0x18, 0x15, 0x14, 0x29,
-    0x2d, 0x10, 0x14, 0x14, 0x0a, 0x52, 0x01, 0x2f, 0x7a, 0x7a, 0xcd, 0x00,
-    0x00, 0x03, 0x00, 0x21, 0xff, 0xc8, 0x03, 0x8b, 0x03, 0x57, 0x00, 0x0a,
-    0x00, 0x2f, 0x00, 0x82, 0x00, 0x00, 0x36, 0x37, 0x36, 0x37, 0x1f, 0x01,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x12, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x37,
-    0x36, 0x37, 0x07, 0x06, 0x07, 0x27, 0x00, 0x36, 0x37, 0x3e, 0x01, 0x3d,
-    0x01, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x23, 0x35,
-    0x33, 0x27, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x33, 0x15, 0x21, 0x06,
-    0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x11, 0x14, 0x16, 0x17, 0x32,
-    0x37, 0x32, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x0f,
-    0x01, 0x22, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x0f, 0x01, 0x15, 0x14, 0x07,
-    0x0e, 0x01, 0x07, 0x27, 0x59, 0x6b, 0x6a, 0x39, 0x06, 0x05, 0x22, 0x79,
+    0x32, 0xfd, 0xaf, 0x55, 0x55, 0x01, 0x1b, 0x41, 0x41, 0x00, 0x38, 0x3e,
+    0x01, 0x72, 0x11, 0x11, 0x32, 0xfc, 0x1c, 0x00, 0xe2, 0x15, 0x13, 0x32,
+    0x6a, 0x09, 0x08, 0x1b, 0x0c, 0x19, 0x32, 0x1b, 0x0c, 0x00, 0x29, 0x22,
+    0x1b, 0x06, 0x2d, 0x23, 0x00, 0x22, 0x00, 0x04, 0x01, 0x1a, 0x45, 0x06,
+    0x23, 0x27, 0x10, 0x22, 0x0c, 0x06, 0x44, 0x0e, 0xf2, 0x9c, 0xab, 0x69,
+    0xbe, 0xfd, 0x6d, 0x14, 0x8d, 0xef, 0x10, 0x12, 0x55, 0x5e, 0xa7, 0x4e,
+    0x52, 0x4e, 0x39, 0x5b, 0x71, 0x74, 0x5f, 0x4b, 0xa8, 0x5a, 0x2e, 0x2c,
+    0x30, 0x3a, 0x24, 0x45, 0x3f, 0x28, 0x3d, 0x13, 0x19, 0x5a, 0xa3, 0x11,
+    0x2b, 0x2b, 0x25, 0x3e, 0x10, 0x23, 0x2d, 0x19, 0x14, 0x07, 0x9b, 0xae,
+    0x0a, 0x20, 0x2e, 0x6f, 0x89, 0xa8, 0x86, 0x0b, 0x1a, 0x21, 0x10, 0x55,
+    0x5e, 0x89, 0x6f, 0x0d, 0x44, 0x48, 0x2e, 0x36, 0x26, 0x4f, 0x50, 0x47,
+    0x2e, 0x02, 0x5a, 0x56, 0x36, 0x39, 0x4f, 0x30, 0x36, 0x50, 0x46, 0x44,
+    0x03, 0x07, 0x0a, 0x11, 0x10, 0x4c, 0x12, 0x10, 0x01, 0x13, 0x4f, 0x39,
+    0x02, 0x08, 0x3e, 0x49, 0x3a, 0x55, 0x4e, 0x52, 0x32, 0x0a, 0x05, 0x05,
+    0x2e, 0x2b, 0x34, 0x1e, 0x45, 0x43, 0x35, 0x36, 0x1c, 0x1b, 0x06, 0x07,
+    0xb8, 0x2b, 0x2e, 0x17, 0x05, 0x05, 0x5b, 0x03, 0x08, 0x17, 0x1b, 0x9c,
+    0x06, 0x02, 0x52, 0x0d, 0x2b, 0x5b, 0x08, 0x02, 0x49, 0x01, 0x09, 0x09,
+    0x33, 0x4f, 0x07, 0x50, 0xfd, 0x58, 0x32, 0x34, 0x2d, 0x3c, 0x25, 0x3b,
+    0x3a, 0x29, 0x44, 0xba, 0x31, 0x24, 0x24, 0x3d, 0x43, 0x2f, 0x31, 0x30,
+    0x24, 0x8c, 0x09, 0xbb, 0xce, 0x03, 0x9f, 0x03, 0x57, 0x00, 0x43, 0x00,
+    0x4e, 0x00, 0x53, 0xc6, 0x40, 0x2a, 0x23, 0x02, 0x1d, 0x0e, 0x01, 0x08,
+    0x10, 0x05, 0xa2, 0x34, 0x17, 0x36, 0x0c, 0x01, 0x07, 0x5c, 0x0d, 0x11,
+    0x17, 0x54, 0x05, 0x03, 0xf7, 0x33, 0x01, 0x38, 0x0e, 0xf0, 0x9a, 0x02,
+    0x60, 0x0b, 0x0c, 0x09, 0x13, 0x4d, 0x0e, 0x11, 0x12, 0x05, 0x45, 0x01,
+    0x21, 0x5c, 0x29, 0x5e, 0x5b, 0x9b, 0x32, 0xa2, 0x5b, 0x5e, 0xa2, 0x37,
+    0xa4, 0x5e, 0x65, 0x20, 0x2d, 0x2e, 0x31, 0x44, 0x25, 0x5b, 0x62, 0x01,
+    0x59, 0x3a, 0x57, 0x3f, 0x0e, 0x12, 0x18, 0x0c, 0x24, 0x37, 0x6f, 0x2d,
+    0x0d, 0x0c, 0x12, 0x0a, 0x1e, 0x26, 0x2c, 0x19, 0x49, 0x25, 0x22, 0x2c,
+    0x1e, 0x3c, 0x33, 0x1c, 0x20, 0x45, 0xfe, 0xd0, 0x81, 0x69, 0x4c, 0x01,
+    0x02, 0x3f, 0x71, 0x66, 0x47, 0x10, 0x02, 0x01, 0x4c, 0x4b, 0x20, 0xd5,
+    0x02, 0xb8, 0x29, 0x1b, 0x1d, 0x2a, 0x14, 0x1f, 0x2b, 0x30, 0x17, 0x0e,
+    0x51, 0xfe, 0xfd, 0x8d, 0x66, 0x48, 0x55, 0x56, 0x67, 0x65, 0x5e, 0x4d,
+    0x50, 0x6b, 0x9c, 0xf5, 0x20, 0x59, 0x4f, 0x6f, 0x2b, 0x0c, 0x17, 0x56,
+    0x11, 0x08, 0x0f, 0x06, 0x54, 0x03, 0x12, 0x15, 0x2f, 0x5a, 0x0a, 0x04,
+    0x4f, 0x01, 0x0b, 0x0d, 0x2b, 0x4b, 0x52, 0x41, 0x1e, 0x52, 0x39, 0x4e,
+    0x26, 0x03, 0x07, 0x32, 0x43, 0x24, 0x2c, 0xfd, 0xb8, 0x18, 0x15, 0x14,
+    0x29, 0x2d, 0x10, 0x14, 0x14, 0x0a, 0x52, 0x01, 0x2f, 0x7a, 0x7a, 0xcd,
+    0x10, 0x01, 0xd3, 0x21, 0xff, 0xc8, 0x03, 0x8b, 0x03, 0x57, 0x00, 0x0a,
+    0x00, 0x2f, 0x00, 0x82, 0x3a, 0x10, 0x04, 0xde, 0x1e, 0x0a, 0xe8, 0x00,
+    0x0d, 0x0d, 0x01, 0x01, 0xf1, 0x00, 0x02, 0x75, 0x4a, 0x07, 0xdc, 0x3e,
+    0x15, 0x33, 0x80, 0x1d, 0x1e, 0x21, 0x7f, 0x0e, 0x01, 0x1f, 0x12, 0x10,
+    0x17, 0x5b, 0x04, 0x06, 0x23, 0x27, 0x02, 0x52, 0x16, 0x23, 0x07, 0x07,
+    0x4f, 0x1d, 0xf0, 0xec, 0x59, 0x6b, 0x6a, 0x39, 0x06, 0x05, 0x22, 0x79,
     0x5a, 0x4d, 0x0f, 0x15, 0x11, 0x16, 0x2a, 0x2d, 0x19, 0x4f, 0x17, 0x2b,
     0x25, 0x26, 0x2b, 0x40, 0x1e, 0x15, 0x4a, 0x25, 0x38, 0x39, 0x22, 0x41,
     0x5e, 0x02, 0x47, 0x46, 0x42, 0x48, 0x0d, 0x0b, 0x1a, 0x0a, 0x27, 0x3a,
@@ -2215,67 +1749,52 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x2e, 0x2f, 0x18, 0x21, 0x03, 0x04, 0xfe, 0xd5, 0x16, 0x10, 0x01, 0x01,
     0x14, 0x19, 0x36, 0x25, 0x13, 0x32, 0x32, 0x28, 0x28, 0x11, 0x01, 0x01,
     0x02, 0x05, 0x2c, 0x37, 0x01, 0x34, 0x03, 0x03, 0x31, 0x8f, 0x58, 0x2e,
-    0x4d, 0x24, 0x41, 0x00, 0x00, 0x04, 0x00, 0x26, 0xff, 0xf5, 0x03, 0x8b,
-    0x03, 0x4c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x00,
-    0x12, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x36, 0x37, 0x36, 0x37, 0x17, 0x35, 0x33, 0x11, 0x3e, 0x01, 0x37, 0x23,
-    0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x23, 0x15, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x2f, 0x01, 0x15, 0x23, 0x11, 0x06, 0x07, 0x27, 0x15,
-    0x21, 0x15, 0x21, 0x11, 0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x17, 0x0e,
-    0x01, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x06, 0x07, 0x27, 0x12,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x04, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x37, 0x0e, 0x09, 0x10, 0x2d, 0x27, 0x15,
-    0x4e, 0x1a, 0x29, 0x24, 0x24, 0x2d, 0x3c, 0x1e, 0x17, 0x40, 0x51, 0x33,
-    0x44, 0x19, 0x7a, 0xa5, 0x51, 0xb4, 0xb4, 0x37, 0x2f, 0x2d, 0x29, 0x35,
-    0x26, 0x2e, 0x33, 0x51, 0x30, 0x53, 0x38, 0x01, 0xd2, 0xfd, 0xdd, 0x25,
-    0x36, 0x3d, 0x1f, 0x58, 0x3d, 0x02, 0x2c, 0xad, 0x23, 0x0c, 0x10, 0x13,
-    0x0b, 0x2b, 0x30, 0x48, 0x49, 0x0a, 0x34, 0x55, 0x52, 0x45, 0x09, 0x5f,
-    0x3c, 0x39, 0x51, 0x0c, 0x01, 0xd7, 0x1b, 0x1b, 0x22, 0x0c, 0x3f, 0x10,
-    0x1d, 0x1f, 0x15, 0x01, 0x2b, 0x1b, 0x12, 0x1f, 0x42, 0x11, 0x1e, 0x25,
-    0x14, 0x40, 0x02, 0x33, 0x0d, 0x0d, 0x19, 0x5a, 0x4f, 0x3d, 0x1b, 0x3f,
-    0x4c, 0x42, 0x33, 0x01, 0x08, 0x38, 0x30, 0x1a, 0x9b, 0xfd, 0xb1, 0x3b,
-    0x6d, 0x3d, 0x52, 0x01, 0x3c, 0xfe, 0xc4, 0x52, 0x20, 0x2a, 0x30, 0x29,
-    0x31, 0x3b, 0x33, 0x31, 0x35, 0xde, 0x01, 0x1b, 0x7f, 0x6a, 0x36, 0x83,
-    0x55, 0x02, 0x88, 0x54, 0x5c, 0x66, 0x28, 0x0c, 0x12, 0x55, 0x0a, 0x1d,
-    0x04, 0x58, 0x03, 0x10, 0x0f, 0x3e, 0x57, 0x07, 0x02, 0x4f, 0xfe, 0x37,
-    0x0f, 0x0f, 0x12, 0x55, 0x14, 0x0a, 0x0b, 0x0b, 0x54, 0x02, 0xa2, 0x29,
-    0x2f, 0x3d, 0x1c, 0x23, 0x29, 0x33, 0x36, 0x20, 0x6d, 0x31, 0x1e, 0x3e,
-    0x1e, 0x26, 0x38, 0x42, 0x18, 0x26, 0x00, 0x00, 0x00, 0x06, 0x00, 0x29,
-    0xff, 0xdf, 0x03, 0x68, 0x03, 0x58, 0x00, 0x3f, 0x00, 0x62, 0x00, 0x66,
-    0x00, 0x6a, 0x00, 0x6e, 0x00, 0x72, 0x00, 0x00, 0x36, 0x37, 0x36, 0x37,
-    0x1f, 0x01, 0x36, 0x37, 0x36, 0x3d, 0x01, 0x33, 0x2e, 0x01, 0x27, 0x26,
-    0x27, 0x37, 0x16, 0x1f, 0x01, 0x33, 0x15, 0x21, 0x14, 0x07, 0x21, 0x11,
-    0x14, 0x06, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x36, 0x3d, 0x01,
-    0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x11,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x12, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x36,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x36, 0x37, 0x17, 0x0e,
-    0x01, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x07, 0x06, 0x07, 0x27, 0x25,
-    0x35, 0x21, 0x15, 0x13, 0x35, 0x23, 0x15, 0x33, 0x35, 0x23, 0x15, 0x33,
-    0x35, 0x23, 0x15, 0x6f, 0x44, 0x2c, 0x48, 0x05, 0x03, 0x13, 0x0d, 0x18,
-    0xd4, 0x02, 0x05, 0x02, 0x05, 0x0e, 0x4f, 0x0b, 0x0c, 0x0c, 0xcc, 0xfe,
-    0x51, 0x02, 0x01, 0xbc, 0x19, 0x25, 0x18, 0x1e, 0x10, 0x07, 0x19, 0x13,
-    0x0a, 0x3d, 0x41, 0x3f, 0x40, 0x3e, 0x45, 0x06, 0x09, 0x18, 0x3b, 0x42,
-    0x1c, 0x13, 0x28, 0x50, 0x46, 0x32, 0x0d, 0x0a, 0x0e, 0x14, 0x24, 0x25,
-    0x17, 0x49, 0x10, 0x30, 0x25, 0x1d, 0x32, 0x2f, 0x26, 0x15, 0x41, 0x18,
-    0x38, 0x38, 0x27, 0x40, 0x4b, 0x02, 0x32, 0x8a, 0x31, 0x0d, 0x17, 0x10,
-    0x17, 0x38, 0x2e, 0x30, 0x26, 0x0c, 0x02, 0xe7, 0xfe, 0x9e, 0x76, 0x3e,
-    0xbd, 0x3f, 0xbd, 0x3d, 0x98, 0x11, 0x0a, 0x14, 0x2d, 0x1e, 0x30, 0x40,
-    0x7e, 0xc1, 0xcc, 0x08, 0x0f, 0x07, 0x11, 0x25, 0x0d, 0x1a, 0x20, 0x27,
-    0xe9, 0x1b, 0x32, 0xfe, 0x7e, 0x2f, 0x25, 0x05, 0x05, 0x50, 0x01, 0x08,
-    0x11, 0x70, 0xa6, 0xa6, 0xa6, 0xa6, 0xda, 0x01, 0x59, 0x31, 0x2f, 0x8d,
-    0x5d, 0x2a, 0x2b, 0x31, 0x0e, 0x11, 0x11, 0x06, 0x50, 0x01, 0xae, 0x15,
-    0x20, 0x4c, 0x4b, 0x43, 0x1e, 0x2d, 0x5e, 0x46, 0x26, 0x02, 0x06, 0x49,
-    0x2c, 0x21, 0x3c, 0x66, 0x66, 0x34, 0x09, 0x14, 0x54, 0x0b, 0x16, 0x05,
-    0x55, 0x06, 0x17, 0x22, 0x64, 0x04, 0x04, 0x02, 0x50, 0x20, 0x58, 0x58,
-    0xfe, 0xa6, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x00, 0x01, 0x00, 0x61,
-    0xff, 0xdc, 0x03, 0x59, 0x03, 0x23, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x11,
-    0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01,
-    0x35, 0x11, 0x21, 0x11, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17, 0x36,
-    0x37, 0x17, 0x07, 0x37, 0x16, 0x17, 0x36, 0x37, 0x17, 0x06, 0x07, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x06,
-    0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x15, 0x23, 0x11,
+    0x4d, 0x24, 0x41, 0x8e, 0x0b, 0xf1, 0x00, 0x26, 0xff, 0xf5, 0x03, 0x8b,
+    0x03, 0x4c, 0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x94, 0x3c,
+    0x0b, 0x70, 0x02, 0x00, 0xd1, 0x4f, 0x00, 0x69, 0x01, 0x02, 0x85, 0x36,
+    0x05, 0xf2, 0x08, 0x11, 0x15, 0xb0, 0x06, 0x01, 0xca, 0x04, 0x04, 0xab,
+    0x01, 0x07, 0xb7, 0x02, 0x0e, 0xa0, 0x43, 0x08, 0xf1, 0x0f, 0xf4, 0xc8,
+    0x37, 0x0e, 0x09, 0x10, 0x2d, 0x27, 0x15, 0x4e, 0x1a, 0x29, 0x24, 0x24,
+    0x2d, 0x3c, 0x1e, 0x17, 0x40, 0x51, 0x33, 0x44, 0x19, 0x7a, 0xa5, 0x51,
+    0xb4, 0xb4, 0x37, 0x2f, 0x2d, 0x29, 0x35, 0x26, 0x2e, 0x33, 0x51, 0x30,
+    0x53, 0x38, 0x01, 0xd2, 0xfd, 0xdd, 0x25, 0x36, 0x3d, 0x1f, 0x58, 0x3d,
+    0x02, 0x2c, 0xad, 0x23, 0x0c, 0x10, 0x13, 0x0b, 0x2b, 0x30, 0x48, 0x49,
+    0x0a, 0x34, 0x55, 0x52, 0x45, 0x09, 0x5f, 0x3c, 0x39, 0x51, 0x0c, 0x01,
+    0xd7, 0x1b, 0x1b, 0x22, 0x0c, 0x3f, 0x10, 0x1d, 0x1f, 0x15, 0x01, 0x2b,
+    0x1b, 0x12, 0x1f, 0x42, 0x11, 0x1e, 0x25, 0x14, 0x40, 0x02, 0x33, 0x0d,
+    0x0d, 0x19, 0x5a, 0x4f, 0x3d, 0x1b, 0x3f, 0x4c, 0x42, 0x33, 0x01, 0x08,
+    0x38, 0x30, 0x1a, 0x9b, 0xfd, 0xb1, 0x3b, 0x6d, 0x3d, 0x52, 0x01, 0x3c,
+    0xfe, 0xc4, 0x52, 0x20, 0x2a, 0x30, 0x29, 0x31, 0x3b, 0x33, 0x31, 0x35,
+    0xde, 0x01, 0x1b, 0x7f, 0x6a, 0x36, 0x83, 0x55, 0x02, 0x88, 0x54, 0x5c,
+    0x66, 0x28, 0x0c, 0x12, 0x55, 0x0a, 0x1d, 0x04, 0x58, 0x03, 0x10, 0x0f,
+    0x3e, 0x57, 0x07, 0x02, 0x4f, 0xfe, 0x37, 0x0f, 0x0f, 0x12, 0x55, 0x14,
+    0x0a, 0x0b, 0x0b, 0x54, 0x02, 0xa2, 0x29, 0x2f, 0x3d, 0x1c, 0x23, 0x29,
+    0x33, 0x36, 0x20, 0x6d, 0x31, 0x1e, 0x3e, 0x1e, 0x26, 0x38, 0x42, 0x18,
+    0x26, 0x00, 0x06, 0x00, 0x29, 0xff, 0xdf, 0x03, 0x68, 0x03, 0x58, 0x00,
+    0x3f, 0x00, 0x62, 0x00, 0x66, 0x00, 0x6a, 0x00, 0x6e, 0x00, 0x72, 0xd0,
+    0x02, 0x20, 0x36, 0x37, 0x19, 0x4d, 0x26, 0x26, 0x26, 0x9b, 0x02, 0x28,
+    0x14, 0x07, 0x87, 0x0f, 0x03, 0x23, 0x0b, 0x02, 0x04, 0x00, 0x04, 0xf7,
+    0x19, 0x0f, 0x05, 0x03, 0x0a, 0x07, 0x45, 0x11, 0x00, 0x60, 0x0a, 0x00,
+    0x52, 0x0b, 0x13, 0x33, 0x04, 0x00, 0xf1, 0xb1, 0x6f, 0x44, 0x2c, 0x48,
+    0x05, 0x03, 0x13, 0x0d, 0x18, 0xd4, 0x02, 0x05, 0x02, 0x05, 0x0e, 0x4f,
+    0x0b, 0x0c, 0x0c, 0xcc, 0xfe, 0x51, 0x02, 0x01, 0xbc, 0x19, 0x25, 0x18,
+    0x1e, 0x10, 0x07, 0x19, 0x13, 0x0a, 0x3d, 0x41, 0x3f, 0x40, 0x3e, 0x45,
+    0x06, 0x09, 0x18, 0x3b, 0x42, 0x1c, 0x13, 0x28, 0x50, 0x46, 0x32, 0x0d,
+    0x0a, 0x0e, 0x14, 0x24, 0x25, 0x17, 0x49, 0x10, 0x30, 0x25, 0x1d, 0x32,
+    0x2f, 0x26, 0x15, 0x41, 0x18, 0x38, 0x38, 0x27, 0x40, 0x4b, 0x02, 0x32,
+    0x8a, 0x31, 0x0d, 0x17, 0x10, 0x17, 0x38, 0x2e, 0x30, 0x26, 0x0c, 0x02,
+    0xe7, 0xfe, 0x9e, 0x76, 0x3e, 0xbd, 0x3f, 0xbd, 0x3d, 0x98, 0x11, 0x0a,
+    0x14, 0x2d, 0x1e, 0x30, 0x40, 0x7e, 0xc1, 0xcc, 0x08, 0x0f, 0x07, 0x11,
+    0x25, 0x0d, 0x1a, 0x20, 0x27, 0xe9, 0x1b, 0x32, 0xfe, 0x7e, 0x2f, 0x25,
+    0x05, 0x05, 0x50, 0x01, 0x08, 0x11, 0x70, 0xa6, 0xa6, 0xa6, 0xa6, 0xda,
+    0x01, 0x59, 0x31, 0x2f, 0x8d, 0x5d, 0x2a, 0x2b, 0x31, 0x0e, 0x11, 0x11,
+    0x06, 0x50, 0x01, 0xae, 0x15, 0x20, 0x4c, 0x4b, 0x43, 0x1e, 0x2d, 0x5e,
+    0x46, 0x26, 0x02, 0x06, 0x49, 0x2c, 0x21, 0x3c, 0x66, 0x66, 0x34, 0x09,
+    0x14, 0x54, 0x0b, 0x16, 0x05, 0x55, 0x06, 0x17, 0x22, 0x64, 0x04, 0x04,
+    0x02, 0x50, 0x20, 0x58, 0x58, 0xfe, 0xa6, 0x7c, 0x01, 0x00, 0xc0, 0x00,
+    0x01, 0x00, 0x61, 0xff, 0xdc, 0x03, 0x59, 0x03, 0x23, 0x00, 0x3d, 0xb2,
+    0x0e, 0x08, 0x23, 0x14, 0x00, 0xc3, 0x10, 0x15, 0x36, 0x5c, 0x24, 0x12,
+    0x07, 0x07, 0x00, 0x0a, 0x58, 0x13, 0x18, 0x06, 0x42, 0x1d, 0xf5, 0x73,
     0x03, 0x59, 0x10, 0x2e, 0x30, 0x3a, 0x3d, 0x11, 0x30, 0x29, 0x24, 0x1c,
     0x0a, 0xfd, 0xae, 0x4d, 0x3f, 0x42, 0x2f, 0x41, 0x20, 0x39, 0x26, 0x1c,
     0x4b, 0x1b, 0x40, 0x26, 0x26, 0x25, 0x1a, 0x4a, 0x26, 0x33, 0x4b, 0x21,
@@ -2286,149 +1805,115 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x57, 0x17, 0x4c, 0x29, 0x38, 0x45, 0x54, 0x56, 0x16, 0x77, 0x75, 0x93,
     0x57, 0x25, 0x48, 0x6e, 0x7c, 0x6d, 0x2d, 0x8a, 0x8a, 0x6b, 0x40, 0x5a,
     0x4a, 0x64, 0x4b, 0x27, 0x27, 0x52, 0x7b, 0x5e, 0x26, 0xa9, 0x03, 0x47,
-    0x00, 0x09, 0x00, 0x35, 0xff, 0xf7, 0x03, 0x8a, 0x03, 0x2d, 0x00, 0x13,
-    0x00, 0x17, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2b,
-    0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x37, 0x11, 0x21, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x11, 0x33, 0x15,
-    0x21, 0x35, 0x13, 0x21, 0x15, 0x21, 0x37, 0x35, 0x23, 0x15, 0x01, 0x35,
-    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35,
-    0x21, 0x15, 0x01, 0x35, 0x23, 0x15, 0x21, 0x35, 0x23, 0x15, 0xb0, 0x01,
-    0x05, 0xfe, 0xa2, 0x01, 0x5e, 0x53, 0x01, 0x5f, 0xfe, 0xa1, 0x01, 0x05,
-    0x7d, 0xfc, 0xab, 0x3d, 0x02, 0xda, 0xfd, 0x26, 0xde, 0x8d, 0x01, 0xf7,
-    0xfe, 0x48, 0x01, 0xb8, 0xfe, 0x48, 0x01, 0xb8, 0xfe, 0x48, 0x01, 0xb8,
-    0xfe, 0x48, 0x01, 0x20, 0x86, 0x01, 0x5e, 0x8a, 0x36, 0x01, 0x98, 0x2e,
+    0x00, 0x09, 0x00, 0x35, 0xff, 0xf7, 0x03, 0x8a, 0x03, 0x2d, 0xea, 0x10,
+    0x04, 0xdc, 0x1e, 0x10, 0x33, 0x0e, 0x17, 0x18, 0x21, 0x02, 0x09, 0x01,
+    0xf8, 0x1c, 0x13, 0x13, 0xec, 0x3b, 0x04, 0x00, 0x15, 0x05, 0x9e, 0x17,
+    0x03, 0xfc, 0x3b, 0xf7, 0x0f, 0xb0, 0x01, 0x05, 0xfe, 0xa2, 0x01, 0x5e,
+    0x53, 0x01, 0x5f, 0xfe, 0xa1, 0x01, 0x05, 0x7d, 0xfc, 0xab, 0x3d, 0x02,
+    0xda, 0xfd, 0x26, 0xde, 0x8d, 0x01, 0xf7, 0xfe, 0x48, 0x01, 0xb8, 0x04,
+    0x00, 0xf1, 0x11, 0x20, 0x86, 0x01, 0x5e, 0x8a, 0x36, 0x01, 0x98, 0x2e,
     0x39, 0x2f, 0x2f, 0x39, 0x2e, 0xfe, 0x68, 0x3f, 0x3f, 0x02, 0xf7, 0xc4,
-    0x38, 0x54, 0x54, 0xfd, 0x95, 0x2f, 0x2f, 0x63, 0x31, 0x31, 0x66, 0x31,
-    0x31, 0x66, 0x31, 0x31, 0x01, 0x3c, 0x54, 0x54, 0x54, 0x54, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x8f, 0xff, 0xf9, 0x03, 0x2f, 0x03, 0x5e, 0x00, 0x0c,
-    0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x00, 0x01, 0x37, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x21, 0x11, 0x21, 0x11, 0x01, 0x35, 0x21,
-    0x15, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x01, 0x79, 0x13,
-    0x11, 0x04, 0x66, 0x15, 0x07, 0x07, 0x06, 0x01, 0x51, 0xfd, 0x60, 0x02,
-    0x48, 0xfe, 0x11, 0x01, 0xef, 0xfe, 0x11, 0x01, 0xef, 0xfe, 0x11, 0x02,
-    0xe5, 0x34, 0x36, 0x0f, 0x0d, 0x39, 0x11, 0x14, 0x0e, 0xfd, 0x14, 0x02,
-    0xec, 0xfd, 0x68, 0x92, 0x92, 0xe6, 0x81, 0x81, 0xd3, 0x8b, 0x8b, 0x00,
-    0x00, 0x04, 0x00, 0x2d, 0xff, 0xcb, 0x03, 0x8d, 0x03, 0x4c, 0x00, 0x1b,
-    0x00, 0x2f, 0x00, 0x34, 0x00, 0x38, 0x00, 0x00, 0x13, 0x35, 0x21, 0x35,
-    0x33, 0x15, 0x21, 0x15, 0x33, 0x15, 0x21, 0x1e, 0x01, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x06, 0x05, 0x27, 0x36, 0x37, 0x36, 0x37, 0x21, 0x35,
-    0x13, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x35, 0x23, 0x01, 0x3d, 0x01, 0x23,
-    0x15, 0x21, 0x35, 0x23, 0x15, 0x9d, 0x01, 0x14, 0x56, 0x01, 0x17, 0x6f,
-    0xfe, 0x89, 0x2a, 0xb5, 0x97, 0x27, 0xbc, 0x65, 0x3c, 0x27, 0x5d, 0xfe,
-    0xd4, 0x27, 0xd6, 0x55, 0x2c, 0x16, 0xfe, 0x8f, 0x0b, 0xda, 0x55, 0xec,
-    0x56, 0xd7, 0xd7, 0x56, 0xec, 0x55, 0xda, 0x01, 0x79, 0xbf, 0x01, 0xd6,
-    0xc1, 0x01, 0x3f, 0xe8, 0x57, 0x57, 0xe8, 0x52, 0x46, 0x62, 0x1e, 0x59,
-    0x2f, 0x47, 0x2a, 0x3f, 0x93, 0x4f, 0x55, 0x32, 0x46, 0x25, 0x30, 0x52,
-    0x01, 0xbb, 0x52, 0x52, 0x52, 0x52, 0x51, 0x44, 0x44, 0x44, 0x44, 0xfe,
-    0x96, 0x09, 0x91, 0x9a, 0x9a, 0x9a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c,
-    0xff, 0xca, 0x03, 0x8d, 0x03, 0x58, 0x00, 0x09, 0x00, 0x20, 0x00, 0x4d,
-    0x00, 0x55, 0x00, 0x00, 0x12, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x37, 0x02, 0x37, 0x36, 0x37, 0x23, 0x35, 0x21, 0x15, 0x06, 0x07,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x2f, 0x01, 0x11, 0x23, 0x11, 0x06, 0x07,
-    0x27, 0x04, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x33, 0x07, 0x06, 0x07,
-    0x33, 0x15, 0x14, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x3e, 0x01, 0x37,
-    0x36, 0x35, 0x17, 0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x2e, 0x01, 0x3d, 0x01, 0x06, 0x07, 0x06, 0x07, 0x27, 0x13, 0x21, 0x11,
-    0x23, 0x11, 0x21, 0x11, 0x23, 0xdc, 0x16, 0x0c, 0x0c, 0x4f, 0x0e, 0x0a,
-    0x07, 0x15, 0x4d, 0x76, 0x44, 0x2b, 0x24, 0xb7, 0x01, 0x15, 0x1f, 0x29,
-    0x36, 0x36, 0x17, 0x34, 0x18, 0x32, 0x18, 0x51, 0x28, 0x35, 0x3a, 0x01,
-    0x5b, 0x71, 0x1f, 0x20, 0x21, 0x03, 0x04, 0x52, 0x04, 0x03, 0x0e, 0x30,
-    0x0c, 0x14, 0x0d, 0x1d, 0x1a, 0x07, 0x16, 0x0c, 0x02, 0x05, 0x4d, 0x02,
-    0x07, 0x05, 0x11, 0x26, 0x24, 0x12, 0x29, 0x29, 0x13, 0x2c, 0x25, 0x0f,
-    0x15, 0x4a, 0x9a, 0x36, 0x6d, 0x01, 0xbf, 0x53, 0xfe, 0xe7, 0x53, 0x03,
-    0x48, 0x37, 0x1f, 0x2c, 0x13, 0x30, 0x1a, 0x12, 0x34, 0x15, 0xfe, 0x1a,
-    0x5f, 0x3c, 0x4c, 0x55, 0x55, 0x40, 0x46, 0x2d, 0x2f, 0x1a, 0x44, 0x1c,
-    0x2f, 0x17, 0xfe, 0x5d, 0x01, 0x71, 0x30, 0x33, 0x42, 0xef, 0x64, 0x32,
-    0x33, 0x87, 0x5a, 0xbe, 0xc6, 0x4e, 0x48, 0xd8, 0x1a, 0x0f, 0x02, 0x01,
-    0x01, 0x02, 0x11, 0x1b, 0x3f, 0x27, 0x17, 0x3c, 0x32, 0x24, 0x27, 0x14,
-    0x02, 0x01, 0x01, 0x03, 0x2d, 0x34, 0x8b, 0x24, 0x21, 0x75, 0x5b, 0x49,
-    0x03, 0x13, 0xfd, 0xd6, 0x01, 0xd7, 0xfe, 0x28, 0x00, 0x09, 0x00, 0x1a,
-    0xff, 0xd3, 0x03, 0x8f, 0x03, 0x5a, 0x00, 0x1a, 0x00, 0x3c, 0x00, 0x42,
-    0x00, 0x47, 0x00, 0x4b, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x78,
-    0x00, 0x00, 0x25, 0x35, 0x23, 0x06, 0x07, 0x27, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0x35, 0x23, 0x35, 0x00, 0x37, 0x17, 0x07, 0x33, 0x15, 0x06,
-    0x07, 0x33, 0x11, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x15,
-    0x23, 0x35, 0x23, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x3d,
-    0x01, 0x07, 0x27, 0x37, 0x36, 0x37, 0x23, 0x06, 0x07, 0x13, 0x35, 0x23,
-    0x15, 0x07, 0x37, 0x35, 0x23, 0x15, 0x12, 0x33, 0x3e, 0x01, 0x3d, 0x01,
-    0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x36, 0x37,
-    0x36, 0x37, 0x23, 0x35, 0x21, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x23,
-    0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x23, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x02, 0x9d, 0x5b, 0x0c, 0x19, 0x46, 0x33, 0x19, 0x48,
-    0x0b, 0x05, 0x42, 0x4f, 0x8c, 0x8c, 0xa3, 0xa3, 0x4f, 0xb8, 0xfe, 0xac,
-    0x44, 0x4b, 0x1e, 0xaf, 0x2a, 0x17, 0x5d, 0x1d, 0x28, 0x17, 0x14, 0x10,
-    0x08, 0x09, 0x46, 0x4d, 0x05, 0x07, 0x0e, 0x2a, 0x47, 0x2f, 0x0a, 0x0d,
-    0x0f, 0x3b, 0xfb, 0x24, 0x18, 0x76, 0x1a, 0x22, 0x57, 0x48, 0x01, 0x49,
-    0x48, 0xaa, 0x0f, 0x14, 0x0a, 0x49, 0x49, 0x49, 0x49, 0x49, 0xd6, 0x1c,
-    0x15, 0x08, 0x5f, 0x01, 0x81, 0x03, 0x09, 0x06, 0x24, 0x2d, 0x29, 0x3e,
-    0x0e, 0x26, 0x1a, 0x1b, 0x17, 0x09, 0x03, 0x04, 0x02, 0x80, 0x09, 0x1b,
-    0x23, 0x50, 0x35, 0xe2, 0x6c, 0x25, 0x39, 0x1a, 0x6b, 0x78, 0x0c, 0x32,
-    0x11, 0x58, 0x58, 0x50, 0x6c, 0x50, 0xbb, 0xbb, 0x50, 0x01, 0xdd, 0x9b,
-    0x18, 0x3f, 0x42, 0x40, 0x1d, 0xfd, 0xe2, 0x34, 0x27, 0x07, 0x04, 0x01,
-    0x2f, 0x04, 0xb9, 0x35, 0x24, 0x4e, 0x4b, 0x20, 0x61, 0x3b, 0x4b, 0x90,
-    0xb3, 0x10, 0x35, 0x22, 0x30, 0x28, 0x2d, 0x2b, 0xfe, 0xac, 0x62, 0x28,
-    0x3a, 0xab, 0x5f, 0x5f, 0xfe, 0x73, 0x01, 0x0a, 0x16, 0x76, 0x95, 0xe0,
-    0x62, 0x62, 0xab, 0x5f, 0x5f, 0x90, 0x31, 0x25, 0x34, 0x4b, 0x5b, 0x62,
-    0x2c, 0x24, 0x06, 0x04, 0x4e, 0x02, 0x04, 0x0f, 0x13, 0x27, 0x33, 0x46,
-    0x33, 0x42, 0x3d, 0x39, 0x00, 0x05, 0x00, 0x30, 0xff, 0xf7, 0x03, 0x8d,
-    0x03, 0x4f, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1b,
-    0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x03, 0x21, 0x2f, 0x01, 0x37, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x15, 0x21, 0x17, 0x21, 0x15, 0x21, 0x35, 0x21,
-    0x15, 0x21, 0x01, 0x35, 0x21, 0x15, 0x03, 0x2a, 0xfd, 0x69, 0x63, 0x01,
-    0x8e, 0x06, 0x18, 0x57, 0x10, 0x0e, 0x07, 0x01, 0x01, 0x70, 0xfc, 0xa3,
-    0x75, 0x02, 0x71, 0xfd, 0x8f, 0x02, 0x71, 0xfd, 0x8f, 0x02, 0x31, 0xfe,
-    0x12, 0x01, 0x2b, 0xfe, 0xcc, 0x01, 0x34, 0x01, 0xbb, 0x14, 0x45, 0x10,
-    0x24, 0x2c, 0x15, 0x04, 0x4f, 0xd7, 0x4d, 0xe0, 0x4d, 0xfe, 0x40, 0x96,
-    0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2e, 0xff, 0xdb, 0x03, 0x8e,
-    0x03, 0x51, 0x00, 0x0d, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x01, 0x11,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x35,
-    0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x13, 0x33,
-    0x11, 0x33, 0x11, 0x33, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23, 0x01, 0x07,
-    0x4b, 0x4d, 0x25, 0x71, 0x96, 0x2a, 0x10, 0x0d, 0x82, 0x8d, 0x21, 0x2e,
-    0x2a, 0x1f, 0x49, 0x11, 0x31, 0x26, 0x2c, 0xe0, 0xef, 0x58, 0xf1, 0xf1,
-    0x58, 0xef, 0x02, 0x27, 0xfe, 0x60, 0x36, 0x4e, 0x58, 0x62, 0x5e, 0x43,
-    0x0d, 0x19, 0x14, 0x01, 0x61, 0x56, 0x01, 0x2a, 0x21, 0x39, 0x34, 0x2f,
-    0x3a, 0x1e, 0x41, 0x33, 0x30, 0xfe, 0xf5, 0x01, 0x3f, 0xfe, 0xc1, 0x58,
-    0xfe, 0x22, 0x01, 0xde, 0x00, 0x03, 0x00, 0x30, 0xff, 0xd2, 0x03, 0x9e,
-    0x03, 0x4d, 0x00, 0x17, 0x00, 0x26, 0x00, 0x30, 0x00, 0x00, 0x24, 0x37,
-    0x36, 0x11, 0x35, 0x33, 0x15, 0x14, 0x07, 0x16, 0x17, 0x16, 0x17, 0x07,
-    0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x03, 0x33,
-    0x11, 0x36, 0x37, 0x17, 0x0e, 0x01, 0x07, 0x27, 0x3e, 0x01, 0x35, 0x11,
-    0x23, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x01,
-    0xaa, 0x41, 0x3f, 0x54, 0x02, 0x0c, 0x36, 0x45, 0x9b, 0x44, 0x97, 0x44,
-    0x17, 0x0f, 0x0e, 0x0b, 0x1a, 0x79, 0x5c, 0x47, 0xda, 0xcd, 0x38, 0x2e,
-    0x22, 0x2b, 0x6e, 0x34, 0x29, 0x0f, 0x09, 0x77, 0x6f, 0x23, 0x30, 0x31,
-    0x1c, 0x41, 0x1c, 0x2f, 0x31, 0x1f, 0x9b, 0xa1, 0x9d, 0x01, 0x04, 0x70,
-    0x85, 0x0e, 0x1c, 0xb9, 0x8f, 0xb4, 0x87, 0x45, 0x94, 0xb1, 0x3a, 0x40,
-    0x39, 0x28, 0x57, 0xb4, 0x57, 0x43, 0x02, 0x0b, 0xfe, 0x90, 0x34, 0x3d,
-    0x4f, 0x30, 0x64, 0x25, 0x3a, 0x0d, 0x19, 0x19, 0x01, 0x37, 0x01, 0x7d,
-    0x20, 0x37, 0x35, 0x28, 0x3b, 0x29, 0x36, 0x3c, 0x1c, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x33, 0xff, 0xed, 0x03, 0x85, 0x03, 0x45, 0x00, 0x0d,
-    0x00, 0x17, 0x00, 0x3c, 0x00, 0x00, 0x13, 0x11, 0x36, 0x37, 0x17, 0x06,
-    0x07, 0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x35, 0x13, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x25, 0x21, 0x11, 0x21, 0x11, 0x14,
-    0x1e, 0x01, 0x17, 0x16, 0x33, 0x32, 0x37, 0x3e, 0x02, 0x3f, 0x01, 0x17,
-    0x06, 0x07, 0x0e, 0x02, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x02, 0x35,
-    0x11, 0x21, 0x35, 0x21, 0xff, 0x32, 0x38, 0x1d, 0x4d, 0x7f, 0x2d, 0x10,
-    0x0b, 0x75, 0x7a, 0x18, 0x32, 0x2a, 0x19, 0x46, 0x1c, 0x27, 0x2a, 0x1f,
-    0x01, 0x14, 0x01, 0xce, 0xfe, 0x9b, 0x0a, 0x1b, 0x21, 0x1e, 0x49, 0x38,
-    0x14, 0x1f, 0x1a, 0x0b, 0x03, 0x09, 0x57, 0x01, 0x0a, 0x08, 0x19, 0x32,
-    0x33, 0x12, 0x76, 0x4e, 0x0e, 0x35, 0x35, 0x16, 0x01, 0x63, 0xfe, 0x89,
-    0x02, 0x24, 0xfe, 0x60, 0x24, 0x3f, 0x5b, 0x47, 0x52, 0x41, 0x0c, 0x17,
-    0x16, 0x01, 0x61, 0x56, 0x01, 0x21, 0x19, 0x3e, 0x34, 0x26, 0x3b, 0x2d,
-    0x30, 0x38, 0x21, 0x0c, 0xfe, 0x80, 0xfe, 0xe2, 0x19, 0x15, 0x07, 0x01,
-    0x02, 0x01, 0x01, 0x07, 0x15, 0x19, 0x6e, 0x1a, 0x14, 0x52, 0x33, 0x32,
-    0x14, 0x03, 0x01, 0x01, 0x03, 0x16, 0x37, 0x38, 0x01, 0x7b, 0xd2, 0x00,
-    0x00, 0x05, 0x00, 0x2d, 0xff, 0xcd, 0x03, 0x93, 0x03, 0x49, 0x00, 0x0d,
-    0x00, 0x17, 0x00, 0x29, 0x00, 0x44, 0x00, 0x49, 0x00, 0x00, 0x13, 0x11,
-    0x36, 0x37, 0x17, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x35,
-    0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x00, 0x37,
-    0x26, 0x27, 0x23, 0x35, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x06, 0x07, 0x27, 0x12, 0x37, 0x36, 0x3d, 0x01, 0x21, 0x15, 0x14,
-    0x1e, 0x01, 0x17, 0x16, 0x37, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01,
-    0x3d, 0x01, 0x23, 0x15, 0x14, 0x07, 0x27, 0x16, 0x17, 0x36, 0x37, 0x21,
+    0x38, 0x54, 0x54, 0xfd, 0x95, 0x2f, 0x2f, 0x63, 0x31, 0x31, 0x66, 0x03,
+    0x00, 0xf0, 0x08, 0x01, 0x3c, 0x54, 0x54, 0x54, 0x54, 0x00, 0x04, 0x00,
+    0x8f, 0xff, 0xf9, 0x03, 0x2f, 0x03, 0x5e, 0x00, 0x0c, 0x00, 0x10, 0x00,
+    0x14, 0x00, 0x74, 0x68, 0x04, 0x6b, 0x02, 0x11, 0x21, 0x91, 0x4d, 0x07,
+    0x89, 0x00, 0xf2, 0x04, 0x79, 0x13, 0x11, 0x04, 0x66, 0x15, 0x07, 0x07,
+    0x06, 0x01, 0x51, 0xfd, 0x60, 0x02, 0x48, 0xfe, 0x11, 0x01, 0xef, 0x04,
+    0x00, 0xf0, 0x09, 0x02, 0xe5, 0x34, 0x36, 0x0f, 0x0d, 0x39, 0x11, 0x14,
+    0x0e, 0xfd, 0x14, 0x02, 0xec, 0xfd, 0x68, 0x92, 0x92, 0xe6, 0x81, 0x81,
+    0xd3, 0x8b, 0x8b, 0x54, 0x04, 0xb1, 0x2d, 0xff, 0xcb, 0x03, 0x8d, 0x03,
+    0x4c, 0x00, 0x1b, 0x00, 0x2f, 0x94, 0x44, 0x23, 0x00, 0x13, 0xf8, 0x00,
+    0x03, 0xe7, 0x3c, 0x01, 0x04, 0x0f, 0x13, 0x05, 0x70, 0x1c, 0x27, 0x13,
+    0x33, 0xa7, 0x32, 0x03, 0x15, 0x03, 0x23, 0x01, 0x35, 0x01, 0x01, 0xf1,
+    0x54, 0x9d, 0x01, 0x14, 0x56, 0x01, 0x17, 0x6f, 0xfe, 0x89, 0x2a, 0xb5,
+    0x97, 0x27, 0xbc, 0x65, 0x3c, 0x27, 0x5d, 0xfe, 0xd4, 0x27, 0xd6, 0x55,
+    0x2c, 0x16, 0xfe, 0x8f, 0x0b, 0xda, 0x55, 0xec, 0x56, 0xd7, 0xd7, 0x56,
+    0xec, 0x55, 0xda, 0x01, 0x79, 0xbf, 0x01, 0xd6, 0xc1, 0x01, 0x3f, 0xe8,
+    0x57, 0x57, 0xe8, 0x52, 0x46, 0x62, 0x1e, 0x59, 0x2f, 0x47, 0x2a, 0x3f,
+    0x93, 0x4f, 0x55, 0x32, 0x46, 0x25, 0x30, 0x52, 0x01, 0xbb, 0x52, 0x52,
+    0x52, 0x52, 0x51, 0x44, 0x44, 0x44, 0x44, 0xfe, 0x96, 0x09, 0x91, 0x9a,
+    0x9a, 0x9a, 0x00, 0x04, 0x00, 0x0c, 0xff, 0xca, 0x03, 0x8d, 0x03, 0x58,
+    0x00, 0x09, 0x00, 0x20, 0x28, 0x12, 0x25, 0x00, 0x12, 0xfd, 0x11, 0x24,
+    0x02, 0x37, 0x45, 0x32, 0x09, 0xda, 0x0d, 0x23, 0x04, 0x36, 0xe9, 0x33,
+    0x29, 0x06, 0x07, 0x82, 0x2f, 0x19, 0x35, 0xa9, 0x1c, 0x13, 0x35, 0xe6,
+    0x36, 0x11, 0x11, 0x3b, 0x5c, 0xf0, 0x6e, 0xdc, 0x16, 0x0c, 0x0c, 0x4f,
+    0x0e, 0x0a, 0x07, 0x15, 0x4d, 0x76, 0x44, 0x2b, 0x24, 0xb7, 0x01, 0x15,
+    0x1f, 0x29, 0x36, 0x36, 0x17, 0x34, 0x18, 0x32, 0x18, 0x51, 0x28, 0x35,
+    0x3a, 0x01, 0x5b, 0x71, 0x1f, 0x20, 0x21, 0x03, 0x04, 0x52, 0x04, 0x03,
+    0x0e, 0x30, 0x0c, 0x14, 0x0d, 0x1d, 0x1a, 0x07, 0x16, 0x0c, 0x02, 0x05,
+    0x4d, 0x02, 0x07, 0x05, 0x11, 0x26, 0x24, 0x12, 0x29, 0x29, 0x13, 0x2c,
+    0x25, 0x0f, 0x15, 0x4a, 0x9a, 0x36, 0x6d, 0x01, 0xbf, 0x53, 0xfe, 0xe7,
+    0x53, 0x03, 0x48, 0x37, 0x1f, 0x2c, 0x13, 0x30, 0x1a, 0x12, 0x34, 0x15,
+    0xfe, 0x1a, 0x5f, 0x3c, 0x4c, 0x55, 0x55, 0x40, 0x46, 0x2d, 0x2f, 0x1a,
+    0x44, 0x1c, 0x2f, 0x17, 0xfe, 0x5d, 0x01, 0x71, 0x30, 0x33, 0x42, 0xef,
+    0x64, 0x32, 0x33, 0x87, 0x5a, 0xbe, 0xc6, 0x4e, 0x48, 0xd8, 0x1a, 0x0f,
+    0x7b, 0x2f, 0xa0, 0x11, 0x1b, 0x3f, 0x27, 0x17, 0x3c, 0x32, 0x24, 0x27,
+    0x14, 0xbe, 0x1c, 0xf1, 0x0f, 0x2d, 0x34, 0x8b, 0x24, 0x21, 0x75, 0x5b,
+    0x49, 0x03, 0x13, 0xfd, 0xd6, 0x01, 0xd7, 0xfe, 0x28, 0x00, 0x09, 0x00,
+    0x1a, 0xff, 0xd3, 0x03, 0x8f, 0x03, 0x5a, 0x00, 0x1a, 0x00, 0x3c, 0x08,
+    0x1c, 0x91, 0x4b, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x78, 0x4a,
+    0x31, 0x0f, 0x69, 0x45, 0x01, 0x11, 0x23, 0x8c, 0x2d, 0x15, 0x17, 0xf7,
+    0x0f, 0x02, 0xc0, 0x0b, 0x07, 0x64, 0x1a, 0x01, 0x1a, 0x10, 0x15, 0x37,
+    0xf8, 0x0f, 0x11, 0x07, 0x68, 0x22, 0x02, 0x96, 0x45, 0x05, 0xd6, 0x1f,
+    0x03, 0x96, 0x46, 0x27, 0x06, 0x07, 0x00, 0x0a, 0x05, 0xe9, 0x2f, 0xf0,
+    0x30, 0x02, 0x9d, 0x5b, 0x0c, 0x19, 0x46, 0x33, 0x19, 0x48, 0x0b, 0x05,
+    0x42, 0x4f, 0x8c, 0x8c, 0xa3, 0xa3, 0x4f, 0xb8, 0xfe, 0xac, 0x44, 0x4b,
+    0x1e, 0xaf, 0x2a, 0x17, 0x5d, 0x1d, 0x28, 0x17, 0x14, 0x10, 0x08, 0x09,
+    0x46, 0x4d, 0x05, 0x07, 0x0e, 0x2a, 0x47, 0x2f, 0x0a, 0x0d, 0x0f, 0x3b,
+    0xfb, 0x24, 0x18, 0x76, 0x1a, 0x22, 0x57, 0x48, 0x01, 0x49, 0x48, 0xaa,
+    0x0f, 0x14, 0x0a, 0x49, 0x01, 0x00, 0xf5, 0x7b, 0xd6, 0x1c, 0x15, 0x08,
+    0x5f, 0x01, 0x81, 0x03, 0x09, 0x06, 0x24, 0x2d, 0x29, 0x3e, 0x0e, 0x26,
+    0x1a, 0x1b, 0x17, 0x09, 0x03, 0x04, 0x02, 0x80, 0x09, 0x1b, 0x23, 0x50,
+    0x35, 0xe2, 0x6c, 0x25, 0x39, 0x1a, 0x6b, 0x78, 0x0c, 0x32, 0x11, 0x58,
+    0x58, 0x50, 0x6c, 0x50, 0xbb, 0xbb, 0x50, 0x01, 0xdd, 0x9b, 0x18, 0x3f,
+    0x42, 0x40, 0x1d, 0xfd, 0xe2, 0x34, 0x27, 0x07, 0x04, 0x01, 0x2f, 0x04,
+    0xb9, 0x35, 0x24, 0x4e, 0x4b, 0x20, 0x61, 0x3b, 0x4b, 0x90, 0xb3, 0x10,
+    0x35, 0x22, 0x30, 0x28, 0x2d, 0x2b, 0xfe, 0xac, 0x62, 0x28, 0x3a, 0xab,
+    0x5f, 0x5f, 0xfe, 0x73, 0x01, 0x0a, 0x16, 0x76, 0x95, 0xe0, 0x62, 0x62,
+    0xab, 0x5f, 0x5f, 0x90, 0x31, 0x25, 0x34, 0x4b, 0x5b, 0x62, 0x2c, 0x24,
+    0x06, 0x04, 0x4e, 0x02, 0x04, 0x0f, 0x13, 0x27, 0x33, 0x46, 0x33, 0x42,
+    0x3d, 0x39, 0x00, 0x05, 0x00, 0x30, 0xff, 0xf7, 0x03, 0x8d, 0x03, 0x4f,
+    0x00, 0x03, 0xf6, 0x14, 0x03, 0xda, 0x22, 0x1f, 0x27, 0xb0, 0x4b, 0x03,
+    0xf1, 0x07, 0x2a, 0xfd, 0x69, 0x63, 0x01, 0x8e, 0x06, 0x18, 0x57, 0x10,
+    0x0e, 0x07, 0x01, 0x01, 0x70, 0xfc, 0xa3, 0x75, 0x02, 0x71, 0xfd, 0x8f,
+    0x04, 0x00, 0xf0, 0x0c, 0x31, 0xfe, 0x12, 0x01, 0x2b, 0xfe, 0xcc, 0x01,
+    0x34, 0x01, 0xbb, 0x14, 0x45, 0x10, 0x24, 0x2c, 0x15, 0x04, 0x4f, 0xd7,
+    0x4d, 0xe0, 0x4d, 0xfe, 0x40, 0x96, 0x96, 0x50, 0x09, 0xb0, 0x2e, 0xff,
+    0xdb, 0x03, 0x8e, 0x03, 0x51, 0x00, 0x0d, 0x00, 0x17, 0xb2, 0x37, 0x13,
+    0x01, 0x67, 0x4d, 0x01, 0xd4, 0x48, 0x17, 0x35, 0x8e, 0x19, 0x03, 0x43,
+    0x3e, 0x00, 0x4f, 0x0f, 0xf2, 0x3f, 0x01, 0x07, 0x4b, 0x4d, 0x25, 0x71,
+    0x96, 0x2a, 0x10, 0x0d, 0x82, 0x8d, 0x21, 0x2e, 0x2a, 0x1f, 0x49, 0x11,
+    0x31, 0x26, 0x2c, 0xe0, 0xef, 0x58, 0xf1, 0xf1, 0x58, 0xef, 0x02, 0x27,
+    0xfe, 0x60, 0x36, 0x4e, 0x58, 0x62, 0x5e, 0x43, 0x0d, 0x19, 0x14, 0x01,
+    0x61, 0x56, 0x01, 0x2a, 0x21, 0x39, 0x34, 0x2f, 0x3a, 0x1e, 0x41, 0x33,
+    0x30, 0xfe, 0xf5, 0x01, 0x3f, 0xfe, 0xc1, 0x58, 0xfe, 0x22, 0x01, 0xde,
+    0x00, 0x03, 0x00, 0x30, 0xff, 0xd2, 0x03, 0x9e, 0x03, 0x4d, 0x00, 0x17,
+    0xf4, 0x3b, 0x40, 0x24, 0x37, 0x36, 0x11, 0x34, 0x34, 0x09, 0x06, 0x37,
+    0x01, 0xca, 0x46, 0x03, 0x0d, 0x19, 0x02, 0x92, 0x00, 0x16, 0x13, 0x84,
+    0x10, 0xf0, 0x4e, 0xaa, 0x41, 0x3f, 0x54, 0x02, 0x0c, 0x36, 0x45, 0x9b,
+    0x44, 0x97, 0x44, 0x17, 0x0f, 0x0e, 0x0b, 0x1a, 0x79, 0x5c, 0x47, 0xda,
+    0xcd, 0x38, 0x2e, 0x22, 0x2b, 0x6e, 0x34, 0x29, 0x0f, 0x09, 0x77, 0x6f,
+    0x23, 0x30, 0x31, 0x1c, 0x41, 0x1c, 0x2f, 0x31, 0x1f, 0x9b, 0xa1, 0x9d,
+    0x01, 0x04, 0x70, 0x85, 0x0e, 0x1c, 0xb9, 0x8f, 0xb4, 0x87, 0x45, 0x94,
+    0xb1, 0x3a, 0x40, 0x39, 0x28, 0x57, 0xb4, 0x57, 0x43, 0x02, 0x0b, 0xfe,
+    0x90, 0x34, 0x3d, 0x4f, 0x30, 0x64, 0x25, 0x3a, 0x0d, 0x19, 0x19, 0x01,
+    0x37, 0x01, 0x7d, 0x20, 0x37, 0x35, 0x28, 0x3b, 0x29, 0x36, 0x3c, 0x1c,
+    0x1a, 0x01, 0x71, 0x33, 0xff, 0xed, 0x03, 0x85, 0x03, 0x45, 0x1a, 0x01,
+    0x10, 0x3c, 0x74, 0x16, 0x0f, 0x1a, 0x01, 0x03, 0x23, 0x25, 0x21, 0x7a,
+    0x20, 0x03, 0x60, 0x14, 0x0a, 0x63, 0x38, 0x00, 0xb5, 0x05, 0xf0, 0x36,
+    0xff, 0x32, 0x38, 0x1d, 0x4d, 0x7f, 0x2d, 0x10, 0x0b, 0x75, 0x7a, 0x18,
+    0x32, 0x2a, 0x19, 0x46, 0x1c, 0x27, 0x2a, 0x1f, 0x01, 0x14, 0x01, 0xce,
+    0xfe, 0x9b, 0x0a, 0x1b, 0x21, 0x1e, 0x49, 0x38, 0x14, 0x1f, 0x1a, 0x0b,
+    0x03, 0x09, 0x57, 0x01, 0x0a, 0x08, 0x19, 0x32, 0x33, 0x12, 0x76, 0x4e,
+    0x0e, 0x35, 0x35, 0x16, 0x01, 0x63, 0xfe, 0x89, 0x02, 0x24, 0xfe, 0x60,
+    0x24, 0x3f, 0x5b, 0x47, 0x52, 0x41, 0x0c, 0x17, 0x16, 0x4c, 0x01, 0xf1,
+    0x05, 0x21, 0x19, 0x3e, 0x34, 0x26, 0x3b, 0x2d, 0x30, 0x38, 0x21, 0x0c,
+    0xfe, 0x80, 0xfe, 0xe2, 0x19, 0x15, 0x07, 0x01, 0x02, 0x00, 0x47, 0xf0,
+    0x02, 0x6e, 0x1a, 0x14, 0x52, 0x33, 0x32, 0x14, 0x03, 0x01, 0x01, 0x03,
+    0x16, 0x37, 0x38, 0x01, 0x7b, 0xd2, 0x40, 0x10, 0x71, 0x2d, 0xff, 0xcd,
+    0x03, 0x93, 0x03, 0x49, 0xc0, 0x00, 0x5f, 0x29, 0x00, 0x44, 0x00, 0x49,
+    0xc4, 0x00, 0x07, 0x0e, 0x06, 0x25, 0x01, 0xb2, 0x1f, 0x04, 0xd6, 0x3c,
+    0x05, 0x9e, 0x04, 0x00, 0x87, 0x13, 0x11, 0x27, 0x70, 0x3a, 0xf1, 0x7d,
     0xfc, 0x2f, 0x36, 0x25, 0x56, 0x7a, 0x2a, 0x0f, 0x0a, 0x78, 0x86, 0x19,
     0x35, 0x2f, 0x16, 0x49, 0x1b, 0x29, 0x2d, 0x1d, 0x01, 0x4f, 0x62, 0x63,
     0x39, 0x25, 0x01, 0xe6, 0x35, 0x6b, 0x62, 0x8c, 0x27, 0xa6, 0x62, 0x70,
@@ -2440,96 +1925,75 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x50, 0x50, 0x83, 0x65, 0x3f, 0x2d, 0x55, 0x42, 0x49, 0x4f, 0x3f, 0x51,
     0x02, 0x1b, 0x26, 0x28, 0x38, 0x64, 0xa7, 0x14, 0x0f, 0x06, 0x01, 0x02,
     0x06, 0x57, 0x02, 0x03, 0x04, 0x28, 0x33, 0x75, 0x35, 0x7a, 0x59, 0x3f,
-    0xfc, 0x4a, 0x4c, 0x68, 0x00, 0x03, 0x00, 0x2f, 0xff, 0xd9, 0x03, 0x8f,
-    0x03, 0x51, 0x00, 0x2e, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x00, 0x00, 0x1f,
-    0x01, 0x33, 0x15, 0x21, 0x0f, 0x01, 0x21, 0x06, 0x07, 0x0e, 0x02, 0x07,
-    0x06, 0x2f, 0x01, 0x16, 0x37, 0x3e, 0x02, 0x37, 0x3e, 0x01, 0x37, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x3f, 0x01, 0x23,
-    0x35, 0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x01, 0x33, 0x11, 0x36, 0x37,
-    0x17, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x13, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x02, 0x86, 0x11, 0x0b, 0xed,
-    0xfe, 0x8e, 0x03, 0x01, 0x01, 0x2c, 0x07, 0x0d, 0x05, 0x16, 0x30, 0x2d,
-    0x54, 0x29, 0x11, 0x44, 0x2b, 0x1c, 0x18, 0x0a, 0x03, 0x05, 0x08, 0x01,
-    0xd5, 0x09, 0x17, 0x1f, 0x66, 0x4e, 0x34, 0x3d, 0x0e, 0x1c, 0x06, 0x03,
-    0x76, 0xf6, 0x02, 0x08, 0x0c, 0x0e, 0x57, 0xfd, 0xb7, 0xc9, 0x2b, 0x33,
-    0x21, 0x4c, 0x78, 0x2a, 0x10, 0x0a, 0x74, 0x75, 0x21, 0x28, 0x2f, 0x13,
-    0x47, 0x1a, 0x27, 0x27, 0x20, 0x03, 0x2e, 0x38, 0x2c, 0x57, 0x72, 0x14,
-    0xee, 0x8d, 0x2d, 0x32, 0x19, 0x05, 0x05, 0x02, 0x5b, 0x04, 0x01, 0x02,
-    0x09, 0x17, 0x1b, 0x2c, 0xa1, 0x44, 0x83, 0x50, 0x76, 0x76, 0x33, 0x38,
-    0x67, 0x37, 0x5f, 0xc9, 0x69, 0x57, 0x0b, 0x1a, 0x2f, 0x26, 0x0d, 0xfe,
-    0xd0, 0xfe, 0x83, 0x21, 0x37, 0x52, 0x46, 0x56, 0x41, 0x0d, 0x19, 0x14,
-    0x01, 0x41, 0x01, 0x77, 0x21, 0x33, 0x3b, 0x1e, 0x38, 0x2b, 0x32, 0x32,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x07, 0x03, 0x8f,
-    0x03, 0x44, 0x00, 0x13, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x00, 0x25, 0x11,
-    0x33, 0x11, 0x33, 0x11, 0x21, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x23, 0x11, 0x33, 0x15, 0x21, 0x35, 0x03, 0x33, 0x11, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x13, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x01, 0x82, 0x57, 0x75, 0xff, 0x00,
-    0x02, 0x26, 0xce, 0xc2, 0xc2, 0xe9, 0xfd, 0x91, 0xf4, 0xbb, 0x25, 0x2d,
-    0x20, 0x44, 0x70, 0x2d, 0x10, 0x0a, 0x66, 0x6e, 0x13, 0x33, 0x2c, 0x11,
-    0x47, 0x20, 0x1c, 0x1e, 0x25, 0x5a, 0x01, 0xe2, 0xfe, 0x1e, 0x02, 0x69,
-    0x56, 0x56, 0xf1, 0x56, 0xfe, 0xde, 0x53, 0x53, 0x01, 0xc9, 0xfe, 0x7f,
-    0x20, 0x37, 0x59, 0x46, 0x53, 0x43, 0x0e, 0x19, 0x15, 0x01, 0x48, 0x01,
-    0x76, 0x12, 0x3e, 0x37, 0x1c, 0x37, 0x2f, 0x26, 0x26, 0x2c, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x2c, 0xff, 0xf3, 0x03, 0x98, 0x03, 0x48, 0x00, 0x03,
-    0x00, 0x11, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x34, 0x00, 0x38, 0x00, 0x00,
-    0x01, 0x11, 0x21, 0x11, 0x25, 0x33, 0x11, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x27, 0x3e, 0x01, 0x35, 0x11, 0x23, 0x13, 0x1e, 0x01, 0x17, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x13, 0x33, 0x37, 0x23, 0x35,
-    0x33, 0x37, 0x23, 0x35, 0x21, 0x15, 0x21, 0x07, 0x21, 0x07, 0x33, 0x15,
-    0x21, 0x01, 0x35, 0x21, 0x15, 0x01, 0x37, 0x23, 0x07, 0x03, 0x4d, 0xfe,
-    0x24, 0xfe, 0xbb, 0xc1, 0x21, 0x32, 0x27, 0x55, 0x69, 0x2b, 0x0f, 0x0d,
-    0x6e, 0x6e, 0x0c, 0x24, 0x09, 0x01, 0x0d, 0x2f, 0x13, 0x45, 0x13, 0x2d,
-    0x21, 0x25, 0xce, 0x90, 0x13, 0x73, 0x80, 0x11, 0xab, 0x02, 0x2f, 0xfe,
-    0xd2, 0x11, 0x01, 0x08, 0x06, 0x6a, 0xfd, 0x8e, 0x01, 0xcf, 0xfe, 0xd1,
-    0x01, 0x11, 0x03, 0xbc, 0x13, 0x01, 0x31, 0xfe, 0xc2, 0x01, 0x3e, 0xf2,
-    0xfe, 0x69, 0x19, 0x36, 0x51, 0x4e, 0x47, 0x40, 0x0b, 0x17, 0x11, 0x01,
-    0x6c, 0x01, 0x74, 0x0b, 0x2a, 0x0a, 0x01, 0x10, 0x38, 0x1e, 0x38, 0x1d,
-    0x39, 0x2c, 0x27, 0xfe, 0xb0, 0x6e, 0x4b, 0x60, 0x4c, 0x4c, 0x60, 0xb9,
-    0x4f, 0xfe, 0xce, 0x9e, 0x9e, 0x01, 0x81, 0x6e, 0x6e, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x2f, 0xff, 0xdd, 0x03, 0x8e, 0x03, 0x4c, 0x00, 0x17,
-    0x00, 0x27, 0x00, 0x31, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x00,
-    0x01, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x21, 0x15, 0x21, 0x35,
-    0x27, 0x33, 0x11, 0x3e, 0x01, 0x37, 0x17, 0x0e, 0x01, 0x07, 0x27, 0x3e,
-    0x01, 0x35, 0x11, 0x23, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x01, 0x21, 0x11, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16,
-    0x33, 0x32, 0x3e, 0x01, 0x3d, 0x01, 0x21, 0x15, 0x23, 0x25, 0x35, 0x21,
-    0x15, 0x25, 0x35, 0x21, 0x15, 0x02, 0x2c, 0xcb, 0xcb, 0xeb, 0xeb, 0x51,
-    0xf4, 0xf4, 0xdc, 0xdc, 0x01, 0x11, 0xfd, 0x96, 0xf5, 0xbc, 0x0c, 0x2d,
-    0x10, 0x24, 0x22, 0x5c, 0x2e, 0x2a, 0x0e, 0x0b, 0x6c, 0x7a, 0x1a, 0x25,
-    0x29, 0x0f, 0x47, 0x0d, 0x29, 0x1e, 0x1f, 0x01, 0x02, 0x01, 0xd9, 0x24,
-    0x30, 0x38, 0x30, 0x0e, 0x26, 0x21, 0x19, 0x14, 0x06, 0xfe, 0xc6, 0x4f,
-    0x01, 0x89, 0xfe, 0xc6, 0x01, 0x3a, 0xfe, 0xc6, 0x02, 0x14, 0x35, 0x40,
-    0x33, 0x41, 0x4f, 0x4f, 0x41, 0x33, 0x40, 0x35, 0x41, 0x41, 0x09, 0xfe,
-    0x6c, 0x0b, 0x2e, 0x13, 0x4d, 0x23, 0x4d, 0x20, 0x3c, 0x0d, 0x19, 0x13,
-    0x01, 0x61, 0x01, 0x6e, 0x1c, 0x38, 0x3b, 0x1e, 0x30, 0x1a, 0x41, 0x2e,
-    0x27, 0xfe, 0x92, 0xfe, 0xa5, 0x33, 0x2b, 0x04, 0x07, 0x02, 0x4d, 0x03,
-    0x05, 0x0e, 0x13, 0x20, 0x92, 0xd4, 0x37, 0x37, 0x77, 0x38, 0x38, 0x00,
-    0x00, 0x03, 0x00, 0x1c, 0xff, 0xce, 0x03, 0x9d, 0x03, 0x54, 0x00, 0x14,
-    0x00, 0x38, 0x00, 0x3f, 0x00, 0x00, 0x3e, 0x02, 0x35, 0x11, 0x33, 0x11,
-    0x14, 0x07, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x2f, 0x01, 0x0e, 0x01,
-    0x07, 0x27, 0x13, 0x21, 0x11, 0x3e, 0x01, 0x37, 0x17, 0x06, 0x07, 0x21,
-    0x15, 0x23, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x07, 0x27, 0x15, 0x23, 0x11, 0x23,
-    0x11, 0x23, 0x24, 0x17, 0x37, 0x36, 0x37, 0x23, 0x07, 0x6e, 0x53, 0x1c,
-    0x4b, 0x09, 0x28, 0x19, 0x40, 0x0f, 0x3a, 0x12, 0x39, 0x24, 0x17, 0x56,
-    0x46, 0x37, 0x3d, 0x01, 0x54, 0x30, 0x4e, 0x13, 0x55, 0x12, 0x18, 0x01,
-    0x25, 0x4d, 0x1c, 0x49, 0x08, 0x0c, 0x50, 0x85, 0x37, 0x84, 0x4c, 0x50,
-    0x8f, 0x3a, 0x98, 0x4f, 0x41, 0x20, 0x1d, 0x39, 0x4c, 0xbe, 0x4a, 0x01,
-    0xf9, 0x43, 0x07, 0x3f, 0x17, 0xa7, 0x12, 0x55, 0x66, 0x66, 0x48, 0x01,
-    0x29, 0xfe, 0xda, 0x42, 0x36, 0x28, 0x1b, 0x46, 0x13, 0x36, 0x1a, 0x41,
-    0x26, 0x34, 0x5f, 0x35, 0x40, 0x02, 0xf6, 0xfe, 0xdd, 0x4c, 0xc1, 0x59,
-    0x11, 0x47, 0x42, 0x50, 0xe8, 0x86, 0x11, 0x12, 0x67, 0x57, 0x4d, 0x62,
-    0x63, 0x5f, 0x65, 0x47, 0x5e, 0x67, 0x6f, 0x8b, 0x30, 0x28, 0xe4, 0x01,
-    0xda, 0xfe, 0x24, 0xb1, 0x73, 0x0e, 0x7f, 0xb8, 0x2a, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x20, 0xff, 0xd6, 0x03, 0x8c, 0x03, 0x40, 0x00, 0x13,
-    0x00, 0x27, 0x00, 0x41, 0x00, 0x00, 0x01, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x35, 0x21, 0x35,
-    0x21, 0x35, 0x00, 0x37, 0x36, 0x35, 0x11, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x15, 0x14, 0x07, 0x06, 0x07, 0x27, 0x24, 0x36,
-    0x37, 0x3e, 0x01, 0x3f, 0x01, 0x33, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27,
+    0xfc, 0x4a, 0x4c, 0x68, 0x00, 0x03, 0x00, 0x2f, 0x50, 0x31, 0x71, 0x51,
+    0x00, 0x2e, 0x00, 0x3c, 0x00, 0x46, 0xd0, 0x29, 0x11, 0x33, 0xb3, 0x51,
+    0x0a, 0x06, 0x34, 0x05, 0x07, 0x34, 0x01, 0x0a, 0x47, 0x14, 0x23, 0x68,
+    0x4d, 0x02, 0x5f, 0x02, 0x0d, 0x5e, 0x02, 0xf0, 0x47, 0x02, 0x86, 0x11,
+    0x0b, 0xed, 0xfe, 0x8e, 0x03, 0x01, 0x01, 0x2c, 0x07, 0x0d, 0x05, 0x16,
+    0x30, 0x2d, 0x54, 0x29, 0x11, 0x44, 0x2b, 0x1c, 0x18, 0x0a, 0x03, 0x05,
+    0x08, 0x01, 0xd5, 0x09, 0x17, 0x1f, 0x66, 0x4e, 0x34, 0x3d, 0x0e, 0x1c,
+    0x06, 0x03, 0x76, 0xf6, 0x02, 0x08, 0x0c, 0x0e, 0x57, 0xfd, 0xb7, 0xc9,
+    0x2b, 0x33, 0x21, 0x4c, 0x78, 0x2a, 0x10, 0x0a, 0x74, 0x75, 0x21, 0x28,
+    0x2f, 0x13, 0x47, 0x1a, 0x27, 0x27, 0x20, 0x03, 0x2e, 0x38, 0x2c, 0x57,
+    0x72, 0x14, 0xee, 0x8d, 0x2d, 0x32, 0x19, 0x05, 0x05, 0x02, 0x5b, 0x15,
+    0x16, 0xf0, 0x11, 0x17, 0x1b, 0x2c, 0xa1, 0x44, 0x83, 0x50, 0x76, 0x76,
+    0x33, 0x38, 0x67, 0x37, 0x5f, 0xc9, 0x69, 0x57, 0x0b, 0x1a, 0x2f, 0x26,
+    0x0d, 0xfe, 0xd0, 0xfe, 0x83, 0x21, 0x37, 0x52, 0x46, 0x56, 0x41, 0x37,
+    0x03, 0xd1, 0x41, 0x01, 0x77, 0x21, 0x33, 0x3b, 0x1e, 0x38, 0x2b, 0x32,
+    0x32, 0x24, 0x00, 0x86, 0x17, 0xb4, 0x07, 0x03, 0x8f, 0x03, 0x44, 0x00,
+    0x13, 0x00, 0x21, 0x00, 0x2b, 0xd2, 0x41, 0x14, 0x21, 0x60, 0x14, 0x01,
+    0x0a, 0x08, 0x03, 0x28, 0x03, 0x0e, 0x27, 0x03, 0xf1, 0x4c, 0x82, 0x57,
+    0x75, 0xff, 0x00, 0x02, 0x26, 0xce, 0xc2, 0xc2, 0xe9, 0xfd, 0x91, 0xf4,
+    0xbb, 0x25, 0x2d, 0x20, 0x44, 0x70, 0x2d, 0x10, 0x0a, 0x66, 0x6e, 0x13,
+    0x33, 0x2c, 0x11, 0x47, 0x20, 0x1c, 0x1e, 0x25, 0x5a, 0x01, 0xe2, 0xfe,
+    0x1e, 0x02, 0x69, 0x56, 0x56, 0xf1, 0x56, 0xfe, 0xde, 0x53, 0x53, 0x01,
+    0xc9, 0xfe, 0x7f, 0x20, 0x37, 0x59, 0x46, 0x53, 0x43, 0x0e, 0x19, 0x15,
+    0x01, 0x48, 0x01, 0x76, 0x12, 0x3e, 0x37, 0x1c, 0x37, 0x2f, 0x26, 0x26,
+    0x2c, 0x00, 0x06, 0x00, 0x2c, 0xff, 0xf3, 0x03, 0x98, 0x03, 0x48, 0x00,
+    0x03, 0x00, 0x11, 0x00, 0x1e, 0x46, 0x55, 0x12, 0x38, 0x9a, 0x04, 0x1b,
+    0x25, 0x80, 0x00, 0x27, 0x16, 0x17, 0x3b, 0x04, 0x01, 0x25, 0x53, 0x01,
+    0x27, 0x3f, 0x21, 0x07, 0x21, 0x73, 0x52, 0x00, 0x1a, 0x08, 0xf0, 0x60,
+    0x37, 0x23, 0x07, 0x03, 0x4d, 0xfe, 0x24, 0xfe, 0xbb, 0xc1, 0x21, 0x32,
+    0x27, 0x55, 0x69, 0x2b, 0x0f, 0x0d, 0x6e, 0x6e, 0x0c, 0x24, 0x09, 0x01,
+    0x0d, 0x2f, 0x13, 0x45, 0x13, 0x2d, 0x21, 0x25, 0xce, 0x90, 0x13, 0x73,
+    0x80, 0x11, 0xab, 0x02, 0x2f, 0xfe, 0xd2, 0x11, 0x01, 0x08, 0x06, 0x6a,
+    0xfd, 0x8e, 0x01, 0xcf, 0xfe, 0xd1, 0x01, 0x11, 0x03, 0xbc, 0x13, 0x01,
+    0x31, 0xfe, 0xc2, 0x01, 0x3e, 0xf2, 0xfe, 0x69, 0x19, 0x36, 0x51, 0x4e,
+    0x47, 0x40, 0x0b, 0x17, 0x11, 0x01, 0x6c, 0x01, 0x74, 0x0b, 0x2a, 0x0a,
+    0x01, 0x10, 0x38, 0x1e, 0x38, 0x1d, 0x39, 0x2c, 0x27, 0xfe, 0xb0, 0x6e,
+    0x4b, 0x60, 0x4c, 0x4c, 0x60, 0xb9, 0x4f, 0xfe, 0xce, 0x9e, 0x9e, 0x01,
+    0x81, 0x6e, 0x6e, 0x6e, 0x14, 0xd1, 0x2f, 0xff, 0xdd, 0x03, 0x8e, 0x03,
+    0x4c, 0x00, 0x17, 0x00, 0x27, 0x00, 0x31, 0xa4, 0x31, 0x14, 0x4c, 0x26,
+    0x3a, 0x0a, 0x5e, 0x33, 0x00, 0x5b, 0x05, 0x11, 0x27, 0xb7, 0x0c, 0x0f,
+    0x7b, 0x04, 0x02, 0x07, 0x48, 0x4b, 0x03, 0x81, 0x1e, 0x04, 0xf0, 0x08,
+    0xf0, 0x2c, 0x02, 0x2c, 0xcb, 0xcb, 0xeb, 0xeb, 0x51, 0xf4, 0xf4, 0xdc,
+    0xdc, 0x01, 0x11, 0xfd, 0x96, 0xf5, 0xbc, 0x0c, 0x2d, 0x10, 0x24, 0x22,
+    0x5c, 0x2e, 0x2a, 0x0e, 0x0b, 0x6c, 0x7a, 0x1a, 0x25, 0x29, 0x0f, 0x47,
+    0x0d, 0x29, 0x1e, 0x1f, 0x01, 0x02, 0x01, 0xd9, 0x24, 0x30, 0x38, 0x30,
+    0x0e, 0x26, 0x21, 0x19, 0x14, 0x06, 0xfe, 0xc6, 0x4f, 0x01, 0x89, 0xfe,
+    0xc6, 0x77, 0x17, 0xf0, 0x30, 0x02, 0x14, 0x35, 0x40, 0x33, 0x41, 0x4f,
+    0x4f, 0x41, 0x33, 0x40, 0x35, 0x41, 0x41, 0x09, 0xfe, 0x6c, 0x0b, 0x2e,
+    0x13, 0x4d, 0x23, 0x4d, 0x20, 0x3c, 0x0d, 0x19, 0x13, 0x01, 0x61, 0x01,
+    0x6e, 0x1c, 0x38, 0x3b, 0x1e, 0x30, 0x1a, 0x41, 0x2e, 0x27, 0xfe, 0x92,
+    0xfe, 0xa5, 0x33, 0x2b, 0x04, 0x07, 0x02, 0x4d, 0x03, 0x05, 0x0e, 0x13,
+    0x20, 0x92, 0xd4, 0x37, 0x37, 0x77, 0x38, 0x38, 0x2c, 0x02, 0xf3, 0x00,
+    0x1c, 0xff, 0xce, 0x03, 0x9d, 0x03, 0x54, 0x00, 0x14, 0x00, 0x38, 0x00,
+    0x3f, 0x00, 0x00, 0x76, 0x3d, 0x05, 0xa4, 0x19, 0x12, 0x06, 0x5f, 0x08,
+    0x16, 0x36, 0x42, 0x2f, 0x0a, 0x09, 0x0b, 0x22, 0x07, 0x27, 0xe4, 0x05,
+    0x12, 0x24, 0x0c, 0x2e, 0xf0, 0x69, 0x6e, 0x53, 0x1c, 0x4b, 0x09, 0x28,
+    0x19, 0x40, 0x0f, 0x3a, 0x12, 0x39, 0x24, 0x17, 0x56, 0x46, 0x37, 0x3d,
+    0x01, 0x54, 0x30, 0x4e, 0x13, 0x55, 0x12, 0x18, 0x01, 0x25, 0x4d, 0x1c,
+    0x49, 0x08, 0x0c, 0x50, 0x85, 0x37, 0x84, 0x4c, 0x50, 0x8f, 0x3a, 0x98,
+    0x4f, 0x41, 0x20, 0x1d, 0x39, 0x4c, 0xbe, 0x4a, 0x01, 0xf9, 0x43, 0x07,
+    0x3f, 0x17, 0xa7, 0x12, 0x55, 0x66, 0x66, 0x48, 0x01, 0x29, 0xfe, 0xda,
+    0x42, 0x36, 0x28, 0x1b, 0x46, 0x13, 0x36, 0x1a, 0x41, 0x26, 0x34, 0x5f,
+    0x35, 0x40, 0x02, 0xf6, 0xfe, 0xdd, 0x4c, 0xc1, 0x59, 0x11, 0x47, 0x42,
+    0x50, 0xe8, 0x86, 0x11, 0x12, 0x67, 0x57, 0x4d, 0x62, 0x63, 0x5f, 0x65,
+    0x47, 0x5e, 0x67, 0x6f, 0x8b, 0x30, 0x28, 0xe4, 0x01, 0xda, 0xfe, 0x24,
+    0xb1, 0x73, 0x0e, 0x7f, 0xb8, 0x2a, 0xca, 0x00, 0xd4, 0x20, 0xff, 0xd6,
+    0x03, 0x8c, 0x03, 0x40, 0x00, 0x13, 0x00, 0x27, 0x00, 0x41, 0xf6, 0x12,
+    0x13, 0x33, 0x39, 0x49, 0x11, 0x33, 0x0c, 0x0b, 0x1a, 0x00, 0xe8, 0x2c,
+    0x11, 0x14, 0x92, 0x3c, 0x06, 0x69, 0x09, 0x0b, 0x4c, 0x06, 0xf0, 0x6a,
     0x02, 0x5f, 0x01, 0x29, 0xfe, 0xd7, 0xdb, 0x54, 0xfe, 0x9e, 0x54, 0xda,
     0xfe, 0xf3, 0x01, 0x0d, 0xfe, 0x5b, 0x16, 0x15, 0x8d, 0xd5, 0xa3, 0xbd,
     0x10, 0x83, 0xc0, 0xd9, 0x62, 0x19, 0x15, 0x45, 0x51, 0x01, 0x14, 0x6e,
@@ -2540,51 +2004,39 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x13, 0x52, 0x0d, 0x0e, 0x0e, 0x02, 0xd5, 0xc6, 0x75, 0x63, 0x78, 0x2c,
     0x3a, 0x2a, 0x21, 0x1b, 0x46, 0x35, 0x44, 0x47, 0x3a, 0x26, 0x12, 0x2c,
     0x3e, 0x1b, 0x4f, 0x2d, 0x32, 0x23, 0x1b, 0x15, 0x13, 0x27, 0x37, 0x17,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x21, 0xff, 0xcf, 0x03, 0x84,
-    0x03, 0x4d, 0x00, 0x0b, 0x00, 0x22, 0x00, 0x2a, 0x00, 0x2e, 0x00, 0x00,
-    0x01, 0x11, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x11, 0x21, 0x11,
-    0x00, 0x36, 0x37, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x07, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x07, 0x06, 0x07, 0x27, 0x13,
-    0x21, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x05, 0x11, 0x23, 0x11, 0x02,
-    0x5a, 0x53, 0xd7, 0xd7, 0xab, 0xfe, 0x89, 0xfe, 0x78, 0x4d, 0x11, 0x21,
-    0x4b, 0x09, 0x24, 0x36, 0x44, 0x16, 0x40, 0x25, 0x31, 0x27, 0x0f, 0x04,
-    0x24, 0x80, 0x39, 0x36, 0x01, 0x4d, 0x4c, 0xb6, 0x4b, 0x02, 0xae, 0xd3,
-    0x01, 0xb0, 0x01, 0x9d, 0x9a, 0x51, 0xb2, 0xfe, 0x48, 0x01, 0xb8, 0xfe,
-    0x88, 0x53, 0x25, 0x46, 0x6c, 0x01, 0x2f, 0xfe, 0xcf, 0x35, 0x3f, 0x21,
-    0x3c, 0x49, 0x1f, 0x3d, 0x35, 0x36, 0x2d, 0x10, 0x0a, 0x54, 0x65, 0x40,
-    0x03, 0x05, 0xfd, 0xc1, 0x01, 0xed, 0xfe, 0x10, 0x87, 0x01, 0x13, 0xfe,
-    0xed, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1a, 0xff, 0xfe, 0x03, 0x8a,
-    0x03, 0x64, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x22, 0x00, 0x3c, 0x00, 0x40,
-    0x00, 0x47, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x04, 0x37, 0x11, 0x33,
-    0x11, 0x37, 0x32, 0x37, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x15, 0x33,
-    0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01,
-    0x35, 0x23, 0x15, 0x24, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15,
-    0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x26, 0x27, 0x06, 0x07, 0x27, 0x01, 0x35, 0x23, 0x15, 0x12, 0x17, 0x36,
-    0x37, 0x23, 0x06, 0x07, 0x03, 0x37, 0xfe, 0x80, 0xfe, 0x82, 0x0f, 0x49,
-    0x44, 0x03, 0x01, 0x84, 0x01, 0x20, 0x4e, 0x64, 0x64, 0x3e, 0x2a, 0x04,
-    0x31, 0x88, 0x70, 0x44, 0x0c, 0x01, 0x0e, 0x87, 0x01, 0x08, 0x2f, 0x27,
-    0x21, 0x4e, 0x0f, 0x12, 0x01, 0x02, 0x34, 0x5e, 0x52, 0x7b, 0x22, 0x8f,
-    0x59, 0x55, 0x8a, 0x26, 0x76, 0x4f, 0x30, 0x2a, 0x22, 0x15, 0x3a, 0x01,
-    0x72, 0xe1, 0x3d, 0x3b, 0x4a, 0x31, 0xd8, 0x04, 0x06, 0x01, 0x52, 0xfe,
-    0xac, 0x01, 0x54, 0xf4, 0x02, 0x01, 0x5c, 0xfe, 0xae, 0x0a, 0x01, 0x01,
-    0x8a, 0x01, 0x2b, 0xfe, 0xd5, 0x87, 0x4d, 0xa9, 0x0b, 0x0a, 0x55, 0x0a,
-    0x15, 0x10, 0x08, 0x51, 0x01, 0xf0, 0x91, 0x91, 0x50, 0x44, 0x38, 0x4c,
-    0x18, 0x20, 0x23, 0x4c, 0x68, 0x58, 0x33, 0x23, 0x4e, 0x30, 0x41, 0x3d,
-    0x34, 0x48, 0x2b, 0x33, 0x2f, 0x40, 0x26, 0x15, 0x37, 0xfd, 0xe0, 0xbb,
-    0xbb, 0x02, 0x1a, 0x37, 0x3f, 0x51, 0x05, 0x0a, 0x00, 0x08, 0x00, 0x23,
-    0xff, 0xd4, 0x03, 0xa0, 0x03, 0x57, 0x00, 0x0f, 0x00, 0x3a, 0x00, 0x4d,
-    0x00, 0x51, 0x00, 0x55, 0x00, 0x5a, 0x00, 0x5e, 0x00, 0x6e, 0x00, 0x00,
-    0x00, 0x36, 0x37, 0x33, 0x1e, 0x01, 0x17, 0x07, 0x26, 0x27, 0x15, 0x21,
-    0x35, 0x06, 0x07, 0x27, 0x02, 0x3f, 0x01, 0x35, 0x23, 0x35, 0x36, 0x3f,
-    0x01, 0x23, 0x35, 0x33, 0x36, 0x37, 0x17, 0x06, 0x07, 0x33, 0x15, 0x23,
-    0x07, 0x06, 0x07, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x15, 0x23, 0x35, 0x23, 0x06, 0x07, 0x27, 0x01,
-    0x33, 0x11, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32,
-    0x36, 0x3d, 0x01, 0x23, 0x15, 0x23, 0x37, 0x35, 0x23, 0x15, 0x37, 0x35,
-    0x23, 0x15, 0x01, 0x26, 0x27, 0x06, 0x07, 0x17, 0x33, 0x11, 0x23, 0x16,
-    0x33, 0x32, 0x3e, 0x01, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x07, 0x0e,
-    0x01, 0x2f, 0x01, 0x01, 0x95, 0x84, 0x2e, 0x47, 0x2b, 0x92, 0x55, 0x2c,
+    0x50, 0xd4, 0x0a, 0x11, 0x21, 0x10, 0x52, 0x92, 0x4d, 0x00, 0x0b, 0x00,
+    0x22, 0x00, 0x2a, 0x00, 0x2e, 0xf4, 0x1f, 0x04, 0x0c, 0x34, 0x12, 0x00,
+    0xc9, 0x1f, 0x17, 0x11, 0xff, 0x06, 0x04, 0x08, 0x0a, 0x00, 0x02, 0x00,
+    0x00, 0xcf, 0x1a, 0xf1, 0x1d, 0x02, 0x5a, 0x53, 0xd7, 0xd7, 0xab, 0xfe,
+    0x89, 0xfe, 0x78, 0x4d, 0x11, 0x21, 0x4b, 0x09, 0x24, 0x36, 0x44, 0x16,
+    0x40, 0x25, 0x31, 0x27, 0x0f, 0x04, 0x24, 0x80, 0x39, 0x36, 0x01, 0x4d,
+    0x4c, 0xb6, 0x4b, 0x02, 0xae, 0xd3, 0x01, 0xb0, 0x01, 0x9d, 0x9a, 0x51,
+    0xb2, 0xd5, 0x0b, 0xf0, 0x16, 0x88, 0x53, 0x25, 0x46, 0x6c, 0x01, 0x2f,
+    0xfe, 0xcf, 0x35, 0x3f, 0x21, 0x3c, 0x49, 0x1f, 0x3d, 0x35, 0x36, 0x2d,
+    0x10, 0x0a, 0x54, 0x65, 0x40, 0x03, 0x05, 0xfd, 0xc1, 0x01, 0xed, 0xfe,
+    0x10, 0x87, 0x01, 0x13, 0xfe, 0xed, 0x16, 0x03, 0x91, 0x1a, 0xff, 0xfe,
+    0x03, 0x8a, 0x03, 0x64, 0x00, 0x03, 0x94, 0x2c, 0x00, 0x9a, 0x1a, 0x14,
+    0x47, 0xb6, 0x35, 0x00, 0x3c, 0x23, 0x22, 0x32, 0x37, 0x8d, 0x0a, 0x09,
+    0xee, 0x4f, 0x00, 0x61, 0x0c, 0x1d, 0x24, 0x03, 0x25, 0x04, 0x01, 0x25,
+    0x00, 0x1e, 0x00, 0x03, 0xf1, 0x24, 0xf1, 0x81, 0x03, 0x37, 0xfe, 0x80,
+    0xfe, 0x82, 0x0f, 0x49, 0x44, 0x03, 0x01, 0x84, 0x01, 0x20, 0x4e, 0x64,
+    0x64, 0x3e, 0x2a, 0x04, 0x31, 0x88, 0x70, 0x44, 0x0c, 0x01, 0x0e, 0x87,
+    0x01, 0x08, 0x2f, 0x27, 0x21, 0x4e, 0x0f, 0x12, 0x01, 0x02, 0x34, 0x5e,
+    0x52, 0x7b, 0x22, 0x8f, 0x59, 0x55, 0x8a, 0x26, 0x76, 0x4f, 0x30, 0x2a,
+    0x22, 0x15, 0x3a, 0x01, 0x72, 0xe1, 0x3d, 0x3b, 0x4a, 0x31, 0xd8, 0x04,
+    0x06, 0x01, 0x52, 0xfe, 0xac, 0x01, 0x54, 0xf4, 0x02, 0x01, 0x5c, 0xfe,
+    0xae, 0x0a, 0x01, 0x01, 0x8a, 0x01, 0x2b, 0xfe, 0xd5, 0x87, 0x4d, 0xa9,
+    0x0b, 0x0a, 0x55, 0x0a, 0x15, 0x10, 0x08, 0x51, 0x01, 0xf0, 0x91, 0x91,
+    0x50, 0x44, 0x38, 0x4c, 0x18, 0x20, 0x23, 0x4c, 0x68, 0x58, 0x33, 0x23,
+    0x4e, 0x30, 0x41, 0x3d, 0x34, 0x48, 0x2b, 0x33, 0x2f, 0x40, 0x26, 0x15,
+    0x37, 0xfd, 0xe0, 0xbb, 0xbb, 0x02, 0x1a, 0x37, 0x3f, 0x51, 0x05, 0x0a,
+    0x00, 0x08, 0x00, 0x23, 0xff, 0xd4, 0x03, 0xa0, 0xce, 0x43, 0xb0, 0x3a,
+    0x00, 0x4d, 0x00, 0x51, 0x00, 0x55, 0x00, 0x5a, 0x00, 0x5e, 0xd4, 0x34,
+    0x10, 0x00, 0xf9, 0x58, 0x01, 0xc3, 0x00, 0x30, 0x15, 0x21, 0x35, 0x28,
+    0x02, 0x10, 0x37, 0x80, 0x33, 0x09, 0x5e, 0x31, 0x26, 0x23, 0x07, 0xc6,
+    0x0a, 0x04, 0x59, 0x2c, 0x01, 0x48, 0x15, 0x0e, 0xba, 0x1a, 0x04, 0xa4,
+    0x0a, 0x01, 0xa9, 0x56, 0x11, 0x17, 0x16, 0x51, 0x07, 0x42, 0x50, 0x00,
+    0xfc, 0x40, 0xf0, 0xba, 0x95, 0x84, 0x2e, 0x47, 0x2b, 0x92, 0x55, 0x2c,
     0x41, 0x3e, 0xfe, 0xe7, 0x34, 0x3f, 0x2e, 0xe2, 0x61, 0x11, 0x8c, 0x1b,
     0x22, 0x04, 0x4b, 0x5f, 0x10, 0x0b, 0x4b, 0x08, 0x12, 0x96, 0xab, 0x07,
     0x1d, 0x1e, 0x42, 0x46, 0x4c, 0x4c, 0x26, 0x23, 0x06, 0x24, 0x2b, 0x46,
@@ -2599,775 +2051,487 @@ unsigned char OPPOSans_Regular_ttf[] = {
     0x25, 0x27, 0x13, 0x04, 0x06, 0x01, 0x4e, 0x02, 0x0e, 0x1a, 0x40, 0xb9,
     0xfd, 0x4e, 0x4e, 0x91, 0x4b, 0x4b, 0x01, 0x0b, 0x42, 0x47, 0x4a, 0x3f,
     0x8f, 0xfe, 0x99, 0x55, 0x04, 0x12, 0x16, 0x01, 0xae, 0xfe, 0x44, 0x36,
-    0x29, 0x07, 0x04, 0x03, 0x02, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x24,
-    0xff, 0xe9, 0x03, 0x95, 0x03, 0x40, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x3b,
-    0x00, 0x00, 0x24, 0x3e, 0x01, 0x3d, 0x01, 0x36, 0x37, 0x36, 0x37, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x15, 0x21, 0x15, 0x23, 0x11, 0x23, 0x11, 0x23,
-    0x0e, 0x02, 0x07, 0x2f, 0x01, 0x11, 0x23, 0x35, 0x33, 0x11, 0x1e, 0x01,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01,
-    0x27, 0x07, 0x27, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x01, 0x53, 0x27, 0x10, 0x76, 0x83, 0x80, 0x3f, 0x19, 0x4c, 0x69,
-    0x79, 0x4b, 0x01, 0xa8, 0x9a, 0x57, 0xb8, 0x03, 0x15, 0x2b, 0x27, 0x4d,
-    0x83, 0x73, 0xc9, 0x35, 0x94, 0x6a, 0x38, 0x21, 0x70, 0x9c, 0x0c, 0x63,
-    0x7b, 0x44, 0x41, 0x7a, 0xa6, 0x36, 0x69, 0x43, 0x80, 0x1f, 0x2d, 0x26,
-    0x20, 0x45, 0x22, 0x22, 0x32, 0x19, 0xde, 0x56, 0x75, 0x66, 0xe8, 0x07,
-    0x17, 0x19, 0x12, 0x55, 0x16, 0x13, 0x16, 0x04, 0x88, 0x57, 0xfe, 0xa0,
-    0x01, 0x60, 0x53, 0x70, 0x5c, 0x35, 0x35, 0x0b, 0x01, 0x03, 0x57, 0xfe,
-    0xa2, 0x34, 0x32, 0x06, 0x02, 0x0d, 0x5a, 0x08, 0x03, 0x05, 0x38, 0x37,
-    0x7c, 0x3f, 0x03, 0x17, 0x1e, 0x37, 0x2a, 0x2d, 0x3c, 0x30, 0x2b, 0x3c,
-    0x19, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x22, 0xff, 0xe3, 0x03, 0x95,
-    0x03, 0x49, 0x00, 0x09, 0x00, 0x20, 0x00, 0x42, 0x00, 0x48, 0x00, 0x00,
-    0x12, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x13, 0x11,
-    0x23, 0x35, 0x33, 0x11, 0x1e, 0x01, 0x17, 0x16, 0x33, 0x32, 0x37, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x07, 0x27, 0x01, 0x33, 0x36,
-    0x3d, 0x01, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
-    0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x0e,
-    0x01, 0x07, 0x27, 0x3e, 0x01, 0x37, 0x23, 0x25, 0x35, 0x23, 0x15, 0x14,
-    0x07, 0xb1, 0x2a, 0x36, 0x10, 0x46, 0x17, 0x29, 0x34, 0x15, 0x41, 0x0e,
-    0x70, 0xc6, 0x34, 0x8f, 0x72, 0x33, 0x3d, 0x78, 0x81, 0x11, 0x6e, 0x68,
-    0x38, 0x54, 0x73, 0xa1, 0x3e, 0x64, 0x4a, 0x01, 0x0d, 0x7e, 0x01, 0x65,
-    0x65, 0x55, 0xa2, 0x54, 0x7a, 0x7a, 0x90, 0x90, 0x54, 0xa9, 0x08, 0x31,
-    0x33, 0x48, 0x2d, 0x2b, 0x07, 0x78, 0x01, 0x76, 0xa2, 0x01, 0x03, 0x1e,
-    0x37, 0x40, 0x1c, 0x39, 0x27, 0x36, 0x41, 0x18, 0x34, 0xfd, 0x74, 0x01,
-    0x06, 0x53, 0xfe, 0xa4, 0x37, 0x2f, 0x06, 0x03, 0x0b, 0x59, 0x08, 0x04,
-    0x04, 0x39, 0x39, 0x7f, 0x3e, 0x01, 0x87, 0x10, 0x23, 0x84, 0x52, 0x97,
-    0x97, 0x98, 0x98, 0x52, 0xb7, 0x53, 0xf1, 0xf1, 0x4d, 0x6c, 0x3f, 0x33,
-    0x31, 0x57, 0x3d, 0x53, 0xb7, 0x7e, 0x27, 0x12, 0x00, 0x04, 0x00, 0x1f,
-    0xff, 0xe3, 0x03, 0x98, 0x03, 0x3d, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x24,
-    0x00, 0x52, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, 0x03, 0x11, 0x23, 0x35,
-    0x33, 0x11, 0x1e, 0x01, 0x17, 0x16, 0x33, 0x32, 0x37, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x2e, 0x01, 0x27, 0x07, 0x27, 0x13, 0x16, 0x17, 0x16, 0x17,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x12, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x35,
-    0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x14, 0x1e, 0x01, 0x17, 0x33, 0x3e,
-    0x02, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x23,
-    0x2e, 0x02, 0x3d, 0x01, 0x23, 0x15, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07,
-    0x27, 0x03, 0x3d, 0xfe, 0x21, 0xbc, 0x6f, 0xc3, 0x2d, 0x7f, 0x6e, 0x45,
-    0x40, 0x70, 0x93, 0x0d, 0x8e, 0x51, 0x5f, 0x45, 0x7f, 0x8e, 0x2f, 0x6c,
-    0x41, 0x7c, 0x21, 0x23, 0x2b, 0x12, 0x48, 0x16, 0x25, 0x2d, 0x16, 0xf7,
-    0x35, 0x0e, 0x0f, 0x0c, 0x01, 0x86, 0x02, 0x50, 0xb9, 0x05, 0x13, 0x17,
-    0x17, 0x13, 0x10, 0x06, 0x02, 0x02, 0x03, 0x50, 0x01, 0x08, 0x06, 0x22,
-    0x2c, 0x15, 0x36, 0x2f, 0x30, 0x13, 0x6b, 0x01, 0x11, 0x13, 0x13, 0x3a,
-    0x2c, 0x3f, 0x03, 0x1a, 0x50, 0x50, 0xfd, 0x99, 0x01, 0x06, 0x53, 0xfe,
-    0xa0, 0x38, 0x2d, 0x04, 0x03, 0x0c, 0x59, 0x07, 0x05, 0x06, 0x33, 0x38,
-    0x7f, 0x40, 0x03, 0x1a, 0x24, 0x32, 0x3b, 0x1f, 0x36, 0x27, 0x36, 0x3f,
-    0x1a, 0xfd, 0xc4, 0x37, 0x1e, 0x1f, 0x4b, 0x36, 0x23, 0x51, 0x51, 0xe5,
-    0x17, 0x13, 0x06, 0x01, 0x01, 0x06, 0x12, 0x16, 0x1c, 0x38, 0x12, 0x18,
-    0x44, 0x34, 0x2a, 0x06, 0x02, 0x01, 0x14, 0x31, 0x30, 0xf1, 0x24, 0x42,
-    0x61, 0x26, 0x27, 0x41, 0x23, 0x3f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x25,
-    0xff, 0xe9, 0x03, 0x96, 0x03, 0x57, 0x00, 0x24, 0x00, 0x3b, 0x00, 0x45,
-    0x00, 0x00, 0x01, 0x36, 0x37, 0x17, 0x06, 0x07, 0x21, 0x15, 0x21, 0x07,
-    0x06, 0x07, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x23, 0x35, 0x21, 0x35, 0x21, 0x35, 0x23, 0x35, 0x36, 0x3f,
-    0x01, 0x23, 0x35, 0x03, 0x11, 0x23, 0x35, 0x33, 0x11, 0x1e, 0x01, 0x17,
-    0x16, 0x33, 0x32, 0x37, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x27,
-    0x07, 0x27, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27,
-    0x01, 0xd9, 0x1e, 0x0c, 0x55, 0x0c, 0x17, 0x01, 0x40, 0xfe, 0x9f, 0x06,
-    0x2d, 0x27, 0x81, 0x55, 0xcb, 0xcb, 0xf6, 0xf6, 0x55, 0xfe, 0xe6, 0x01,
-    0x1a, 0xe4, 0x2b, 0x2f, 0x05, 0x79, 0x98, 0x74, 0xc9, 0x34, 0x89, 0x75,
-    0x33, 0x3f, 0x78, 0x80, 0x0d, 0x6a, 0x70, 0x33, 0x5a, 0x82, 0x9c, 0x35,
-    0x65, 0x45, 0x78, 0x26, 0x22, 0x2a, 0x16, 0x4a, 0x14, 0x2a, 0x21, 0x24,
-    0x02, 0xeb, 0x4a, 0x22, 0x0d, 0x23, 0x3c, 0x50, 0x0d, 0x67, 0x3e, 0x7f,
-    0x7f, 0x4f, 0x72, 0x52, 0x7a, 0x7a, 0x52, 0x72, 0x51, 0x42, 0x64, 0x0a,
-    0x50, 0xfd, 0xc6, 0x01, 0x0a, 0x55, 0xfe, 0x9f, 0x38, 0x2d, 0x06, 0x03,
-    0x0c, 0x5a, 0x09, 0x04, 0x06, 0x37, 0x3c, 0x7e, 0x3f, 0x03, 0x1a, 0x2c,
-    0x30, 0x3d, 0x25, 0x37, 0x2a, 0x3b, 0x32, 0x2c, 0x00, 0x04, 0x00, 0x19,
-    0xff, 0xe5, 0x03, 0x8e, 0x03, 0x4c, 0x00, 0x3a, 0x00, 0x44, 0x00, 0x48,
-    0x00, 0x4c, 0x00, 0x00, 0x00, 0x17, 0x36, 0x37, 0x36, 0x37, 0x21, 0x15,
-    0x36, 0x37, 0x17, 0x0e, 0x01, 0x07, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x06, 0x07, 0x27, 0x37,
-    0x11, 0x23, 0x35, 0x33, 0x11, 0x16, 0x17, 0x27, 0x3e, 0x01, 0x35, 0x11,
-    0x21, 0x11, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x37, 0x01, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x02, 0x3c, 0x56,
-    0x25, 0x22, 0x3c, 0x15, 0xfe, 0x89, 0x65, 0x4c, 0x12, 0x33, 0x94, 0x3b,
-    0x3f, 0x58, 0x34, 0x4a, 0x7e, 0x87, 0x0d, 0x7e, 0x5e, 0x57, 0x4a, 0x6b,
-    0x9b, 0x3e, 0x2c, 0x36, 0x45, 0x7d, 0x6d, 0xc0, 0x2d, 0x43, 0x11, 0x0f,
-    0x0c, 0x01, 0xcc, 0x13, 0x2d, 0x24, 0x47, 0x2e, 0x66, 0x39, 0x2e, 0x34,
-    0x78, 0x79, 0x45, 0x27, 0xfe, 0x86, 0x24, 0x25, 0x2d, 0x16, 0x46, 0x14,
-    0x2b, 0x2b, 0x1d, 0x02, 0x98, 0xfe, 0xd2, 0x01, 0x2e, 0xfe, 0xd2, 0x01,
-    0x7c, 0x37, 0x14, 0x16, 0x26, 0x11, 0xe7, 0x1e, 0x20, 0x4f, 0x13, 0x2e,
-    0x0f, 0x12, 0x08, 0x04, 0x0c, 0x58, 0x08, 0x06, 0x07, 0x3a, 0x35, 0x3a,
-    0x49, 0x3b, 0x95, 0x01, 0x0a, 0x52, 0xfe, 0x9b, 0x2b, 0x1a, 0x37, 0x06,
-    0x14, 0x12, 0x02, 0x61, 0xfe, 0x7f, 0x0f, 0x3b, 0x1d, 0x2d, 0x1c, 0x46,
-    0x32, 0x40, 0x30, 0x55, 0x55, 0x24, 0x3b, 0x01, 0xb3, 0x26, 0x2f, 0x38,
-    0x25, 0x37, 0x22, 0x39, 0x3c, 0x1d, 0xfe, 0xdb, 0x52, 0x52, 0x9d, 0x50,
-    0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1f, 0xff, 0xe7, 0x03, 0x93,
-    0x03, 0x50, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x35,
-    0x23, 0x06, 0x07, 0x27, 0x36, 0x37, 0x17, 0x06, 0x07, 0x33, 0x35, 0x33,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x16, 0x17,
-    0x16, 0x33, 0x32, 0x3e, 0x01, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x0e,
-    0x02, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x15, 0x06, 0x07,
-    0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x35, 0x23, 0x35, 0x03, 0x11, 0x23,
-    0x35, 0x33, 0x11, 0x1e, 0x01, 0x17, 0x16, 0x33, 0x32, 0x37, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x06, 0x07, 0x27, 0x13, 0x16, 0x17,
-    0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x02, 0x30, 0x85, 0x1c, 0x13,
-    0x50, 0x43, 0x24, 0x50, 0x09, 0x13, 0x69, 0x4e, 0xd8, 0xd8, 0xfc, 0xb9,
-    0x0a, 0x11, 0x0a, 0x19, 0x1a, 0x15, 0x07, 0x02, 0x05, 0x02, 0x4a, 0x02,
-    0x06, 0x05, 0x18, 0x34, 0x33, 0x28, 0x22, 0x22, 0x1e, 0x5c, 0x02, 0x20,
-    0x29, 0x60, 0x37, 0x56, 0x1e, 0x1f, 0xa5, 0x87, 0x6b, 0xbd, 0x37, 0x8b,
-    0x6e, 0x32, 0x37, 0x79, 0x94, 0x0d, 0x5f, 0x7e, 0x53, 0x42, 0x71, 0xa1,
-    0x3b, 0x34, 0x33, 0x41, 0x6c, 0x1f, 0x2a, 0x30, 0x13, 0x43, 0x19, 0x26,
-    0x28, 0x20, 0x01, 0xf0, 0x84, 0x41, 0x24, 0x21, 0x77, 0x8a, 0x15, 0x24,
-    0x39, 0x91, 0x91, 0x4b, 0x84, 0x4d, 0xb3, 0x16, 0x11, 0x03, 0x01, 0x05,
-    0x0e, 0x12, 0x24, 0x39, 0x11, 0x2f, 0x2c, 0x28, 0x26, 0x0f, 0x04, 0x07,
-    0x2b, 0x2a, 0xc5, 0x02, 0x6a, 0x3d, 0x50, 0x3d, 0x40, 0x3a, 0x30, 0x31,
-    0x5b, 0x4d, 0xfe, 0xc7, 0x01, 0x03, 0x4e, 0xfe, 0xac, 0x37, 0x31, 0x07,
-    0x03, 0x0c, 0x54, 0x07, 0x03, 0x05, 0x36, 0x39, 0x3d, 0x46, 0x3c, 0x03,
-    0x16, 0x21, 0x32, 0x39, 0x20, 0x38, 0x26, 0x33, 0x35, 0x20, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x19, 0xff, 0xe8, 0x03, 0x94, 0x03, 0x3d, 0x00, 0x09,
-    0x00, 0x49, 0x00, 0x4d, 0x00, 0x51, 0x00, 0x55, 0x00, 0x59, 0x00, 0x00,
-    0x12, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x03, 0x11,
-    0x23, 0x35, 0x33, 0x11, 0x16, 0x17, 0x11, 0x33, 0x26, 0x27, 0x37, 0x16,
-    0x17, 0x36, 0x37, 0x21, 0x35, 0x21, 0x15, 0x06, 0x07, 0x17, 0x33, 0x11,
-    0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x3e, 0x02, 0x3d,
-    0x01, 0x23, 0x15, 0x23, 0x35, 0x23, 0x15, 0x23, 0x1e, 0x01, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x07, 0x06, 0x23, 0x22, 0x27, 0x2e, 0x01, 0x27, 0x07,
-    0x27, 0x01, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x05, 0x35, 0x23,
-    0x15, 0x37, 0x35, 0x23, 0x15, 0xbd, 0x1f, 0x20, 0x19, 0x4a, 0x12, 0x24,
-    0x28, 0x15, 0x44, 0x05, 0x68, 0xba, 0x24, 0x38, 0xca, 0x3f, 0x32, 0x28,
-    0x3e, 0x48, 0x47, 0x37, 0xfe, 0x7e, 0x02, 0x02, 0x6e, 0x51, 0x02, 0xc5,
-    0x0c, 0x22, 0x25, 0x26, 0x2b, 0x10, 0x1e, 0x18, 0x17, 0x12, 0x06, 0x92,
-    0x4f, 0x8f, 0x4c, 0x29, 0x67, 0x44, 0x31, 0x4a, 0x72, 0x8c, 0x0d, 0x8b,
-    0x62, 0x4f, 0x38, 0x74, 0xa0, 0x3f, 0x62, 0x45, 0x02, 0x09, 0x8f, 0x8f,
-    0x8f, 0x01, 0x70, 0x92, 0x92, 0x92, 0x03, 0x17, 0x33, 0x32, 0x2e, 0x2d,
-    0x29, 0x38, 0x3f, 0x1b, 0x2b, 0xfd, 0x74, 0x01, 0x0c, 0x51, 0xfe, 0x9d,
-    0x28, 0x19, 0x01, 0xfc, 0x2a, 0x19, 0x38, 0x1f, 0x2f, 0x25, 0x29, 0x47,
-    0x47, 0x4f, 0x2b, 0x01, 0xfe, 0x6d, 0x27, 0x28, 0x13, 0x05, 0x06, 0x02,
-    0x50, 0x03, 0x01, 0x06, 0x12, 0x16, 0x1e, 0x8b, 0x8b, 0x99, 0x12, 0x14,
-    0x06, 0x04, 0x0b, 0x51, 0x08, 0x04, 0x08, 0x38, 0x38, 0x7f, 0x37, 0x01,
-    0x29, 0x48, 0x48, 0x8d, 0x4a, 0x4a, 0x8d, 0x48, 0x48, 0x8d, 0x4a, 0x4a,
-    0x00, 0x07, 0x00, 0x31, 0xff, 0xf1, 0x03, 0x8e, 0x03, 0x20, 0x00, 0x0b,
-    0x00, 0x0f, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x33, 0x00, 0x57,
-    0x00, 0x00, 0x13, 0x35, 0x23, 0x35, 0x21, 0x15, 0x23, 0x15, 0x33, 0x11,
-    0x21, 0x11, 0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x22, 0x27, 0x2e, 0x01,
-    0x3d, 0x01, 0x23, 0x15, 0x14, 0x07, 0x06, 0x07, 0x27, 0x15, 0x36, 0x37,
-    0x36, 0x3d, 0x01, 0x23, 0x15, 0x13, 0x35, 0x23, 0x15, 0x1e, 0x01, 0x33,
-    0x16, 0x36, 0x33, 0x35, 0x23, 0x15, 0x13, 0x21, 0x11, 0x23, 0x11, 0x14,
-    0x1e, 0x01, 0x17, 0x32, 0x37, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x36, 0x35,
-    0x17, 0x06, 0x07, 0x0e, 0x02, 0x0f, 0x01, 0x27, 0x2e, 0x02, 0x35, 0x11,
-    0x33, 0x35, 0x23, 0xc4, 0x93, 0x01, 0xcd, 0x85, 0x74, 0xfe, 0x63, 0x01,
-    0x56, 0xfe, 0xf0, 0x01, 0x10, 0x23, 0x15, 0x1f, 0x19, 0x32, 0x10, 0x10,
-    0x2d, 0x21, 0x1a, 0x0b, 0x0e, 0x33, 0x9f, 0x31, 0x6f, 0x08, 0x0e, 0x08,
-    0x0f, 0x06, 0x33, 0xb5, 0x01, 0x3d, 0xe6, 0x08, 0x17, 0x1b, 0x21, 0x26,
-    0x14, 0x13, 0x09, 0x03, 0x04, 0x02, 0x02, 0x53, 0x01, 0x09, 0x06, 0x16,
-    0x2d, 0x2c, 0x32, 0x35, 0x33, 0x34, 0x14, 0xe4, 0xe9, 0x02, 0x6e, 0x64,
-    0x4e, 0x4e, 0x64, 0xfd, 0x90, 0x02, 0x70, 0xfd, 0xdf, 0x5b, 0x5b, 0xa7,
-    0x46, 0x03, 0x04, 0x1b, 0x1f, 0xa8, 0x17, 0x56, 0x36, 0x35, 0x35, 0x19,
-    0x3b, 0x81, 0x21, 0x2f, 0x53, 0x0b, 0xd0, 0x01, 0x1b, 0x64, 0x64, 0xe6,
-    0x0b, 0x01, 0x01, 0xa6, 0x8b, 0x01, 0x85, 0xfe, 0x85, 0xfe, 0xd4, 0x14,
-    0x12, 0x06, 0x01, 0x02, 0x01, 0x09, 0x16, 0x19, 0x27, 0x2a, 0x10, 0x06,
-    0x17, 0x2b, 0x41, 0x30, 0x31, 0x14, 0x01, 0x01, 0x01, 0x01, 0x12, 0x30,
-    0x30, 0x01, 0x90, 0xd7, 0x00, 0x05, 0x00, 0x21, 0xff, 0xdc, 0x03, 0x9c,
-    0x03, 0x3f, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x32, 0x00, 0x3c, 0x00, 0x46,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x11, 0x23, 0x11, 0x0e, 0x01, 0x07,
-    0x06, 0x07, 0x27, 0x36, 0x37, 0x36, 0x37, 0x21, 0x35, 0x12, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x04, 0x2f, 0x01, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x25, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x16, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x01, 0xb2, 0x57, 0x01, 0x6b, 0xfe, 0xe8, 0x30, 0x49, 0x5d, 0x6a,
-    0x2f, 0x73, 0x56, 0x68, 0x33, 0x57, 0x17, 0x48, 0x2b, 0x5d, 0x7a, 0x30,
-    0x67, 0x6a, 0x42, 0x29, 0xfe, 0xeb, 0xab, 0xde, 0xd6, 0x8f, 0x19, 0xa2,
-    0xbc, 0xfe, 0xfa, 0x76, 0x13, 0x6e, 0x1a, 0x1f, 0x18, 0x24, 0x49, 0x19,
-    0x1e, 0x21, 0x19, 0x01, 0x4c, 0x19, 0x1b, 0x1b, 0x11, 0x4b, 0x0f, 0x1e,
-    0x1c, 0x15, 0xf9, 0x2a, 0x24, 0x1c, 0x4c, 0x19, 0x25, 0x2e, 0x24, 0x47,
-    0x01, 0x96, 0x5b, 0x5b, 0x52, 0x40, 0x3a, 0x4a, 0x2b, 0x4e, 0x38, 0x48,
-    0x59, 0x64, 0xfe, 0x98, 0x01, 0x5e, 0x2a, 0x57, 0x25, 0x51, 0x3d, 0x4d,
-    0x29, 0x58, 0x38, 0x38, 0x52, 0x01, 0x72, 0x10, 0x10, 0x17, 0x52, 0x17,
-    0x0f, 0x11, 0x01, 0x53, 0x62, 0x1e, 0x2d, 0x21, 0x3b, 0x30, 0x2b, 0x2e,
-    0x30, 0x20, 0x45, 0x21, 0x2f, 0x2b, 0x23, 0x2b, 0x21, 0x31, 0x30, 0x1c,
-    0x74, 0x3b, 0x33, 0x36, 0x2b, 0x2e, 0x38, 0x41, 0x29, 0x32, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x30, 0xff, 0xf4, 0x03, 0x90, 0x03, 0x41, 0x00, 0x2d,
-    0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x35,
-    0x21, 0x35, 0x21, 0x35, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x23, 0x15, 0x21, 0x15, 0x21, 0x15,
-    0x21, 0x11, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35,
-    0x21, 0x35, 0x21, 0x35, 0x21, 0x35, 0x21, 0x11, 0x05, 0x35, 0x23, 0x15,
-    0x37, 0x35, 0x23, 0x15, 0x05, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15,
-    0x01, 0xb6, 0xfe, 0x7a, 0x01, 0x86, 0x84, 0x56, 0x3a, 0x19, 0x0e, 0x1c,
-    0x3d, 0x91, 0xa2, 0xa5, 0x77, 0x19, 0x70, 0xbc, 0x06, 0x01, 0x86, 0xfe,
-    0x7a, 0x01, 0x22, 0xfe, 0xde, 0x01, 0x3c, 0xfe, 0xc4, 0x01, 0x79, 0xfc,
-    0xb8, 0x01, 0x7b, 0xfe, 0xc5, 0x01, 0x3b, 0xfe, 0xdf, 0x01, 0x21, 0xcd,
-    0xcd, 0xcd, 0x01, 0xee, 0xcd, 0xcd, 0xcd, 0x02, 0x28, 0x39, 0x42, 0x3b,
-    0x05, 0x01, 0x49, 0x01, 0x09, 0x07, 0x0f, 0x49, 0x0e, 0x08, 0x3f, 0x42,
-    0x39, 0xfe, 0xcb, 0x3d, 0x41, 0x3c, 0x45, 0x45, 0x3c, 0x41, 0x3d, 0x01,
-    0x35, 0xf4, 0x3a, 0x3a, 0x7a, 0x3a, 0x3a, 0x7a, 0x3a, 0x3a, 0x7a, 0x3a,
-    0x3a, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x30, 0xff, 0xeb, 0x03, 0x8c,
-    0x03, 0x35, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x23,
-    0x00, 0x27, 0x00, 0x2b, 0x00, 0x2f, 0x00, 0x33, 0x00, 0x00, 0x01, 0x15,
-    0x21, 0x35, 0x03, 0x21, 0x15, 0x21, 0x13, 0x21, 0x35, 0x21, 0x35, 0x21,
-    0x35, 0x21, 0x35, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x01, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x01, 0x35,
-    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x01, 0x35, 0x23, 0x15, 0x37, 0x35,
-    0x23, 0x15, 0x03, 0x2c, 0xfd, 0x63, 0x5f, 0x03, 0x5c, 0xfc, 0xa4, 0x0b,
+    0x29, 0x07, 0x04, 0x03, 0x02, 0x50, 0x00, 0x03, 0x00, 0x24, 0xff, 0xe9,
+    0x03, 0x95, 0x03, 0x40, 0x00, 0x1a, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x00,
+    0x24, 0xfd, 0x04, 0x0d, 0x66, 0x30, 0x60, 0x0e, 0x02, 0x07, 0x27, 0x27,
+    0x11, 0xef, 0x11, 0x0b, 0x3e, 0x3f, 0x08, 0xdd, 0x23, 0xf0, 0x5d, 0x01,
+    0x53, 0x27, 0x10, 0x76, 0x83, 0x80, 0x3f, 0x19, 0x4c, 0x69, 0x79, 0x4b,
+    0x01, 0xa8, 0x9a, 0x57, 0xb8, 0x03, 0x15, 0x2b, 0x27, 0x4d, 0x83, 0x73,
+    0xc9, 0x35, 0x94, 0x6a, 0x38, 0x21, 0x70, 0x9c, 0x0c, 0x63, 0x7b, 0x44,
+    0x41, 0x7a, 0xa6, 0x36, 0x69, 0x43, 0x80, 0x1f, 0x2d, 0x26, 0x20, 0x45,
+    0x22, 0x22, 0x32, 0x19, 0xde, 0x56, 0x75, 0x66, 0xe8, 0x07, 0x17, 0x19,
+    0x12, 0x55, 0x16, 0x13, 0x16, 0x04, 0x88, 0x57, 0xfe, 0xa0, 0x01, 0x60,
+    0x53, 0x70, 0x5c, 0x35, 0x35, 0x0b, 0x01, 0x03, 0x57, 0xfe, 0xa2, 0x34,
+    0x32, 0x06, 0x02, 0x0d, 0x5a, 0x08, 0x03, 0x05, 0x38, 0x37, 0x7c, 0x3f,
+    0x03, 0x17, 0x1e, 0x37, 0x2a, 0x2d, 0x3c, 0x30, 0x2b, 0x3c, 0x19, 0x7e,
+    0x03, 0x71, 0x22, 0xff, 0xe3, 0x03, 0x95, 0x03, 0x49, 0xb0, 0x0d, 0x00,
+    0x9c, 0x1c, 0x07, 0xb0, 0x0d, 0x1f, 0x13, 0xac, 0x00, 0x03, 0x44, 0x01,
+    0x33, 0x36, 0x35, 0x16, 0x06, 0x0a, 0xbf, 0x0c, 0x03, 0xa6, 0x12, 0x21,
+    0x23, 0x25, 0x0f, 0x09, 0xf1, 0x6e, 0xb1, 0x2a, 0x36, 0x10, 0x46, 0x17,
+    0x29, 0x34, 0x15, 0x41, 0x0e, 0x70, 0xc6, 0x34, 0x8f, 0x72, 0x33, 0x3d,
+    0x78, 0x81, 0x11, 0x6e, 0x68, 0x38, 0x54, 0x73, 0xa1, 0x3e, 0x64, 0x4a,
+    0x01, 0x0d, 0x7e, 0x01, 0x65, 0x65, 0x55, 0xa2, 0x54, 0x7a, 0x7a, 0x90,
+    0x90, 0x54, 0xa9, 0x08, 0x31, 0x33, 0x48, 0x2d, 0x2b, 0x07, 0x78, 0x01,
+    0x76, 0xa2, 0x01, 0x03, 0x1e, 0x37, 0x40, 0x1c, 0x39, 0x27, 0x36, 0x41,
+    0x18, 0x34, 0xfd, 0x74, 0x01, 0x06, 0x53, 0xfe, 0xa4, 0x37, 0x2f, 0x06,
+    0x03, 0x0b, 0x59, 0x08, 0x04, 0x04, 0x39, 0x39, 0x7f, 0x3e, 0x01, 0x87,
+    0x10, 0x23, 0x84, 0x52, 0x97, 0x97, 0x98, 0x98, 0x52, 0xb7, 0x53, 0xf1,
+    0xf1, 0x4d, 0x6c, 0x3f, 0x33, 0x31, 0x57, 0x3d, 0x53, 0xb7, 0x7e, 0x27,
+    0x12, 0x00, 0x04, 0x00, 0x1f, 0xff, 0xe3, 0x03, 0x98, 0x03, 0x3d, 0x12,
+    0x4d, 0x10, 0x24, 0x18, 0x2e, 0x10, 0x01, 0x04, 0x08, 0x0f, 0x76, 0x01,
+    0x0d, 0x16, 0x12, 0xb1, 0x46, 0x11, 0x23, 0xdb, 0x09, 0x02, 0xe5, 0x5c,
+    0x04, 0xf1, 0x3c, 0x01, 0xae, 0x46, 0x23, 0x15, 0x06, 0x79, 0x0b, 0xf0,
+    0x3f, 0x3d, 0xfe, 0x21, 0xbc, 0x6f, 0xc3, 0x2d, 0x7f, 0x6e, 0x45, 0x40,
+    0x70, 0x93, 0x0d, 0x8e, 0x51, 0x5f, 0x45, 0x7f, 0x8e, 0x2f, 0x6c, 0x41,
+    0x7c, 0x21, 0x23, 0x2b, 0x12, 0x48, 0x16, 0x25, 0x2d, 0x16, 0xf7, 0x35,
+    0x0e, 0x0f, 0x0c, 0x01, 0x86, 0x02, 0x50, 0xb9, 0x05, 0x13, 0x17, 0x17,
+    0x13, 0x10, 0x06, 0x02, 0x02, 0x03, 0x50, 0x01, 0x08, 0x06, 0x22, 0x2c,
+    0x15, 0x36, 0x2f, 0x30, 0x13, 0x6b, 0x01, 0x11, 0x13, 0x13, 0x3a, 0x2c,
+    0x3f, 0x03, 0x1a, 0x50, 0x50, 0xfd, 0x99, 0xe1, 0x00, 0xf1, 0x33, 0xa0,
+    0x38, 0x2d, 0x04, 0x03, 0x0c, 0x59, 0x07, 0x05, 0x06, 0x33, 0x38, 0x7f,
+    0x40, 0x03, 0x1a, 0x24, 0x32, 0x3b, 0x1f, 0x36, 0x27, 0x36, 0x3f, 0x1a,
+    0xfd, 0xc4, 0x37, 0x1e, 0x1f, 0x4b, 0x36, 0x23, 0x51, 0x51, 0xe5, 0x17,
+    0x13, 0x06, 0x01, 0x01, 0x06, 0x12, 0x16, 0x1c, 0x38, 0x12, 0x18, 0x44,
+    0x34, 0x2a, 0x06, 0x02, 0x01, 0x14, 0x31, 0x30, 0xf1, 0x24, 0x42, 0x61,
+    0x26, 0x27, 0x41, 0x23, 0x3f, 0x10, 0x17, 0x11, 0xe9, 0xba, 0x28, 0x58,
+    0x24, 0x00, 0x3b, 0x00, 0x45, 0xa4, 0x5b, 0x0c, 0x67, 0x0e, 0x02, 0xb7,
+    0x5d, 0x01, 0xc6, 0x03, 0x1f, 0x03, 0x8f, 0x02, 0x0e, 0xf1, 0x6a, 0xd9,
+    0x1e, 0x0c, 0x55, 0x0c, 0x17, 0x01, 0x40, 0xfe, 0x9f, 0x06, 0x2d, 0x27,
+    0x81, 0x55, 0xcb, 0xcb, 0xf6, 0xf6, 0x55, 0xfe, 0xe6, 0x01, 0x1a, 0xe4,
+    0x2b, 0x2f, 0x05, 0x79, 0x98, 0x74, 0xc9, 0x34, 0x89, 0x75, 0x33, 0x3f,
+    0x78, 0x80, 0x0d, 0x6a, 0x70, 0x33, 0x5a, 0x82, 0x9c, 0x35, 0x65, 0x45,
+    0x78, 0x26, 0x22, 0x2a, 0x16, 0x4a, 0x14, 0x2a, 0x21, 0x24, 0x02, 0xeb,
+    0x4a, 0x22, 0x0d, 0x23, 0x3c, 0x50, 0x0d, 0x67, 0x3e, 0x7f, 0x7f, 0x4f,
+    0x72, 0x52, 0x7a, 0x7a, 0x52, 0x72, 0x51, 0x42, 0x64, 0x0a, 0x50, 0xfd,
+    0xc6, 0x01, 0x0a, 0x55, 0xfe, 0x9f, 0x38, 0x2d, 0x06, 0x03, 0x0c, 0x5a,
+    0x09, 0x04, 0x06, 0x37, 0x3c, 0x7e, 0x3f, 0x03, 0x1a, 0x2c, 0x30, 0x3d,
+    0x25, 0x37, 0x2a, 0x3b, 0x32, 0x2c, 0x00, 0x04, 0x00, 0x19, 0xff, 0xe5,
+    0x90, 0x08, 0x14, 0x3a, 0x8c, 0x08, 0x21, 0x00, 0x17, 0xd4, 0x10, 0x12,
+    0x15, 0x78, 0x08, 0x0a, 0xb0, 0x00, 0x02, 0xc6, 0x30, 0x00, 0xc8, 0x00,
+    0x22, 0x17, 0x27, 0xd4, 0x12, 0x03, 0xb8, 0x3e, 0x02, 0xc7, 0x02, 0x07,
+    0xc6, 0x58, 0x04, 0x8c, 0x08, 0xf2, 0x84, 0x3c, 0x56, 0x25, 0x22, 0x3c,
+    0x15, 0xfe, 0x89, 0x65, 0x4c, 0x12, 0x33, 0x94, 0x3b, 0x3f, 0x58, 0x34,
+    0x4a, 0x7e, 0x87, 0x0d, 0x7e, 0x5e, 0x57, 0x4a, 0x6b, 0x9b, 0x3e, 0x2c,
+    0x36, 0x45, 0x7d, 0x6d, 0xc0, 0x2d, 0x43, 0x11, 0x0f, 0x0c, 0x01, 0xcc,
+    0x13, 0x2d, 0x24, 0x47, 0x2e, 0x66, 0x39, 0x2e, 0x34, 0x78, 0x79, 0x45,
+    0x27, 0xfe, 0x86, 0x24, 0x25, 0x2d, 0x16, 0x46, 0x14, 0x2b, 0x2b, 0x1d,
+    0x02, 0x98, 0xfe, 0xd2, 0x01, 0x2e, 0xfe, 0xd2, 0x01, 0x7c, 0x37, 0x14,
+    0x16, 0x26, 0x11, 0xe7, 0x1e, 0x20, 0x4f, 0x13, 0x2e, 0x0f, 0x12, 0x08,
+    0x04, 0x0c, 0x58, 0x08, 0x06, 0x07, 0x3a, 0x35, 0x3a, 0x49, 0x3b, 0x95,
+    0x01, 0x0a, 0x52, 0xfe, 0x9b, 0x2b, 0x1a, 0x37, 0x06, 0x14, 0x12, 0x02,
+    0x61, 0xfe, 0x7f, 0x0f, 0x3b, 0x1d, 0x2d, 0x1c, 0x46, 0x32, 0x40, 0x30,
+    0x55, 0x55, 0x24, 0x3b, 0x01, 0xb3, 0x26, 0x2f, 0x38, 0x25, 0x37, 0x22,
+    0x39, 0x3c, 0x1d, 0xfe, 0xdb, 0x52, 0x52, 0x9d, 0x50, 0x50, 0x24, 0x46,
+    0xbf, 0xe7, 0x03, 0x93, 0x03, 0x50, 0x00, 0x3b, 0x00, 0x53, 0x00, 0x5d,
+    0xe0, 0x5d, 0x05, 0x03, 0x23, 0x11, 0x06, 0x97, 0x29, 0x05, 0x82, 0x0c,
+    0x05, 0x27, 0x10, 0x0f, 0xd8, 0x01, 0x04, 0x09, 0x45, 0x28, 0xf3, 0x9e,
+    0x02, 0x30, 0x85, 0x1c, 0x13, 0x50, 0x43, 0x24, 0x50, 0x09, 0x13, 0x69,
+    0x4e, 0xd8, 0xd8, 0xfc, 0xb9, 0x0a, 0x11, 0x0a, 0x19, 0x1a, 0x15, 0x07,
+    0x02, 0x05, 0x02, 0x4a, 0x02, 0x06, 0x05, 0x18, 0x34, 0x33, 0x28, 0x22,
+    0x22, 0x1e, 0x5c, 0x02, 0x20, 0x29, 0x60, 0x37, 0x56, 0x1e, 0x1f, 0xa5,
+    0x87, 0x6b, 0xbd, 0x37, 0x8b, 0x6e, 0x32, 0x37, 0x79, 0x94, 0x0d, 0x5f,
+    0x7e, 0x53, 0x42, 0x71, 0xa1, 0x3b, 0x34, 0x33, 0x41, 0x6c, 0x1f, 0x2a,
+    0x30, 0x13, 0x43, 0x19, 0x26, 0x28, 0x20, 0x01, 0xf0, 0x84, 0x41, 0x24,
+    0x21, 0x77, 0x8a, 0x15, 0x24, 0x39, 0x91, 0x91, 0x4b, 0x84, 0x4d, 0xb3,
+    0x16, 0x11, 0x03, 0x01, 0x05, 0x0e, 0x12, 0x24, 0x39, 0x11, 0x2f, 0x2c,
+    0x28, 0x26, 0x0f, 0x04, 0x07, 0x2b, 0x2a, 0xc5, 0x02, 0x6a, 0x3d, 0x50,
+    0x3d, 0x40, 0x3a, 0x30, 0x31, 0x5b, 0x4d, 0xfe, 0xc7, 0x01, 0x03, 0x4e,
+    0xfe, 0xac, 0x37, 0x31, 0x07, 0x03, 0x0c, 0x54, 0x07, 0x03, 0x05, 0x36,
+    0x39, 0x3d, 0x46, 0x3c, 0x03, 0x16, 0x21, 0x32, 0x39, 0x20, 0x38, 0x26,
+    0x33, 0x35, 0x20, 0x00, 0x06, 0x00, 0x19, 0xff, 0xe8, 0x03, 0x94, 0x03,
+    0x3d, 0x00, 0x09, 0x00, 0x49, 0x96, 0x06, 0x18, 0x59, 0x9e, 0x04, 0x02,
+    0xe3, 0x00, 0x00, 0x8b, 0x68, 0x06, 0xea, 0x47, 0x00, 0x5b, 0x12, 0x07,
+    0x78, 0x06, 0x25, 0x3e, 0x02, 0x0f, 0x16, 0x0e, 0xc6, 0x04, 0x0b, 0x19,
+    0x25, 0xf0, 0x66, 0xbd, 0x1f, 0x20, 0x19, 0x4a, 0x12, 0x24, 0x28, 0x15,
+    0x44, 0x05, 0x68, 0xba, 0x24, 0x38, 0xca, 0x3f, 0x32, 0x28, 0x3e, 0x48,
+    0x47, 0x37, 0xfe, 0x7e, 0x02, 0x02, 0x6e, 0x51, 0x02, 0xc5, 0x0c, 0x22,
+    0x25, 0x26, 0x2b, 0x10, 0x1e, 0x18, 0x17, 0x12, 0x06, 0x92, 0x4f, 0x8f,
+    0x4c, 0x29, 0x67, 0x44, 0x31, 0x4a, 0x72, 0x8c, 0x0d, 0x8b, 0x62, 0x4f,
+    0x38, 0x74, 0xa0, 0x3f, 0x62, 0x45, 0x02, 0x09, 0x8f, 0x8f, 0x8f, 0x01,
+    0x70, 0x92, 0x92, 0x92, 0x03, 0x17, 0x33, 0x32, 0x2e, 0x2d, 0x29, 0x38,
+    0x3f, 0x1b, 0x2b, 0xfd, 0x74, 0x01, 0x0c, 0x51, 0xfe, 0x9d, 0x28, 0x19,
+    0x01, 0xfc, 0x2a, 0x19, 0x38, 0x1f, 0x2f, 0x25, 0x29, 0x47, 0x47, 0x4f,
+    0x2b, 0x01, 0xfe, 0x6d, 0x27, 0x28, 0x13, 0x05, 0x06, 0x02, 0x50, 0x03,
+    0xd0, 0x03, 0x90, 0x1e, 0x8b, 0x8b, 0x99, 0x12, 0x14, 0x06, 0x04, 0x0b,
+    0x7d, 0x49, 0xc1, 0x38, 0x38, 0x7f, 0x37, 0x01, 0x29, 0x48, 0x48, 0x8d,
+    0x4a, 0x4a, 0x8d, 0x06, 0x00, 0x41, 0x00, 0x07, 0x00, 0x31, 0x7c, 0x25,
+    0x11, 0x20, 0xe8, 0x25, 0x90, 0x1f, 0x00, 0x26, 0x00, 0x2a, 0x00, 0x33,
+    0x00, 0x57, 0xfa, 0x13, 0x04, 0x01, 0x23, 0x04, 0x59, 0x14, 0x06, 0x8a,
+    0x0e, 0x00, 0xae, 0x15, 0x01, 0x30, 0x12, 0x02, 0x5b, 0x25, 0x50, 0x16,
+    0x16, 0x33, 0x16, 0x36, 0xd1, 0x16, 0x01, 0x37, 0x09, 0x05, 0x44, 0x3e,
+    0x06, 0x64, 0x13, 0x10, 0x07, 0x91, 0x0f, 0x00, 0x53, 0x23, 0xf0, 0x20,
+    0xc4, 0x93, 0x01, 0xcd, 0x85, 0x74, 0xfe, 0x63, 0x01, 0x56, 0xfe, 0xf0,
+    0x01, 0x10, 0x23, 0x15, 0x1f, 0x19, 0x32, 0x10, 0x10, 0x2d, 0x21, 0x1a,
+    0x0b, 0x0e, 0x33, 0x9f, 0x31, 0x6f, 0x08, 0x0e, 0x08, 0x0f, 0x06, 0x33,
+    0xb5, 0x01, 0x3d, 0xe6, 0x08, 0x17, 0x1b, 0x21, 0x26, 0x14, 0x13, 0xfb,
+    0x11, 0xf0, 0x45, 0x02, 0x53, 0x01, 0x09, 0x06, 0x16, 0x2d, 0x2c, 0x32,
+    0x35, 0x33, 0x34, 0x14, 0xe4, 0xe9, 0x02, 0x6e, 0x64, 0x4e, 0x4e, 0x64,
+    0xfd, 0x90, 0x02, 0x70, 0xfd, 0xdf, 0x5b, 0x5b, 0xa7, 0x46, 0x03, 0x04,
+    0x1b, 0x1f, 0xa8, 0x17, 0x56, 0x36, 0x35, 0x35, 0x19, 0x3b, 0x81, 0x21,
+    0x2f, 0x53, 0x0b, 0xd0, 0x01, 0x1b, 0x64, 0x64, 0xe6, 0x0b, 0x01, 0x01,
+    0xa6, 0x8b, 0x01, 0x85, 0xfe, 0x85, 0xfe, 0xd4, 0x14, 0x12, 0x06, 0x01,
+    0x02, 0x01, 0x09, 0x16, 0x19, 0x27, 0x2a, 0x10, 0x06, 0x17, 0x2b, 0x41,
+    0x30, 0x31, 0x14, 0xe7, 0x40, 0xf2, 0x07, 0x12, 0x30, 0x30, 0x01, 0x90,
+    0xd7, 0x00, 0x05, 0x00, 0x21, 0xff, 0xdc, 0x03, 0x9c, 0x03, 0x3f, 0x00,
+    0x1e, 0x00, 0x28, 0x00, 0x32, 0xca, 0x0e, 0x0c, 0x72, 0x31, 0x00, 0x49,
+    0x14, 0x07, 0x69, 0x31, 0x03, 0x22, 0x19, 0x10, 0x04, 0xfe, 0x1e, 0x0e,
+    0x2b, 0x2b, 0x16, 0x16, 0x40, 0x19, 0xf1, 0x7d, 0xb2, 0x57, 0x01, 0x6b,
+    0xfe, 0xe8, 0x30, 0x49, 0x5d, 0x6a, 0x2f, 0x73, 0x56, 0x68, 0x33, 0x57,
+    0x17, 0x48, 0x2b, 0x5d, 0x7a, 0x30, 0x67, 0x6a, 0x42, 0x29, 0xfe, 0xeb,
+    0xab, 0xde, 0xd6, 0x8f, 0x19, 0xa2, 0xbc, 0xfe, 0xfa, 0x76, 0x13, 0x6e,
+    0x1a, 0x1f, 0x18, 0x24, 0x49, 0x19, 0x1e, 0x21, 0x19, 0x01, 0x4c, 0x19,
+    0x1b, 0x1b, 0x11, 0x4b, 0x0f, 0x1e, 0x1c, 0x15, 0xf9, 0x2a, 0x24, 0x1c,
+    0x4c, 0x19, 0x25, 0x2e, 0x24, 0x47, 0x01, 0x96, 0x5b, 0x5b, 0x52, 0x40,
+    0x3a, 0x4a, 0x2b, 0x4e, 0x38, 0x48, 0x59, 0x64, 0xfe, 0x98, 0x01, 0x5e,
+    0x2a, 0x57, 0x25, 0x51, 0x3d, 0x4d, 0x29, 0x58, 0x38, 0x38, 0x52, 0x01,
+    0x72, 0x10, 0x10, 0x17, 0x52, 0x17, 0x0f, 0x11, 0x01, 0x53, 0x62, 0x1e,
+    0x2d, 0x21, 0x3b, 0x30, 0x2b, 0x2e, 0x30, 0x20, 0x45, 0x21, 0x2f, 0x2b,
+    0x23, 0x2b, 0x21, 0x31, 0x30, 0x1c, 0x74, 0x3b, 0x33, 0x36, 0x2b, 0x2e,
+    0x38, 0x41, 0x29, 0x32, 0xdc, 0x12, 0x73, 0xf4, 0x03, 0x90, 0x03, 0x41,
+    0x00, 0x2d, 0x26, 0x55, 0x14, 0x3d, 0xdc, 0x1f, 0x05, 0xcb, 0x58, 0x01,
+    0xba, 0x00, 0x18, 0x23, 0x8e, 0x2e, 0x05, 0xde, 0x28, 0x00, 0xd4, 0x49,
+    0x1b, 0x05, 0xd5, 0x02, 0xf0, 0x0e, 0x01, 0xb6, 0xfe, 0x7a, 0x01, 0x86,
+    0x84, 0x56, 0x3a, 0x19, 0x0e, 0x1c, 0x3d, 0x91, 0xa2, 0xa5, 0x77, 0x19,
+    0x70, 0xbc, 0x06, 0x01, 0x86, 0xfe, 0x7a, 0x01, 0x22, 0xfe, 0xde, 0xb4,
+    0x19, 0xa0, 0x01, 0x79, 0xfc, 0xb8, 0x01, 0x7b, 0xfe, 0xc5, 0x01, 0x3b,
+    0x97, 0x63, 0xf4, 0x1b, 0xcd, 0xcd, 0xcd, 0x01, 0xee, 0xcd, 0xcd, 0xcd,
+    0x02, 0x28, 0x39, 0x42, 0x3b, 0x05, 0x01, 0x49, 0x01, 0x09, 0x07, 0x0f,
+    0x49, 0x0e, 0x08, 0x3f, 0x42, 0x39, 0xfe, 0xcb, 0x3d, 0x41, 0x3c, 0x45,
+    0x45, 0x3c, 0x41, 0x3d, 0x01, 0x35, 0xf4, 0x3a, 0x3a, 0x7a, 0x03, 0x00,
+    0x11, 0x00, 0x74, 0x36, 0x51, 0xeb, 0x03, 0x8c, 0x03, 0x35, 0x14, 0x55,
+    0x0b, 0x9a, 0x17, 0x01, 0x7c, 0x07, 0x01, 0x6e, 0x26, 0x04, 0xa3, 0x00,
+    0x06, 0x93, 0x29, 0x04, 0x81, 0x03, 0x04, 0x95, 0x05, 0x04, 0x10, 0x00,
+    0xf4, 0x16, 0x03, 0x2c, 0xfd, 0x63, 0x5f, 0x03, 0x5c, 0xfc, 0xa4, 0x0b,
     0x01, 0x7a, 0xfe, 0xc7, 0x01, 0x39, 0xfe, 0xdb, 0x02, 0x9c, 0xfe, 0xdd,
     0x01, 0x37, 0xfe, 0xc9, 0x01, 0x78, 0xfc, 0xba, 0x01, 0x7a, 0xcf, 0xcf,
-    0xcf, 0x01, 0xf0, 0xfe, 0x11, 0x01, 0xef, 0xfe, 0x11, 0x01, 0xef, 0xcd,
-    0xcd, 0xcd, 0x03, 0x35, 0xea, 0xea, 0xfe, 0xeb, 0x39, 0xfe, 0x42, 0x2d,
-    0x38, 0x31, 0xfd, 0xfd, 0x31, 0x38, 0x2d, 0x3e, 0x01, 0x0a, 0x30, 0x30,
-    0x65, 0x2e, 0x2e, 0x01, 0x24, 0x29, 0x29, 0x59, 0x27, 0x27, 0xfe, 0x1e,
-    0x30, 0x30, 0x65, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x5f,
-    0xff, 0xde, 0x03, 0x5d, 0x03, 0x5e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x29,
-    0x00, 0x3b, 0x00, 0x00, 0x13, 0x11, 0x23, 0x11, 0x37, 0x16, 0x17, 0x16,
-    0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x00, 0x37, 0x23, 0x35, 0x21, 0x35,
-    0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x14, 0x06, 0x07, 0x06, 0x23, 0x27,
-    0x16, 0x33, 0x3e, 0x02, 0x3d, 0x01, 0x06, 0x07, 0x27, 0x13, 0x21, 0x11,
-    0x14, 0x0e, 0x01, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33, 0x32, 0x3e, 0x01,
-    0x35, 0x11, 0x21, 0xb5, 0x56, 0x55, 0x27, 0x33, 0x27, 0x1a, 0x3f, 0x13,
-    0x35, 0x28, 0x24, 0x01, 0x08, 0x64, 0xfb, 0x01, 0x21, 0x54, 0x7c, 0x7c,
-    0x24, 0x34, 0x3a, 0x3e, 0x10, 0x26, 0x3b, 0x15, 0x11, 0x05, 0x6f, 0xa8,
-    0x34, 0xa3, 0x01, 0xf7, 0x11, 0x29, 0x26, 0x49, 0x32, 0x11, 0x1b, 0x31,
-    0x26, 0x1a, 0x08, 0xfe, 0x61, 0x02, 0xa3, 0xfd, 0x3b, 0x02, 0xc5, 0xbb,
-    0x1e, 0x32, 0x26, 0x1d, 0x41, 0x1a, 0x37, 0x29, 0x1f, 0xfe, 0x17, 0xa2,
-    0x4d, 0x73, 0x73, 0x4d, 0xfe, 0xba, 0x36, 0x2a, 0x06, 0x05, 0x56, 0x03,
-    0x01, 0x05, 0x11, 0x15, 0xe0, 0xa9, 0x6d, 0x48, 0x02, 0x5e, 0xfd, 0x3f,
-    0x2b, 0x2f, 0x17, 0x03, 0x06, 0x02, 0x5d, 0x03, 0x05, 0x12, 0x1b, 0x02,
-    0x5b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x5f, 0xff, 0xdb, 0x03, 0x5d,
-    0x03, 0x53, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x25, 0x00, 0x29,
-    0x00, 0x00, 0x12, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37,
-    0x07, 0x33, 0x11, 0x23, 0x13, 0x21, 0x11, 0x21, 0x13, 0x21, 0x11, 0x14,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x1e, 0x01, 0x37, 0x3e, 0x02,
-    0x35, 0x11, 0x21, 0x13, 0x35, 0x23, 0x15, 0xc1, 0x34, 0x1f, 0x2b, 0x3e,
+    0xcf, 0x01, 0xf0, 0x2e, 0x17, 0xf1, 0x16, 0xcd, 0xcd, 0xcd, 0x03, 0x35,
+    0xea, 0xea, 0xfe, 0xeb, 0x39, 0xfe, 0x42, 0x2d, 0x38, 0x31, 0xfd, 0xfd,
+    0x31, 0x38, 0x2d, 0x3e, 0x01, 0x0a, 0x30, 0x30, 0x65, 0x2e, 0x2e, 0x01,
+    0x24, 0x29, 0x29, 0x59, 0x27, 0x27, 0xfe, 0x1e, 0x0e, 0x00, 0x00, 0xec,
+    0x08, 0xd0, 0x5f, 0xff, 0xde, 0x03, 0x5d, 0x03, 0x5e, 0x00, 0x03, 0x00,
+    0x0d, 0x00, 0x29, 0xa8, 0x09, 0x10, 0x13, 0x0e, 0x27, 0x07, 0xec, 0x11,
+    0x00, 0x1c, 0x07, 0x0a, 0x76, 0x38, 0x03, 0x78, 0x3e, 0x2c, 0x13, 0x21,
+    0x38, 0x19, 0xf0, 0x5b, 0xb5, 0x56, 0x55, 0x27, 0x33, 0x27, 0x1a, 0x3f,
+    0x13, 0x35, 0x28, 0x24, 0x01, 0x08, 0x64, 0xfb, 0x01, 0x21, 0x54, 0x7c,
+    0x7c, 0x24, 0x34, 0x3a, 0x3e, 0x10, 0x26, 0x3b, 0x15, 0x11, 0x05, 0x6f,
+    0xa8, 0x34, 0xa3, 0x01, 0xf7, 0x11, 0x29, 0x26, 0x49, 0x32, 0x11, 0x1b,
+    0x31, 0x26, 0x1a, 0x08, 0xfe, 0x61, 0x02, 0xa3, 0xfd, 0x3b, 0x02, 0xc5,
+    0xbb, 0x1e, 0x32, 0x26, 0x1d, 0x41, 0x1a, 0x37, 0x29, 0x1f, 0xfe, 0x17,
+    0xa2, 0x4d, 0x73, 0x73, 0x4d, 0xfe, 0xba, 0x36, 0x2a, 0x06, 0x05, 0x56,
+    0x03, 0x01, 0x05, 0x11, 0x15, 0xe0, 0xa9, 0x6d, 0x48, 0x02, 0x5e, 0xfd,
+    0x3f, 0x2b, 0x2f, 0x17, 0x03, 0x06, 0x02, 0x5d, 0x03, 0x05, 0x12, 0x1b,
+    0x02, 0x5b, 0xb2, 0x12, 0xd2, 0x5f, 0xff, 0xdb, 0x03, 0x5d, 0x03, 0x53,
+    0x00, 0x09, 0x00, 0x0d, 0x00, 0x11, 0xb4, 0x60, 0x06, 0x0a, 0x05, 0x00,
+    0x44, 0x26, 0x00, 0x7e, 0x75, 0x01, 0xa5, 0x00, 0x03, 0xfe, 0x2e, 0x03,
+    0x10, 0x65, 0x00, 0xfe, 0x03, 0xf1, 0x33, 0xc1, 0x34, 0x1f, 0x2b, 0x3e,
     0x27, 0x21, 0x39, 0x16, 0x37, 0x42, 0x58, 0x58, 0xc7, 0x01, 0x71, 0xfe,
     0x8f, 0x35, 0x02, 0x02, 0x29, 0x36, 0x2d, 0x37, 0x1f, 0x0c, 0x11, 0x18,
     0x44, 0x19, 0x18, 0x14, 0x07, 0xfe, 0x55, 0xe8, 0xc9, 0x03, 0x3b, 0x2f,
     0x1c, 0x2d, 0x45, 0x2d, 0x20, 0x39, 0x12, 0x3d, 0xc5, 0xfd, 0x4d, 0x02,
     0x60, 0xfe, 0x74, 0x02, 0x64, 0xfd, 0x4d, 0x42, 0x35, 0x07, 0x05, 0x01,
-    0x5f, 0x02, 0x02, 0x01, 0x02, 0x08, 0x16, 0x19, 0x02, 0x4a, 0xfe, 0x43,
-    0xed, 0xed, 0x00, 0x00, 0x00, 0x02, 0x00, 0x63, 0xff, 0xcd, 0x03, 0xa0,
-    0x03, 0x47, 0x00, 0x18, 0x00, 0x33, 0x00, 0x00, 0x24, 0x36, 0x37, 0x36,
-    0x11, 0x35, 0x33, 0x07, 0x14, 0x07, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x27, 0x03, 0x21, 0x15,
-    0x06, 0x07, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x2f, 0x01, 0x16, 0x33,
-    0x32, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x36, 0x37, 0x23, 0x11, 0x23,
-    0x01, 0x6e, 0x67, 0x1f, 0x3a, 0x58, 0x01, 0x01, 0x09, 0x32, 0x41, 0xa0,
-    0x44, 0xa0, 0x42, 0x0c, 0x0e, 0x05, 0x0c, 0x1c, 0x72, 0x5c, 0x45, 0xbd,
-    0x01, 0x3e, 0x24, 0x2f, 0x59, 0x33, 0x3b, 0x25, 0x2f, 0x11, 0x1a, 0x14,
-    0x23, 0x20, 0x0d, 0x2f, 0x30, 0x31, 0x23, 0x90, 0x54, 0x52, 0x92, 0x52,
-    0x9a, 0x01, 0x03, 0x74, 0x84, 0x21, 0x10, 0xc7, 0x81, 0xa1, 0x94, 0x45,
-    0xa3, 0xad, 0x1f, 0x33, 0x15, 0x2a, 0x5e, 0xb1, 0x57, 0x42, 0x03, 0x0e,
-    0x54, 0x6e, 0x59, 0x6f, 0x67, 0x45, 0x43, 0x0b, 0x05, 0x02, 0x5a, 0x03,
-    0x09, 0x1d, 0x21, 0x28, 0x64, 0x33, 0x63, 0x73, 0xfd, 0x0b, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x52, 0xff, 0xd3, 0x03, 0x96, 0x03, 0x25, 0x00, 0x20,
-    0x00, 0x3e, 0x00, 0x42, 0x00, 0x46, 0x00, 0x00, 0x24, 0x36, 0x35, 0x11,
-    0x21, 0x11, 0x23, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x23, 0x11, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x27, 0x01, 0x21, 0x15, 0x06, 0x07, 0x1e, 0x01,
-    0x17, 0x14, 0x06, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x16, 0x37, 0x3e,
-    0x02, 0x35, 0x2e, 0x01, 0x27, 0x36, 0x37, 0x23, 0x11, 0x23, 0x01, 0x35,
-    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x01, 0x86, 0x0b, 0x01, 0xb6, 0xd6,
-    0x19, 0x23, 0x1f, 0x1b, 0x33, 0x23, 0x32, 0x2b, 0x2d, 0x20, 0x1e, 0x47,
-    0x76, 0x2f, 0x8f, 0x48, 0x48, 0x25, 0x41, 0x47, 0x4e, 0x14, 0x65, 0x96,
-    0x1b, 0xfe, 0xdd, 0x01, 0x17, 0x1c, 0x29, 0x23, 0x21, 0x01, 0x29, 0x36,
-    0x15, 0x17, 0x10, 0x06, 0x10, 0x25, 0x11, 0x14, 0x11, 0x07, 0x01, 0x21,
-    0x25, 0x2d, 0x1a, 0x7a, 0x4e, 0x02, 0xa5, 0xfe, 0xeb, 0x01, 0x15, 0xfe,
-    0xeb, 0x20, 0x15, 0x13, 0x02, 0xdd, 0xfe, 0x55, 0x4d, 0x38, 0x16, 0x16,
-    0x26, 0x22, 0x39, 0x2b, 0x20, 0x19, 0x14, 0x4e, 0x2f, 0x4c, 0x4a, 0x5c,
-    0x5b, 0x8a, 0xfe, 0xcd, 0x1a, 0x2b, 0x50, 0x32, 0x37, 0x45, 0x03, 0x0d,
-    0x4b, 0x73, 0x69, 0x3b, 0x69, 0x3a, 0x49, 0x3d, 0x06, 0x03, 0x01, 0x56,
-    0x04, 0x01, 0x02, 0x0b, 0x1c, 0x1f, 0x31, 0x5e, 0x35, 0x71, 0x74, 0xfd,
-    0x04, 0x01, 0xed, 0x63, 0x63, 0xae, 0x65, 0x65, 0x00, 0x05, 0x00, 0x5a,
-    0xff, 0xd6, 0x03, 0xa3, 0x03, 0x4e, 0x00, 0x26, 0x00, 0x42, 0x00, 0x4c,
-    0x00, 0x52, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x35, 0x23, 0x35, 0x06, 0x07,
-    0x27, 0x36, 0x37, 0x33, 0x1e, 0x01, 0x17, 0x07, 0x26, 0x27, 0x15, 0x23,
-    0x15, 0x33, 0x15, 0x23, 0x15, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x27,
-    0x16, 0x33, 0x3e, 0x02, 0x3d, 0x01, 0x23, 0x35, 0x01, 0x21, 0x15, 0x06,
-    0x07, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x27, 0x16,
-    0x33, 0x32, 0x3e, 0x01, 0x35, 0x34, 0x27, 0x36, 0x37, 0x23, 0x11, 0x23,
-    0x24, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x01, 0x27,
-    0x26, 0x27, 0x06, 0x07, 0x01, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x02, 0x3f, 0x7f, 0x24, 0x2e, 0x33, 0xaf, 0x5b, 0x4f, 0x2b,
-    0x8e, 0x56, 0x36, 0x34, 0x25, 0x84, 0xdf, 0xdf, 0x0f, 0x25, 0x23, 0x20,
-    0x3a, 0x12, 0x23, 0x22, 0x15, 0x12, 0x06, 0xcc, 0xfe, 0xe7, 0x01, 0x09,
-    0x1a, 0x2c, 0x25, 0x22, 0x14, 0x2d, 0x27, 0x16, 0x21, 0x10, 0x17, 0x0f,
-    0x1b, 0x18, 0x08, 0x45, 0x27, 0x1c, 0x6b, 0x4f, 0x01, 0x03, 0x1d, 0x28,
-    0x18, 0x48, 0x22, 0x23, 0x20, 0x36, 0x41, 0x01, 0xe0, 0x2b, 0x42, 0x2c,
-    0x3b, 0x5b, 0x01, 0x1d, 0x19, 0x3b, 0x30, 0x1b, 0x42, 0x10, 0x38, 0x2e,
-    0x24, 0x01, 0x80, 0x68, 0x39, 0x21, 0x23, 0x44, 0x80, 0xad, 0x51, 0x9c,
-    0x3d, 0x43, 0x26, 0x23, 0x42, 0x68, 0x53, 0xd4, 0x2a, 0x2d, 0x18, 0x05,
-    0x05, 0x59, 0x03, 0x01, 0x07, 0x15, 0x19, 0xc1, 0x53, 0x01, 0x96, 0x4f,
-    0x6b, 0x6f, 0x3d, 0x6a, 0x39, 0x34, 0x3d, 0x1e, 0x05, 0x03, 0x57, 0x03,
-    0x0b, 0x1f, 0x22, 0x66, 0x65, 0x6a, 0x7c, 0xfd, 0x0f, 0x97, 0x2e, 0x44,
-    0x36, 0x20, 0x46, 0x39, 0x37, 0x43, 0x2f, 0x02, 0x0c, 0x2d, 0x47, 0x49,
-    0x65, 0x58, 0xfe, 0xdc, 0x1a, 0x53, 0x46, 0x2d, 0x2e, 0x1f, 0x54, 0x44,
-    0x28, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x1e, 0xff, 0xd8, 0x03, 0x90,
-    0x03, 0x5a, 0x00, 0x1a, 0x00, 0x41, 0x00, 0x45, 0x00, 0x49, 0x00, 0x4d,
-    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x15, 0x21, 0x16, 0x17, 0x07,
-    0x26, 0x27, 0x26, 0x27, 0x15, 0x23, 0x35, 0x06, 0x07, 0x06, 0x07, 0x27,
-    0x3e, 0x01, 0x37, 0x21, 0x35, 0x12, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07,
-    0x33, 0x26, 0x27, 0x26, 0x27, 0x37, 0x1e, 0x01, 0x17, 0x16, 0x17, 0x21,
-    0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
-    0x15, 0x21, 0x15, 0x23, 0x11, 0x06, 0x07, 0x27, 0x05, 0x35, 0x23, 0x15,
-    0x37, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x01, 0xb4, 0x55, 0x01,
-    0x71, 0xfe, 0xe7, 0x68, 0xc7, 0x26, 0x77, 0x57, 0x59, 0x3a, 0x55, 0x39,
-    0x59, 0x62, 0x6d, 0x26, 0x63, 0x94, 0x34, 0xfe, 0xed, 0x1b, 0x3a, 0x31,
-    0x27, 0x4e, 0x13, 0x15, 0xdb, 0x03, 0x08, 0x0d, 0x0b, 0x4f, 0x04, 0x12,
-    0x06, 0x06, 0x08, 0x01, 0x10, 0xfe, 0xe3, 0x01, 0x05, 0xfe, 0xfb, 0x01,
-    0x05, 0xfe, 0xfb, 0x01, 0x2c, 0xfd, 0x91, 0x55, 0x1f, 0x2b, 0x3c, 0x01,
-    0xca, 0xef, 0xef, 0xef, 0xef, 0xef, 0x01, 0x07, 0x36, 0x36, 0x47, 0x59,
-    0x31, 0x4e, 0x26, 0x31, 0x2f, 0x4c, 0xe2, 0xe3, 0x51, 0x2f, 0x36, 0x21,
-    0x4c, 0x19, 0x46, 0x31, 0x47, 0x01, 0x75, 0x4e, 0x44, 0x4c, 0x21, 0x24,
-    0x23, 0x09, 0x12, 0x22, 0x16, 0x15, 0x08, 0x27, 0x11, 0x0e, 0x1a, 0x3d,
-    0x39, 0x3b, 0x38, 0x3b, 0x3b, 0x40, 0x25, 0x01, 0x22, 0x24, 0x28, 0x3d,
-    0xae, 0x3b, 0x3b, 0x76, 0x38, 0x38, 0x73, 0x39, 0x39, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x3c, 0xff, 0xfd, 0x03, 0x77, 0x03, 0x2b, 0x00, 0x10,
-    0x00, 0x14, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x20, 0x00, 0x24, 0x00, 0x00,
-    0x01, 0x36, 0x3f, 0x01, 0x21, 0x35, 0x21, 0x15, 0x21, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x11, 0x21, 0x11, 0x13, 0x11, 0x23, 0x11, 0x21, 0x35, 0x23,
-    0x15, 0x37, 0x35, 0x23, 0x15, 0x37, 0x35, 0x23, 0x15, 0x01, 0x11, 0x23,
-    0x11, 0x01, 0x7c, 0x01, 0x13, 0x10, 0xfe, 0x9c, 0x03, 0x3b, 0xfe, 0x8c,
-    0x06, 0x0e, 0x10, 0x01, 0x01, 0x6d, 0xfd, 0x1e, 0xc5, 0x72, 0x01, 0x77,
-    0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x01, 0x77, 0x73, 0x02, 0x74, 0x02, 0x34,
-    0x32, 0x4f, 0x4f, 0x15, 0x26, 0x2b, 0x02, 0xfd, 0x89, 0x02, 0x77, 0xfd,
-    0xd7, 0x01, 0xdb, 0xfe, 0x25, 0x73, 0x73, 0xc0, 0x62, 0x62, 0xb0, 0x6b,
-    0x6b, 0xfe, 0x90, 0x01, 0xdb, 0xfe, 0x25, 0x00, 0x00, 0x05, 0x00, 0x37,
-    0xff, 0xec, 0x03, 0x88, 0x03, 0x5d, 0x00, 0x03, 0x00, 0x21, 0x00, 0x25,
-    0x00, 0x29, 0x00, 0x34, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x27, 0x33,
-    0x26, 0x2f, 0x01, 0x37, 0x23, 0x35, 0x21, 0x2f, 0x01, 0x2e, 0x01, 0x27,
-    0x37, 0x16, 0x1f, 0x01, 0x21, 0x15, 0x23, 0x17, 0x0e, 0x01, 0x0f, 0x02,
-    0x33, 0x15, 0x21, 0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x13,
-    0x17, 0x16, 0x17, 0x07, 0x33, 0x36, 0x37, 0x36, 0x37, 0x21, 0x03, 0x20,
-    0xfd, 0x80, 0x69, 0xfb, 0x09, 0x15, 0x2a, 0x36, 0xbb, 0x01, 0x59, 0x06,
-    0x0b, 0x03, 0x07, 0x03, 0x55, 0x10, 0x08, 0x0b, 0x01, 0x42, 0xc4, 0x42,
-    0x06, 0x19, 0x07, 0x0c, 0x0b, 0xed, 0xfc, 0xaf, 0x02, 0x8e, 0xfe, 0x34,
-    0x01, 0xcc, 0xfe, 0x34, 0x62, 0x0e, 0x17, 0x05, 0x37, 0xe0, 0x1f, 0x0c,
-    0x14, 0x15, 0xfe, 0xba, 0x01, 0x94, 0xfe, 0x58, 0x01, 0xa8, 0x93, 0x11,
-    0x1c, 0x35, 0x25, 0x4d, 0x10, 0x1d, 0x09, 0x11, 0x09, 0x12, 0x24, 0x1d,
-    0x21, 0x4d, 0x22, 0x0d, 0x28, 0x0c, 0x13, 0x11, 0x4e, 0xfe, 0x62, 0x60,
-    0x60, 0xad, 0x5b, 0x5b, 0x01, 0x9d, 0x12, 0x1e, 0x09, 0x25, 0x2a, 0x14,
-    0x20, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1b, 0xff, 0xd3, 0x03, 0x97,
-    0x03, 0x52, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x00,
-    0x01, 0x15, 0x23, 0x07, 0x06, 0x07, 0x33, 0x11, 0x23, 0x11, 0x23, 0x11,
-    0x23, 0x11, 0x33, 0x36, 0x37, 0x36, 0x37, 0x23, 0x35, 0x00, 0x37, 0x36,
-    0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x27, 0x16, 0x36, 0x37, 0x23, 0x35,
-    0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x33, 0x15, 0x33, 0x15,
-    0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x37, 0x17, 0x0e, 0x02, 0x07,
-    0x27, 0x24, 0x36, 0x37, 0x36, 0x3d, 0x01, 0x33, 0x15, 0x14, 0x07, 0x16,
-    0x17, 0x16, 0x17, 0x07, 0x26, 0x2f, 0x02, 0x07, 0x0e, 0x01, 0x07, 0x27,
-    0x03, 0x82, 0xb9, 0x0b, 0x03, 0x0a, 0xab, 0x4e, 0xdd, 0x4e, 0x7d, 0x06,
-    0x06, 0x09, 0x02, 0xab, 0xfe, 0x6d, 0x1e, 0x12, 0x1e, 0x4b, 0x1c, 0x19,
-    0x22, 0x1d, 0x43, 0x65, 0x7d, 0x2c, 0x3b, 0xbd, 0x41, 0x49, 0x49, 0x4c,
-    0x6a, 0x6a, 0x7c, 0x90, 0x31, 0x1f, 0x4b, 0x25, 0x66, 0x8f, 0x68, 0x31,
-    0x01, 0xba, 0x65, 0x17, 0x1e, 0x4d, 0x0a, 0x31, 0x34, 0x51, 0x26, 0x37,
-    0x2d, 0x40, 0x1f, 0x34, 0x12, 0x1f, 0x66, 0x50, 0x31, 0x03, 0x24, 0x4d,
-    0x34, 0x0c, 0x21, 0xfe, 0x35, 0x01, 0x7d, 0xfe, 0x83, 0x01, 0xcb, 0x12,
-    0x1d, 0x21, 0x11, 0x4d, 0xfd, 0xc0, 0x41, 0x23, 0x4a, 0x1c, 0x47, 0x30,
-    0x45, 0x2a, 0x25, 0x71, 0x55, 0x34, 0xf7, 0x4e, 0xf2, 0xf2, 0x01, 0x40,
-    0x76, 0x4c, 0x7e, 0x4e, 0xde, 0x43, 0x60, 0x1d, 0x67, 0x92, 0x6f, 0x31,
-    0x46, 0x29, 0x4c, 0x2c, 0x37, 0x51, 0xbc, 0xc0, 0x3a, 0x2c, 0x23, 0x2c,
-    0x43, 0x27, 0x45, 0x30, 0x3a, 0x1b, 0x2d, 0x1d, 0x2a, 0x4b, 0x27, 0x48,
-    0x00, 0x06, 0x00, 0x21, 0xff, 0xed, 0x03, 0xa2, 0x03, 0x57, 0x00, 0x0c,
-    0x00, 0x3a, 0x00, 0x48, 0x00, 0x52, 0x00, 0x57, 0x00, 0x61, 0x00, 0x00,
-    0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x0f, 0x01, 0x06, 0x07, 0x06, 0x07,
-    0x27, 0x13, 0x21, 0x03, 0x3e, 0x01, 0x37, 0x33, 0x16, 0x17, 0x07, 0x26,
-    0x27, 0x15, 0x21, 0x35, 0x06, 0x07, 0x27, 0x07, 0x33, 0x14, 0x0f, 0x01,
-    0x0e, 0x01, 0x07, 0x06, 0x23, 0x27, 0x16, 0x33, 0x32, 0x3e, 0x01, 0x37,
-    0x36, 0x35, 0x36, 0x37, 0x23, 0x13, 0x17, 0x07, 0x33, 0x13, 0x23, 0x01,
-    0x21, 0x36, 0x37, 0x36, 0x37, 0x17, 0x06, 0x07, 0x06, 0x07, 0x33, 0x15,
-    0x21, 0x13, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x27, 0x25,
-    0x26, 0x27, 0x06, 0x07, 0x17, 0x16, 0x17, 0x16, 0x17, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x3b, 0x50, 0x46, 0x2c, 0x06, 0x17, 0x3f, 0x14, 0x1b, 0x0a,
-    0x3d, 0x09, 0x0d, 0x1b, 0x01, 0x17, 0x10, 0x5b, 0x83, 0x2d, 0x45, 0x55,
-    0xba, 0x31, 0x27, 0x27, 0xfe, 0x9a, 0x1d, 0x2a, 0x34, 0x05, 0x2a, 0x05,
-    0x07, 0x05, 0x2f, 0x3f, 0x30, 0x2b, 0x10, 0x1e, 0x25, 0x27, 0x1d, 0x0b,
-    0x03, 0x04, 0x02, 0x02, 0xc8, 0x17, 0x48, 0x12, 0x53, 0x13, 0xc9, 0x01,
-    0x2e, 0x01, 0x31, 0x1b, 0x1f, 0x23, 0x0e, 0x4d, 0x10, 0x24, 0x19, 0x1b,
-    0x90, 0xfd, 0xef, 0x65, 0x16, 0x15, 0x17, 0x0a, 0x47, 0x06, 0x18, 0x1a,
-    0x10, 0x01, 0x80, 0x64, 0x37, 0x38, 0x66, 0x98, 0x14, 0x11, 0x18, 0x04,
-    0x46, 0x0e, 0x0f, 0x17, 0x0e, 0xf2, 0x0d, 0x0d, 0x0b, 0x4e, 0x08, 0x0d,
-    0x04, 0x04, 0x01, 0x09, 0x01, 0x50, 0x02, 0x33, 0xfe, 0xf2, 0x46, 0x9e,
-    0x5d, 0xbc, 0x8c, 0x42, 0x1d, 0x24, 0x3b, 0x3c, 0x1b, 0x21, 0x3e, 0x59,
-    0x83, 0x5c, 0x7c, 0x36, 0x30, 0x06, 0x04, 0x50, 0x03, 0x07, 0x17, 0x20,
-    0x36, 0x27, 0x2a, 0x6e, 0x01, 0x48, 0x01, 0xfc, 0x01, 0x21, 0xfd, 0x7a,
-    0x41, 0x64, 0x70, 0x49, 0x12, 0x4f, 0x6d, 0x4d, 0x43, 0x51, 0x01, 0xae,
-    0x3b, 0x50, 0x50, 0x3f, 0x16, 0x2d, 0x60, 0x60, 0x2d, 0x8a, 0x61, 0x6b,
-    0x69, 0x63, 0x6b, 0x3b, 0x45, 0x5e, 0x26, 0x13, 0x4b, 0x39, 0x5c, 0x23,
-    0x00, 0x06, 0x00, 0x39, 0xff, 0xd8, 0x03, 0x87, 0x03, 0x58, 0x00, 0x0b,
-    0x00, 0x20, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x00,
-    0x01, 0x27, 0x26, 0x27, 0x37, 0x16, 0x1f, 0x01, 0x21, 0x15, 0x21, 0x35,
-    0x13, 0x21, 0x11, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x22, 0x2f, 0x01, 0x16,
-    0x37, 0x3e, 0x02, 0x3d, 0x01, 0x21, 0x11, 0x23, 0x13, 0x21, 0x15, 0x21,
-    0x25, 0x35, 0x21, 0x15, 0x17, 0x21, 0x15, 0x21, 0x25, 0x35, 0x23, 0x15,
-    0x01, 0xb9, 0x03, 0x14, 0x02, 0x58, 0x10, 0x08, 0x08, 0x01, 0x6f, 0xfc,
-    0xb2, 0x38, 0x02, 0xe1, 0x01, 0x25, 0x2f, 0x27, 0x29, 0x0d, 0x1a, 0x10,
-    0x2e, 0x29, 0x17, 0x13, 0x07, 0xfd, 0xc6, 0x53, 0x4c, 0x02, 0x46, 0xfd,
-    0xba, 0x01, 0xf1, 0xfe, 0x64, 0x0e, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x2d,
-    0xdb, 0x03, 0x01, 0x0e, 0x34, 0x05, 0x10, 0x23, 0x1c, 0x18, 0x45, 0x45,
-    0xfe, 0x8d, 0xfe, 0xbf, 0x32, 0x2d, 0x07, 0x07, 0x02, 0x51, 0x04, 0x01,
-    0x02, 0x07, 0x12, 0x15, 0xe9, 0xfe, 0x8f, 0x02, 0xad, 0xc0, 0x40, 0x3f,
-    0x3f, 0xf4, 0xca, 0x43, 0x44, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1e,
-    0xff, 0xf0, 0x02, 0x51, 0x03, 0x10, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
-    0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x02, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-    0xa2, 0x84, 0x84, 0x96, 0x94, 0x85, 0x85, 0x94, 0xb9, 0x51, 0x68, 0x66,
-    0x51, 0x51, 0x66, 0x68, 0x51, 0x10, 0xe0, 0xb0, 0xaf, 0xe1, 0xe1, 0xaf,
-    0xb0, 0xe0, 0x01, 0x0e, 0xb6, 0xb6, 0x82, 0x81, 0xb7, 0xb6, 0x82, 0x00,
-    0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x01, 0x22, 0x03, 0x00, 0x00, 0x0a,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x35, 0x3e, 0x02, 0x37, 0x33, 0x11, 0x23,
+    0x5f, 0x3f, 0x4f, 0xf0, 0x07, 0x16, 0x19, 0x02, 0x4a, 0xfe, 0x43, 0xed,
+    0xed, 0x00, 0x02, 0x00, 0x63, 0xff, 0xcd, 0x03, 0xa0, 0x03, 0x47, 0x00,
+    0x18, 0x00, 0x33, 0xec, 0x0a, 0x01, 0xa1, 0x14, 0x1e, 0x07, 0xa1, 0x14,
+    0x01, 0x00, 0x0d, 0x18, 0x15, 0x11, 0x10, 0x10, 0x34, 0xff, 0x40, 0x00,
+    0x28, 0x15, 0xf1, 0x52, 0x6e, 0x67, 0x1f, 0x3a, 0x58, 0x01, 0x01, 0x09,
+    0x32, 0x41, 0xa0, 0x44, 0xa0, 0x42, 0x0c, 0x0e, 0x05, 0x0c, 0x1c, 0x72,
+    0x5c, 0x45, 0xbd, 0x01, 0x3e, 0x24, 0x2f, 0x59, 0x33, 0x3b, 0x25, 0x2f,
+    0x11, 0x1a, 0x14, 0x23, 0x20, 0x0d, 0x2f, 0x30, 0x31, 0x23, 0x90, 0x54,
+    0x52, 0x92, 0x52, 0x9a, 0x01, 0x03, 0x74, 0x84, 0x21, 0x10, 0xc7, 0x81,
+    0xa1, 0x94, 0x45, 0xa3, 0xad, 0x1f, 0x33, 0x15, 0x2a, 0x5e, 0xb1, 0x57,
+    0x42, 0x03, 0x0e, 0x54, 0x6e, 0x59, 0x6f, 0x67, 0x45, 0x43, 0x0b, 0x05,
+    0x02, 0x5a, 0x03, 0x09, 0x1d, 0x21, 0x28, 0x64, 0x33, 0x63, 0x73, 0xfd,
+    0x0b, 0x00, 0x04, 0x00, 0x52, 0x26, 0x35, 0x51, 0x25, 0x00, 0x20, 0x00,
+    0x3e, 0x1c, 0x22, 0x21, 0x00, 0x24, 0x18, 0x08, 0x17, 0x23, 0x33, 0x30,
+    0x05, 0xad, 0x35, 0x03, 0x3e, 0x63, 0x21, 0x21, 0x15, 0x48, 0x28, 0x05,
+    0x42, 0x01, 0x00, 0x41, 0x01, 0x14, 0x26, 0xb0, 0x00, 0x04, 0xa4, 0x02,
+    0xf0, 0x61, 0x86, 0x0b, 0x01, 0xb6, 0xd6, 0x19, 0x23, 0x1f, 0x1b, 0x33,
+    0x23, 0x32, 0x2b, 0x2d, 0x20, 0x1e, 0x47, 0x76, 0x2f, 0x8f, 0x48, 0x48,
+    0x25, 0x41, 0x47, 0x4e, 0x14, 0x65, 0x96, 0x1b, 0xfe, 0xdd, 0x01, 0x17,
+    0x1c, 0x29, 0x23, 0x21, 0x01, 0x29, 0x36, 0x15, 0x17, 0x10, 0x06, 0x10,
+    0x25, 0x11, 0x14, 0x11, 0x07, 0x01, 0x21, 0x25, 0x2d, 0x1a, 0x7a, 0x4e,
+    0x02, 0xa5, 0xfe, 0xeb, 0x01, 0x15, 0xfe, 0xeb, 0x20, 0x15, 0x13, 0x02,
+    0xdd, 0xfe, 0x55, 0x4d, 0x38, 0x16, 0x16, 0x26, 0x22, 0x39, 0x2b, 0x20,
+    0x19, 0x14, 0x4e, 0x2f, 0x4c, 0x4a, 0x5c, 0x5b, 0x8a, 0xfe, 0xcd, 0x1a,
+    0x2b, 0x50, 0x32, 0x37, 0x45, 0x03, 0x0d, 0x4b, 0x73, 0x69, 0x3b, 0x69,
+    0x3a, 0x49, 0x3d, 0x06, 0x03, 0x01, 0xf8, 0x46, 0xf2, 0x16, 0x0b, 0x1c,
+    0x1f, 0x31, 0x5e, 0x35, 0x71, 0x74, 0xfd, 0x04, 0x01, 0xed, 0x63, 0x63,
+    0xae, 0x65, 0x65, 0x00, 0x05, 0x00, 0x5a, 0xff, 0xd6, 0x03, 0xa3, 0x03,
+    0x4e, 0x00, 0x26, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x52, 0x00, 0x5c, 0xae,
+    0x11, 0x01, 0x02, 0x05, 0x04, 0xb2, 0x0d, 0x08, 0x09, 0x24, 0x04, 0x0d,
+    0x07, 0x13, 0x35, 0xe7, 0x00, 0x0a, 0x20, 0x22, 0x12, 0x34, 0xe6, 0x00,
+    0x16, 0x24, 0x19, 0x05, 0x01, 0xc5, 0x01, 0x07, 0x2d, 0x4f, 0xf0, 0x5d,
+    0x3f, 0x7f, 0x24, 0x2e, 0x33, 0xaf, 0x5b, 0x4f, 0x2b, 0x8e, 0x56, 0x36,
+    0x34, 0x25, 0x84, 0xdf, 0xdf, 0x0f, 0x25, 0x23, 0x20, 0x3a, 0x12, 0x23,
+    0x22, 0x15, 0x12, 0x06, 0xcc, 0xfe, 0xe7, 0x01, 0x09, 0x1a, 0x2c, 0x25,
+    0x22, 0x14, 0x2d, 0x27, 0x16, 0x21, 0x10, 0x17, 0x0f, 0x1b, 0x18, 0x08,
+    0x45, 0x27, 0x1c, 0x6b, 0x4f, 0x01, 0x03, 0x1d, 0x28, 0x18, 0x48, 0x22,
+    0x23, 0x20, 0x36, 0x41, 0x01, 0xe0, 0x2b, 0x42, 0x2c, 0x3b, 0x5b, 0x01,
+    0x1d, 0x19, 0x3b, 0x30, 0x1b, 0x42, 0x10, 0x38, 0x2e, 0x24, 0x01, 0x80,
+    0x68, 0x39, 0x21, 0x23, 0x44, 0x80, 0xad, 0x51, 0x9c, 0x3d, 0x43, 0x26,
+    0x23, 0x42, 0x68, 0x53, 0xd4, 0x2a, 0x2d, 0x18, 0x05, 0x05, 0x59, 0x03,
+    0xb7, 0x15, 0xf2, 0x27, 0xc1, 0x53, 0x01, 0x96, 0x4f, 0x6b, 0x6f, 0x3d,
+    0x6a, 0x39, 0x34, 0x3d, 0x1e, 0x05, 0x03, 0x57, 0x03, 0x0b, 0x1f, 0x22,
+    0x66, 0x65, 0x6a, 0x7c, 0xfd, 0x0f, 0x97, 0x2e, 0x44, 0x36, 0x20, 0x46,
+    0x39, 0x37, 0x43, 0x2f, 0x02, 0x0c, 0x2d, 0x47, 0x49, 0x65, 0x58, 0xfe,
+    0xdc, 0x1a, 0x53, 0x46, 0x2d, 0x2e, 0x1f, 0x54, 0x44, 0x28, 0x1c, 0x26,
+    0x31, 0xd8, 0x03, 0x90, 0x78, 0x19, 0x11, 0x41, 0x48, 0x2a, 0x17, 0x4d,
+    0x2e, 0x06, 0x01, 0xcc, 0x00, 0x05, 0x2e, 0x40, 0x07, 0x2a, 0x06, 0x03,
+    0x36, 0x27, 0x03, 0x40, 0x18, 0x09, 0x02, 0x00, 0x03, 0xa8, 0x34, 0x06,
+    0x62, 0x19, 0xf0, 0x20, 0x01, 0xb4, 0x55, 0x01, 0x71, 0xfe, 0xe7, 0x68,
+    0xc7, 0x26, 0x77, 0x57, 0x59, 0x3a, 0x55, 0x39, 0x59, 0x62, 0x6d, 0x26,
+    0x63, 0x94, 0x34, 0xfe, 0xed, 0x1b, 0x3a, 0x31, 0x27, 0x4e, 0x13, 0x15,
+    0xdb, 0x03, 0x08, 0x0d, 0x0b, 0x4f, 0x04, 0x12, 0x06, 0x06, 0x08, 0x01,
+    0x10, 0xfe, 0xe3, 0x02, 0x4d, 0x01, 0x04, 0x00, 0xa0, 0x2c, 0xfd, 0x91,
+    0x55, 0x1f, 0x2b, 0x3c, 0x01, 0xca, 0xef, 0x01, 0x00, 0xf0, 0x30, 0x01,
+    0x07, 0x36, 0x36, 0x47, 0x59, 0x31, 0x4e, 0x26, 0x31, 0x2f, 0x4c, 0xe2,
+    0xe3, 0x51, 0x2f, 0x36, 0x21, 0x4c, 0x19, 0x46, 0x31, 0x47, 0x01, 0x75,
+    0x4e, 0x44, 0x4c, 0x21, 0x24, 0x23, 0x09, 0x12, 0x22, 0x16, 0x15, 0x08,
+    0x27, 0x11, 0x0e, 0x1a, 0x3d, 0x39, 0x3b, 0x38, 0x3b, 0x3b, 0x40, 0x25,
+    0x01, 0x22, 0x24, 0x28, 0x3d, 0xae, 0x3b, 0x3b, 0x76, 0x38, 0x38, 0x73,
+    0x39, 0x39, 0x9e, 0x10, 0x73, 0x3c, 0xff, 0xfd, 0x03, 0x77, 0x03, 0x2b,
+    0x6a, 0x1c, 0x11, 0x1c, 0xf0, 0x7e, 0x00, 0xf6, 0x0b, 0x11, 0x37, 0x67,
+    0x05, 0x04, 0x74, 0x1c, 0x11, 0x13, 0x10, 0x68, 0x07, 0xbf, 0x00, 0x00,
+    0x2d, 0x75, 0xf0, 0x08, 0x7c, 0x01, 0x13, 0x10, 0xfe, 0x9c, 0x03, 0x3b,
+    0xfe, 0x8c, 0x06, 0x0e, 0x10, 0x01, 0x01, 0x6d, 0xfd, 0x1e, 0xc5, 0x72,
+    0x01, 0x77, 0xb2, 0x01, 0x00, 0xf0, 0x13, 0x01, 0x77, 0x73, 0x02, 0x74,
+    0x02, 0x34, 0x32, 0x4f, 0x4f, 0x15, 0x26, 0x2b, 0x02, 0xfd, 0x89, 0x02,
+    0x77, 0xfd, 0xd7, 0x01, 0xdb, 0xfe, 0x25, 0x73, 0x73, 0xc0, 0x62, 0x62,
+    0xb0, 0x6b, 0x6b, 0xfe, 0x90, 0x0e, 0x00, 0x00, 0x6a, 0x01, 0x93, 0x37,
+    0xff, 0xec, 0x03, 0x88, 0x03, 0x5d, 0x00, 0x03, 0x84, 0x3a, 0x12, 0x34,
+    0x1c, 0x11, 0x10, 0x27, 0xa7, 0x33, 0x11, 0x37, 0x36, 0x53, 0x13, 0x26,
+    0xc7, 0x30, 0x00, 0xc0, 0x3f, 0x11, 0x06, 0xc8, 0x44, 0x04, 0x49, 0x03,
+    0x15, 0x13, 0x9c, 0x3f, 0xf0, 0x66, 0x21, 0x03, 0x20, 0xfd, 0x80, 0x69,
+    0xfb, 0x09, 0x15, 0x2a, 0x36, 0xbb, 0x01, 0x59, 0x06, 0x0b, 0x03, 0x07,
+    0x03, 0x55, 0x10, 0x08, 0x0b, 0x01, 0x42, 0xc4, 0x42, 0x06, 0x19, 0x07,
+    0x0c, 0x0b, 0xed, 0xfc, 0xaf, 0x02, 0x8e, 0xfe, 0x34, 0x01, 0xcc, 0xfe,
+    0x34, 0x62, 0x0e, 0x17, 0x05, 0x37, 0xe0, 0x1f, 0x0c, 0x14, 0x15, 0xfe,
+    0xba, 0x01, 0x94, 0xfe, 0x58, 0x01, 0xa8, 0x93, 0x11, 0x1c, 0x35, 0x25,
+    0x4d, 0x10, 0x1d, 0x09, 0x11, 0x09, 0x12, 0x24, 0x1d, 0x21, 0x4d, 0x22,
+    0x0d, 0x28, 0x0c, 0x13, 0x11, 0x4e, 0xfe, 0x62, 0x60, 0x60, 0xad, 0x5b,
+    0x5b, 0x01, 0x9d, 0x12, 0x1e, 0x09, 0x25, 0x2a, 0x14, 0x20, 0x29, 0x00,
+    0x04, 0x00, 0x1b, 0xff, 0xd3, 0x03, 0x97, 0x03, 0x52, 0x00, 0x14, 0x00,
+    0x1e, 0x00, 0x3d, 0x98, 0x1c, 0x12, 0x01, 0xbb, 0x10, 0x04, 0x08, 0x29,
+    0x02, 0x39, 0x1b, 0x06, 0x27, 0x33, 0x10, 0x16, 0x0f, 0x00, 0x03, 0xe6,
+    0x0e, 0x04, 0x90, 0x12, 0x02, 0xe3, 0x10, 0x22, 0x0e, 0x02, 0x4b, 0x13,
+    0x17, 0x35, 0x96, 0x19, 0x22, 0x2f, 0x02, 0xf3, 0x04, 0xf1, 0x92, 0x82,
+    0xb9, 0x0b, 0x03, 0x0a, 0xab, 0x4e, 0xdd, 0x4e, 0x7d, 0x06, 0x06, 0x09,
+    0x02, 0xab, 0xfe, 0x6d, 0x1e, 0x12, 0x1e, 0x4b, 0x1c, 0x19, 0x22, 0x1d,
+    0x43, 0x65, 0x7d, 0x2c, 0x3b, 0xbd, 0x41, 0x49, 0x49, 0x4c, 0x6a, 0x6a,
+    0x7c, 0x90, 0x31, 0x1f, 0x4b, 0x25, 0x66, 0x8f, 0x68, 0x31, 0x01, 0xba,
+    0x65, 0x17, 0x1e, 0x4d, 0x0a, 0x31, 0x34, 0x51, 0x26, 0x37, 0x2d, 0x40,
+    0x1f, 0x34, 0x12, 0x1f, 0x66, 0x50, 0x31, 0x03, 0x24, 0x4d, 0x34, 0x0c,
+    0x21, 0xfe, 0x35, 0x01, 0x7d, 0xfe, 0x83, 0x01, 0xcb, 0x12, 0x1d, 0x21,
+    0x11, 0x4d, 0xfd, 0xc0, 0x41, 0x23, 0x4a, 0x1c, 0x47, 0x30, 0x45, 0x2a,
+    0x25, 0x71, 0x55, 0x34, 0xf7, 0x4e, 0xf2, 0xf2, 0x01, 0x40, 0x76, 0x4c,
+    0x7e, 0x4e, 0xde, 0x43, 0x60, 0x1d, 0x67, 0x92, 0x6f, 0x31, 0x46, 0x29,
+    0x4c, 0x2c, 0x37, 0x51, 0xbc, 0xc0, 0x3a, 0x2c, 0x23, 0x2c, 0x43, 0x27,
+    0x45, 0x30, 0x3a, 0x1b, 0x2d, 0x1d, 0x2a, 0x4b, 0x27, 0x48, 0x00, 0x06,
+    0x00, 0x21, 0xff, 0xed, 0x03, 0xa2, 0x03, 0x57, 0x00, 0x0c, 0x00, 0x3a,
+    0x00, 0x48, 0x00, 0x52, 0x7a, 0x32, 0x14, 0x00, 0xea, 0x4a, 0x03, 0x54,
+    0x1d, 0x21, 0x03, 0x36, 0xe1, 0x6a, 0x05, 0xe7, 0x11, 0x4a, 0x07, 0x33,
+    0x14, 0x07, 0x41, 0x1c, 0x00, 0xff, 0x4f, 0x01, 0x1c, 0x2e, 0x36, 0x23,
+    0x01, 0x21, 0x49, 0x4d, 0x27, 0x15, 0x21, 0xed, 0x19, 0x01, 0xd5, 0x11,
+    0x05, 0x0f, 0x00, 0xf0, 0x1f, 0x3b, 0x50, 0x46, 0x2c, 0x06, 0x17, 0x3f,
+    0x14, 0x1b, 0x0a, 0x3d, 0x09, 0x0d, 0x1b, 0x01, 0x17, 0x10, 0x5b, 0x83,
+    0x2d, 0x45, 0x55, 0xba, 0x31, 0x27, 0x27, 0xfe, 0x9a, 0x1d, 0x2a, 0x34,
+    0x05, 0x2a, 0x05, 0x07, 0x05, 0x2f, 0x3f, 0x30, 0x2b, 0x10, 0x1e, 0x25,
+    0x27, 0x1d, 0x0b, 0x47, 0x0a, 0xf1, 0x87, 0xc8, 0x17, 0x48, 0x12, 0x53,
+    0x13, 0xc9, 0x01, 0x2e, 0x01, 0x31, 0x1b, 0x1f, 0x23, 0x0e, 0x4d, 0x10,
+    0x24, 0x19, 0x1b, 0x90, 0xfd, 0xef, 0x65, 0x16, 0x15, 0x17, 0x0a, 0x47,
+    0x06, 0x18, 0x1a, 0x10, 0x01, 0x80, 0x64, 0x37, 0x38, 0x66, 0x98, 0x14,
+    0x11, 0x18, 0x04, 0x46, 0x0e, 0x0f, 0x17, 0x0e, 0xf2, 0x0d, 0x0d, 0x0b,
+    0x4e, 0x08, 0x0d, 0x04, 0x04, 0x01, 0x09, 0x01, 0x50, 0x02, 0x33, 0xfe,
+    0xf2, 0x46, 0x9e, 0x5d, 0xbc, 0x8c, 0x42, 0x1d, 0x24, 0x3b, 0x3c, 0x1b,
+    0x21, 0x3e, 0x59, 0x83, 0x5c, 0x7c, 0x36, 0x30, 0x06, 0x04, 0x50, 0x03,
+    0x07, 0x17, 0x20, 0x36, 0x27, 0x2a, 0x6e, 0x01, 0x48, 0x01, 0xfc, 0x01,
+    0x21, 0xfd, 0x7a, 0x41, 0x64, 0x70, 0x49, 0x12, 0x4f, 0x6d, 0x4d, 0x43,
+    0x51, 0x01, 0xae, 0x3b, 0x50, 0x50, 0x3f, 0x16, 0x2d, 0x60, 0x60, 0x2d,
+    0x8a, 0x61, 0x6b, 0x69, 0x63, 0x6b, 0x3b, 0x45, 0x5e, 0x26, 0x13, 0x4b,
+    0x39, 0x5c, 0x23, 0x00, 0x06, 0x00, 0x39, 0xff, 0xd8, 0x03, 0x87, 0x03,
+    0x58, 0x80, 0x2b, 0x05, 0xf8, 0x31, 0x15, 0x01, 0x99, 0x33, 0x00, 0x62,
+    0x20, 0x28, 0x11, 0x06, 0x2c, 0x06, 0x00, 0x21, 0x7b, 0x00, 0x76, 0x20,
+    0x00, 0xdf, 0x02, 0x00, 0x21, 0x00, 0x01, 0xe9, 0x51, 0xf3, 0x58, 0xb9,
+    0x03, 0x14, 0x02, 0x58, 0x10, 0x08, 0x08, 0x01, 0x6f, 0xfc, 0xb2, 0x38,
+    0x02, 0xe1, 0x01, 0x25, 0x2f, 0x27, 0x29, 0x0d, 0x1a, 0x10, 0x2e, 0x29,
+    0x17, 0x13, 0x07, 0xfd, 0xc6, 0x53, 0x4c, 0x02, 0x46, 0xfd, 0xba, 0x01,
+    0xf1, 0xfe, 0x64, 0x0e, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x2d, 0xdb, 0x03,
+    0x01, 0x0e, 0x34, 0x05, 0x10, 0x23, 0x1c, 0x18, 0x45, 0x45, 0xfe, 0x8d,
+    0xfe, 0xbf, 0x32, 0x2d, 0x07, 0x07, 0x02, 0x51, 0x04, 0x01, 0x02, 0x07,
+    0x12, 0x15, 0xe9, 0xfe, 0x8f, 0x02, 0xad, 0xc0, 0x40, 0x3f, 0x3f, 0xf4,
+    0xca, 0x43, 0x44, 0x44, 0x00, 0x02, 0x00, 0x1e, 0xff, 0xf0, 0x02, 0x51,
+    0x03, 0x10, 0x00, 0x0b, 0x00, 0x17, 0xe2, 0x76, 0x03, 0x8f, 0x73, 0x08,
+    0x85, 0x74, 0xf0, 0x17, 0xa2, 0x84, 0x84, 0x96, 0x94, 0x85, 0x85, 0x94,
+    0xb9, 0x51, 0x68, 0x66, 0x51, 0x51, 0x66, 0x68, 0x51, 0x10, 0xe0, 0xb0,
+    0xaf, 0xe1, 0xe1, 0xaf, 0xb0, 0xe0, 0x01, 0x0e, 0xb6, 0xb6, 0x82, 0x81,
+    0xb7, 0xb6, 0x82, 0x00, 0x00, 0x01, 0x42, 0x00, 0x23, 0x01, 0x22, 0x94,
+    0x73, 0xf0, 0x0c, 0x06, 0x07, 0x35, 0x3e, 0x02, 0x37, 0x33, 0x11, 0x23,
     0xc2, 0x42, 0x69, 0x28, 0x48, 0x35, 0x0c, 0x5a, 0x60, 0x02, 0x60, 0x43,
-    0x09, 0x55, 0x06, 0x26, 0x40, 0x2b, 0xfd, 0x00, 0x00, 0x01, 0x00, 0x21,
-    0x00, 0x00, 0x02, 0x30, 0x03, 0x10, 0x00, 0x22, 0x00, 0x00, 0x37, 0x34,
-    0x3e, 0x01, 0x37, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x27,
-    0x3e, 0x02, 0x33, 0x32, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x01, 0x0f, 0x01,
-    0x0e, 0x02, 0x07, 0x21, 0x15, 0x21, 0x21, 0x35, 0x60, 0x4d, 0x4c, 0x4b,
-    0x2a, 0x50, 0x49, 0x92, 0x17, 0x60, 0x08, 0x3f, 0x72, 0x50, 0x4f, 0x71,
-    0x39, 0x3e, 0x5f, 0x4f, 0x03, 0x41, 0x45, 0x2a, 0x03, 0x01, 0xae, 0xfd,
-    0xf1, 0x30, 0x52, 0x70, 0x4a, 0x29, 0x26, 0x32, 0x42, 0x32, 0x41, 0x48,
-    0x97, 0x11, 0x3b, 0x64, 0x3d, 0x3b, 0x64, 0x3f, 0x49, 0x64, 0x42, 0x2b,
-    0x01, 0x22, 0x30, 0x3f, 0x2e, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14,
-    0xff, 0xf0, 0x02, 0x23, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x16, 0x26,
-    0x27, 0x37, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x07, 0x27, 0x37, 0x21, 0x35, 0x21, 0x15, 0x07, 0x32, 0x16, 0x15,
-    0x14, 0x0e, 0x01, 0x23, 0xa6, 0x83, 0x0f, 0x5f, 0x06, 0x57, 0x4b, 0x51,
-    0x55, 0x4c, 0x51, 0x22, 0x36, 0x0e, 0x2d, 0xf9, 0xfe, 0xa3, 0x01, 0xd1,
-    0xcd, 0x6f, 0x83, 0x39, 0x77, 0x58, 0x10, 0x79, 0x65, 0x0f, 0x44, 0x53,
-    0x5f, 0x4a, 0x49, 0x53, 0x10, 0x0d, 0x3d, 0xfe, 0x57, 0x54, 0xd2, 0x7a,
-    0x70, 0x41, 0x75, 0x4a, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x02, 0x55,
-    0x03, 0x00, 0x00, 0x12, 0x00, 0x00, 0x25, 0x21, 0x35, 0x36, 0x12, 0x37,
-    0x33, 0x06, 0x02, 0x07, 0x21, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15,
-    0x23, 0x01, 0x8b, 0xfe, 0x90, 0x4b, 0x98, 0x1e, 0x65, 0x1e, 0x95, 0x4f,
-    0x01, 0x0c, 0x5e, 0x6c, 0x6c, 0x5e, 0xc2, 0x69, 0x5b, 0x01, 0x0e, 0x6c,
-    0x73, 0xfe, 0xed, 0x63, 0xff, 0xff, 0x55, 0xc2, 0x00, 0x01, 0x00, 0x16,
-    0xff, 0xf0, 0x02, 0x27, 0x03, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x16, 0x26,
-    0x27, 0x37, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-    0x06, 0x07, 0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x3e, 0x01, 0x33, 0x32,
-    0x16, 0x15, 0x14, 0x0e, 0x01, 0x23, 0xaf, 0x89, 0x10, 0x62, 0x07, 0x56,
-    0x4c, 0x50, 0x55, 0x4f, 0x4f, 0x2f, 0x56, 0x1a, 0x59, 0x2d, 0x01, 0xa5,
-    0xfe, 0xac, 0x19, 0x1a, 0x54, 0x38, 0x6f, 0x7d, 0x3f, 0x76, 0x51, 0x10,
-    0x74, 0x6a, 0x0f, 0x42, 0x55, 0x5d, 0x50, 0x4e, 0x54, 0x25, 0x22, 0x0c,
-    0x01, 0xa6, 0x57, 0xff, 0x1b, 0x22, 0x83, 0x70, 0x4c, 0x76, 0x42, 0x00,
-    0x00, 0x02, 0x00, 0x20, 0xff, 0xf0, 0x02, 0x40, 0x03, 0x10, 0x00, 0x18,
-    0x00, 0x25, 0x00, 0x00, 0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
-    0x17, 0x07, 0x2e, 0x01, 0x23, 0x22, 0x03, 0x3e, 0x01, 0x33, 0x32, 0x16,
-    0x15, 0x14, 0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
-    0x26, 0x23, 0x22, 0x0e, 0x01, 0x15, 0xb2, 0x92, 0x8c, 0x97, 0x60, 0x79,
-    0x17, 0x5b, 0x0e, 0x4a, 0x40, 0xc0, 0x03, 0x1d, 0x6f, 0x46, 0x76, 0x7b,
-    0x3b, 0x75, 0x55, 0xab, 0x5a, 0x4e, 0x51, 0x57, 0x52, 0x4f, 0x31, 0x50,
-    0x2e, 0x10, 0xc3, 0xbb, 0xbd, 0xe5, 0x59, 0x51, 0x17, 0x30, 0x3b, 0xfe,
-    0xc6, 0x36, 0x3f, 0x8d, 0x72, 0x48, 0x77, 0x47, 0xb7, 0x61, 0x5d, 0x52,
-    0x50, 0x5a, 0x2c, 0x4e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09,
-    0x00, 0x00, 0x01, 0xfd, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x33, 0x36,
-    0x12, 0x37, 0x21, 0x35, 0x21, 0x15, 0x06, 0x02, 0x07, 0x61, 0x15, 0xa5,
+    0x09, 0x55, 0x06, 0x26, 0x40, 0x2b, 0x82, 0x7b, 0x00, 0x46, 0x51, 0x40,
+    0x02, 0x30, 0x03, 0x10, 0x12, 0x2d, 0x40, 0x37, 0x34, 0x36, 0x36, 0xfc,
+    0x00, 0x00, 0x6c, 0x00, 0x44, 0x07, 0x27, 0x3e, 0x02, 0x73, 0x72, 0x40,
+    0x07, 0x07, 0x0e, 0x02, 0x7b, 0x10, 0xf1, 0x2d, 0x21, 0x35, 0x60, 0x4d,
+    0x4c, 0x4b, 0x2a, 0x50, 0x49, 0x92, 0x17, 0x60, 0x08, 0x3f, 0x72, 0x50,
+    0x4f, 0x71, 0x39, 0x3e, 0x5f, 0x4f, 0x03, 0x41, 0x45, 0x2a, 0x03, 0x01,
+    0xae, 0xfd, 0xf1, 0x30, 0x52, 0x70, 0x4a, 0x29, 0x26, 0x32, 0x42, 0x32,
+    0x41, 0x48, 0x97, 0x11, 0x3b, 0x64, 0x3d, 0x3b, 0x64, 0x3f, 0x49, 0x64,
+    0x42, 0x2b, 0x01, 0x22, 0x30, 0x3f, 0x2e, 0x58, 0xba, 0x4e, 0x7a, 0xf0,
+    0x02, 0x23, 0x03, 0x00, 0x00, 0x1d, 0xd8, 0x71, 0x01, 0xc2, 0x77, 0x01,
+    0xe6, 0x04, 0x22, 0x07, 0x32, 0xe2, 0x72, 0xf0, 0x23, 0xa6, 0x83, 0x0f,
+    0x5f, 0x06, 0x57, 0x4b, 0x51, 0x55, 0x4c, 0x51, 0x22, 0x36, 0x0e, 0x2d,
+    0xf9, 0xfe, 0xa3, 0x01, 0xd1, 0xcd, 0x6f, 0x83, 0x39, 0x77, 0x58, 0x10,
+    0x79, 0x65, 0x0f, 0x44, 0x53, 0x5f, 0x4a, 0x49, 0x53, 0x10, 0x0d, 0x3d,
+    0xfe, 0x57, 0x54, 0xd2, 0x7a, 0x70, 0x41, 0x75, 0x4a, 0x00, 0x01, 0x38,
+    0x1e, 0x21, 0x02, 0x55, 0xda, 0x76, 0xc4, 0x00, 0x25, 0x21, 0x35, 0x36,
+    0x12, 0x37, 0x33, 0x06, 0x02, 0x07, 0x21, 0x2d, 0x21, 0xf0, 0x10, 0x01,
+    0x8b, 0xfe, 0x90, 0x4b, 0x98, 0x1e, 0x65, 0x1e, 0x95, 0x4f, 0x01, 0x0c,
+    0x5e, 0x6c, 0x6c, 0x5e, 0xc2, 0x69, 0x5b, 0x01, 0x0e, 0x6c, 0x73, 0xfe,
+    0xed, 0x63, 0xff, 0xff, 0x55, 0xc2, 0xa2, 0x70, 0x21, 0xff, 0xf0, 0xd2,
+    0x77, 0x1e, 0x1f, 0x9c, 0x00, 0x01, 0xd0, 0x58, 0x12, 0x07, 0x21, 0x74,
+    0x00, 0x9e, 0x00, 0xf0, 0x26, 0xaf, 0x89, 0x10, 0x62, 0x07, 0x56, 0x4c,
+    0x50, 0x55, 0x4f, 0x4f, 0x2f, 0x56, 0x1a, 0x59, 0x2d, 0x01, 0xa5, 0xfe,
+    0xac, 0x19, 0x1a, 0x54, 0x38, 0x6f, 0x7d, 0x3f, 0x76, 0x51, 0x10, 0x74,
+    0x6a, 0x0f, 0x42, 0x55, 0x5d, 0x50, 0x4e, 0x54, 0x25, 0x22, 0x0c, 0x01,
+    0xa6, 0x57, 0xff, 0x1b, 0x22, 0x83, 0x70, 0x4c, 0x76, 0x42, 0x02, 0x39,
+    0xb6, 0x20, 0xff, 0xf0, 0x02, 0x40, 0x03, 0x10, 0x00, 0x18, 0x00, 0x25,
+    0xe2, 0x01, 0x02, 0xcb, 0x72, 0x16, 0x03, 0x5f, 0x00, 0x07, 0x33, 0x74,
+    0xf0, 0x2d, 0x06, 0x15, 0xb2, 0x92, 0x8c, 0x97, 0x60, 0x79, 0x17, 0x5b,
+    0x0e, 0x4a, 0x40, 0xc0, 0x03, 0x1d, 0x6f, 0x46, 0x76, 0x7b, 0x3b, 0x75,
+    0x55, 0xab, 0x5a, 0x4e, 0x51, 0x57, 0x52, 0x4f, 0x31, 0x50, 0x2e, 0x10,
+    0xc3, 0xbb, 0xbd, 0xe5, 0x59, 0x51, 0x17, 0x30, 0x3b, 0xfe, 0xc6, 0x36,
+    0x3f, 0x8d, 0x72, 0x48, 0x77, 0x47, 0xb7, 0x61, 0x5d, 0x52, 0x50, 0x5a,
+    0x2c, 0x4e, 0xdf, 0x02, 0x01, 0x2e, 0x7e, 0x12, 0xfd, 0x08, 0x02, 0x32,
+    0x33, 0x36, 0x12, 0x53, 0x0f, 0xf1, 0x08, 0x02, 0x07, 0x61, 0x15, 0xa5,
     0x70, 0xfe, 0x7e, 0x01, 0xf4, 0x74, 0xaa, 0x16, 0xb9, 0x01, 0x74, 0x7c,
-    0x57, 0x56, 0x79, 0xfe, 0x94, 0xc5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x21,
-    0xff, 0xf1, 0x02, 0x3f, 0x03, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x33,
-    0x00, 0x00, 0x16, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x35,
-    0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x1e,
-    0x01, 0x15, 0x14, 0x0e, 0x01, 0x23, 0x26, 0x16, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x12, 0x16, 0x33, 0x32, 0x36, 0x35,
-    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0xdb, 0x7b, 0x3f, 0x4a, 0x43, 0x34,
-    0x3b, 0x3b, 0x6e, 0x48, 0x49, 0x6e, 0x3b, 0x3b, 0x34, 0x43, 0x49, 0x3e,
-    0x7b, 0x56, 0xb0, 0x5f, 0x52, 0x52, 0x5d, 0x5e, 0x52, 0x52, 0x5e, 0x1f,
-    0x4d, 0x44, 0x45, 0x4e, 0x4f, 0x44, 0x44, 0x4d, 0x0f, 0x3b, 0x67, 0x41,
-    0x48, 0x6a, 0x1a, 0x19, 0x55, 0x39, 0x3b, 0x5b, 0x32, 0x32, 0x5b, 0x3b,
-    0x39, 0x55, 0x19, 0x1a, 0x69, 0x49, 0x41, 0x67, 0x3b, 0xa6, 0x50, 0x4f,
-    0x45, 0x46, 0x52, 0x52, 0x46, 0x01, 0x2d, 0x42, 0x42, 0x3b, 0x38, 0x40,
-    0x40, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x15, 0xff, 0xf0, 0x02, 0x36,
-    0x03, 0x0f, 0x00, 0x19, 0x00, 0x26, 0x00, 0x00, 0x16, 0x26, 0x27, 0x37,
-    0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x35,
-    0x34, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x02, 0x16,
-    0x33, 0x32, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0xb6,
+    0x57, 0x56, 0x79, 0xfe, 0x94, 0xc5, 0x72, 0x28, 0x40, 0xf1, 0x02, 0x3f,
+    0x03, 0xc8, 0x74, 0x34, 0x27, 0x00, 0x33, 0xcc, 0x74, 0x1a, 0x37, 0x0c,
+    0x7c, 0x1e, 0x16, 0xd8, 0x74, 0x08, 0x8b, 0x74, 0xf1, 0x41, 0xdb, 0x7b,
+    0x3f, 0x4a, 0x43, 0x34, 0x3b, 0x3b, 0x6e, 0x48, 0x49, 0x6e, 0x3b, 0x3b,
+    0x34, 0x43, 0x49, 0x3e, 0x7b, 0x56, 0xb0, 0x5f, 0x52, 0x52, 0x5d, 0x5e,
+    0x52, 0x52, 0x5e, 0x1f, 0x4d, 0x44, 0x45, 0x4e, 0x4f, 0x44, 0x44, 0x4d,
+    0x0f, 0x3b, 0x67, 0x41, 0x48, 0x6a, 0x1a, 0x19, 0x55, 0x39, 0x3b, 0x5b,
+    0x32, 0x32, 0x5b, 0x3b, 0x39, 0x55, 0x19, 0x1a, 0x69, 0x49, 0x41, 0x67,
+    0x3b, 0xa6, 0x50, 0x4f, 0x45, 0x46, 0x52, 0x52, 0x46, 0x01, 0x2d, 0x42,
+    0x42, 0x3b, 0x38, 0x40, 0x40, 0x38, 0x22, 0x3f, 0x97, 0xf0, 0x02, 0x36,
+    0x03, 0x0f, 0x00, 0x19, 0x00, 0x26, 0x9c, 0x01, 0x11, 0x37, 0xb3, 0x74,
+    0x03, 0x9a, 0x00, 0x05, 0x26, 0x03, 0x04, 0x87, 0x00, 0xf1, 0x08, 0xb6,
     0x7f, 0x17, 0x5d, 0x0e, 0x4e, 0x40, 0x5e, 0x60, 0x01, 0x1d, 0x6d, 0x48,
-    0x75, 0x7c, 0x3c, 0x76, 0x53, 0x88, 0x94, 0x88, 0x97, 0xa2, 0x52, 0x4f,
-    0x31, 0x50, 0x2e, 0x5a, 0x4e, 0x4e, 0x5a, 0x10, 0x5b, 0x50, 0x1a, 0x31,
-    0x3e, 0x9c, 0x9e, 0x35, 0x40, 0x8d, 0x71, 0x48, 0x77, 0x47, 0xc1, 0xbb,
-    0xbf, 0xe4, 0x01, 0xca, 0x58, 0x2b, 0x4e, 0x30, 0x4e, 0x60, 0x5e, 0x51,
-    0x00, 0x01, 0x00, 0x20, 0xff, 0xf6, 0x00, 0xa5, 0x00, 0x7a, 0x00, 0x0b,
-    0x00, 0x00, 0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-    0x06, 0x23, 0x46, 0x26, 0x25, 0x1d, 0x1e, 0x25, 0x26, 0x1d, 0x0a, 0x26,
-    0x1c, 0x1e, 0x24, 0x24, 0x1e, 0x1c, 0x26, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0xff, 0x77, 0x00, 0xad, 0x00, 0x7a, 0x00, 0x10, 0x00, 0x00, 0x17, 0x36,
-    0x37, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-    0x14, 0x06, 0x07, 0x2a, 0x40, 0x0a, 0x08, 0x0a, 0x1c, 0x26, 0x24, 0x1d,
-    0x26, 0x26, 0x49, 0x3a, 0x58, 0x04, 0x4e, 0x04, 0x26, 0x1c, 0x1d, 0x25,
-    0x34, 0x27, 0x4f, 0x56, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2f,
-    0xff, 0xf6, 0x00, 0xb4, 0x02, 0x13, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x00,
-    0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-    0x02, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35,
-    0x55, 0x26, 0x25, 0x1e, 0x1d, 0x25, 0x26, 0x1c, 0x43, 0x25, 0x1e, 0x1d,
-    0x25, 0x26, 0x1c, 0x1d, 0x26, 0x0a, 0x26, 0x1c, 0x1e, 0x24, 0x24, 0x1e,
-    0x1c, 0x26, 0x01, 0xf9, 0x24, 0x24, 0x1e, 0x1c, 0x26, 0x26, 0x1c, 0x00,
-    0x00, 0x02, 0x00, 0x0a, 0xff, 0xf6, 0x01, 0xe4, 0x03, 0x10, 0x00, 0x1d,
-    0x00, 0x29, 0x00, 0x00, 0x37, 0x35, 0x34, 0x3e, 0x01, 0x37, 0x3e, 0x01,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x01, 0x33, 0x32,
-    0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x02, 0x15, 0x06, 0x36, 0x33,
-    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0xb0, 0x0c, 0x2d,
+    0x75, 0x7c, 0x3c, 0x76, 0x53, 0x88, 0x94, 0x88, 0x97, 0xa2, 0x34, 0x01,
+    0xfa, 0x1e, 0x5a, 0x4e, 0x4e, 0x5a, 0x10, 0x5b, 0x50, 0x1a, 0x31, 0x3e,
+    0x9c, 0x9e, 0x35, 0x40, 0x8d, 0x71, 0x48, 0x77, 0x47, 0xc1, 0xbb, 0xbf,
+    0xe4, 0x01, 0xca, 0x58, 0x2b, 0x4e, 0x30, 0x4e, 0x60, 0x5e, 0x51, 0x00,
+    0x01, 0x00, 0x20, 0xff, 0xf6, 0x00, 0xa5, 0x00, 0x7a, 0x00, 0x0b, 0x8a,
+    0x03, 0xf1, 0x03, 0x46, 0x26, 0x25, 0x1d, 0x1e, 0x25, 0x26, 0x1d, 0x0a,
+    0x26, 0x1c, 0x1e, 0x24, 0x24, 0x1e, 0x1c, 0x26, 0x00, 0x2c, 0x00, 0x71,
+    0x77, 0x00, 0xad, 0x00, 0x7a, 0x00, 0x10, 0xd5, 0x12, 0x03, 0x96, 0x00,
+    0x12, 0x33, 0xd4, 0x7c, 0xf0, 0x0b, 0x2a, 0x40, 0x0a, 0x08, 0x0a, 0x1c,
+    0x26, 0x24, 0x1d, 0x26, 0x26, 0x49, 0x3a, 0x58, 0x04, 0x4e, 0x04, 0x26,
+    0x1c, 0x1d, 0x25, 0x34, 0x27, 0x4f, 0x56, 0x03, 0x10, 0x02, 0x8e, 0x2f,
+    0xff, 0xf6, 0x00, 0xb4, 0x02, 0x13, 0x00, 0xf2, 0x03, 0x07, 0x8a, 0x77,
+    0x92, 0x55, 0x26, 0x25, 0x1e, 0x1d, 0x25, 0x26, 0x1c, 0x43, 0x07, 0x00,
+    0x25, 0x1d, 0x26, 0x7d, 0x00, 0x21, 0x01, 0xf9, 0x07, 0x00, 0x20, 0x26,
+    0x1c, 0x4c, 0x00, 0x60, 0x0a, 0xff, 0xf6, 0x01, 0xe4, 0x03, 0x04, 0x6d,
+    0x10, 0x29, 0xca, 0x35, 0x00, 0xc9, 0x03, 0x0b, 0x1f, 0x7b, 0x12, 0x16,
+    0x3d, 0x65, 0x27, 0x15, 0x06, 0x5d, 0x00, 0xf1, 0x2f, 0xb0, 0x0c, 0x2d,
     0x30, 0x38, 0x33, 0x44, 0x40, 0x47, 0x44, 0x0a, 0x61, 0x11, 0x7f, 0x69,
     0x40, 0x66, 0x3b, 0x48, 0x46, 0x22, 0x1f, 0x0a, 0x6c, 0x25, 0x1c, 0x1d,
     0x26, 0x26, 0x1d, 0x1c, 0x25, 0xd6, 0x0e, 0x36, 0x3d, 0x36, 0x22, 0x26,
     0x42, 0x33, 0x33, 0x3e, 0x48, 0x3c, 0x10, 0x5e, 0x6b, 0x2f, 0x59, 0x3f,
-    0x4a, 0x5e, 0x30, 0x17, 0x27, 0x32, 0x2b, 0x81, 0x24, 0x24, 0x1d, 0x1c,
-    0x26, 0x26, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x20, 0x01, 0x9e, 0x01, 0x94,
-    0x03, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x13, 0x37, 0x27, 0x37, 0x17, 0x27,
-    0x33, 0x07, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x51, 0x56, 0x87,
-    0x14, 0x85, 0x02, 0x46, 0x03, 0x85, 0x15, 0x87, 0x55, 0x37, 0x51, 0x50,
-    0x01, 0xc6, 0x70, 0x29, 0x43, 0x2f, 0x8d, 0x8c, 0x2e, 0x43, 0x29, 0x70,
-    0x28, 0x73, 0x73, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9,
-    0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x33, 0x23, 0x01, 0x33, 0x60, 0x60,
-    0x01, 0x5a, 0x5f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0xb9, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x11, 0x33,
-    0x01, 0x23, 0x5f, 0x01, 0x5a, 0x61, 0x03, 0x00, 0xfd, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x28, 0x00, 0xfb, 0x01, 0x3b, 0x01, 0x52, 0x00, 0x03,
-    0x00, 0x00, 0x25, 0x21, 0x35, 0x21, 0x01, 0x3b, 0xfe, 0xed, 0x01, 0x13,
-    0xfb, 0x57, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf4, 0xff, 0x71, 0x02, 0x8f,
-    0xff, 0xb4, 0x00, 0x03, 0x00, 0x00, 0x05, 0x21, 0x35, 0x21, 0x02, 0x8f,
-    0xfd, 0x65, 0x02, 0x9b, 0x8f, 0x43, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28,
-    0xff, 0x2b, 0x03, 0xd9, 0x02, 0xf0, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x00,
-    0x04, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x01, 0x15,
-    0x14, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26,
-    0x35, 0x34, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x37, 0x33, 0x03, 0x06,
-    0x16, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x34, 0x2e, 0x01, 0x23, 0x22, 0x0e,
-    0x01, 0x15, 0x14, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x01,
-    0x23, 0x02, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0e,
-    0x01, 0x15, 0x01, 0x6c, 0xd5, 0x6f, 0x77, 0xda, 0x92, 0x88, 0xd2, 0x74,
-    0x37, 0x64, 0x42, 0x48, 0x4a, 0x05, 0x1c, 0x5a, 0x35, 0x57, 0x56, 0x3c,
-    0x70, 0x4a, 0x37, 0x48, 0x0c, 0x10, 0x59, 0x3e, 0x0b, 0x1d, 0x34, 0x27,
-    0x3e, 0x23, 0x62, 0xab, 0x6c, 0x79, 0xb5, 0x61, 0x55, 0xaf, 0x81, 0x46,
-    0x83, 0x2c, 0x2f, 0x3a, 0x97, 0x55, 0x97, 0x5c, 0x38, 0x49, 0x23, 0x31,
-    0x31, 0x2e, 0x49, 0x27, 0xd5, 0x76, 0xd3, 0x8b, 0x8e, 0xe2, 0x81, 0x69,
-    0xc2, 0x80, 0x5c, 0x8c, 0x4b, 0x40, 0x2a, 0x30, 0x3a, 0x67, 0x5d, 0x48,
-    0x8c, 0x58, 0x34, 0x2b, 0x57, 0xfe, 0xe0, 0x36, 0x4b, 0x3a, 0x6a, 0x46,
-    0x74, 0x9d, 0x4f, 0x6d, 0xbf, 0x78, 0x74, 0xb1, 0x63, 0x25, 0x28, 0x43,
-    0x30, 0x26, 0x01, 0x34, 0x50, 0x6f, 0x2a, 0x36, 0x38, 0x42, 0x66, 0x33,
-    0x00, 0x03, 0x00, 0x22, 0xff, 0xf0, 0x03, 0x42, 0x03, 0x10, 0x00, 0x0f,
-    0x00, 0x1f, 0x00, 0x39, 0x00, 0x00, 0x04, 0x2e, 0x01, 0x35, 0x34, 0x3e,
-    0x01, 0x33, 0x32, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x01, 0x23, 0x00, 0x1e,
-    0x01, 0x33, 0x32, 0x3e, 0x01, 0x35, 0x34, 0x2e, 0x01, 0x23, 0x22, 0x0e,
-    0x01, 0x15, 0x3e, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x23, 0x22,
-    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x23, 0x22,
-    0x2e, 0x01, 0x35, 0x01, 0x42, 0xb7, 0x69, 0x68, 0xb8, 0x70, 0x71, 0xb7,
-    0x68, 0x69, 0xb6, 0x71, 0xfe, 0xaf, 0x57, 0x9a, 0x60, 0x5f, 0x9a, 0x57,
-    0x57, 0x9a, 0x5f, 0x60, 0x9a, 0x57, 0x75, 0x35, 0x64, 0x46, 0x4b, 0x68,
-    0x16, 0x43, 0x28, 0x5e, 0x44, 0x4e, 0x4e, 0x46, 0x30, 0x42, 0x15, 0x43,
-    0x38, 0x94, 0x46, 0x64, 0x35, 0x10, 0x68, 0xb8, 0x70, 0x71, 0xb6, 0x69,
-    0x69, 0xb6, 0x71, 0x70, 0xb8, 0x68, 0x01, 0x31, 0x9c, 0x5a, 0x5a, 0x9c,
-    0x5f, 0x60, 0x9d, 0x59, 0x59, 0x9d, 0x60, 0x45, 0x70, 0x40, 0x46, 0x40,
-    0x1b, 0x5e, 0x64, 0x4e, 0x4d, 0x63, 0x30, 0x34, 0x1a, 0x8e, 0x41, 0x6e,
-    0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7d, 0xff, 0x67, 0x00, 0xd7,
-    0x03, 0x6b, 0x00, 0x03, 0x00, 0x00, 0x17, 0x23, 0x11, 0x33, 0xd7, 0x5a,
-    0x5a, 0x99, 0x04, 0x04, 0x00, 0x03, 0x00, 0x1a, 0xff, 0x88, 0x02, 0x63,
-    0x03, 0x6b, 0x00, 0x21, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x05, 0x2e,
-    0x01, 0x27, 0x37, 0x1e, 0x01, 0x17, 0x11, 0x2e, 0x01, 0x35, 0x34, 0x3e,
-    0x01, 0x37, 0x35, 0x33, 0x15, 0x1e, 0x01, 0x17, 0x07, 0x26, 0x27, 0x11,
-    0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x15, 0x23, 0x02, 0x16, 0x17, 0x35,
-    0x0e, 0x01, 0x15, 0x13, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x01, 0x23,
-    0x6f, 0x86, 0x14, 0x62, 0x0c, 0x4f, 0x4c, 0x82, 0x6f, 0x3b, 0x6e, 0x48,
-    0x4b, 0x5b, 0x77, 0x18, 0x59, 0x22, 0x6f, 0x7e, 0x77, 0x83, 0x72, 0x4b,
-    0x93, 0x3f, 0x54, 0x4a, 0x49, 0xde, 0x49, 0x4c, 0x45, 0x50, 0x0e, 0x0b,
-    0x77, 0x5c, 0x1d, 0x42, 0x54, 0x0a, 0x01, 0x11, 0x15, 0x6a, 0x55, 0x39,
-    0x61, 0x3c, 0x05, 0x5e, 0x5f, 0x0b, 0x66, 0x52, 0x1b, 0x71, 0x13, 0xfe,
-    0xfd, 0x15, 0x6a, 0x58, 0x62, 0x7d, 0x08, 0x69, 0x02, 0x79, 0x38, 0x0e,
-    0xfb, 0x06, 0x4a, 0x32, 0xfe, 0x17, 0x06, 0x4c, 0x39, 0x38, 0x37, 0x0d,
-    0x00, 0x01, 0x00, 0x17, 0x00, 0x74, 0x02, 0x13, 0x02, 0x72, 0x00, 0x0b,
-    0x00, 0x00, 0x13, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23,
-    0x15, 0x23, 0xeb, 0xd4, 0xd4, 0x53, 0xd5, 0xd5, 0x53, 0x01, 0x4b, 0x52,
-    0xd5, 0xd5, 0x52, 0xd7, 0x00, 0x05, 0x00, 0x2d, 0xff, 0xf2, 0x03, 0x42,
-    0x03, 0x0f, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1c, 0x00, 0x29, 0x00, 0x35,
-    0x00, 0x00, 0x09, 0x01, 0x23, 0x01, 0x04, 0x36, 0x33, 0x32, 0x1e, 0x01,
-    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x1e, 0x01, 0x33, 0x32, 0x36,
-    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x00, 0x36, 0x33, 0x32, 0x1e,
-    0x01, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x1e, 0x01, 0x33, 0x32,
-    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x02, 0xc4, 0xfe, 0x46,
-    0x5b, 0x01, 0xbb, 0xfd, 0xc3, 0x56, 0x53, 0x38, 0x4d, 0x25, 0x55, 0x55,
-    0x55, 0x54, 0x51, 0x29, 0x2f, 0x2f, 0x29, 0x29, 0x2f, 0x2f, 0x29, 0x01,
-    0x71, 0x57, 0x53, 0x38, 0x4c, 0x25, 0x55, 0x54, 0x55, 0x55, 0x51, 0x2a,
-    0x2f, 0x2f, 0x28, 0x28, 0x2f, 0x2f, 0x2a, 0x03, 0x00, 0xfd, 0x00, 0x03,
-    0x00, 0x65, 0x74, 0x36, 0x5c, 0x36, 0x56, 0x73, 0x73, 0x56, 0x38, 0x49,
-    0x49, 0x38, 0x38, 0x47, 0x48, 0x37, 0xfe, 0xc9, 0x73, 0x36, 0x5c, 0x36,
-    0x56, 0x73, 0x73, 0x56, 0x37, 0x4a, 0x4a, 0x37, 0x38, 0x47, 0x48, 0x37,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0xc6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x07, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x16, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x09, 0x00, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x0c, 0x00, 0x2f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x06, 0x00, 0x08, 0x00, 0x3b, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x00, 0x00, 0x66, 0x00, 0x43, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x01, 0x00, 0x12, 0x00, 0xa9, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x02, 0x00, 0x0e, 0x00, 0xbb, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x03, 0x00, 0x2c, 0x00, 0xc9, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x04, 0x00, 0x12, 0x00, 0xf5, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x05, 0x00, 0x18, 0x01, 0x07, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x06, 0x00, 0x10, 0x01, 0x1f, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x07, 0x00, 0x40, 0x01, 0x2f, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x08, 0x00, 0x16, 0x01, 0x6f, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-    0x00, 0x0a, 0x00, 0x24, 0x01, 0x85, 0x4f, 0x50, 0x50, 0x4f, 0x20, 0x53,
-    0x61, 0x6e, 0x73, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x4f, 0x50,
-    0x50, 0x4f, 0x20, 0x53, 0x61, 0x6e, 0x73, 0x20, 0x56, 0x65, 0x72, 0x73,
-    0x69, 0x6f, 0x6e, 0x20, 0x33, 0x2e, 0x30, 0x34, 0x4f, 0x50, 0x50, 0x4f,
-    0x20, 0x53, 0x61, 0x6e, 0x73, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-    0x20, 0x33, 0x2e, 0x30, 0x34, 0x4f, 0x50, 0x50, 0x4f, 0x53, 0x61, 0x6e,
-    0x73, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
+    0x4a, 0x5e, 0x30, 0x17, 0x27, 0x32, 0x2b, 0x81, 0x24, 0x24, 0x1d, 0x7c,
+    0x00, 0x00, 0x02, 0x01, 0x41, 0x01, 0x9e, 0x01, 0x94, 0xd8, 0x81, 0xf3,
+    0x1f, 0x00, 0x13, 0x37, 0x27, 0x37, 0x17, 0x27, 0x33, 0x07, 0x37, 0x17,
+    0x07, 0x17, 0x07, 0x27, 0x07, 0x51, 0x56, 0x87, 0x14, 0x85, 0x02, 0x46,
+    0x03, 0x85, 0x15, 0x87, 0x55, 0x37, 0x51, 0x50, 0x01, 0xc6, 0x70, 0x29,
+    0x43, 0x2f, 0x8d, 0x8c, 0x2e, 0x43, 0x29, 0x70, 0x28, 0x73, 0x73, 0xa4,
+    0x8c, 0x24, 0x01, 0xb9, 0x0e, 0x78, 0x63, 0x01, 0x33, 0x60, 0x60, 0x01,
+    0x5a, 0x10, 0x78, 0x07, 0x1a, 0x00, 0x83, 0x11, 0x33, 0x01, 0x23, 0x5f,
+    0x01, 0x5a, 0x61, 0x34, 0x80, 0x60, 0x28, 0x00, 0xfb, 0x01, 0x3b, 0x01,
+    0xb6, 0x35, 0x00, 0xec, 0x03, 0x90, 0x21, 0x01, 0x3b, 0xfe, 0xed, 0x01,
+    0x13, 0xfb, 0x57, 0xba, 0x7c, 0x70, 0xff, 0x71, 0x02, 0x8f, 0xff, 0xb4,
+    0x00, 0xe5, 0x7f, 0xf1, 0x06, 0x21, 0x35, 0x21, 0x02, 0x8f, 0xfd, 0x65,
+    0x02, 0x9b, 0x8f, 0x43, 0x00, 0x02, 0x00, 0x28, 0xff, 0x2b, 0x03, 0xd9,
+    0x02, 0xf0, 0x8e, 0x48, 0x0c, 0x7a, 0x7f, 0x00, 0xa0, 0x55, 0x08, 0x4f,
+    0x02, 0x00, 0x12, 0x75, 0x14, 0x06, 0x4f, 0x02, 0x02, 0x88, 0x03, 0x25,
+    0x14, 0x16, 0x75, 0x7b, 0x16, 0x02, 0x68, 0x02, 0xf0, 0x6b, 0x06, 0x15,
+    0x01, 0x6c, 0xd5, 0x6f, 0x77, 0xda, 0x92, 0x88, 0xd2, 0x74, 0x37, 0x64,
+    0x42, 0x48, 0x4a, 0x05, 0x1c, 0x5a, 0x35, 0x57, 0x56, 0x3c, 0x70, 0x4a,
+    0x37, 0x48, 0x0c, 0x10, 0x59, 0x3e, 0x0b, 0x1d, 0x34, 0x27, 0x3e, 0x23,
+    0x62, 0xab, 0x6c, 0x79, 0xb5, 0x61, 0x55, 0xaf, 0x81, 0x46, 0x83, 0x2c,
+    0x2f, 0x3a, 0x97, 0x55, 0x97, 0x5c, 0x38, 0x49, 0x23, 0x31, 0x31, 0x2e,
+    0x49, 0x27, 0xd5, 0x76, 0xd3, 0x8b, 0x8e, 0xe2, 0x81, 0x69, 0xc2, 0x80,
+    0x5c, 0x8c, 0x4b, 0x40, 0x2a, 0x30, 0x3a, 0x67, 0x5d, 0x48, 0x8c, 0x58,
+    0x34, 0x2b, 0x57, 0xfe, 0xe0, 0x36, 0x4b, 0x3a, 0x6a, 0x46, 0x74, 0x9d,
+    0x4f, 0x6d, 0xbf, 0x78, 0x74, 0xb1, 0x63, 0x25, 0x28, 0x43, 0x30, 0x26,
+    0x01, 0x34, 0x50, 0x6f, 0x2a, 0x36, 0x38, 0x42, 0x66, 0x33, 0x00, 0x03,
+    0x4a, 0x80, 0x41, 0x03, 0x42, 0x03, 0x10, 0x44, 0x12, 0x1e, 0x39, 0xd2,
+    0x00, 0x2a, 0x00, 0x16, 0xc0, 0x00, 0x22, 0x3e, 0x02, 0x6b, 0x04, 0x08,
+    0x40, 0x7c, 0x01, 0xf3, 0x77, 0xf0, 0x24, 0x01, 0x42, 0xb7, 0x69, 0x68,
+    0xb8, 0x70, 0x71, 0xb7, 0x68, 0x69, 0xb6, 0x71, 0xfe, 0xaf, 0x57, 0x9a,
+    0x60, 0x5f, 0x9a, 0x57, 0x57, 0x9a, 0x5f, 0x60, 0x9a, 0x57, 0x75, 0x35,
+    0x64, 0x46, 0x4b, 0x68, 0x16, 0x43, 0x28, 0x5e, 0x44, 0x4e, 0x4e, 0x46,
+    0x30, 0x42, 0x15, 0x43, 0x38, 0x94, 0x46, 0x64, 0x35, 0x10, 0x2f, 0x00,
+    0xf1, 0x17, 0xb6, 0x69, 0x69, 0xb6, 0x71, 0x70, 0xb8, 0x68, 0x01, 0x31,
+    0x9c, 0x5a, 0x5a, 0x9c, 0x5f, 0x60, 0x9d, 0x59, 0x59, 0x9d, 0x60, 0x45,
+    0x70, 0x40, 0x46, 0x40, 0x1b, 0x5e, 0x64, 0x4e, 0x4d, 0x63, 0x30, 0x34,
+    0x1a, 0x8e, 0x41, 0x6e, 0xb2, 0x7b, 0x70, 0x7d, 0xff, 0x67, 0x00, 0xd7,
+    0x03, 0x6b, 0x94, 0x01, 0xa0, 0x17, 0x23, 0x11, 0x33, 0xd7, 0x5a, 0x5a,
+    0x99, 0x04, 0x04, 0xd0, 0x17, 0xa0, 0xff, 0x88, 0x02, 0x63, 0x03, 0x6b,
+    0x00, 0x21, 0x00, 0x28, 0xce, 0x71, 0x22, 0x05, 0x26, 0xb3, 0x0b, 0x12,
+    0x11, 0xca, 0x00, 0x00, 0x34, 0x5d, 0x02, 0xf9, 0x0c, 0x12, 0x11, 0xba,
+    0x02, 0xa2, 0x15, 0x23, 0x02, 0x16, 0x17, 0x35, 0x06, 0x06, 0x15, 0x13,
+    0x79, 0x0e, 0xf1, 0x47, 0x01, 0x23, 0x6f, 0x86, 0x14, 0x62, 0x0c, 0x4f,
+    0x4c, 0x82, 0x6f, 0x3b, 0x6e, 0x48, 0x4b, 0x5b, 0x77, 0x18, 0x59, 0x22,
+    0x6f, 0x7e, 0x77, 0x83, 0x72, 0x4b, 0x93, 0x3f, 0x54, 0x4a, 0x49, 0xde,
+    0x49, 0x4c, 0x45, 0x50, 0x0e, 0x0b, 0x77, 0x5c, 0x1d, 0x42, 0x54, 0x0a,
+    0x01, 0x11, 0x15, 0x6a, 0x55, 0x39, 0x61, 0x3c, 0x05, 0x5e, 0x5f, 0x0b,
+    0x66, 0x52, 0x1b, 0x71, 0x13, 0xfe, 0xfd, 0x15, 0x6a, 0x58, 0x62, 0x7d,
+    0x08, 0x69, 0x02, 0x79, 0x38, 0x0e, 0xfb, 0x06, 0x4a, 0x32, 0xfe, 0x17,
+    0x06, 0x4c, 0x39, 0x38, 0x37, 0x0d, 0x3c, 0x07, 0x51, 0x74, 0x02, 0x13,
+    0x02, 0x72, 0x1e, 0x77, 0x06, 0x2d, 0x1f, 0xf1, 0x00, 0x23, 0xeb, 0xd4,
+    0xd4, 0x53, 0xd5, 0xd5, 0x53, 0x01, 0x4b, 0x52, 0xd5, 0xd5, 0x52, 0xd7,
+    0x76, 0x22, 0x51, 0xf2, 0x03, 0x42, 0x03, 0x0f, 0x7a, 0x70, 0x70, 0x1c,
+    0x00, 0x29, 0x00, 0x35, 0x00, 0x00, 0x85, 0x82, 0x14, 0x04, 0x85, 0x01,
+    0x00, 0x50, 0x02, 0x17, 0x16, 0x1b, 0x05, 0x1f, 0x00, 0x19, 0x00, 0x05,
+    0xf0, 0x08, 0x02, 0xc4, 0xfe, 0x46, 0x5b, 0x01, 0xbb, 0xfd, 0xc3, 0x56,
+    0x53, 0x38, 0x4d, 0x25, 0x55, 0x55, 0x55, 0x54, 0x51, 0x29, 0x2f, 0x2f,
+    0x29, 0x04, 0x00, 0xf0, 0x05, 0x01, 0x71, 0x57, 0x53, 0x38, 0x4c, 0x25,
+    0x55, 0x54, 0x55, 0x55, 0x51, 0x2a, 0x2f, 0x2f, 0x28, 0x28, 0x2f, 0x2f,
+    0x2a, 0x05, 0x03, 0xf3, 0x07, 0x03, 0x00, 0x65, 0x74, 0x36, 0x5c, 0x36,
+    0x56, 0x73, 0x73, 0x56, 0x38, 0x49, 0x49, 0x38, 0x38, 0x47, 0x48, 0x37,
+    0xfe, 0xc9, 0x73, 0x12, 0x00, 0x40, 0x37, 0x4a, 0x4a, 0x37, 0x12, 0x00,
+    0x01, 0xb2, 0x87, 0x30, 0x0a, 0x00, 0x7e, 0x7e, 0x8c, 0x10, 0x04, 0x76,
+    0x90, 0x33, 0x66, 0x00, 0x00, 0x0c, 0x00, 0x53, 0x01, 0x00, 0x12, 0x00,
+    0x66, 0x0c, 0x00, 0x53, 0x02, 0x00, 0x0e, 0x00, 0x78, 0x0c, 0x00, 0x00,
+    0x82, 0x21, 0x13, 0x86, 0x0c, 0x00, 0x17, 0x04, 0x24, 0x00, 0x53, 0x05,
+    0x00, 0x18, 0x00, 0xb2, 0x0c, 0x00, 0x53, 0x06, 0x00, 0x10, 0x00, 0xca,
+    0x0c, 0x00, 0x53, 0x07, 0x00, 0x40, 0x00, 0xda, 0x0c, 0x00, 0x53, 0x08,
+    0x00, 0x16, 0x01, 0x1a, 0x0c, 0x00, 0xf1, 0x18, 0x0a, 0x00, 0x24, 0x01,
+    0x30, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
     0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0xa9, 0x00,
-    0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x2d, 0x00,
-    0x32, 0x00, 0x30, 0x00, 0x32, 0x00, 0x33, 0x00, 0x20, 0x00, 0x62, 0x00,
-    0x79, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00,
-    0x2e, 0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00,
-    0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00,
-    0x20, 0x00, 0x72, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00,
-    0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2e, 0x00, 0x4f, 0x00, 0x50, 0x00,
-    0x50, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00,
-    0x73, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00,
-    0x61, 0x00, 0x72, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00,
-    0x20, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x20, 0x00,
-    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x20, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x34, 0x00,
-    0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x20, 0x00, 0x53, 0x00,
-    0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00,
-    0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x33, 0x00,
-    0x2e, 0x00, 0x30, 0x00, 0x34, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00,
-    0x4f, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x4f, 0x00,
-    0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00,
-    0x73, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x2d, 0x0a,
+    0x00, 0xf7, 0x10, 0x32, 0x00, 0x33, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79,
+    0x00, 0x20, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00, 0x2e,
+    0x00, 0x20, 0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x3e, 0x00,
+    0x11, 0x73, 0x0e, 0x00, 0xf5, 0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x64, 0x00, 0x2e, 0x34, 0x00, 0xfd,
+    0x08, 0x20, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x52,
+    0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72,
+    0x20, 0x00, 0x00, 0x46, 0x00, 0x11, 0x56, 0x42, 0x00, 0xd1, 0x73, 0x00,
+    0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x33, 0x00, 0x2e, 0xe4,
+    0x21, 0x0f, 0x18, 0x00, 0x05, 0x04, 0x44, 0x00, 0x04, 0x42, 0x00, 0x0c,
+    0x10, 0x00, 0x31, 0x20, 0x00, 0x69, 0x06, 0x00, 0xf1, 0x00, 0x61, 0x00,
     0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x64, 0x00, 0x65, 0x00,
-    0x6d, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00,
-    0x66, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x50, 0x00, 0x4f, 0x00,
-    0x2e, 0x00, 0x48, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x79, 0x00, 0x69, 0x00,
-    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00,
-    0x66, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00,
-    0x6e, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x77, 0x00, 0x73, 0x00, 0x20, 0x00,
-    0x64, 0x00, 0x65, 0x00, 0x73, 0x00, 0x69, 0x00, 0x67, 0x00, 0x6e, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9c, 0x00, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34,
-    0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46,
-    0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c,
-    0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52,
-    0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
-    0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x01, 0x02,
-    0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08,
-    0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e,
-    0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14,
-    0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a,
-    0x01, 0x1b, 0x01, 0x1c, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20,
-    0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26,
-    0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c,
-    0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32,
-    0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
-    0x01, 0x39, 0x01, 0x3a, 0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e,
-    0x01, 0x3f, 0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44,
-    0x01, 0x45, 0x01, 0x46, 0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a,
-    0x01, 0x4b, 0x01, 0x4c, 0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50,
-    0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56,
-    0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c,
-    0x01, 0x5d, 0x01, 0x5e, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62,
-    0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68,
-    0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e,
-    0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74,
-    0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a,
-    0x01, 0x7b, 0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80,
-    0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86,
-    0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c,
-    0x01, 0x8d, 0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x00, 0x13, 0x00, 0x14,
-    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a,
-    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x11, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x22,
-    0x00, 0x0d, 0x00, 0x12, 0x00, 0x3f, 0x00, 0x10, 0x00, 0x42, 0x00, 0x23,
-    0x00, 0x8b, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x08, 0x07, 0x75,
-    0x6e, 0x69, 0x34, 0x45, 0x32, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x45,
-    0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x45, 0x32, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x34, 0x45, 0x36, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x45,
-    0x38, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x45, 0x45, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x34, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x46,
-    0x32, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x46, 0x34, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x34, 0x46, 0x34, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x46,
-    0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x34, 0x46, 0x45, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x31, 0x36, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x31,
-    0x36, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x31, 0x37, 0x33, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x31, 0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x32,
-    0x31, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x32, 0x32, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x32, 0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x32,
-    0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x32, 0x36, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x32, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x33,
-    0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x33, 0x31, 0x36, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x33, 0x44, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x33,
-    0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x33, 0x45, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x34, 0x30, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x34,
-    0x32, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x36, 0x36, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x37, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x37,
-    0x33, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x37, 0x34, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x39, 0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x39,
-    0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x39, 0x33, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x42, 0x35, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x42,
-    0x38, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x42, 0x38, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x42, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x42,
-    0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x42, 0x46, 0x39, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x43, 0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x44,
-    0x46, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x45, 0x32, 0x37, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x45, 0x41, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x45,
-    0x46, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x46, 0x30, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x35, 0x46, 0x30, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x35, 0x46,
-    0x38, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x30, 0x33, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x32, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x32,
-    0x35, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x32, 0x41, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x32, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x33,
-    0x30, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x33, 0x36, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x33, 0x41, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x33,
-    0x41, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x35, 0x34, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x35, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x35,
-    0x38, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x35, 0x42, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x35, 0x45, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x35,
-    0x46, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x36, 0x46, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x37, 0x30, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x37,
-    0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x37, 0x31, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x37, 0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x37,
-    0x32, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x37, 0x33, 0x41, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x37, 0x34, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x37,
-    0x37, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x38, 0x33, 0x43, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x38, 0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x42,
-    0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x42, 0x36, 0x34, 0x07, 0x75,
-    0x6e, 0x69, 0x36, 0x43, 0x34, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x36, 0x44,
-    0x38, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x32, 0x34, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x33, 0x38, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x35,
-    0x31, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x35, 0x32, 0x38, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x35, 0x33, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x36,
-    0x44, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x37, 0x45, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x38, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x38,
-    0x36, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x38, 0x36, 0x45, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x41, 0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x41,
-    0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x41, 0x45, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x42, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x42,
-    0x34, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x42, 0x41, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x43, 0x46, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x45,
-    0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x45, 0x44, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x45, 0x45, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x46,
-    0x31, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x37, 0x46, 0x35, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x37, 0x46, 0x36, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x31,
-    0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x32, 0x46, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x39, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x39,
-    0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x41, 0x30, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x42, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x42,
-    0x41, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x42, 0x42, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x42, 0x42, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x42,
-    0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x42, 0x43, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x42, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x42,
-    0x46, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x44, 0x32, 0x35, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x44, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x44,
-    0x33, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x44, 0x45, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x46, 0x39, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x46,
-    0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x46, 0x44, 0x42, 0x07, 0x75,
-    0x6e, 0x69, 0x38, 0x46, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x38, 0x46,
-    0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x30, 0x30, 0x30, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x30, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x30,
-    0x31, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x31, 0x34, 0x44, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x31, 0x43, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x31,
-    0x43, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x31, 0x43, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x35, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x35,
-    0x45, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x36, 0x31, 0x46, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x36, 0x35, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x36,
-    0x36, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x36, 0x43, 0x36, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x37, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x37,
-    0x46, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x38, 0x39, 0x31, 0x07, 0x75,
-    0x6e, 0x69, 0x39, 0x41, 0x38, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x39, 0x41,
-    0x44, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0e,
-    0x00, 0x10, 0x00, 0x07, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00,
-    0x01, 0xf4, 0xfe, 0x0c, 0x00, 0x00, 0x03, 0xe8, 0xfe, 0xa4, 0xff, 0x90,
-    0x04, 0x58, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01};
-
-unsigned int OPPOSans_Regular_ttf_len = 40304;
+    0x6d, 0x80, 0x00, 0x79, 0x6b, 0x00, 0x20, 0x00, 0x6f, 0x00, 0x66, 0xde,
+    0x00, 0x11, 0x48, 0x38, 0x00, 0x71, 0x79, 0x00, 0x69, 0x00, 0x20, 0x00,
+    0x46, 0x6c, 0x00, 0x00, 0xde, 0x00, 0xf1, 0x04, 0x66, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x6f, 0x00, 0x77, 0x56, 0x00, 0x11, 0x64, 0xf4, 0x00, 0x00, 0x06, 0x01,
+    0x11, 0x6e, 0xc2, 0x01, 0x01, 0x01, 0x00, 0x3f, 0xff, 0x9c, 0x00, 0xb0,
+    0x8a, 0x03, 0x00, 0x6e, 0x8e, 0xb1, 0x08, 0x00, 0x0e, 0x00, 0x10, 0x00,
+    0x07, 0xff, 0xff, 0x00, 0x0f, 0xe2, 0x8a, 0xc0, 0xf4, 0xfe, 0x0c, 0x00,
+    0x00, 0x03, 0xe8, 0xfe, 0xa4, 0xff, 0x90, 0x04, 0x38, 0x58, 0x06, 0x9e,
+    0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01};
+unsigned int OPPOSans_Regular_ttf_lz4_len = 30247;
+unsigned int OPPOSans_Regular_ttf_len = 37844;
 
-#endif
\ No newline at end of file
+#endif
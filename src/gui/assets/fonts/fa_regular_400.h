@@ -1,5668 +0,0 @@
-/*
- * @Author: DI JUNKUN
- * @Date: 2024-11-11
- * Copyright (c) 2024 by DI JUNKUN, All Rights Reserved.
- */
-
-#ifndef _FA_REGULAR_400_H_
-#define _FA_REGULAR_400_H_
-
-unsigned char fa_regular_400_ttf[] = {
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0x03, 0x00, 0x20,
-    0x4f, 0x53, 0x2f, 0x32, 0x5f, 0x6e, 0x5e, 0x5e, 0x00, 0x00, 0x01, 0x28,
-    0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, 0x4a, 0xa6, 0x9d, 0xd0,
-    0x00, 0x00, 0x04, 0xd8, 0x00, 0x00, 0x17, 0x80, 0x67, 0x6c, 0x79, 0x66,
-    0xd1, 0xbd, 0x61, 0x38, 0x00, 0x00, 0x1e, 0x04, 0x00, 0x00, 0xdd, 0x08,
-    0x68, 0x65, 0x61, 0x64, 0x29, 0x05, 0xd4, 0x87, 0x00, 0x00, 0x00, 0xac,
-    0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 0x04, 0x4a, 0x03, 0x05,
-    0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78,
-    0x81, 0x1e, 0x00, 0xed, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x03, 0x50,
-    0x6c, 0x6f, 0x63, 0x61, 0xae, 0xe9, 0x73, 0xda, 0x00, 0x00, 0x1c, 0x58,
-    0x00, 0x00, 0x01, 0xaa, 0x6d, 0x61, 0x78, 0x70, 0x00, 0xe3, 0x07, 0xf5,
-    0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0x65, 0x44, 0x09, 0x13, 0x00, 0x00, 0xfb, 0x0c, 0x00, 0x00, 0x04, 0x05,
-    0x70, 0x6f, 0x73, 0x74, 0x39, 0xcd, 0xbe, 0xc9, 0x00, 0x00, 0xff, 0x14,
-    0x00, 0x00, 0x09, 0xfe, 0x00, 0x01, 0x00, 0x00, 0x03, 0x05, 0x05, 0x00,
-    0xb3, 0x58, 0x73, 0x1c, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x02, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe2, 0x31, 0xc7, 0x85, 0x00, 0x00, 0x00, 0x00,
-    0xe2, 0x31, 0xc7, 0x85, 0xff, 0xf8, 0xff, 0xb8, 0x02, 0x87, 0x01, 0xc8,
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x01, 0xc8, 0xff, 0xb8, 0x00, 0x00, 0x02, 0x80,
-    0xff, 0xf8, 0xff, 0xf8, 0x02, 0x87, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0xd4, 0x07, 0xf3, 0x00, 0x0d, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xd0,
-    0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x01, 0x4c, 0x01, 0x66, 0x00, 0x00,
-    0x00, 0x47, 0x01, 0x4c, 0x01, 0x66, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x19,
-    0x00, 0x84, 0x00, 0x00, 0x02, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x57, 0x53, 0x4d, 0x00, 0xc0,
-    0x00, 0x21, 0xff, 0xff, 0x01, 0xc8, 0xff, 0xb8, 0x00, 0x00, 0x01, 0xc8,
-    0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3f,
-    0x01, 0xac, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x00, 0x40, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x0b,
-    0x01, 0x80, 0x00, 0x01, 0x01, 0x80, 0xff, 0xfa, 0x01, 0xc0, 0x00, 0x10,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x00, 0xff, 0xfa, 0x01, 0x40, 0xff, 0xf9,
-    0x01, 0x40, 0xff, 0xfb, 0x01, 0x80, 0xff, 0xfd, 0x01, 0x40, 0xff, 0xfb,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x10,
-    0x01, 0x80, 0xff, 0xfb, 0x01, 0x40, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0xff, 0xfb, 0x01, 0x40, 0x00, 0x00, 0x01, 0x80, 0xff, 0xf9,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x20,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
-    0x01, 0x40, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-    0x01, 0x40, 0xff, 0xfc, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x01, 0x80, 0xff, 0xfb, 0x02, 0x40, 0xff, 0xfc, 0x01, 0x80, 0xff, 0xf9,
-    0x01, 0x80, 0xff, 0xf9, 0x01, 0x80, 0xff, 0xfc, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x15,
-    0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x40, 0xff, 0xfe, 0x02, 0x80, 0xff, 0xf9,
-    0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0xff, 0xfe, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x80, 0xff, 0xfc,
-    0x02, 0x40, 0x00, 0x15, 0x01, 0xc0, 0xff, 0xf8, 0x02, 0x40, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x10, 0x01, 0xc0, 0xff, 0xfc,
-    0x02, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xfd,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x80, 0xff, 0xf9,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x40, 0x00, 0x20,
-    0x02, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x20,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x40, 0x00, 0x1d, 0x01, 0xc0, 0xff, 0xfc, 0x02, 0x00, 0x00, 0x1c,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x0c, 0x02, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x20, 0x02, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x01, 0x80, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0xc0, 0xff, 0xfc,
-    0x01, 0xc0, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xfb, 0x02, 0x40, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00,
-    0x01, 0xc0, 0x00, 0x10, 0x01, 0x40, 0x00, 0x00, 0x02, 0x00, 0xff, 0xfa,
-    0x01, 0xc0, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xfe,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x15, 0x02, 0x00, 0x00, 0x00,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03,
-    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x34,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x03, 0x00, 0x0a,
-    0x00, 0x00, 0x08, 0x34, 0x00, 0x04, 0x08, 0x10, 0x00, 0x00, 0x01, 0xcc,
-    0x01, 0x00, 0x00, 0x07, 0x00, 0xcc, 0x00, 0x21, 0x00, 0x25, 0x00, 0x2b,
-    0x00, 0x39, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64,
-    0x00, 0x65, 0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6a,
-    0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d, 0x00, 0x6e, 0x00, 0x6f, 0x00, 0x70,
-    0x00, 0x71, 0x00, 0x72, 0x00, 0x73, 0x00, 0x74, 0x00, 0x75, 0x00, 0x76,
-    0x00, 0x77, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7a, 0x00, 0xa9, 0x00, 0xae,
-    0x23, 0x28, 0x23, 0xf3, 0x23, 0xfe, 0x25, 0xa0, 0x25, 0xcf, 0x25, 0xfb,
-    0x25, 0xfc, 0x26, 0x00, 0x26, 0x11, 0x26, 0x1d, 0x26, 0x39, 0x26, 0x5a,
-    0x26, 0x5b, 0x26, 0x5c, 0x26, 0x5d, 0x26, 0x5e, 0x26, 0x5f, 0x26, 0x65,
-    0x26, 0xaa, 0x26, 0xab, 0x26, 0xbd, 0x27, 0x05, 0x27, 0x09, 0x27, 0x0b,
-    0x27, 0x0c, 0x27, 0x31, 0x27, 0x44, 0x27, 0x46, 0x27, 0x53, 0x27, 0x54,
-    0x27, 0x55, 0x27, 0x57, 0x27, 0x64, 0x27, 0x95, 0x2b, 0x1b, 0x2b, 0x1c,
-    0x2b, 0x24, 0x2b, 0x50, 0xe1, 0x85, 0xe1, 0xfe, 0xf0, 0x03, 0xf0, 0x05,
-    0xf0, 0x06, 0xf0, 0x07, 0xf0, 0x14, 0xf0, 0x16, 0xf0, 0x17, 0xf0, 0x1a,
-    0xf0, 0x1b, 0xf0, 0x1d, 0xf0, 0x22, 0xf0, 0x24, 0xf0, 0x2e, 0xf0, 0x3e,
-    0xf0, 0x44, 0xf0, 0x45, 0xf0, 0x46, 0xf0, 0x59, 0xf0, 0x5c, 0xf0, 0x5d,
-    0xf0, 0x67, 0xf0, 0x69, 0xf0, 0x6e, 0xf0, 0x70, 0xf0, 0x73, 0xf0, 0x75,
-    0xf0, 0x7c, 0xf0, 0x80, 0xf0, 0x86, 0xf0, 0x87, 0xf0, 0x88, 0xf0, 0x89,
-    0xf0, 0x8a, 0xf0, 0x94, 0xf0, 0x96, 0xf0, 0x97, 0xf0, 0x9d, 0xf0, 0xa0,
-    0xf0, 0xa2, 0xf0, 0xa7, 0xf0, 0xc5, 0xf0, 0xc8, 0xf0, 0xe0, 0xf0, 0xe5,
-    0xf0, 0xe6, 0xf0, 0xeb, 0xf0, 0xf3, 0xf0, 0xf6, 0xf0, 0xf7, 0xf0, 0xf8,
-    0xf0, 0xfe, 0xf1, 0x0c, 0xf1, 0x11, 0xf1, 0x14, 0xf1, 0x15, 0xf1, 0x1a,
-    0xf1, 0x1c, 0xf1, 0x1d, 0xf1, 0x23, 0xf1, 0x28, 0xf1, 0x2a, 0xf1, 0x33,
-    0xf1, 0x44, 0xf1, 0x46, 0xf1, 0x47, 0xf1, 0x4a, 0xf1, 0x4e, 0xf1, 0x52,
-    0xf1, 0x55, 0xf1, 0x5c, 0xf1, 0x65, 0xf1, 0x86, 0xf1, 0x8e, 0xf1, 0x90,
-    0xf1, 0x92, 0xf1, 0x96, 0xf1, 0xad, 0xf1, 0xc9, 0xf1, 0xcd, 0xf1, 0xd8,
-    0xf1, 0xd9, 0xf1, 0xdb, 0xf1, 0xe3, 0xf1, 0xea, 0xf1, 0xf6, 0xf1, 0xf7,
-    0xf1, 0xf9, 0xf1, 0xfa, 0xf2, 0x0a, 0xf2, 0x49, 0xf2, 0x4a, 0xf2, 0x4d,
-    0xf2, 0x50, 0xf2, 0x52, 0xf2, 0x5b, 0xf2, 0x5d, 0xf2, 0x74, 0xf2, 0x78,
-    0xf2, 0x7a, 0xf2, 0x7b, 0xf2, 0x83, 0xf2, 0x8b, 0xf2, 0x8c, 0xf2, 0x8d,
-    0xf2, 0x8e, 0xf2, 0x92, 0xf2, 0x95, 0xf2, 0x9c, 0xf2, 0xb6, 0xf2, 0xb7,
-    0xf2, 0xb9, 0xf2, 0xba, 0xf2, 0xbb, 0xf2, 0xbc, 0xf2, 0xbd, 0xf2, 0xbe,
-    0xf2, 0xc0, 0xf2, 0xc2, 0xf2, 0xc3, 0xf2, 0xd2, 0xf2, 0xd4, 0xf2, 0xdc,
-    0xf2, 0xed, 0xf3, 0x02, 0xf3, 0x28, 0xf3, 0x5b, 0xf3, 0xa5, 0xf3, 0xd1,
-    0xf4, 0x10, 0xf4, 0x25, 0xf4, 0x3a, 0xf4, 0x3f, 0xf4, 0x41, 0xf4, 0x43,
-    0xf4, 0x45, 0xf4, 0x47, 0xf4, 0x5c, 0xf4, 0x7d, 0xf4, 0xad, 0xf4, 0xda,
-    0xf4, 0xe6, 0xf5, 0x2c, 0xf5, 0x31, 0xf5, 0x36, 0xf5, 0x41, 0xf5, 0x56,
-    0xf5, 0x67, 0xf5, 0x7a, 0xf5, 0x8c, 0xf5, 0x9c, 0xf5, 0xa5, 0xf5, 0xb4,
-    0xf5, 0xb8, 0xf5, 0xc0, 0xf5, 0xc2, 0xf5, 0xc8, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x21, 0x00, 0x23, 0x00, 0x2a, 0x00, 0x30, 0x00, 0x3c, 0x00, 0x61,
-    0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x66, 0x00, 0x67,
-    0x00, 0x68, 0x00, 0x69, 0x00, 0x6a, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6d,
-    0x00, 0x6e, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x71, 0x00, 0x72, 0x00, 0x73,
-    0x00, 0x74, 0x00, 0x75, 0x00, 0x76, 0x00, 0x77, 0x00, 0x78, 0x00, 0x79,
-    0x00, 0x7a, 0x00, 0xa9, 0x00, 0xae, 0x23, 0x28, 0x23, 0xf3, 0x23, 0xfe,
-    0x25, 0xa0, 0x25, 0xcf, 0x25, 0xfb, 0x25, 0xfc, 0x26, 0x00, 0x26, 0x11,
-    0x26, 0x1d, 0x26, 0x39, 0x26, 0x5a, 0x26, 0x5b, 0x26, 0x5c, 0x26, 0x5d,
-    0x26, 0x5e, 0x26, 0x5f, 0x26, 0x65, 0x26, 0xaa, 0x26, 0xab, 0x26, 0xbd,
-    0x27, 0x05, 0x27, 0x09, 0x27, 0x0b, 0x27, 0x0c, 0x27, 0x31, 0x27, 0x44,
-    0x27, 0x46, 0x27, 0x53, 0x27, 0x54, 0x27, 0x55, 0x27, 0x57, 0x27, 0x64,
-    0x27, 0x95, 0x2b, 0x1b, 0x2b, 0x1c, 0x2b, 0x24, 0x2b, 0x50, 0xe1, 0x85,
-    0xe1, 0xfe, 0xf0, 0x03, 0xf0, 0x04, 0xf0, 0x06, 0xf0, 0x07, 0xf0, 0x14,
-    0xf0, 0x16, 0xf0, 0x17, 0xf0, 0x1a, 0xf0, 0x1b, 0xf0, 0x1d, 0xf0, 0x22,
-    0xf0, 0x24, 0xf0, 0x2e, 0xf0, 0x3e, 0xf0, 0x44, 0xf0, 0x45, 0xf0, 0x46,
-    0xf0, 0x57, 0xf0, 0x5c, 0xf0, 0x5d, 0xf0, 0x67, 0xf0, 0x69, 0xf0, 0x6e,
-    0xf0, 0x70, 0xf0, 0x73, 0xf0, 0x75, 0xf0, 0x7b, 0xf0, 0x80, 0xf0, 0x86,
-    0xf0, 0x87, 0xf0, 0x88, 0xf0, 0x89, 0xf0, 0x8a, 0xf0, 0x94, 0xf0, 0x96,
-    0xf0, 0x97, 0xf0, 0x9d, 0xf0, 0xa0, 0xf0, 0xa2, 0xf0, 0xa4, 0xf0, 0xc5,
-    0xf0, 0xc7, 0xf0, 0xe0, 0xf0, 0xe5, 0xf0, 0xe6, 0xf0, 0xea, 0xf0, 0xf3,
-    0xf0, 0xf6, 0xf0, 0xf7, 0xf0, 0xf8, 0xf0, 0xfe, 0xf1, 0x0c, 0xf1, 0x11,
-    0xf1, 0x14, 0xf1, 0x15, 0xf1, 0x18, 0xf1, 0x1c, 0xf1, 0x1d, 0xf1, 0x23,
-    0xf1, 0x28, 0xf1, 0x2a, 0xf1, 0x33, 0xf1, 0x44, 0xf1, 0x46, 0xf1, 0x47,
-    0xf1, 0x4a, 0xf1, 0x4d, 0xf1, 0x50, 0xf1, 0x55, 0xf1, 0x5b, 0xf1, 0x64,
-    0xf1, 0x85, 0xf1, 0x8e, 0xf1, 0x90, 0xf1, 0x91, 0xf1, 0x96, 0xf1, 0xad,
-    0xf1, 0xc1, 0xf1, 0xcd, 0xf1, 0xd8, 0xf1, 0xd9, 0xf1, 0xdb, 0xf1, 0xe3,
-    0xf1, 0xea, 0xf1, 0xf6, 0xf1, 0xf7, 0xf1, 0xf9, 0xf1, 0xfa, 0xf2, 0x0a,
-    0xf2, 0x47, 0xf2, 0x4a, 0xf2, 0x4d, 0xf2, 0x50, 0xf2, 0x52, 0xf2, 0x54,
-    0xf2, 0x5d, 0xf2, 0x71, 0xf2, 0x78, 0xf2, 0x79, 0xf2, 0x7b, 0xf2, 0x83,
-    0xf2, 0x8b, 0xf2, 0x8c, 0xf2, 0x8d, 0xf2, 0x8e, 0xf2, 0x92, 0xf2, 0x95,
-    0xf2, 0x9c, 0xf2, 0xb4, 0xf2, 0xb7, 0xf2, 0xb9, 0xf2, 0xba, 0xf2, 0xbb,
-    0xf2, 0xbc, 0xf2, 0xbd, 0xf2, 0xbe, 0xf2, 0xc0, 0xf2, 0xc1, 0xf2, 0xc3,
-    0xf2, 0xd0, 0xf2, 0xd4, 0xf2, 0xdc, 0xf2, 0xed, 0xf3, 0x02, 0xf3, 0x28,
-    0xf3, 0x58, 0xf3, 0xa5, 0xf3, 0xd1, 0xf4, 0x10, 0xf4, 0x25, 0xf4, 0x3a,
-    0xf4, 0x3f, 0xf4, 0x41, 0xf4, 0x43, 0xf4, 0x45, 0xf4, 0x47, 0xf4, 0x5c,
-    0xf4, 0x7d, 0xf4, 0xad, 0xf4, 0xda, 0xf4, 0xe6, 0xf5, 0x2c, 0xf5, 0x31,
-    0xf5, 0x36, 0xf5, 0x41, 0xf5, 0x56, 0xf5, 0x67, 0xf5, 0x79, 0xf5, 0x7f,
-    0xf5, 0x96, 0xf5, 0xa4, 0xf5, 0xb3, 0xf5, 0xb8, 0xf5, 0xc0, 0xf5, 0xc2,
-    0xf5, 0xc8, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xdf, 0xff, 0xdb, 0xff, 0xd7,
-    0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1e, 0xab, 0x1e, 0x33, 0x00, 0x00, 0x10, 0x2e, 0x00, 0x00,
-    0x10, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1e, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x10, 0x14, 0x10, 0x13, 0x10, 0x0a, 0x0f, 0xfb, 0x0f, 0xf6,
-    0x00, 0x00, 0x00, 0x00, 0x0f, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0f, 0xd0, 0x0f, 0xcf, 0x0f, 0xcd, 0x0f, 0xcc, 0x0f, 0xc7,
-    0x0f, 0xc4, 0x0f, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbd, 0x00, 0x00,
-    0x0f, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xab, 0x0f, 0xa9, 0x00, 0x00,
-    0x0f, 0xa6, 0x0f, 0x89, 0x0f, 0x88, 0x0f, 0x71, 0x00, 0x00, 0x00, 0x00,
-    0x0f, 0x68, 0x0f, 0x61, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x5d, 0x0f, 0x58,
-    0x00, 0x00, 0x0f, 0x46, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x40, 0x0f, 0x3f,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x29, 0x0f, 0x19,
-    0x0f, 0x18, 0x00, 0x00, 0x0f, 0x15, 0x0f, 0x13, 0x0f, 0x12, 0x00, 0x00,
-    0x0f, 0x0a, 0x0f, 0x03, 0x0e, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xda,
-    0x00, 0x00, 0x0e, 0xc0, 0x0e, 0xad, 0x0e, 0xaa, 0x0e, 0xa0, 0x00, 0x00,
-    0x00, 0x00, 0x0e, 0x96, 0x0e, 0x90, 0x0e, 0x85, 0x00, 0x00, 0x0e, 0x83,
-    0x00, 0x00, 0x0e, 0x73, 0x0e, 0x37, 0x00, 0x00, 0x0e, 0x34, 0x00, 0x00,
-    0x0e, 0x30, 0x0e, 0x2f, 0x0e, 0x2e, 0x0e, 0x1b, 0x00, 0x00, 0x0e, 0x17,
-    0x00, 0x00, 0x00, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x0e, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe0, 0x00, 0x00, 0x0d, 0xde,
-    0x00, 0x00, 0x0d, 0xdd, 0x00, 0x00, 0x0d, 0xdc, 0x00, 0x00, 0x00, 0x00,
-    0x0d, 0xd9, 0x00, 0x00, 0x0d, 0xcc, 0x00, 0x00, 0x0d, 0xc3, 0x0d, 0xb3,
-    0x0d, 0x9f, 0x0d, 0x7a, 0x0d, 0x4b, 0x0d, 0x02, 0x0c, 0xd7, 0x0c, 0x99,
-    0x00, 0x00, 0x0c, 0x70, 0x0c, 0x6c, 0x0c, 0x6b, 0x0c, 0x6a, 0x0c, 0x69,
-    0x0c, 0x68, 0x0c, 0x54, 0x00, 0x00, 0x0c, 0x04, 0x0b, 0xd8, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x5d, 0x0b, 0x4d,
-    0x0b, 0x3c, 0x0b, 0x38, 0x0b, 0x2f, 0x0b, 0x28, 0x0b, 0x1b, 0x0b, 0x18,
-    0x0b, 0x11, 0x0b, 0x10, 0x0b, 0x0b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8,
-    0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8,
-    0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8,
-    0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8,
-    0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x01, 0xd8, 0x02, 0x22,
-    0x02, 0x2a, 0x02, 0x00, 0x02, 0x20, 0x02, 0x10, 0x01, 0xec, 0x01, 0xf4,
-    0x01, 0xe8, 0x01, 0xe6, 0x02, 0x04, 0x01, 0xf6, 0x01, 0xde, 0x01, 0xea,
-    0x02, 0x36, 0x02, 0x3a, 0x02, 0x3a, 0x02, 0x2e, 0x02, 0x30, 0x02, 0x30,
-    0x01, 0xb2, 0x01, 0xd8, 0x01, 0xd6, 0x01, 0xf2, 0x01, 0xdc, 0x01, 0xc8,
-    0x01, 0xf6, 0x01, 0xf6, 0x01, 0x60, 0x02, 0x08, 0x02, 0x06, 0x01, 0x64,
-    0x01, 0x62, 0x01, 0x4e, 0x01, 0x4c, 0x01, 0x94, 0x01, 0x52, 0x02, 0x12,
-    0x02, 0x10, 0x01, 0xb4, 0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa4,
-    0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0xe6, 0x01, 0xb0, 0x00, 0x00,
-    0x01, 0xe2, 0x01, 0xe6, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x9a, 0x01, 0x96, 0x00, 0x00, 0x01, 0x6a,
-    0x01, 0x6a, 0x01, 0x1c, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x84, 0x01, 0x84,
-    0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x01, 0x5e, 0x01, 0x46, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x3e, 0x01, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5e, 0x01, 0x66,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x46, 0x00, 0x00, 0x01, 0x2c, 0x01, 0x2c,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x01, 0x28, 0x00, 0xd6, 0x00, 0xc2,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64,
-    0x01, 0x60, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x28, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x22, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c,
-    0x00, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x01, 0x18, 0x00, 0x00, 0x01, 0x42, 0x00, 0xd6, 0x00, 0x00, 0x01, 0x10,
-    0x00, 0x00, 0x01, 0x0e, 0x00, 0x6a, 0x00, 0x6c, 0x00, 0xbc, 0x00, 0x00,
-    0x01, 0x08, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
-    0x01, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xc8, 0x00, 0x2e, 0x00, 0x2e, 0x00, 0x28, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
-    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
-    0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22,
-    0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28,
-    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e,
-    0x00, 0x2f, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x37, 0x00, 0x38,
-    0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43,
-    0x00, 0x45, 0x00, 0x46, 0x00, 0x48, 0x00, 0x4c, 0x00, 0x50, 0x00, 0x51,
-    0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x59, 0x00, 0x5b,
-    0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60, 0x00, 0x65, 0x00, 0x66,
-    0x00, 0x67, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6a, 0x00, 0x6d, 0x00, 0x78,
-    0x00, 0x79, 0x00, 0x7b, 0x00, 0x7c, 0x00, 0x80, 0x00, 0x83, 0x00, 0x85,
-    0x00, 0x8a, 0x00, 0x8b, 0x00, 0x90, 0x00, 0x92, 0x00, 0x93, 0x00, 0x94,
-    0x00, 0x96, 0x00, 0x97, 0x00, 0x98, 0x00, 0x99, 0x00, 0x9b, 0x00, 0x9f,
-    0x00, 0xa0, 0x00, 0xa3, 0x00, 0xa4, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0xa9,
-    0x00, 0xaa, 0x00, 0xab, 0x00, 0xac, 0x00, 0xad, 0x00, 0xae, 0x00, 0xaf,
-    0x00, 0xb0, 0x00, 0xb1, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x4c,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x00, 0x00, 0x00, 0x21,
-    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23,
-    0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2a,
-    0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x30,
-    0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c,
-    0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x61,
-    0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x62,
-    0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x63,
-    0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x64,
-    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x65,
-    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x66,
-    0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x67,
-    0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x68,
-    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x69,
-    0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x6a,
-    0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x6b,
-    0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6c,
-    0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x6d,
-    0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x6e,
-    0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x6f,
-    0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x70,
-    0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x71,
-    0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x72,
-    0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x73,
-    0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x74,
-    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x75,
-    0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x76,
-    0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x77,
-    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x78,
-    0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x79,
-    0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x7a,
-    0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xa9,
-    0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xae,
-    0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x23, 0x28,
-    0x00, 0x00, 0x23, 0x28, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x23, 0xf3,
-    0x00, 0x00, 0x23, 0xf3, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x23, 0xfe,
-    0x00, 0x00, 0x23, 0xfe, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x25, 0xa0,
-    0x00, 0x00, 0x25, 0xa0, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x25, 0xcf,
-    0x00, 0x00, 0x25, 0xcf, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x25, 0xfb,
-    0x00, 0x00, 0x25, 0xfb, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x25, 0xfc,
-    0x00, 0x00, 0x25, 0xfc, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x26, 0x00,
-    0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x26, 0x11,
-    0x00, 0x00, 0x26, 0x11, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x26, 0x1d,
-    0x00, 0x00, 0x26, 0x1d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x26, 0x39,
-    0x00, 0x00, 0x26, 0x39, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x26, 0x5a,
-    0x00, 0x00, 0x26, 0x5a, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x26, 0x5b,
-    0x00, 0x00, 0x26, 0x5b, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x26, 0x5c,
-    0x00, 0x00, 0x26, 0x5c, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x26, 0x5d,
-    0x00, 0x00, 0x26, 0x5d, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x26, 0x5e,
-    0x00, 0x00, 0x26, 0x5e, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x26, 0x5f,
-    0x00, 0x00, 0x26, 0x5f, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x26, 0x65,
-    0x00, 0x00, 0x26, 0x65, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x26, 0xaa,
-    0x00, 0x00, 0x26, 0xaa, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x26, 0xab,
-    0x00, 0x00, 0x26, 0xab, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x26, 0xbd,
-    0x00, 0x00, 0x26, 0xbd, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x27, 0x05,
-    0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x27, 0x09,
-    0x00, 0x00, 0x27, 0x09, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x27, 0x0b,
-    0x00, 0x00, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x27, 0x0c,
-    0x00, 0x00, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x27, 0x31,
-    0x00, 0x00, 0x27, 0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x27, 0x44,
-    0x00, 0x00, 0x27, 0x44, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x27, 0x46,
-    0x00, 0x00, 0x27, 0x46, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x27, 0x53,
-    0x00, 0x00, 0x27, 0x53, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x27, 0x54,
-    0x00, 0x00, 0x27, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x27, 0x55,
-    0x00, 0x00, 0x27, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27, 0x57,
-    0x00, 0x00, 0x27, 0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x27, 0x64,
-    0x00, 0x00, 0x27, 0x64, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x27, 0x95,
-    0x00, 0x00, 0x27, 0x95, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x2b, 0x1b,
-    0x00, 0x00, 0x2b, 0x1b, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x2b, 0x1c,
-    0x00, 0x00, 0x2b, 0x1c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x2b, 0x24,
-    0x00, 0x00, 0x2b, 0x24, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x2b, 0x50,
-    0x00, 0x00, 0x2b, 0x50, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0xe1, 0x85,
-    0x00, 0x00, 0xe1, 0x85, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xe1, 0xfe,
-    0x00, 0x00, 0xe1, 0xfe, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0xf0, 0x03,
-    0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0xf0, 0x04,
-    0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0xf0, 0x06,
-    0x00, 0x00, 0xf0, 0x06, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0xf0, 0x07,
-    0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0xf0, 0x14,
-    0x00, 0x00, 0xf0, 0x14, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xf0, 0x16,
-    0x00, 0x00, 0xf0, 0x16, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0xf0, 0x17,
-    0x00, 0x00, 0xf0, 0x17, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0xf0, 0x1a,
-    0x00, 0x00, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xf0, 0x1b,
-    0x00, 0x00, 0xf0, 0x1b, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0xf0, 0x1d,
-    0x00, 0x00, 0xf0, 0x1d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0xf0, 0x22,
-    0x00, 0x00, 0xf0, 0x22, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0xf0, 0x24,
-    0x00, 0x00, 0xf0, 0x24, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0xf0, 0x2e,
-    0x00, 0x00, 0xf0, 0x2e, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x3e,
-    0x00, 0x00, 0xf0, 0x3e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0xf0, 0x44,
-    0x00, 0x00, 0xf0, 0x44, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0xf0, 0x45,
-    0x00, 0x00, 0xf0, 0x45, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xf0, 0x46,
-    0x00, 0x00, 0xf0, 0x46, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0xf0, 0x57,
-    0x00, 0x00, 0xf0, 0x59, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0xf0, 0x5c,
-    0x00, 0x00, 0xf0, 0x5c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0xf0, 0x5d,
-    0x00, 0x00, 0xf0, 0x5d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xf0, 0x67,
-    0x00, 0x00, 0xf0, 0x67, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xf0, 0x69,
-    0x00, 0x00, 0xf0, 0x69, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xf0, 0x6e,
-    0x00, 0x00, 0xf0, 0x6e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xf0, 0x70,
-    0x00, 0x00, 0xf0, 0x70, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xf0, 0x73,
-    0x00, 0x00, 0xf0, 0x73, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xf0, 0x75,
-    0x00, 0x00, 0xf0, 0x75, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xf0, 0x7b,
-    0x00, 0x00, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xf0, 0x80,
-    0x00, 0x00, 0xf0, 0x80, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0xf0, 0x86,
-    0x00, 0x00, 0xf0, 0x86, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0xf0, 0x87,
-    0x00, 0x00, 0xf0, 0x87, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0xf0, 0x88,
-    0x00, 0x00, 0xf0, 0x88, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0xf0, 0x89,
-    0x00, 0x00, 0xf0, 0x89, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0xf0, 0x8a,
-    0x00, 0x00, 0xf0, 0x8a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0xf0, 0x94,
-    0x00, 0x00, 0xf0, 0x94, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0xf0, 0x96,
-    0x00, 0x00, 0xf0, 0x96, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xf0, 0x97,
-    0x00, 0x00, 0xf0, 0x97, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xf0, 0x9d,
-    0x00, 0x00, 0xf0, 0x9d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0xf0, 0xa0,
-    0x00, 0x00, 0xf0, 0xa0, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0xf0, 0xa2,
-    0x00, 0x00, 0xf0, 0xa2, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xf0, 0xa4,
-    0x00, 0x00, 0xf0, 0xa7, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0xf0, 0xc5,
-    0x00, 0x00, 0xf0, 0xc5, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0xf0, 0xc7,
-    0x00, 0x00, 0xf0, 0xc8, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0xf0, 0xe0,
-    0x00, 0x00, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0xf0, 0xe5,
-    0x00, 0x00, 0xf0, 0xe5, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0xf0, 0xe6,
-    0x00, 0x00, 0xf0, 0xe6, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0xf0, 0xea,
-    0x00, 0x00, 0xf0, 0xeb, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0xf0, 0xf3,
-    0x00, 0x00, 0xf0, 0xf3, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0xf0, 0xf6,
-    0x00, 0x00, 0xf0, 0xf6, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0xf0, 0xf7,
-    0x00, 0x00, 0xf0, 0xf7, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0xf0, 0xf8,
-    0x00, 0x00, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xf0, 0xfe,
-    0x00, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0xf1, 0x0c,
-    0x00, 0x00, 0xf1, 0x0c, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0xf1, 0x11,
-    0x00, 0x00, 0xf1, 0x11, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0xf1, 0x14,
-    0x00, 0x00, 0xf1, 0x14, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xf1, 0x15,
-    0x00, 0x00, 0xf1, 0x15, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0xf1, 0x18,
-    0x00, 0x00, 0xf1, 0x1a, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0xf1, 0x1c,
-    0x00, 0x00, 0xf1, 0x1c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0xf1, 0x1d,
-    0x00, 0x00, 0xf1, 0x1d, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0xf1, 0x23,
-    0x00, 0x00, 0xf1, 0x23, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0xf1, 0x28,
-    0x00, 0x00, 0xf1, 0x28, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xf1, 0x2a,
-    0x00, 0x00, 0xf1, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf1, 0x33,
-    0x00, 0x00, 0xf1, 0x33, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0xf1, 0x44,
-    0x00, 0x00, 0xf1, 0x44, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0xf1, 0x46,
-    0x00, 0x00, 0xf1, 0x46, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0xf1, 0x47,
-    0x00, 0x00, 0xf1, 0x47, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0xf1, 0x4a,
-    0x00, 0x00, 0xf1, 0x4a, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0xf1, 0x4d,
-    0x00, 0x00, 0xf1, 0x4e, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0xf1, 0x50,
-    0x00, 0x00, 0xf1, 0x52, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0xf1, 0x55,
-    0x00, 0x00, 0xf1, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xf1, 0x5b,
-    0x00, 0x00, 0xf1, 0x5c, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0xf1, 0x64,
-    0x00, 0x00, 0xf1, 0x65, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0xf1, 0x85,
-    0x00, 0x00, 0xf1, 0x86, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xf1, 0x8e,
-    0x00, 0x00, 0xf1, 0x8e, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xf1, 0x90,
-    0x00, 0x00, 0xf1, 0x90, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xf1, 0x91,
-    0x00, 0x00, 0xf1, 0x92, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0xf1, 0x96,
-    0x00, 0x00, 0xf1, 0x96, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0xf1, 0xad,
-    0x00, 0x00, 0xf1, 0xad, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0xf1, 0xc1,
-    0x00, 0x00, 0xf1, 0xc9, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0xf1, 0xcd,
-    0x00, 0x00, 0xf1, 0xcd, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0xf1, 0xd8,
-    0x00, 0x00, 0xf1, 0xd8, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf1, 0xd9,
-    0x00, 0x00, 0xf1, 0xd9, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0xf1, 0xdb,
-    0x00, 0x00, 0xf1, 0xdb, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0xf1, 0xe3,
-    0x00, 0x00, 0xf1, 0xe3, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0xf1, 0xea,
-    0x00, 0x00, 0xf1, 0xea, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0xf1, 0xf6,
-    0x00, 0x00, 0xf1, 0xf6, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0xf1, 0xf7,
-    0x00, 0x00, 0xf1, 0xf7, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0xf1, 0xf9,
-    0x00, 0x00, 0xf1, 0xf9, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xf1, 0xfa,
-    0x00, 0x00, 0xf1, 0xfa, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0xf2, 0x0a,
-    0x00, 0x00, 0xf2, 0x0a, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xf2, 0x47,
-    0x00, 0x00, 0xf2, 0x49, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0xf2, 0x4a,
-    0x00, 0x00, 0xf2, 0x4a, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xf2, 0x4d,
-    0x00, 0x00, 0xf2, 0x4d, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0xf2, 0x50,
-    0x00, 0x00, 0xf2, 0x50, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0xf2, 0x52,
-    0x00, 0x00, 0xf2, 0x52, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0xf2, 0x54,
-    0x00, 0x00, 0xf2, 0x5b, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0xf2, 0x5d,
-    0x00, 0x00, 0xf2, 0x5d, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0xf2, 0x71,
-    0x00, 0x00, 0xf2, 0x74, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0xf2, 0x78,
-    0x00, 0x00, 0xf2, 0x78, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf2, 0x79,
-    0x00, 0x00, 0xf2, 0x7a, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xf2, 0x7b,
-    0x00, 0x00, 0xf2, 0x7b, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0xf2, 0x83,
-    0x00, 0x00, 0xf2, 0x83, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0xf2, 0x8b,
-    0x00, 0x00, 0xf2, 0x8b, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0xf2, 0x8c,
-    0x00, 0x00, 0xf2, 0x8c, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0xf2, 0x8d,
-    0x00, 0x00, 0xf2, 0x8d, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0xf2, 0x8e,
-    0x00, 0x00, 0xf2, 0x8e, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0xf2, 0x92,
-    0x00, 0x00, 0xf2, 0x92, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf2, 0x95,
-    0x00, 0x00, 0xf2, 0x95, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf2, 0x9c,
-    0x00, 0x00, 0xf2, 0x9c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0xf2, 0xb4,
-    0x00, 0x00, 0xf2, 0xb6, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0xf2, 0xb7,
-    0x00, 0x00, 0xf2, 0xb7, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0xf2, 0xb9,
-    0x00, 0x00, 0xf2, 0xb9, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0xf2, 0xba,
-    0x00, 0x00, 0xf2, 0xba, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0xf2, 0xbb,
-    0x00, 0x00, 0xf2, 0xbb, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0xf2, 0xbc,
-    0x00, 0x00, 0xf2, 0xbc, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0xf2, 0xbd,
-    0x00, 0x00, 0xf2, 0xbd, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0xf2, 0xbe,
-    0x00, 0x00, 0xf2, 0xbe, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0xf2, 0xc0,
-    0x00, 0x00, 0xf2, 0xc0, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0xf2, 0xc1,
-    0x00, 0x00, 0xf2, 0xc2, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0xf2, 0xc3,
-    0x00, 0x00, 0xf2, 0xc3, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0xf2, 0xd0,
-    0x00, 0x00, 0xf2, 0xd2, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0xf2, 0xd4,
-    0x00, 0x00, 0xf2, 0xd4, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0xf2, 0xdc,
-    0x00, 0x00, 0xf2, 0xdc, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0xf2, 0xed,
-    0x00, 0x00, 0xf2, 0xed, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0xf3, 0x02,
-    0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0xf3, 0x28,
-    0x00, 0x00, 0xf3, 0x28, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0xf3, 0x58,
-    0x00, 0x00, 0xf3, 0x5b, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xf3, 0xa5,
-    0x00, 0x00, 0xf3, 0xa5, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0xf3, 0xd1,
-    0x00, 0x00, 0xf3, 0xd1, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0xf4, 0x10,
-    0x00, 0x00, 0xf4, 0x10, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0xf4, 0x25,
-    0x00, 0x00, 0xf4, 0x25, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0xf4, 0x3a,
-    0x00, 0x00, 0xf4, 0x3a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0xf4, 0x3f,
-    0x00, 0x00, 0xf4, 0x3f, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0xf4, 0x41,
-    0x00, 0x00, 0xf4, 0x41, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0xf4, 0x43,
-    0x00, 0x00, 0xf4, 0x43, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0xf4, 0x45,
-    0x00, 0x00, 0xf4, 0x45, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0xf4, 0x47,
-    0x00, 0x00, 0xf4, 0x47, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xf4, 0x5c,
-    0x00, 0x00, 0xf4, 0x5c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0xf4, 0x7d,
-    0x00, 0x00, 0xf4, 0x7d, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xf4, 0xad,
-    0x00, 0x00, 0xf4, 0xad, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0xf4, 0xda,
-    0x00, 0x00, 0xf4, 0xda, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0xf4, 0xe6,
-    0x00, 0x00, 0xf4, 0xe6, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0xf5, 0x2c,
-    0x00, 0x00, 0xf5, 0x2c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0xf5, 0x31,
-    0x00, 0x00, 0xf5, 0x31, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0xf5, 0x36,
-    0x00, 0x00, 0xf5, 0x36, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xf5, 0x41,
-    0x00, 0x00, 0xf5, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xf5, 0x56,
-    0x00, 0x00, 0xf5, 0x56, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0xf5, 0x67,
-    0x00, 0x00, 0xf5, 0x67, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0xf5, 0x79,
-    0x00, 0x00, 0xf5, 0x7a, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0xf5, 0x7f,
-    0x00, 0x00, 0xf5, 0x8c, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0xf5, 0x96,
-    0x00, 0x00, 0xf5, 0x9c, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0xf5, 0xa4,
-    0x00, 0x00, 0xf5, 0xa5, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xf5, 0xb3,
-    0x00, 0x00, 0xf5, 0xb4, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0xf5, 0xb8,
-    0x00, 0x00, 0xf5, 0xb8, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0xf5, 0xc0,
-    0x00, 0x00, 0xf5, 0xc0, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0xf5, 0xc2,
-    0x00, 0x00, 0xf5, 0xc2, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0xf5, 0xc8,
-    0x00, 0x00, 0xf5, 0xc8, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x01, 0xf3, 0x19,
-    0x00, 0x01, 0xf3, 0x19, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x01, 0xf3, 0x4b,
-    0x00, 0x01, 0xf3, 0x4b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x01, 0xf3, 0xe2,
-    0x00, 0x01, 0xf3, 0xe2, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x01, 0xf3, 0xe5,
-    0x00, 0x01, 0xf3, 0xe5, 0x00, 0x00, 0x00, 0x55, 0x00, 0x01, 0xf3, 0xf4,
-    0x00, 0x01, 0xf3, 0xf4, 0x00, 0x00, 0x00, 0x37, 0x00, 0x01, 0xf4, 0x41,
-    0x00, 0x01, 0xf4, 0x41, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x01, 0xf4, 0x4d,
-    0x00, 0x01, 0xf4, 0x4d, 0x00, 0x00, 0x00, 0x67, 0x00, 0x01, 0xf4, 0x4e,
-    0x00, 0x01, 0xf4, 0x4e, 0x00, 0x00, 0x00, 0x68, 0x00, 0x01, 0xf4, 0x64,
-    0x00, 0x01, 0xf4, 0x64, 0x00, 0x00, 0x00, 0x34, 0x00, 0x01, 0xf4, 0x8e,
-    0x00, 0x01, 0xf4, 0x8e, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x01, 0xf4, 0x99,
-    0x00, 0x01, 0xf4, 0x99, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf4, 0x9a,
-    0x00, 0x01, 0xf4, 0x9a, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf4, 0x9b,
-    0x00, 0x01, 0xf4, 0x9b, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf4, 0x9c,
-    0x00, 0x01, 0xf4, 0x9c, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf4, 0xa1,
-    0x00, 0x01, 0xf4, 0xa1, 0x00, 0x00, 0x00, 0x53, 0x00, 0x01, 0xf4, 0xac,
-    0x00, 0x01, 0xf4, 0xac, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x01, 0xf4, 0xb2,
-    0x00, 0x01, 0xf4, 0xb2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0xf4, 0xb3,
-    0x00, 0x01, 0xf4, 0xb3, 0x00, 0x00, 0x00, 0x48, 0x00, 0x01, 0xf4, 0xbe,
-    0x00, 0x01, 0xf4, 0xbe, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x01, 0xf4, 0xc1,
-    0x00, 0x01, 0xf4, 0xc1, 0x00, 0x00, 0x00, 0x42, 0x00, 0x01, 0xf4, 0xc2,
-    0x00, 0x01, 0xf4, 0xc2, 0x00, 0x00, 0x00, 0x43, 0x00, 0x01, 0xf4, 0xc4,
-    0x00, 0x01, 0xf4, 0xc4, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xf4, 0xc5,
-    0x00, 0x01, 0xf4, 0xc5, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x01, 0xf4, 0xc6,
-    0x00, 0x01, 0xf4, 0xc6, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x01, 0xf4, 0xcb,
-    0x00, 0x01, 0xf4, 0xcb, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x01, 0xf4, 0xf0,
-    0x00, 0x01, 0xf4, 0xf0, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x01, 0xf5, 0x14,
-    0x00, 0x01, 0xf5, 0x14, 0x00, 0x00, 0x00, 0x54, 0x00, 0x01, 0xf5, 0x15,
-    0x00, 0x01, 0xf5, 0x15, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x01, 0xf5, 0x16,
-    0x00, 0x01, 0xf5, 0x16, 0x00, 0x00, 0x00, 0x38, 0x00, 0x01, 0xf5, 0x18,
-    0x00, 0x01, 0xf5, 0x18, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x01, 0xf5, 0x34,
-    0x00, 0x01, 0xf5, 0x34, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf5, 0x35,
-    0x00, 0x01, 0xf5, 0x35, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf5, 0x53,
-    0x00, 0x01, 0xf5, 0x53, 0x00, 0x00, 0x00, 0x35, 0x00, 0x01, 0xf5, 0x82,
-    0x00, 0x01, 0xf5, 0x82, 0x00, 0x00, 0x00, 0x51, 0x00, 0x01, 0xf5, 0x96,
-    0x00, 0x01, 0xf5, 0x96, 0x00, 0x00, 0x00, 0x88, 0x00, 0x01, 0xf5, 0xa4,
-    0x00, 0x01, 0xf5, 0xa4, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf5, 0xaa,
-    0x00, 0x01, 0xf5, 0xaa, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x01, 0xf5, 0xb4,
-    0x00, 0x01, 0xf5, 0xb4, 0x00, 0x00, 0x00, 0x49, 0x00, 0x01, 0xf5, 0xb9,
-    0x00, 0x01, 0xf5, 0xb9, 0x00, 0x00, 0x00, 0x66, 0x00, 0x01, 0xf5, 0xbb,
-    0x00, 0x01, 0xf5, 0xbb, 0x00, 0x00, 0x00, 0x72, 0x00, 0x01, 0xf5, 0xbf,
-    0x00, 0x01, 0xf5, 0xbf, 0x00, 0x00, 0x00, 0x42, 0x00, 0x01, 0xf5, 0xc1,
-    0x00, 0x01, 0xf5, 0xc1, 0x00, 0x00, 0x00, 0x43, 0x00, 0x01, 0xf5, 0xcb,
-    0x00, 0x01, 0xf5, 0xcb, 0x00, 0x00, 0x00, 0x65, 0x00, 0x01, 0xf5, 0xce,
-    0x00, 0x01, 0xf5, 0xce, 0x00, 0x00, 0x00, 0x66, 0x00, 0x01, 0xf5, 0xd5,
-    0x00, 0x01, 0xf5, 0xd5, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x01, 0xf5, 0xd6,
-    0x00, 0x01, 0xf5, 0xd6, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x01, 0xf5, 0xe9,
-    0x00, 0x01, 0xf5, 0xe9, 0x00, 0x00, 0x00, 0x41, 0x00, 0x01, 0xf5, 0xea,
-    0x00, 0x01, 0xf5, 0xea, 0x00, 0x00, 0x00, 0x45, 0x00, 0x01, 0xf5, 0xfa,
-    0x00, 0x01, 0xf5, 0xfa, 0x00, 0x00, 0x00, 0x90, 0x00, 0x01, 0xf6, 0x00,
-    0x00, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x01, 0xf6, 0x01,
-    0x00, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x01, 0xf6, 0x02,
-    0x00, 0x01, 0xf6, 0x02, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x01, 0xf6, 0x03,
-    0x00, 0x01, 0xf6, 0x03, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x01, 0xf6, 0x04,
-    0x00, 0x01, 0xf6, 0x04, 0x00, 0x00, 0x00, 0xba, 0x00, 0x01, 0xf6, 0x05,
-    0x00, 0x01, 0xf6, 0x05, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x01, 0xf6, 0x06,
-    0x00, 0x01, 0xf6, 0x06, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x01, 0xf6, 0x09,
-    0x00, 0x01, 0xf6, 0x09, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x01, 0xf6, 0x0a,
-    0x00, 0x01, 0xf6, 0x0a, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x01, 0xf6, 0x0d,
-    0x00, 0x01, 0xf6, 0x0d, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x01, 0xf6, 0x10,
-    0x00, 0x01, 0xf6, 0x10, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x01, 0xf6, 0x17,
-    0x00, 0x01, 0xf6, 0x17, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x01, 0xf6, 0x18,
-    0x00, 0x01, 0xf6, 0x18, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x01, 0xf6, 0x19,
-    0x00, 0x01, 0xf6, 0x19, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x01, 0xf6, 0x1b,
-    0x00, 0x01, 0xf6, 0x1b, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x01, 0xf6, 0x1c,
-    0x00, 0x01, 0xf6, 0x1c, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x01, 0xf6, 0x1d,
-    0x00, 0x01, 0xf6, 0x1d, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x01, 0xf6, 0x20,
-    0x00, 0x01, 0xf6, 0x20, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x01, 0xf6, 0x22,
-    0x00, 0x01, 0xf6, 0x22, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x01, 0xf6, 0x26,
-    0x00, 0x01, 0xf6, 0x26, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x01, 0xf6, 0x2b,
-    0x00, 0x01, 0xf6, 0x2b, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x01, 0xf6, 0x2c,
-    0x00, 0x01, 0xf6, 0x2c, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x01, 0xf6, 0x2d,
-    0x00, 0x01, 0xf6, 0x2d, 0x00, 0x00, 0x00, 0xce, 0x00, 0x01, 0xf6, 0x2e,
-    0x00, 0x01, 0xf6, 0x2e, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x01, 0xf6, 0x33,
-    0x00, 0x01, 0xf6, 0x33, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x01, 0xf6, 0x36,
-    0x00, 0x01, 0xf6, 0x36, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x01, 0xf6, 0x42,
-    0x00, 0x01, 0xf6, 0x42, 0x00, 0x00, 0x00, 0x58, 0x00, 0x01, 0xf6, 0x44,
-    0x00, 0x01, 0xf6, 0x44, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x01, 0xf7, 0xe0,
-    0x00, 0x01, 0xf7, 0xe0, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf7, 0xe1,
-    0x00, 0x01, 0xf7, 0xe1, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf7, 0xe2,
-    0x00, 0x01, 0xf7, 0xe2, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf7, 0xe3,
-    0x00, 0x01, 0xf7, 0xe3, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf7, 0xe4,
-    0x00, 0x01, 0xf7, 0xe4, 0x00, 0x00, 0x00, 0x57, 0x00, 0x01, 0xf7, 0xe5,
-    0x00, 0x01, 0xf7, 0xe5, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xe6,
-    0x00, 0x01, 0xf7, 0xe6, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xe7,
-    0x00, 0x01, 0xf7, 0xe7, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xe8,
-    0x00, 0x01, 0xf7, 0xe8, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xe9,
-    0x00, 0x01, 0xf7, 0xe9, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xea,
-    0x00, 0x01, 0xf7, 0xea, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf7, 0xeb,
-    0x00, 0x01, 0xf7, 0xeb, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x01, 0xf9, 0x0d,
-    0x00, 0x01, 0xf9, 0x0d, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf9, 0x0e,
-    0x00, 0x01, 0xf9, 0x0e, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf9, 0x1a,
-    0x00, 0x01, 0xf9, 0x1a, 0x00, 0x00, 0x00, 0x85, 0x00, 0x01, 0xf9, 0x23,
-    0x00, 0x01, 0xf9, 0x23, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x01, 0xf9, 0x29,
-    0x00, 0x01, 0xf9, 0x29, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x01, 0xf9, 0xe1,
-    0x00, 0x01, 0xf9, 0xe1, 0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0xf9, 0xed,
-    0x00, 0x01, 0xf9, 0xed, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x50,
-    0x00, 0x82, 0x00, 0xea, 0x01, 0x72, 0x01, 0xb8, 0x01, 0xfc, 0x02, 0x2a,
-    0x02, 0x6e, 0x02, 0x9c, 0x02, 0xde, 0x03, 0x32, 0x03, 0x6a, 0x03, 0xba,
-    0x04, 0x02, 0x04, 0x26, 0x04, 0xa6, 0x04, 0xee, 0x05, 0x14, 0x05, 0x3e,
-    0x05, 0x64, 0x05, 0xc6, 0x06, 0x4a, 0x06, 0x7a, 0x06, 0xda, 0x07, 0x1c,
-    0x07, 0x62, 0x07, 0xa0, 0x07, 0xd2, 0x08, 0x22, 0x08, 0x54, 0x08, 0x82,
-    0x08, 0xb8, 0x08, 0xea, 0x09, 0x0a, 0x09, 0x42, 0x09, 0x72, 0x09, 0xc2,
-    0x0a, 0x04, 0x0a, 0x5e, 0x0a, 0xaa, 0x0b, 0x34, 0x0b, 0x58, 0x0b, 0x8c,
-    0x0b, 0xb2, 0x0b, 0xee, 0x0c, 0x20, 0x0c, 0x46, 0x0c, 0x76, 0x0c, 0xce,
-    0x0d, 0x1e, 0x0d, 0x98, 0x0d, 0xfc, 0x0e, 0x6e, 0x0e, 0xd8, 0x0f, 0x92,
-    0x0f, 0xee, 0x10, 0x2a, 0x10, 0x8e, 0x11, 0x22, 0x11, 0x9e, 0x12, 0x08,
-    0x12, 0xa4, 0x13, 0x62, 0x14, 0x1c, 0x14, 0xb8, 0x15, 0x2c, 0x15, 0x7a,
-    0x15, 0xce, 0x16, 0x2e, 0x16, 0xe2, 0x17, 0x24, 0x17, 0xca, 0x18, 0x36,
-    0x18, 0xaa, 0x19, 0x6c, 0x1a, 0x2e, 0x1a, 0xf4, 0x1b, 0xba, 0x1c, 0x28,
-    0x1c, 0x98, 0x1c, 0xda, 0x1d, 0x32, 0x1d, 0xc0, 0x1e, 0x4e, 0x1e, 0xb6,
-    0x23, 0x8a, 0x23, 0xf2, 0x24, 0x42, 0x24, 0xea, 0x25, 0x90, 0x26, 0x22,
-    0x27, 0x4a, 0x27, 0xa0, 0x28, 0x08, 0x28, 0x5c, 0x28, 0xb8, 0x29, 0x7e,
-    0x2a, 0x06, 0x2a, 0x60, 0x2a, 0xba, 0x2b, 0x14, 0x2b, 0x5a, 0x2b, 0xc0,
-    0x2c, 0x72, 0x2d, 0x24, 0x2d, 0xf4, 0x2e, 0x6c, 0x2e, 0xc4, 0x2f, 0x38,
-    0x2f, 0xdc, 0x30, 0x92, 0x31, 0x0a, 0x31, 0x7c, 0x31, 0xf2, 0x32, 0x70,
-    0x33, 0x14, 0x33, 0x94, 0x34, 0x0a, 0x34, 0x82, 0x35, 0x2c, 0x35, 0x76,
-    0x36, 0x30, 0x36, 0xe0, 0x37, 0x5c, 0x37, 0xda, 0x38, 0x82, 0x39, 0x18,
-    0x3a, 0x58, 0x3a, 0xa0, 0x3b, 0x0c, 0x3b, 0x6c, 0x3b, 0xd8, 0x3c, 0x8a,
-    0x3d, 0x44, 0x3d, 0xfc, 0x3e, 0x74, 0x3f, 0x28, 0x3f, 0xf8, 0x40, 0xd6,
-    0x41, 0x60, 0x41, 0xdc, 0x42, 0x46, 0x42, 0xca, 0x43, 0x3e, 0x43, 0x96,
-    0x43, 0xf8, 0x44, 0x6e, 0x44, 0xdc, 0x45, 0x28, 0x46, 0x1c, 0x46, 0x7a,
-    0x47, 0x1c, 0x47, 0xac, 0x48, 0x3a, 0x48, 0xba, 0x49, 0x3c, 0x49, 0x80,
-    0x49, 0x98, 0x4a, 0x0a, 0x4a, 0xdc, 0x4b, 0x78, 0x4c, 0x06, 0x4c, 0x70,
-    0x4c, 0xe8, 0x4d, 0x60, 0x4d, 0xd8, 0x4e, 0x50, 0x4e, 0xa0, 0x4f, 0x30,
-    0x4f, 0x9a, 0x50, 0x3c, 0x50, 0xba, 0x51, 0x5a, 0x51, 0xd0, 0x52, 0x64,
-    0x52, 0xfe, 0x53, 0x26, 0x53, 0xe2, 0x54, 0x8a, 0x55, 0x44, 0x55, 0xfe,
-    0x56, 0xce, 0x57, 0x6e, 0x58, 0x3c, 0x58, 0xde, 0x59, 0x82, 0x5a, 0x66,
-    0x5b, 0x70, 0x5c, 0x2e, 0x5c, 0xe0, 0x5d, 0xd4, 0x5e, 0xa8, 0x5f, 0xe6,
-    0x60, 0xa6, 0x61, 0x76, 0x62, 0x52, 0x62, 0xf4, 0x63, 0xfe, 0x65, 0x4c,
-    0x66, 0x78, 0x67, 0x16, 0x67, 0xf6, 0x68, 0xa4, 0x69, 0x42, 0x69, 0xc4,
-    0x6a, 0x98, 0x6b, 0x48, 0x6b, 0xf8, 0x6c, 0xe4, 0x6d, 0x3a, 0x6d, 0xd0,
-    0x6e, 0x84, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x35,
-    0x00, 0x00, 0x37, 0x37, 0x07, 0x37, 0x27, 0x31, 0x11, 0x17, 0x33, 0x23,
-    0x33, 0x27, 0x31, 0x07, 0x37, 0x17, 0x27, 0x17, 0x11, 0x31, 0x07, 0x37,
-    0x23, 0x33, 0x23, 0x17, 0x31, 0x37, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x30, 0x73, 0x73, 0x73,
-    0x73, 0x1d, 0xe6, 0xe6, 0xe6, 0x73, 0x73, 0x90, 0x73, 0x73, 0x73, 0x73,
-    0x56, 0xe6, 0xe6, 0xe6, 0x73, 0x73, 0xfe, 0xcd, 0x01, 0x0d, 0x0e, 0x14,
-    0x01, 0x20, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0xfe, 0xe0,
-    0x14, 0x0e, 0x0d, 0x01, 0x1a, 0xa6, 0xa6, 0xa6, 0xa6, 0xfe, 0xb4, 0x2a,
-    0xa6, 0xa6, 0xd0, 0xa6, 0xa6, 0xa6, 0x01, 0x4c, 0xa6, 0xd0, 0xa6, 0xa6,
-    0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0xfe, 0x60, 0x14, 0x0e,
-    0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x01, 0xa0, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x00, 0x40, 0x01, 0xa0, 0x00, 0x0b, 0x00, 0x1e, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x36, 0x37, 0x11,
-    0x03, 0x32, 0x37, 0x31, 0x31, 0x36, 0x35, 0x34, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x38, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x18, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x01, 0x88, 0x16, 0x02, 0x02, 0x16, 0xfe,
-    0xe0, 0x16, 0x02, 0x02, 0x16, 0x01, 0x20, 0xfe, 0x58, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xde, 0x01, 0xc0, 0x01, 0xa2, 0x00, 0x48,
-    0x00, 0x51, 0x00, 0x00, 0x13, 0x16, 0x07, 0x07, 0x31, 0x33, 0x31, 0x37,
-    0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x33, 0x31, 0x16, 0x17, 0x06,
-    0x07, 0x23, 0x31, 0x07, 0x31, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23,
-    0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x23, 0x31, 0x07,
-    0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x23, 0x31, 0x26, 0x27, 0x36,
-    0x37, 0x33, 0x31, 0x37, 0x31, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x33,
-    0x31, 0x37, 0x31, 0x36, 0x17, 0x07, 0x07, 0x37, 0x07, 0x33, 0x31, 0x37,
-    0x31, 0x23, 0xbd, 0x15, 0x02, 0x0f, 0x6f, 0x10, 0x07, 0x16, 0x15, 0x03,
-    0x0e, 0x47, 0x16, 0x02, 0x02, 0x16, 0x51, 0x1d, 0x4e, 0x16, 0x02, 0x02,
-    0x16, 0x57, 0x11, 0x07, 0x16, 0x15, 0x03, 0x0f, 0x6f, 0x11, 0x07, 0x16,
-    0x15, 0x03, 0x0f, 0x48, 0x16, 0x02, 0x02, 0x16, 0x51, 0x1d, 0x4e, 0x16,
-    0x02, 0x02, 0x16, 0x58, 0x10, 0x07, 0x16, 0x06, 0x1d, 0x1d, 0x1d, 0x6f,
-    0x1d, 0x6f, 0x01, 0x9f, 0x06, 0x16, 0x4b, 0x55, 0x15, 0x03, 0x06, 0x16,
-    0x4b, 0x02, 0x16, 0x16, 0x02, 0x90, 0x02, 0x16, 0x16, 0x02, 0x55, 0x15,
-    0x02, 0x07, 0x16, 0x4b, 0x55, 0x15, 0x02, 0x07, 0x16, 0x4b, 0x02, 0x16,
-    0x16, 0x02, 0x90, 0x02, 0x16, 0x16, 0x02, 0x55, 0x15, 0x03, 0x97, 0x90,
-    0x90, 0x90, 0x90, 0x00, 0x00, 0x01, 0x00, 0x0b, 0xff, 0xc0, 0x01, 0x34,
-    0x01, 0xc0, 0x00, 0x5d, 0x00, 0x00, 0x13, 0x26, 0x27, 0x06, 0x07, 0x15,
-    0x31, 0x22, 0x23, 0x06, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06,
-    0x07, 0x06, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x07, 0x06, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x31, 0x31, 0x32, 0x17, 0x32, 0x33, 0x15, 0x31, 0x16,
-    0x17, 0x36, 0x37, 0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36,
-    0x27, 0x26, 0x27, 0x35, 0xb8, 0x02, 0x16, 0x16, 0x02, 0x05, 0x04, 0x24,
-    0x1f, 0x21, 0x09, 0x06, 0x0c, 0x0d, 0x16, 0x14, 0x19, 0x18, 0x18, 0x02,
-    0x34, 0x1e, 0x0d, 0x04, 0x05, 0x03, 0x04, 0x1f, 0x21, 0x36, 0x12, 0x18,
-    0x18, 0x11, 0x15, 0x0b, 0x07, 0x13, 0x15, 0x1c, 0x1b, 0x14, 0x03, 0x02,
-    0x03, 0x02, 0x02, 0x16, 0x16, 0x02, 0x1d, 0x19, 0x33, 0x0d, 0x06, 0x0c,
-    0x0d, 0x16, 0x14, 0x19, 0x18, 0x18, 0x02, 0x34, 0x1e, 0x0d, 0x04, 0x05,
-    0x03, 0x05, 0x0f, 0x11, 0x1d, 0x1d, 0x1e, 0x1f, 0x18, 0x15, 0x07, 0x04,
-    0x15, 0x1e, 0x2a, 0x01, 0xa8, 0x16, 0x02, 0x02, 0x16, 0x30, 0x02, 0x12,
-    0x14, 0x2a, 0x1f, 0x18, 0x18, 0x0d, 0x0c, 0x07, 0x08, 0x06, 0x0c, 0x10,
-    0x09, 0x08, 0x08, 0x11, 0x16, 0x0d, 0x0d, 0x07, 0x03, 0x06, 0x06, 0x08,
-    0x07, 0x14, 0x15, 0x0a, 0x09, 0x07, 0x07, 0x03, 0x01, 0x32, 0x16, 0x02,
-    0x02, 0x16, 0x31, 0x01, 0x0a, 0x11, 0x35, 0x1f, 0x18, 0x18, 0x0d, 0x0c,
-    0x07, 0x08, 0x06, 0x0c, 0x10, 0x09, 0x08, 0x08, 0x11, 0x15, 0x09, 0x0b,
-    0x02, 0x02, 0x04, 0x05, 0x06, 0x03, 0x15, 0x16, 0x07, 0x08, 0x05, 0x31,
-    0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x01, 0x7f, 0x01, 0x7f, 0x00, 0x0b,
-    0x00, 0x18, 0x00, 0x25, 0x00, 0x00, 0x01, 0x36, 0x27, 0x26, 0x07, 0x01,
-    0x31, 0x06, 0x17, 0x16, 0x37, 0x01, 0x05, 0x26, 0x27, 0x26, 0x07, 0x06,
-    0x07, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x01, 0x26, 0x27, 0x26, 0x07,
-    0x06, 0x07, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x01, 0x71, 0x0e, 0x0e,
-    0x11, 0x11, 0xfe, 0xc0, 0x0e, 0x0e, 0x11, 0x11, 0x01, 0x40, 0xfe, 0xff,
-    0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01,
-    0x01, 0x00, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x01, 0x17, 0x18, 0x18,
-    0x17, 0x01, 0x01, 0x4f, 0x11, 0x11, 0x0e, 0x0e, 0xfe, 0xc0, 0x11, 0x11,
-    0x0e, 0x0e, 0x01, 0x40, 0x0f, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x1b,
-    0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0xff, 0x00, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f,
-    0x1b, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x00, 0x00, 0x01, 0xff, 0xfa,
-    0xff, 0xe0, 0x01, 0x86, 0x01, 0xa0, 0x00, 0x30, 0x00, 0x00, 0x13, 0x16,
-    0x17, 0x15, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x17,
-    0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26,
-    0x27, 0x35, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x27,
-    0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x35, 0x31, 0x36, 0x37, 0xc0,
-    0x16, 0x02, 0x83, 0x14, 0x0d, 0x0a, 0x11, 0x87, 0x87, 0x11, 0x0a, 0x0d,
-    0x14, 0x83, 0x02, 0x16, 0x16, 0x02, 0x83, 0x14, 0x0d, 0x0a, 0x11, 0x87,
-    0x87, 0x11, 0x0a, 0x0d, 0x14, 0x83, 0x02, 0x16, 0x01, 0xa0, 0x02, 0x16,
-    0x9d, 0x51, 0x0a, 0x11, 0x14, 0x0d, 0x54, 0x54, 0x0d, 0x14, 0x11, 0x0a,
-    0x51, 0x9d, 0x16, 0x02, 0x02, 0x16, 0x9d, 0x51, 0x0a, 0x11, 0x14, 0x0d,
-    0x54, 0x54, 0x0d, 0x14, 0x11, 0x0a, 0x51, 0x9d, 0x16, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x10, 0xff, 0xf0, 0x01, 0xb0, 0x01, 0x90, 0x00, 0x1f,
-    0x00, 0x00, 0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35,
-    0x31, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35, 0xf8, 0x02,
-    0x16, 0x16, 0x02, 0xa0, 0x16, 0x02, 0x02, 0x16, 0xa0, 0x02, 0x16, 0x16,
-    0x02, 0xa0, 0x16, 0x02, 0x02, 0x16, 0xa0, 0x01, 0x78, 0x16, 0x02, 0x02,
-    0x16, 0xa0, 0x02, 0x16, 0x16, 0x02, 0xa0, 0x16, 0x02, 0x02, 0x16, 0xa0,
-    0x02, 0x16, 0x16, 0x02, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x15, 0x00, 0x2c, 0x00, 0x00,
-    0x13, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x15,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x35, 0x37, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x36,
-    0x37, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x00, 0x02, 0x2d,
-    0x2d, 0x44, 0x44, 0x2d, 0x2d, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x44, 0x2d,
-    0x2d, 0x02, 0xa0, 0x30, 0x1f, 0x20, 0x01, 0x01, 0x20, 0x1f, 0x30, 0x30,
-    0x1f, 0x20, 0x01, 0x01, 0x20, 0x1f, 0x30, 0x01, 0x00, 0x44, 0x2d, 0x2d,
-    0x02, 0x02, 0x2d, 0x2d, 0x44, 0x80, 0x44, 0x2d, 0x2d, 0x02, 0x02, 0x2d,
-    0x2d, 0x44, 0x80, 0x70, 0x01, 0x20, 0x1f, 0x30, 0x80, 0x30, 0x1f, 0x20,
-    0x01, 0x01, 0x20, 0x1f, 0x30, 0x80, 0x30, 0x1f, 0x20, 0x01, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xfa, 0xff, 0xe0, 0x01, 0x00, 0x01, 0xa3, 0x00, 0x1d,
-    0x00, 0x00, 0x13, 0x34, 0x27, 0x26, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x11, 0x31, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x33, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x11, 0x98, 0x0c, 0x0d, 0x0c,
-    0x68, 0x11, 0x09, 0x0e, 0x13, 0x44, 0x50, 0x16, 0x02, 0x02, 0x16, 0x68,
-    0x68, 0x16, 0x02, 0x02, 0x16, 0x50, 0x01, 0x88, 0x0e, 0x07, 0x06, 0x07,
-    0x40, 0x0d, 0x14, 0x11, 0x0a, 0x29, 0xfe, 0xb3, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x01, 0x78, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x2b, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x07, 0x31, 0x33, 0x31, 0x16,
-    0x17, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x37, 0x37, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x94, 0x2a, 0x1d, 0x24, 0x11, 0x11,
-    0x0e, 0x0e, 0x24, 0x2b, 0x3e, 0x07, 0x3c, 0x28, 0x27, 0x02, 0x01, 0x2c,
-    0xa6, 0xd3, 0x16, 0x02, 0x02, 0x16, 0xfe, 0xf0, 0x10, 0x06, 0x05, 0x0b,
-    0xd3, 0x1c, 0x01, 0x01, 0x1a, 0x1b, 0x27, 0x07, 0x01, 0x70, 0x01, 0x1c,
-    0x24, 0x0e, 0x0e, 0x11, 0x11, 0x23, 0x2b, 0x01, 0x02, 0x27, 0x28, 0x3c,
-    0x3d, 0x2a, 0x9c, 0x02, 0x16, 0x16, 0x02, 0x01, 0x0e, 0x0f, 0x0b, 0xc6,
-    0x1c, 0x28, 0x27, 0x1b, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfb,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x3a, 0x00, 0x00, 0x13, 0x36,
-    0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x07, 0x07, 0x31, 0x33, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x22, 0x27, 0x26,
-    0x27, 0x27, 0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x16, 0x17, 0x33,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x26,
-    0x27, 0x26, 0x37, 0x37, 0x31, 0x23, 0x31, 0x26, 0x27, 0x00, 0x02, 0x16,
-    0x01, 0x00, 0x10, 0x06, 0x06, 0x0b, 0x95, 0x28, 0x38, 0x25, 0x26, 0x01,
-    0x01, 0x26, 0x25, 0x38, 0x5b, 0x1e, 0x18, 0x19, 0x0e, 0x01, 0x08, 0x12,
-    0x15, 0x0b, 0x02, 0x11, 0x21, 0x5b, 0x24, 0x17, 0x18, 0x01, 0x01, 0x18,
-    0x17, 0x24, 0x64, 0x10, 0x06, 0x06, 0x0b, 0x95, 0xc4, 0x16, 0x02, 0x01,
-    0x88, 0x16, 0x02, 0x01, 0x0e, 0x0f, 0x0b, 0x8f, 0x01, 0x26, 0x25, 0x38,
-    0x38, 0x25, 0x26, 0x01, 0x10, 0x0f, 0x1a, 0x04, 0x15, 0x0b, 0x08, 0x12,
-    0x04, 0x1e, 0x01, 0x01, 0x18, 0x17, 0x24, 0x24, 0x17, 0x18, 0x01, 0x01,
-    0x0e, 0x0f, 0x0b, 0x8f, 0x02, 0x16, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfd,
-    0xff, 0xe0, 0x01, 0x80, 0x01, 0xa6, 0x00, 0x27, 0x00, 0x00, 0x13, 0x36,
-    0x27, 0x26, 0x07, 0x03, 0x31, 0x06, 0x17, 0x16, 0x33, 0x33, 0x31, 0x15,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x26,
-    0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23,
-    0x31, 0x37, 0xbd, 0x09, 0x13, 0x14, 0x0c, 0x90, 0x06, 0x06, 0x08, 0x0d,
-    0xf8, 0x02, 0x16, 0x16, 0x02, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x02,
-    0x16, 0x16, 0x02, 0xd0, 0x7d, 0x01, 0x7d, 0x14, 0x0c, 0x09, 0x13, 0xfe,
-    0xf0, 0x0c, 0x0b, 0x0c, 0x68, 0x16, 0x02, 0x02, 0x16, 0x68, 0x02, 0x16,
-    0x16, 0x02, 0x98, 0x16, 0x02, 0x02, 0x16, 0x98, 0xed, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xfb, 0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x37,
-    0x00, 0x00, 0x13, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23,
-    0x31, 0x07, 0x31, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x23, 0x31, 0x22, 0x27, 0x26, 0x27, 0x27, 0x31, 0x26, 0x37, 0x36,
-    0x17, 0x17, 0x31, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x26,
-    0x27, 0x26, 0x27, 0x23, 0x31, 0x22, 0x27, 0x26, 0x37, 0x37, 0x20, 0x05,
-    0x13, 0xd0, 0x16, 0x02, 0x02, 0x16, 0xbc, 0x17, 0x87, 0x38, 0x25, 0x26,
-    0x01, 0x01, 0x26, 0x25, 0x38, 0x5f, 0x1c, 0x17, 0x17, 0x0c, 0x05, 0x07,
-    0x12, 0x15, 0x0b, 0x05, 0x0e, 0x1d, 0x5f, 0x24, 0x17, 0x18, 0x01, 0x01,
-    0x18, 0x17, 0x24, 0xa4, 0x0b, 0x07, 0x07, 0x01, 0x20, 0x01, 0x8c, 0x13,
-    0x01, 0x02, 0x16, 0x16, 0x02, 0x88, 0x01, 0x26, 0x25, 0x38, 0x38, 0x25,
-    0x26, 0x01, 0x0e, 0x0e, 0x19, 0x08, 0x15, 0x0c, 0x07, 0x12, 0x08, 0x1a,
-    0x01, 0x01, 0x18, 0x17, 0x24, 0x24, 0x17, 0x18, 0x01, 0x09, 0x08, 0x0b,
-    0xb8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x40,
-    0x01, 0xa7, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x00, 0x25, 0x26, 0x27, 0x31,
-    0x31, 0x26, 0x27, 0x06, 0x07, 0x07, 0x31, 0x06, 0x15, 0x16, 0x17, 0x16,
-    0x17, 0x36, 0x37, 0x36, 0x37, 0x27, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x37, 0x31,
-    0x36, 0x17, 0x16, 0x07, 0x07, 0x01, 0x10, 0x01, 0x20, 0x1f, 0x30, 0x32,
-    0x20, 0x05, 0x19, 0x01, 0x20, 0x1f, 0x30, 0x30, 0x1f, 0x20, 0x01, 0x7e,
-    0x07, 0x07, 0x44, 0x2d, 0x2d, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x44, 0x2d,
-    0x2d, 0x02, 0x01, 0x29, 0x8b, 0x10, 0x12, 0x10, 0x0c, 0x49, 0x80, 0x30,
-    0x1f, 0x20, 0x01, 0x01, 0x23, 0x06, 0x1f, 0x27, 0x30, 0x1f, 0x20, 0x01,
-    0x01, 0x20, 0x1f, 0x30, 0x9f, 0x01, 0x02, 0x2d, 0x2d, 0x44, 0x44, 0x2d,
-    0x2d, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x40, 0x2c, 0xab, 0x10, 0x0c, 0x10,
-    0x12, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xda, 0x01, 0x43,
-    0x01, 0xa0, 0x00, 0x14, 0x00, 0x00, 0x13, 0x36, 0x37, 0x21, 0x31, 0x32,
-    0x17, 0x16, 0x07, 0x03, 0x31, 0x06, 0x27, 0x26, 0x37, 0x13, 0x31, 0x23,
-    0x31, 0x26, 0x27, 0x00, 0x02, 0x16, 0x01, 0x10, 0x0e, 0x07, 0x06, 0x06,
-    0xf0, 0x0d, 0x14, 0x12, 0x0a, 0xda, 0xe6, 0x16, 0x02, 0x01, 0x88, 0x16,
-    0x02, 0x0c, 0x0c, 0x0c, 0xfe, 0x70, 0x12, 0x09, 0x0d, 0x14, 0x01, 0x6c,
-    0x02, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x40,
-    0x01, 0xa0, 0x00, 0x22, 0x00, 0x44, 0x00, 0x63, 0x00, 0x00, 0x01, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x16,
-    0x17, 0x06, 0x07, 0x06, 0x15, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x34, 0x27, 0x26, 0x27, 0x36, 0x37, 0x07, 0x33, 0x23,
-    0x33, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x30, 0x31, 0x30,
-    0x31, 0x33, 0x31, 0x30, 0x31, 0x30, 0x31, 0x35, 0x30, 0x31, 0x31, 0x31,
-    0x30, 0x31, 0x23, 0x31, 0x30, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27,
-    0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x01, 0x30, 0x01, 0x23, 0x23, 0x35, 0x28, 0x35, 0x23, 0x23,
-    0x01, 0x02, 0x29, 0x1b, 0x10, 0x10, 0x01, 0x23, 0x23, 0x35, 0x48, 0x35,
-    0x23, 0x23, 0x01, 0x10, 0x10, 0x1b, 0x29, 0x02, 0x7c, 0x10, 0x10, 0x10,
-    0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x20, 0x48, 0x20, 0x16, 0x15,
-    0x01, 0x01, 0x15, 0x16, 0x20, 0x10, 0x28, 0x28, 0x20, 0x16, 0x15, 0x01,
-    0x01, 0x15, 0x16, 0x20, 0x28, 0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16,
-    0x20, 0x01, 0x24, 0x35, 0x23, 0x23, 0x01, 0x01, 0x23, 0x23, 0x35, 0x3a,
-    0x24, 0x11, 0x1b, 0x1c, 0x22, 0x35, 0x23, 0x23, 0x01, 0x01, 0x23, 0x23,
-    0x35, 0x22, 0x1c, 0x1b, 0x11, 0x24, 0x3a, 0x7c, 0x01, 0x15, 0x16, 0x20,
-    0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x20, 0x20, 0x16, 0x15, 0x01,
-    0x30, 0x01, 0x15, 0x16, 0x20, 0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16,
-    0x20, 0x20, 0x16, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xd9, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x00,
-    0x13, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x36, 0x37, 0x37, 0x31, 0x36,
-    0x35, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x17, 0x06, 0x23,
-    0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x30, 0x01, 0x20,
-    0x1f, 0x30, 0x32, 0x20, 0x05, 0x19, 0x01, 0x20, 0x1f, 0x30, 0x30, 0x1f,
-    0x20, 0x01, 0x7e, 0x07, 0x07, 0x44, 0x2d, 0x2d, 0x02, 0x02, 0x2d, 0x2d,
-    0x44, 0x44, 0x2d, 0x2d, 0x02, 0x01, 0x29, 0x8b, 0x10, 0x12, 0x10, 0x0c,
-    0x49, 0x01, 0x00, 0x30, 0x1f, 0x20, 0x01, 0x01, 0x23, 0x06, 0x1f, 0x27,
-    0x30, 0x1f, 0x20, 0x01, 0x01, 0x20, 0x1f, 0x30, 0x9f, 0x01, 0x02, 0x2d,
-    0x2d, 0x44, 0x44, 0x2d, 0x2d, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x40, 0x2c,
-    0xab, 0x10, 0x0c, 0x10, 0x12, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xfb, 0x01, 0x85, 0x01, 0x85, 0x00, 0x14, 0x00, 0x00, 0x01, 0x16,
-    0x07, 0x05, 0x31, 0x05, 0x31, 0x16, 0x07, 0x06, 0x27, 0x25, 0x31, 0x26,
-    0x27, 0x34, 0x37, 0x25, 0x31, 0x36, 0x17, 0x01, 0x7e, 0x07, 0x12, 0xfe,
-    0xdb, 0x01, 0x25, 0x12, 0x08, 0x0b, 0x15, 0xfe, 0xb0, 0x0c, 0x01, 0x0d,
-    0x01, 0x50, 0x15, 0x0c, 0x01, 0x73, 0x15, 0x0c, 0x92, 0x93, 0x0b, 0x15,
-    0x12, 0x08, 0xa8, 0x06, 0x0f, 0x0e, 0x07, 0xa8, 0x08, 0x12, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x10, 0x00, 0x50, 0x01, 0xb0, 0x01, 0x30, 0x00, 0x0b,
-    0x00, 0x17, 0x00, 0x00, 0x13, 0x06, 0x07, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x21, 0x15, 0x06, 0x07, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x21, 0x28, 0x16, 0x02, 0x02, 0x16, 0x01, 0x70, 0x16,
-    0x02, 0x02, 0x16, 0xfe, 0x90, 0x16, 0x02, 0x02, 0x16, 0x01, 0x70, 0x16,
-    0x02, 0x02, 0x16, 0xfe, 0x90, 0x01, 0x30, 0x02, 0x16, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0xb0, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02,
-    0x00, 0x01, 0xff, 0xfb, 0xff, 0xfb, 0x01, 0x80, 0x01, 0x85, 0x00, 0x14,
-    0x00, 0x00, 0x13, 0x06, 0x17, 0x05, 0x31, 0x05, 0x31, 0x06, 0x17, 0x16,
-    0x37, 0x25, 0x31, 0x36, 0x37, 0x34, 0x27, 0x25, 0x31, 0x26, 0x07, 0x03,
-    0x08, 0x12, 0x01, 0x25, 0xfe, 0xdb, 0x12, 0x08, 0x0b, 0x15, 0x01, 0x50,
-    0x0c, 0x01, 0x0d, 0xfe, 0xb0, 0x15, 0x0b, 0x01, 0x73, 0x15, 0x0c, 0x92,
-    0x93, 0x0b, 0x15, 0x12, 0x08, 0xa8, 0x07, 0x0e, 0x0f, 0x07, 0xa8, 0x07,
-    0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0xff, 0xe0, 0x01, 0x30,
-    0x01, 0xa0, 0x00, 0x34, 0x00, 0x47, 0x00, 0x00, 0x13, 0x36, 0x37, 0x31,
-    0x31, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x06,
-    0x07, 0x07, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35,
-    0x31, 0x34, 0x37, 0x37, 0x31, 0x36, 0x37, 0x36, 0x35, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x36,
-    0x37, 0x13, 0x32, 0x37, 0x31, 0x31, 0x36, 0x35, 0x34, 0x27, 0x26, 0x23,
-    0x22, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x40, 0x01, 0x16, 0x17,
-    0x22, 0x20, 0x22, 0x17, 0x16, 0x01, 0x01, 0x1f, 0x34, 0x23, 0x01, 0x02,
-    0x16, 0x16, 0x02, 0x0e, 0x35, 0x19, 0x0e, 0x0e, 0x01, 0x25, 0x24, 0x36,
-    0x20, 0x36, 0x25, 0x24, 0x01, 0x02, 0x16, 0x16, 0x02, 0x60, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x01, 0x20,
-    0x22, 0x17, 0x16, 0x01, 0x01, 0x16, 0x17, 0x22, 0x05, 0x26, 0x16, 0x22,
-    0x19, 0x2a, 0x02, 0x16, 0x02, 0x02, 0x16, 0x02, 0x11, 0x0a, 0x22, 0x12,
-    0x1a, 0x1a, 0x1e, 0x05, 0x36, 0x25, 0x24, 0x01, 0x01, 0x24, 0x25, 0x36,
-    0x16, 0x02, 0x02, 0x16, 0xfe, 0xc0, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x4a, 0x00, 0x57, 0x00, 0x00,
-    0x01, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x15,
-    0x31, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x17, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x16, 0x17,
-    0x16, 0x37, 0x36, 0x37, 0x01, 0x00, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b,
-    0x3b, 0x58, 0x16, 0x02, 0x02, 0x16, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01,
-    0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01,
-    0x01, 0x1a, 0x1a, 0x27, 0x31, 0x1a, 0x23, 0x36, 0x33, 0x22, 0x22, 0x01,
-    0x01, 0x22, 0x22, 0x33, 0x2c, 0x20, 0x07, 0x0d, 0x16, 0x02, 0x0d, 0x0c,
-    0x13, 0x13, 0x0c, 0x0d, 0x02, 0x3b, 0x3b, 0x58, 0x48, 0x01, 0x23, 0x24,
-    0x24, 0x23, 0x01, 0x01, 0x23, 0x24, 0x24, 0x23, 0x01, 0x01, 0x90, 0x02,
-    0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x16, 0x16, 0x02, 0x01,
-    0x22, 0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01, 0x01,
-    0x22, 0x22, 0x3a, 0x39, 0x48, 0x1c, 0x27, 0x1a, 0x1a, 0x01, 0x02, 0x25,
-    0x25, 0x02, 0x01, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x01, 0x01, 0x1a,
-    0x0a, 0x01, 0x02, 0x16, 0x50, 0x1c, 0x13, 0x0c, 0x0d, 0x0d, 0x0c, 0x13,
-    0x1c, 0x58, 0x3b, 0x3b, 0x02, 0xd0, 0x29, 0x15, 0x14, 0x14, 0x15, 0x29,
-    0x29, 0x15, 0x14, 0x14, 0x15, 0x29, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfb,
-    0xff, 0xdb, 0x01, 0x85, 0x01, 0xa0, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x06, 0x07, 0x03, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37,
-    0x31, 0x33, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x03, 0x13, 0x23,
-    0x33, 0x23, 0x37, 0x31, 0x17, 0xd6, 0x06, 0x10, 0x10, 0x06, 0xa8, 0x07,
-    0x14, 0x15, 0x0a, 0x22, 0xe0, 0x22, 0x0a, 0x15, 0x14, 0x07, 0xa8, 0x46,
-    0xb8, 0xb8, 0xb8, 0x5c, 0x5c, 0x01, 0x91, 0x0e, 0x01, 0x01, 0x0e, 0xfe,
-    0x70, 0x15, 0x0a, 0x07, 0x14, 0x51, 0x51, 0x14, 0x07, 0x0a, 0x15, 0x01,
-    0x90, 0xfe, 0xdf, 0xda, 0xda, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x42,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x15, 0x31, 0x15,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x34,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x17, 0x23,
-    0x33, 0x23, 0x35, 0x31, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x07, 0x33, 0x23, 0x33, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x38, 0x18, 0x10,
-    0x0f, 0x01, 0x01, 0x0f, 0x10, 0x18, 0x8c, 0x35, 0x23, 0x23, 0x01, 0x13,
-    0x13, 0x1f, 0x24, 0x01, 0x01, 0x23, 0x23, 0x35, 0x6c, 0x6c, 0x74, 0x74,
-    0x74, 0x01, 0x07, 0x6c, 0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x20,
-    0x74, 0x74, 0x74, 0x94, 0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x20,
-    0x8c, 0x07, 0x01, 0x01, 0xa0, 0x01, 0x0f, 0x10, 0x18, 0xa8, 0xa8, 0x18,
-    0x10, 0x0f, 0x01, 0x01, 0x23, 0x23, 0x35, 0x25, 0x1d, 0x1e, 0x0f, 0x23,
-    0x36, 0x35, 0x23, 0x23, 0x01, 0xc8, 0x90, 0x07, 0x01, 0x01, 0x15, 0x16,
-    0x20, 0x20, 0x16, 0x15, 0x01, 0x30, 0x01, 0x15, 0x16, 0x20, 0x20, 0x16,
-    0x15, 0x01, 0x01, 0x07, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9,
-    0xff, 0xd8, 0x01, 0x87, 0x01, 0xa7, 0x00, 0x28, 0x00, 0x00, 0x01, 0x26,
-    0x23, 0x31, 0x31, 0x22, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x27, 0x01, 0x58, 0x36, 0x45, 0x45, 0x36, 0x32, 0x32, 0x36,
-    0x45, 0x45, 0x36, 0x10, 0x11, 0x0e, 0x0e, 0x2c, 0x38, 0x38, 0x38, 0x38,
-    0x2c, 0x2c, 0x0e, 0x0e, 0x0e, 0x0e, 0x2c, 0x2c, 0x38, 0x38, 0x38, 0x38,
-    0x2c, 0x0e, 0x0e, 0x11, 0x10, 0x01, 0x3c, 0x34, 0x34, 0x36, 0x46, 0x46,
-    0x36, 0x34, 0x34, 0x0e, 0x0e, 0x11, 0x12, 0x2b, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x2b, 0x2d, 0x39, 0x39, 0x39, 0x39, 0x2c, 0x2c, 0x0f, 0x0e, 0x0e, 0x0f,
-    0x2c, 0x11, 0x11, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x80, 0x01, 0xa0, 0x00, 0x11, 0x00, 0x2d, 0x00, 0x00,
-    0x13, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x38, 0x07,
-    0x01, 0x01, 0x07, 0x68, 0x4b, 0x31, 0x32, 0x02, 0x02, 0x32, 0x31, 0x4b,
-    0x68, 0x38, 0x01, 0x0f, 0x10, 0x18, 0x68, 0x3f, 0x32, 0x33, 0x1d, 0x1e,
-    0x01, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x68, 0x18, 0x10, 0x0f, 0x01,
-    0x01, 0x70, 0x01, 0x07, 0xfe, 0xb0, 0x07, 0x01, 0x02, 0x32, 0x31, 0x4b,
-    0x4b, 0x31, 0x32, 0x02, 0x08, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x1e, 0x1d,
-    0x33, 0x32, 0x3f, 0x3f, 0x32, 0x33, 0x1d, 0x1e, 0x01, 0x01, 0x0f, 0x10,
-    0x18, 0x01, 0x50, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x40,
-    0x01, 0xa0, 0x00, 0x2d, 0x00, 0x00, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06,
-    0x07, 0x15, 0x31, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x36, 0x37, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x38, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10,
-    0x18, 0xf0, 0x16, 0x02, 0x02, 0x16, 0xf0, 0x07, 0x01, 0xb8, 0x16, 0x02,
-    0x02, 0x16, 0xb8, 0x01, 0x07, 0xf0, 0x16, 0x02, 0x02, 0x16, 0xf0, 0x01,
-    0xa0, 0x01, 0x0f, 0x10, 0x18, 0xa8, 0xa8, 0x18, 0x10, 0x0f, 0x01, 0x02,
-    0x16, 0x16, 0x02, 0x01, 0x07, 0x98, 0x02, 0x16, 0x16, 0x02, 0x88, 0x07,
-    0x01, 0x02, 0x16, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x23, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x15, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36,
-    0x37, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35,
-    0x31, 0x36, 0x37, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x38, 0x18,
-    0x10, 0x0f, 0x01, 0x02, 0x16, 0x16, 0x02, 0xb8, 0x16, 0x02, 0x02, 0x16,
-    0xb8, 0x01, 0x07, 0xf0, 0x16, 0x02, 0x02, 0x16, 0xf0, 0x01, 0xa0, 0x01,
-    0x0f, 0x10, 0x18, 0xa0, 0xd0, 0x16, 0x02, 0x02, 0x16, 0xb8, 0x02, 0x16,
-    0x16, 0x02, 0x88, 0x07, 0x01, 0x02, 0x16, 0x16, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa0, 0x00, 0x32,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x36, 0x37, 0x36, 0x37, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x33,
-    0x31, 0x32, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x27, 0x26, 0x27, 0xe0, 0x4b, 0x31, 0x32, 0x02, 0x02, 0x32,
-    0x31, 0x4b, 0x44, 0x30, 0x30, 0x0a, 0x95, 0x16, 0x02, 0x02, 0x16, 0x9f,
-    0x11, 0x0b, 0x0c, 0x01, 0x09, 0x3e, 0x3e, 0x5a, 0x3f, 0x32, 0x33, 0x1d,
-    0x1e, 0x01, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x58, 0x3d, 0x0f, 0x0d,
-    0x10, 0x12, 0x30, 0x45, 0x01, 0x70, 0x02, 0x32, 0x31, 0x4b, 0x4b, 0x31,
-    0x32, 0x02, 0x01, 0x2b, 0x2a, 0x42, 0x02, 0x16, 0x16, 0x02, 0x0c, 0x0c,
-    0x12, 0x59, 0x39, 0x3a, 0x02, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x3f,
-    0x32, 0x33, 0x1d, 0x1e, 0x01, 0x02, 0x37, 0x10, 0x12, 0x0f, 0x0d, 0x2c,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x80,
-    0x01, 0xa0, 0x00, 0x22, 0x00, 0x00, 0x25, 0x15, 0x35, 0x15, 0x16, 0x17,
-    0x36, 0x37, 0x35, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31,
-    0x21, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17,
-    0x36, 0x37, 0x35, 0x31, 0x21, 0x01, 0x50, 0x02, 0x16, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0xfe, 0xe0, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x01, 0x20, 0xc0, 0xc8, 0xc8, 0xc8, 0x16, 0x02, 0x02, 0x16, 0xe8,
-    0xa8, 0x16, 0x02, 0x02, 0x16, 0x98, 0x98, 0x16, 0x02, 0x02, 0x16, 0xfe,
-    0x70, 0x16, 0x02, 0x02, 0x16, 0xc8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x1f, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x11, 0x31, 0x23, 0x31, 0x06, 0x07, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x11, 0x31, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x18, 0x16, 0x02, 0x02, 0x16, 0x70,
-    0x70, 0x16, 0x02, 0x02, 0x16, 0x01, 0x10, 0x16, 0x02, 0x02, 0x16, 0x70,
-    0x70, 0x16, 0x02, 0x02, 0x16, 0x88, 0x01, 0xa0, 0x02, 0x16, 0x16, 0x02,
-    0xfe, 0xa0, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x01, 0x60,
-    0x02, 0x16, 0x16, 0x02, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x40,
-    0x01, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x01, 0x16, 0x17, 0x11, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x16,
-    0x17, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x11,
-    0x31, 0x36, 0x37, 0x01, 0x28, 0x16, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x44,
-    0x2d, 0x2d, 0x02, 0x02, 0x16, 0x16, 0x02, 0x01, 0x20, 0x1f, 0x30, 0x30,
-    0x1f, 0x20, 0x01, 0x02, 0x16, 0x01, 0xa0, 0x02, 0x16, 0xfe, 0xf8, 0x44,
-    0x2d, 0x2d, 0x02, 0x02, 0x2d, 0x2d, 0x44, 0x28, 0x16, 0x02, 0x02, 0x16,
-    0x28, 0x30, 0x1f, 0x20, 0x01, 0x01, 0x20, 0x1f, 0x30, 0x01, 0x08, 0x16,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xd9, 0x01, 0x47,
-    0x01, 0xa7, 0x00, 0x21, 0x00, 0x00, 0x13, 0x26, 0x27, 0x06, 0x07, 0x11,
-    0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x37, 0x31, 0x17,
-    0x31, 0x16, 0x37, 0x36, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26,
-    0x07, 0x07, 0x31, 0x35, 0x30, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x50, 0x94, 0x0f, 0x13, 0x10, 0x0a, 0x9a, 0x97, 0x0e, 0x0e, 0x11,
-    0x11, 0xe7, 0x01, 0x88, 0x16, 0x02, 0x02, 0x16, 0xfe, 0xf0, 0x80, 0x16,
-    0x02, 0x02, 0x16, 0x76, 0x50, 0xd4, 0x11, 0x0b, 0x0f, 0x13, 0xda, 0x97,
-    0x11, 0x11, 0x0e, 0x0e, 0xe7, 0xd6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x12, 0x00, 0x00, 0x13, 0x16,
-    0x17, 0x11, 0x31, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x26,
-    0x27, 0x11, 0x31, 0x36, 0x37, 0x38, 0x16, 0x02, 0xd8, 0x16, 0x02, 0x02,
-    0x16, 0xf0, 0x16, 0x02, 0x02, 0x16, 0x01, 0xa0, 0x02, 0x16, 0xfe, 0x88,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x01, 0x90, 0x16, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa3, 0x00, 0x24,
-    0x00, 0x00, 0x13, 0x36, 0x17, 0x13, 0x31, 0x13, 0x31, 0x36, 0x17, 0x16,
-    0x17, 0x11, 0x31, 0x06, 0x07, 0x26, 0x27, 0x11, 0x31, 0x07, 0x31, 0x06,
-    0x23, 0x22, 0x27, 0x27, 0x31, 0x11, 0x31, 0x06, 0x07, 0x26, 0x27, 0x11,
-    0x31, 0x36, 0x37, 0x11, 0x11, 0x0a, 0xb4, 0xb4, 0x0a, 0x11, 0x10, 0x01,
-    0x02, 0x16, 0x16, 0x02, 0x9c, 0x07, 0x0d, 0x0d, 0x07, 0x9c, 0x02, 0x16,
-    0x16, 0x02, 0x01, 0x10, 0x01, 0x9f, 0x04, 0x0e, 0xfe, 0xef, 0x01, 0x11,
-    0x0e, 0x04, 0x06, 0x11, 0xfe, 0x70, 0x16, 0x02, 0x02, 0x16, 0x01, 0x40,
-    0xed, 0x0b, 0x0b, 0xed, 0xfe, 0xc0, 0x16, 0x02, 0x02, 0x16, 0x01, 0x90,
-    0x11, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdd, 0x01, 0x80,
-    0x01, 0xa3, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x36, 0x17, 0x01, 0x31, 0x11,
-    0x31, 0x36, 0x37, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x27, 0x01,
-    0x31, 0x11, 0x31, 0x06, 0x07, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x10,
-    0x0f, 0x0b, 0x01, 0x26, 0x02, 0x16, 0x16, 0x02, 0x01, 0x0f, 0x0f, 0x0b,
-    0xfe, 0xda, 0x02, 0x16, 0x16, 0x02, 0x01, 0x0f, 0x01, 0x9f, 0x04, 0x0c,
-    0xfe, 0xa3, 0x01, 0x4e, 0x16, 0x02, 0x02, 0x16, 0xfe, 0x70, 0x10, 0x07,
-    0x04, 0x0b, 0x01, 0x5e, 0xfe, 0xb2, 0x16, 0x02, 0x02, 0x16, 0x01, 0x90,
-    0x10, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x00, 0x13, 0x22, 0x07, 0x31,
-    0x31, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x23, 0x17,
-    0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27,
-    0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17,
-    0x16, 0x17, 0xe0, 0x30, 0x28, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28,
-    0x30, 0x30, 0x28, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28, 0x28, 0x30, 0xe0,
-    0x01, 0x1d, 0x1e, 0x34, 0x35, 0x3b, 0x3b, 0x35, 0x34, 0x1e, 0x1d, 0x01,
-    0x01, 0x1d, 0x1e, 0x34, 0x35, 0x3b, 0x3b, 0x35, 0x34, 0x1e, 0x1d, 0x01,
-    0x01, 0x70, 0x18, 0x17, 0x29, 0x2a, 0x2e, 0x2e, 0x2a, 0x29, 0x17, 0x18,
-    0x18, 0x17, 0x29, 0x2a, 0x2e, 0x2e, 0x2a, 0x29, 0x17, 0x18, 0xb0, 0x3d,
-    0x33, 0x33, 0x1f, 0x1e, 0x1e, 0x1f, 0x33, 0x33, 0x3d, 0x3d, 0x33, 0x33,
-    0x1f, 0x1e, 0x1e, 0x1f, 0x33, 0x33, 0x3d, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0x40, 0x01, 0xa0, 0x00, 0x11, 0x00, 0x2c, 0x00, 0x00,
-    0x13, 0x33, 0x23, 0x33, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x23, 0x31, 0x35, 0x31, 0x36, 0x37, 0x03, 0x33, 0x23, 0x33, 0x36, 0x37,
-    0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07,
-    0x15, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x38, 0x70, 0x70,
-    0x70, 0x2c, 0x1e, 0x1d, 0x01, 0x01, 0x1d, 0x1e, 0x2c, 0x78, 0x01, 0x07,
-    0x08, 0x78, 0x78, 0x78, 0x41, 0x2a, 0x2b, 0x02, 0x02, 0x2b, 0x2a, 0x41,
-    0x70, 0x18, 0x10, 0x0f, 0x01, 0x02, 0x16, 0x16, 0x02, 0x01, 0x70, 0x01,
-    0x1d, 0x1e, 0x2c, 0x2c, 0x1e, 0x1d, 0x01, 0xc8, 0x07, 0x01, 0xff, 0x00,
-    0x02, 0x2b, 0x2a, 0x41, 0x41, 0x2a, 0x2b, 0x02, 0x01, 0x0f, 0x10, 0x18,
-    0xe0, 0x90, 0x16, 0x02, 0x02, 0x16, 0x78, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xb9, 0x01, 0xc7, 0x01, 0xa0, 0x00, 0x1a, 0x00, 0x38, 0x00, 0x00,
-    0x37, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x36, 0x37, 0x27, 0x31, 0x26,
-    0x37, 0x36, 0x17, 0x17, 0x31, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x06, 0x07, 0x05, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x17, 0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x30, 0x02, 0x32,
-    0x31, 0x4b, 0x36, 0x2b, 0x5b, 0x0d, 0x10, 0x12, 0x0f, 0x5b, 0x2a, 0x01,
-    0x02, 0x32, 0x31, 0x4b, 0x4b, 0x31, 0x32, 0x02, 0x01, 0x30, 0x38, 0x48,
-    0x3f, 0x32, 0x33, 0x1d, 0x1e, 0x01, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f,
-    0x3f, 0x32, 0x33, 0x1d, 0x1e, 0x01, 0x02, 0x3a, 0x36, 0x0d, 0x0f, 0x13,
-    0x0f, 0x36, 0xc0, 0x4b, 0x31, 0x32, 0x02, 0x01, 0x1c, 0x6b, 0x13, 0x0f,
-    0x0d, 0x10, 0x6b, 0x30, 0x44, 0x4b, 0x31, 0x32, 0x02, 0x02, 0x32, 0x31,
-    0x4b, 0xb8, 0x27, 0x01, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x3f, 0x32,
-    0x33, 0x1d, 0x1e, 0x01, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x5a, 0x3e,
-    0x41, 0x12, 0x0f, 0x0d, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xd9, 0x01, 0x47, 0x01, 0xa0, 0x00, 0x23, 0x00, 0x36, 0x00, 0x00,
-    0x13, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x15, 0x31, 0x15, 0x31, 0x16,
-    0x17, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36,
-    0x27, 0x27, 0x31, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x23,
-    0x17, 0x23, 0x33, 0x23, 0x35, 0x31, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17,
-    0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x23, 0x38, 0x18, 0x10, 0x0f, 0x01,
-    0x02, 0x16, 0x16, 0x02, 0x6e, 0x77, 0x0e, 0x13, 0x11, 0x0b, 0x65, 0x2e,
-    0x1d, 0x1d, 0x01, 0x01, 0x27, 0x26, 0x3a, 0x80, 0x78, 0x80, 0x80, 0x80,
-    0x01, 0x07, 0x80, 0x25, 0x19, 0x19, 0x01, 0x01, 0x19, 0x19, 0x25, 0x08,
-    0x01, 0xa0, 0x01, 0x0f, 0x10, 0x18, 0xc0, 0xb0, 0x16, 0x02, 0x02, 0x16,
-    0x98, 0xa6, 0x11, 0x0b, 0x0f, 0x13, 0x8d, 0x0c, 0x24, 0x24, 0x31, 0x3a,
-    0x26, 0x27, 0x01, 0xe0, 0xa8, 0x07, 0x01, 0x01, 0x19, 0x19, 0x25, 0x25,
-    0x19, 0x19, 0x01, 0x00, 0x00, 0x01, 0xff, 0xfc, 0xff, 0xd9, 0x01, 0x44,
-    0x01, 0xa7, 0x00, 0x5e, 0x00, 0x00, 0x13, 0x06, 0x07, 0x06, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x32, 0x17, 0x30, 0x31, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x22, 0x31, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x22, 0x27, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x37, 0x17, 0x31, 0x27, 0x31, 0x36, 0x37, 0x36, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x27, 0x26, 0x27, 0x26, 0x27, 0x37,
-    0x31, 0x07, 0x31, 0x26, 0x07, 0x5b, 0x24, 0x06, 0x03, 0x06, 0x06, 0x0f,
-    0x23, 0x3b, 0x01, 0x01, 0x1b, 0x1c, 0x1b, 0x17, 0x18, 0x0e, 0x0c, 0x06,
-    0x0e, 0x39, 0x36, 0x47, 0x14, 0x19, 0x19, 0x15, 0x01, 0x08, 0x05, 0x15,
-    0x05, 0x09, 0x16, 0x03, 0x04, 0x04, 0x05, 0x15, 0x16, 0x16, 0x10, 0x3e,
-    0x26, 0x24, 0x06, 0x03, 0x06, 0x06, 0x0f, 0x23, 0x3a, 0x02, 0x01, 0x1b,
-    0x1c, 0x1b, 0x17, 0x18, 0x0d, 0x0d, 0x06, 0x18, 0x18, 0x0e, 0x39, 0x36,
-    0x47, 0x0c, 0x17, 0x16, 0x0d, 0x15, 0x04, 0x07, 0x16, 0x0b, 0x15, 0x16,
-    0x0b, 0x04, 0x04, 0x3e, 0x26, 0x01, 0x65, 0x0f, 0x21, 0x17, 0x0c, 0x0d,
-    0x0b, 0x15, 0x0e, 0x01, 0x07, 0x09, 0x0a, 0x0f, 0x0f, 0x1c, 0x1c, 0x24,
-    0x3d, 0x17, 0x15, 0x0b, 0x03, 0x08, 0x08, 0x07, 0x03, 0x01, 0x09, 0x16,
-    0x14, 0x05, 0x01, 0x01, 0x02, 0x01, 0x07, 0x07, 0x07, 0x03, 0x09, 0x11,
-    0x0f, 0x21, 0x17, 0x0c, 0x0d, 0x0b, 0x15, 0x0e, 0x01, 0x07, 0x0a, 0x09,
-    0x0f, 0x0f, 0x1c, 0x1c, 0x24, 0x04, 0x04, 0x3d, 0x17, 0x15, 0x0b, 0x02,
-    0x04, 0x04, 0x04, 0x07, 0x16, 0x14, 0x03, 0x03, 0x04, 0x04, 0x02, 0x18,
-    0x18, 0x09, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x80,
-    0x01, 0xa0, 0x00, 0x15, 0x00, 0x00, 0x13, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x11, 0x31, 0x16, 0x17, 0x36, 0x37, 0x11, 0x31, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x18, 0x16, 0x02, 0x02, 0x16, 0x90, 0x02, 0x16,
-    0x16, 0x02, 0x90, 0x16, 0x02, 0x02, 0x16, 0xa8, 0x01, 0xa0, 0x02, 0x16,
-    0x16, 0x02, 0xfe, 0x88, 0x16, 0x02, 0x02, 0x16, 0x01, 0x78, 0x02, 0x16,
-    0x16, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x80,
-    0x01, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x13, 0x16, 0x17, 0x15, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x36, 0x37, 0x16,
-    0x17, 0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x35,
-    0x31, 0x36, 0x37, 0x18, 0x16, 0x02, 0x02, 0x28, 0x29, 0x3d, 0x3d, 0x29,
-    0x28, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x36, 0x36, 0x52, 0x52, 0x36,
-    0x36, 0x02, 0x02, 0x16, 0x01, 0xa0, 0x02, 0x16, 0xe8, 0x3d, 0x29, 0x28,
-    0x02, 0x02, 0x28, 0x29, 0x3d, 0xe8, 0x16, 0x02, 0x02, 0x16, 0xe8, 0x52,
-    0x36, 0x36, 0x02, 0x02, 0x36, 0x36, 0x52, 0xe8, 0x16, 0x02, 0x00, 0x00,
-    0x00, 0x01, 0xff, 0xfb, 0xff, 0xe0, 0x01, 0x85, 0x01, 0xa5, 0x00, 0x14,
-    0x00, 0x00, 0x13, 0x36, 0x17, 0x13, 0x31, 0x13, 0x31, 0x36, 0x17, 0x16,
-    0x07, 0x03, 0x31, 0x06, 0x07, 0x26, 0x27, 0x03, 0x31, 0x26, 0x37, 0x0f,
-    0x15, 0x0a, 0x92, 0x92, 0x0a, 0x15, 0x14, 0x07, 0xa8, 0x07, 0x0f, 0x0f,
-    0x07, 0xa8, 0x07, 0x14, 0x01, 0x9e, 0x07, 0x14, 0xfe, 0xa5, 0x01, 0x5b,
-    0x14, 0x07, 0x0a, 0x15, 0xfe, 0x70, 0x0e, 0x01, 0x01, 0x0e, 0x01, 0x90,
-    0x15, 0x0a, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0xff, 0xe0, 0x02, 0x44,
-    0x01, 0xa4, 0x00, 0x24, 0x00, 0x00, 0x13, 0x36, 0x17, 0x13, 0x31, 0x13,
-    0x31, 0x36, 0x37, 0x16, 0x17, 0x13, 0x31, 0x13, 0x31, 0x36, 0x17, 0x16,
-    0x07, 0x03, 0x31, 0x06, 0x07, 0x26, 0x27, 0x03, 0x31, 0x03, 0x31, 0x06,
-    0x07, 0x22, 0x27, 0x03, 0x31, 0x26, 0x37, 0x10, 0x15, 0x0a, 0x77, 0x63,
-    0x06, 0x11, 0x11, 0x06, 0x63, 0x77, 0x0a, 0x15, 0x14, 0x05, 0x90, 0x07,
-    0x11, 0x10, 0x06, 0x61, 0x61, 0x06, 0x10, 0x11, 0x06, 0x91, 0x05, 0x14,
-    0x01, 0x9f, 0x05, 0x14, 0xfe, 0xb5, 0x01, 0x4a, 0x10, 0x01, 0x01, 0x10,
-    0xfe, 0xb6, 0x01, 0x4b, 0x14, 0x05, 0x0a, 0x15, 0xfe, 0x70, 0x0f, 0x01,
-    0x01, 0x10, 0x01, 0x43, 0xfe, 0xbd, 0x10, 0x01, 0x10, 0x01, 0x90, 0x15,
-    0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9, 0xff, 0xd9, 0x01, 0x87,
-    0x01, 0xa7, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x36, 0x27, 0x26, 0x07, 0x07,
-    0x31, 0x27, 0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31, 0x07, 0x31, 0x06,
-    0x17, 0x16, 0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27,
-    0x31, 0x37, 0x01, 0x7a, 0x0d, 0x0f, 0x13, 0x0f, 0x96, 0x96, 0x0f, 0x12,
-    0x10, 0x0d, 0x9b, 0x9b, 0x0d, 0x10, 0x12, 0x0f, 0x96, 0x96, 0x0f, 0x12,
-    0x10, 0x0d, 0x9b, 0x9b, 0x01, 0x79, 0x12, 0x0f, 0x0d, 0x10, 0xb2, 0xb2,
-    0x10, 0x0d, 0x0f, 0x12, 0xb9, 0xb9, 0x12, 0x0f, 0x0d, 0x0f, 0xb3, 0xb2,
-    0x10, 0x0d, 0x0f, 0x12, 0xb9, 0xb9, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9,
-    0xff, 0xe0, 0x01, 0x87, 0x01, 0xa7, 0x00, 0x17, 0x00, 0x00, 0x13, 0x26,
-    0x07, 0x06, 0x17, 0x17, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35,
-    0x31, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x27, 0x2b, 0x0e,
-    0x13, 0x11, 0x0c, 0xa3, 0x02, 0x16, 0x16, 0x02, 0xa3, 0x0c, 0x11, 0x13,
-    0x0e, 0x95, 0x95, 0x01, 0x96, 0x11, 0x0c, 0x0e, 0x13, 0xe2, 0xa0, 0x16,
-    0x02, 0x02, 0x16, 0xa0, 0xe2, 0x13, 0x0e, 0x0c, 0x11, 0xcd, 0xcd, 0x00,
-    0x00, 0x01, 0xff, 0xfc, 0xff, 0xe0, 0x01, 0x84, 0x01, 0xa0, 0x00, 0x1c,
-    0x00, 0x00, 0x13, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x07, 0x01,
-    0x31, 0x21, 0x31, 0x16, 0x17, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26,
-    0x37, 0x01, 0x31, 0x21, 0x31, 0x26, 0x27, 0x00, 0x02, 0x16, 0x01, 0x50,
-    0x0f, 0x07, 0x06, 0x0a, 0xfe, 0xd2, 0x01, 0x1c, 0x16, 0x02, 0x02, 0x16,
-    0xfe, 0xb0, 0x0f, 0x07, 0x06, 0x0a, 0x01, 0x2f, 0xfe, 0xe3, 0x16, 0x02,
-    0x01, 0x88, 0x16, 0x02, 0x01, 0x0d, 0x0e, 0x0c, 0xfe, 0x98, 0x02, 0x16,
-    0x16, 0x02, 0x01, 0x0d, 0x0e, 0x0b, 0x01, 0x69, 0x02, 0x16, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x1f,
-    0x00, 0x33, 0x00, 0x40, 0x00, 0x00, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x11, 0x31, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x27, 0x31, 0x26,
-    0x23, 0x23, 0x07, 0x36, 0x37, 0x33, 0x31, 0x32, 0x17, 0x17, 0x31, 0x16,
-    0x33, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x21, 0x31, 0x35, 0x15, 0x21,
-    0x21, 0x21, 0x15, 0x31, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x35, 0x40,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x9e, 0x2b, 0x15, 0x1e, 0x84, 0x10,
-    0x01, 0x0f, 0x84, 0x0a, 0x07, 0x2d, 0x0c, 0x11, 0xa1, 0x0f, 0x01, 0xfe,
-    0x60, 0x01, 0xa0, 0xfe, 0x60, 0x01, 0xa0, 0x01, 0x0f, 0xfe, 0x80, 0x0f,
-    0x01, 0x01, 0xa0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x2b,
-    0x15, 0x40, 0x0f, 0x01, 0x07, 0x2d, 0x0c, 0x01, 0x0f, 0x20, 0x60, 0x90,
-    0xb0, 0x0f, 0x01, 0x01, 0x0f, 0xb0, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x14,
-    0x00, 0x1b, 0x00, 0x35, 0x00, 0x00, 0x37, 0x37, 0x07, 0x37, 0x27, 0x31,
-    0x11, 0x17, 0x33, 0x23, 0x33, 0x27, 0x31, 0x07, 0x37, 0x17, 0x27, 0x17,
-    0x11, 0x31, 0x07, 0x37, 0x23, 0x33, 0x23, 0x17, 0x31, 0x37, 0x21, 0x36,
-    0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x30, 0x73, 0x73, 0x73, 0x73, 0x1d, 0xe6, 0xe6, 0xe6, 0x73, 0x73, 0x90,
-    0x73, 0x73, 0x73, 0x73, 0x56, 0xe6, 0xe6, 0xe6, 0x73, 0x73, 0xfe, 0xcd,
-    0x01, 0x0d, 0x0e, 0x14, 0x01, 0x20, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d,
-    0x0e, 0x14, 0xfe, 0xe0, 0x14, 0x0e, 0x0d, 0x01, 0x1a, 0xa6, 0xa6, 0xa6,
-    0xa6, 0xfe, 0xb4, 0x2a, 0xa6, 0xa6, 0xd0, 0xa6, 0xa6, 0xa6, 0x01, 0x4c,
-    0xa6, 0xd0, 0xa6, 0xa6, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14,
-    0xfe, 0x60, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x01, 0xa0,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0x9d, 0x00, 0x2b,
-    0x00, 0x62, 0x00, 0x00, 0x17, 0x27, 0x17, 0x27, 0x27, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x36, 0x37,
-    0x36, 0x37, 0x30, 0x31, 0x30, 0x31, 0x36, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x15, 0x31, 0x06, 0x07, 0x07, 0x31, 0x07, 0x31, 0x06, 0x23, 0x22, 0x27,
-    0x13, 0x30, 0x27, 0x31, 0x31, 0x30, 0x31, 0x27, 0x31, 0x30, 0x31, 0x30,
-    0x31, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x06, 0x07, 0x15, 0x31, 0x16,
-    0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x31, 0x07, 0x31, 0x30,
-    0x07, 0x30, 0x31, 0x06, 0x23, 0x22, 0x27, 0xe2, 0x03, 0x03, 0x03, 0xaf,
-    0x2f, 0x01, 0x01, 0x21, 0x20, 0x35, 0x3e, 0x32, 0x0e, 0x0b, 0x06, 0x08,
-    0x05, 0x06, 0x32, 0x3e, 0x35, 0x20, 0x21, 0x01, 0x01, 0x2f, 0xaf, 0x03,
-    0x0d, 0x11, 0x11, 0x0d, 0x0d, 0x01, 0x12, 0x12, 0x18, 0x18, 0x1a, 0x23,
-    0x16, 0x16, 0x01, 0x01, 0x20, 0xaf, 0xaf, 0x20, 0x01, 0x01, 0x16, 0x16,
-    0x23, 0x1a, 0x18, 0x18, 0x12, 0x12, 0x01, 0x07, 0x0a, 0x0a, 0x07, 0x14,
-    0x02, 0x02, 0x02, 0xa3, 0x2d, 0x41, 0x03, 0x36, 0x28, 0x27, 0x0b, 0x0b,
-    0x23, 0x09, 0x0d, 0x07, 0x06, 0x05, 0x04, 0x23, 0x0a, 0x0b, 0x28, 0x28,
-    0x36, 0x03, 0x41, 0x2d, 0xa3, 0x02, 0x0c, 0x0c, 0x01, 0x43, 0x01, 0x14,
-    0x14, 0x08, 0x08, 0x05, 0x07, 0x1b, 0x1a, 0x25, 0x03, 0x2c, 0x1f, 0xa3,
-    0xa3, 0x1f, 0x2c, 0x03, 0x25, 0x1a, 0x1b, 0x07, 0x05, 0x08, 0x08, 0x14,
-    0x14, 0x01, 0x07, 0x07, 0x00, 0x02, 0x00, 0x15, 0xff, 0xbc, 0x02, 0x2b,
-    0x01, 0xc0, 0x00, 0x28, 0x00, 0x47, 0x00, 0x00, 0x01, 0x16, 0x17, 0x17,
-    0x31, 0x17, 0x31, 0x16, 0x17, 0x16, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16,
-    0x07, 0x06, 0x27, 0x27, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37,
-    0x31, 0x27, 0x31, 0x26, 0x37, 0x36, 0x37, 0x37, 0x31, 0x37, 0x31, 0x36,
-    0x37, 0x15, 0x07, 0x37, 0x07, 0x06, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16,
-    0x07, 0x07, 0x31, 0x37, 0x31, 0x36, 0x17, 0x17, 0x31, 0x27, 0x31, 0x26,
-    0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x27, 0x27, 0x01, 0x20, 0x0f, 0x07,
-    0x44, 0x99, 0x0f, 0x05, 0x04, 0x0a, 0x6f, 0x1a, 0x02, 0x0c, 0x0c, 0x0d,
-    0x89, 0x89, 0x0d, 0x0c, 0x0c, 0x02, 0x1a, 0x6f, 0x0a, 0x04, 0x05, 0x0f,
-    0x99, 0x44, 0x07, 0x0f, 0x35, 0x35, 0x35, 0x05, 0x0d, 0x76, 0x56, 0x08,
-    0x01, 0x15, 0x6a, 0x0b, 0x0b, 0x69, 0x14, 0x02, 0x09, 0x56, 0x76, 0x0d,
-    0x05, 0x35, 0x01, 0xc0, 0x01, 0x0d, 0x8d, 0x16, 0x03, 0x0e, 0x0e, 0x0a,
-    0x6e, 0x9c, 0x0e, 0x0a, 0x08, 0x07, 0x49, 0x49, 0x07, 0x09, 0x09, 0x0e,
-    0x9c, 0x6e, 0x0a, 0x0e, 0x0e, 0x03, 0x16, 0x8d, 0x0d, 0x01, 0x4f, 0x6c,
-    0x6c, 0x6c, 0x0b, 0x03, 0x11, 0x55, 0x09, 0x0c, 0x78, 0x38, 0x06, 0x06,
-    0x38, 0x78, 0x0c, 0x09, 0x55, 0x11, 0x03, 0x0b, 0x6c, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x0c,
-    0x00, 0x27, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x00, 0x01, 0x26, 0x27, 0x26,
-    0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x23, 0x34, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x15,
-    0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35,
-    0x03, 0x21, 0x21, 0x21, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07,
-    0x06, 0x07, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x33, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x23, 0x21, 0x31, 0x22, 0x27, 0x26,
-    0x35, 0x01, 0x30, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x01, 0x27, 0x28,
-    0x28, 0x27, 0x01, 0xd0, 0x11, 0x11, 0x1e, 0x1e, 0x22, 0x22, 0x1e, 0x1e,
-    0x11, 0x11, 0x11, 0x11, 0x1e, 0x1e, 0x22, 0x22, 0x1e, 0x1e, 0x11, 0x11,
-    0x2f, 0x01, 0x5e, 0xfe, 0xa2, 0x01, 0x5e, 0x08, 0x23, 0x24, 0x32, 0x5c,
-    0x32, 0x23, 0x24, 0x08, 0x31, 0x02, 0x32, 0x33, 0x4b, 0x5c, 0x4b, 0x33,
-    0x32, 0x02, 0x09, 0x08, 0x0d, 0xfe, 0x7c, 0x0d, 0x08, 0x09, 0x01, 0x40,
-    0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d,
-    0x23, 0x1d, 0x1d, 0x12, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x23, 0x23, 0x1d,
-    0x1d, 0x12, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x23, 0xfe, 0xb0, 0x31, 0x1f,
-    0x1f, 0x01, 0x01, 0x1f, 0x1f, 0x31, 0x12, 0x4b, 0x33, 0x32, 0x02, 0x02,
-    0x32, 0x33, 0x4b, 0x0d, 0x08, 0x09, 0x09, 0x08, 0x0d, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x49, 0x00, 0x00, 0x25, 0x14, 0x07, 0x31, 0x31, 0x06,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36,
-    0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x15, 0x21, 0x16, 0x17,
-    0x31, 0x31, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x37,
-    0x26, 0x27, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x07,
-    0x37, 0x15, 0x35, 0x15, 0x14, 0x17, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27,
-    0x27, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x01, 0xd0, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xe8, 0x0b, 0x60, 0x13,
-    0x0e, 0x0b, 0x12, 0x55, 0x02, 0x16, 0x16, 0x02, 0xc0, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x88, 0x88, 0x88, 0x88, 0x0d, 0x07, 0x40, 0x0b, 0x12, 0x13, 0x0e,
-    0x39, 0x7b, 0x16, 0x02, 0x02, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-    0xff, 0xe0, 0x02, 0x40, 0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3c,
-    0x00, 0x49, 0x00, 0x56, 0x00, 0x63, 0x00, 0x76, 0x00, 0x89, 0x00, 0x00,
-    0x13, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11,
-    0x31, 0x26, 0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x21,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x17, 0x34, 0x37, 0x31, 0x31, 0x36,
-    0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x35, 0x33, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31,
-    0x26, 0x27, 0x15, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23,
-    0x31, 0x26, 0x27, 0x15, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x27, 0x22, 0x27, 0x31, 0x31, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x07,
-    0x34, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0xc0, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0x40, 0x40, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x40,
-    0x1b, 0x12, 0x12, 0x01, 0x60, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x68, 0x02, 0x16, 0xe0, 0x16, 0x02, 0x02,
-    0x16, 0xe0, 0x16, 0x02, 0x02, 0x16, 0xe0, 0x16, 0x02, 0x02, 0x16, 0xe0,
-    0x16, 0x02, 0x02, 0x16, 0xe0, 0x16, 0x02, 0x02, 0x16, 0xe0, 0x16, 0x02,
-    0x48, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f,
-    0x01, 0x40, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0x40, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x60, 0x16,
-    0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x60, 0x16, 0x02, 0x02, 0x16,
-    0x16, 0x02, 0x02, 0x16, 0x40, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x2d, 0x00, 0x42, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x11, 0x31, 0x15, 0x31, 0x15,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x26, 0x07, 0x07,
-    0x31, 0x06, 0x23, 0x22, 0x27, 0x26, 0x07, 0x07, 0x31, 0x35, 0x15, 0x37,
-    0x07, 0x37, 0x36, 0x17, 0x16, 0x17, 0x16, 0x37, 0x15, 0x31, 0x07, 0x31,
-    0x06, 0x27, 0x26, 0x07, 0x07, 0x31, 0x35, 0x30, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x50, 0x40, 0x3b, 0x45, 0x49, 0x22, 0x14, 0x01,
-    0x01, 0x0e, 0x0d, 0x11, 0x09, 0x24, 0x26, 0x26, 0x23, 0x37, 0x3b, 0x55,
-    0x61, 0x61, 0x61, 0x29, 0x27, 0x2a, 0x2d, 0x2d, 0x2b, 0x18, 0x35, 0x33,
-    0x4b, 0x50, 0x45, 0x01, 0xa8, 0x16, 0x02, 0x02, 0x16, 0x28, 0xfe, 0xe1,
-    0x31, 0x58, 0x16, 0x02, 0x02, 0x16, 0x64, 0x14, 0x0f, 0x1c, 0x22, 0x1a,
-    0x0d, 0x09, 0x15, 0x01, 0x18, 0x12, 0x08, 0x09, 0x07, 0x05, 0x12, 0x12,
-    0x1a, 0x0e, 0x15, 0x1c, 0x4e, 0x19, 0x19, 0x19, 0x0a, 0x13, 0x15, 0x01,
-    0x02, 0x11, 0xf2, 0x09, 0x13, 0x19, 0x24, 0x13, 0x12, 0xed, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0xff, 0xbd, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x2b,
-    0x00, 0x00, 0x13, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x15, 0x31, 0x11,
-    0x31, 0x37, 0x31, 0x36, 0x17, 0x17, 0x31, 0x11, 0x31, 0x21, 0x31, 0x35,
-    0x31, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x14, 0x07, 0x06,
-    0x27, 0x27, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x27, 0x11, 0x00, 0x01,
-    0x0d, 0x0e, 0x14, 0x82, 0x0e, 0x0e, 0x82, 0xfe, 0xe0, 0x01, 0x20, 0x14,
-    0x0e, 0x0d, 0x01, 0x0d, 0x0d, 0x0c, 0x9a, 0x9a, 0x0c, 0x0d, 0x0c, 0x01,
-    0x01, 0x90, 0x14, 0x0e, 0x0d, 0x01, 0x30, 0xfe, 0x77, 0x5c, 0x09, 0x09,
-    0x5c, 0x01, 0x89, 0x30, 0x01, 0x0d, 0x0e, 0x14, 0xfe, 0x48, 0x0e, 0x07,
-    0x06, 0x07, 0x6e, 0x6e, 0x07, 0x06, 0x07, 0x0e, 0x01, 0xb8, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x1f,
-    0x00, 0x39, 0x00, 0x46, 0x00, 0x00, 0x01, 0x16, 0x17, 0x11, 0x31, 0x27,
-    0x31, 0x27, 0x31, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26,
-    0x23, 0x22, 0x07, 0x07, 0x31, 0x07, 0x31, 0x31, 0x31, 0x11, 0x31, 0x36,
-    0x37, 0x21, 0x25, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x21, 0x17, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x06, 0x17, 0x16, 0x17, 0x01, 0xc0, 0x0f, 0x01, 0x05, 0x88, 0x07,
-    0x0c, 0x0c, 0x07, 0x53, 0x1e, 0x08, 0x0c, 0x0c, 0x07, 0x50, 0x05, 0x01,
-    0x0f, 0x01, 0x80, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x01, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe,
-    0x80, 0x50, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x1b, 0x0f, 0x0c, 0x0c,
-    0x0f, 0x1b, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x07, 0xb0, 0x09, 0x09,
-    0x6c, 0x2b, 0x0a, 0x0a, 0x70, 0x06, 0x01, 0x40, 0x0f, 0x01, 0x30, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xc0, 0x01, 0x17, 0x18, 0x18,
-    0x17, 0x01, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0xfc, 0x01, 0xbc, 0x00, 0x0d, 0x00, 0x1d, 0x00, 0x39,
-    0x00, 0x6b, 0x00, 0x00, 0x01, 0x17, 0x27, 0x17, 0x16, 0x07, 0x07, 0x31,
-    0x27, 0x31, 0x37, 0x31, 0x36, 0x17, 0x07, 0x37, 0x07, 0x37, 0x17, 0x31,
-    0x07, 0x31, 0x06, 0x07, 0x07, 0x31, 0x37, 0x31, 0x36, 0x37, 0x37, 0x07,
-    0x37, 0x07, 0x06, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31,
-    0x36, 0x37, 0x37, 0x31, 0x36, 0x35, 0x34, 0x27, 0x27, 0x31, 0x26, 0x23,
-    0x22, 0x07, 0x05, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x26,
-    0x27, 0x06, 0x07, 0x15, 0x31, 0x14, 0x07, 0x06, 0x23, 0x21, 0x31, 0x22,
-    0x27, 0x26, 0x35, 0x11, 0x31, 0x34, 0x37, 0x36, 0x33, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x01, 0xb9, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x1d,
-    0x2e, 0x1d, 0x11, 0x11, 0xe7, 0x86, 0x86, 0x86, 0x2e, 0x86, 0x05, 0x06,
-    0x3a, 0x11, 0x01, 0x05, 0xa3, 0xc5, 0xc5, 0xc5, 0x0d, 0x05, 0x1d, 0x04,
-    0x0a, 0x0a, 0x0e, 0x64, 0x12, 0x0d, 0xc5, 0x15, 0x15, 0x0c, 0x16, 0x1d,
-    0x1d, 0x16, 0xfe, 0xe3, 0x25, 0x19, 0x19, 0x01, 0x01, 0x19, 0x19, 0x25,
-    0x01, 0x10, 0x25, 0x19, 0x19, 0x01, 0x02, 0x16, 0x16, 0x02, 0x0c, 0x0b,
-    0x11, 0xfe, 0xf0, 0x11, 0x0b, 0x0c, 0x0c, 0x0b, 0x11, 0x70, 0x16, 0x02,
-    0x02, 0x16, 0x70, 0x01, 0x85, 0x0c, 0x0c, 0x0c, 0x11, 0x11, 0x1d, 0x2e,
-    0x1d, 0x0e, 0x0e, 0xc5, 0x86, 0x86, 0x86, 0x2e, 0x86, 0x05, 0x01, 0x11,
-    0x3a, 0x06, 0x05, 0xe7, 0xc5, 0xc5, 0xc5, 0x0e, 0x11, 0x64, 0x0e, 0x0a,
-    0x09, 0x03, 0x1d, 0x05, 0x0d, 0xc5, 0x16, 0x1d, 0x1d, 0x16, 0x0c, 0x15,
-    0x15, 0x27, 0x01, 0x19, 0x19, 0x25, 0xfe, 0xf0, 0x25, 0x19, 0x19, 0x01,
-    0x01, 0x19, 0x19, 0x25, 0x70, 0x16, 0x02, 0x02, 0x16, 0x70, 0x11, 0x0b,
-    0x0c, 0x0c, 0x0b, 0x11, 0x01, 0x10, 0x11, 0x0b, 0x0c, 0x02, 0x16, 0x16,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x56, 0x00, 0x00, 0x01, 0x32,
-    0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36,
-    0x33, 0x11, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x03, 0x06, 0x17, 0x17, 0x31, 0x07, 0x31, 0x06,
-    0x17, 0x16, 0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27,
-    0x31, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26,
-    0x07, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f,
-    0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a,
-    0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x51, 0x0e, 0x0e, 0x2f, 0x2f,
-    0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f,
-    0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x01, 0x90, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x51, 0x11, 0x11,
-    0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x11, 0x11,
-    0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x47, 0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16,
-    0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x13, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x07, 0x06,
-    0x17, 0x17, 0x31, 0x16, 0x37, 0x37, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x71, 0x0e, 0x0e, 0x11, 0x11, 0x6f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x40,
-    0x11, 0x11, 0x80, 0x01, 0x90, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x6f, 0x2f, 0x0e,
-    0x0e, 0x11, 0x11, 0x40, 0x0e, 0x0e, 0x80, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x5f,
-    0x00, 0x72, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26,
-    0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x37, 0x36,
-    0x37, 0x31, 0x31, 0x36, 0x33, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x06,
-    0x07, 0x07, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x34, 0x37, 0x37,
-    0x31, 0x36, 0x35, 0x26, 0x27, 0x23, 0x31, 0x22, 0x07, 0x15, 0x31, 0x06,
-    0x27, 0x26, 0x37, 0x35, 0x17, 0x34, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32,
-    0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x35, 0x01,
-    0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xaa,
-    0x06, 0x0e, 0x0e, 0x13, 0x3a, 0x1b, 0x12, 0x11, 0x01, 0x01, 0x1f, 0x20,
-    0x02, 0x16, 0x16, 0x02, 0x0c, 0x2c, 0x08, 0x01, 0x0e, 0x3a, 0x06, 0x02,
-    0x0a, 0x15, 0x14, 0x06, 0x36, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x5b, 0x11,
-    0x0a, 0x0a, 0x01, 0x12, 0x11, 0x1b, 0x24, 0x13, 0x12, 0x16, 0x02, 0x02,
-    0x16, 0x0d, 0x0e, 0x07, 0x1a, 0x04, 0x09, 0x0e, 0x01, 0x05, 0x02, 0x14,
-    0x06, 0x09, 0x15, 0x02, 0xbb, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xfe,
-    0xff, 0xe0, 0x02, 0x43, 0x01, 0xa0, 0x00, 0x22, 0x00, 0x49, 0x00, 0x68,
-    0x00, 0x83, 0x00, 0x00, 0x01, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x36,
-    0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x26, 0x37, 0x36, 0x37, 0x36, 0x37, 0x17, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x22, 0x31, 0x30, 0x23, 0x16, 0x15, 0x06,
-    0x07, 0x06, 0x07, 0x22, 0x27, 0x14, 0x31, 0x30, 0x15, 0x16, 0x17, 0x16,
-    0x17, 0x35, 0x32, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37,
-    0x36, 0x37, 0x36, 0x33, 0x01, 0x20, 0x31, 0x28, 0x28, 0x1f, 0x1d, 0x14,
-    0x13, 0x0b, 0x0b, 0x13, 0x14, 0x1d, 0x1f, 0x28, 0x28, 0x31, 0x31, 0x28,
-    0x28, 0x1f, 0x1d, 0x14, 0x13, 0x0b, 0x0b, 0x13, 0x14, 0x1d, 0x1f, 0x28,
-    0x28, 0x31, 0xc1, 0x24, 0x30, 0x30, 0x3d, 0x3d, 0x30, 0x30, 0x24, 0x23,
-    0x17, 0x17, 0x0c, 0x05, 0x05, 0x0c, 0x17, 0x17, 0x23, 0x24, 0x30, 0x30,
-    0x3d, 0x3d, 0x30, 0x30, 0x24, 0x23, 0x17, 0x17, 0x0b, 0x05, 0x05, 0x0b,
-    0x17, 0x17, 0x23, 0xc1, 0x22, 0x17, 0x16, 0x01, 0x01, 0x16, 0x17, 0x22,
-    0x01, 0x01, 0x02, 0x01, 0x12, 0x12, 0x1b, 0x08, 0x08, 0x01, 0x16, 0x17,
-    0x22, 0x23, 0x1d, 0x1d, 0x12, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x23, 0x23,
-    0x1d, 0x1d, 0x12, 0x11, 0x11, 0x12, 0x1d, 0x1d, 0x23, 0x01, 0x70, 0x01,
-    0x13, 0x12, 0x1e, 0x1b, 0x1d, 0x1d, 0x17, 0x17, 0x1d, 0x1d, 0x1b, 0x1e,
-    0x12, 0x13, 0x01, 0x01, 0x13, 0x12, 0x1e, 0x1b, 0x1d, 0x1d, 0x17, 0x17,
-    0x1d, 0x1d, 0x1b, 0x1e, 0x12, 0x13, 0x01, 0x21, 0x22, 0x17, 0x17, 0x01,
-    0x01, 0x17, 0x17, 0x22, 0x21, 0x23, 0x23, 0x1c, 0x0c, 0x0c, 0x1c, 0x23,
-    0x23, 0x21, 0x22, 0x17, 0x17, 0x01, 0x01, 0x17, 0x17, 0x22, 0x21, 0x23,
-    0x23, 0x1c, 0x0c, 0x0c, 0x1c, 0x23, 0x23, 0x21, 0xdf, 0x01, 0x16, 0x17,
-    0x22, 0x22, 0x17, 0x16, 0x01, 0x08, 0x08, 0x1b, 0x12, 0x12, 0x01, 0x02,
-    0x01, 0x01, 0x22, 0x17, 0x16, 0x01, 0xd0, 0x11, 0x11, 0x1e, 0x1e, 0x22,
-    0x22, 0x1e, 0x1e, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x1e, 0x22, 0x22, 0x1e,
-    0x1e, 0x11, 0x11, 0x00, 0x00, 0x05, 0xff, 0xf9, 0xff, 0xb9, 0x02, 0x87,
-    0x01, 0xc7, 0x00, 0x1f, 0x00, 0x39, 0x00, 0x49, 0x00, 0x69, 0x00, 0x79,
-    0x00, 0x00, 0x13, 0x26, 0x07, 0x06, 0x17, 0x01, 0x31, 0x16, 0x37, 0x36,
-    0x27, 0x27, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x27, 0x17, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x27, 0x31, 0x36, 0x35, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x27,
-    0x17, 0x27, 0x17, 0x27, 0x36, 0x35, 0x34, 0x27, 0x32, 0x33, 0x16, 0x17,
-    0x16, 0x17, 0x14, 0x07, 0x17, 0x27, 0x17, 0x27, 0x06, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x27, 0x31, 0x06, 0x07,
-    0x06, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37,
-    0x27, 0x27, 0x17, 0x27, 0x26, 0x27, 0x27, 0x31, 0x14, 0x15, 0x16, 0x17,
-    0x16, 0x17, 0x32, 0x37, 0x27, 0x13, 0x0f, 0x0c, 0x10, 0x02, 0x50, 0x13,
-    0x0f, 0x0c, 0x10, 0x69, 0x1d, 0x14, 0x14, 0x0b, 0x04, 0x04, 0x0c, 0x17,
-    0x17, 0x23, 0x24, 0x30, 0x30, 0x3d, 0x33, 0x2b, 0x2a, 0x21, 0x70, 0x97,
-    0x36, 0x4c, 0x31, 0x28, 0x28, 0x1f, 0x1d, 0x14, 0x13, 0x0b, 0x0a, 0x12,
-    0x12, 0x19, 0x36, 0x0e, 0x01, 0x24, 0x25, 0x36, 0x31, 0x23, 0x2e, 0xcd,
-    0x52, 0x52, 0x52, 0x07, 0x02, 0x01, 0x01, 0x22, 0x17, 0x16, 0x01, 0x05,
-    0x33, 0x2a, 0x2a, 0x2a, 0x26, 0x2e, 0x31, 0x28, 0x28, 0x1f, 0x1d, 0x14,
-    0x13, 0x0b, 0x0d, 0x1b, 0x26, 0x22, 0x0e, 0x05, 0x05, 0x0b, 0x17, 0x17,
-    0x24, 0x23, 0x30, 0x30, 0x3d, 0x48, 0x36, 0x58, 0x38, 0x38, 0x38, 0x25,
-    0x11, 0x38, 0x01, 0x24, 0x25, 0x36, 0x14, 0x12, 0x01, 0xbb, 0x0c, 0x10,
-    0x13, 0x0f, 0xfe, 0x30, 0x0c, 0x10, 0x13, 0x0f, 0x52, 0x1f, 0x20, 0x1f,
-    0x19, 0x0c, 0x0c, 0x1c, 0x23, 0x23, 0x21, 0x22, 0x17, 0x17, 0x01, 0x01,
-    0x10, 0x11, 0x1b, 0x58, 0x76, 0x29, 0x02, 0x01, 0x13, 0x12, 0x1e, 0x1b,
-    0x1d, 0x1d, 0x17, 0x15, 0x1b, 0x1b, 0x1a, 0x2a, 0x1b, 0x20, 0x36, 0x25,
-    0x24, 0x01, 0x01, 0x1e, 0x24, 0xa1, 0x40, 0x40, 0x40, 0x0d, 0x0f, 0x08,
-    0x08, 0x01, 0x16, 0x17, 0x22, 0x0f, 0x0d, 0xa4, 0x21, 0x21, 0x21, 0x10,
-    0x01, 0x01, 0x13, 0x12, 0x1e, 0x1b, 0x1d, 0x1d, 0x17, 0x1d, 0x24, 0x1d,
-    0x2e, 0x24, 0x0c, 0x0c, 0x1c, 0x23, 0x23, 0x21, 0x22, 0x17, 0x17, 0x01,
-    0x02, 0x1e, 0x46, 0x2c, 0x2c, 0x2c, 0x09, 0x21, 0x2c, 0x04, 0x04, 0x36,
-    0x25, 0x24, 0x01, 0x06, 0x00, 0x0a, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0,
-    0x01, 0xc0, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x45, 0x00, 0x4e, 0x00, 0x57,
-    0x00, 0x60, 0x00, 0x6b, 0x00, 0x74, 0x00, 0x7f, 0x00, 0x88, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x15, 0x31, 0x15, 0x31, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x35, 0x31, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15,
-    0x31, 0x23, 0x31, 0x35, 0x07, 0x33, 0x23, 0x33, 0x15, 0x31, 0x23, 0x31,
-    0x35, 0x15, 0x33, 0x23, 0x33, 0x15, 0x31, 0x23, 0x31, 0x35, 0x33, 0x33,
-    0x23, 0x33, 0x15, 0x31, 0x23, 0x31, 0x35, 0x33, 0x33, 0x23, 0x33, 0x15,
-    0x31, 0x23, 0x31, 0x35, 0x37, 0x23, 0x33, 0x23, 0x35, 0x31, 0x33, 0x31,
-    0x15, 0x15, 0x15, 0x35, 0x15, 0x06, 0x07, 0x23, 0x31, 0x35, 0x31, 0x33,
-    0x23, 0x15, 0x35, 0x15, 0x23, 0x31, 0x35, 0x31, 0x33, 0x23, 0x15, 0x35,
-    0x15, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x33, 0x37, 0x23, 0x33, 0x23,
-    0x35, 0x31, 0x33, 0x31, 0x15, 0x98, 0x02, 0x16, 0x16, 0x02, 0x28, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x28, 0x02, 0x16, 0x16, 0x02, 0x90, 0x68,
-    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x80, 0x60, 0x60, 0x60,
-    0x60, 0x90, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x01,
-    0x0f, 0x40, 0x50, 0x80, 0x60, 0x60, 0x90, 0x40, 0x0f, 0x01, 0x50, 0x90,
-    0x60, 0x60, 0x60, 0x60, 0x01, 0xa8, 0x16, 0x02, 0x02, 0x16, 0x28, 0x01,
-    0x12, 0x12, 0x1b, 0x10, 0x30, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x00, 0x30, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x28,
-    0x16, 0x02, 0x02, 0x16, 0x28, 0x28, 0xa8, 0x38, 0x38, 0x68, 0x40, 0x40,
-    0x40, 0x40, 0x40, 0x40, 0x30, 0x38, 0x38, 0xa0, 0x28, 0x28, 0x28, 0x0f,
-    0x01, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x01, 0x0f, 0x28,
-    0xa0, 0x38, 0x38, 0x00, 0x00, 0x02, 0xff, 0xfe, 0xff, 0xe0, 0x02, 0x00,
-    0x01, 0xa0, 0x00, 0x18, 0x00, 0x4f, 0x00, 0x00, 0x37, 0x36, 0x17, 0x16,
-    0x33, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06,
-    0x07, 0x14, 0x17, 0x16, 0x07, 0x06, 0x07, 0x36, 0x37, 0x07, 0x36, 0x37,
-    0x36, 0x37, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27,
-    0x06, 0x07, 0x06, 0x07, 0x30, 0x23, 0x30, 0x23, 0x06, 0x23, 0x30, 0x31,
-    0x22, 0x31, 0x06, 0x23, 0x22, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x37,
-    0x30, 0x31, 0x30, 0x31, 0x7c, 0x14, 0x18, 0x28, 0x30, 0x5f, 0x38, 0x38,
-    0x01, 0x01, 0x38, 0x38, 0x5f, 0x5f, 0x38, 0x38, 0x01, 0x24, 0x0d, 0x01,
-    0x03, 0x09, 0x1a, 0x0e, 0x67, 0x03, 0x02, 0x11, 0x05, 0x2f, 0x01, 0x01,
-    0x22, 0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01, 0x01,
-    0x22, 0x22, 0x3a, 0x39, 0x48, 0x38, 0x30, 0x13, 0x23, 0x17, 0x1c, 0x01,
-    0x01, 0x06, 0x07, 0x01, 0x07, 0x08, 0x0b, 0x04, 0x03, 0x06, 0x07, 0x05,
-    0x02, 0x03, 0x39, 0x0e, 0x08, 0x0f, 0x03, 0x2f, 0x30, 0x3e, 0x3e, 0x30,
-    0x2f, 0x03, 0x03, 0x2f, 0x30, 0x3e, 0x31, 0x28, 0x0f, 0x15, 0x1b, 0x16,
-    0x0d, 0x0a, 0x29, 0x04, 0x04, 0x1a, 0x25, 0x34, 0x45, 0x3a, 0x2f, 0x2f,
-    0x1c, 0x1b, 0x01, 0x01, 0x1b, 0x1c, 0x2f, 0x2f, 0x3a, 0x3a, 0x2f, 0x2f,
-    0x1c, 0x1b, 0x01, 0x12, 0x0e, 0x11, 0x0a, 0x06, 0x02, 0x01, 0x0a, 0x0a,
-    0x07, 0x06, 0x08, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x1f, 0x00, 0x37, 0x00, 0x00,
-    0x13, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x33, 0x31, 0x32, 0x17, 0x17,
-    0x31, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x37, 0x06, 0x07, 0x11,
-    0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x23,
-    0x31, 0x22, 0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x00, 0x01, 0x12, 0x12,
-    0x1b, 0x84, 0x1e, 0x15, 0x2b, 0x9e, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x40, 0x0f, 0x01, 0x01,
-    0x0f, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0xa1, 0x11, 0x0c, 0x2d, 0x07,
-    0x0a, 0x84, 0x01, 0x60, 0x1b, 0x12, 0x12, 0x01, 0x15, 0x2b, 0x01, 0x12,
-    0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x10, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x00, 0x0f, 0x01, 0x0c, 0x2d, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-    0xff, 0xe0, 0x02, 0x44, 0x01, 0xa0, 0x00, 0x40, 0x00, 0x00, 0x05, 0x33,
-    0x23, 0x33, 0x36, 0x37, 0x37, 0x31, 0x36, 0x27, 0x26, 0x27, 0x21, 0x31,
-    0x06, 0x07, 0x07, 0x31, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x32, 0x17,
-    0x17, 0x31, 0x16, 0x17, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x33, 0x31,
-    0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x22, 0x27, 0x27, 0x31,
-    0x26, 0x23, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17,
-    0x16, 0x17, 0x33, 0x01, 0x80, 0x30, 0x30, 0x30, 0x12, 0x0a, 0x70, 0x08,
-    0x08, 0x0a, 0x12, 0xfe, 0x70, 0x12, 0x0a, 0x44, 0x01, 0x0f, 0x76, 0x06,
-    0x05, 0x1a, 0x21, 0x2f, 0x75, 0x0f, 0x01, 0x30, 0x01, 0x12, 0x12, 0x1b,
-    0x75, 0x1b, 0x13, 0x1a, 0x13, 0x1b, 0x75, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x18, 0x20, 0x01, 0x0f, 0xc0, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x75, 0x01, 0x05, 0x0f, 0x01, 0x05, 0x1a, 0x20, 0x01, 0x01,
-    0x0f, 0x20, 0x20, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x1a, 0x13, 0x01, 0x12,
-    0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x16, 0x00, 0x23, 0x00, 0x31,
-    0x00, 0x3f, 0x00, 0x00, 0x13, 0x16, 0x17, 0x11, 0x31, 0x16, 0x17, 0x21,
-    0x31, 0x16, 0x17, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x31, 0x36, 0x37, 0x17, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x17, 0x33, 0x23, 0x33, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x15, 0x21, 0x21, 0x21, 0x16, 0x17,
-    0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x36, 0x37, 0x18, 0x16, 0x02, 0x02,
-    0x16, 0x01, 0xa0, 0x16, 0x02, 0x02, 0x16, 0xfe, 0x60, 0x1f, 0x14, 0x14,
-    0x01, 0x02, 0x16, 0x68, 0x02, 0x16, 0xd0, 0x16, 0x02, 0x02, 0x16, 0xd0,
-    0x16, 0x02, 0x18, 0x90, 0x90, 0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16,
-    0x02, 0x02, 0x16, 0x01, 0x10, 0xfe, 0xf0, 0x01, 0x10, 0x16, 0x02, 0x02,
-    0x16, 0xfe, 0xf0, 0x16, 0x02, 0x02, 0x16, 0x01, 0xa0, 0x02, 0x16, 0xfe,
-    0xa0, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x01, 0x14, 0x14, 0x1f, 0x01,
-    0x60, 0x16, 0x02, 0x68, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16,
-    0x48, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x60, 0x02, 0x16,
-    0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc,
-    0xff, 0xc0, 0x02, 0x83, 0x01, 0xc0, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x74,
-    0x00, 0x00, 0x37, 0x36, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16,
-    0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x26, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x27, 0x16, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x16, 0x33,
-    0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x01, 0x32, 0x37, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x34, 0x27, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x16,
-    0x15, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x17, 0x26, 0x27, 0x26, 0x27, 0x26, 0x07, 0x06,
-    0x23, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x58,
-    0x0f, 0x16, 0x21, 0x01, 0x2b, 0x2b, 0x49, 0x49, 0x2b, 0x2b, 0x01, 0x01,
-    0x2b, 0x2b, 0x49, 0x14, 0x12, 0x10, 0x0e, 0x07, 0x06, 0x18, 0x1a, 0x04,
-    0x04, 0x02, 0x01, 0x58, 0x01, 0x2d, 0x02, 0x01, 0x0f, 0x15, 0x0b, 0x06,
-    0x07, 0x0f, 0x42, 0x39, 0x07, 0x07, 0x17, 0x18, 0x58, 0x3b, 0x3b, 0x02,
-    0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02, 0x01, 0xb0, 0x18, 0x17,
-    0x07, 0x07, 0x39, 0x42, 0x0f, 0x07, 0x05, 0x0a, 0x15, 0x0f, 0x01, 0x01,
-    0x01, 0x2d, 0x01, 0x02, 0x38, 0x37, 0x55, 0x06, 0x42, 0x27, 0x26, 0x01,
-    0x21, 0x16, 0x0f, 0x01, 0x02, 0x03, 0x03, 0x01, 0x01, 0x1a, 0x18, 0x06,
-    0x07, 0x0e, 0x10, 0x12, 0x14, 0x2f, 0x23, 0x23, 0x14, 0x18, 0x1a, 0x1a,
-    0x32, 0x31, 0x3e, 0x8b, 0x1e, 0x1a, 0x22, 0x2b, 0x32, 0x26, 0x26, 0x02,
-    0x02, 0x26, 0x26, 0x32, 0x32, 0x26, 0x26, 0x02, 0x04, 0x03, 0x08, 0x03,
-    0x03, 0x0b, 0x07, 0x07, 0x07, 0x03, 0x03, 0x85, 0x40, 0x2e, 0x03, 0x02,
-    0x1d, 0x18, 0x0b, 0x0e, 0x0e, 0x01, 0x03, 0x1b, 0x03, 0x03, 0x04, 0x02,
-    0x32, 0x31, 0x4b, 0x4b, 0x31, 0x32, 0x02, 0x02, 0x32, 0x31, 0x4b, 0xfe,
-    0xd0, 0x04, 0x03, 0x03, 0x1b, 0x03, 0x01, 0x0d, 0x0f, 0x0b, 0x18, 0x1c,
-    0x02, 0x01, 0x01, 0x02, 0x2e, 0x40, 0x49, 0x31, 0x31, 0x05, 0x17, 0x19,
-    0x01, 0x06, 0x25, 0x25, 0x2f, 0x2b, 0x22, 0x1a, 0x1e, 0x03, 0x03, 0x05,
-    0x05, 0x02, 0x02, 0x07, 0x0b, 0x03, 0x03, 0x08, 0x03, 0x04, 0x01, 0x11,
-    0x11, 0x1b, 0x08, 0x03, 0x2d, 0x1b, 0x1a, 0x01, 0x00, 0x02, 0x00, 0x15,
-    0xff, 0xbc, 0x01, 0x38, 0x01, 0xc2, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0x00,
-    0x01, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26,
-    0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x37, 0x36, 0x37, 0x37, 0x31, 0x37,
-    0x31, 0x36, 0x17, 0x07, 0x07, 0x37, 0x07, 0x06, 0x07, 0x07, 0x31, 0x17,
-    0x31, 0x16, 0x07, 0x07, 0x31, 0x37, 0x31, 0x11, 0x01, 0x25, 0x12, 0x01,
-    0x01, 0x0c, 0x94, 0x0d, 0x0c, 0x0c, 0x02, 0x1a, 0x6f, 0x0a, 0x04, 0x05,
-    0x0f, 0x99, 0x44, 0x09, 0x12, 0x1d, 0x1d, 0x1d, 0x1d, 0x05, 0x0d, 0x76,
-    0x56, 0x08, 0x01, 0x15, 0x5d, 0x01, 0xbf, 0x05, 0x12, 0xfe, 0x7f, 0x0e,
-    0x07, 0x4f, 0x07, 0x09, 0x09, 0x0e, 0x9c, 0x6e, 0x0a, 0x0e, 0x0e, 0x02,
-    0x17, 0x8d, 0x10, 0x03, 0x7f, 0x3b, 0x3b, 0x3b, 0x0b, 0x03, 0x11, 0x55,
-    0x09, 0x0c, 0x78, 0x32, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8,
-    0xff, 0xd8, 0x01, 0xc8, 0x01, 0xa8, 0x00, 0x30, 0x00, 0x5b, 0x00, 0x6e,
-    0x00, 0x00, 0x01, 0x22, 0x07, 0x06, 0x07, 0x06, 0x27, 0x26, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x37, 0x36,
-    0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34,
-    0x27, 0x26, 0x23, 0x35, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x14, 0x07,
-    0x06, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x27, 0x26, 0x07,
-    0x06, 0x23, 0x26, 0x27, 0x26, 0x27, 0x34, 0x37, 0x36, 0x27, 0x26, 0x37,
-    0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x37, 0x36, 0x33, 0x07, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x36, 0x17, 0x16, 0x07, 0x01, 0x70, 0x05, 0x04, 0x0e, 0x14, 0x13,
-    0x15, 0x2c, 0x2e, 0x2e, 0x27, 0x26, 0x0f, 0x0f, 0x0b, 0x05, 0x02, 0x02,
-    0x05, 0x01, 0x09, 0x09, 0x0e, 0x05, 0x04, 0x0e, 0x14, 0x13, 0x15, 0x2c,
-    0x2e, 0x2e, 0x27, 0x26, 0x0f, 0x0f, 0x0b, 0x05, 0x02, 0x02, 0x05, 0x01,
-    0x09, 0x09, 0x0e, 0x22, 0x17, 0x16, 0x01, 0x03, 0x08, 0x05, 0x0e, 0x13,
-    0x14, 0x2d, 0x2d, 0x3b, 0x3a, 0x3b, 0x18, 0x19, 0x0a, 0x0c, 0x22, 0x17,
-    0x16, 0x01, 0x03, 0x08, 0x05, 0x0e, 0x13, 0x14, 0x2d, 0x2e, 0x3a, 0x3a,
-    0x3b, 0x18, 0x19, 0x0a, 0x0c, 0x79, 0x28, 0x1e, 0x1e, 0x0c, 0x08, 0x16,
-    0x14, 0x04, 0x10, 0x26, 0x27, 0x33, 0x16, 0x08, 0x04, 0x14, 0x01, 0x70,
-    0x01, 0x05, 0x02, 0x02, 0x05, 0x0b, 0x0f, 0x0f, 0x26, 0x27, 0x2e, 0x2e,
-    0x2c, 0x15, 0x13, 0x14, 0x0e, 0x04, 0x05, 0x0e, 0x09, 0x09, 0x01, 0x05,
-    0x02, 0x02, 0x05, 0x0b, 0x0f, 0x0f, 0x26, 0x27, 0x2e, 0x2e, 0x2c, 0x15,
-    0x13, 0x14, 0x0e, 0x04, 0x05, 0x0e, 0x09, 0x09, 0x30, 0x01, 0x16, 0x17,
-    0x22, 0x0c, 0x0a, 0x19, 0x18, 0x3b, 0x3a, 0x3b, 0x2d, 0x2d, 0x14, 0x13,
-    0x0e, 0x05, 0x08, 0x03, 0x01, 0x16, 0x17, 0x22, 0x0c, 0x0a, 0x19, 0x18,
-    0x3b, 0x3a, 0x3a, 0x2e, 0x2d, 0x14, 0x13, 0x0e, 0x05, 0x08, 0x03, 0x87,
-    0x0c, 0x1e, 0x1e, 0x28, 0x14, 0x04, 0x08, 0x16, 0x33, 0x27, 0x26, 0x10,
-    0x04, 0x14, 0x16, 0x08, 0x00, 0x05, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x40,
-    0x01, 0xa0, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x32, 0x00, 0x3e, 0x00, 0x4a,
-    0x00, 0x00, 0x01, 0x16, 0x17, 0x15, 0x31, 0x21, 0x31, 0x35, 0x31, 0x36,
-    0x37, 0x21, 0x17, 0x15, 0x35, 0x15, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x21, 0x25, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31,
-    0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x21, 0x13, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x36, 0x37, 0x26, 0x27, 0x23, 0x33, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x36, 0x37, 0x26, 0x27, 0x23, 0x02, 0x00, 0x0f, 0x01, 0xfe, 0x20, 0x01,
-    0x0f, 0x01, 0xc0, 0x10, 0x01, 0x0f, 0xfe, 0x40, 0x0f, 0x01, 0x01, 0xe0,
-    0xfe, 0x30, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x40, 0x38, 0x16,
-    0x02, 0x02, 0x16, 0x30, 0x16, 0x02, 0x02, 0x16, 0x30, 0x80, 0x16, 0x02,
-    0x02, 0x16, 0x70, 0x16, 0x02, 0x02, 0x16, 0x70, 0x01, 0x70, 0x01, 0x0f,
-    0x20, 0x20, 0x0f, 0x01, 0x90, 0xc0, 0xc0, 0xc0, 0x0f, 0x01, 0x01, 0x0f,
-    0xc0, 0xc0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xfe, 0xd0,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x00, 0x05, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x50,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x15, 0x31, 0x36, 0x33, 0x21, 0x31, 0x32,
-    0x17, 0x35, 0x31, 0x26, 0x27, 0x21, 0x07, 0x15, 0x35, 0x15, 0x16, 0x17,
-    0x21, 0x31, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07,
-    0x23, 0x35, 0x15, 0x35, 0x36, 0x37, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17,
-    0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x35, 0x05, 0x36, 0x37, 0x16, 0x17, 0x06, 0x07,
-    0x26, 0x27, 0x37, 0x16, 0x17, 0x06, 0x07, 0x26, 0x27, 0x36, 0x37, 0x40,
-    0x0f, 0x01, 0x08, 0x08, 0x01, 0x80, 0x08, 0x08, 0x01, 0x0f, 0xfe, 0x80,
-    0x10, 0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0x80, 0x0f,
-    0x01, 0x30, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x18,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x78, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0x02, 0x16, 0x01, 0x70, 0x01, 0x0f, 0xa2, 0x02, 0x02,
-    0xa2, 0x0f, 0x01, 0xf0, 0x60, 0x60, 0x60, 0x0f, 0x01, 0x01, 0x0f, 0x60,
-    0x0f, 0x01, 0x01, 0x0f, 0xe0, 0xe0, 0xe0, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xe0, 0x60, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x60, 0x30, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x18,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x0d, 0x00, 0x3d, 0x00, 0x6d,
-    0x00, 0x79, 0x00, 0x85, 0x00, 0x94, 0x00, 0x00, 0x01, 0x23, 0x33, 0x23,
-    0x16, 0x15, 0x15, 0x31, 0x33, 0x33, 0x36, 0x37, 0x26, 0x27, 0x07, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x23, 0x30, 0x31, 0x30, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x26, 0x35, 0x36,
-    0x37, 0x26, 0x35, 0x34, 0x37, 0x26, 0x35, 0x35, 0x31, 0x36, 0x37, 0x16,
-    0x17, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x35, 0x27, 0x30,
-    0x31, 0x31, 0x31, 0x30, 0x31, 0x16, 0x17, 0x33, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x16, 0x15, 0x06, 0x07, 0x16,
-    0x15, 0x06, 0x07, 0x16, 0x15, 0x06, 0x07, 0x06, 0x07, 0x23, 0x23, 0x26,
-    0x27, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x13, 0x36,
-    0x37, 0x26, 0x27, 0x23, 0x23, 0x06, 0x07, 0x16, 0x17, 0x33, 0x37, 0x14,
-    0x07, 0x33, 0x33, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x15, 0x07, 0x23,
-    0x33, 0x23, 0x06, 0x07, 0x16, 0x17, 0x33, 0x33, 0x36, 0x37, 0x26, 0x27,
-    0x23, 0x01, 0xc0, 0xb2, 0xb2, 0xb2, 0x02, 0x20, 0x90, 0x0f, 0x01, 0x01,
-    0x0f, 0xe0, 0x09, 0x09, 0x0e, 0x18, 0x33, 0x22, 0x22, 0x01, 0x01, 0x16,
-    0x16, 0x24, 0x01, 0x01, 0x17, 0x08, 0x0e, 0x0e, 0x02, 0x16, 0x16, 0x02,
-    0x01, 0x0f, 0x0f, 0x01, 0x20, 0x1b, 0x15, 0xd0, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x52, 0x02, 0x02, 0x22, 0x04, 0x01, 0x17, 0x08,
-    0x01, 0x12, 0x12, 0x1b, 0x40, 0x18, 0x47, 0x30, 0x2f, 0x02, 0x02, 0x2f,
-    0x30, 0x47, 0x18, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x40, 0x10, 0x02, 0x02, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20,
-    0x18, 0x28, 0x28, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x18, 0x01, 0x40, 0x08, 0x08, 0x10, 0x01, 0x0f, 0x0f, 0x01,
-    0x10, 0x0e, 0x09, 0x09, 0x01, 0x22, 0x22, 0x33, 0x30, 0x28, 0x1e, 0x1f,
-    0x0c, 0x04, 0x05, 0x1f, 0x13, 0x0d, 0x11, 0x17, 0x11, 0x11, 0x17, 0x28,
-    0x16, 0x02, 0x02, 0x16, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x28, 0x28, 0x50,
-    0x01, 0x0f, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x08, 0x08,
-    0x28, 0x12, 0x0a, 0x0c, 0x1f, 0x13, 0x0d, 0x11, 0x1b, 0x12, 0x12, 0x01,
-    0x02, 0x2f, 0x30, 0x47, 0x30, 0x47, 0x30, 0x2f, 0x02, 0xfe, 0xb0, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0xb0, 0x08, 0x08, 0x01, 0x0f,
-    0x0f, 0x01, 0x10, 0x40, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01,
-    0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x0d,
-    0x00, 0x3d, 0x00, 0x6d, 0x00, 0x79, 0x00, 0x85, 0x00, 0x94, 0x00, 0x00,
-    0x13, 0x33, 0x23, 0x33, 0x06, 0x15, 0x15, 0x31, 0x23, 0x23, 0x26, 0x27,
-    0x36, 0x37, 0x17, 0x34, 0x37, 0x31, 0x31, 0x36, 0x33, 0x30, 0x31, 0x30,
-    0x31, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x36, 0x35, 0x26, 0x27, 0x36, 0x35, 0x34, 0x27, 0x36, 0x35, 0x35,
-    0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35,
-    0x31, 0x35, 0x37, 0x30, 0x31, 0x31, 0x31, 0x30, 0x31, 0x06, 0x07, 0x23,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31, 0x06,
-    0x15, 0x16, 0x17, 0x06, 0x15, 0x16, 0x17, 0x06, 0x15, 0x16, 0x17, 0x16,
-    0x17, 0x33, 0x33, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x23, 0x03, 0x26, 0x27, 0x36, 0x37, 0x33, 0x33, 0x16, 0x17, 0x06,
-    0x07, 0x23, 0x27, 0x14, 0x17, 0x23, 0x23, 0x26, 0x27, 0x36, 0x37, 0x33,
-    0x31, 0x15, 0x17, 0x33, 0x23, 0x33, 0x16, 0x17, 0x06, 0x07, 0x23, 0x23,
-    0x26, 0x27, 0x36, 0x37, 0x33, 0x40, 0xb2, 0xb2, 0xb2, 0x02, 0x20, 0x90,
-    0x0f, 0x01, 0x01, 0x0f, 0xe0, 0x09, 0x09, 0x0e, 0x18, 0x33, 0x22, 0x22,
-    0x01, 0x01, 0x16, 0x16, 0x24, 0x01, 0x01, 0x17, 0x08, 0x0e, 0x0e, 0x02,
-    0x16, 0x16, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x20, 0x1b, 0x15, 0xd0, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x52, 0x02, 0x02, 0x22, 0x04,
-    0x01, 0x17, 0x08, 0x01, 0x12, 0x12, 0x1b, 0x40, 0x18, 0x47, 0x30, 0x2f,
-    0x02, 0x02, 0x2f, 0x30, 0x47, 0x18, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x30,
-    0x10, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x10, 0x02, 0x02, 0x20, 0x0f, 0x01,
-    0x01, 0x0f, 0x20, 0x18, 0x28, 0x28, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x30,
-    0x10, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x01, 0x40, 0x08, 0x08, 0x10, 0x01,
-    0x0f, 0x0f, 0x01, 0x10, 0x0e, 0x09, 0x09, 0x01, 0x22, 0x22, 0x33, 0x30,
-    0x28, 0x1e, 0x1f, 0x0c, 0x04, 0x05, 0x1f, 0x13, 0x0d, 0x11, 0x17, 0x11,
-    0x11, 0x17, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x0f, 0x01, 0x01, 0x0f,
-    0x28, 0x28, 0x50, 0x01, 0x0f, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12,
-    0x01, 0x08, 0x08, 0x28, 0x12, 0x0a, 0x0c, 0x1f, 0x13, 0x0d, 0x11, 0x1b,
-    0x12, 0x12, 0x01, 0x02, 0x2f, 0x30, 0x47, 0x30, 0x47, 0x30, 0x2f, 0x02,
-    0xfe, 0xb0, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0xb0, 0x08,
-    0x08, 0x01, 0x0f, 0x0f, 0x01, 0x10, 0x40, 0x01, 0x0f, 0x0f, 0x01, 0x01,
-    0x0f, 0x0f, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x0f, 0x00, 0x3d, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b,
-    0x00, 0x9c, 0x00, 0x00, 0x13, 0x15, 0x35, 0x15, 0x36, 0x33, 0x33, 0x31,
-    0x35, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x17, 0x22, 0x07, 0x31,
-    0x31, 0x06, 0x15, 0x30, 0x31, 0x30, 0x31, 0x15, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x06, 0x23, 0x26, 0x27, 0x06,
-    0x23, 0x22, 0x27, 0x06, 0x23, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x07, 0x30, 0x31, 0x31, 0x31, 0x30,
-    0x31, 0x36, 0x37, 0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16,
-    0x17, 0x15, 0x31, 0x36, 0x33, 0x16, 0x17, 0x36, 0x33, 0x16, 0x17, 0x36,
-    0x33, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x23, 0x31, 0x26, 0x27, 0x26, 0x27, 0x35, 0x25, 0x26, 0x27, 0x06,
-    0x07, 0x15, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x27, 0x32,
-    0x17, 0x35, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x33,
-    0x17, 0x15, 0x35, 0x15, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x35, 0x31,
-    0x26, 0x27, 0x06, 0x07, 0x15, 0x40, 0x08, 0x08, 0x10, 0x01, 0x0f, 0x0f,
-    0x01, 0x10, 0x0e, 0x09, 0x09, 0x01, 0x22, 0x22, 0x33, 0x30, 0x28, 0x1e,
-    0x1f, 0x0c, 0x04, 0x05, 0x1f, 0x13, 0x0d, 0x11, 0x17, 0x11, 0x11, 0x17,
-    0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x28, 0x78,
-    0x01, 0x0f, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x08, 0x08,
-    0x28, 0x12, 0x0a, 0x0c, 0x1f, 0x13, 0x0d, 0x11, 0x1b, 0x12, 0x12, 0x01,
-    0x02, 0x2f, 0x30, 0x47, 0x30, 0x47, 0x30, 0x2f, 0x02, 0x01, 0x50, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0xb0, 0x08, 0x08, 0x01, 0x0f,
-    0x0f, 0x01, 0x10, 0x40, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01,
-    0x01, 0x80, 0xb2, 0xb2, 0xb2, 0x02, 0x20, 0x90, 0x0f, 0x01, 0x01, 0x0f,
-    0xe0, 0x09, 0x09, 0x0e, 0x18, 0x33, 0x22, 0x22, 0x01, 0x01, 0x16, 0x16,
-    0x24, 0x01, 0x01, 0x17, 0x08, 0x0e, 0x0e, 0x02, 0x16, 0x16, 0x02, 0x01,
-    0x0f, 0x0f, 0x01, 0x20, 0x1b, 0x15, 0xd0, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x52, 0x02, 0x02, 0x22, 0x04, 0x01, 0x17, 0x08, 0x01,
-    0x12, 0x12, 0x1b, 0x40, 0x18, 0x47, 0x30, 0x2f, 0x02, 0x02, 0x2f, 0x30,
-    0x47, 0x18, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01, 0x01,
-    0x0f, 0x40, 0x10, 0x02, 0x02, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x18,
-    0x28, 0x28, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01, 0x01,
-    0x0f, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x0f, 0x00, 0x3d, 0x00, 0x6f, 0x00, 0x7d, 0x00, 0x8b,
-    0x00, 0x9c, 0x00, 0x00, 0x37, 0x35, 0x15, 0x35, 0x16, 0x33, 0x33, 0x31,
-    0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x37, 0x22, 0x27, 0x31,
-    0x31, 0x26, 0x35, 0x30, 0x31, 0x30, 0x31, 0x35, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x26, 0x23, 0x06, 0x07, 0x26,
-    0x23, 0x22, 0x07, 0x26, 0x23, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x27, 0x30, 0x31, 0x31, 0x31, 0x30,
-    0x31, 0x16, 0x17, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36,
-    0x37, 0x35, 0x31, 0x16, 0x33, 0x36, 0x37, 0x16, 0x33, 0x36, 0x37, 0x16,
-    0x33, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x35, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x15, 0x05, 0x06, 0x07, 0x26,
-    0x27, 0x35, 0x31, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15, 0x07, 0x32,
-    0x37, 0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x33,
-    0x37, 0x35, 0x15, 0x35, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31,
-    0x06, 0x07, 0x26, 0x27, 0x35, 0x40, 0x08, 0x08, 0x10, 0x01, 0x0f, 0x0f,
-    0x01, 0x10, 0x0e, 0x09, 0x09, 0x01, 0x22, 0x22, 0x33, 0x30, 0x28, 0x1e,
-    0x1f, 0x0c, 0x04, 0x05, 0x1f, 0x13, 0x0d, 0x11, 0x17, 0x11, 0x11, 0x17,
-    0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x28, 0x78,
-    0x01, 0x0f, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x08, 0x08,
-    0x28, 0x12, 0x0a, 0x0c, 0x1f, 0x13, 0x0d, 0x11, 0x1b, 0x12, 0x12, 0x01,
-    0x02, 0x2f, 0x30, 0x47, 0x30, 0x47, 0x30, 0x2f, 0x02, 0x01, 0x50, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0xb0, 0x08, 0x08, 0x01, 0x0f,
-    0x0f, 0x01, 0x10, 0x40, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01,
-    0x00, 0xb2, 0xb2, 0xb2, 0x02, 0x20, 0x90, 0x0f, 0x01, 0x01, 0x0f, 0xe0,
-    0x09, 0x09, 0x0e, 0x18, 0x33, 0x22, 0x22, 0x01, 0x01, 0x16, 0x16, 0x24,
-    0x01, 0x01, 0x17, 0x08, 0x0e, 0x0e, 0x02, 0x16, 0x16, 0x02, 0x01, 0x0f,
-    0x0f, 0x01, 0x20, 0x1b, 0x15, 0xd0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x52, 0x02, 0x02, 0x22, 0x04, 0x01, 0x17, 0x08, 0x01, 0x12,
-    0x12, 0x1b, 0x40, 0x18, 0x47, 0x30, 0x2f, 0x02, 0x02, 0x2f, 0x30, 0x47,
-    0x18, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01, 0x01, 0x0f,
-    0x40, 0x10, 0x02, 0x02, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x18, 0x28,
-    0x28, 0x28, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x0f, 0x01, 0x01, 0x0f,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0,
-    0x01, 0xc0, 0x00, 0x11, 0x00, 0x2d, 0x00, 0x55, 0x00, 0x00, 0x25, 0x23,
-    0x33, 0x23, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x17, 0x31,
-    0x15, 0x31, 0x06, 0x07, 0x07, 0x33, 0x23, 0x33, 0x36, 0x37, 0x36, 0x37,
-    0x35, 0x31, 0x34, 0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x31, 0x06, 0x07,
-    0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x03, 0x06, 0x07, 0x31,
-    0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x35, 0x31, 0x23, 0x31, 0x15, 0x31, 0x06, 0x07, 0x23,
-    0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x35, 0x31, 0x23,
-    0x01, 0x80, 0xc0, 0xc0, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x8c, 0x44, 0x01,
-    0x0f, 0xc0, 0xc0, 0xc0, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x0e, 0x44, 0x0e,
-    0x14, 0x8c, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x80, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xc0, 0x1b, 0x12, 0x12, 0x01,
-    0x30, 0x01, 0x0f, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x20, 0x70, 0x01,
-    0x0f, 0x01, 0x00, 0x0f, 0x01, 0x44, 0xcc, 0x0f, 0x01, 0x30, 0x01, 0x12,
-    0x12, 0x1b, 0xcc, 0x14, 0x0e, 0x44, 0x0e, 0x01, 0x12, 0x12, 0x1b, 0xff,
-    0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x00, 0x01, 0x12, 0x12, 0x1b, 0xff,
-    0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x20, 0x20, 0x0f,
-    0x01, 0x01, 0x0f, 0x01, 0x00, 0x0f, 0x01, 0x30, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa0, 0x00, 0x3d, 0x00, 0x46, 0x00, 0x53,
-    0x00, 0x00, 0x13, 0x11, 0x11, 0x11, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37,
-    0x35, 0x31, 0x34, 0x27, 0x37, 0x31, 0x16, 0x15, 0x15, 0x31, 0x06, 0x07,
-    0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37,
-    0x36, 0x37, 0x33, 0x31, 0x32, 0x17, 0x17, 0x31, 0x07, 0x31, 0x27, 0x31,
-    0x26, 0x31, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31,
-    0x23, 0x31, 0x06, 0x07, 0x37, 0x15, 0x35, 0x15, 0x33, 0x31, 0x35, 0x31,
-    0x23, 0x17, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x27,
-    0x26, 0x27, 0x30, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x05, 0x22, 0x13,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0xf6, 0x1a, 0x13, 0x4a, 0x22, 0x4a, 0x01, 0x02, 0x16, 0xc0,
-    0x16, 0x02, 0x10, 0x0f, 0x01, 0x50, 0x90, 0x90, 0x20, 0x01, 0x1f, 0x20,
-    0x20, 0x1f, 0x01, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01, 0x60, 0xfe,
-    0xc0, 0x01, 0x40, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0xf5, 0x07, 0x05,
-    0x22, 0x13, 0x1b, 0xf5, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x4a, 0x22, 0x4a, 0x01, 0x64,
-    0x16, 0x02, 0x02, 0x16, 0x68, 0x01, 0x0f, 0x10, 0x50, 0x50, 0x50, 0x50,
-    0xf0, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x24, 0x13, 0x12, 0x12, 0x13,
-    0x24, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x00, 0x01, 0x16, 0x17, 0x11,
-    0x31, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x21,
-    0x25, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x21, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01,
-    0x01, 0x0f, 0x01, 0x40, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0xc0, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f,
-    0x01, 0x40, 0x0f, 0x01, 0x30, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-    0x01, 0x80, 0x00, 0x11, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x15, 0x31, 0x17, 0x31, 0x16, 0x33, 0x32, 0x37, 0x37, 0x31, 0x35,
-    0x31, 0x26, 0x27, 0x21, 0x07, 0x15, 0x35, 0x15, 0x16, 0x17, 0x21, 0x31,
-    0x36, 0x37, 0x35, 0x31, 0x07, 0x31, 0x06, 0x23, 0x22, 0x27, 0x27, 0x27,
-    0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17,
-    0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27,
-    0x11, 0x40, 0x0f, 0x01, 0xad, 0x10, 0x13, 0x14, 0x10, 0xac, 0x01, 0x0f,
-    0xfe, 0x80, 0x10, 0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x8e, 0x1e, 0x24,
-    0x24, 0x1e, 0x8e, 0x30, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x50, 0x01, 0x0f, 0x16, 0x8e, 0x0c, 0x0c, 0x8e, 0x16, 0x0f, 0x01,
-    0x64, 0xac, 0xac, 0xac, 0x0f, 0x01, 0x01, 0x0f, 0xac, 0x75, 0x17, 0x17,
-    0x75, 0x54, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x33,
-    0x00, 0x3c, 0x00, 0x4e, 0x00, 0x6a, 0x00, 0x00, 0x13, 0x23, 0x33, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x33, 0x31,
-    0x35, 0x31, 0x23, 0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31,
-    0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x36, 0x37, 0x33, 0x31, 0x26, 0x27,
-    0x26, 0x23, 0x23, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07,
-    0x17, 0x36, 0x37, 0x16, 0x17, 0x06, 0x07, 0x26, 0x27, 0x01, 0x23, 0x33,
-    0x23, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x17, 0x31, 0x15,
-    0x31, 0x06, 0x07, 0x07, 0x33, 0x23, 0x33, 0x36, 0x37, 0x36, 0x37, 0x35,
-    0x31, 0x34, 0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x69, 0x29, 0x29, 0x29, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x60, 0x60, 0x0f, 0x01, 0x01,
-    0x0f, 0x10, 0x09, 0x09, 0x0e, 0x48, 0x1c, 0x2c, 0x3e, 0x06, 0x10, 0x11,
-    0x17, 0x29, 0x03, 0x0f, 0x0f, 0x16, 0x16, 0x0f, 0x0f, 0x03, 0x27, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x30, 0xc0, 0xc0, 0xc0,
-    0x0f, 0x01, 0x01, 0x0f, 0x8c, 0x44, 0x01, 0x0f, 0xc0, 0xc0, 0xc0, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0x0e, 0x44, 0x0e, 0x14, 0x8c, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x90, 0x01, 0x12, 0x12, 0x1b, 0xfe,
-    0xf0, 0x1b, 0x12, 0x12, 0x01, 0x30, 0x01, 0x0f, 0x01, 0x10, 0x0f, 0x01,
-    0x0e, 0x09, 0x09, 0x1f, 0x01, 0x15, 0x0d, 0x0e, 0x15, 0x0d, 0x0e, 0x0e,
-    0x0d, 0x15, 0x08, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0xfe,
-    0x68, 0x01, 0x0f, 0x01, 0x00, 0x0f, 0x01, 0x44, 0xcc, 0x0f, 0x01, 0x30,
-    0x01, 0x12, 0x12, 0x1b, 0xcc, 0x14, 0x0e, 0x44, 0x0e, 0x01, 0x12, 0x12,
-    0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x00, 0x00, 0x03, 0x00, 0x10,
-    0xff, 0xc0, 0x01, 0x70, 0x01, 0xc0, 0x00, 0x46, 0x00, 0x59, 0x00, 0x6a,
-    0x00, 0x00, 0x25, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06,
-    0x07, 0x16, 0x17, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x17, 0x23,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x31, 0x31, 0x31, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x14, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x36,
-    0x37, 0x27, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27,
-    0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x06, 0x07, 0x11, 0x26, 0x27, 0x31,
-    0x31, 0x26, 0x27, 0x35, 0x31, 0x33, 0x31, 0x15, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x01, 0x29, 0x16, 0x01, 0x01, 0x24, 0x25, 0x36, 0x36, 0x25, 0x24,
-    0x01, 0x01, 0x16, 0x05, 0x08, 0x15, 0x12, 0x0f, 0x04, 0x31, 0x03, 0x09,
-    0x0f, 0x13, 0x08, 0x08, 0x1e, 0x01, 0x02, 0x32, 0x31, 0x4b, 0x4b, 0x31,
-    0x32, 0x02, 0x01, 0x1e, 0x08, 0x08, 0x13, 0x0f, 0x09, 0x03, 0x31, 0x04,
-    0x0f, 0x13, 0x15, 0x07, 0x05, 0x69, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x16, 0x17, 0x22, 0x0f, 0x01, 0x01, 0x0f, 0x22, 0x17,
-    0x16, 0x01, 0xa0, 0x01, 0x16, 0x17, 0x22, 0xc7, 0x20, 0x29, 0x36, 0x25,
-    0x24, 0x01, 0x01, 0x24, 0x25, 0x36, 0x29, 0x20, 0x08, 0x0a, 0x1b, 0x20,
-    0x1d, 0x1d, 0x12, 0x11, 0x1a, 0x19, 0x0b, 0x0b, 0x2b, 0x39, 0x4b, 0x31,
-    0x32, 0x02, 0x02, 0x32, 0x31, 0x4b, 0x39, 0x2b, 0x0b, 0x0a, 0x01, 0x19,
-    0x1a, 0x11, 0x12, 0x1d, 0x1d, 0x20, 0x1b, 0x0a, 0x08, 0x79, 0x01, 0x0d,
-    0x0e, 0x14, 0x0f, 0x01, 0x01, 0x0f, 0x22, 0x17, 0x16, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0xfe, 0x80, 0x01, 0x16, 0x17, 0x22, 0x10, 0x10, 0x22, 0x17,
-    0x16, 0x01, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0xff, 0xc0, 0x01, 0xc3,
-    0x01, 0xc0, 0x00, 0x2c, 0x00, 0x41, 0x00, 0x4d, 0x00, 0x00, 0x13, 0x22,
-    0x07, 0x31, 0x31, 0x06, 0x15, 0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x15,
-    0x31, 0x06, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x36, 0x27, 0x27, 0x31, 0x26, 0x27, 0x35, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x35, 0x31, 0x34, 0x27, 0x26, 0x23, 0x15, 0x16, 0x17, 0x31, 0x31,
-    0x16, 0x17, 0x15, 0x31, 0x14, 0x17, 0x21, 0x31, 0x36, 0x37, 0x35, 0x31,
-    0x36, 0x37, 0x36, 0x37, 0x13, 0x23, 0x33, 0x23, 0x14, 0x17, 0x16, 0x33,
-    0x32, 0x37, 0x36, 0x35, 0xe0, 0x0e, 0x09, 0x09, 0x38, 0x23, 0x24, 0x01,
-    0x01, 0x2b, 0x0f, 0x09, 0x06, 0x07, 0x0f, 0x01, 0x90, 0x0f, 0x07, 0x05,
-    0x08, 0x0f, 0x2b, 0x01, 0x01, 0x24, 0x23, 0x38, 0x09, 0x09, 0x0e, 0x30,
-    0x1f, 0x20, 0x01, 0x28, 0xfe, 0xd0, 0x27, 0x01, 0x01, 0x20, 0x1f, 0x30,
-    0x40, 0x40, 0x40, 0x80, 0x13, 0x13, 0x1a, 0x1a, 0x13, 0x13, 0x01, 0xc0,
-    0x09, 0x09, 0x0e, 0x13, 0x0c, 0x2b, 0x2b, 0x3b, 0x19, 0x46, 0x37, 0x13,
-    0x0c, 0x0d, 0x0d, 0x01, 0x01, 0x0d, 0x0d, 0x0c, 0x13, 0x37, 0x46, 0x19,
-    0x3b, 0x2b, 0x2b, 0x0c, 0x13, 0x0e, 0x09, 0x09, 0x60, 0x01, 0x20, 0x1f,
-    0x30, 0x19, 0x4a, 0x3d, 0x3d, 0x4a, 0x19, 0x30, 0x1f, 0x20, 0x01, 0xfe,
-    0xa0, 0x1a, 0x13, 0x13, 0x13, 0x13, 0x1a, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x80, 0x01, 0xc0, 0x04, 0x2f, 0x04, 0x52, 0x07, 0xac,
-    0x07, 0xc8, 0x07, 0xf2, 0x00, 0x00, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06,
-    0x07, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x21, 0x33, 0x31,
-    0x31, 0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x23, 0x17, 0x33,
-    0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17,
-    0x33, 0x31, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x35, 0x31, 0x35, 0x21, 0x33, 0x23,
-    0x33, 0x11, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x26, 0x27, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x31, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35,
-    0x31, 0x36, 0x37, 0x37, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x11, 0x31,
-    0x15, 0x31, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x11, 0x17, 0x15, 0x35, 0x15, 0x23,
-    0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x33, 0x31, 0x15, 0x31, 0x16,
-    0x17, 0x33, 0x31, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x35,
-    0x31, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x23, 0x31, 0x06,
-    0x07, 0xe8, 0x1f, 0x14, 0x14, 0x01, 0x58, 0x1f, 0x14, 0x14, 0x01, 0x01,
-    0x14, 0x14, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1b, 0x08, 0x68,
-    0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f, 0x58, 0x01, 0x14, 0x14,
-    0x1f, 0xb0, 0xf8, 0x58, 0x58, 0x58, 0x16, 0x02, 0x38, 0x16, 0x02, 0x02,
-    0x16, 0x38, 0x38, 0x16, 0x02, 0x02, 0x16, 0x38, 0x02, 0x16, 0x58, 0xfe,
-    0x68, 0x58, 0x58, 0x58, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x02, 0x38, 0x16,
-    0x02, 0x02, 0x16, 0x38, 0x38, 0x16, 0x02, 0x02, 0x16, 0x38, 0x02, 0x16,
-    0x88, 0x02, 0x16, 0xb0, 0x16, 0x02, 0x40, 0x01, 0x0d, 0x0e, 0x14, 0x14,
-    0x0e, 0x0d, 0x01, 0x40, 0x58, 0x18, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x01,
-    0x0f, 0x10, 0x0f, 0x01, 0x18, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x01, 0x0f,
-    0x10, 0x0f, 0x01, 0x01, 0xc0, 0x01, 0x14, 0x14, 0x1f, 0x08, 0x01, 0x14,
-    0x14, 0x1f, 0xfe, 0xe0, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f,
-    0x01, 0x20, 0x1f, 0x14, 0x14, 0x01, 0x08, 0x1f, 0x14, 0x14, 0x01, 0x80,
-    0x02, 0x16, 0x28, 0x02, 0x16, 0x16, 0x02, 0x30, 0x02, 0x16, 0x16, 0x02,
-    0x68, 0x16, 0x02, 0x80, 0xd0, 0xfe, 0xb0, 0x02, 0x16, 0x68, 0x02, 0x16,
-    0x16, 0x02, 0x30, 0x02, 0x16, 0x16, 0x02, 0x28, 0x16, 0x02, 0x38, 0x16,
-    0x02, 0x02, 0x16, 0xfe, 0xf8, 0x80, 0x40, 0x14, 0x0e, 0x0d, 0x01, 0x01,
-    0x0d, 0x0e, 0x14, 0x40, 0x01, 0x88, 0x18, 0x18, 0x18, 0x18, 0x01, 0x0f,
-    0x10, 0x0f, 0x01, 0x18, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x01, 0x0f, 0x10,
-    0x0f, 0x01, 0x18, 0x0f, 0x01, 0x01, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x4b,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x17, 0x35, 0x15, 0x35,
-    0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37,
-    0x16, 0x17, 0x15, 0x31, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31,
-    0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x40, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0xc8, 0x40, 0x16, 0x02, 0x02, 0x16, 0x40, 0x02,
-    0x16, 0x16, 0x02, 0x40, 0x16, 0x02, 0x02, 0x16, 0x40, 0x02, 0x16, 0x16,
-    0x02, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40,
-    0xf8, 0x40, 0x40, 0x40, 0x02, 0x16, 0x16, 0x02, 0x40, 0x16, 0x02, 0x02,
-    0x16, 0x40, 0x02, 0x16, 0x16, 0x02, 0x40, 0x16, 0x02, 0x02, 0x16, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26,
-    0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x01, 0xd0,
-    0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xc0, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x50, 0x00, 0x63, 0x00, 0x76,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x17, 0x16, 0x17, 0x31,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x27,
-    0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x37, 0x32, 0x17, 0x31, 0x31, 0x16,
-    0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36,
-    0x33, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe,
-    0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0xb2, 0x0b, 0x14, 0x13, 0x1c, 0x1c, 0x13, 0x14, 0x0b, 0x11, 0x11,
-    0x0f, 0x0d, 0x11, 0x1c, 0x1d, 0x28, 0x28, 0x1d, 0x1c, 0x11, 0x0d, 0x0f,
-    0x11, 0x11, 0x22, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0d, 0x09, 0x09, 0x01, 0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x0d, 0x09, 0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0xc0, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x3e, 0x0d, 0x0a, 0x0a, 0x01, 0x01, 0x0a, 0x0a, 0x0d, 0x0f, 0x0e,
-    0x10, 0x12, 0x12, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x12, 0x12, 0x10,
-    0x0e, 0x0f, 0x6e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x74,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x17, 0x06, 0x27, 0x26,
-    0x37, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x27, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x26, 0x27, 0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x01,
-    0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xaf,
-    0x0a, 0x15, 0x14, 0x06, 0x0d, 0x23, 0x22, 0x2c, 0x2c, 0x22, 0x23, 0x0e,
-    0x05, 0x14, 0x15, 0x09, 0x08, 0x15, 0x16, 0x1f, 0x1f, 0x16, 0x15, 0x07,
-    0x1f, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d,
-    0x09, 0x09, 0x01, 0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09,
-    0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x80,
-    0x14, 0x05, 0x0a, 0x15, 0x25, 0x15, 0x16, 0x16, 0x15, 0x25, 0x15, 0x0a,
-    0x05, 0x14, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0xb0, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x00, 0x25, 0x14,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16,
-    0x15, 0x03, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x07, 0x32, 0x37, 0x31, 0x31, 0x36, 0x35, 0x34,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x33, 0x37,
-    0x34, 0x27, 0x31, 0x31, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x16, 0x17,
-    0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x07, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37,
-    0x31, 0x31, 0x1b, 0x1c, 0xd0, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x50, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0x01, 0x09, 0x09, 0x0d, 0xc0, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0xb8, 0x16, 0x02, 0x02, 0x16,
-    0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x01, 0x00, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0xf0, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x20, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x78, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
-    0x01, 0x80, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x4b, 0x00, 0x5d,
-    0x00, 0x6d, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xc3,
-    0x00, 0xd3, 0x00, 0xe5, 0x00, 0x00, 0x13, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x07, 0x36,
-    0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x17, 0x33, 0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31,
-    0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x27, 0x36, 0x37, 0x33, 0x31, 0x16,
-    0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x37, 0x33,
-    0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x36, 0x37, 0x17, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x15,
-    0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x37, 0x33, 0x23, 0x33,
-    0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31,
-    0x36, 0x37, 0x17, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x06,
-    0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17,
-    0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37,
-    0x17, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23,
-    0x31, 0x26, 0x27, 0x35, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x15, 0x31,
-    0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x17, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26,
-    0x27, 0x35, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x40, 0x0f, 0x01, 0x01,
-    0x0f, 0x01, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0x40, 0x40, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xb0, 0xe0, 0xe0, 0xe0, 0x0f, 0x01,
-    0x01, 0x0f, 0xe0, 0x0f, 0x01, 0x01, 0x0f, 0x48, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x50, 0x01, 0x0f, 0xff,
-    0x00, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x0f, 0x01, 0x10, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0xc0, 0x01, 0x0f, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x48, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x60, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f,
-    0x10, 0x0f, 0x01, 0x60, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01,
-    0x0f, 0x10, 0x60, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f,
-    0x01, 0x60, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10,
-    0x60, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x60,
-    0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x60, 0x01,
-    0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x60, 0x0f, 0x01,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x60, 0x01, 0x0f, 0x10,
-    0x0f, 0x01, 0x01, 0x0f, 0x10, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x33, 0x00, 0x40, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x15, 0x31, 0x15, 0x31, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x35, 0x31, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15,
-    0x31, 0x23, 0x31, 0x35, 0x07, 0x21, 0x21, 0x21, 0x11, 0x31, 0x06, 0x07,
-    0x21, 0x31, 0x26, 0x27, 0x11, 0x98, 0x02, 0x16, 0x16, 0x02, 0x28, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x28, 0x02, 0x16, 0x16, 0x02, 0x90, 0x68,
-    0x01, 0x60, 0xfe, 0xa0, 0x01, 0x60, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01,
-    0x01, 0xa8, 0x16, 0x02, 0x02, 0x16, 0x28, 0x01, 0x12, 0x12, 0x1b, 0x10,
-    0x30, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0x00, 0x30, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x28, 0x16, 0x02, 0x02, 0x16,
-    0x28, 0x28, 0xa8, 0xff, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x48, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x37, 0x36, 0x17, 0x17, 0x31, 0x16, 0x15, 0x14, 0x07, 0x07, 0x31, 0x06,
-    0x27, 0x26, 0x35, 0x35, 0x31, 0x34, 0x37, 0x01, 0xd0, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xbc, 0x0d, 0x0c, 0x90, 0x0b,
-    0x0b, 0x90, 0x0c, 0x0d, 0x0c, 0x0c, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x6d,
-    0x06, 0x07, 0x58, 0x07, 0x0d, 0x0d, 0x08, 0x58, 0x06, 0x06, 0x07, 0x0e,
-    0xb0, 0x0e, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x37, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26,
-    0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x11, 0x17, 0x33, 0x23, 0x33, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x40, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0x98, 0x90, 0x90, 0x90, 0x16, 0x02, 0x02, 0x16,
-    0x90, 0x16, 0x02, 0x02, 0x16, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f,
-    0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0x40, 0x88, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26,
-    0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x11, 0x05, 0x07, 0x37, 0x07, 0x06, 0x27, 0x27, 0x31,
-    0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07,
-    0x40, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe,
-    0xc0, 0x40, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x51,
-    0x80, 0x80, 0x80, 0x11, 0x11, 0x40, 0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x6f,
-    0x11, 0x11, 0x0e, 0x0e, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01,
-    0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x01, 0x40, 0x71, 0x80, 0x80, 0x80, 0x0e, 0x0e, 0x40, 0x11, 0x11,
-    0x0e, 0x0e, 0x2f, 0x6f, 0x0e, 0x0e, 0x11, 0x11, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x30, 0x01, 0xc0, 0x00, 0x1e, 0x00, 0x6d, 0x00, 0x99,
-    0x00, 0x00, 0x25, 0x35, 0x15, 0x35, 0x35, 0x31, 0x26, 0x27, 0x23, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x33, 0x33,
-    0x36, 0x37, 0x35, 0x31, 0x35, 0x31, 0x17, 0x31, 0x07, 0x27, 0x33, 0x23,
-    0x33, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x32, 0x37, 0x37,
-    0x31, 0x36, 0x35, 0x34, 0x27, 0x27, 0x31, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x15, 0x15, 0x31, 0x23, 0x23, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x33, 0x33, 0x31, 0x36,
-    0x37, 0x26, 0x27, 0x31, 0x31, 0x34, 0x31, 0x30, 0x23, 0x26, 0x27, 0x30,
-    0x35, 0x26, 0x27, 0x26, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26, 0x35, 0x36,
-    0x37, 0x36, 0x37, 0x33, 0x27, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x35,
-    0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x06, 0x07, 0x21, 0x31, 0x26,
-    0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x01, 0x90, 0x01, 0x0f, 0x20, 0x3e, 0x27, 0x1d, 0x1d, 0x0c, 0x05, 0x01,
-    0x20, 0x1f, 0x30, 0x30, 0x30, 0x0f, 0x01, 0x6a, 0x6a, 0x40, 0x10, 0x10,
-    0x10, 0x09, 0x09, 0x0e, 0x04, 0x0c, 0x09, 0x8b, 0x0c, 0x0c, 0x8a, 0x0a,
-    0x0d, 0x0f, 0x0a, 0x0a, 0x10, 0x30, 0x44, 0x2d, 0x2d, 0x02, 0x01, 0x14,
-    0x14, 0x17, 0x09, 0x08, 0x06, 0x05, 0x06, 0x03, 0x03, 0x04, 0x02, 0x11,
-    0x01, 0x01, 0x0b, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
-    0x03, 0x04, 0x01, 0x12, 0x13, 0x1c, 0x0e, 0xe8, 0x1f, 0x14, 0x14, 0x01,
-    0x01, 0x14, 0x14, 0x1f, 0x01, 0x50, 0x1f, 0x14, 0x14, 0x01, 0x02, 0x16,
-    0x16, 0x02, 0x02, 0x16, 0xfe, 0xb0, 0x16, 0x02, 0x02, 0x16, 0x40, 0x16,
-    0x02, 0x02, 0x16, 0x40, 0xc1, 0x0f, 0x0f, 0x0f, 0x20, 0x0f, 0x01, 0x01,
-    0x16, 0x15, 0x24, 0x0e, 0x12, 0x30, 0x1f, 0x20, 0x01, 0x01, 0x0f, 0x20,
-    0x0f, 0x5f, 0x5f, 0x0f, 0x30, 0x0e, 0x09, 0x09, 0x08, 0x7d, 0x0b, 0x10,
-    0x10, 0x0b, 0x7c, 0x09, 0x0a, 0x0a, 0x0f, 0x2d, 0x02, 0x2d, 0x2d, 0x44,
-    0x2d, 0x1e, 0x1e, 0x10, 0x06, 0x05, 0x04, 0x03, 0x02, 0x02, 0x01, 0x02,
-    0x10, 0x0c, 0x07, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-    0x03, 0x05, 0x09, 0x0e, 0x1b, 0x13, 0x12, 0x01, 0xd0, 0x01, 0x14, 0x14,
-    0x1f, 0xfe, 0xb0, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f, 0x40,
-    0x16, 0x02, 0x02, 0x16, 0x40, 0x16, 0x02, 0x02, 0x16, 0x01, 0x50, 0x16,
-    0x02, 0x02, 0x16, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4b,
-    0x00, 0x5e, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26,
-    0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x07,
-    0x37, 0x07, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x36, 0x37, 0x37, 0x31,
-    0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x06, 0x07, 0x27, 0x34, 0x27, 0x31,
-    0x31, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x35, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x33, 0x91, 0x91, 0x91, 0x0f, 0x0a, 0x0a, 0x04,
-    0x38, 0x05, 0x0d, 0x91, 0x0f, 0x0a, 0x0a, 0x04, 0x38, 0x05, 0x0d, 0x13,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a,
-    0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x45, 0x38, 0x38, 0x38, 0x04, 0x0a, 0x0a,
-    0x0f, 0x91, 0x0d, 0x05, 0x38, 0x04, 0x0a, 0x0a, 0x0f, 0x91, 0x0d, 0x05,
-    0x45, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x25, 0x36,
-    0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x21, 0x37, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x21, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x21, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x11, 0x27, 0x22, 0x27, 0x27, 0x31, 0x26, 0x37, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x07, 0x07, 0x31, 0x06, 0x23, 0x01,
-    0x80, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x40, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xe0, 0x0a,
-    0x08, 0x68, 0x0a, 0x06, 0x07, 0x0f, 0xd0, 0x0f, 0x07, 0x06, 0x0a, 0x68,
-    0x08, 0x0a, 0x10, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe,
-    0xc0, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0,
-    0x40, 0x08, 0x70, 0x0b, 0x0f, 0x0d, 0x01, 0x01, 0x0d, 0x0f, 0x0b, 0x70,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x13, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26,
-    0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x11, 0x17, 0x32, 0x17, 0x17, 0x31, 0x16, 0x07, 0x06,
-    0x07, 0x23, 0x31, 0x26, 0x27, 0x26, 0x37, 0x37, 0x31, 0x36, 0x33, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0,
-    0x40, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0xe0, 0x0a, 0x08,
-    0x68, 0x0a, 0x06, 0x07, 0x0f, 0xd0, 0x0f, 0x07, 0x06, 0x0a, 0x68, 0x08,
-    0x0a, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40,
-    0x40, 0x08, 0x70, 0x0b, 0x0f, 0x0d, 0x01, 0x01, 0x0d, 0x0f, 0x0b, 0x70,
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x26,
-    0x27, 0x21, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x11, 0x27, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x11, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x21, 0x07, 0x14, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26,
-    0x27, 0x35, 0x31, 0x36, 0x37, 0x36, 0x17, 0x17, 0x31, 0x16, 0x15, 0x01,
-    0x90, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f,
-    0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x40, 0x08,
-    0x70, 0x0b, 0x0f, 0x0d, 0x01, 0x01, 0x0d, 0x0f, 0x0b, 0x70, 0x08, 0x01,
-    0x60, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x40, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xe0, 0x0a,
-    0x08, 0x68, 0x0a, 0x06, 0x07, 0x0f, 0xd0, 0x0f, 0x07, 0x06, 0x0a, 0x68,
-    0x08, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x15, 0x00, 0x31, 0x00, 0x00, 0x05, 0x36, 0x37, 0x11,
-    0x31, 0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x01, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x33, 0x31, 0x32, 0x17, 0x17, 0x31, 0x16, 0x15, 0x11, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x01, 0x40,
-    0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xa0, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x00, 0xfe, 0xc0, 0x01, 0x12, 0x12, 0x1b, 0xa6, 0x1a, 0x13, 0x5a, 0x13,
-    0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x10, 0x01,
-    0x0f, 0x01, 0x20, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xfe, 0x80, 0x0f,
-    0x01, 0x01, 0x90, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a, 0x13, 0x1b, 0xfe,
-    0xdb, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x15,
-    0x00, 0x31, 0x00, 0x3d, 0x00, 0x49, 0x00, 0x00, 0x17, 0x26, 0x27, 0x11,
-    0x31, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x33,
-    0x31, 0x11, 0x31, 0x06, 0x07, 0x21, 0x11, 0x06, 0x07, 0x31, 0x31, 0x06,
-    0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x11, 0x31, 0x34, 0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x13, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x15, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x40, 0x0f,
-    0x01, 0x01, 0x0f, 0xa0, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xff, 0x00,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12,
-    0x12, 0x01, 0x13, 0x5a, 0x13, 0x1a, 0xa6, 0x38, 0x16, 0x02, 0x02, 0x16,
-    0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16,
-    0x02, 0x02, 0x16, 0x90, 0x10, 0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x50,
-    0x0e, 0x09, 0x09, 0xfe, 0xe0, 0x0f, 0x01, 0x01, 0xd0, 0x01, 0x12, 0x12,
-    0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0x25, 0x1b, 0x13, 0x5a, 0x13, 0xff, 0x00, 0x02, 0x16, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0x60, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa5, 0x00, 0x6a,
-    0x00, 0x84, 0x00, 0x00, 0x01, 0x26, 0x07, 0x31, 0x31, 0x06, 0x07, 0x07,
-    0x31, 0x06, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x36,
-    0x37, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x06, 0x07, 0x06,
-    0x17, 0x16, 0x33, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x17, 0x16, 0x15, 0x06, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x15, 0x06,
-    0x07, 0x06, 0x17, 0x16, 0x15, 0x06, 0x07, 0x23, 0x31, 0x22, 0x27, 0x27,
-    0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31, 0x16, 0x33, 0x33, 0x31, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x37, 0x34, 0x27, 0x36, 0x37, 0x34, 0x27, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x36, 0x37, 0x37, 0x31, 0x36,
-    0x27, 0x26, 0x27, 0x05, 0x22, 0x07, 0x31, 0x31, 0x06, 0x15, 0x15, 0x31,
-    0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x32, 0x37, 0x36, 0x35, 0x35, 0x31,
-    0x34, 0x27, 0x26, 0x23, 0x23, 0x01, 0x44, 0x1e, 0x19, 0x19, 0x09, 0x06,
-    0x06, 0x0d, 0x34, 0x0d, 0x0f, 0x12, 0x10, 0x33, 0x15, 0x09, 0x06, 0x08,
-    0x16, 0x14, 0x04, 0x06, 0x08, 0x12, 0x08, 0x06, 0x07, 0x0e, 0x86, 0x0f,
-    0x01, 0x01, 0x09, 0x0c, 0x03, 0x03, 0x08, 0x04, 0x01, 0x0c, 0x0d, 0x05,
-    0x04, 0x08, 0x03, 0x01, 0x09, 0x13, 0x04, 0x01, 0x01, 0x0f, 0x61, 0x14,
-    0x10, 0x3e, 0x13, 0x0e, 0x0b, 0x12, 0x3d, 0x1d, 0x22, 0x61, 0x1b, 0x12,
-    0x12, 0x01, 0x17, 0x01, 0x01, 0x18, 0x01, 0x03, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x5c, 0x07, 0x05, 0x05, 0x08, 0x0e, 0x0e, 0x1d, 0xfe, 0xdc,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x40, 0x01, 0x9d, 0x08, 0x0e, 0x0e, 0x1d, 0x14, 0x14, 0x0f, 0x39,
-    0x11, 0x11, 0x0d, 0x0f, 0x38, 0x18, 0x1f, 0x14, 0x14, 0x04, 0x08, 0x16,
-    0x14, 0x1e, 0x19, 0x0c, 0x0d, 0x0d, 0x01, 0x0f, 0x0b, 0x04, 0x05, 0x0c,
-    0x0c, 0x09, 0x05, 0x06, 0x0d, 0x03, 0x03, 0x0c, 0x0d, 0x0a, 0x04, 0x06,
-    0x0b, 0x04, 0x09, 0x14, 0x02, 0x02, 0x0f, 0x01, 0x0b, 0x29, 0x0a, 0x11,
-    0x13, 0x0e, 0x29, 0x13, 0x12, 0x11, 0x1b, 0x12, 0x20, 0x07, 0x06, 0x12,
-    0x21, 0x0a, 0x09, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x10, 0x10, 0x14,
-    0x1e, 0x19, 0x19, 0x09, 0x9d, 0x09, 0x09, 0x0e, 0xe0, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0xe0, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xdb, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x6a, 0x00, 0x84, 0x00, 0x00,
-    0x05, 0x06, 0x27, 0x31, 0x31, 0x26, 0x27, 0x27, 0x31, 0x26, 0x27, 0x27,
-    0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x16, 0x17, 0x17, 0x31, 0x16,
-    0x37, 0x36, 0x27, 0x27, 0x31, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x35, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x35, 0x26, 0x27, 0x26, 0x37, 0x36,
-    0x35, 0x26, 0x27, 0x23, 0x31, 0x22, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26,
-    0x37, 0x37, 0x31, 0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x16, 0x17, 0x16,
-    0x17, 0x14, 0x07, 0x16, 0x17, 0x14, 0x07, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x23, 0x31, 0x16, 0x17, 0x17, 0x31, 0x16, 0x07, 0x06, 0x07, 0x25,
-    0x22, 0x27, 0x31, 0x31, 0x26, 0x35, 0x35, 0x31, 0x34, 0x37, 0x36, 0x33,
-    0x33, 0x31, 0x32, 0x17, 0x16, 0x15, 0x15, 0x31, 0x14, 0x07, 0x06, 0x23,
-    0x23, 0x01, 0x44, 0x1e, 0x19, 0x19, 0x09, 0x06, 0x06, 0x0d, 0x34, 0x0d,
-    0x0f, 0x12, 0x10, 0x33, 0x15, 0x09, 0x06, 0x08, 0x16, 0x14, 0x04, 0x06,
-    0x08, 0x12, 0x08, 0x06, 0x07, 0x0e, 0x86, 0x0f, 0x01, 0x01, 0x09, 0x0c,
-    0x03, 0x03, 0x08, 0x04, 0x01, 0x0c, 0x0d, 0x05, 0x04, 0x08, 0x03, 0x01,
-    0x09, 0x13, 0x04, 0x01, 0x01, 0x0f, 0x61, 0x14, 0x10, 0x3e, 0x13, 0x0e,
-    0x0b, 0x12, 0x3d, 0x1d, 0x22, 0x61, 0x1b, 0x12, 0x12, 0x01, 0x17, 0x01,
-    0x01, 0x18, 0x01, 0x03, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x5c, 0x07,
-    0x05, 0x05, 0x08, 0x0e, 0x0e, 0x1d, 0xfe, 0xdc, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x40, 0x1d, 0x08,
-    0x0e, 0x0e, 0x1d, 0x14, 0x14, 0x0f, 0x39, 0x11, 0x10, 0x0e, 0x0f, 0x39,
-    0x17, 0x1f, 0x14, 0x14, 0x04, 0x08, 0x16, 0x14, 0x1e, 0x19, 0x0c, 0x0d,
-    0x0c, 0x01, 0x01, 0x0f, 0x0b, 0x04, 0x05, 0x0c, 0x0c, 0x09, 0x05, 0x06,
-    0x0d, 0x03, 0x03, 0x0c, 0x0d, 0x0a, 0x04, 0x06, 0x0b, 0x04, 0x09, 0x14,
-    0x02, 0x02, 0x0f, 0x01, 0x0b, 0x29, 0x0a, 0x11, 0x13, 0x0e, 0x29, 0x13,
-    0x12, 0x11, 0x1b, 0x12, 0x20, 0x07, 0x06, 0x12, 0x21, 0x0a, 0x09, 0x12,
-    0x1b, 0x1b, 0x12, 0x12, 0x01, 0x10, 0x10, 0x14, 0x1e, 0x19, 0x19, 0x09,
-    0x5d, 0x09, 0x09, 0x0e, 0xe0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0xe0,
-    0x0e, 0x09, 0x09, 0x00, 0x00, 0x04, 0xff, 0xfd, 0xff, 0xbd, 0x02, 0x03,
-    0x01, 0xc3, 0x00, 0x3f, 0x00, 0x71, 0x00, 0x8c, 0x00, 0x99, 0x00, 0x00,
-    0x01, 0x26, 0x27, 0x26, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x07, 0x06,
-    0x07, 0x07, 0x31, 0x07, 0x31, 0x06, 0x07, 0x06, 0x17, 0x17, 0x31, 0x07,
-    0x31, 0x06, 0x17, 0x16, 0x17, 0x17, 0x31, 0x17, 0x31, 0x16, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x37, 0x37, 0x31, 0x37,
-    0x31, 0x36, 0x37, 0x36, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26,
-    0x27, 0x27, 0x31, 0x27, 0x07, 0x37, 0x07, 0x37, 0x17, 0x31, 0x16, 0x17,
-    0x17, 0x31, 0x07, 0x31, 0x06, 0x17, 0x17, 0x31, 0x07, 0x31, 0x06, 0x07,
-    0x07, 0x31, 0x27, 0x31, 0x26, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x27,
-    0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x37,
-    0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x03, 0x32, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x27, 0x36, 0x37,
-    0x36, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x27, 0x26, 0x27, 0x01, 0x78,
-    0x03, 0x0c, 0x0c, 0x0a, 0x53, 0x52, 0x0b, 0x0c, 0x0c, 0x03, 0x12, 0x62,
-    0x0d, 0x05, 0x05, 0x07, 0x39, 0x39, 0x07, 0x05, 0x05, 0x0d, 0x62, 0x12,
-    0x03, 0x0c, 0x0c, 0x0a, 0x53, 0x53, 0x0a, 0x0c, 0x0c, 0x03, 0x12, 0x62,
-    0x0d, 0x05, 0x05, 0x07, 0x39, 0x39, 0x07, 0x05, 0x05, 0x0d, 0x62, 0x12,
-    0x6a, 0x41, 0x41, 0x41, 0x0f, 0x03, 0x10, 0x4e, 0x2d, 0x09, 0x09, 0x2d,
-    0x4e, 0x10, 0x03, 0x0f, 0x41, 0x0e, 0x0e, 0x41, 0x0f, 0x03, 0x10, 0x4e,
-    0x2d, 0x09, 0x09, 0x2d, 0x4e, 0x10, 0x03, 0x0f, 0x41, 0x0e, 0x0e, 0x0e,
-    0x1e, 0x1a, 0x1a, 0x0f, 0x0f, 0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a,
-    0x1a, 0x0f, 0x0f, 0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x40, 0x01, 0x1f, 0x20,
-    0x20, 0x1f, 0x01, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01, 0xac, 0x0d,
-    0x05, 0x05, 0x07, 0x39, 0x39, 0x07, 0x05, 0x05, 0x0d, 0x62, 0x12, 0x03,
-    0x0c, 0x0c, 0x0b, 0x52, 0x53, 0x0a, 0x0c, 0x0c, 0x03, 0x12, 0x62, 0x0d,
-    0x05, 0x05, 0x07, 0x39, 0x39, 0x07, 0x05, 0x05, 0x0d, 0x62, 0x12, 0x03,
-    0x0c, 0x0c, 0x0a, 0x53, 0x52, 0x0b, 0x0c, 0x0c, 0x03, 0x12, 0x62, 0x5a,
-    0x2d, 0x2d, 0x2d, 0x4e, 0x10, 0x03, 0x0f, 0x41, 0x0e, 0x0e, 0x41, 0x0f,
-    0x03, 0x10, 0x4e, 0x2d, 0x09, 0x09, 0x2d, 0x4e, 0x10, 0x03, 0x0f, 0x41,
-    0x0e, 0x0e, 0x41, 0x0f, 0x03, 0x10, 0x4e, 0x2d, 0x09, 0x09, 0xfe, 0xfe,
-    0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a, 0x0f, 0x0f, 0x0f, 0x0f,
-    0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a, 0x0f, 0x0f, 0x70, 0x24, 0x13, 0x12,
-    0x12, 0x13, 0x24, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x00, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x01, 0x83, 0x01, 0xa0, 0x00, 0x10,
-    0x00, 0x53, 0x00, 0x00, 0x13, 0x06, 0x15, 0x16, 0x17, 0x16, 0x17, 0x06,
-    0x23, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x37, 0x06, 0x07,
-    0x31, 0x31, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37,
-    0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x27, 0x26, 0x07,
-    0x22, 0x07, 0x06, 0x23, 0x22, 0x23, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27,
-    0x34, 0x37, 0x36, 0x37, 0x36, 0x37, 0x30, 0x33, 0x36, 0x37, 0x36, 0x37,
-    0x36, 0x27, 0x26, 0x27, 0x26, 0x23, 0x22, 0x23, 0x30, 0x31, 0x22, 0x23,
-    0x30, 0x31, 0x06, 0x23, 0x91, 0x21, 0x01, 0x29, 0x29, 0x43, 0x13, 0x14,
-    0x4a, 0x32, 0x31, 0x02, 0x01, 0x1a, 0x1a, 0x2c, 0x3e, 0x59, 0x3a, 0x3a,
-    0x02, 0x01, 0x1e, 0x1d, 0x33, 0x32, 0x3f, 0x48, 0x38, 0x02, 0x01, 0x01,
-    0x01, 0x08, 0x06, 0x04, 0x04, 0x08, 0x05, 0x05, 0x0c, 0x05, 0x06, 0x07,
-    0x08, 0x02, 0x02, 0x4b, 0x31, 0x31, 0x02, 0x11, 0x11, 0x1e, 0x01, 0x01,
-    0x01, 0x06, 0x06, 0x05, 0x05, 0x0a, 0x02, 0x03, 0x0c, 0x05, 0x05, 0x04,
-    0x04, 0x05, 0x05, 0x04, 0x03, 0x01, 0x5d, 0x34, 0x41, 0x4b, 0x38, 0x39,
-    0x18, 0x04, 0x02, 0x32, 0x31, 0x4b, 0x34, 0x2a, 0x29, 0x16, 0x42, 0x08,
-    0x3e, 0x3e, 0x5b, 0x3f, 0x32, 0x33, 0x1d, 0x1e, 0x01, 0x01, 0x28, 0x01,
-    0x01, 0x01, 0x01, 0x05, 0x06, 0x04, 0x03, 0x09, 0x0a, 0x0a, 0x02, 0x01,
-    0x01, 0x02, 0x32, 0x31, 0x4b, 0x29, 0x23, 0x23, 0x19, 0x01, 0x01, 0x05,
-    0x04, 0x04, 0x02, 0x06, 0x0c, 0x0a, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa0, 0x00, 0x0f,
-    0x00, 0x29, 0x00, 0x3c, 0x00, 0x00, 0x37, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07, 0x11, 0x17, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x21,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21,
-    0x37, 0x34, 0x37, 0x37, 0x31, 0x36, 0x17, 0x16, 0x17, 0x15, 0x31, 0x06,
-    0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x35, 0x30, 0x01, 0x0f, 0x01, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x40, 0x08, 0x70, 0x0b, 0x0f, 0x0d, 0x01,
-    0x01, 0x0d, 0x0f, 0x0b, 0x70, 0x08, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x40, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xc0, 0x40, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0xe0, 0x0a, 0x08, 0x68, 0x0a, 0x06, 0x07, 0x0f,
-    0xd0, 0x0f, 0x07, 0x06, 0x0a, 0x68, 0x08, 0x0a, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x50,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x25, 0x32, 0x17, 0x31,
-    0x31, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x01,
-    0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x00, 0x1a, 0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x0d, 0x16, 0x16, 0x1a, 0x1a,
-    0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x0d, 0x16, 0x16, 0x1a, 0xc0, 0x39, 0x2f,
-    0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x60, 0x0d, 0x0d, 0x16, 0x17, 0x19, 0x19, 0x17, 0x16, 0x0d,
-    0x0d, 0x0d, 0x0d, 0x16, 0x17, 0x19, 0x19, 0x17, 0x16, 0x0d, 0x0d, 0x00,
-    0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x1d,
-    0x00, 0x37, 0x00, 0x47, 0x00, 0x59, 0x00, 0x69, 0x00, 0x7b, 0x00, 0x00,
-    0x13, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x33, 0x31, 0x35, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x33, 0x31, 0x36,
-    0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x17, 0x36, 0x37, 0x33,
-    0x31, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35,
-    0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31,
-    0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x07, 0x36, 0x37, 0x33, 0x31, 0x16,
-    0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x37, 0x33,
-    0x23, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x36, 0x37, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x50, 0x01, 0x0d,
-    0x0e, 0x14, 0x14, 0x0e, 0x0d, 0x01, 0x50, 0x0f, 0x01, 0x01, 0x0f, 0xff,
-    0x00, 0x40, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x58, 0x01,
-    0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x90, 0x30, 0x30,
-    0x30, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f, 0x90, 0x01,
-    0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x90, 0x30, 0x30,
-    0x30, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x90,
-    0x01, 0x0f, 0xfe, 0x80, 0x0f, 0x01, 0x40, 0x14, 0x0e, 0x0d, 0x01, 0x01,
-    0x0d, 0x0e, 0x14, 0x40, 0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x10, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x28, 0x0f, 0x01, 0x01, 0x0f,
-    0x30, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x10, 0x01, 0x0f, 0x30, 0x0f, 0x01,
-    0x01, 0x0f, 0x30, 0x0f, 0x01, 0x90, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x0f,
-    0x01, 0x01, 0x0f, 0x30, 0x10, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f,
-    0x30, 0x0f, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xf0,
-    0x01, 0xc0, 0x00, 0x2f, 0x00, 0x49, 0x00, 0x53, 0x00, 0x69, 0x00, 0x75,
-    0x00, 0x93, 0x00, 0x00, 0x17, 0x33, 0x23, 0x33, 0x15, 0x31, 0x23, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31,
-    0x32, 0x17, 0x17, 0x31, 0x16, 0x15, 0x15, 0x31, 0x23, 0x31, 0x35, 0x31,
-    0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x23, 0x31, 0x06, 0x07,
-    0x11, 0x31, 0x16, 0x17, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27,
-    0x35, 0x31, 0x35, 0x31, 0x36, 0x37, 0x17, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x31, 0x15, 0x31, 0x33, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x16, 0x17,
-    0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31,
-    0x36, 0x37, 0x17, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x23, 0x31, 0x15,
-    0x31, 0x33, 0x37, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23,
-    0x31, 0x15, 0x31, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x15,
-    0x31, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x35, 0x40, 0x30, 0x30, 0x30,
-    0x30, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xa6, 0x1a, 0x13,
-    0x5a, 0x13, 0x30, 0x50, 0x0e, 0x09, 0x09, 0xa0, 0x0f, 0x01, 0x01, 0x0f,
-    0x70, 0x20, 0x20, 0x20, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x18,
-    0x10, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x16, 0x02, 0x02, 0x16,
-    0x10, 0x10, 0x60, 0x20, 0x20, 0x20, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d,
-    0x0e, 0x14, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x0f, 0x01, 0x01, 0x0f,
-    0x10, 0x10, 0x50, 0x01, 0x0f, 0x30, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x20,
-    0x0f, 0x01, 0x01, 0x0f, 0x20, 0x01, 0x0f, 0x0f, 0x01, 0x10, 0x30, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a, 0x13,
-    0x1b, 0x95, 0x90, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xfe, 0x80, 0x0f,
-    0x01, 0x70, 0x01, 0x0f, 0x10, 0x18, 0x18, 0x10, 0x0f, 0x01, 0x20, 0x0f,
-    0x01, 0x01, 0x0f, 0x30, 0x50, 0x0f, 0x01, 0x50, 0x02, 0x16, 0x16, 0x02,
-    0x30, 0x50, 0x01, 0x0d, 0x0e, 0x14, 0x40, 0x14, 0x0e, 0x0d, 0x01, 0x01,
-    0x0f, 0x80, 0x0f, 0x01, 0x80, 0x01, 0x0f, 0x40, 0x0f, 0x01, 0x60, 0x70,
-    0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x20, 0x01, 0x0f, 0x0f, 0x01, 0x30,
-    0x0f, 0x01, 0x01, 0x0f, 0x40, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x17, 0x00, 0x33, 0x00, 0x57,
-    0x00, 0x00, 0x37, 0x11, 0x11, 0x11, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31,
-    0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06, 0x07, 0x21, 0x31,
-    0x26, 0x27, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34,
-    0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x17, 0x26, 0x07, 0x06, 0x17, 0x17,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x17, 0x36,
-    0x37, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26,
-    0x27, 0x06, 0x07, 0x07, 0x31, 0x27, 0x30, 0x01, 0x0f, 0xa0, 0x09, 0x09,
-    0x0e, 0x50, 0x01, 0x0f, 0xff, 0x00, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x13,
-    0x5a, 0x13, 0x1a, 0xa6, 0x37, 0x08, 0x16, 0x14, 0x04, 0x30, 0x06, 0x11,
-    0x11, 0x06, 0x19, 0x19, 0x06, 0x11, 0x11, 0x06, 0x30, 0x04, 0x14, 0x16,
-    0x08, 0x19, 0x19, 0x06, 0x11, 0x11, 0x06, 0x19, 0x19, 0x00, 0x01, 0x80,
-    0xfe, 0x80, 0x01, 0x80, 0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xfe, 0xe0,
-    0x0f, 0x01, 0x01, 0x0f, 0x01, 0xc0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x25, 0x1b, 0x13,
-    0x5a, 0x13, 0xf1, 0x14, 0x04, 0x08, 0x16, 0xa0, 0x10, 0x01, 0x01, 0x10,
-    0x53, 0x53, 0x10, 0x01, 0x01, 0x10, 0xa0, 0x16, 0x08, 0x04, 0x14, 0x54,
-    0x54, 0x10, 0x01, 0x01, 0x10, 0x54, 0x54, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x17, 0x00, 0x33, 0x00, 0x53,
-    0x00, 0x00, 0x37, 0x11, 0x11, 0x11, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31,
-    0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06, 0x07, 0x21, 0x31,
-    0x26, 0x27, 0x13, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34,
-    0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x17, 0x26, 0x07, 0x06, 0x17, 0x17,
-    0x31, 0x07, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x17, 0x31, 0x16,
-    0x37, 0x36, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07,
-    0x31, 0x27, 0x30, 0x01, 0x0f, 0xa0, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f,
-    0xff, 0x00, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a, 0x13, 0x1a, 0xa6,
-    0x5b, 0x0f, 0x13, 0x10, 0x0c, 0x2d, 0x2d, 0x0c, 0x10, 0x13, 0x0f, 0x25,
-    0x25, 0x0f, 0x13, 0x10, 0x0c, 0x2d, 0x2d, 0x0c, 0x10, 0x13, 0x0f, 0x25,
-    0x25, 0x00, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x80, 0x0f, 0x01, 0x50, 0x0e,
-    0x09, 0x09, 0xfe, 0xe0, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0xc0, 0x01, 0x12,
-    0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x25, 0x1b, 0x13, 0x5a, 0x13, 0xe9, 0x10, 0x0c, 0x0f, 0x13, 0x39,
-    0x39, 0x13, 0x0f, 0x0c, 0x10, 0x30, 0x30, 0x10, 0x0c, 0x0f, 0x13, 0x39,
-    0x39, 0x13, 0x0f, 0x0c, 0x10, 0x30, 0x30, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x15, 0x00, 0x31, 0x00, 0x49,
-    0x00, 0x59, 0x00, 0x00, 0x17, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06,
-    0x07, 0x21, 0x11, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34,
-    0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x17, 0x06, 0x07, 0x15, 0x31, 0x15,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x17, 0x23, 0x33, 0x23, 0x35, 0x31,
-    0x33, 0x31, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x40, 0x0f,
-    0x01, 0x01, 0x0f, 0xa0, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xff, 0x00,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12,
-    0x12, 0x01, 0x13, 0x5a, 0x13, 0x1a, 0xa6, 0x48, 0x16, 0x02, 0x02, 0x16,
-    0x16, 0x02, 0x2c, 0x20, 0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x20, 0x44,
-    0x44, 0x2c, 0x2c, 0x2c, 0x2c, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x0c, 0x10,
-    0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xfe, 0xe0,
-    0x0f, 0x01, 0x01, 0xd0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x25, 0x1b, 0x13, 0x5a, 0x13,
-    0xd0, 0x02, 0x16, 0x68, 0x38, 0x16, 0x02, 0x02, 0x16, 0x20, 0x01, 0x15,
-    0x16, 0x20, 0x20, 0x16, 0x15, 0x01, 0x68, 0x38, 0x08, 0x08, 0x0c, 0x0c,
-    0x08, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x15, 0x00, 0x31, 0x00, 0x44, 0x00, 0x5e, 0x00, 0x00,
-    0x17, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31, 0x14,
-    0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06, 0x07, 0x21, 0x11, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34, 0x27, 0x27, 0x31, 0x26,
-    0x23, 0x23, 0x13, 0x34, 0x27, 0x31, 0x31, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x17, 0x26, 0x23,
-    0x22, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31,
-    0x06, 0x17, 0x16, 0x33, 0x33, 0x33, 0x32, 0x37, 0x36, 0x27, 0x27, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0xa0, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xff,
-    0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b,
-    0x12, 0x12, 0x01, 0x13, 0x5a, 0x13, 0x1a, 0xa6, 0x60, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x45, 0x05, 0x08,
-    0x08, 0x05, 0x29, 0x0c, 0x05, 0x09, 0x09, 0x05, 0x28, 0x04, 0x04, 0x05,
-    0x09, 0x30, 0x90, 0x09, 0x05, 0x04, 0x05, 0x48, 0x10, 0x01, 0x0f, 0x01,
-    0x80, 0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xfe, 0xe0, 0x0f, 0x01, 0x01,
-    0xd0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x25, 0x1b, 0x13, 0x5a, 0x13, 0xff, 0x00, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x2f,
-    0x07, 0x07, 0x3c, 0x13, 0x08, 0x08, 0x40, 0x07, 0x09, 0x08, 0x09, 0x08,
-    0x08, 0x68, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80,
-    0x01, 0xc0, 0x00, 0x1d, 0x00, 0x39, 0x00, 0x46, 0x00, 0x53, 0x00, 0x6b,
-    0x00, 0x79, 0x00, 0x00, 0x17, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31, 0x14,
-    0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06, 0x07, 0x21, 0x11, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34, 0x27, 0x27, 0x31, 0x26,
-    0x23, 0x23, 0x17, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x31, 0x06, 0x07, 0x15, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27,
-    0x23, 0x31, 0x06, 0x07, 0x07, 0x07, 0x37, 0x07, 0x06, 0x15, 0x16, 0x17,
-    0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x34, 0x27, 0x27, 0x31, 0x26, 0x27,
-    0x23, 0x31, 0x06, 0x07, 0x17, 0x33, 0x23, 0x33, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x30,
-    0x01, 0x0f, 0x20, 0x0f, 0x01, 0x30, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f,
-    0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00,
-    0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a, 0x13, 0x1a, 0xa6, 0x30, 0x01, 0x0f,
-    0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x0f,
-    0x01, 0x01, 0x0f, 0x20, 0x0f, 0x01, 0x06, 0x18, 0x18, 0x18, 0x02, 0x01,
-    0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x02, 0x18, 0x07, 0x17, 0x0f,
-    0x18, 0x07, 0x16, 0x20, 0x20, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x0f, 0x01,
-    0x01, 0x0f, 0x50, 0x0e, 0x09, 0x09, 0xfe, 0xe0, 0x0f, 0x01, 0x01, 0xd0,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0x25, 0x1b, 0x13, 0x5a, 0x13, 0x70, 0x0f, 0x01, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01,
-    0x01, 0x0f, 0x48, 0x58, 0x58, 0x58, 0x08, 0x08, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x08, 0x08, 0x58, 0x17, 0x01, 0x01, 0x17, 0x58,
-    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x17, 0x00, 0x33, 0x00, 0x4d,
-    0x00, 0x5e, 0x00, 0x00, 0x17, 0x21, 0x21, 0x21, 0x36, 0x37, 0x11, 0x31,
-    0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x23, 0x31, 0x06, 0x07,
-    0x11, 0x31, 0x16, 0x17, 0x03, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x32, 0x17, 0x17, 0x31, 0x16, 0x15, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x17, 0x15, 0x35, 0x15,
-    0x14, 0x07, 0x06, 0x27, 0x27, 0x31, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31,
-    0x36, 0x37, 0x33, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x17, 0x37, 0x16,
-    0x15, 0x14, 0x07, 0x06, 0x27, 0x26, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26,
-    0x37, 0x36, 0x17, 0x40, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x0f, 0x01,
-    0x50, 0x0e, 0x09, 0x09, 0xa0, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x12,
-    0x12, 0x1b, 0xa6, 0x1a, 0x13, 0x5a, 0x13, 0x01, 0x12, 0x12, 0x1b, 0xff,
-    0x00, 0x1b, 0x12, 0x12, 0x01, 0xc0, 0x0a, 0x0a, 0x07, 0x24, 0x11, 0x0f,
-    0x01, 0x01, 0x0f, 0x11, 0x24, 0x07, 0x0a, 0x09, 0x01, 0x56, 0x12, 0x12,
-    0x0d, 0x14, 0x12, 0x09, 0x0c, 0x0c, 0x09, 0x12, 0x14, 0x0d, 0x10, 0x01,
-    0x0f, 0x01, 0x20, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xfe, 0x80, 0x0f,
-    0x01, 0x01, 0x90, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a, 0x13, 0x1b, 0xfe,
-    0xdb, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0xd0,
-    0x80, 0x80, 0x80, 0x0a, 0x05, 0x03, 0x07, 0x23, 0x01, 0x0f, 0x30, 0x0f,
-    0x01, 0x23, 0x07, 0x03, 0x05, 0x0a, 0x04, 0x1e, 0x26, 0x26, 0x1e, 0x12,
-    0x09, 0x0d, 0x14, 0x14, 0x18, 0x18, 0x14, 0x14, 0x0d, 0x09, 0x12, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x15,
-    0x00, 0x31, 0x00, 0x5b, 0x00, 0x00, 0x05, 0x36, 0x37, 0x11, 0x31, 0x23,
-    0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x23, 0x31, 0x06, 0x07, 0x11,
-    0x31, 0x16, 0x17, 0x21, 0x01, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x32, 0x17, 0x17, 0x31, 0x16, 0x15, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x17, 0x34, 0x37, 0x31,
-    0x31, 0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x16, 0x15, 0x15, 0x31, 0x37,
-    0x31, 0x36, 0x33, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x22, 0x27, 0x27,
-    0x31, 0x15, 0x31, 0x14, 0x07, 0x06, 0x23, 0x23, 0x31, 0x22, 0x27, 0x26,
-    0x35, 0x35, 0x01, 0x40, 0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xa0, 0x0f,
-    0x01, 0x01, 0x0f, 0x01, 0x00, 0xfe, 0xc0, 0x01, 0x12, 0x12, 0x1b, 0xa6,
-    0x1a, 0x13, 0x5a, 0x13, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12,
-    0x12, 0x01, 0x50, 0x09, 0x09, 0x0e, 0x60, 0x0e, 0x09, 0x09, 0x2d, 0x03,
-    0x04, 0x0b, 0x01, 0x01, 0x0b, 0x04, 0x03, 0x2d, 0x09, 0x09, 0x0e, 0x60,
-    0x0e, 0x09, 0x09, 0x10, 0x01, 0x0f, 0x01, 0x20, 0x09, 0x09, 0x0e, 0x50,
-    0x01, 0x0f, 0xfe, 0x80, 0x0f, 0x01, 0x01, 0x90, 0x1b, 0x12, 0x12, 0x01,
-    0x13, 0x5a, 0x13, 0x1b, 0xfe, 0xdb, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0x80, 0xe0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x10,
-    0x1e, 0x02, 0x01, 0x0b, 0x68, 0x0b, 0x01, 0x02, 0x1e, 0x10, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x60, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x15, 0x00, 0x31, 0x00, 0x43,
-    0x00, 0x55, 0x00, 0x00, 0x17, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x33,
-    0x31, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x11, 0x31, 0x06,
-    0x07, 0x21, 0x11, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x34,
-    0x27, 0x27, 0x31, 0x26, 0x23, 0x23, 0x13, 0x36, 0x27, 0x26, 0x07, 0x07,
-    0x31, 0x06, 0x17, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27, 0x31, 0x37,
-    0x37, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31, 0x07, 0x31, 0x06, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x36, 0x27, 0x27, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0xa0,
-    0x09, 0x09, 0x0e, 0x50, 0x01, 0x0f, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x13, 0x5a,
-    0x13, 0x1a, 0xa6, 0x61, 0x0e, 0x0e, 0x11, 0x11, 0x30, 0x0e, 0x0e, 0x30,
-    0x11, 0x11, 0x0e, 0x0e, 0x1f, 0x1f, 0x60, 0x11, 0x11, 0x0e, 0x0e, 0x1f,
-    0x1f, 0x0e, 0x0e, 0x11, 0x11, 0x30, 0x0e, 0x0e, 0x30, 0x10, 0x01, 0x0f,
-    0x01, 0x80, 0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xfe, 0xe0, 0x0f, 0x01,
-    0x01, 0xd0, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x01, 0x25, 0x1b, 0x13, 0x5a, 0x13, 0xfe, 0xdf,
-    0x11, 0x11, 0x0e, 0x0e, 0x30, 0x11, 0x11, 0x30, 0x0e, 0x0e, 0x11, 0x11,
-    0x1f, 0x1f, 0x22, 0x0e, 0x0e, 0x11, 0x11, 0x1f, 0x1f, 0x11, 0x11, 0x0e,
-    0x0e, 0x30, 0x11, 0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x0b, 0x00, 0x3b, 0x00, 0x49,
-    0x00, 0x57, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x25, 0x06, 0x07, 0x26,
-    0x27, 0x37, 0x31, 0x16, 0x33, 0x32, 0x37, 0x17, 0x33, 0x36, 0x37, 0x26,
-    0x27, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x26, 0x27, 0x06,
-    0x07, 0x27, 0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31, 0x06, 0x07, 0x16,
-    0x17, 0x07, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x16, 0x17, 0x36,
-    0x37, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27, 0x27, 0x27, 0x17, 0x27,
-    0x36, 0x35, 0x34, 0x27, 0x37, 0x31, 0x16, 0x17, 0x06, 0x07, 0x03, 0x07,
-    0x37, 0x07, 0x26, 0x23, 0x22, 0x07, 0x27, 0x31, 0x36, 0x37, 0x16, 0x17,
-    0x07, 0x07, 0x37, 0x07, 0x26, 0x27, 0x36, 0x37, 0x17, 0x31, 0x06, 0x15,
-    0x14, 0x17, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x27, 0x26, 0x27, 0x01, 0x81, 0x36, 0x4b, 0x4b, 0x36, 0x50, 0x16, 0x1b,
-    0x1b, 0x16, 0x50, 0x44, 0x39, 0x02, 0x02, 0x39, 0x0c, 0x0e, 0x0e, 0x11,
-    0x11, 0x0c, 0x44, 0x5f, 0x5f, 0x44, 0x0c, 0x11, 0x11, 0x0e, 0x0e, 0x0c,
-    0x39, 0x02, 0x02, 0x39, 0x0c, 0x0e, 0x0e, 0x11, 0x11, 0x0c, 0x44, 0x5f,
-    0x5f, 0x44, 0x0c, 0x11, 0x11, 0x0e, 0x0e, 0x0c, 0x22, 0x50, 0x50, 0x50,
-    0x0d, 0x0d, 0x50, 0x2c, 0x01, 0x01, 0x2c, 0x22, 0x50, 0x50, 0x50, 0x16,
-    0x1b, 0x1b, 0x16, 0x50, 0x36, 0x4b, 0x4b, 0x36, 0xd4, 0x50, 0x50, 0x50,
-    0x2c, 0x01, 0x01, 0x2c, 0x50, 0x0d, 0x0d, 0x23, 0x01, 0x17, 0x18, 0x18,
-    0x17, 0x01, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x1d, 0x2c, 0x01, 0x01,
-    0x2c, 0x50, 0x0d, 0x0d, 0x50, 0x44, 0x5f, 0x5f, 0x44, 0x0c, 0x11, 0x11,
-    0x0e, 0x0e, 0x0c, 0x39, 0x02, 0x02, 0x39, 0x0c, 0x0e, 0x0e, 0x11, 0x11,
-    0x0c, 0x44, 0x5f, 0x5f, 0x44, 0x0c, 0x11, 0x11, 0x0e, 0x0e, 0x0c, 0x39,
-    0x02, 0x02, 0x39, 0x0c, 0x0e, 0x0e, 0x11, 0x11, 0x0c, 0x22, 0x50, 0x50,
-    0x50, 0x16, 0x1b, 0x1b, 0x16, 0x50, 0x36, 0x4b, 0x4b, 0x36, 0x01, 0x24,
-    0x50, 0x50, 0x50, 0x0d, 0x0d, 0x50, 0x2c, 0x01, 0x01, 0x2c, 0xd4, 0x50,
-    0x50, 0x50, 0x36, 0x4b, 0x4b, 0x36, 0x50, 0x16, 0x1b, 0x1b, 0x16, 0x31,
-    0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b,
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x02, 0x02, 0x01, 0xc5, 0x00, 0x1f,
-    0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x37, 0x06, 0x17, 0x31, 0x31, 0x16,
-    0x17, 0x17, 0x31, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x37,
-    0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x37, 0x13, 0x31, 0x36, 0x27, 0x26,
-    0x07, 0x01, 0x17, 0x25, 0x05, 0x25, 0x07, 0x31, 0x17, 0x31, 0x27, 0x05,
-    0x27, 0x17, 0x27, 0x37, 0x31, 0x03, 0x10, 0x11, 0x01, 0x02, 0x12, 0x8c,
-    0x0a, 0x09, 0x0e, 0x0f, 0x0a, 0x3e, 0x7c, 0x0f, 0x0d, 0x0d, 0x03, 0x40,
-    0x02, 0x10, 0x10, 0x12, 0xfe, 0x40, 0x34, 0x01, 0x56, 0xfe, 0xaa, 0x01,
-    0x56, 0xdc, 0x01, 0x7b, 0x01, 0x4f, 0xa6, 0xa6, 0xa6, 0xd6, 0x30, 0xbc,
-    0x0b, 0x13, 0x13, 0x09, 0x3a, 0x67, 0x0e, 0x09, 0x0a, 0x0c, 0x4a, 0x34,
-    0x05, 0x07, 0x08, 0x0f, 0x01, 0xa0, 0x14, 0x0b, 0x0b, 0x09, 0xff, 0x00,
-    0x1a, 0xc3, 0xc3, 0xc3, 0xf5, 0x01, 0x33, 0x8b, 0x45, 0x45, 0x45, 0xef,
-    0xfe, 0xcc, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x35, 0x00, 0x3c, 0x00, 0x40, 0x00, 0x48, 0x00, 0x4c,
-    0x00, 0x52, 0x00, 0x6d, 0x00, 0x81, 0x00, 0x00, 0x25, 0x27, 0x17, 0x27,
-    0x22, 0x07, 0x06, 0x07, 0x07, 0x31, 0x06, 0x23, 0x22, 0x27, 0x27, 0x31,
-    0x26, 0x27, 0x26, 0x23, 0x07, 0x31, 0x26, 0x27, 0x37, 0x31, 0x36, 0x37,
-    0x36, 0x27, 0x27, 0x31, 0x36, 0x37, 0x17, 0x31, 0x16, 0x33, 0x32, 0x37,
-    0x37, 0x31, 0x16, 0x17, 0x07, 0x31, 0x06, 0x17, 0x16, 0x17, 0x17, 0x31,
-    0x06, 0x07, 0x03, 0x33, 0x23, 0x33, 0x23, 0x31, 0x33, 0x07, 0x36, 0x37,
-    0x07, 0x17, 0x17, 0x27, 0x17, 0x26, 0x27, 0x22, 0x27, 0x33, 0x06, 0x07,
-    0x37, 0x37, 0x27, 0x17, 0x27, 0x16, 0x17, 0x03, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x13, 0x26,
-    0x07, 0x07, 0x31, 0x06, 0x17, 0x17, 0x31, 0x16, 0x17, 0x33, 0x31, 0x36,
-    0x37, 0x37, 0x31, 0x36, 0x27, 0x27, 0x01, 0xb3, 0x59, 0x59, 0x59, 0x08,
-    0x07, 0x06, 0x02, 0x16, 0x16, 0x17, 0x17, 0x16, 0x16, 0x02, 0x06, 0x07,
-    0x08, 0x59, 0x17, 0x05, 0x4c, 0x07, 0x02, 0x03, 0x03, 0x22, 0x1f, 0x2a,
-    0x45, 0x06, 0x08, 0x08, 0x06, 0x45, 0x2a, 0x1f, 0x22, 0x03, 0x03, 0x02,
-    0x07, 0x4c, 0x05, 0x17, 0xb3, 0x01, 0x01, 0x01, 0x02, 0x01, 0xc7, 0x01,
-    0x02, 0x03, 0x4b, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0xf8, 0x02,
-    0x02, 0x04, 0x4b, 0x03, 0x03, 0x03, 0x02, 0x01, 0xc7, 0x46, 0x3a, 0x3a,
-    0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x0e, 0x0e, 0x0e, 0x30, 0x0d, 0x04, 0x13,
-    0x06, 0x10, 0x3c, 0x10, 0x06, 0x13, 0x04, 0x0d, 0x30, 0x57, 0x06, 0x06,
-    0x06, 0x05, 0x04, 0x08, 0x57, 0x05, 0x05, 0x57, 0x08, 0x04, 0x05, 0x06,
-    0x26, 0x2f, 0x30, 0x04, 0x08, 0x07, 0x08, 0x53, 0x22, 0x13, 0x3a, 0x05,
-    0x05, 0x3a, 0x13, 0x22, 0x53, 0x08, 0x07, 0x08, 0x04, 0x30, 0x2f, 0x26,
-    0x01, 0x39, 0x94, 0x04, 0x05, 0x09, 0xe3, 0x03, 0x03, 0x03, 0x01, 0x01,
-    0x01, 0x01, 0x02, 0x03, 0xe3, 0x09, 0x09, 0x09, 0x05, 0x04, 0xfe, 0xc4,
-    0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01,
-    0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01,
-    0x01, 0x46, 0x09, 0x09, 0x23, 0x0b, 0x10, 0x38, 0x10, 0x01, 0x01, 0x10,
-    0x38, 0x10, 0x0b, 0x23, 0x00, 0x07, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x35, 0x00, 0x45, 0x00, 0x53, 0x00, 0x61,
-    0x00, 0x6f, 0x00, 0x7d, 0x00, 0x00, 0x13, 0x06, 0x07, 0x11, 0x31, 0x14,
-    0x07, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x03, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x16, 0x17, 0x11,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x21,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21,
-    0x13, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23,
-    0x31, 0x26, 0x27, 0x35, 0x37, 0x33, 0x23, 0x33, 0x16, 0x17, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x15, 0x33, 0x23, 0x33, 0x16, 0x17,
-    0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x07, 0x33, 0x23, 0x33,
-    0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x15, 0x33,
-    0x23, 0x33, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37,
-    0xa8, 0x16, 0x02, 0x04, 0x01, 0x2c, 0x16, 0x02, 0x02, 0x16, 0xfe, 0xf0,
-    0x60, 0x1f, 0x14, 0x14, 0x01, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x01, 0x14, 0x14, 0x1f, 0x01, 0x10, 0x1f, 0x14, 0x14, 0x01, 0x01,
-    0x14, 0x14, 0x1f, 0xfe, 0x90, 0x68, 0x02, 0x16, 0x60, 0x16, 0x02, 0x02,
-    0x16, 0x60, 0x16, 0x02, 0xc8, 0x20, 0x20, 0x20, 0x16, 0x02, 0x02, 0x16,
-    0x20, 0x16, 0x02, 0x02, 0x16, 0x20, 0x20, 0x20, 0x16, 0x02, 0x02, 0x16,
-    0x20, 0x16, 0x02, 0x02, 0x16, 0xb0, 0xd0, 0xd0, 0xd0, 0x16, 0x02, 0x02,
-    0x16, 0xd0, 0x16, 0x02, 0x02, 0x16, 0xd0, 0xd0, 0xd0, 0x16, 0x02, 0x02,
-    0x16, 0xd0, 0x16, 0x02, 0x02, 0x16, 0x01, 0x70, 0x02, 0x16, 0xfe, 0xd0,
-    0x0d, 0x0b, 0x02, 0x16, 0x01, 0x30, 0x16, 0x02, 0xfe, 0x70, 0x01, 0x14,
-    0x14, 0x1f, 0x01, 0x28, 0x16, 0x02, 0x02, 0x16, 0xfe, 0xd8, 0x16, 0x02,
-    0x02, 0x16, 0x01, 0x30, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f,
-    0xfe, 0xd0, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x58, 0x16, 0x02, 0x02, 0x16,
-    0x50, 0x16, 0x02, 0x02, 0x16, 0x50, 0x18, 0x02, 0x16, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0x50, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02,
-    0x50, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x50, 0x02, 0x16,
-    0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf9,
-    0xff, 0xb9, 0x02, 0x87, 0x01, 0xc7, 0x00, 0x27, 0x00, 0x37, 0x00, 0x4c,
-    0x00, 0x58, 0x00, 0x00, 0x13, 0x26, 0x07, 0x06, 0x17, 0x01, 0x31, 0x16,
-    0x37, 0x36, 0x27, 0x27, 0x31, 0x36, 0x27, 0x27, 0x31, 0x26, 0x27, 0x35,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x35, 0x31, 0x34, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x15, 0x15, 0x31, 0x06, 0x07, 0x27, 0x17, 0x36, 0x37, 0x31,
-    0x31, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x14, 0x17, 0x27,
-    0x13, 0x27, 0x17, 0x27, 0x23, 0x31, 0x36, 0x37, 0x27, 0x31, 0x15, 0x31,
-    0x06, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16, 0x17, 0x21, 0x07, 0x23, 0x33,
-    0x23, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x27, 0x13, 0x0f,
-    0x0c, 0x10, 0x02, 0x50, 0x13, 0x0f, 0x0c, 0x10, 0x58, 0x04, 0x08, 0x0f,
-    0x2b, 0x01, 0x01, 0x24, 0x23, 0x38, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x42, 0x24, 0x93, 0xb9, 0x0f, 0x19, 0x19, 0x1f, 0x30, 0x1f, 0x20, 0x01,
-    0x13, 0xe3, 0xb6, 0x3d, 0x3d, 0x3d, 0xb1, 0x20, 0x07, 0x2f, 0x01, 0x2b,
-    0x0f, 0x08, 0x05, 0x07, 0x0f, 0x01, 0x1e, 0x16, 0x40, 0x40, 0x80, 0x13,
-    0x13, 0x1a, 0x1a, 0x13, 0x13, 0x01, 0xbb, 0x0c, 0x10, 0x13, 0x0f, 0xfe,
-    0x30, 0x0c, 0x10, 0x13, 0x0f, 0x45, 0x0c, 0x0b, 0x13, 0x37, 0x46, 0x19,
-    0x3b, 0x2b, 0x2b, 0x0c, 0x13, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x13,
-    0x0f, 0x37, 0x74, 0x91, 0x18, 0x0f, 0x0f, 0x01, 0x20, 0x1f, 0x30, 0x19,
-    0x32, 0x2d, 0xb2, 0xfe, 0xf6, 0x30, 0x30, 0x30, 0x32, 0x3b, 0x25, 0x0c,
-    0x45, 0x37, 0x13, 0x0c, 0x0d, 0x0d, 0x01, 0x20, 0x1a, 0x13, 0x13, 0x13,
-    0x13, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x58, 0x00, 0x00, 0x01, 0x32,
-    0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36,
-    0x33, 0x11, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x27, 0x26, 0x35, 0x31, 0x31, 0x34, 0x37, 0x36,
-    0x33, 0x32, 0x17, 0x16, 0x37, 0x36, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x27, 0x26, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f,
-    0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x39, 0x17, 0x17,
-    0x19, 0x20, 0x20, 0x19, 0x11, 0x10, 0x0e, 0x0e, 0x27, 0x33, 0x33, 0x28,
-    0x25, 0x25, 0x28, 0x33, 0x33, 0x27, 0x0e, 0x0e, 0x11, 0x10, 0x19, 0x20,
-    0x20, 0x19, 0x01, 0x90, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31,
-    0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c,
-    0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22,
-    0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22,
-    0x21, 0x01, 0xc7, 0x19, 0x20, 0x20, 0x18, 0x18, 0x18, 0x0e, 0x0e, 0x12,
-    0x10, 0x26, 0x26, 0x27, 0x33, 0x33, 0x28, 0x25, 0x25, 0x11, 0x11, 0x0e,
-    0x0e, 0x17, 0x17, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x40,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x4a, 0x00, 0x6d, 0x00, 0x00,
-    0x01, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x11,
-    0x31, 0x36, 0x37, 0x21, 0x25, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x21, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x36,
-    0x37, 0x36, 0x27, 0x26, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x36,
-    0x37, 0x36, 0x37, 0x17, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x16, 0x17,
-    0x16, 0x37, 0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17,
-    0x16, 0x17, 0x36, 0x37, 0x36, 0x27, 0x26, 0x07, 0x06, 0x07, 0x26, 0x27,
-    0x26, 0x27, 0x02, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0x40, 0x0f, 0x01,
-    0x01, 0x0f, 0x01, 0xc0, 0xfe, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0x40, 0x88, 0x16, 0x0e, 0x10, 0x12, 0x0f, 0x0d, 0x1c, 0x2c, 0x29,
-    0x1b, 0x1b, 0x01, 0x01, 0x1b, 0x1b, 0x29, 0x2c, 0x1c, 0x0d, 0x0f, 0x12,
-    0x10, 0x0e, 0x16, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x90,
-    0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e, 0x10, 0x12, 0x0f, 0x0d, 0x1c, 0x2c,
-    0x29, 0x1b, 0x1b, 0x01, 0x01, 0x1b, 0x1b, 0x29, 0x2c, 0x1c, 0x0d, 0x0f,
-    0x12, 0x10, 0x0e, 0x16, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x70, 0x01, 0x0f,
-    0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x30, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0xb0, 0x01, 0x0f, 0x0f, 0x0d,
-    0x10, 0x12, 0x1f, 0x01, 0x01, 0x1b, 0x1b, 0x29, 0x29, 0x1b, 0x1b, 0x01,
-    0x01, 0x1f, 0x12, 0x10, 0x0d, 0x0f, 0x0f, 0x01, 0x01, 0x0d, 0x0e, 0x14,
-    0x14, 0x0e, 0x0d, 0x01, 0x30, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x0f,
-    0x0d, 0x10, 0x12, 0x1f, 0x01, 0x01, 0x1b, 0x1b, 0x29, 0x29, 0x1b, 0x1b,
-    0x01, 0x01, 0x1f, 0x12, 0x10, 0x0d, 0x0f, 0x0f, 0x01, 0x01, 0x0d, 0x0e,
-    0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0xff, 0xe0, 0x02, 0x20,
-    0x01, 0xa0, 0x00, 0x27, 0x00, 0x37, 0x00, 0x51, 0x00, 0x6e, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x36, 0x37, 0x11, 0x37, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x17, 0x34, 0x37, 0x31,
-    0x31, 0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x16, 0x15, 0x15, 0x31, 0x14,
-    0x07, 0x06, 0x23, 0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x17, 0x33,
-    0x23, 0x33, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x32, 0x17,
-    0x16, 0x15, 0x15, 0x31, 0x14, 0x07, 0x06, 0x23, 0x23, 0x31, 0x22, 0x27,
-    0x26, 0x35, 0x35, 0x30, 0x0f, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e,
-    0x01, 0x58, 0x0e, 0x16, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x0f, 0x01,
-    0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e, 0xfe, 0xa8, 0x0e, 0x16, 0x14, 0x0e,
-    0x0d, 0x01, 0x01, 0x0f, 0x4d, 0x08, 0x15, 0x15, 0x08, 0x01, 0x46, 0x08,
-    0x15, 0x15, 0x08, 0xfe, 0xba, 0x03, 0x09, 0x09, 0x0e, 0x80, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x80, 0x0e, 0x09, 0x09, 0x80, 0x20, 0x20, 0x20,
-    0x1b, 0x12, 0x12, 0x01, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x80,
-    0x0e, 0x09, 0x09, 0x01, 0x4c, 0x0e, 0x16, 0x14, 0x0e, 0x0d, 0x01, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e, 0xfe, 0xe8, 0x0e,
-    0x16, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0d, 0x0e,
-    0x14, 0x16, 0x0e, 0x01, 0x18, 0x14, 0x15, 0x08, 0xfe, 0xfa, 0x08, 0x15,
-    0x15, 0x08, 0x01, 0x06, 0x08, 0x15, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x60, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x60, 0xa0, 0x01, 0x12,
-    0x12, 0x1b, 0x20, 0x09, 0x09, 0x0e, 0x60, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x20, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x80,
-    0x01, 0xc0, 0x00, 0x10, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x64, 0x00, 0x6d,
-    0x00, 0x7c, 0x00, 0xbe, 0x00, 0xcb, 0x00, 0xd8, 0x00, 0xe9, 0x00, 0x00,
-    0x13, 0x34, 0x35, 0x30, 0x31, 0x30, 0x31, 0x36, 0x37, 0x32, 0x33, 0x16,
-    0x17, 0x06, 0x07, 0x26, 0x27, 0x27, 0x14, 0x17, 0x31, 0x31, 0x16, 0x17,
-    0x15, 0x31, 0x06, 0x07, 0x06, 0x15, 0x16, 0x17, 0x16, 0x17, 0x32, 0x37,
-    0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x33, 0x36, 0x37, 0x36, 0x37,
-    0x34, 0x27, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x36, 0x35, 0x26, 0x27,
-    0x26, 0x27, 0x22, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x26, 0x23,
-    0x06, 0x07, 0x06, 0x07, 0x21, 0x36, 0x37, 0x16, 0x17, 0x06, 0x07, 0x26,
-    0x27, 0x07, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x36, 0x37, 0x33, 0x17, 0x16, 0x17, 0x06, 0x07, 0x26, 0x27,
-    0x36, 0x37, 0x05, 0x06, 0x07, 0x22, 0x23, 0x31, 0x31, 0x26, 0x27, 0x34,
-    0x35, 0x36, 0x37, 0x16, 0x17, 0x25, 0x33, 0x23, 0x33, 0x16, 0x17, 0x15,
-    0x31, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x23, 0x31, 0x15,
-    0x31, 0x06, 0x07, 0x06, 0x15, 0x16, 0x17, 0x16, 0x17, 0x32, 0x37, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x33, 0x36, 0x37, 0x36, 0x37, 0x34,
-    0x27, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x36, 0x35, 0x26, 0x27, 0x26,
-    0x27, 0x22, 0x07, 0x06, 0x07, 0x23, 0x31, 0x15, 0x31, 0x16, 0x17, 0x37,
-    0x36, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x27, 0x26, 0x37,
-    0x05, 0x06, 0x07, 0x06, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16,
-    0x07, 0x05, 0x26, 0x27, 0x36, 0x37, 0x16, 0x17, 0x31, 0x31, 0x30, 0x31,
-    0x14, 0x15, 0x06, 0x07, 0x22, 0x23, 0x30, 0x01, 0x0f, 0x01, 0x02, 0x0c,
-    0x01, 0x01, 0x0f, 0x0d, 0x03, 0x30, 0x0b, 0x0b, 0x12, 0x12, 0x0b, 0x0b,
-    0x01, 0x12, 0x12, 0x1b, 0x14, 0x10, 0x10, 0x07, 0xca, 0x07, 0x10, 0x10,
-    0x14, 0x1b, 0x12, 0x12, 0x01, 0x0b, 0x0b, 0x12, 0x12, 0x0b, 0x0b, 0x01,
-    0x12, 0x12, 0x1b, 0x14, 0x10, 0x10, 0x07, 0xca, 0x07, 0x10, 0x10, 0x14,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x70, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0x2b, 0x0a, 0x19, 0x19, 0x0a, 0xca, 0x0a, 0x19, 0x19, 0x0a,
-    0xca, 0x3b, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0xd0,
-    0x01, 0x0c, 0x01, 0x02, 0x0e, 0x02, 0x03, 0x0d, 0x0f, 0x01, 0x01, 0x87,
-    0x2e, 0x2e, 0x2e, 0x0a, 0x19, 0x19, 0x0a, 0xca, 0x0a, 0x19, 0x30, 0x12,
-    0x0b, 0x0b, 0x01, 0x12, 0x12, 0x1b, 0x14, 0x10, 0x10, 0x07, 0xca, 0x07,
-    0x10, 0x10, 0x14, 0x1b, 0x12, 0x12, 0x01, 0x0b, 0x0b, 0x12, 0x12, 0x0b,
-    0x0b, 0x01, 0x12, 0x12, 0x1b, 0x14, 0x10, 0x10, 0x07, 0x45, 0x0f, 0x08,
-    0x59, 0x02, 0x08, 0x09, 0x07, 0x07, 0x01, 0x02, 0x08, 0x09, 0x08, 0x06,
-    0x01, 0xfe, 0xe0, 0x02, 0x08, 0x09, 0x07, 0x07, 0x01, 0x02, 0x08, 0x09,
-    0x08, 0x06, 0x01, 0x01, 0x2d, 0x0c, 0x01, 0x02, 0x0e, 0x0d, 0x03, 0x01,
-    0x0f, 0x01, 0x02, 0x01, 0x7d, 0x01, 0x02, 0x0e, 0x02, 0x03, 0x0d, 0x0f,
-    0x01, 0x01, 0x0c, 0x03, 0x14, 0x10, 0x10, 0x07, 0x6a, 0x07, 0x10, 0x10,
-    0x14, 0x1b, 0x12, 0x12, 0x01, 0x0b, 0x0b, 0x12, 0x12, 0x0b, 0x0b, 0x01,
-    0x12, 0x12, 0x1b, 0x14, 0x10, 0x10, 0x07, 0x6a, 0x07, 0x10, 0x10, 0x14,
-    0x1b, 0x12, 0x12, 0x01, 0x0b, 0x0b, 0x12, 0x12, 0x0b, 0x0b, 0x01, 0x12,
-    0x12, 0x1b, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x19,
-    0x0a, 0x6a, 0x0a, 0x19, 0x19, 0x0a, 0x6a, 0x0a, 0x19, 0xb8, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x10, 0x0d, 0x03, 0x01, 0x0f, 0x01,
-    0x02, 0x0c, 0x01, 0x01, 0x0f, 0x28, 0x19, 0x0a, 0x6a, 0x0a, 0x19, 0x19,
-    0x0a, 0x25, 0x25, 0x07, 0x10, 0x10, 0x14, 0x1b, 0x12, 0x12, 0x01, 0x0b,
-    0x0b, 0x12, 0x12, 0x0b, 0x0b, 0x01, 0x12, 0x12, 0x1b, 0x14, 0x10, 0x10,
-    0x07, 0x6a, 0x07, 0x10, 0x10, 0x14, 0x1b, 0x12, 0x12, 0x01, 0x0b, 0x0b,
-    0x12, 0x10, 0x0e, 0x12, 0x1b, 0x09, 0x04, 0x03, 0x06, 0x07, 0x09, 0x09,
-    0x04, 0x03, 0x06, 0x07, 0x09, 0xe6, 0x09, 0x04, 0x03, 0x06, 0x07, 0x09,
-    0x09, 0x04, 0x03, 0x06, 0x07, 0x09, 0x0d, 0x03, 0x0d, 0x0f, 0x01, 0x01,
-    0x0c, 0x02, 0x01, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0xff, 0xe0, 0x01, 0xc0, 0x01, 0xa0, 0x00, 0x15, 0x00, 0x34, 0x00, 0x00,
-    0x13, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x33, 0x31, 0x35, 0x31, 0x34,
-    0x37, 0x36, 0x33, 0x33, 0x31, 0x35, 0x31, 0x26, 0x27, 0x21, 0x13, 0x23,
-    0x33, 0x23, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37,
-    0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x14, 0x07,
-    0x07, 0x31, 0x06, 0x23, 0x23, 0x40, 0x0f, 0x01, 0x01, 0x0f, 0xe0, 0x09,
-    0x09, 0x0e, 0x50, 0x01, 0x0f, 0xfe, 0xc0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12,
-    0x01, 0x13, 0x5a, 0x13, 0x1a, 0x06, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0,
-    0x0f, 0x01, 0x50, 0x0e, 0x09, 0x09, 0xe0, 0x0f, 0x01, 0xfe, 0x70, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0xe0, 0x06, 0x1a, 0x13, 0x5a, 0x13, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x27, 0x00, 0x39, 0x00, 0x53,
-    0x00, 0x00, 0x17, 0x33, 0x23, 0x33, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31,
-    0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x26, 0x27,
-    0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x15, 0x31, 0x23, 0x31,
-    0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x37, 0x33, 0x23, 0x33, 0x36, 0x37,
-    0x35, 0x31, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17,
-    0x27, 0x35, 0x15, 0x35, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17,
-    0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x26, 0x27, 0x40, 0xe0, 0xe0, 0xe0, 0x0f, 0x01, 0x30, 0x01, 0x12, 0x12,
-    0x1b, 0xe0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x40, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0xa0, 0xe0, 0xe0, 0xe0, 0x0f, 0x01, 0x01, 0x0f,
-    0xe0, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x01, 0x12, 0x12, 0x1b, 0xe0, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xe0, 0x1b, 0x12, 0x12, 0x01,
-    0x10, 0x01, 0x0f, 0x40, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0xe0, 0x1b, 0x12, 0x12, 0x01, 0x30, 0x01, 0x0f, 0xe0, 0x0f, 0x01,
-    0xa0, 0x01, 0x0f, 0xe0, 0x0f, 0x01, 0x01, 0x0f, 0xe0, 0x0f, 0x01, 0x10,
-    0xe0, 0xe0, 0xe0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xe0,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x34, 0x00, 0x3e, 0x00, 0x4a,
-    0x00, 0x00, 0x13, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23,
-    0x31, 0x15, 0x31, 0x06, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16, 0x17, 0x15,
-    0x31, 0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x36,
-    0x37, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26,
-    0x27, 0x35, 0x31, 0x23, 0x31, 0x26, 0x27, 0x13, 0x06, 0x07, 0x33, 0x31,
-    0x26, 0x27, 0x27, 0x31, 0x07, 0x37, 0x36, 0x35, 0x35, 0x31, 0x23, 0x31,
-    0x15, 0x31, 0x14, 0x17, 0x33, 0x00, 0x02, 0x16, 0x01, 0x50, 0x16, 0x02,
-    0x02, 0x16, 0x08, 0x01, 0x2b, 0x52, 0x51, 0x2c, 0x01, 0x08, 0x16, 0x02,
-    0x02, 0x16, 0xfe, 0xb0, 0x16, 0x02, 0x02, 0x16, 0x08, 0x01, 0x2c, 0x51,
-    0x51, 0x2c, 0x01, 0x08, 0x16, 0x02, 0x6f, 0x06, 0x05, 0xb8, 0x05, 0x05,
-    0x52, 0x51, 0xad, 0x14, 0xe0, 0x14, 0xb8, 0x01, 0xa8, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0x13, 0x3f, 0x2d, 0x51, 0x52, 0x2c, 0x3f, 0x13, 0x02,
-    0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x13, 0x3f, 0x2c, 0x52, 0x51,
-    0x2d, 0x3f, 0x13, 0x02, 0x16, 0xfe, 0xa4, 0x05, 0x07, 0x07, 0x05, 0x52,
-    0x51, 0xf3, 0x1b, 0x22, 0x13, 0x13, 0x22, 0x1b, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x33, 0x00, 0x42, 0x00, 0x51,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31, 0x15, 0x31, 0x16,
-    0x17, 0x17, 0x31, 0x07, 0x31, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35,
-    0x31, 0x26, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x37, 0x35, 0x31, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x21, 0x13, 0x17, 0x27, 0x17, 0x16, 0x17,
-    0x15, 0x31, 0x23, 0x31, 0x35, 0x31, 0x36, 0x37, 0x37, 0x35, 0x27, 0x17,
-    0x27, 0x26, 0x27, 0x35, 0x31, 0x33, 0x31, 0x15, 0x31, 0x06, 0x07, 0x07,
-    0x18, 0x16, 0x02, 0x02, 0x16, 0x08, 0x01, 0x2c, 0x51, 0x51, 0x2c, 0x01,
-    0x08, 0x16, 0x02, 0x02, 0x16, 0x01, 0x50, 0x16, 0x02, 0x02, 0x16, 0x08,
-    0x01, 0x2b, 0x52, 0x51, 0x2c, 0x01, 0x08, 0x16, 0x02, 0x02, 0x16, 0xfe,
-    0xb0, 0xa8, 0x52, 0x52, 0x52, 0x1d, 0x01, 0xe0, 0x01, 0x1e, 0x51, 0x51,
-    0x51, 0x51, 0x1e, 0x01, 0xe0, 0x01, 0x1d, 0x52, 0x01, 0xc0, 0x02, 0x16,
-    0x16, 0x02, 0x13, 0x3f, 0x2d, 0x51, 0x52, 0x2c, 0x3f, 0x13, 0x02, 0x16,
-    0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x13, 0x3f, 0x2c, 0x52, 0x51, 0x2d,
-    0x3f, 0x13, 0x02, 0x16, 0x16, 0x02, 0xfe, 0xde, 0x51, 0x51, 0x51, 0x1f,
-    0x2b, 0x13, 0x13, 0x2b, 0x1e, 0x52, 0x44, 0x51, 0x51, 0x51, 0x1f, 0x2b,
-    0x13, 0x13, 0x2b, 0x1f, 0x51, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x20,
-    0xff, 0xc0, 0x01, 0xa0, 0x01, 0xc0, 0x00, 0x87, 0x00, 0x00, 0x13, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x16, 0x37, 0x36,
-    0x33, 0x16, 0x17, 0x15, 0x31, 0x14, 0x07, 0x06, 0x07, 0x06, 0x07, 0x15,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x36, 0x37, 0x36, 0x35, 0x35,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x22, 0x07, 0x26, 0x27, 0x22, 0x07, 0x26,
-    0x27, 0x22, 0x07, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x15, 0x31, 0x06,
-    0x07, 0x17, 0x31, 0x27, 0x31, 0x07, 0x31, 0x06, 0x15, 0x15, 0x31, 0x14,
-    0x17, 0x16, 0x17, 0x37, 0x31, 0x07, 0x31, 0x17, 0x31, 0x16, 0x17, 0x15,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x07,
-    0x31, 0x37, 0x31, 0x27, 0x31, 0x26, 0x27, 0x35, 0x31, 0x34, 0x37, 0x37,
-    0x31, 0x36, 0x37, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x35,
-    0x31, 0x35, 0x90, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0c, 0x0e, 0x0b, 0x05,
-    0x05, 0x0f, 0x01, 0x01, 0x0c, 0x0e, 0x0b, 0x05, 0x05, 0x0f, 0x01, 0x01,
-    0x0c, 0x0e, 0x0b, 0x05, 0x05, 0x0f, 0x01, 0x0d, 0x0e, 0x15, 0x0f, 0x01,
-    0x02, 0x16, 0x16, 0x02, 0x1d, 0x11, 0x12, 0x01, 0x12, 0x12, 0x1b, 0x04,
-    0x04, 0x12, 0x26, 0x04, 0x04, 0x12, 0x26, 0x04, 0x04, 0x12, 0x26, 0x1b,
-    0x12, 0x12, 0x01, 0x12, 0x0e, 0x12, 0x12, 0x09, 0x17, 0x11, 0x11, 0x1f,
-    0x0e, 0x0e, 0x09, 0x0a, 0x0c, 0x02, 0x16, 0x16, 0x02, 0x02, 0x14, 0x0c,
-    0x09, 0x0d, 0x0d, 0x09, 0x2b, 0x01, 0x0a, 0x0a, 0x05, 0x07, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x07, 0x06, 0x09,
-    0x03, 0x01, 0x0f, 0x0f, 0x07, 0x06, 0x09, 0x03, 0x01, 0x0f, 0x0f, 0x07,
-    0x06, 0x09, 0x03, 0x01, 0x0f, 0x68, 0x18, 0x12, 0x12, 0x08, 0x06, 0x11,
-    0x85, 0x16, 0x02, 0x02, 0x16, 0x76, 0x0f, 0x1c, 0x1c, 0x23, 0x68, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x1f, 0x02, 0x01, 0x1f, 0x02, 0x01, 0x1f, 0x02,
-    0x01, 0x12, 0x12, 0x1b, 0x40, 0x0b, 0x10, 0x10, 0x10, 0x0b, 0x19, 0x22,
-    0x0c, 0x26, 0x21, 0x20, 0x16, 0x14, 0x14, 0x06, 0x07, 0x04, 0x6d, 0x16,
-    0x02, 0x02, 0x16, 0x80, 0x15, 0x03, 0x01, 0x06, 0x13, 0x13, 0x06, 0x20,
-    0x36, 0x0c, 0x10, 0x0b, 0x0b, 0x06, 0x05, 0x20, 0x0f, 0x01, 0x01, 0x0f,
-    0x42, 0x0e, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xe0,
-    0x01, 0xc0, 0x00, 0x3a, 0x00, 0x9c, 0x00, 0x00, 0x01, 0x06, 0x07, 0x26,
-    0x23, 0x06, 0x07, 0x06, 0x07, 0x15, 0x31, 0x27, 0x31, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x15, 0x14, 0x17, 0x17, 0x31, 0x16, 0x17, 0x16, 0x33, 0x33,
-    0x33, 0x32, 0x33, 0x32, 0x33, 0x36, 0x37, 0x36, 0x37, 0x34, 0x35, 0x34,
-    0x35, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x22, 0x07, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x22, 0x07, 0x26, 0x27, 0x07, 0x30, 0x31, 0x31, 0x31,
-    0x30, 0x31, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x30, 0x31,
-    0x30, 0x31, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x30, 0x31,
-    0x30, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x30, 0x31, 0x30, 0x31,
-    0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x30, 0x31, 0x30, 0x31,
-    0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x30, 0x15, 0x30, 0x15, 0x06, 0x07,
-    0x06, 0x07, 0x22, 0x23, 0x23, 0x23, 0x26, 0x27, 0x27, 0x31, 0x26, 0x37,
-    0x36, 0x17, 0x17, 0x31, 0x16, 0x37, 0x36, 0x37, 0x35, 0x31, 0x36, 0x37,
-    0x16, 0x17, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x01, 0x00, 0x28,
-    0x12, 0x0a, 0x0c, 0x1b, 0x12, 0x12, 0x01, 0x03, 0x13, 0x1a, 0x19, 0x14,
-    0x13, 0x13, 0x58, 0x24, 0x2f, 0x2e, 0x34, 0x08, 0x08, 0x01, 0x01, 0x01,
-    0x02, 0x46, 0x2f, 0x30, 0x06, 0x01, 0x12, 0x12, 0x1b, 0x08, 0x08, 0x01,
-    0x12, 0x12, 0x1b, 0x0c, 0x0a, 0x12, 0x28, 0x10, 0x01, 0x0f, 0x0f, 0x01,
-    0x02, 0x16, 0x16, 0x02, 0x01, 0x0f, 0x0f, 0x01, 0x02, 0x16, 0x16, 0x02,
-    0x01, 0x0f, 0x0f, 0x01, 0x04, 0x24, 0x24, 0x35, 0x01, 0x01, 0x05, 0x08,
-    0x56, 0x3e, 0x57, 0x0a, 0x0a, 0x0b, 0x0b, 0x2c, 0x0c, 0x0e, 0x0e, 0x01,
-    0x01, 0x0f, 0x0f, 0x01, 0x02, 0x16, 0x16, 0x02, 0x01, 0xc0, 0x02, 0x22,
-    0x04, 0x01, 0x12, 0x12, 0x1b, 0xa6, 0x03, 0x13, 0x13, 0x14, 0x19, 0x1a,
-    0x13, 0x58, 0x24, 0x14, 0x13, 0x07, 0x2f, 0x2f, 0x46, 0x02, 0x01, 0x01,
-    0x01, 0xb0, 0x1b, 0x12, 0x12, 0x01, 0x02, 0x02, 0x1b, 0x12, 0x12, 0x01,
-    0x04, 0x22, 0x02, 0x60, 0x20, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x88, 0x16,
-    0x02, 0x02, 0x16, 0x88, 0x0f, 0x01, 0x01, 0x0f, 0x38, 0x50, 0x16, 0x02,
-    0x02, 0x16, 0x48, 0x0f, 0x01, 0x01, 0x0f, 0xad, 0x01, 0x01, 0x35, 0x24,
-    0x24, 0x04, 0x01, 0x3c, 0x58, 0x0b, 0x0b, 0x0a, 0x0a, 0x2b, 0x0b, 0x05,
-    0x07, 0x10, 0xdf, 0x0f, 0x01, 0x01, 0x0f, 0x88, 0x16, 0x02, 0x02, 0x16,
-    0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xf0, 0x02, 0x00,
-    0x01, 0x80, 0x00, 0x40, 0x00, 0x8e, 0x00, 0x00, 0x37, 0x34, 0x37, 0x31,
-    0x31, 0x36, 0x37, 0x33, 0x31, 0x27, 0x31, 0x26, 0x27, 0x26, 0x37, 0x36,
-    0x37, 0x36, 0x17, 0x17, 0x31, 0x36, 0x37, 0x30, 0x31, 0x37, 0x31, 0x36,
-    0x37, 0x33, 0x31, 0x32, 0x17, 0x16, 0x17, 0x17, 0x31, 0x16, 0x15, 0x15,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x23, 0x26, 0x27, 0x26, 0x27, 0x34,
-    0x37, 0x26, 0x27, 0x34, 0x31, 0x34, 0x31, 0x07, 0x31, 0x22, 0x27, 0x26,
-    0x27, 0x37, 0x06, 0x07, 0x16, 0x17, 0x37, 0x31, 0x16, 0x17, 0x16, 0x07,
-    0x06, 0x15, 0x16, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x15, 0x16, 0x17,
-    0x33, 0x33, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x34, 0x27, 0x27, 0x31,
-    0x26, 0x27, 0x26, 0x23, 0x23, 0x31, 0x22, 0x07, 0x27, 0x31, 0x17, 0x31,
-    0x07, 0x31, 0x14, 0x23, 0x14, 0x31, 0x17, 0x31, 0x16, 0x07, 0x06, 0x27,
-    0x27, 0x31, 0x27, 0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31, 0x16, 0x17,
-    0x15, 0x31, 0x14, 0x07, 0x06, 0x07, 0x07, 0x00, 0x11, 0x12, 0x1b, 0x03,
-    0x08, 0x1a, 0x0e, 0x0e, 0x05, 0x07, 0x15, 0x16, 0x1b, 0xad, 0x03, 0x04,
-    0x12, 0x1b, 0x26, 0x0b, 0x29, 0x22, 0x23, 0x15, 0x01, 0x15, 0x01, 0x22,
-    0x22, 0x33, 0x08, 0x60, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x1f, 0x02, 0x7e,
-    0x1b, 0x12, 0x13, 0x02, 0x40, 0x0f, 0x01, 0x02, 0x0f, 0xa1, 0x10, 0x07,
-    0x06, 0x0b, 0x04, 0x01, 0x0f, 0x0f, 0x07, 0x06, 0x09, 0x03, 0x01, 0x0f,
-    0x60, 0x08, 0x1f, 0x14, 0x14, 0x01, 0x0e, 0x02, 0x0e, 0x18, 0x17, 0x1c,
-    0x0b, 0x11, 0x0c, 0x12, 0x12, 0x13, 0x01, 0x39, 0x0e, 0x02, 0x05, 0x0f,
-    0x55, 0xbd, 0x0e, 0x05, 0x02, 0x0e, 0xbc, 0x10, 0x03, 0x06, 0x07, 0x0a,
-    0xbb, 0xac, 0x1b, 0x13, 0x12, 0x02, 0x02, 0x06, 0x16, 0x16, 0x1a, 0x1b,
-    0x0d, 0x0e, 0x05, 0x27, 0x05, 0x04, 0x14, 0x1c, 0x01, 0x14, 0x14, 0x23,
-    0x03, 0x24, 0x29, 0x7d, 0x33, 0x22, 0x22, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x04, 0x04, 0x12, 0x26, 0x01, 0x01, 0x04, 0x11, 0x12, 0x1b, 0x12, 0x02,
-    0x0f, 0x0e, 0x01, 0x06, 0x01, 0x0e, 0x0e, 0x0c, 0x04, 0x07, 0x0f, 0x01,
-    0x01, 0x0c, 0x0e, 0x0b, 0x05, 0x05, 0x0f, 0x01, 0x01, 0x14, 0x14, 0x1f,
-    0x7d, 0x1c, 0x19, 0x02, 0x19, 0x0d, 0x0e, 0x0d, 0x10, 0x10, 0x14, 0x01,
-    0x01, 0x0d, 0x05, 0x0f, 0x0e, 0x02, 0x14, 0x2a, 0x02, 0x0e, 0x0f, 0x04,
-    0x2a, 0x04, 0x11, 0x01, 0x0b, 0x07, 0x08, 0x01, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x80, 0x00, 0x59,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x32, 0x17, 0x17, 0x31, 0x16, 0x15, 0x15, 0x31, 0x06, 0x07, 0x26,
-    0x27, 0x35, 0x31, 0x27, 0x31, 0x23, 0x31, 0x26, 0x27, 0x26, 0x27, 0x36,
-    0x37, 0x36, 0x37, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x32, 0x17, 0x16,
-    0x17, 0x17, 0x31, 0x16, 0x15, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35,
-    0x31, 0x34, 0x27, 0x27, 0x31, 0x26, 0x27, 0x23, 0x48, 0x16, 0x02, 0x02,
-    0x16, 0xa8, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x68, 0x16,
-    0x02, 0x02, 0x16, 0x98, 0x07, 0x06, 0x40, 0x0b, 0x02, 0x16, 0x16, 0x02,
-    0x2f, 0x91, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f, 0x68, 0x0f,
-    0x01, 0x01, 0x0f, 0xa8, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x14, 0x14, 0x1f,
-    0xd2, 0x23, 0x1f, 0x1f, 0x16, 0x4f, 0x20, 0x02, 0x16, 0x16, 0x02, 0x16,
-    0x4e, 0x20, 0x32, 0xd2, 0x01, 0x50, 0x02, 0x16, 0x16, 0x02, 0x01, 0x12,
-    0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0x02, 0x16, 0x16, 0x02, 0x04, 0x28,
-    0x07, 0x0d, 0x18, 0x16, 0x02, 0x02, 0x16, 0x0b, 0x1d, 0x01, 0x14, 0x14,
-    0x1f, 0x1f, 0x14, 0x14, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x14, 0x14,
-    0x1f, 0x1f, 0x14, 0x14, 0x01, 0x0f, 0x10, 0x1b, 0x64, 0x2a, 0x34, 0x6c,
-    0x16, 0x02, 0x02, 0x16, 0x6c, 0x24, 0x1c, 0x64, 0x27, 0x01, 0x00, 0x00,
-    0x00, 0x02, 0x00, 0x1d, 0xff, 0xc0, 0x02, 0x24, 0x01, 0xc4, 0x00, 0x3c,
-    0x00, 0x80, 0x00, 0x00, 0x13, 0x26, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36,
-    0x17, 0x16, 0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x37, 0x36, 0x17, 0x16,
-    0x17, 0x16, 0x15, 0x36, 0x17, 0x16, 0x17, 0x16, 0x07, 0x07, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x22, 0x23, 0x22, 0x23, 0x26, 0x27, 0x27, 0x31, 0x26,
-    0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x17, 0x17, 0x31, 0x27, 0x31, 0x26,
-    0x37, 0x36, 0x37, 0x36, 0x17, 0x37, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31,
-    0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31,
-    0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31,
-    0x16, 0x17, 0x32, 0x33, 0x32, 0x33, 0x32, 0x37, 0x36, 0x37, 0x37, 0x31,
-    0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x06, 0x07, 0x22, 0x27, 0x26, 0x37,
-    0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x06, 0x07, 0x26, 0x27,
-    0x27, 0xaa, 0x06, 0x0c, 0x0d, 0x1a, 0x1a, 0x16, 0x17, 0x08, 0x1e, 0x0d,
-    0x06, 0x15, 0x15, 0x1b, 0x18, 0x0e, 0x0e, 0x0f, 0x10, 0x1b, 0x0d, 0x0d,
-    0x06, 0x37, 0x0e, 0x28, 0x28, 0x35, 0x09, 0x08, 0x09, 0x08, 0x58, 0x45,
-    0x5c, 0x15, 0x04, 0x03, 0x10, 0x12, 0x19, 0x19, 0x16, 0x11, 0x33, 0x0a,
-    0x0a, 0x0b, 0x19, 0x10, 0x11, 0x4d, 0x05, 0x0e, 0x0e, 0x03, 0x36, 0x04,
-    0x13, 0x15, 0x09, 0x33, 0x07, 0x0e, 0x0d, 0x04, 0x49, 0x08, 0x12, 0x12,
-    0x15, 0x3f, 0x0c, 0x0b, 0x08, 0x0b, 0x5c, 0x39, 0x47, 0x08, 0x09, 0x08,
-    0x09, 0x24, 0x1b, 0x1c, 0x09, 0x38, 0x02, 0x0e, 0x0f, 0x04, 0x1a, 0x06,
-    0x14, 0x0d, 0x07, 0x08, 0x02, 0x1d, 0x01, 0x0e, 0x0f, 0x04, 0x1f, 0x05,
-    0x14, 0x12, 0x05, 0x3a, 0x01, 0x6f, 0x1a, 0x16, 0x17, 0x08, 0x06, 0x0c,
-    0x0d, 0x1a, 0x6b, 0x46, 0x1b, 0x0e, 0x0e, 0x04, 0x05, 0x12, 0x12, 0x18,
-    0x04, 0x04, 0x07, 0x16, 0x16, 0x1b, 0xdd, 0x34, 0x1f, 0x1f, 0x01, 0x01,
-    0x35, 0x47, 0x12, 0x19, 0x19, 0x16, 0x15, 0x03, 0x04, 0x11, 0x0d, 0x83,
-    0x1a, 0x17, 0x18, 0x0a, 0x07, 0x03, 0x15, 0x0e, 0x03, 0x05, 0x0e, 0xb7,
-    0x14, 0x09, 0x05, 0x13, 0x80, 0x0d, 0x04, 0x07, 0x0e, 0xba, 0x18, 0x0d,
-    0x0d, 0x0d, 0x32, 0x07, 0x0a, 0x0d, 0x0a, 0x47, 0x2b, 0x01, 0x16, 0x15,
-    0x23, 0xde, 0x0f, 0x04, 0x03, 0x0e, 0x68, 0x13, 0x01, 0x0a, 0x09, 0x0c,
-    0x96, 0x0f, 0x04, 0x01, 0x0e, 0xa7, 0x13, 0x01, 0x01, 0x11, 0xca, 0x00,
-    0x00, 0x05, 0xff, 0xfc, 0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x3b,
-    0x00, 0x70, 0x00, 0x7c, 0x00, 0x89, 0x00, 0x95, 0x00, 0x00, 0x13, 0x36,
-    0x37, 0x16, 0x17, 0x15, 0x31, 0x16, 0x17, 0x16, 0x37, 0x36, 0x33, 0x16,
-    0x17, 0x16, 0x17, 0x16, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x37, 0x36, 0x33, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x23, 0x23, 0x22, 0x27, 0x26, 0x27, 0x27, 0x31, 0x26, 0x37, 0x36,
-    0x17, 0x17, 0x31, 0x16, 0x37, 0x36, 0x37, 0x35, 0x31, 0x11, 0x37, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x15, 0x31, 0x26, 0x27, 0x26, 0x07, 0x06,
-    0x07, 0x06, 0x17, 0x17, 0x31, 0x16, 0x17, 0x16, 0x33, 0x33, 0x33, 0x36,
-    0x37, 0x36, 0x37, 0x35, 0x31, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x22,
-    0x07, 0x26, 0x27, 0x22, 0x07, 0x26, 0x27, 0x22, 0x07, 0x35, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17,
-    0x36, 0x37, 0x35, 0x37, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37,
-    0x35, 0x31, 0x26, 0x27, 0x17, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x16,
-    0x17, 0x36, 0x37, 0x35, 0xa0, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x10,
-    0x0b, 0x05, 0x08, 0x0f, 0x01, 0x01, 0x0f, 0x11, 0x0a, 0x05, 0x08, 0x0d,
-    0x03, 0x03, 0x0c, 0x0c, 0x0b, 0x04, 0x06, 0x0f, 0x01, 0x01, 0x14, 0x14,
-    0x1f, 0x38, 0x3d, 0x1c, 0x18, 0x19, 0x10, 0x43, 0x07, 0x0b, 0x0d, 0x09,
-    0x27, 0x0a, 0x11, 0x10, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x10, 0x17,
-    0x18, 0x14, 0x17, 0x05, 0x05, 0x0f, 0x43, 0x17, 0x23, 0x23, 0x28, 0x01,
-    0x74, 0x33, 0x22, 0x22, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x07, 0x06, 0x13,
-    0x20, 0x0a, 0x0a, 0x12, 0x22, 0x04, 0x04, 0x01, 0x12, 0x12, 0x1b, 0x30,
-    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x30, 0x0f, 0x01, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x50, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0x88, 0x11, 0x06, 0x04,
-    0x0c, 0x07, 0x01, 0x0f, 0x11, 0x06, 0x04, 0x0c, 0x07, 0x01, 0x0c, 0x0d,
-    0x05, 0x04, 0x07, 0x04, 0x02, 0x0e, 0x10, 0x68, 0x1f, 0x14, 0x14, 0x01,
-    0x0d, 0x0d, 0x18, 0x65, 0x0d, 0x09, 0x07, 0x0b, 0x3a, 0x0e, 0x04, 0x06,
-    0x11, 0x14, 0x01, 0x00, 0x40, 0x01, 0x12, 0x12, 0x1b, 0xc6, 0x12, 0x03,
-    0x04, 0x0e, 0x0f, 0x19, 0x1a, 0x17, 0x65, 0x21, 0x13, 0x13, 0x01, 0x22,
-    0x22, 0x33, 0x68, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x18, 0x01, 0x03,
-    0x1a, 0x01, 0x01, 0x61, 0x1b, 0x12, 0x12, 0x01, 0xfe, 0xd0, 0x0f, 0x01,
-    0x01, 0x0f, 0x60, 0x0f, 0x01, 0x01, 0x0f, 0x60, 0x10, 0x01, 0x0f, 0x60,
-    0x0f, 0x01, 0x01, 0x0f, 0x60, 0x0f, 0x01, 0x10, 0x0f, 0x01, 0x01, 0x0f,
-    0x60, 0x0f, 0x01, 0x01, 0x0f, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1c,
-    0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc1, 0x00, 0x3c, 0x00, 0x52, 0x00, 0x60,
-    0x00, 0x6e, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0x00, 0x13, 0x26, 0x07, 0x31,
-    0x31, 0x06, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x27, 0x26, 0x07, 0x06,
-    0x07, 0x06, 0x17, 0x17, 0x31, 0x06, 0x07, 0x31, 0x31, 0x15, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x35,
-    0x31, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x22, 0x07, 0x26, 0x27, 0x22,
-    0x31, 0x22, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26, 0x27, 0x15, 0x06, 0x15,
-    0x15, 0x31, 0x14, 0x31, 0x14, 0x31, 0x26, 0x23, 0x23, 0x31, 0x27, 0x31,
-    0x37, 0x31, 0x36, 0x33, 0x16, 0x15, 0x07, 0x27, 0x17, 0x27, 0x17, 0x23,
-    0x31, 0x22, 0x07, 0x27, 0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x36, 0x37,
-    0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35, 0x17,
-    0x16, 0x17, 0x32, 0x37, 0x15, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x35, 0x31, 0x31, 0x31, 0x34, 0x37, 0x36, 0x33,
-    0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x06, 0x07, 0x16, 0x17,
-    0x33, 0x31, 0x36, 0x37, 0x36, 0x37, 0x34, 0x31, 0x34, 0x31, 0x16, 0x33,
-    0x32, 0x37, 0x37, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x35, 0x31, 0x36,
-    0x37, 0x16, 0x17, 0x15, 0x31, 0x15, 0xfb, 0x1b, 0x14, 0x14, 0x03, 0x07,
-    0x11, 0x0a, 0x17, 0x17, 0x1a, 0x19, 0x0b, 0x0b, 0x08, 0x35, 0x18, 0x01,
-    0x02, 0x2f, 0x30, 0x47, 0x30, 0x47, 0x30, 0x2f, 0x02, 0x01, 0x12, 0x12,
-    0x1b, 0x0c, 0x0a, 0x12, 0x28, 0x01, 0x01, 0x06, 0x02, 0x10, 0x10, 0x1b,
-    0x0b, 0x08, 0x08, 0x07, 0x06, 0x11, 0x03, 0x0f, 0x0e, 0x09, 0x8c, 0x37,
-    0x37, 0x37, 0x16, 0x06, 0x06, 0x33, 0x03, 0x0d, 0x0e, 0x06, 0xb1, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x26, 0x12, 0x28, 0x08, 0x08,
-    0x01, 0x22, 0x22, 0x33, 0x30, 0x33, 0x22, 0x22, 0x01, 0x09, 0x09, 0x0e,
-    0x50, 0x0f, 0x01, 0x01, 0x0f, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x1b,
-    0x12, 0x12, 0x01, 0x08, 0x08, 0x0c, 0x0a, 0x4a, 0x01, 0x0f, 0x0f, 0x01,
-    0x01, 0x0f, 0x0f, 0x01, 0x01, 0xbf, 0x02, 0x10, 0x10, 0x1b, 0x3d, 0x31,
-    0x1a, 0x0b, 0x0b, 0x09, 0x09, 0x17, 0x17, 0x1a, 0x96, 0x17, 0x23, 0x18,
-    0x47, 0x30, 0x2f, 0x02, 0x02, 0x2f, 0x30, 0x47, 0x48, 0x10, 0x20, 0x1b,
-    0x12, 0x12, 0x01, 0x04, 0x22, 0x02, 0x38, 0x1b, 0x14, 0x14, 0x04, 0x9c,
-    0x0f, 0x14, 0x30, 0x01, 0x01, 0x02, 0x0f, 0xa2, 0x0e, 0x03, 0x0f, 0x5a,
-    0x47, 0x9a, 0x9a, 0x9a, 0x01, 0x91, 0x0e, 0x06, 0x04, 0x0e, 0x6a, 0x0f,
-    0x01, 0x01, 0x0f, 0x20, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x30, 0x6c, 0x22,
-    0x02, 0x02, 0x0a, 0x33, 0x22, 0x22, 0x01, 0x01, 0x22, 0x22, 0x33, 0x18,
-    0x0e, 0x09, 0x09, 0x01, 0x0f, 0x0f, 0x01, 0x02, 0x16, 0x16, 0x02, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x01, 0x02, 0x04, 0x1c, 0x0f, 0x01, 0x01, 0x0f,
-    0x20, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x20, 0x10, 0x00, 0x04, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x55,
-    0x00, 0x64, 0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16,
-    0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x03, 0x15,
-    0x35, 0x15, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x33, 0x31,
-    0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27, 0x31, 0x36, 0x37, 0x26, 0x27,
-    0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x17, 0x35, 0x15, 0x35, 0x33, 0x31,
-    0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x23, 0x01, 0x00, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x60, 0x02, 0x16, 0x16, 0x02, 0x3d, 0x25, 0x0b, 0x15,
-    0x13, 0x07, 0x22, 0x22, 0x02, 0x01, 0x16, 0x17, 0x22, 0x58, 0x16, 0x02,
-    0x30, 0x40, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x40, 0x01, 0x90, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x68, 0x70,
-    0x70, 0x70, 0x60, 0x16, 0x02, 0x02, 0x16, 0x48, 0x52, 0x13, 0x07, 0x0b,
-    0x15, 0x4b, 0x17, 0x2c, 0x22, 0x17, 0x16, 0x01, 0x02, 0x16, 0x58, 0x40,
-    0x40, 0x40, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x33, 0x00, 0x40, 0x00, 0x61,
-    0x00, 0x00, 0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x15, 0x31, 0x15, 0x31, 0x11, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x35, 0x31, 0x35,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x06,
-    0x07, 0x15, 0x31, 0x23, 0x31, 0x35, 0x07, 0x21, 0x21, 0x21, 0x11, 0x31,
-    0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x11, 0x17, 0x06, 0x07, 0x15, 0x31,
-    0x23, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31, 0x15, 0x31, 0x16, 0x17,
-    0x36, 0x37, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31,
-    0x35, 0x31, 0x26, 0x27, 0x98, 0x02, 0x16, 0x16, 0x02, 0x28, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01,
-    0x01, 0x12, 0x12, 0x1b, 0x28, 0x02, 0x16, 0x16, 0x02, 0x90, 0x68, 0x01,
-    0x60, 0xfe, 0xa0, 0x01, 0x60, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0xb0,
-    0x16, 0x02, 0x30, 0x16, 0x02, 0x02, 0x16, 0x30, 0x02, 0x16, 0x16, 0x02,
-    0x30, 0x16, 0x02, 0x02, 0x16, 0x30, 0x02, 0x16, 0x01, 0xa8, 0x16, 0x02,
-    0x02, 0x16, 0x28, 0x01, 0x12, 0x12, 0x1b, 0x10, 0x30, 0xff, 0x00, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x30, 0x10, 0x1b,
-    0x12, 0x12, 0x01, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x28, 0xa8, 0xff,
-    0x00, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x28, 0x02, 0x16, 0x30, 0x02,
-    0x16, 0x16, 0x02, 0x30, 0x16, 0x02, 0x02, 0x16, 0x30, 0x02, 0x16, 0x16,
-    0x02, 0x30, 0x16, 0x02, 0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0,
-    0x01, 0xc0, 0x00, 0x34, 0x00, 0x41, 0x00, 0x4f, 0x00, 0x00, 0x13, 0x16,
-    0x17, 0x15, 0x31, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15,
-    0x31, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x11,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x31, 0x35, 0x31, 0x35, 0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x35,
-    0x31, 0x36, 0x37, 0x05, 0x21, 0x21, 0x21, 0x11, 0x31, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x11, 0x07, 0x23, 0x33, 0x23, 0x26, 0x27, 0x36, 0x37,
-    0x33, 0x31, 0x16, 0x17, 0x06, 0x07, 0x80, 0x16, 0x02, 0x90, 0x02, 0x16,
-    0x16, 0x02, 0x28, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe,
-    0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x28, 0x02, 0x16,
-    0x01, 0x10, 0xfe, 0xa0, 0x01, 0x60, 0xfe, 0xa0, 0x01, 0x0f, 0x01, 0x40,
-    0x0f, 0x01, 0x68, 0x90, 0x90, 0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16,
-    0x02, 0x02, 0x16, 0x01, 0xc0, 0x02, 0x16, 0x28, 0x28, 0x16, 0x02, 0x02,
-    0x16, 0x28, 0x01, 0x12, 0x12, 0x1b, 0x10, 0x30, 0xff, 0x00, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x30, 0x10, 0x1b, 0x12,
-    0x12, 0x01, 0x28, 0x16, 0x02, 0xc0, 0xff, 0x00, 0x0f, 0x01, 0x01, 0x0f,
-    0x01, 0x00, 0xa0, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x34,
-    0x00, 0x41, 0x00, 0x63, 0x00, 0x00, 0x13, 0x16, 0x17, 0x15, 0x31, 0x33,
-    0x31, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x33, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x35, 0x31, 0x35,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37, 0x05,
-    0x21, 0x21, 0x21, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11,
-    0x07, 0x07, 0x37, 0x07, 0x17, 0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x31,
-    0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x37,
-    0x36, 0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x80, 0x16,
-    0x02, 0x90, 0x02, 0x16, 0x16, 0x02, 0x28, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0x28, 0x02, 0x16, 0x01, 0x10, 0xfe, 0xa0, 0x01, 0x60, 0xfe, 0xa0,
-    0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x5f, 0x2f, 0x2f, 0x2f, 0x2f, 0x0e,
-    0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e,
-    0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x01, 0xc0, 0x02,
-    0x16, 0x28, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x01, 0x12, 0x12, 0x1b,
-    0x10, 0x30, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x00, 0x30, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x28, 0x16, 0x02, 0xc0,
-    0xff, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x59, 0x2f, 0x2f, 0x2f,
-    0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x11, 0x11, 0x2f,
-    0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x11, 0x11, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x34,
-    0x00, 0x41, 0x00, 0x55, 0x00, 0x00, 0x13, 0x16, 0x17, 0x15, 0x31, 0x33,
-    0x31, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x15, 0x31, 0x33, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x15, 0x31, 0x15, 0x31, 0x11, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x35, 0x31, 0x35,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37, 0x05,
-    0x21, 0x21, 0x21, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11,
-    0x07, 0x07, 0x37, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x37, 0x36, 0x17,
-    0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x80, 0x16, 0x02, 0x90,
-    0x02, 0x16, 0x16, 0x02, 0x28, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x28,
-    0x02, 0x16, 0x01, 0x10, 0xfe, 0xa0, 0x01, 0x60, 0xfe, 0xa0, 0x01, 0x0f,
-    0x01, 0x40, 0x0f, 0x01, 0x47, 0x70, 0x70, 0x70, 0x11, 0x11, 0x40, 0x0e,
-    0x0e, 0x11, 0x11, 0x2f, 0x5f, 0x11, 0x11, 0x0e, 0x0e, 0x01, 0xc0, 0x02,
-    0x16, 0x28, 0x28, 0x16, 0x02, 0x02, 0x16, 0x28, 0x01, 0x12, 0x12, 0x1b,
-    0x10, 0x30, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x01, 0x00, 0x30, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x28, 0x16, 0x02, 0xc0,
-    0xff, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x69, 0x70, 0x70, 0x70,
-    0x0e, 0x0e, 0x40, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x5f, 0x0e, 0x0e, 0x11,
-    0x11, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xdd, 0x02, 0x40,
-    0x01, 0xa3, 0x00, 0x20, 0x00, 0x29, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x00,
-    0x01, 0x16, 0x15, 0x11, 0x31, 0x06, 0x07, 0x07, 0x31, 0x06, 0x27, 0x27,
-    0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x35, 0x11, 0x31, 0x36, 0x37, 0x37,
-    0x31, 0x36, 0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x05, 0x11, 0x11,
-    0x11, 0x37, 0x31, 0x11, 0x31, 0x07, 0x01, 0x11, 0x11, 0x11, 0x27, 0x31,
-    0x11, 0x31, 0x17, 0x37, 0x37, 0x07, 0x37, 0x11, 0x31, 0x07, 0x31, 0x11,
-    0x02, 0x36, 0x0a, 0x01, 0x0e, 0xa8, 0x09, 0x08, 0xb7, 0xa0, 0x0c, 0x0b,
-    0x0a, 0x01, 0x0f, 0xa8, 0x08, 0x08, 0xb8, 0xa0, 0x0b, 0x0b, 0xfd, 0xfa,
-    0x78, 0x78, 0x01, 0x38, 0x90, 0x90, 0x30, 0x78, 0x78, 0x78, 0x78, 0x01,
-    0x9c, 0x08, 0x0c, 0xfe, 0xb0, 0x10, 0x06, 0x40, 0x03, 0x02, 0x3d, 0x3d,
-    0x04, 0x07, 0x08, 0x0c, 0x01, 0x50, 0x10, 0x06, 0x40, 0x03, 0x02, 0x3e,
-    0x3d, 0x05, 0x07, 0x65, 0xfe, 0xe4, 0x01, 0x1c, 0xfe, 0xe4, 0x2d, 0x01,
-    0x1d, 0x2e, 0xfe, 0xe2, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0x1e, 0x30, 0xfe,
-    0xe2, 0x30, 0x02, 0x2d, 0x2d, 0x2d, 0x01, 0x1d, 0x2e, 0xfe, 0xe4, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xbe, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1d,
-    0x00, 0x4e, 0x00, 0x00, 0x37, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x15,
-    0x31, 0x37, 0x31, 0x36, 0x33, 0x33, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26,
-    0x27, 0x21, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x33, 0x17, 0x31,
-    0x31, 0x31, 0x07, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x35, 0x35, 0x31,
-    0x35, 0x31, 0x31, 0x31, 0x35, 0x31, 0x35, 0x31, 0x23, 0x23, 0x26, 0x27,
-    0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17,
-    0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x07, 0xa0,
-    0x14, 0x0e, 0x0d, 0x01, 0x49, 0x0c, 0x10, 0x8b, 0x0f, 0x01, 0x01, 0x0f,
-    0xfe, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0x60, 0x30, 0x05, 0x11, 0x08, 0x09,
-    0x09, 0x30, 0x30, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x8b, 0x65, 0x50,
-    0x01, 0x0d, 0x0e, 0x14, 0x10, 0x36, 0x0a, 0x01, 0x0f, 0x01, 0x20, 0x0f,
-    0x01, 0x01, 0x0f, 0xfe, 0xe0, 0x0f, 0x01, 0x7c, 0x04, 0x0d, 0x05, 0x04,
-    0x04, 0x0a, 0x15, 0x07, 0x04, 0x30, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x20,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xe0, 0x1b, 0x12,
-    0x12, 0x01, 0x4c, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x43, 0x00, 0x51, 0x00, 0x00,
-    0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36,
-    0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33,
-    0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x37, 0x15, 0x35, 0x15, 0x06, 0x07,
-    0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x33, 0x15, 0x35, 0x15,
-    0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x01, 0xd0,
-    0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xe0, 0x02,
-    0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x70, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f,
-    0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x48, 0x90, 0x90,
-    0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x90,
-    0x90, 0x16, 0x02, 0x02, 0x16, 0x90, 0x16, 0x02, 0x02, 0x16, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4f, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x37, 0x33, 0x23, 0x33, 0x32, 0x17, 0x16, 0x15, 0x15, 0x31, 0x14, 0x07,
-    0x06, 0x23, 0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x34, 0x37,
-    0x36, 0x33, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31,
-    0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c,
-    0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22,
-    0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22,
-    0x21, 0x01, 0xc0, 0x80, 0x80, 0x80, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x80, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0xc0, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x60, 0x09, 0x09, 0x0e, 0x80, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x80,
-    0x0e, 0x09, 0x09, 0x00, 0x00, 0x02, 0x00, 0x0c, 0xff, 0xc0, 0x01, 0xf0,
-    0x01, 0xc0, 0x00, 0x29, 0x00, 0x36, 0x00, 0x00, 0x13, 0x36, 0x37, 0x26,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x15, 0x31, 0x15,
-    0x31, 0x11, 0x31, 0x15, 0x31, 0x15, 0x31, 0x33, 0x31, 0x35, 0x31, 0x21,
-    0x31, 0x36, 0x37, 0x34, 0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x35, 0x26,
-    0x27, 0x21, 0x03, 0x11, 0x11, 0x11, 0x21, 0x31, 0x07, 0x31, 0x06, 0x17,
-    0x17, 0x31, 0x21, 0x5c, 0x17, 0x01, 0x01, 0x0e, 0x0f, 0x16, 0x16, 0x0f,
-    0x0e, 0x01, 0x01, 0x13, 0x30, 0x01, 0x86, 0x18, 0x02, 0x02, 0x3e, 0x3e,
-    0x02, 0x02, 0x18, 0xfe, 0x86, 0x0c, 0x01, 0x64, 0x30, 0x08, 0x08, 0x30,
-    0xfe, 0x9c, 0x01, 0x60, 0x0f, 0x1d, 0x16, 0x0f, 0x0e, 0x01, 0x01, 0x0e,
-    0x0f, 0x16, 0x1a, 0x0f, 0x03, 0x30, 0xff, 0x00, 0x30, 0x40, 0x40, 0x02,
-    0x18, 0x06, 0x05, 0x8b, 0x8b, 0x05, 0x06, 0x18, 0x02, 0xfe, 0xd0, 0x01,
-    0x00, 0xff, 0x00, 0x01, 0x00, 0x6d, 0x13, 0x14, 0x6c, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0xff, 0xfc, 0x02, 0x80, 0x01, 0x80, 0x00, 0x83,
-    0x00, 0xa6, 0x00, 0xaf, 0x00, 0xb8, 0x00, 0x00, 0x01, 0x07, 0x37, 0x07,
-    0x06, 0x07, 0x07, 0x31, 0x06, 0x23, 0x23, 0x31, 0x15, 0x31, 0x16, 0x17,
-    0x17, 0x31, 0x17, 0x31, 0x31, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x36, 0x17, 0x17, 0x31, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35,
-    0x36, 0x37, 0x36, 0x17, 0x16, 0x37, 0x36, 0x27, 0x27, 0x31, 0x07, 0x31,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x34, 0x37, 0x37, 0x31, 0x36, 0x37,
-    0x16, 0x17, 0x17, 0x31, 0x33, 0x33, 0x16, 0x17, 0x15, 0x31, 0x14, 0x07,
-    0x06, 0x23, 0x23, 0x31, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x27,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x27, 0x06, 0x27, 0x26, 0x27, 0x27, 0x31,
-    0x27, 0x31, 0x27, 0x31, 0x26, 0x27, 0x14, 0x07, 0x06, 0x23, 0x23, 0x31,
-    0x22, 0x27, 0x26, 0x35, 0x35, 0x31, 0x36, 0x37, 0x33, 0x33, 0x32, 0x37,
-    0x37, 0x31, 0x36, 0x37, 0x33, 0x31, 0x32, 0x17, 0x05, 0x35, 0x15, 0x35,
-    0x23, 0x31, 0x22, 0x27, 0x27, 0x31, 0x26, 0x23, 0x06, 0x07, 0x07, 0x31,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x37, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07,
-    0x23, 0x31, 0x17, 0x31, 0x16, 0x17, 0x33, 0x05, 0x26, 0x27, 0x06, 0x07,
-    0x16, 0x17, 0x36, 0x37, 0x05, 0x36, 0x37, 0x26, 0x27, 0x06, 0x07, 0x16,
-    0x17, 0x01, 0x10, 0x33, 0x33, 0x33, 0x17, 0x12, 0x1b, 0x10, 0x15, 0x14,
-    0x20, 0x16, 0x24, 0x07, 0x1b, 0x0b, 0x0c, 0x02, 0x01, 0x05, 0x0d, 0x0c,
-    0x0a, 0x0b, 0x09, 0x0b, 0x0c, 0x09, 0x09, 0x01, 0x0d, 0x0c, 0x0c, 0x10,
-    0x0f, 0x0e, 0x0e, 0x4c, 0x24, 0x15, 0x1b, 0x1b, 0x16, 0x17, 0x01, 0x17,
-    0x46, 0x2b, 0x3a, 0x38, 0x2a, 0x1e, 0x27, 0x50, 0x0f, 0x01, 0x09, 0x09,
-    0x0e, 0x20, 0x13, 0x09, 0x55, 0x05, 0x08, 0x1c, 0x23, 0x06, 0x09, 0x15,
-    0x1c, 0x1b, 0x18, 0x14, 0x18, 0x18, 0x12, 0x1b, 0x07, 0x24, 0x08, 0x0c,
-    0x09, 0x09, 0x0e, 0x20, 0x0e, 0x09, 0x09, 0x01, 0x0f, 0x28, 0x3c, 0x03,
-    0x02, 0x1b, 0x2b, 0x3a, 0x0a, 0x07, 0x06, 0x01, 0x10, 0x30, 0x09, 0x07,
-    0x25, 0x1c, 0x26, 0x27, 0x1d, 0x46, 0x08, 0x08, 0x11, 0x10, 0x48, 0x11,
-    0x10, 0x0e, 0x0f, 0x01, 0x4b, 0x0f, 0x04, 0x4b, 0xfe, 0x20, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x02, 0x10, 0x0f, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0x01, 0x0f, 0x01, 0x7f, 0x33, 0x33, 0x33, 0x06, 0x10, 0x18,
-    0x0e, 0x80, 0x01, 0x16, 0x24, 0x07, 0x1b, 0x09, 0x09, 0x03, 0x03, 0x0c,
-    0x03, 0x03, 0x09, 0x0b, 0x09, 0x09, 0x08, 0x0b, 0x0e, 0x07, 0x05, 0x07,
-    0x0a, 0x0c, 0x11, 0x11, 0x4c, 0x21, 0x13, 0x12, 0x17, 0x1e, 0x1e, 0x18,
-    0x42, 0x27, 0x01, 0x01, 0x24, 0x1b, 0x01, 0x0f, 0xd0, 0x0e, 0x09, 0x09,
-    0x01, 0x0f, 0x0a, 0x09, 0x19, 0x05, 0x0b, 0x09, 0x14, 0x03, 0x02, 0x11,
-    0x10, 0x01, 0x01, 0x12, 0x1b, 0x07, 0x24, 0x08, 0x01, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0xd0, 0x0f, 0x01, 0x02, 0x18, 0x25, 0x01, 0x01, 0xff,
-    0x90, 0x90, 0x90, 0x06, 0x21, 0x19, 0x01, 0x1a, 0x42, 0x08, 0x0a, 0x0b,
-    0x07, 0x0c, 0x0c, 0x43, 0x0d, 0x0f, 0x11, 0x11, 0x4b, 0x0f, 0x14, 0x10,
-    0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x01, 0x0f, 0x0f,
-    0x01, 0x01, 0x0f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x19, 0x00, 0x2c, 0x00, 0x47,
-    0x00, 0x00, 0x13, 0x32, 0x31, 0x30, 0x33, 0x30, 0x31, 0x17, 0x31, 0x16,
-    0x15, 0x15, 0x31, 0x07, 0x31, 0x06, 0x23, 0x22, 0x27, 0x27, 0x31, 0x35,
-    0x31, 0x34, 0x37, 0x37, 0x07, 0x17, 0x27, 0x17, 0x16, 0x33, 0x32, 0x37,
-    0x37, 0x31, 0x15, 0x31, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x35, 0x13,
-    0x22, 0x07, 0x07, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17,
-    0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x27, 0x31,
-    0x26, 0x23, 0xff, 0x01, 0x01, 0xcc, 0x03, 0xac, 0x11, 0x13, 0x14, 0x10,
-    0xac, 0x03, 0xcc, 0xcf, 0x8e, 0x8e, 0x8e, 0x1e, 0x24, 0x24, 0x1e, 0x8e,
-    0x01, 0x07, 0xfe, 0x70, 0x07, 0x01, 0xd0, 0x10, 0x0c, 0xcc, 0x17, 0x01,
-    0x01, 0x0f, 0x10, 0x18, 0x01, 0x90, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x16,
-    0xcc, 0x0d, 0x10, 0x01, 0x90, 0x92, 0x02, 0x05, 0x0d, 0x8e, 0x0c, 0x0c,
-    0x8e, 0x0d, 0x05, 0x02, 0x92, 0xe4, 0x75, 0x75, 0x75, 0x17, 0x17, 0x75,
-    0xb4, 0x07, 0x01, 0x01, 0x07, 0xb4, 0x01, 0x14, 0x09, 0x92, 0x11, 0x1d,
-    0xff, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x18, 0xff, 0x1d, 0x11,
-    0x92, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x20, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x36, 0x00, 0x48, 0x00, 0x54,
-    0x00, 0x61, 0x00, 0x6d, 0x00, 0x00, 0x01, 0x16, 0x17, 0x11, 0x31, 0x06,
-    0x07, 0x21, 0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x21, 0x25, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x26, 0x27, 0x21,
-    0x13, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16,
-    0x17, 0x07, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x23, 0x25, 0x26, 0x27, 0x06, 0x07,
-    0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x07, 0x06, 0x07, 0x15, 0x31,
-    0x16, 0x17, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x17, 0x26, 0x27, 0x06,
-    0x07, 0x15, 0x31, 0x16, 0x17, 0x36, 0x37, 0x35, 0x01, 0x80, 0x0f, 0x01,
-    0x01, 0x0f, 0xfe, 0xe0, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x20, 0xfe, 0xe0,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x20, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xe0, 0x90, 0x24, 0x13, 0x12,
-    0x12, 0x13, 0x24, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x20, 0x22, 0x17,
-    0x16, 0x01, 0x01, 0x0f, 0xc0, 0x0f, 0x01, 0x01, 0x16, 0x17, 0x22, 0x40,
-    0x01, 0x30, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x01, 0x0f, 0x0f, 0x01,
-    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x90, 0x01, 0x0f, 0xfe, 0x80, 0x0f, 0x01,
-    0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x30, 0x01, 0x12, 0x12, 0x1b, 0xfe,
-    0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b,
-    0x12, 0x12, 0x01, 0xff, 0x00, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01,
-    0x1f, 0x20, 0x20, 0x1f, 0x01, 0x20, 0x01, 0x16, 0x17, 0x22, 0x0f, 0x01,
-    0x01, 0x0f, 0x22, 0x17, 0x16, 0x01, 0xd0, 0x0f, 0x01, 0x01, 0x0f, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0x40, 0x70, 0x01, 0x0f, 0x40, 0x0f, 0x01, 0x01,
-    0x0f, 0x40, 0x0f, 0x01, 0x90, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0x0f, 0x01,
-    0x01, 0x0f, 0x40, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x40,
-    0x01, 0xa0, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x36, 0x00, 0x48, 0x00, 0x54,
-    0x00, 0x60, 0x00, 0x00, 0x01, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x21,
-    0x31, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x21, 0x25, 0x06, 0x07, 0x31,
-    0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x26, 0x27, 0x21, 0x17, 0x36,
-    0x37, 0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x07,
-    0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37,
-    0x26, 0x27, 0x26, 0x27, 0x23, 0x37, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x36, 0x37, 0x26, 0x27, 0x23, 0x15, 0x06, 0x07, 0x16, 0x17, 0x33, 0x31,
-    0x36, 0x37, 0x26, 0x27, 0x23, 0x02, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0xfe,
-    0x40, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0xc0, 0xfe, 0x40, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xfe, 0x40, 0x90, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24,
-    0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x20, 0x22, 0x17, 0x16, 0x01, 0x01,
-    0x0f, 0xc0, 0x0f, 0x01, 0x01, 0x16, 0x17, 0x22, 0x40, 0xc8, 0x16, 0x02,
-    0x02, 0x16, 0x50, 0x16, 0x02, 0x02, 0x16, 0x50, 0x16, 0x02, 0x02, 0x16,
-    0x50, 0x16, 0x02, 0x02, 0x16, 0x50, 0x01, 0x70, 0x01, 0x0f, 0xfe, 0xc0,
-    0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x30, 0x01, 0x12, 0x12,
-    0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0x40, 0x1b, 0x12, 0x12, 0x01, 0xe0, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01,
-    0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x20, 0x01, 0x16, 0x17, 0x22, 0x0f,
-    0x01, 0x01, 0x0f, 0x22, 0x17, 0x16, 0x01, 0x90, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x60, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x18, 0x00, 0x27, 0x00, 0x42, 0x00, 0x4f, 0x00, 0x5c,
-    0x00, 0x00, 0x25, 0x26, 0x27, 0x31, 0x31, 0x26, 0x27, 0x23, 0x31, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16,
-    0x17, 0x06, 0x07, 0x07, 0x06, 0x07, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37,
-    0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06,
-    0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x11, 0x26, 0x27,
-    0x26, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x27, 0x16,
-    0x17, 0x16, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x01,
-    0x97, 0x0f, 0x20, 0x1f, 0x29, 0x40, 0x29, 0x1f, 0x20, 0x0e, 0x38, 0x02,
-    0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x37, 0x29, 0x30,
-    0x3e, 0x3e, 0x30, 0x06, 0x15, 0x15, 0x1e, 0x40, 0x1e, 0x15, 0x15, 0x07,
-    0x6f, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x17, 0x0c, 0x0a,
-    0x0a, 0x0c, 0x17, 0x17, 0x0c, 0x0a, 0x0a, 0x0c, 0x17, 0x58, 0x02, 0x2a,
-    0x2c, 0x2c, 0x2a, 0x02, 0x02, 0x2a, 0x2c, 0x2c, 0x2a, 0x02, 0x30, 0x24,
-    0x16, 0x15, 0x01, 0x01, 0x15, 0x16, 0x24, 0x3a, 0x56, 0x58, 0x3b, 0x3b,
-    0x02, 0x02, 0x3b, 0x3b, 0x58, 0x56, 0x3a, 0x20, 0x1f, 0x01, 0x01, 0x1f,
-    0x1c, 0x12, 0x11, 0x01, 0x01, 0x11, 0x12, 0x1c, 0x50, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x10, 0x01,
-    0x13, 0x14, 0x14, 0x13, 0x01, 0x01, 0x13, 0x14, 0x14, 0x13, 0x01, 0x28,
-    0x32, 0x1a, 0x18, 0x18, 0x1a, 0x32, 0x32, 0x1a, 0x18, 0x18, 0x1a, 0x32,
-    0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x20,
-    0x00, 0x3a, 0x00, 0x4c, 0x00, 0x59, 0x00, 0x00, 0x01, 0x15, 0x35, 0x15,
-    0x14, 0x07, 0x06, 0x23, 0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x35, 0x31,
-    0x23, 0x31, 0x06, 0x07, 0x11, 0x31, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37,
-    0x11, 0x31, 0x26, 0x27, 0x23, 0x05, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07,
-    0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x13, 0x33, 0x23, 0x33, 0x16,
-    0x17, 0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27, 0x36, 0x37, 0x36,
-    0x37, 0x27, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x27,
-    0x26, 0x27, 0x01, 0x00, 0x09, 0x09, 0x0e, 0x40, 0x0e, 0x09, 0x09, 0x40,
-    0x0f, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x0f, 0x01, 0x01, 0x0f, 0x40, 0xff,
-    0x00, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0xa0, 0x40, 0x40,
-    0x40, 0x22, 0x17, 0x16, 0x01, 0x01, 0x0f, 0xc0, 0x0f, 0x01, 0x01, 0x16,
-    0x17, 0x22, 0x20, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01, 0x1f, 0x20,
-    0x20, 0x1f, 0x01, 0x01, 0x90, 0x10, 0x10, 0x10, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x10, 0x01, 0x0f, 0xfe, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x80, 0x0f, 0x01, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80,
-    0xff, 0x00, 0x01, 0x16, 0x17, 0x22, 0x0f, 0x01, 0x01, 0x0f, 0x22, 0x17,
-    0x16, 0x01, 0x60, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x24, 0x13, 0x12,
-    0x12, 0x13, 0x24, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x40,
-    0x01, 0xa0, 0x00, 0x18, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x4b, 0x00, 0x57,
-    0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x26, 0x27,
-    0x11, 0x31, 0x21, 0x25, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x11, 0x31,
-    0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x11, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x21, 0x17, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07,
-    0x16, 0x17, 0x16, 0x37, 0x36, 0x37, 0x37, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x15, 0x06, 0x07, 0x16, 0x17, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x02, 0x10, 0x01, 0x0f, 0xc0, 0x01,
-    0x16, 0x17, 0x22, 0x40, 0x22, 0x17, 0x16, 0x01, 0x20, 0x0f, 0x01, 0x01,
-    0xe0, 0xfe, 0x30, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01,
-    0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x40, 0xd0,
-    0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01,
-    0x68, 0x16, 0x02, 0x02, 0x16, 0x50, 0x16, 0x02, 0x02, 0x16, 0x50, 0x16,
-    0x02, 0x02, 0x16, 0x50, 0x16, 0x02, 0x02, 0x16, 0x50, 0x01, 0x20, 0xff,
-    0x00, 0x01, 0x00, 0xff, 0x00, 0x0f, 0x01, 0x22, 0x17, 0x16, 0x01, 0x01,
-    0x16, 0x17, 0x22, 0x01, 0x0f, 0x01, 0x00, 0x80, 0x01, 0x12, 0x12, 0x1b,
-    0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40,
-    0x1b, 0x12, 0x12, 0x01, 0xe0, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x24,
-    0x13, 0x12, 0x12, 0x13, 0x24, 0x30, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16,
-    0x16, 0x02, 0x60, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x22,
-    0x00, 0x2f, 0x00, 0x00, 0x13, 0x14, 0x15, 0x15, 0x31, 0x15, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x35,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x21, 0x31, 0x22, 0x23, 0x06, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x17, 0x21, 0x21, 0x21, 0x15, 0x31, 0x06, 0x07, 0x21,
-    0x31, 0x26, 0x27, 0x35, 0x00, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x80, 0x03, 0x03, 0x0e,
-    0x0c, 0x10, 0x08, 0x06, 0x02, 0x30, 0x01, 0xa0, 0xfe, 0x60, 0x01, 0xa0,
-    0x01, 0x0f, 0xfe, 0x80, 0x0f, 0x01, 0x01, 0x66, 0x03, 0x03, 0x80, 0xc0,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xc0, 0x80, 0x1b, 0x12,
-    0x12, 0x01, 0x02, 0x07, 0x09, 0x10, 0x0b, 0x0d, 0x86, 0xc0, 0x0f, 0x01,
-    0x01, 0x0f, 0xc0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00,
-    0x00, 0x10, 0x00, 0x0b, 0x00, 0x00, 0x37, 0x06, 0x07, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x21, 0x18, 0x16, 0x02, 0x02, 0x16, 0x01,
-    0xd0, 0x16, 0x02, 0x02, 0x16, 0xfe, 0x30, 0x10, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x53, 0x00, 0x00, 0x01, 0x23,
-    0x33, 0x23, 0x22, 0x07, 0x06, 0x15, 0x15, 0x31, 0x23, 0x31, 0x35, 0x31,
-    0x36, 0x37, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31,
-    0x06, 0x07, 0x06, 0x07, 0x23, 0x31, 0x35, 0x31, 0x33, 0x31, 0x32, 0x37,
-    0x36, 0x35, 0x35, 0x31, 0x34, 0x27, 0x26, 0x23, 0x01, 0x16, 0x17, 0x21,
-    0x31, 0x36, 0x37, 0x35, 0x31, 0x21, 0x31, 0x15, 0x13, 0x21, 0x21, 0x21,
-    0x16, 0x17, 0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x01, 0xb0,
-    0xe0, 0xe0, 0xe0, 0x0e, 0x09, 0x09, 0x30, 0x01, 0x16, 0x17, 0x22, 0xe0,
-    0x22, 0x17, 0x16, 0x01, 0x01, 0x16, 0x17, 0x22, 0x10, 0x10, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0xfe, 0x80, 0x01, 0x0f, 0x01, 0x00, 0x0f, 0x01,
-    0xfe, 0xe0, 0x10, 0x01, 0x00, 0xff, 0x00, 0x01, 0x00, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x90, 0x09, 0x09, 0x0e, 0x10, 0x10, 0x22, 0x17,
-    0x16, 0x01, 0x01, 0x16, 0x17, 0x22, 0xe0, 0x22, 0x17, 0x16, 0x01, 0x30,
-    0x09, 0x09, 0x0e, 0xe0, 0x0e, 0x09, 0x09, 0xfe, 0x70, 0x0f, 0x01, 0x01,
-    0x0f, 0xc0, 0xc0, 0x01, 0x40, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x1b, 0x12, 0x12,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0xff, 0xc0, 0x01, 0xc4,
-    0x01, 0xc0, 0x00, 0xa8, 0x00, 0x00, 0x13, 0x16, 0x17, 0x15, 0x31, 0x37,
-    0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x15, 0x31, 0x37, 0x31, 0x37,
-    0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16,
-    0x07, 0x07, 0x31, 0x17, 0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x07,
-    0x31, 0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x17,
-    0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x17, 0x31, 0x16, 0x07, 0x06,
-    0x27, 0x27, 0x31, 0x27, 0x31, 0x15, 0x31, 0x17, 0x31, 0x16, 0x07, 0x06,
-    0x27, 0x27, 0x31, 0x15, 0x31, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x07,
-    0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x35, 0x31, 0x07, 0x31, 0x07,
-    0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26,
-    0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x37,
-    0x31, 0x27, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x27,
-    0x31, 0x26, 0x37, 0x36, 0x17, 0x17, 0x31, 0x27, 0x31, 0x26, 0x37, 0x36,
-    0x17, 0x17, 0x31, 0x17, 0x31, 0x35, 0x31, 0x27, 0x31, 0x26, 0x37, 0x36,
-    0x17, 0x17, 0x31, 0x35, 0x31, 0x36, 0x37, 0xe0, 0x16, 0x02, 0x17, 0x11,
-    0x11, 0x0e, 0x0e, 0x39, 0x42, 0x15, 0x08, 0x15, 0x15, 0x04, 0x08, 0x25,
-    0x14, 0x0d, 0x09, 0x12, 0x25, 0x20, 0x14, 0x03, 0x08, 0x16, 0x4e, 0x42,
-    0x42, 0x4e, 0x16, 0x07, 0x04, 0x15, 0x1f, 0x25, 0x12, 0x09, 0x0d, 0x14,
-    0x25, 0x08, 0x04, 0x15, 0x15, 0x08, 0x15, 0x42, 0x39, 0x0e, 0x0e, 0x11,
-    0x11, 0x17, 0x02, 0x16, 0x16, 0x02, 0x17, 0x11, 0x11, 0x0e, 0x0e, 0x39,
-    0x42, 0x15, 0x08, 0x15, 0x15, 0x04, 0x08, 0x25, 0x14, 0x0d, 0x09, 0x12,
-    0x25, 0x1f, 0x15, 0x04, 0x07, 0x16, 0x4e, 0x42, 0x42, 0x4e, 0x16, 0x07,
-    0x04, 0x15, 0x1f, 0x25, 0x12, 0x09, 0x0d, 0x14, 0x25, 0x08, 0x04, 0x15,
-    0x15, 0x08, 0x15, 0x42, 0x39, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x02, 0x16,
-    0x01, 0xc0, 0x02, 0x16, 0x2e, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x39, 0x4d,
-    0x27, 0x4d, 0x15, 0x04, 0x07, 0x16, 0x1f, 0x15, 0x09, 0x12, 0x14, 0x0c,
-    0x16, 0x08, 0x08, 0x16, 0x14, 0x03, 0x15, 0x26, 0x26, 0x15, 0x03, 0x14,
-    0x16, 0x08, 0x08, 0x16, 0x0c, 0x14, 0x12, 0x09, 0x15, 0x1f, 0x16, 0x08,
-    0x03, 0x14, 0x4e, 0x26, 0x4c, 0x39, 0x11, 0x11, 0x0e, 0x0e, 0x17, 0x2e,
-    0x16, 0x02, 0x02, 0x16, 0x2e, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x39, 0x4c,
-    0x26, 0x4e, 0x14, 0x03, 0x08, 0x16, 0x1f, 0x15, 0x09, 0x12, 0x14, 0x0c,
-    0x16, 0x08, 0x08, 0x16, 0x14, 0x03, 0x15, 0x26, 0x26, 0x15, 0x03, 0x14,
-    0x16, 0x08, 0x08, 0x16, 0x0c, 0x14, 0x12, 0x09, 0x15, 0x1f, 0x16, 0x08,
-    0x03, 0x14, 0x4e, 0x26, 0x4c, 0x39, 0x11, 0x11, 0x0e, 0x0e, 0x17, 0x2e,
-    0x16, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xc0, 0x01, 0xc0,
-    0x01, 0xc0, 0x00, 0x0d, 0x00, 0x37, 0x00, 0x48, 0x00, 0x56, 0x00, 0x64,
-    0x00, 0x72, 0x00, 0x00, 0x13, 0x07, 0x37, 0x07, 0x33, 0x31, 0x27, 0x31,
-    0x26, 0x23, 0x23, 0x31, 0x22, 0x07, 0x37, 0x17, 0x27, 0x17, 0x33, 0x33,
-    0x16, 0x17, 0x06, 0x07, 0x23, 0x31, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07,
-    0x23, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11, 0x31, 0x23, 0x31, 0x26, 0x27,
-    0x36, 0x37, 0x33, 0x33, 0x37, 0x31, 0x36, 0x37, 0x33, 0x31, 0x16, 0x17,
-    0x07, 0x11, 0x11, 0x11, 0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x32, 0x37,
-    0x36, 0x35, 0x11, 0x31, 0x21, 0x17, 0x15, 0x35, 0x15, 0x06, 0x07, 0x26,
-    0x27, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x33, 0x15, 0x35, 0x15, 0x06,
-    0x07, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0x33, 0x15, 0x35,
-    0x15, 0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37, 0x16, 0x17, 0xab,
-    0x13, 0x13, 0x13, 0x91, 0x13, 0x03, 0x04, 0x5e, 0x04, 0x03, 0x94, 0x24,
-    0x24, 0x24, 0x0e, 0x38, 0x16, 0x02, 0x02, 0x16, 0x08, 0x01, 0x16, 0x17,
-    0x22, 0xe0, 0x22, 0x17, 0x16, 0x01, 0x08, 0x16, 0x02, 0x02, 0x16, 0x08,
-    0x3e, 0x25, 0x11, 0x1d, 0x5e, 0x1d, 0x11, 0xed, 0x09, 0x09, 0x0e, 0xe0,
-    0x0e, 0x09, 0x09, 0xfe, 0xe0, 0x50, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f,
-    0x0f, 0x01, 0x50, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x50,
-    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x8c, 0x1c, 0x1c,
-    0x1c, 0x1c, 0x04, 0x04, 0x1b, 0x37, 0x37, 0x37, 0x02, 0x16, 0x16, 0x02,
-    0xfe, 0xd0, 0x22, 0x17, 0x16, 0x01, 0x01, 0x16, 0x17, 0x22, 0x01, 0x30,
-    0x02, 0x16, 0x16, 0x02, 0x37, 0x18, 0x01, 0x01, 0x18, 0x67, 0xfe, 0xd0,
-    0x01, 0x30, 0xfe, 0xd0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x01, 0x30,
-    0x40, 0xd0, 0xd0, 0xd0, 0x0f, 0x01, 0x01, 0x0f, 0xd0, 0x0f, 0x01, 0x01,
-    0x0f, 0xd0, 0xd0, 0xd0, 0x0f, 0x01, 0x01, 0x0f, 0xd0, 0x0f, 0x01, 0x01,
-    0x0f, 0xd0, 0xd0, 0xd0, 0x0f, 0x01, 0x01, 0x0f, 0xd0, 0x0f, 0x01, 0x01,
-    0x0f, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x40,
-    0x01, 0xa0, 0x00, 0x23, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x68, 0x00, 0x00,
-    0x13, 0x21, 0x21, 0x21, 0x16, 0x17, 0x15, 0x31, 0x06, 0x07, 0x23, 0x31,
-    0x27, 0x31, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31, 0x27, 0x31, 0x26, 0x23,
-    0x22, 0x07, 0x07, 0x31, 0x23, 0x31, 0x26, 0x27, 0x35, 0x31, 0x36, 0x37,
-    0x07, 0x15, 0x35, 0x15, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36, 0x37,
-    0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07,
-    0x06, 0x07, 0x07, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x26, 0x27, 0x21, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x35, 0x17, 0x34, 0x27, 0x31, 0x31, 0x26, 0x23, 0x22, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0xa0, 0x01, 0x60,
-    0xfe, 0xa0, 0x01, 0x60, 0x0f, 0x01, 0x01, 0x0f, 0x15, 0x67, 0x07, 0x0d,
-    0x0d, 0x07, 0x34, 0x0d, 0x07, 0x0c, 0x0c, 0x07, 0x45, 0x10, 0x0f, 0x01,
-    0x01, 0x0f, 0x40, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x60, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xa0, 0x1b, 0x12, 0x12, 0x01, 0x30,
-    0x02, 0x16, 0x16, 0x02, 0x01, 0x27, 0x26, 0x3a, 0x01, 0x40, 0x16, 0x02,
-    0x02, 0x16, 0xfe, 0xc0, 0x25, 0x19, 0x19, 0x01, 0xd0, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x01, 0x70, 0x01,
-    0x0f, 0xe0, 0x0f, 0x01, 0x9d, 0x0b, 0x0b, 0x50, 0x11, 0x0a, 0x0a, 0x5e,
-    0x01, 0x0f, 0xe0, 0x0f, 0x01, 0x10, 0xe0, 0xe0, 0xe0, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0xe0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x18, 0x16, 0x02, 0x02, 0x16, 0xe0, 0x3a, 0x26, 0x27, 0x01,
-    0x02, 0x16, 0x16, 0x02, 0x01, 0x19, 0x19, 0x25, 0xe0, 0x18, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x00,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x24,
-    0x00, 0x40, 0x00, 0x49, 0x00, 0x00, 0x01, 0x33, 0x23, 0x33, 0x16, 0x17,
-    0x16, 0x17, 0x11, 0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27,
-    0x26, 0x27, 0x11, 0x31, 0x36, 0x37, 0x36, 0x37, 0x33, 0x33, 0x36, 0x37,
-    0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x33, 0x07, 0x06, 0x07, 0x11, 0x31,
-    0x16, 0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x23, 0x31,
-    0x15, 0x31, 0x06, 0x07, 0x23, 0x23, 0x26, 0x27, 0x35, 0x31, 0x23, 0x37,
-    0x36, 0x37, 0x26, 0x27, 0x06, 0x07, 0x16, 0x17, 0x01, 0x18, 0x28, 0x28,
-    0x28, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x28, 0x0a, 0x06, 0x15, 0x15,
-    0x1e, 0x1e, 0x15, 0x15, 0x06, 0x0a, 0xd8, 0x0f, 0x01, 0x01, 0x0f, 0x01,
-    0x00, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x02, 0x16, 0x58, 0x58, 0x16, 0x02,
-    0x10, 0x80, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x01, 0x80,
-    0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12,
-    0x12, 0x1b, 0x01, 0x40, 0x1b, 0x12, 0x12, 0x01, 0x1c, 0x12, 0x11, 0x01,
-    0x01, 0x11, 0x12, 0x1c, 0x30, 0x01, 0x0f, 0xfe, 0xc0, 0x0f, 0x01, 0x01,
-    0x0f, 0x01, 0x40, 0x0f, 0x01, 0x18, 0x16, 0x02, 0x02, 0x16, 0x18, 0x08,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x57,
-    0x00, 0x00, 0x05, 0x22, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x07, 0x06, 0x23, 0x11, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x13, 0x36, 0x35, 0x26,
-    0x27, 0x23, 0x31, 0x35, 0x31, 0x34, 0x27, 0x26, 0x23, 0x23, 0x31, 0x22,
-    0x07, 0x06, 0x15, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x14, 0x17, 0x17,
-    0x31, 0x16, 0x33, 0x32, 0x37, 0x37, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x79, 0x07, 0x02, 0x14, 0x3a, 0x09, 0x09, 0x0e, 0x20, 0x0e, 0x09, 0x09,
-    0x3a, 0x14, 0x02, 0x07, 0x6b, 0x06, 0x08, 0x08, 0x06, 0x6b, 0x10, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x01, 0xd0, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xfe, 0xd9, 0x07,
-    0x0a, 0x14, 0x02, 0x60, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x60, 0x02,
-    0x14, 0x0a, 0x07, 0x63, 0x06, 0x06, 0x63, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x57,
-    0x00, 0x00, 0x37, 0x34, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32,
-    0x17, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x26, 0x35, 0x21, 0x26, 0x27, 0x31, 0x31, 0x26, 0x27,
-    0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17,
-    0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x37, 0x05, 0x16, 0x33, 0x36,
-    0x37, 0x35, 0x31, 0x33, 0x31, 0x32, 0x37, 0x36, 0x35, 0x35, 0x31, 0x34,
-    0x27, 0x26, 0x23, 0x23, 0x31, 0x35, 0x31, 0x26, 0x27, 0x22, 0x07, 0x07,
-    0x31, 0x06, 0x15, 0x14, 0x17, 0x17, 0x30, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x01, 0xd0, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0xfe, 0xd9, 0x07, 0x0a, 0x14, 0x02, 0x60,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x60, 0x02, 0x14, 0x0a, 0x07, 0x63,
-    0x06, 0x06, 0x63, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x79, 0x07, 0x02, 0x14,
-    0x3a, 0x09, 0x09, 0x0e, 0x20, 0x0e, 0x09, 0x09, 0x3a, 0x14, 0x02, 0x07,
-    0x6b, 0x06, 0x08, 0x08, 0x06, 0x6b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x57,
-    0x00, 0x00, 0x25, 0x14, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x32,
-    0x17, 0x16, 0x17, 0x16, 0x15, 0x21, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17,
-    0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x27,
-    0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x07, 0x25, 0x26, 0x23, 0x06,
-    0x07, 0x15, 0x31, 0x23, 0x31, 0x22, 0x07, 0x06, 0x15, 0x15, 0x31, 0x14,
-    0x17, 0x16, 0x33, 0x33, 0x31, 0x15, 0x31, 0x16, 0x17, 0x32, 0x37, 0x37,
-    0x31, 0x36, 0x35, 0x34, 0x27, 0x27, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37,
-    0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x27, 0x07, 0x0a, 0x14, 0x02,
-    0x60, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x60, 0x02, 0x14, 0x0a, 0x07,
-    0x63, 0x06, 0x06, 0x63, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f,
-    0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x79, 0x07, 0x02,
-    0x14, 0x3a, 0x09, 0x09, 0x0e, 0x20, 0x0e, 0x09, 0x09, 0x3a, 0x14, 0x02,
-    0x07, 0x6b, 0x06, 0x08, 0x08, 0x06, 0x6b, 0x00, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x57,
-    0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x03, 0x06, 0x15, 0x16,
-    0x17, 0x33, 0x31, 0x15, 0x31, 0x14, 0x17, 0x16, 0x33, 0x33, 0x31, 0x32,
-    0x37, 0x36, 0x35, 0x35, 0x31, 0x33, 0x31, 0x36, 0x37, 0x34, 0x27, 0x27,
-    0x31, 0x26, 0x23, 0x22, 0x07, 0x07, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x79, 0x07, 0x02, 0x14, 0x3a, 0x09, 0x09, 0x0e, 0x20, 0x0e, 0x09, 0x09,
-    0x3a, 0x14, 0x02, 0x07, 0x6b, 0x06, 0x08, 0x08, 0x06, 0x6b, 0x01, 0x90,
-    0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x27,
-    0x07, 0x0a, 0x14, 0x02, 0x60, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x60,
-    0x02, 0x14, 0x0a, 0x07, 0x63, 0x06, 0x06, 0x63, 0x00, 0x05, 0xff, 0xfb,
-    0xff, 0xe0, 0x02, 0x05, 0x01, 0xa8, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x14,
-    0x00, 0x1b, 0x00, 0x33, 0x00, 0x00, 0x13, 0x17, 0x27, 0x17, 0x37, 0x31,
-    0x23, 0x17, 0x07, 0x37, 0x07, 0x33, 0x31, 0x27, 0x17, 0x23, 0x33, 0x21,
-    0x17, 0x31, 0x37, 0x25, 0x33, 0x23, 0x33, 0x27, 0x31, 0x07, 0x05, 0x03,
-    0x13, 0x03, 0x06, 0x23, 0x22, 0x27, 0x03, 0x31, 0x26, 0x37, 0x37, 0x31,
-    0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x17, 0x31, 0x16, 0x07, 0xa9, 0x57,
-    0x57, 0x57, 0x58, 0xaf, 0xd7, 0x48, 0x48, 0x48, 0x81, 0x39, 0x32, 0xb2,
-    0xb2, 0xfe, 0x9c, 0xb2, 0xb2, 0xfe, 0x96, 0x81, 0x81, 0x81, 0x49, 0x38,
-    0x01, 0xb2, 0xe8, 0xe8, 0xe8, 0x07, 0x0b, 0x0b, 0x07, 0xe8, 0x0b, 0x0a,
-    0x70, 0x07, 0x0c, 0xf0, 0x0c, 0x07, 0x70, 0x0a, 0x0b, 0x01, 0x78, 0x5d,
-    0x5d, 0x5d, 0x5d, 0x1b, 0x4d, 0x4d, 0x4d, 0x4d, 0x7d, 0xc4, 0xc4, 0x30,
-    0x4d, 0x4d, 0x28, 0xff, 0x00, 0x01, 0x00, 0xff, 0x00, 0x08, 0x08, 0x01,
-    0x00, 0x0f, 0x0f, 0x98, 0x0a, 0x0a, 0x98, 0x0f, 0x0f, 0x00, 0x00, 0x00,
-    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x01, 0x80, 0x00, 0x19,
-    0x00, 0x33, 0x00, 0x4e, 0x00, 0x69, 0x00, 0x00, 0x13, 0x06, 0x07, 0x31,
-    0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17, 0x21, 0x31, 0x36,
-    0x37, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x21, 0x07, 0x36,
-    0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x17, 0x34, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16,
-    0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x26, 0x35, 0x37, 0x16, 0x17, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07,
-    0x16, 0x17, 0x33, 0x33, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31,
-    0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x70, 0x01, 0x12, 0x12, 0x1b, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x60, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12,
-    0x01, 0xfe, 0xa0, 0x70, 0x01, 0x12, 0x12, 0x1b, 0x01, 0xc0, 0x1b, 0x12,
-    0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0x40, 0x1b, 0x12, 0x12, 0x01,
-    0xb0, 0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a, 0x0f, 0x0f, 0x0f,
-    0x0f, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a, 0x0f, 0x0f, 0x50, 0x01, 0x0f,
-    0x08, 0x0f, 0x01, 0x01, 0x0f, 0x18, 0x18, 0x0f, 0x01, 0x01, 0x0f, 0x08,
-    0x01, 0x0f, 0x10, 0x0f, 0x01, 0x01, 0x50, 0x1b, 0x12, 0x12, 0x01, 0xa0,
-    0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0xa0, 0x01, 0x12, 0x12,
-    0x1b, 0x10, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xff, 0x00,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x00, 0x80, 0x1e,
-    0x1a, 0x1a, 0x0f, 0x0f, 0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x1e, 0x1a, 0x1a,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x1a, 0x1a, 0x1e, 0x30, 0x0f, 0x01, 0x40, 0x01,
-    0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x50, 0x0f, 0x01, 0x01, 0x0f,
-    0x00, 0x03, 0x00, 0x00, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x0f,
-    0x00, 0x29, 0x00, 0x4a, 0x00, 0x00, 0x13, 0x06, 0x07, 0x11, 0x31, 0x16,
-    0x17, 0x21, 0x31, 0x36, 0x37, 0x11, 0x31, 0x26, 0x27, 0x21, 0x07, 0x36,
-    0x37, 0x31, 0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x16, 0x17, 0x11,
-    0x31, 0x06, 0x07, 0x06, 0x07, 0x21, 0x31, 0x26, 0x27, 0x26, 0x27, 0x11,
-    0x17, 0x36, 0x17, 0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07,
-    0x31, 0x17, 0x31, 0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x07, 0x31, 0x06,
-    0x27, 0x26, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x37, 0x40, 0x0f, 0x01,
-    0x01, 0x0f, 0x01, 0x80, 0x0f, 0x01, 0x01, 0x0f, 0xfe, 0x80, 0x40, 0x01,
-    0x12, 0x12, 0x1b, 0x01, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12,
-    0x1b, 0xfe, 0x80, 0x1b, 0x12, 0x12, 0x01, 0xaf, 0x11, 0x11, 0x2f, 0x2f,
-    0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x2f,
-    0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f, 0x0e, 0x0e, 0x01, 0x70, 0x01, 0x0f,
-    0xfe, 0xc0, 0x0f, 0x01, 0x01, 0x0f, 0x01, 0x40, 0x0f, 0x01, 0x10, 0x1b,
-    0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0xfe, 0xc0, 0x1b, 0x12, 0x12,
-    0x01, 0x01, 0x12, 0x12, 0x1b, 0x01, 0x40, 0x4f, 0x0e, 0x0e, 0x2f, 0x2f,
-    0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x0e, 0x0e, 0x2f, 0x2f,
-    0x0e, 0x0e, 0x11, 0x11, 0x2f, 0x2f, 0x11, 0x11, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0x40, 0x01, 0xc0, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x74,
-    0x00, 0x00, 0x13, 0x06, 0x07, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x07, 0x16, 0x17, 0x16, 0x17, 0x15, 0x31, 0x33, 0x31, 0x35, 0x31, 0x34,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x07,
-    0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x06, 0x15, 0x15, 0x31, 0x33, 0x31, 0x35, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x26, 0x27, 0x23,
-    0x03, 0x37, 0x07, 0x37, 0x33, 0x31, 0x17, 0x31, 0x23, 0x37, 0x23, 0x33,
-    0x23, 0x06, 0x07, 0x07, 0x31, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x33,
-    0x31, 0x32, 0x37, 0x36, 0x35, 0x34, 0x27, 0x27, 0x31, 0x26, 0x27, 0x68,
-    0x16, 0x02, 0x01, 0x11, 0x0c, 0x0c, 0x1c, 0x16, 0x17, 0x01, 0x01, 0x0e,
-    0x0f, 0x12, 0x30, 0x0d, 0x0e, 0x0a, 0x0a, 0x01, 0x01, 0x12, 0x12, 0x19,
-    0x19, 0x14, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x13, 0x19,
-    0x08, 0x08, 0x42, 0x0e, 0x0e, 0x11, 0x11, 0x3a, 0x14, 0x01, 0x01, 0x0a,
-    0x0a, 0x0e, 0x0d, 0x30, 0x12, 0x0f, 0x0e, 0x01, 0x01, 0x17, 0x16, 0x1c,
-    0x0c, 0x0c, 0x11, 0x01, 0x02, 0x16, 0x38, 0x6b, 0x10, 0x10, 0x10, 0xb6,
-    0x10, 0xd6, 0xd0, 0xc9, 0xc9, 0xc9, 0x14, 0x09, 0x1a, 0x05, 0x0c, 0x0b,
-    0x12, 0xee, 0x12, 0x0b, 0x0c, 0x05, 0x1a, 0x0a, 0x12, 0x01, 0xc0, 0x02,
-    0x16, 0x12, 0x05, 0x0c, 0x0f, 0x20, 0x2d, 0x2e, 0x36, 0x21, 0x16, 0x15,
-    0x0c, 0x0d, 0x1b, 0x0e, 0x07, 0x07, 0x0d, 0x0c, 0x15, 0x2a, 0x25, 0x25,
-    0x1e, 0x1d, 0x10, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x10,
-    0x1d, 0x0a, 0x0a, 0x42, 0x11, 0x11, 0x0e, 0x0e, 0x3a, 0x27, 0x2d, 0x15,
-    0x0c, 0x0d, 0x07, 0x07, 0x0e, 0x1b, 0x0d, 0x0c, 0x15, 0x16, 0x21, 0x36,
-    0x2e, 0x2d, 0x20, 0x0f, 0x0c, 0x05, 0x12, 0x16, 0x02, 0xfe, 0x30, 0x20,
-    0x20, 0x20, 0x20, 0x50, 0x01, 0x10, 0x34, 0x08, 0x0a, 0x12, 0x0b, 0x0c,
-    0x0c, 0x0b, 0x12, 0x0a, 0x08, 0x34, 0x10, 0x01, 0x00, 0x03, 0x00, 0x00,
-    0xff, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x41, 0x00, 0x4a, 0x00, 0x62,
-    0x00, 0x00, 0x13, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31, 0x23, 0x31, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x15, 0x31, 0x23, 0x31, 0x06, 0x07, 0x06,
-    0x07, 0x14, 0x17, 0x17, 0x31, 0x33, 0x31, 0x27, 0x31, 0x26, 0x35, 0x36,
-    0x37, 0x33, 0x33, 0x16, 0x17, 0x14, 0x07, 0x07, 0x31, 0x33, 0x31, 0x37,
-    0x31, 0x36, 0x35, 0x26, 0x27, 0x26, 0x27, 0x23, 0x31, 0x35, 0x31, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x35, 0x03, 0x33, 0x23, 0x33,
-    0x17, 0x31, 0x21, 0x31, 0x37, 0x25, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07,
-    0x07, 0x31, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x21, 0x31, 0x32, 0x37,
-    0x36, 0x35, 0x34, 0x27, 0x27, 0xf8, 0x02, 0x16, 0x16, 0x02, 0x20, 0x16,
-    0x02, 0x02, 0x16, 0x20, 0x8c, 0x1a, 0x11, 0x10, 0x01, 0x05, 0x36, 0x34,
-    0x3e, 0x01, 0x01, 0x0b, 0xa4, 0xa4, 0x0b, 0x01, 0x01, 0x3e, 0x34, 0x36,
-    0x05, 0x01, 0x11, 0x10, 0x1a, 0x8c, 0x20, 0x16, 0x02, 0x02, 0x16, 0x20,
-    0x93, 0xf6, 0xf6, 0xf6, 0x10, 0xfe, 0xea, 0x10, 0x01, 0x1c, 0x09, 0x13,
-    0xfe, 0xf7, 0x14, 0x09, 0x1a, 0x05, 0x0c, 0x0b, 0x12, 0x01, 0x2e, 0x12,
-    0x0b, 0x0c, 0x05, 0x1a, 0x01, 0xa8, 0x16, 0x02, 0x02, 0x16, 0x20, 0x02,
-    0x16, 0x16, 0x02, 0x28, 0x01, 0x10, 0x11, 0x1a, 0x0c, 0x0b, 0x7d, 0x90,
-    0x02, 0x02, 0x0b, 0x01, 0x01, 0x0b, 0x02, 0x02, 0x90, 0x7d, 0x0b, 0x0c,
-    0x1a, 0x11, 0x10, 0x01, 0x28, 0x02, 0x16, 0x16, 0x02, 0x20, 0xfe, 0x68,
-    0x20, 0x20, 0x1f, 0x10, 0x01, 0x01, 0x10, 0x34, 0x08, 0x0a, 0x12, 0x0b,
-    0x0c, 0x0c, 0x0b, 0x12, 0x0a, 0x08, 0x34, 0x00, 0x00, 0x04, 0x00, 0x10,
-    0xff, 0xc0, 0x01, 0xb0, 0x01, 0xc0, 0x00, 0x4b, 0x00, 0x54, 0x00, 0x6e,
-    0x00, 0x77, 0x00, 0x00, 0x13, 0x23, 0x33, 0x23, 0x17, 0x31, 0x16, 0x15,
-    0x14, 0x07, 0x07, 0x31, 0x06, 0x15, 0x15, 0x31, 0x14, 0x17, 0x17, 0x31,
-    0x16, 0x37, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x07, 0x31,
-    0x06, 0x07, 0x23, 0x31, 0x36, 0x37, 0x26, 0x27, 0x27, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x34, 0x37, 0x23, 0x31, 0x26, 0x35, 0x34, 0x37, 0x36, 0x33,
-    0x33, 0x31, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x07, 0x31, 0x23, 0x31,
-    0x37, 0x31, 0x36, 0x35, 0x26, 0x27, 0x26, 0x27, 0x03, 0x07, 0x37, 0x07,
-    0x21, 0x31, 0x27, 0x31, 0x21, 0x25, 0x17, 0x27, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x23, 0x21, 0x31, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37,
-    0x31, 0x36, 0x37, 0x21, 0x31, 0x16, 0x17, 0x03, 0x16, 0x17, 0x06, 0x07,
-    0x26, 0x27, 0x36, 0x37, 0xe3, 0x6e, 0x6e, 0x6e, 0x11, 0x0a, 0x0a, 0x06,
-    0x10, 0x0d, 0x02, 0x10, 0x11, 0x32, 0x13, 0x0e, 0x0c, 0x11, 0x32, 0x36,
-    0x0b, 0x06, 0x32, 0x08, 0x1c, 0x02, 0x02, 0x02, 0x20, 0x01, 0x13, 0x01,
-    0x12, 0x0d, 0x0d, 0x13, 0x76, 0x50, 0x36, 0x35, 0x02, 0x03, 0x17, 0x31,
-    0x19, 0x02, 0x02, 0x27, 0x28, 0x3c, 0x8e, 0x10, 0x10, 0x10, 0x01, 0x36,
-    0x10, 0xfe, 0xea, 0x01, 0x3c, 0x1a, 0x1a, 0x1a, 0x05, 0x0c, 0x0b, 0x12,
-    0xfe, 0xb2, 0x12, 0x0b, 0x0c, 0x05, 0x1a, 0x09, 0x14, 0x01, 0x29, 0x13,
-    0x09, 0xe5, 0x12, 0x02, 0x02, 0x12, 0x12, 0x02, 0x02, 0x12, 0x01, 0x90,
-    0x0d, 0x07, 0x0c, 0x0c, 0x07, 0x05, 0x0c, 0x14, 0x5b, 0x10, 0x0a, 0x01,
-    0x0b, 0x0b, 0x24, 0x0c, 0x11, 0x13, 0x0f, 0x24, 0x27, 0x08, 0x0c, 0x22,
-    0x16, 0x02, 0x01, 0x01, 0x19, 0x28, 0x5b, 0x1f, 0x17, 0x0e, 0x17, 0x13,
-    0x0d, 0x0d, 0x02, 0x35, 0x36, 0x50, 0x11, 0x11, 0x81, 0x8a, 0x0c, 0x0d,
-    0x3c, 0x28, 0x27, 0x02, 0xfe, 0x80, 0x20, 0x20, 0x20, 0x20, 0x1f, 0x34,
-    0x34, 0x34, 0x08, 0x0a, 0x12, 0x0b, 0x0c, 0x0c, 0x0b, 0x12, 0x0a, 0x08,
-    0x34, 0x10, 0x01, 0x01, 0x10, 0x01, 0x11, 0x02, 0x12, 0x12, 0x02, 0x02,
-    0x12, 0x12, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x01, 0x40,
-    0x01, 0xa0, 0x00, 0x0c, 0x00, 0x34, 0x00, 0x3d, 0x00, 0x55, 0x00, 0x00,
-    0x13, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x37, 0x36,
-    0x37, 0x17, 0x23, 0x33, 0x23, 0x17, 0x31, 0x23, 0x31, 0x27, 0x31, 0x23,
-    0x23, 0x07, 0x31, 0x23, 0x31, 0x37, 0x31, 0x23, 0x31, 0x26, 0x27, 0x36,
-    0x37, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x06,
-    0x07, 0x16, 0x17, 0x06, 0x07, 0x07, 0x33, 0x23, 0x33, 0x27, 0x31, 0x23,
-    0x31, 0x07, 0x37, 0x16, 0x17, 0x17, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06,
-    0x23, 0x23, 0x31, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x36,
-    0x37, 0x33, 0xe8, 0x01, 0x23, 0x24, 0x24, 0x23, 0x01, 0x01, 0x23, 0x24,
-    0x24, 0x23, 0x01, 0x18, 0x0d, 0x0d, 0x0d, 0x0b, 0x30, 0x0b, 0x23, 0x23,
-    0x0b, 0x30, 0x0b, 0x0d, 0x16, 0x02, 0x02, 0x16, 0x17, 0x01, 0x01, 0x22,
-    0x22, 0x33, 0x33, 0x22, 0x22, 0x01, 0x01, 0x17, 0x16, 0x02, 0x02, 0x16,
-    0xcb, 0xd6, 0xd6, 0xd6, 0x10, 0xb6, 0x10, 0xd0, 0x13, 0x09, 0x1b, 0x04,
-    0x0c, 0x0b, 0x12, 0xee, 0x12, 0x0b, 0x0c, 0x05, 0x1a, 0x09, 0x14, 0xc9,
-    0x01, 0x28, 0x29, 0x15, 0x14, 0x14, 0x15, 0x29, 0x29, 0x15, 0x14, 0x14,
-    0x15, 0x29, 0x78, 0x50, 0x50, 0x50, 0x50, 0x02, 0x16, 0x16, 0x02, 0x1f,
-    0x29, 0x33, 0x22, 0x22, 0x01, 0x01, 0x22, 0x22, 0x33, 0x29, 0x1f, 0x02,
-    0x16, 0x16, 0x02, 0xc0, 0x20, 0x20, 0x50, 0x01, 0x10, 0x34, 0x08, 0x0a,
-    0x12, 0x0b, 0x0c, 0x0c, 0x0b, 0x12, 0x0a, 0x08, 0x34, 0x10, 0x01, 0x00,
-    0x00, 0x04, 0xff, 0xfa, 0xff, 0xc0, 0x02, 0x06, 0x01, 0xc0, 0x00, 0x0c,
-    0x00, 0x45, 0x00, 0x4e, 0x00, 0x66, 0x00, 0x00, 0x01, 0x36, 0x37, 0x36,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x07, 0x06, 0x17, 0x17, 0x31,
-    0x33, 0x31, 0x27, 0x31, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x36, 0x37,
-    0x16, 0x17, 0x16, 0x17, 0x07, 0x31, 0x33, 0x31, 0x37, 0x31, 0x36, 0x27,
-    0x26, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x03, 0x33, 0x23, 0x33, 0x17, 0x31,
-    0x21, 0x31, 0x37, 0x25, 0x26, 0x27, 0x21, 0x31, 0x06, 0x07, 0x07, 0x31,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0x21, 0x31, 0x32, 0x37, 0x36, 0x35,
-    0x34, 0x27, 0x27, 0x01, 0x00, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x1b,
-    0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x5f, 0x1c, 0x08, 0x06, 0x11, 0x10, 0x16,
-    0x0f, 0x0d, 0x0c, 0x0c, 0x12, 0x0a, 0x5e, 0x37, 0x53, 0x1f, 0x18, 0x18,
-    0x0e, 0x23, 0x3a, 0x3a, 0x23, 0x0d, 0x19, 0x18, 0x1f, 0x53, 0x37, 0x5e,
-    0x0a, 0x12, 0x0c, 0x0c, 0x0d, 0x0f, 0x16, 0x10, 0x11, 0x06, 0x08, 0x1c,
-    0x16, 0x0a, 0x15, 0x2a, 0x2a, 0x15, 0x0a, 0x16, 0x1c, 0xf6, 0xf6, 0xf6,
-    0x10, 0xfe, 0xea, 0x10, 0x01, 0x1c, 0x09, 0x13, 0xfe, 0xf7, 0x14, 0x09,
-    0x1a, 0x05, 0x0c, 0x0b, 0x12, 0x01, 0x2e, 0x12, 0x0b, 0x0c, 0x05, 0x1a,
-    0x01, 0x60, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x01, 0x17, 0x18, 0x18,
-    0x17, 0x01, 0x08, 0x03, 0x18, 0x14, 0x0c, 0x0d, 0x06, 0x06, 0x07, 0x0d,
-    0x15, 0xa3, 0x90, 0x02, 0x10, 0x10, 0x1a, 0x2a, 0x02, 0x02, 0x2a, 0x1a,
-    0x10, 0x10, 0x02, 0x90, 0xa3, 0x14, 0x0e, 0x07, 0x06, 0x06, 0x0d, 0x0c,
-    0x14, 0x18, 0x03, 0x02, 0x11, 0x23, 0x02, 0x02, 0x23, 0x11, 0x02, 0xfe,
-    0xa8, 0x20, 0x20, 0x1f, 0x10, 0x01, 0x01, 0x10, 0x34, 0x08, 0x0a, 0x12,
-    0x0b, 0x0c, 0x0c, 0x0b, 0x12, 0x0a, 0x08, 0x34, 0x00, 0x04, 0x00, 0x20,
-    0xff, 0xc0, 0x01, 0xa0, 0x01, 0xa0, 0x00, 0x48, 0x00, 0x51, 0x00, 0x69,
-    0x00, 0x7b, 0x00, 0x00, 0x13, 0x15, 0x35, 0x15, 0x14, 0x17, 0x17, 0x31,
-    0x16, 0x07, 0x07, 0x31, 0x23, 0x31, 0x37, 0x31, 0x27, 0x31, 0x26, 0x27,
-    0x35, 0x31, 0x34, 0x37, 0x36, 0x33, 0x21, 0x31, 0x32, 0x17, 0x16, 0x15,
-    0x15, 0x31, 0x06, 0x07, 0x07, 0x31, 0x17, 0x31, 0x23, 0x31, 0x27, 0x31,
-    0x26, 0x37, 0x37, 0x31, 0x36, 0x35, 0x35, 0x31, 0x23, 0x31, 0x15, 0x31,
-    0x06, 0x07, 0x26, 0x27, 0x35, 0x31, 0x23, 0x31, 0x15, 0x31, 0x06, 0x07,
-    0x26, 0x27, 0x35, 0x31, 0x23, 0x13, 0x21, 0x21, 0x21, 0x27, 0x31, 0x23,
-    0x31, 0x07, 0x25, 0x16, 0x17, 0x17, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06,
-    0x23, 0x21, 0x31, 0x22, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x36,
-    0x37, 0x21, 0x27, 0x26, 0x27, 0x35, 0x31, 0x34, 0x37, 0x36, 0x33, 0x32,
-    0x17, 0x16, 0x15, 0x15, 0x31, 0x06, 0x07, 0x23, 0x50, 0x03, 0x33, 0x0b,
-    0x01, 0x0a, 0x31, 0x0a, 0x29, 0x15, 0x01, 0x0c, 0x0b, 0x11, 0x01, 0x30,
-    0x11, 0x0b, 0x0c, 0x01, 0x15, 0x29, 0x0a, 0x30, 0x0b, 0x01, 0x0b, 0x33,
-    0x03, 0x40, 0x02, 0x16, 0x16, 0x02, 0x40, 0x02, 0x16, 0x16, 0x02, 0x40,
-    0x05, 0x01, 0x16, 0xfe, 0xea, 0x01, 0x16, 0x10, 0xf6, 0x10, 0x01, 0x10,
-    0x13, 0x09, 0x1a, 0x05, 0x0c, 0x0b, 0x12, 0xfe, 0xd2, 0x12, 0x0b, 0x0c,
-    0x05, 0x1a, 0x09, 0x14, 0x01, 0x09, 0x95, 0x0f, 0x01, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x01, 0x0f, 0x20, 0x01, 0x70, 0x70, 0x70, 0x70, 0x04,
-    0x02, 0x27, 0x08, 0x0e, 0x5d, 0x55, 0x1e, 0x11, 0x1c, 0x78, 0x11, 0x0b,
-    0x0c, 0x0c, 0x0b, 0x11, 0x78, 0x1c, 0x11, 0x1e, 0x55, 0x5d, 0x0e, 0x08,
-    0x27, 0x02, 0x04, 0x70, 0x18, 0x16, 0x02, 0x02, 0x16, 0x18, 0x18, 0x16,
-    0x02, 0x02, 0x16, 0x18, 0xfe, 0x80, 0x20, 0x20, 0x50, 0x01, 0x10, 0x34,
-    0x08, 0x0a, 0x12, 0x0b, 0x0c, 0x0c, 0x0b, 0x12, 0x0a, 0x08, 0x34, 0x10,
-    0x01, 0x60, 0x01, 0x0f, 0x30, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x30,
-    0x0f, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x08, 0x00, 0x1b, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11,
-    0x21, 0x31, 0x11, 0x31, 0x21, 0x25, 0x23, 0x33, 0x23, 0x15, 0x31, 0x11,
-    0x31, 0x15, 0x31, 0x33, 0x21, 0x35, 0x31, 0x11, 0x31, 0x35, 0x31, 0x23,
-    0x01, 0xd0, 0xfe, 0x60, 0x01, 0xa0, 0xfe, 0x60, 0x30, 0x30, 0x30, 0x30,
-    0x01, 0xd0, 0x30, 0x01, 0x90, 0xfe, 0x60, 0x01, 0xa0, 0xfe, 0x60, 0x01,
-    0xa0, 0x30, 0x30, 0xfe, 0x60, 0x30, 0x30, 0x01, 0xa0, 0x30, 0x00, 0x00,
-    0x00, 0x05, 0xff, 0xfe, 0xff, 0xe0, 0x02, 0x00, 0x01, 0xa0, 0x00, 0x18,
-    0x00, 0x4f, 0x00, 0x62, 0x00, 0x75, 0x00, 0x88, 0x00, 0x00, 0x37, 0x26,
-    0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x07,
-    0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x17,
-    0x16, 0x33, 0x32, 0x33, 0x32, 0x37, 0x31, 0x31, 0x36, 0x37, 0x32, 0x33,
-    0x30, 0x31, 0x36, 0x37, 0x36, 0x37, 0x16, 0x33, 0x36, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x07, 0x16, 0x17, 0x06, 0x07, 0x37, 0x32, 0x37, 0x31, 0x31, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x33, 0x37, 0x34, 0x27, 0x31, 0x31, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15,
-    0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x17, 0x32, 0x37, 0x31,
-    0x31, 0x36, 0x35, 0x34, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14,
-    0x17, 0x16, 0x33, 0xa8, 0x18, 0x14, 0x0d, 0x1b, 0x09, 0x03, 0x01, 0x0d,
-    0x24, 0x01, 0x38, 0x38, 0x5f, 0x5f, 0x38, 0x38, 0x01, 0x01, 0x38, 0x38,
-    0x5f, 0x30, 0x28, 0x8e, 0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x05, 0x06,
-    0x07, 0x03, 0x05, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x07, 0x06, 0x02, 0x01,
-    0x1b, 0x17, 0x23, 0x13, 0x30, 0x38, 0x48, 0x3a, 0x39, 0x22, 0x22, 0x01,
-    0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01,
-    0x01, 0x2f, 0x05, 0x11, 0x76, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x90, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x50, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x3f, 0x08, 0x0e, 0x0a, 0x0d,
-    0x16, 0x1b, 0x14, 0x10, 0x28, 0x31, 0x3e, 0x30, 0x2f, 0x03, 0x03, 0x2f,
-    0x30, 0x3e, 0x3e, 0x30, 0x2f, 0x03, 0x0f, 0x27, 0x04, 0x04, 0x02, 0x02,
-    0x02, 0x01, 0x07, 0x07, 0x07, 0x0a, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x0a,
-    0x11, 0x0e, 0x12, 0x01, 0x1b, 0x1c, 0x2f, 0x2f, 0x3a, 0x3a, 0x2f, 0x2f,
-    0x1c, 0x1b, 0x01, 0x01, 0x1b, 0x1c, 0x2f, 0x2f, 0x3a, 0x45, 0x34, 0x25,
-    0x1a, 0x98, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x20, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x50, 0x00, 0x63, 0x00, 0x74,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x17, 0x16, 0x17, 0x31,
-    0x31, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x27,
-    0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x17, 0x06, 0x27, 0x26, 0x37, 0x36,
-    0x33, 0x32, 0x17, 0x16, 0x07, 0x06, 0x27, 0x26, 0x23, 0x22, 0x07, 0x01,
-    0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xb2,
-    0x0b, 0x14, 0x13, 0x1c, 0x1c, 0x13, 0x14, 0x0b, 0x11, 0x11, 0x0f, 0x0d,
-    0x11, 0x1c, 0x1d, 0x28, 0x28, 0x1d, 0x1c, 0x11, 0x0d, 0x0f, 0x11, 0x11,
-    0x22, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d,
-    0x09, 0x09, 0x01, 0xa6, 0x0e, 0x0e, 0x0c, 0x0b, 0x18, 0x1f, 0x1f, 0x17,
-    0x0b, 0x0c, 0x0e, 0x0e, 0x09, 0x10, 0x11, 0x09, 0xc0, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x3e, 0x0d, 0x0a, 0x0a, 0x01, 0x01, 0x0a, 0x0a, 0x0d, 0x0f, 0x0e,
-    0x10, 0x12, 0x12, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x12, 0x12, 0x10,
-    0x0e, 0x0f, 0x6e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x16, 0x0c, 0x0b, 0x0e, 0x0f, 0x16, 0x16, 0x0f, 0x0e,
-    0x0b, 0x0c, 0x0a, 0x0a, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x67, 0x00, 0x82,
-    0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x37, 0x36, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x17, 0x16, 0x37, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x37, 0x27, 0x32, 0x37, 0x31, 0x31, 0x36, 0x35,
-    0x34, 0x35, 0x17, 0x31, 0x16, 0x37, 0x36, 0x27, 0x27, 0x31, 0x26, 0x07,
-    0x06, 0x17, 0x17, 0x31, 0x06, 0x07, 0x16, 0x17, 0x16, 0x33, 0x37, 0x34,
-    0x27, 0x37, 0x31, 0x36, 0x27, 0x26, 0x07, 0x07, 0x31, 0x06, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x14, 0x15, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36,
-    0x37, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f,
-    0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a,
-    0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x48, 0x0f, 0x0d, 0x0b, 0x13,
-    0x12, 0x1a, 0x1a, 0x12, 0x13, 0x0a, 0x0e, 0x0f, 0x11, 0x11, 0x0b, 0x1b,
-    0x1c, 0x0b, 0x10, 0x12, 0x99, 0x0e, 0x09, 0x09, 0x0b, 0x0e, 0x06, 0x04,
-    0x0e, 0x60, 0x0e, 0x06, 0x03, 0x0d, 0x1f, 0x09, 0x01, 0x01, 0x09, 0x09,
-    0x0d, 0xc0, 0x09, 0x1e, 0x0e, 0x04, 0x06, 0x0e, 0x60, 0x0d, 0x03, 0x06,
-    0x0e, 0x0c, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x90, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x76, 0x11, 0x11,
-    0x0c, 0x0a, 0x09, 0x01, 0x01, 0x09, 0x0a, 0x0c, 0x11, 0x11, 0x0d, 0x0f,
-    0x0e, 0x02, 0x02, 0x0e, 0x0f, 0x0d, 0x7a, 0x09, 0x09, 0x0e, 0x02, 0x02,
-    0x03, 0x04, 0x0e, 0x0e, 0x06, 0x20, 0x03, 0x0d, 0x0e, 0x06, 0x0a, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x20, 0x0e, 0x09, 0x0a, 0x06, 0x0e, 0x0d, 0x03,
-    0x20, 0x06, 0x0e, 0x0d, 0x03, 0x04, 0x02, 0x03, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x42, 0x00, 0x63, 0x00, 0x84,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x27, 0x36, 0x17,
-    0x17, 0x31, 0x37, 0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x17, 0x31,
-    0x16, 0x07, 0x06, 0x27, 0x27, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37,
-    0x37, 0x31, 0x27, 0x31, 0x26, 0x37, 0x33, 0x36, 0x17, 0x17, 0x31, 0x37,
-    0x31, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16, 0x07, 0x06,
-    0x27, 0x27, 0x31, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37, 0x31, 0x27,
-    0x31, 0x26, 0x37, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x00, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0x24,
-    0x13, 0x12, 0x12, 0x13, 0x24, 0x99, 0x11, 0x11, 0x17, 0x17, 0x11, 0x11,
-    0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17, 0x11, 0x11,
-    0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0xc0, 0x11, 0x11, 0x17, 0x17, 0x11,
-    0x11, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17, 0x11,
-    0x11, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0xc0, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x20, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x01, 0x1f, 0x20, 0x20, 0x1f,
-    0x01, 0x99, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17,
-    0x11, 0x11, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17,
-    0x11, 0x11, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17,
-    0x11, 0x11, 0x0e, 0x0e, 0x17, 0x17, 0x0e, 0x0e, 0x11, 0x11, 0x17, 0x17,
-    0x11, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x47, 0x00, 0x53,
-    0x00, 0x60, 0x00, 0x6d, 0x00, 0x7a, 0x00, 0x87, 0x00, 0x00, 0x25, 0x14,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16,
-    0x15, 0x03, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x07, 0x36, 0x37, 0x26, 0x27, 0x06, 0x07, 0x16,
-    0x17, 0x37, 0x26, 0x27, 0x06, 0x07, 0x16, 0x17, 0x36, 0x37, 0x07, 0x06,
-    0x07, 0x16, 0x17, 0x33, 0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x27, 0x16,
-    0x17, 0x16, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x15,
-    0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17,
-    0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x27, 0x26,
-    0x27, 0x33, 0x26, 0x27, 0x26, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x37,
-    0x36, 0x37, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31,
-    0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c,
-    0xd0, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46,
-    0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x60, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0xd8, 0x02, 0x16, 0x16, 0x02, 0x02,
-    0x16, 0x16, 0x02, 0xb8, 0x16, 0x02, 0x02, 0x16, 0x80, 0x16, 0x02, 0x02,
-    0x16, 0x80, 0x20, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x1b, 0x0f, 0x0c,
-    0x0c, 0x0f, 0x1b, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0x2d, 0x18, 0x16,
-    0x16, 0x18, 0x2d, 0x90, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x01, 0x17,
-    0x18, 0x18, 0x17, 0x01, 0x80, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x01,
-    0x27, 0x28, 0x28, 0x27, 0x01, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x01, 0x00, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0xf8, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x18, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0x02, 0x16, 0x70, 0x02,
-    0x16, 0x16, 0x02, 0x02, 0x16, 0x16, 0x02, 0xa0, 0x01, 0x17, 0x18, 0x18,
-    0x17, 0x01, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x80, 0x01, 0x27, 0x28,
-    0x28, 0x27, 0x01, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x50, 0x1b, 0x0f,
-    0x0c, 0x0c, 0x0f, 0x1b, 0x1b, 0x0f, 0x0c, 0x0c, 0x0f, 0x1b, 0x2d, 0x18,
-    0x16, 0x16, 0x18, 0x2d, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x17, 0x06, 0x27, 0x31, 0x31, 0x26, 0x37, 0x36,
-    0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x07, 0x06, 0x27, 0x26,
-    0x23, 0x22, 0x07, 0x27, 0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x37, 0x32,
-    0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x36, 0x37, 0x36, 0x33, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0xb6, 0x0a, 0x07, 0x07, 0x03, 0x0d, 0x19,
-    0x19, 0x20, 0x20, 0x19, 0x19, 0x0d, 0x03, 0x07, 0x07, 0x0a, 0x22, 0x28,
-    0x28, 0x22, 0x26, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0d, 0x09, 0x09, 0x01, 0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x0d, 0x09, 0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0xc0, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x7f, 0x03, 0x05, 0x05, 0x0a, 0x1c, 0x11, 0x11, 0x11, 0x11, 0x1c,
-    0x0a, 0x05, 0x05, 0x03, 0x0f, 0x0f, 0xaf, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x09, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x3f,
-    0x00, 0x48, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x72, 0x00, 0x85, 0x00, 0x98,
-    0x00, 0x00, 0x01, 0x22, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x15, 0x14,
-    0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34,
-    0x27, 0x26, 0x27, 0x26, 0x23, 0x05, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x05, 0x06, 0x07, 0x16,
-    0x17, 0x33, 0x31, 0x35, 0x31, 0x23, 0x17, 0x33, 0x23, 0x33, 0x35, 0x31,
-    0x23, 0x31, 0x15, 0x33, 0x35, 0x15, 0x35, 0x23, 0x31, 0x15, 0x31, 0x33,
-    0x33, 0x33, 0x23, 0x33, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x15, 0x27,
-    0x33, 0x23, 0x33, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x23,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x27, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x26, 0x27, 0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x01,
-    0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x01, 0x00, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xfe,
-    0xa8, 0x16, 0x02, 0x02, 0x16, 0x08, 0x08, 0x28, 0x20, 0x20, 0x20, 0x20,
-    0x60, 0x20, 0x20, 0x20, 0x08, 0x08, 0x08, 0x16, 0x02, 0x02, 0x16, 0x08,
-    0xa8, 0xb0, 0xb0, 0xb0, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x18,
-    0xb0, 0x18, 0x10, 0x0f, 0x01, 0x01, 0x0f, 0x10, 0x18, 0x18, 0x01, 0x09,
-    0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01,
-    0x09, 0x09, 0x0d, 0x01, 0x90, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xd0, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x40, 0x02,
-    0x16, 0x16, 0x02, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x02,
-    0x16, 0x16, 0x02, 0x30, 0x50, 0x01, 0x0f, 0x10, 0x18, 0x18, 0x10, 0x0f,
-    0x01, 0x01, 0x0f, 0x10, 0x18, 0x18, 0x10, 0x0f, 0x01, 0x50, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x05, 0x36, 0x17, 0x31, 0x31, 0x16, 0x07, 0x06,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x27, 0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x37, 0x32,
-    0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x36, 0x37, 0x36, 0x33, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e, 0x0e, 0x09, 0x09, 0x07, 0x13,
-    0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07, 0x09, 0x08, 0x0f, 0x2c,
-    0x32, 0x32, 0x2c, 0xce, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0xc0, 0x39, 0x2f,
-    0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x34, 0x02, 0x09, 0x09, 0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12,
-    0x1c, 0x0d, 0x09, 0x09, 0x02, 0x0b, 0x0b, 0x64, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x72, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x05, 0x36, 0x17, 0x31, 0x31, 0x16, 0x07, 0x06,
-    0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x27, 0x14, 0x07, 0x31, 0x31, 0x06, 0x07, 0x26, 0x27,
-    0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x15, 0x17, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16,
-    0x15, 0x14, 0x07, 0x06, 0x07, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43,
-    0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e, 0x0e, 0x09, 0x09, 0x07, 0x13,
-    0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07, 0x09, 0x08, 0x0f, 0x2c,
-    0x32, 0x32, 0x2c, 0x7e, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x60, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x34, 0x02,
-    0x09, 0x09, 0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09, 0x09,
-    0x02, 0x0b, 0x0b, 0x74, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x40, 0x01, 0x12, 0x12,
-    0x1b, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12,
-    0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x83, 0x00, 0xba,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x36, 0x17, 0x31,
-    0x31, 0x16, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x37, 0x36, 0x17, 0x16, 0x33, 0x32, 0x37, 0x27, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31,
-    0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
-    0x30, 0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x06, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17,
-    0x14, 0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x31, 0x31, 0x01, 0xd0, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e, 0x0e,
-    0x09, 0x09, 0x07, 0x13, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07,
-    0x09, 0x08, 0x0f, 0x2c, 0x32, 0x32, 0x2c, 0x84, 0x01, 0x01, 0x02, 0x04,
-    0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0x03, 0x05,
-    0x06, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01, 0x05, 0x06, 0x03,
-    0xa0, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04,
-    0x02, 0x01, 0x01, 0x03, 0x06, 0x05, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f,
-    0x10, 0x01, 0x06, 0x05, 0x03, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x34, 0x02,
-    0x09, 0x09, 0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09, 0x09,
-    0x02, 0x0b, 0x0b, 0x4f, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01,
-    0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15,
-    0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02,
-    0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01,
-    0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c,
-    0x06, 0x02, 0x01, 0x04, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc3, 0x00, 0x1c, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x9b, 0x00, 0xd2,
-    0x00, 0x00, 0x01, 0x36, 0x37, 0x31, 0x31, 0x36, 0x35, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x06, 0x15, 0x06,
-    0x15, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37,
-    0x36, 0x37, 0x36, 0x37, 0x34, 0x27, 0x06, 0x23, 0x22, 0x27, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37,
-    0x16, 0x17, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x03, 0x36, 0x27, 0x31,
-    0x31, 0x26, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x07, 0x06, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x27, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x16, 0x37, 0x36, 0x35, 0x26, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x06, 0x07, 0x14, 0x17, 0x16, 0x37, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x33, 0x31, 0x34, 0x31, 0x30, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x30, 0x31, 0x30, 0x15, 0x33,
-    0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x16, 0x37, 0x36, 0x35,
-    0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x14, 0x17, 0x16, 0x37,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x34, 0x31, 0x30, 0x31,
-    0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x30, 0x31, 0x30, 0x15, 0x33, 0x31, 0x31, 0x31, 0x31, 0x01, 0xdd, 0x0f,
-    0x0a, 0x0a, 0x01, 0x0f, 0x0e, 0x0c, 0x06, 0x06, 0x08, 0x0b, 0x0a, 0x07,
-    0x01, 0x05, 0x01, 0x0d, 0x0e, 0x14, 0x07, 0x06, 0x52, 0x3d, 0x4e, 0x48,
-    0x39, 0x3a, 0x22, 0x22, 0x01, 0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x48,
-    0x39, 0x3a, 0x22, 0x22, 0x01, 0x15, 0x0d, 0x0e, 0x0d, 0x0d, 0x19, 0x01,
-    0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58,
-    0x4a, 0x37, 0x01, 0x01, 0x06, 0x02, 0x02, 0x14, 0x07, 0x09, 0x09, 0x0e,
-    0x2c, 0x32, 0x32, 0x2c, 0x0f, 0x08, 0x09, 0x07, 0x13, 0x1f, 0x1f, 0x26,
-    0x26, 0x1f, 0x1f, 0x13, 0x9d, 0x03, 0x06, 0x05, 0x01, 0x10, 0x0f, 0x18,
-    0x18, 0x0f, 0x10, 0x01, 0x06, 0x05, 0x03, 0x01, 0x01, 0x02, 0x04, 0x06,
-    0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0xa0, 0x03, 0x06,
-    0x05, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01, 0x06, 0x05, 0x03,
-    0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02,
-    0x01, 0x01, 0x01, 0x42, 0x04, 0x0c, 0x0c, 0x11, 0x10, 0x18, 0x17, 0x0f,
-    0x06, 0x06, 0x0a, 0x10, 0x10, 0x10, 0x01, 0x01, 0x0a, 0x08, 0x14, 0x0d,
-    0x0e, 0x02, 0x55, 0x28, 0x01, 0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x48,
-    0x39, 0x3a, 0x22, 0x22, 0x01, 0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x36,
-    0x2f, 0x05, 0x04, 0x2d, 0x37, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b,
-    0x58, 0x58, 0x3b, 0x3b, 0x02, 0x01, 0x2c, 0x06, 0x06, 0x12, 0x0c, 0x05,
-    0x05, 0xfe, 0xd8, 0x0d, 0x09, 0x09, 0x02, 0x0b, 0x0b, 0x02, 0x09, 0x09,
-    0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x6c, 0x04, 0x01, 0x02, 0x06,
-    0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04,
-    0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02,
-    0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15,
-    0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d,
-    0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4c,
-    0x00, 0x69, 0x00, 0x85, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x05, 0x36, 0x17, 0x31, 0x31, 0x16, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16, 0x33, 0x32, 0x37, 0x27,
-    0x16, 0x17, 0x31, 0x31, 0x16, 0x07, 0x07, 0x31, 0x06, 0x27, 0x27, 0x31,
-    0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x36, 0x17, 0x17, 0x31, 0x37, 0x31,
-    0x36, 0x37, 0x36, 0x17, 0x17, 0x17, 0x27, 0x17, 0x37, 0x31, 0x36, 0x17,
-    0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x07, 0x31, 0x06, 0x27, 0x27, 0x31,
-    0x26, 0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x17, 0x01, 0xd0, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e, 0x0e, 0x09,
-    0x09, 0x07, 0x13, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07, 0x09,
-    0x08, 0x0f, 0x2c, 0x32, 0x32, 0x2c, 0x87, 0x0e, 0x07, 0x06, 0x03, 0x11,
-    0x06, 0x0e, 0x41, 0x0e, 0x06, 0x07, 0x03, 0x04, 0x0c, 0x0b, 0x0e, 0x10,
-    0x04, 0x04, 0x0c, 0x0b, 0x0e, 0x7b, 0x04, 0x04, 0x04, 0x10, 0x0e, 0x0b,
-    0x0c, 0x04, 0x03, 0x07, 0x06, 0x0e, 0x41, 0x0e, 0x06, 0x11, 0x03, 0x06,
-    0x07, 0x0e, 0x0d, 0x0c, 0x0c, 0x04, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x34,
-    0x02, 0x09, 0x09, 0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09,
-    0x09, 0x02, 0x0b, 0x0b, 0xab, 0x04, 0x0c, 0x0b, 0x0e, 0x41, 0x0e, 0x03,
-    0x11, 0x04, 0x0c, 0x0b, 0x0e, 0x0e, 0x06, 0x07, 0x03, 0x05, 0x10, 0x0e,
-    0x07, 0x06, 0x03, 0x18, 0x10, 0x10, 0x10, 0x04, 0x04, 0x07, 0x06, 0x0e,
-    0x0e, 0x0b, 0x0c, 0x04, 0x11, 0x03, 0x0e, 0x41, 0x0e, 0x0b, 0x0c, 0x04,
-    0x03, 0x07, 0x06, 0x0e, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x7f,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x36, 0x17, 0x31,
-    0x31, 0x16, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x37, 0x36, 0x17, 0x16, 0x33, 0x32, 0x37, 0x27, 0x17, 0x27, 0x17, 0x16,
-    0x15, 0x14, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26, 0x35, 0x34, 0x37, 0x37,
-    0x31, 0x27, 0x31, 0x26, 0x35, 0x34, 0x37, 0x36, 0x17, 0x05, 0x14, 0x07,
-    0x07, 0x31, 0x17, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x27, 0x27, 0x31,
-    0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x36, 0x17, 0x16, 0x15, 0x01, 0xd0,
-    0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b,
-    0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21,
-    0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e,
-    0x0e, 0x09, 0x09, 0x07, 0x13, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13,
-    0x07, 0x09, 0x08, 0x0f, 0x2c, 0x32, 0x32, 0x2c, 0xd8, 0x59, 0x59, 0x59,
-    0x08, 0x08, 0x59, 0x07, 0x05, 0x06, 0x03, 0x24, 0x24, 0x03, 0x06, 0x05,
-    0x07, 0x01, 0x06, 0x03, 0x24, 0x24, 0x03, 0x06, 0x05, 0x06, 0x5a, 0x08,
-    0x08, 0x5a, 0x06, 0x05, 0x06, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x34, 0x02,
-    0x09, 0x09, 0x0d, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09, 0x09,
-    0x02, 0x0b, 0x0b, 0xa1, 0x30, 0x30, 0x30, 0x04, 0x09, 0x09, 0x04, 0x30,
-    0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03,
-    0x03, 0x03, 0x0a, 0x04, 0x04, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03, 0x03,
-    0x03, 0x30, 0x05, 0x08, 0x09, 0x04, 0x30, 0x03, 0x03, 0x03, 0x07, 0x00,
-    0x00, 0x07, 0xff, 0xf8, 0xff, 0xb8, 0x02, 0x08, 0x01, 0xc8, 0x00, 0x14,
-    0x00, 0x2f, 0x00, 0x48, 0x00, 0x5f, 0x00, 0x79, 0x00, 0x92, 0x00, 0xa7,
-    0x00, 0x00, 0x01, 0x36, 0x33, 0x31, 0x31, 0x32, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x22, 0x35, 0x36, 0x37, 0x36, 0x37, 0x05,
-    0x36, 0x37, 0x31, 0x31, 0x36, 0x17, 0x06, 0x07, 0x06, 0x07, 0x26, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x17, 0x06, 0x07, 0x06, 0x07, 0x26, 0x37,
-    0x36, 0x37, 0x05, 0x36, 0x37, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36,
-    0x27, 0x36, 0x37, 0x07, 0x36, 0x33, 0x31, 0x31, 0x32, 0x17, 0x16, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x27, 0x26, 0x35, 0x26, 0x37, 0x36, 0x37,
-    0x36, 0x37, 0x05, 0x37, 0x07, 0x37, 0x36, 0x17, 0x16, 0x07, 0x07, 0x31,
-    0x06, 0x07, 0x06, 0x27, 0x26, 0x35, 0x27, 0x31, 0x27, 0x31, 0x22, 0x27,
-    0x26, 0x37, 0x36, 0x37, 0x37, 0x16, 0x15, 0x17, 0x31, 0x17, 0x31, 0x32,
-    0x17, 0x16, 0x07, 0x06, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26, 0x37, 0x37,
-    0x31, 0x36, 0x37, 0x36, 0x17, 0x01, 0x26, 0x35, 0x31, 0x31, 0x34, 0x37,
-    0x36, 0x37, 0x36, 0x37, 0x32, 0x15, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x01, 0xab, 0x0f, 0x14, 0x14, 0x0f, 0x0f, 0x0e, 0x0d, 0x1c,
-    0x1d, 0x12, 0x0a, 0x02, 0x07, 0x07, 0x0b, 0xfe, 0xa0, 0x41, 0x53, 0x54,
-    0x4b, 0x02, 0x02, 0x05, 0x02, 0x3f, 0x48, 0x48, 0x37, 0x35, 0x07, 0x07,
-    0x29, 0x11, 0x12, 0x08, 0x07, 0x29, 0x0a, 0x0b, 0x3e, 0x01, 0x86, 0x07,
-    0x07, 0x29, 0x0a, 0x0b, 0x3e, 0x41, 0x53, 0x54, 0x4b, 0x02, 0x02, 0x04,
-    0x03, 0x3f, 0x48, 0x47, 0x38, 0x35, 0x07, 0x07, 0x29, 0x11, 0x12, 0x69,
-    0x09, 0x0c, 0x0d, 0x04, 0x07, 0x0a, 0x09, 0x1b, 0x1b, 0x22, 0x22, 0x22,
-    0x0e, 0x01, 0x0d, 0x26, 0x23, 0x24, 0x17, 0xfe, 0xf5, 0x61, 0x61, 0x61,
-    0x0a, 0x06, 0x06, 0x03, 0x1d, 0x03, 0x06, 0x06, 0x05, 0x03, 0x06, 0x38,
-    0x04, 0x03, 0x05, 0x02, 0x01, 0x07, 0xc1, 0x03, 0x06, 0x38, 0x04, 0x03,
-    0x05, 0x02, 0x02, 0x06, 0x61, 0x0a, 0x06, 0x06, 0x03, 0x1d, 0x03, 0x06,
-    0x06, 0x05, 0xfe, 0xf2, 0x0f, 0x0e, 0x0d, 0x1c, 0x1c, 0x13, 0x0a, 0x02,
-    0x07, 0x07, 0x0b, 0x0f, 0x14, 0x14, 0x0f, 0x01, 0xb2, 0x0e, 0x0f, 0x0f,
-    0x14, 0x14, 0x0f, 0x0b, 0x07, 0x07, 0x02, 0x0a, 0x12, 0x1d, 0x1c, 0x0d,
-    0x3d, 0x3e, 0x0b, 0x0a, 0x29, 0x07, 0x08, 0x12, 0x11, 0x29, 0x07, 0x06,
-    0x36, 0x37, 0x48, 0x48, 0x3f, 0x02, 0x05, 0x02, 0x02, 0x4b, 0x54, 0x53,
-    0x41, 0x3b, 0x02, 0x02, 0x4b, 0x54, 0x53, 0x41, 0x3e, 0x0b, 0x0a, 0x29,
-    0x07, 0x07, 0x13, 0x10, 0x28, 0x07, 0x06, 0x36, 0x37, 0x48, 0x48, 0x3f,
-    0x02, 0x05, 0x5d, 0x0c, 0x0e, 0x22, 0x22, 0x22, 0x1b, 0x1b, 0x09, 0x0a,
-    0x07, 0x04, 0x0c, 0x0d, 0x09, 0x17, 0x23, 0x24, 0x26, 0x26, 0x1d, 0x1d,
-    0x1d, 0x03, 0x06, 0x06, 0x0a, 0x61, 0x07, 0x01, 0x02, 0x05, 0x03, 0x04,
-    0x38, 0x06, 0x03, 0x05, 0x06, 0x06, 0x03, 0xb2, 0x03, 0x04, 0x39, 0x05,
-    0x03, 0x05, 0x06, 0x06, 0x03, 0x1e, 0x02, 0x06, 0x06, 0x09, 0x62, 0x07,
-    0x01, 0x02, 0x05, 0xfe, 0x66, 0x0f, 0x14, 0x14, 0x0f, 0x0b, 0x07, 0x07,
-    0x02, 0x0a, 0x12, 0x1d, 0x1c, 0x0d, 0x0e, 0x0f, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x5d,
-    0x00, 0x85, 0x00, 0x9a, 0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16,
-    0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x03, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31, 0x07, 0x31, 0x06, 0x07, 0x06,
-    0x17, 0x17, 0x31, 0x07, 0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x17,
-    0x31, 0x16, 0x37, 0x36, 0x35, 0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26,
-    0x27, 0x27, 0x31, 0x27, 0x33, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31, 0x07,
-    0x31, 0x06, 0x07, 0x06, 0x17, 0x17, 0x31, 0x07, 0x31, 0x14, 0x17, 0x16,
-    0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36, 0x35, 0x27, 0x31, 0x37,
-    0x31, 0x36, 0x27, 0x26, 0x27, 0x27, 0x31, 0x27, 0x17, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x07, 0x06, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36,
-    0x37, 0x36, 0x27, 0x26, 0x07, 0x01, 0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d,
-    0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x49,
-    0x02, 0x05, 0x05, 0x02, 0x11, 0x26, 0x05, 0x01, 0x02, 0x04, 0x1c, 0x07,
-    0x01, 0x04, 0x04, 0x04, 0x22, 0x22, 0x04, 0x04, 0x04, 0x07, 0x1b, 0x04,
-    0x01, 0x02, 0x05, 0x26, 0x11, 0xa0, 0x02, 0x05, 0x05, 0x02, 0x11, 0x26,
-    0x05, 0x02, 0x01, 0x04, 0x1b, 0x07, 0x04, 0x04, 0x04, 0x22, 0x22, 0x04,
-    0x04, 0x04, 0x07, 0x1b, 0x04, 0x01, 0x02, 0x05, 0x26, 0x11, 0x07, 0x2c,
-    0x32, 0x32, 0x2c, 0x0f, 0x08, 0x09, 0x07, 0x13, 0x1f, 0x1f, 0x26, 0x26,
-    0x1f, 0x1f, 0x13, 0x07, 0x09, 0x09, 0x0e, 0x01, 0x90, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x7b, 0x05, 0x05, 0x22,
-    0x05, 0x01, 0x05, 0x05, 0x03, 0x1b, 0x25, 0x05, 0x03, 0x03, 0x02, 0x12,
-    0x12, 0x02, 0x03, 0x03, 0x05, 0x26, 0x1a, 0x03, 0x05, 0x05, 0x01, 0x05,
-    0x22, 0x05, 0x05, 0x22, 0x05, 0x01, 0x05, 0x05, 0x03, 0x1b, 0x25, 0x05,
-    0x03, 0x03, 0x02, 0x12, 0x12, 0x02, 0x03, 0x03, 0x05, 0x26, 0x1a, 0x03,
-    0x05, 0x05, 0x01, 0x05, 0x22, 0xaf, 0x0b, 0x0b, 0x02, 0x09, 0x09, 0x0d,
-    0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09, 0x09, 0x02, 0x00, 0x00,
-    0x00, 0x07, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x80, 0x01, 0xc0, 0x00, 0x1c,
-    0x00, 0x37, 0x00, 0x52, 0x00, 0x73, 0x00, 0x8a, 0x00, 0xc1, 0x00, 0xf8,
-    0x00, 0x00, 0x25, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x16,
-    0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x03, 0x06, 0x07, 0x31, 0x31,
-    0x06, 0x07, 0x26, 0x07, 0x06, 0x07, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x26, 0x27, 0x26, 0x07, 0x26, 0x27, 0x26, 0x27, 0x03, 0x06,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x35, 0x34, 0x37, 0x36, 0x37, 0x36,
-    0x37, 0x36, 0x37, 0x32, 0x15, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x14,
-    0x31, 0x21, 0x26, 0x23, 0x31, 0x31, 0x34, 0x23, 0x30, 0x31, 0x30, 0x35,
-    0x26, 0x27, 0x26, 0x27, 0x34, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x27, 0x27, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x37, 0x36,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x17, 0x16, 0x07, 0x27, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31,
-    0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37,
-    0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x02,
-    0x04, 0x02, 0x01, 0x05, 0x0c, 0x06, 0x07, 0x21, 0x3c, 0x3c, 0x4c, 0x4c,
-    0x3c, 0x3c, 0x21, 0x07, 0x06, 0x0c, 0x05, 0x01, 0x02, 0x16, 0x35, 0x34,
-    0x45, 0x45, 0x34, 0x35, 0x16, 0xc4, 0x4e, 0x37, 0x38, 0x0f, 0x0a, 0x0d,
-    0x0a, 0x10, 0x10, 0x45, 0x46, 0x62, 0x62, 0x46, 0x45, 0x10, 0x10, 0x0a,
-    0x0d, 0x0a, 0x0f, 0x38, 0x37, 0x4e, 0xf1, 0x0f, 0x12, 0x12, 0x0e, 0x0e,
-    0x0e, 0x06, 0x0e, 0x0e, 0x10, 0x14, 0x0e, 0x09, 0x02, 0x07, 0x06, 0x0a,
-    0x02, 0x01, 0x01, 0xe3, 0x01, 0x01, 0x01, 0x0b, 0x06, 0x07, 0x02, 0x09,
-    0x02, 0x01, 0x0d, 0x12, 0x10, 0x0e, 0x0e, 0x06, 0x0e, 0x0e, 0x0e, 0x12,
-    0x12, 0x0f, 0x7a, 0x13, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07,
-    0x09, 0x08, 0x0f, 0x2c, 0x32, 0x32, 0x2c, 0x0e, 0x09, 0x09, 0x07, 0x9d,
-    0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02,
-    0x01, 0x01, 0x03, 0x05, 0x06, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10,
-    0x01, 0x05, 0x06, 0x03, 0xa0, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0x03, 0x06, 0x05, 0x01, 0x10,
-    0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01, 0x06, 0x05, 0x03, 0x7a, 0x04, 0x04,
-    0x0e, 0x0d, 0x06, 0x04, 0x40, 0x26, 0x26, 0x01, 0x01, 0x26, 0x26, 0x40,
-    0x04, 0x06, 0x0d, 0x0d, 0x05, 0x04, 0x3d, 0x26, 0x26, 0x01, 0x01, 0x26,
-    0x26, 0x3d, 0x01, 0x16, 0x02, 0x2e, 0x2f, 0x4a, 0x05, 0x01, 0x02, 0x03,
-    0x5f, 0x3c, 0x3d, 0x02, 0x02, 0x3d, 0x3c, 0x5f, 0x03, 0x02, 0x01, 0x04,
-    0x49, 0x2f, 0x2e, 0x02, 0xfe, 0xdb, 0x0c, 0x01, 0x01, 0x0d, 0x0f, 0x13,
-    0x13, 0x0e, 0x07, 0x05, 0x05, 0x03, 0x04, 0x02, 0x09, 0x12, 0x1b, 0x1b,
-    0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x1b, 0x1b, 0x12, 0x09,
-    0x01, 0x01, 0x04, 0x03, 0x05, 0x05, 0x07, 0x0e, 0x13, 0x13, 0x0f, 0x0d,
-    0x01, 0x01, 0x0c, 0x04, 0x1c, 0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09,
-    0x09, 0x02, 0x0b, 0x0b, 0x02, 0x09, 0x09, 0x0d, 0x6c, 0x01, 0x02, 0x02,
-    0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x04,
-    0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06,
-    0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d,
-    0x06, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15,
-    0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x2a,
-    0x00, 0x45, 0x00, 0x58, 0x00, 0x6b, 0x00, 0x89, 0x00, 0x00, 0x25, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x26, 0x35, 0x35, 0x31, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16,
-    0x33, 0x32, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06, 0x07, 0x15, 0x31, 0x14,
-    0x07, 0x36, 0x37, 0x36, 0x37, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x37, 0x32, 0x17, 0x31,
-    0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x36,
-    0x37, 0x36, 0x33, 0x17, 0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x17, 0x35,
-    0x15, 0x35, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16, 0x17, 0x16, 0x17,
-    0x36, 0x37, 0x36, 0x37, 0x01, 0xd0, 0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b,
-    0x3b, 0x02, 0x01, 0x1f, 0x1f, 0x35, 0x04, 0x0d, 0x0a, 0x07, 0x09, 0x09,
-    0x0e, 0x2c, 0x32, 0x32, 0x2c, 0x0e, 0x09, 0x09, 0x07, 0x0a, 0x0d, 0x04,
-    0x35, 0x1f, 0x1f, 0x01, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xb0, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0x80, 0x01, 0x09,
-    0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0x10, 0x02, 0x19, 0x02, 0x12, 0x05, 0x03, 0x09, 0x09, 0x03, 0x05, 0x12,
-    0x02, 0x19, 0x02, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01, 0xc0,
-    0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58, 0x3e, 0x31, 0x31, 0x1a,
-    0x0c, 0x0e, 0x34, 0x0c, 0x0f, 0x0d, 0x09, 0x09, 0x02, 0x0b, 0x0b, 0x02,
-    0x09, 0x09, 0x0d, 0x0e, 0x0d, 0x34, 0x0e, 0x0c, 0x1a, 0x31, 0x31, 0x3e,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x50, 0x09, 0x09, 0x0e,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x20, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0xd0, 0x25,
-    0x25, 0x25, 0x19, 0x02, 0x01, 0x12, 0x09, 0x09, 0x12, 0x01, 0x02, 0x19,
-    0x25, 0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x00, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x2a,
-    0x00, 0x45, 0x00, 0x60, 0x00, 0x7a, 0x00, 0x98, 0x00, 0x00, 0x25, 0x26,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x26, 0x35, 0x35, 0x31, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x16,
-    0x17, 0x36, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06, 0x07, 0x15, 0x31, 0x14,
-    0x07, 0x36, 0x37, 0x36, 0x37, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x37, 0x34, 0x37, 0x31,
-    0x31, 0x36, 0x17, 0x17, 0x31, 0x16, 0x15, 0x14, 0x07, 0x07, 0x31, 0x06,
-    0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x35, 0x25,
-    0x36, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x07, 0x31, 0x17, 0x31,
-    0x16, 0x15, 0x14, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x35, 0x34, 0x37,
-    0x37, 0x03, 0x35, 0x15, 0x35, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x15, 0x31, 0x16,
-    0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x37, 0x01, 0xd0, 0x02, 0x3b, 0x3b,
-    0x58, 0x58, 0x3b, 0x3b, 0x02, 0x01, 0x1f, 0x1f, 0x35, 0x04, 0x25, 0x12,
-    0x03, 0x06, 0x07, 0x0a, 0x3c, 0x47, 0x48, 0x3c, 0x0a, 0x06, 0x07, 0x04,
-    0x12, 0x25, 0x04, 0x35, 0x1f, 0x1f, 0x01, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x74, 0x06, 0x05,
-    0x07, 0x59, 0x08, 0x08, 0x59, 0x07, 0x05, 0x06, 0x03, 0x24, 0x24, 0x03,
-    0x01, 0x07, 0x06, 0x05, 0x06, 0x03, 0x24, 0x24, 0x03, 0x06, 0x05, 0x06,
-    0x5a, 0x08, 0x08, 0x5a, 0x3b, 0x02, 0x19, 0x02, 0x12, 0x05, 0x03, 0x09,
-    0x09, 0x03, 0x05, 0x12, 0x02, 0x19, 0x02, 0x01, 0x12, 0x12, 0x1b, 0x1b,
-    0x12, 0x12, 0x01, 0xc0, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58,
-    0x3e, 0x31, 0x31, 0x1a, 0x0c, 0x0e, 0x17, 0x1b, 0x2a, 0x0a, 0x06, 0x06,
-    0x03, 0x12, 0x01, 0x01, 0x12, 0x03, 0x06, 0x06, 0x0a, 0x2a, 0x1b, 0x17,
-    0x0e, 0x0c, 0x1a, 0x31, 0x31, 0x3e, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x63, 0x07, 0x03, 0x03, 0x03, 0x30, 0x04, 0x09, 0x08, 0x05,
-    0x30, 0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 0x2b, 0x2b, 0x04, 0x04, 0x0a,
-    0x03, 0x03, 0x03, 0x07, 0x04, 0x04, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03,
-    0x03, 0x03, 0x30, 0x05, 0x08, 0x09, 0x04, 0x30, 0xfe, 0xf3, 0x25, 0x25,
-    0x25, 0x19, 0x02, 0x01, 0x12, 0x09, 0x09, 0x12, 0x01, 0x02, 0x19, 0x25,
-    0x1b, 0x12, 0x12, 0x01, 0x01, 0x12, 0x12, 0x1b, 0x00, 0x07, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x28, 0x00, 0x43, 0x00, 0x54,
-    0x00, 0x5d, 0x00, 0x6a, 0x00, 0x77, 0x00, 0x95, 0x00, 0x00, 0x25, 0x36,
-    0x35, 0x35, 0x31, 0x36, 0x37, 0x36, 0x27, 0x26, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x07, 0x06, 0x17, 0x16, 0x17, 0x15, 0x31, 0x14, 0x17, 0x26,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x06,
-    0x07, 0x06, 0x07, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x35,
-    0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x15,
-    0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x03, 0x32, 0x17, 0x16, 0x37, 0x36,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x17, 0x16, 0x37, 0x36, 0x37, 0x17,
-    0x36, 0x37, 0x26, 0x27, 0x06, 0x07, 0x16, 0x17, 0x35, 0x16, 0x17, 0x16,
-    0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x37, 0x36, 0x37, 0x15, 0x36, 0x37,
-    0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x07, 0x06,
-    0x07, 0x31, 0x31, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x35, 0x31, 0x36,
-    0x37, 0x33, 0x31, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x33,
-    0x31, 0x16, 0x17, 0x15, 0x01, 0x5c, 0x04, 0x0d, 0x0a, 0x07, 0x09, 0x09,
-    0x0e, 0x2c, 0x32, 0x32, 0x2c, 0x0f, 0x08, 0x09, 0x07, 0x0a, 0x0d, 0x04,
-    0x35, 0x1f, 0x1f, 0x01, 0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02,
-    0x01, 0x1f, 0x1f, 0x35, 0x5c, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x60, 0x10, 0x09, 0x0e, 0x0e, 0x0d, 0x0c, 0x17, 0x1f, 0x1f, 0x18,
-    0x0b, 0x0c, 0x0e, 0x0e, 0x09, 0x11, 0xb0, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x02, 0x16, 0x1b, 0x0e, 0x0d, 0x0d, 0x0e, 0x1b, 0x1b, 0x0f, 0x0d,
-    0x0d, 0x0f, 0x1b, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0x2d, 0x18, 0x16,
-    0x16, 0x18, 0x2d, 0x10, 0x01, 0x12, 0x12, 0x1b, 0x1b, 0x12, 0x12, 0x01,
-    0x02, 0x19, 0x02, 0x12, 0x05, 0x03, 0x09, 0x09, 0x03, 0x05, 0x12, 0x02,
-    0x19, 0x02, 0x06, 0x0c, 0x0e, 0x34, 0x0d, 0x0e, 0x0d, 0x09, 0x09, 0x02,
-    0x0b, 0x0b, 0x02, 0x09, 0x09, 0x0d, 0x0f, 0x0c, 0x34, 0x0e, 0x0c, 0x1a,
-    0x31, 0x31, 0x3e, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58, 0x3e,
-    0x31, 0x31, 0x1a, 0x46, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x01, 0x24, 0x0a, 0x0c, 0x0b, 0x0e, 0x0f, 0x16,
-    0x16, 0x0f, 0x0e, 0x0b, 0x0c, 0x09, 0x01, 0x0c, 0x02, 0x16, 0x16, 0x02,
-    0x02, 0x16, 0x16, 0x02, 0x48, 0x01, 0x17, 0x18, 0x18, 0x17, 0x01, 0x01,
-    0x17, 0x18, 0x18, 0x17, 0x01, 0x80, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01,
-    0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x80, 0x1b, 0x12, 0x12, 0x01, 0x01,
-    0x12, 0x12, 0x1b, 0x25, 0x19, 0x02, 0x01, 0x12, 0x09, 0x09, 0x12, 0x01,
-    0x02, 0x19, 0x25, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4c, 0x00, 0x5f, 0x00, 0x70,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x36, 0x17, 0x31,
-    0x31, 0x16, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26,
-    0x37, 0x36, 0x17, 0x16, 0x33, 0x32, 0x37, 0x27, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x17, 0x06, 0x27, 0x26, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16,
-    0x07, 0x06, 0x27, 0x26, 0x23, 0x22, 0x07, 0x01, 0xd0, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x5e, 0x0e, 0x09, 0x09,
-    0x07, 0x13, 0x1f, 0x1f, 0x26, 0x26, 0x1f, 0x1f, 0x13, 0x07, 0x09, 0x08,
-    0x0f, 0x2c, 0x32, 0x32, 0x2c, 0xce, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0xa6, 0x0e, 0x0e, 0x0c,
-    0x0b, 0x18, 0x1f, 0x1f, 0x17, 0x0b, 0x0c, 0x0e, 0x0e, 0x09, 0x10, 0x11,
-    0x09, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39,
-    0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24,
-    0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x34, 0x02, 0x09, 0x09, 0x0d, 0x1c,
-    0x12, 0x11, 0x11, 0x12, 0x1c, 0x0d, 0x09, 0x09, 0x02, 0x0b, 0x0b, 0x64,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x16, 0x0c, 0x0b, 0x0e, 0x0f, 0x16, 0x16, 0x0f, 0x0e, 0x0b, 0x0c, 0x0a,
-    0x0a, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0xb8, 0x00, 0xcb, 0x00, 0xde,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x05, 0x16, 0x15, 0x06,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16, 0x17, 0x16, 0x15, 0x06,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x26, 0x37, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x33, 0x30, 0x35, 0x32,
-    0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x30, 0x23, 0x27, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x26, 0x35, 0x34, 0x37, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30,
-    0x33, 0x34, 0x31, 0x32, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x30, 0x27, 0x30,
-    0x31, 0x22, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x26,
-    0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x27, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06,
-    0x23, 0x22, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x01, 0xd0, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x31, 0x07,
-    0x01, 0x06, 0x07, 0x0a, 0x04, 0x05, 0x05, 0x04, 0x0a, 0x07, 0x07, 0x01,
-    0x06, 0x07, 0x0a, 0x15, 0x1b, 0x06, 0x02, 0x01, 0x05, 0x01, 0x01, 0x01,
-    0x02, 0x04, 0x06, 0x06, 0x03, 0x04, 0x04, 0x03, 0x06, 0x06, 0x04, 0x02,
-    0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x06,
-    0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x02, 0x01, 0x01, 0x01, 0x05,
-    0x01, 0x02, 0x06, 0x1b, 0x15, 0x0a, 0x07, 0xa1, 0x01, 0x09, 0x09, 0x0d,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0xc0, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x09, 0x09,
-    0x0d, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39,
-    0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24,
-    0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x1a, 0x08, 0x0a, 0x0b, 0x07, 0x08,
-    0x06, 0x02, 0x02, 0x02, 0x02, 0x06, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x08,
-    0x06, 0x0b, 0x01, 0x06, 0x06, 0x03, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05,
-    0x05, 0x06, 0x03, 0x03, 0x06, 0x05, 0x05, 0x04, 0x03, 0x01, 0x01, 0x01,
-    0x02, 0x05, 0x05, 0x02, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06, 0x05,
-    0x03, 0x03, 0x06, 0x05, 0x05, 0x05, 0x02, 0x01, 0x01, 0x01, 0x03, 0x06,
-    0x06, 0x0c, 0x06, 0x08, 0x4a, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0xb8,
-    0x00, 0xef, 0x01, 0x26, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x05, 0x16, 0x15, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x16, 0x17, 0x16,
-    0x17, 0x16, 0x15, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x26,
-    0x37, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30,
-    0x33, 0x30, 0x35, 0x32, 0x31, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x30, 0x23, 0x34,
-    0x31, 0x22, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x26,
-    0x35, 0x34, 0x37, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x30, 0x33, 0x30, 0x35, 0x32, 0x31, 0x36, 0x37, 0x36,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x30, 0x23, 0x34, 0x31, 0x22, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x26, 0x37, 0x36, 0x33, 0x16, 0x17, 0x16, 0x17, 0x27,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30,
-    0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06,
-    0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14,
-    0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x23, 0x31,
-    0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07,
-    0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37,
-    0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe,
-    0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0x01, 0x31, 0x07, 0x01, 0x06, 0x07, 0x0a, 0x04, 0x05, 0x05, 0x04,
-    0x0a, 0x07, 0x07, 0x01, 0x06, 0x07, 0x0a, 0x15, 0x1b, 0x06, 0x02, 0x01,
-    0x05, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x06, 0x03, 0x04, 0x04, 0x03,
-    0x06, 0x06, 0x04, 0x02, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01,
-    0x02, 0x04, 0x06, 0x06, 0x03, 0x04, 0x04, 0x03, 0x06, 0x06, 0x04, 0x02,
-    0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x06, 0x1b, 0x15, 0x0a, 0x07, 0x57,
-    0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02,
-    0x01, 0x01, 0x03, 0x05, 0x06, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10,
-    0x01, 0x05, 0x06, 0x03, 0xa0, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e,
-    0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0x03, 0x06, 0x05, 0x01, 0x10,
-    0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01, 0x06, 0x05, 0x03, 0xc0, 0x39, 0x2f,
-    0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x2a, 0x08, 0x0a, 0x0b, 0x07, 0x08, 0x06, 0x02, 0x02, 0x02,
-    0x02, 0x06, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x08, 0x06, 0x0b, 0x01, 0x06,
-    0x06, 0x03, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x03, 0x03,
-    0x06, 0x05, 0x05, 0x04, 0x03, 0x01, 0x01, 0x01, 0x02, 0x05, 0x05, 0x02,
-    0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x03, 0x03, 0x06, 0x05,
-    0x05, 0x04, 0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x01, 0x0b, 0x06,
-    0x08, 0x45, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06,
-    0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02,
-    0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x04,
-    0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01,
-    0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02,
-    0x01, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x03,
-    0x01, 0xc0, 0x00, 0x2d, 0x00, 0xb0, 0x00, 0xc3, 0x00, 0xd4, 0x00, 0xf0,
-    0x00, 0x00, 0x25, 0x06, 0x23, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36,
-    0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x16, 0x17, 0x36, 0x17, 0x36,
-    0x35, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x07, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x32, 0x37, 0x26, 0x27, 0x27,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x22, 0x07, 0x06, 0x17, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x33, 0x30, 0x15, 0x32,
-    0x31, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x23, 0x14, 0x31, 0x22, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06,
-    0x15, 0x14, 0x17, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x30,
-    0x33, 0x30, 0x15, 0x32, 0x31, 0x16, 0x17, 0x16, 0x17, 0x16, 0x17, 0x16,
-    0x15, 0x14, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x23, 0x14,
-    0x31, 0x22, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x06, 0x17, 0x16, 0x33, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x37, 0x27,
-    0x32, 0x37, 0x31, 0x31, 0x36, 0x35, 0x34, 0x27, 0x26, 0x23, 0x22, 0x07,
-    0x06, 0x07, 0x16, 0x17, 0x16, 0x33, 0x37, 0x32, 0x17, 0x16, 0x37, 0x36,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x17, 0x16, 0x37, 0x36, 0x37, 0x17,
-    0x26, 0x27, 0x31, 0x31, 0x26, 0x07, 0x06, 0x07, 0x06, 0x17, 0x17, 0x31,
-    0x16, 0x37, 0x37, 0x31, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x26, 0x07,
-    0x07, 0x31, 0x27, 0x01, 0x53, 0x26, 0x2d, 0x58, 0x3b, 0x3b, 0x02, 0x02,
-    0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b, 0x02, 0x0a, 0x05, 0x03, 0x13, 0x11,
-    0x0e, 0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22,
-    0x01, 0x01, 0x22, 0x22, 0x3a, 0x39, 0x48, 0x35, 0x2f, 0x08, 0x03, 0x06,
-    0x2b, 0x01, 0x06, 0x07, 0x0a, 0x15, 0x1b, 0x06, 0x02, 0x01, 0x05, 0x01,
-    0x01, 0x01, 0x02, 0x04, 0x06, 0x06, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06,
-    0x04, 0x02, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x02, 0x04,
-    0x06, 0x06, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x04, 0x02, 0x01, 0x01,
-    0x01, 0x05, 0x01, 0x02, 0x06, 0x1b, 0x15, 0x0a, 0x07, 0x06, 0x01, 0x01,
-    0x06, 0x07, 0x0a, 0x04, 0x05, 0x05, 0x04, 0x0a, 0x07, 0x06, 0x01, 0x78,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x09,
-    0x09, 0x0d, 0xa0, 0x10, 0x09, 0x0e, 0x0e, 0x0d, 0x0c, 0x17, 0x1f, 0x1f,
-    0x18, 0x0b, 0x0c, 0x0e, 0x0e, 0x09, 0x11, 0x62, 0x05, 0x0e, 0x0f, 0x11,
-    0x11, 0x08, 0x09, 0x04, 0x17, 0x05, 0x0f, 0x55, 0x11, 0x08, 0x09, 0x05,
-    0x04, 0x0f, 0x0e, 0x12, 0x14, 0x05, 0x01, 0x11, 0x02, 0x3b, 0x3b, 0x58,
-    0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58, 0x22, 0x1e, 0x07, 0x08,
-    0x02, 0x07, 0x28, 0x2c, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01, 0x01, 0x22,
-    0x22, 0x3a, 0x39, 0x48, 0x48, 0x39, 0x3a, 0x22, 0x22, 0x01, 0x14, 0x09,
-    0x0b, 0x19, 0x83, 0x0b, 0x07, 0x08, 0x06, 0x0b, 0x01, 0x06, 0x06, 0x03,
-    0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x03, 0x03, 0x06, 0x05,
-    0x05, 0x04, 0x03, 0x01, 0x01, 0x01, 0x02, 0x05, 0x05, 0x02, 0x01, 0x01,
-    0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x03, 0x03, 0x06, 0x05, 0x05, 0x04,
-    0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0x06, 0x01, 0x0b, 0x06, 0x08, 0x07,
-    0x0b, 0x0a, 0x08, 0x08, 0x06, 0x02, 0x02, 0x02, 0x02, 0x06, 0x08, 0x07,
-    0x0b, 0x4c, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x14, 0x0a, 0x0c, 0x0b, 0x0e, 0x0f, 0x16, 0x16, 0x0f, 0x0e,
-    0x0b, 0x0c, 0x09, 0x01, 0x84, 0x11, 0x09, 0x09, 0x05, 0x05, 0x0f, 0x0f,
-    0x12, 0x59, 0x0e, 0x02, 0x18, 0x05, 0x0f, 0x10, 0x12, 0x11, 0x09, 0x09,
-    0x05, 0x05, 0x15, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x70,
-    0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32,
-    0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x17, 0x26, 0x37, 0x31,
-    0x31, 0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06,
-    0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x36, 0x37, 0x31, 0x31, 0x36, 0x33,
-    0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27,
-    0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x01, 0xd0, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37,
-    0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d,
-    0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x83, 0x03, 0x06, 0x07, 0x0b,
-    0xd5, 0x0b, 0x06, 0x07, 0x03, 0x0e, 0x22, 0x22, 0x2e, 0x2e, 0x22, 0x22,
-    0x0d, 0x0d, 0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x0d, 0x09, 0x09, 0x01, 0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d,
-    0x09, 0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0xc0, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x3a, 0x0b, 0x07, 0x08, 0x08, 0x07, 0x0b, 0x2a, 0x19, 0x1a, 0x01, 0x01,
-    0x1a, 0x19, 0x2a, 0x7a, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09,
-    0x09, 0x09, 0x09, 0x0e, 0x20, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4a,
-    0x00, 0x81, 0x00, 0xb8, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x17, 0x26, 0x37, 0x31, 0x31, 0x36, 0x33, 0x33, 0x31, 0x32, 0x17, 0x16,
-    0x07, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26, 0x27, 0x37, 0x31, 0x31,
-    0x31, 0x31, 0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30,
-    0x15, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26,
-    0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06,
-    0x27, 0x31, 0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x23, 0x31, 0x34, 0x31,
-    0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17,
-    0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x31, 0x31, 0x01,
-    0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01,
-    0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x83,
-    0x03, 0x06, 0x07, 0x0b, 0xd5, 0x0b, 0x06, 0x07, 0x03, 0x0e, 0x22, 0x22,
-    0x2e, 0x2e, 0x22, 0x22, 0x0d, 0x57, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0e,
-    0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0x03, 0x05, 0x06, 0x01,
-    0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01, 0x05, 0x06, 0x03, 0xa0, 0x01,
-    0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01,
-    0x01, 0x03, 0x06, 0x05, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01,
-    0x06, 0x05, 0x03, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x3a, 0x0b, 0x07, 0x08,
-    0x08, 0x07, 0x0b, 0x2a, 0x19, 0x1a, 0x01, 0x01, 0x1a, 0x19, 0x2a, 0x55,
-    0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02,
-    0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15,
-    0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d,
-    0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06,
-    0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4a, 0x00, 0x64, 0x00, 0x7d, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x17, 0x26, 0x37, 0x31, 0x31, 0x36, 0x33, 0x33,
-    0x31, 0x32, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x37, 0x17, 0x27, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x31, 0x06,
-    0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x17, 0x05, 0x14, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16, 0x15,
-    0x14, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31,
-    0x36, 0x17, 0x16, 0x15, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37,
-    0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31,
-    0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x83, 0x03, 0x06, 0x07, 0x0b, 0xd5, 0x0b, 0x06,
-    0x07, 0x03, 0x0e, 0x22, 0x22, 0x2e, 0x2e, 0x22, 0x22, 0x0d, 0x03, 0x59,
-    0x59, 0x59, 0x08, 0x08, 0x59, 0x07, 0x05, 0x06, 0x03, 0x24, 0x24, 0x03,
-    0x06, 0x05, 0x07, 0x01, 0x06, 0x03, 0x24, 0x24, 0x03, 0x06, 0x05, 0x06,
-    0x5a, 0x08, 0x08, 0x5a, 0x06, 0x05, 0x06, 0xc0, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c,
-    0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x3a, 0x0b, 0x07, 0x08, 0x08, 0x07, 0x0b, 0x2a, 0x19, 0x1a, 0x01, 0x01,
-    0x1a, 0x19, 0x2a, 0xb7, 0x30, 0x30, 0x30, 0x04, 0x09, 0x08, 0x05, 0x30,
-    0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 0x2b, 0x2b, 0x04, 0x04, 0x07, 0x03,
-    0x03, 0x03, 0x0a, 0x04, 0x04, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03, 0x03,
-    0x03, 0x30, 0x05, 0x08, 0x09, 0x04, 0x30, 0x03, 0x03, 0x03, 0x07, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x4a, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x17, 0x26, 0x37, 0x31, 0x31, 0x36, 0x33, 0x33,
-    0x31, 0x32, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26,
-    0x27, 0x37, 0x36, 0x37, 0x31, 0x31, 0x36, 0x33, 0x32, 0x17, 0x16, 0x15,
-    0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x17, 0x06, 0x27, 0x26,
-    0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x07, 0x06, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe,
-    0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21,
-    0x01, 0x83, 0x03, 0x06, 0x07, 0x0b, 0xd5, 0x0b, 0x06, 0x07, 0x03, 0x0e,
-    0x22, 0x22, 0x2e, 0x2e, 0x22, 0x22, 0x0d, 0x0d, 0x01, 0x09, 0x09, 0x0d,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0xa6, 0x0e,
-    0x0e, 0x0c, 0x0b, 0x18, 0x1f, 0x1f, 0x17, 0x0b, 0x0c, 0x0e, 0x0e, 0x09,
-    0x10, 0x11, 0x09, 0xc0, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f,
-    0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a,
-    0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x3a, 0x0b, 0x07, 0x08,
-    0x08, 0x07, 0x0b, 0x2a, 0x19, 0x1a, 0x01, 0x01, 0x1a, 0x19, 0x2a, 0x7a,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e,
-    0x16, 0x0c, 0x0b, 0x0e, 0x0f, 0x16, 0x16, 0x0f, 0x0e, 0x0b, 0x0c, 0x0a,
-    0x0a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x00,
-    0x01, 0x22, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x34, 0x27, 0x26,
-    0x27, 0x26, 0x23, 0x05, 0x06, 0x07, 0x31, 0x31, 0x06, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x36, 0x33,
-    0x32, 0x17, 0x16, 0x17, 0x16, 0x17, 0x25, 0x36, 0x37, 0x31, 0x31, 0x36,
-    0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26,
-    0x27, 0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23,
-    0x22, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x01, 0x00, 0x39, 0x2f,
-    0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d,
-    0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x01, 0x00, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xfe, 0x90, 0x01, 0x09,
-    0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0xc0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x01,
-    0x09, 0x09, 0x0d, 0x01, 0x90, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xd0, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46,
-    0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x30, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x00, 0x07, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x42, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x8b, 0x00, 0x98,
-    0x00, 0x00, 0x01, 0x32, 0x17, 0x31, 0x31, 0x16, 0x17, 0x16, 0x15, 0x14,
-    0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x37, 0x36, 0x33, 0x11, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37,
-    0x36, 0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07,
-    0x06, 0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x27, 0x16, 0x17, 0x33,
-    0x31, 0x36, 0x37, 0x26, 0x27, 0x23, 0x31, 0x06, 0x07, 0x27, 0x26, 0x27,
-    0x31, 0x31, 0x26, 0x27, 0x36, 0x37, 0x14, 0x15, 0x30, 0x31, 0x14, 0x17,
-    0x16, 0x33, 0x32, 0x37, 0x36, 0x35, 0x34, 0x35, 0x30, 0x31, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x15, 0x36, 0x37, 0x36, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x06, 0x17, 0x16, 0x17, 0x37, 0x26, 0x27, 0x31, 0x31, 0x26, 0x27,
-    0x36, 0x37, 0x14, 0x15, 0x14, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x35,
-    0x34, 0x35, 0x30, 0x31, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x15, 0x36,
-    0x37, 0x36, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x17, 0x16, 0x17, 0x01,
-    0x00, 0x39, 0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a,
-    0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x58, 0x02, 0x16, 0x80, 0x16, 0x02, 0x02,
-    0x16, 0x80, 0x16, 0x02, 0x08, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x09,
-    0x09, 0x0e, 0x0e, 0x09, 0x09, 0x0f, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x2d,
-    0x18, 0x16, 0x16, 0x18, 0x2d, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0xc0,
-    0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09,
-    0x0f, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d,
-    0x2d, 0x18, 0x16, 0x16, 0x18, 0x2d, 0x01, 0x90, 0x1c, 0x1b, 0x31, 0x31,
-    0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37,
-    0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x88, 0x16, 0x02, 0x02, 0x16, 0x16,
-    0x02, 0x02, 0x16, 0x68, 0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e, 0x02, 0x02,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x02, 0x02, 0x0e, 0x16, 0x14, 0x0e,
-    0x0d, 0x01, 0x20, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x01, 0x27, 0x28,
-    0x28, 0x27, 0x01, 0x20, 0x01, 0x0d, 0x0e, 0x14, 0x16, 0x0e, 0x02, 0x02,
-    0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x02, 0x02, 0x0e, 0x16, 0x14, 0x0e,
-    0x0d, 0x01, 0x20, 0x01, 0x27, 0x28, 0x28, 0x27, 0x01, 0x01, 0x27, 0x28,
-    0x28, 0x27, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00,
-    0x01, 0xc0, 0x00, 0x25, 0x00, 0x40, 0x00, 0x51, 0x00, 0x62, 0x00, 0x78,
-    0x00, 0x00, 0x25, 0x35, 0x15, 0x35, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31,
-    0x06, 0x23, 0x26, 0x27, 0x35, 0x31, 0x26, 0x27, 0x06, 0x07, 0x15, 0x31,
-    0x26, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17,
-    0x14, 0x07, 0x06, 0x07, 0x07, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36,
-    0x35, 0x34, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x17, 0x03, 0x32, 0x17, 0x16, 0x37,
-    0x36, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x17, 0x16, 0x37, 0x36, 0x37,
-    0x17, 0x36, 0x33, 0x32, 0x17, 0x16, 0x37, 0x36, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x17, 0x16, 0x37, 0x07, 0x15, 0x35, 0x15, 0x16, 0x17, 0x16,
-    0x17, 0x36, 0x37, 0x36, 0x37, 0x35, 0x31, 0x26, 0x27, 0x26, 0x27, 0x06,
-    0x07, 0x06, 0x07, 0x01, 0x90, 0x02, 0x16, 0x16, 0x02, 0x2c, 0x34, 0x34,
-    0x2c, 0x02, 0x16, 0x16, 0x02, 0x1e, 0x11, 0x11, 0x02, 0x3b, 0x3b, 0x58,
-    0x58, 0x3b, 0x3b, 0x02, 0x11, 0x11, 0x1e, 0x90, 0x46, 0x3a, 0x3a, 0x24,
-    0x22, 0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x60, 0x10, 0x09, 0x0e, 0x0e, 0x0d, 0x0c, 0x17,
-    0x1f, 0x1f, 0x18, 0x0b, 0x0c, 0x0e, 0x0e, 0x09, 0x11, 0xa6, 0x09, 0x11,
-    0x10, 0x09, 0x0e, 0x0e, 0x0d, 0x0c, 0x17, 0x1f, 0x1f, 0x18, 0x0b, 0x0c,
-    0x0e, 0x0e, 0x76, 0x01, 0x0d, 0x0e, 0x14, 0x14, 0x0e, 0x0d, 0x01, 0x01,
-    0x0d, 0x0e, 0x14, 0x14, 0x0e, 0x0d, 0x01, 0x2a, 0x76, 0x76, 0x76, 0x16,
-    0x02, 0x02, 0x16, 0x99, 0x17, 0x01, 0x16, 0x99, 0x16, 0x02, 0x02, 0x16,
-    0x76, 0x1d, 0x26, 0x26, 0x2d, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b,
-    0x58, 0x2d, 0x26, 0x26, 0x1d, 0x6a, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43,
-    0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x24, 0x0a, 0x0c, 0x0b, 0x0e,
-    0x0f, 0x16, 0x16, 0x0f, 0x0e, 0x0b, 0x0c, 0x09, 0x01, 0x0a, 0x0a, 0x0a,
-    0x0c, 0x0b, 0x0e, 0x0f, 0x16, 0x16, 0x0f, 0x0e, 0x0b, 0x0c, 0x5a, 0x20,
-    0x20, 0x20, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x20, 0x14,
-    0x0e, 0x0d, 0x01, 0x01, 0x0d, 0x0e, 0x14, 0x00, 0x00, 0x06, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x16, 0x00, 0x31, 0x00, 0x46,
-    0x00, 0x53, 0x00, 0x66, 0x00, 0x79, 0x00, 0x00, 0x37, 0x22, 0x27, 0x31,
-    0x31, 0x26, 0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16,
-    0x17, 0x06, 0x07, 0x06, 0x07, 0x22, 0x27, 0x27, 0x16, 0x17, 0x31, 0x31,
-    0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x37, 0x26, 0x27,
-    0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x07, 0x17, 0x16,
-    0x17, 0x31, 0x31, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26,
-    0x27, 0x26, 0x07, 0x06, 0x07, 0x06, 0x07, 0x37, 0x06, 0x07, 0x16, 0x17,
-    0x16, 0x17, 0x16, 0x37, 0x36, 0x27, 0x26, 0x27, 0x37, 0x14, 0x17, 0x31,
-    0x31, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x26, 0x27, 0x26, 0x23, 0x22,
-    0x07, 0x06, 0x15, 0x07, 0x32, 0x37, 0x31, 0x31, 0x36, 0x37, 0x26, 0x27,
-    0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16, 0x33, 0xb0, 0x1b,
-    0x14, 0x15, 0x08, 0x32, 0x02, 0x02, 0x3b, 0x3b, 0x58, 0x58, 0x3b, 0x3b,
-    0x02, 0x02, 0x3b, 0x3b, 0x58, 0x2b, 0x25, 0xb0, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c,
-    0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x80, 0x01, 0x0d, 0x0e,
-    0x14, 0x14, 0x0e, 0x0d, 0x01, 0x01, 0x0f, 0x0e, 0x0c, 0x06, 0x06, 0x0c,
-    0x0e, 0x0f, 0x01, 0x80, 0x16, 0x02, 0x02, 0x16, 0x2f, 0x21, 0x12, 0x10,
-    0x0d, 0x0f, 0x2e, 0x42, 0x30, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01,
-    0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x80, 0x0d, 0x09, 0x09, 0x01,
-    0x01, 0x09, 0x09, 0x0d, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x00, 0x0f,
-    0x0f, 0x19, 0x38, 0x51, 0x58, 0x3b, 0x3b, 0x02, 0x02, 0x3b, 0x3b, 0x58,
-    0x58, 0x3b, 0x3b, 0x02, 0x10, 0xc0, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22,
-    0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a,
-    0x3a, 0x46, 0x71, 0x14, 0x0d, 0x0e, 0x0e, 0x0d, 0x14, 0x10, 0x18, 0x17,
-    0x0f, 0x06, 0x06, 0x0f, 0x17, 0x18, 0x10, 0x41, 0x02, 0x16, 0x16, 0x02,
-    0x01, 0x1e, 0x0d, 0x0f, 0x12, 0x10, 0x2a, 0x01, 0x60, 0x0e, 0x09, 0x09,
-    0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x20, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x00, 0x00,
-    0x00, 0x05, 0x00, 0x00, 0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a,
-    0x00, 0x35, 0x00, 0x50, 0x00, 0x87, 0x00, 0xbe, 0x00, 0x00, 0x25, 0x34,
-    0x27, 0x31, 0x31, 0x26, 0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06,
-    0x15, 0x14, 0x17, 0x16, 0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36,
-    0x35, 0x21, 0x36, 0x37, 0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17,
-    0x16, 0x17, 0x16, 0x17, 0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x26, 0x27, 0x17, 0x16, 0x17, 0x31, 0x31, 0x16, 0x17, 0x36,
-    0x37, 0x36, 0x37, 0x36, 0x17, 0x16, 0x07, 0x06, 0x07, 0x06, 0x07, 0x26,
-    0x27, 0x26, 0x27, 0x26, 0x37, 0x36, 0x17, 0x37, 0x31, 0x31, 0x31, 0x31,
-    0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31, 0x26, 0x27, 0x26, 0x27, 0x26,
-    0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x30, 0x31, 0x30, 0x15, 0x23,
-    0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36,
-    0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x31,
-    0x31, 0x31, 0x33, 0x31, 0x31, 0x31, 0x23, 0x31, 0x34, 0x31, 0x30, 0x31,
-    0x26, 0x27, 0x26, 0x27, 0x26, 0x27, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07,
-    0x30, 0x31, 0x30, 0x15, 0x23, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
-    0x06, 0x27, 0x26, 0x35, 0x36, 0x37, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17,
-    0x14, 0x07, 0x06, 0x27, 0x31, 0x31, 0x31, 0x31, 0x31, 0x01, 0xd0, 0x1c,
-    0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31,
-    0x31, 0x37, 0x37, 0x31, 0x31, 0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22,
-    0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c, 0x22, 0x21, 0x01, 0xb2, 0x0b, 0x14,
-    0x13, 0x1c, 0x1c, 0x13, 0x14, 0x0b, 0x11, 0x11, 0x0f, 0x0d, 0x11, 0x1c,
-    0x1d, 0x28, 0x28, 0x1d, 0x1c, 0x11, 0x0d, 0x0f, 0x11, 0x11, 0x28, 0x01,
-    0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e, 0x0e, 0x06, 0x04, 0x02, 0x01,
-    0x01, 0x03, 0x05, 0x06, 0x01, 0x10, 0x0f, 0x18, 0x18, 0x0f, 0x10, 0x01,
-    0x05, 0x06, 0x03, 0xa0, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0e, 0x0e, 0x0e,
-    0x0e, 0x06, 0x04, 0x02, 0x01, 0x01, 0x03, 0x06, 0x05, 0x01, 0x10, 0x0f,
-    0x18, 0x18, 0x0f, 0x10, 0x01, 0x06, 0x05, 0x03, 0xc0, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f, 0x1d, 0x1c,
-    0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24, 0x3a, 0x3a,
-    0x46, 0x3e, 0x0d, 0x0a, 0x0a, 0x01, 0x01, 0x0a, 0x0a, 0x0d, 0x0f, 0x0e,
-    0x10, 0x12, 0x12, 0x0f, 0x0f, 0x01, 0x01, 0x0f, 0x0f, 0x12, 0x12, 0x10,
-    0x0e, 0x0f, 0x59, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d,
-    0x06, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x06, 0x1c, 0x15, 0x15,
-    0x02, 0x02, 0x15, 0x15, 0x1c, 0x06, 0x02, 0x01, 0x04, 0x01, 0x02, 0x02,
-    0x04, 0x06, 0x0d, 0x01, 0x01, 0x0d, 0x06, 0x04, 0x02, 0x02, 0x01, 0x04,
-    0x01, 0x02, 0x06, 0x1c, 0x15, 0x15, 0x02, 0x02, 0x15, 0x15, 0x1c, 0x06,
-    0x02, 0x01, 0x04, 0x00, 0x00, 0x02, 0x00, 0x15, 0xff, 0xbc, 0x02, 0x2b,
-    0x01, 0xc0, 0x00, 0x27, 0x00, 0x3b, 0x00, 0x00, 0x01, 0x26, 0x27, 0x06,
-    0x07, 0x07, 0x31, 0x07, 0x31, 0x06, 0x07, 0x06, 0x17, 0x17, 0x31, 0x07,
-    0x31, 0x06, 0x17, 0x16, 0x37, 0x37, 0x31, 0x17, 0x31, 0x16, 0x37, 0x36,
-    0x27, 0x27, 0x31, 0x37, 0x31, 0x36, 0x27, 0x26, 0x27, 0x27, 0x31, 0x27,
-    0x03, 0x11, 0x11, 0x11, 0x17, 0x31, 0x16, 0x17, 0x17, 0x31, 0x07, 0x31,
-    0x06, 0x17, 0x17, 0x31, 0x27, 0x31, 0x26, 0x23, 0x01, 0x36, 0x07, 0x0f,
-    0x0f, 0x07, 0x44, 0x99, 0x0f, 0x05, 0x04, 0x0a, 0x6f, 0x1a, 0x02, 0x0c,
-    0x0c, 0x0d, 0x89, 0x89, 0x0d, 0x0c, 0x0c, 0x02, 0x1a, 0x6f, 0x0a, 0x04,
-    0x05, 0x0f, 0x99, 0x44, 0x16, 0x35, 0x05, 0x0d, 0x76, 0x56, 0x08, 0x01,
-    0x14, 0x69, 0x05, 0x06, 0x01, 0xb2, 0x0d, 0x01, 0x01, 0x0d, 0x8d, 0x17,
-    0x02, 0x0e, 0x0e, 0x0a, 0x6e, 0x9c, 0x0e, 0x09, 0x09, 0x07, 0x49, 0x49,
-    0x07, 0x09, 0x09, 0x0e, 0x9c, 0x6e, 0x0a, 0x0e, 0x0e, 0x03, 0x16, 0x8d,
-    0xfe, 0x8d, 0x01, 0x32, 0xfe, 0xce, 0x01, 0x32, 0x6c, 0x0b, 0x03, 0x11,
-    0x55, 0x09, 0x0c, 0x78, 0x38, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x48,
-    0x00, 0x5b, 0x00, 0x68, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x37, 0x32, 0x17, 0x31, 0x31, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22,
-    0x27, 0x26, 0x27, 0x36, 0x37, 0x36, 0x33, 0x17, 0x36, 0x37, 0x31, 0x31,
-    0x36, 0x33, 0x32, 0x17, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x22, 0x27,
-    0x26, 0x27, 0x07, 0x16, 0x17, 0x16, 0x07, 0x06, 0x07, 0x26, 0x27, 0x26,
-    0x37, 0x36, 0x37, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31,
-    0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31, 0x1b,
-    0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d, 0x3c,
-    0x22, 0x21, 0x01, 0xb0, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09,
-    0x09, 0x01, 0x01, 0x09, 0x09, 0x0d, 0x80, 0x01, 0x09, 0x09, 0x0d, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x0d, 0x09, 0x09, 0x01, 0x30, 0x24, 0x13,
-    0x12, 0x12, 0x13, 0x24, 0x24, 0x13, 0x12, 0x12, 0x13, 0x24, 0xc0, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x50, 0x09, 0x09, 0x0e, 0x0e, 0x09, 0x09, 0x09, 0x09,
-    0x0e, 0x0e, 0x09, 0x09, 0x20, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x0e, 0x0e,
-    0x09, 0x09, 0x09, 0x09, 0x0e, 0x50, 0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01,
-    0x01, 0x1f, 0x20, 0x20, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-    0xff, 0xc0, 0x02, 0x00, 0x01, 0xc0, 0x00, 0x1a, 0x00, 0x35, 0x00, 0x4e,
-    0x00, 0x68, 0x00, 0x81, 0x00, 0x00, 0x25, 0x34, 0x27, 0x31, 0x31, 0x26,
-    0x27, 0x26, 0x23, 0x22, 0x07, 0x06, 0x07, 0x06, 0x15, 0x14, 0x17, 0x16,
-    0x17, 0x16, 0x33, 0x32, 0x37, 0x36, 0x37, 0x36, 0x35, 0x21, 0x36, 0x37,
-    0x31, 0x31, 0x36, 0x37, 0x36, 0x33, 0x32, 0x17, 0x16, 0x17, 0x16, 0x17,
-    0x06, 0x07, 0x06, 0x07, 0x06, 0x23, 0x22, 0x27, 0x26, 0x27, 0x26, 0x27,
-    0x17, 0x36, 0x37, 0x16, 0x17, 0x16, 0x17, 0x14, 0x07, 0x06, 0x27, 0x27,
-    0x31, 0x26, 0x23, 0x22, 0x07, 0x07, 0x31, 0x06, 0x27, 0x26, 0x35, 0x36,
-    0x37, 0x27, 0x17, 0x27, 0x17, 0x16, 0x15, 0x14, 0x07, 0x07, 0x31, 0x06,
-    0x27, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31, 0x27, 0x31, 0x26, 0x35, 0x34,
-    0x37, 0x36, 0x17, 0x05, 0x14, 0x07, 0x07, 0x31, 0x17, 0x31, 0x16, 0x15,
-    0x14, 0x07, 0x06, 0x27, 0x27, 0x31, 0x26, 0x35, 0x34, 0x37, 0x37, 0x31,
-    0x36, 0x17, 0x16, 0x15, 0x01, 0xd0, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37,
-    0x31, 0x31, 0x1b, 0x1c, 0x1c, 0x1b, 0x31, 0x31, 0x37, 0x37, 0x31, 0x31,
-    0x1b, 0x1c, 0xfe, 0x30, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0x01, 0x21, 0x22, 0x3c, 0x3d, 0x43, 0x43, 0x3d,
-    0x3c, 0x22, 0x21, 0x01, 0xb1, 0x1e, 0x31, 0x31, 0x1f, 0x1e, 0x02, 0x07,
-    0x07, 0x08, 0x12, 0x22, 0x26, 0x26, 0x22, 0x12, 0x08, 0x07, 0x07, 0x02,
-    0x1e, 0x2a, 0x59, 0x59, 0x59, 0x08, 0x08, 0x59, 0x07, 0x05, 0x06, 0x03,
-    0x24, 0x24, 0x03, 0x06, 0x05, 0x07, 0x01, 0x06, 0x03, 0x24, 0x24, 0x03,
-    0x06, 0x05, 0x06, 0x5a, 0x08, 0x08, 0x5a, 0x06, 0x05, 0x06, 0xc0, 0x39,
-    0x2f, 0x2f, 0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x39, 0x2f, 0x2f,
-    0x1d, 0x1c, 0x1c, 0x1d, 0x2f, 0x2f, 0x39, 0x46, 0x3a, 0x3a, 0x24, 0x22,
-    0x22, 0x24, 0x3a, 0x3a, 0x46, 0x46, 0x3a, 0x3a, 0x24, 0x22, 0x22, 0x24,
-    0x3a, 0x3a, 0x46, 0x40, 0x1d, 0x03, 0x03, 0x1d, 0x1d, 0x23, 0x08, 0x05,
-    0x05, 0x03, 0x08, 0x0f, 0x0f, 0x08, 0x03, 0x05, 0x05, 0x08, 0x23, 0x1d,
-    0xad, 0x30, 0x30, 0x30, 0x04, 0x09, 0x09, 0x04, 0x30, 0x03, 0x03, 0x03,
-    0x07, 0x05, 0x03, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x0a,
-    0x04, 0x04, 0x2b, 0x2b, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x30, 0x05,
-    0x08, 0x09, 0x04, 0x30, 0x03, 0x03, 0x03, 0x07, 0x00, 0x00, 0x00, 0x16,
-    0x01, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
-    0x00, 0xe3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
-    0x00, 0x3c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x21,
-    0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1b,
-    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x32,
-    0x00, 0x9a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18,
-    0x00, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x2c,
-    0x00, 0x6e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x17,
-    0x00, 0xcc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x13,
-    0x00, 0x43, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x07,
-    0x00, 0x3c, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x34,
-    0x02, 0xc3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x36,
-    0x00, 0xfd, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e,
-    0x01, 0x75, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x42,
-    0x01, 0x33, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x36,
-    0x00, 0xfd, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x64,
-    0x02, 0x31, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x30,
-    0x01, 0xa9, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0a, 0x00, 0x58,
-    0x01, 0xd9, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x2e,
-    0x02, 0x95, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x10, 0x00, 0x26,
-    0x01, 0x83, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x11, 0x00, 0x0e,
-    0x01, 0x75, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77, 0x65, 0x73, 0x6f,
-    0x6d, 0x65, 0x20, 0x36, 0x20, 0x46, 0x72, 0x65, 0x65, 0x20, 0x52, 0x65,
-    0x67, 0x75, 0x6c, 0x61, 0x72, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77,
-    0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x36, 0x20, 0x46, 0x72, 0x65, 0x65,
-    0x20, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x36, 0x2e, 0x35,
-    0x2e, 0x32, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x46, 0x6f, 0x6e,
-    0x74, 0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x36, 0x20,
-    0x46, 0x72, 0x65, 0x65, 0x46, 0x6f, 0x6e, 0x74, 0x41, 0x77, 0x65, 0x73,
-    0x6f, 0x6d, 0x65, 0x36, 0x46, 0x72, 0x65, 0x65, 0x2d, 0x52, 0x65, 0x67,
-    0x75, 0x6c, 0x61, 0x72, 0x54, 0x68, 0x65, 0x20, 0x77, 0x65, 0x62, 0x27,
-    0x73, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x70, 0x6f, 0x70, 0x75, 0x6c,
-    0x61, 0x72, 0x20, 0x69, 0x63, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x20,
-    0x61, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2e,
-    0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x37, 0x37, 0x33, 0x2e,
-    0x30, 0x31, 0x39, 0x35, 0x33, 0x31, 0x32, 0x35, 0x20, 0x28, 0x46, 0x6f,
-    0x6e, 0x74, 0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x76,
-    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x36, 0x2e, 0x35, 0x2e,
-    0x32, 0x29, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x66, 0x6f,
-    0x6e, 0x74, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2e, 0x63, 0x6f,
-    0x6d, 0x43, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28,
-    0x63, 0x29, 0x20, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77, 0x65, 0x73,
-    0x6f, 0x6d, 0x65, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00,
-    0x20, 0x00, 0x41, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00, 0x6f, 0x00,
-    0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x36, 0x00, 0x20, 0x00, 0x46, 0x00,
-    0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00,
-    0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x46, 0x00,
-    0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x77, 0x00,
-    0x65, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00,
-    0x36, 0x00, 0x20, 0x00, 0x46, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00,
-    0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00,
-    0x61, 0x00, 0x72, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x2e, 0x00, 0x35, 0x00,
-    0x2e, 0x00, 0x32, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
-    0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00,
-    0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00,
-    0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x36, 0x00, 0x20, 0x00,
-    0x46, 0x00, 0x72, 0x00, 0x65, 0x00, 0x65, 0x00, 0x46, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x74, 0x00, 0x41, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00,
-    0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x36, 0x00, 0x46, 0x00, 0x72, 0x00,
-    0x65, 0x00, 0x65, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
-    0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x54, 0x00, 0x68, 0x00,
-    0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x65, 0x00, 0x62, 0x00, 0x27, 0x00,
-    0x73, 0x00, 0x20, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x73, 0x00, 0x74, 0x00,
-    0x20, 0x00, 0x70, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x75, 0x00, 0x6c, 0x00,
-    0x61, 0x00, 0x72, 0x00, 0x20, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x20, 0x00, 0x73, 0x00, 0x65, 0x00, 0x74, 0x00, 0x20, 0x00,
-    0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x74, 0x00, 0x6f, 0x00,
-    0x6f, 0x00, 0x6c, 0x00, 0x6b, 0x00, 0x69, 0x00, 0x74, 0x00, 0x2e, 0x00,
-    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x20, 0x00, 0x37, 0x00, 0x37, 0x00, 0x33, 0x00, 0x2e, 0x00,
-    0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x35, 0x00, 0x33, 0x00, 0x31, 0x00,
-    0x32, 0x00, 0x35, 0x00, 0x20, 0x00, 0x28, 0x00, 0x46, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x77, 0x00, 0x65, 0x00,
-    0x73, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x20, 0x00, 0x76, 0x00,
-    0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00,
-    0x3a, 0x00, 0x20, 0x00, 0x36, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x2e, 0x00,
-    0x32, 0x00, 0x29, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
-    0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x66, 0x00, 0x6f, 0x00,
-    0x6e, 0x00, 0x74, 0x00, 0x61, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00,
-    0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00,
-    0x6d, 0x00, 0x43, 0x00, 0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00,
-    0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x28, 0x00,
-    0x63, 0x00, 0x29, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00,
-    0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x77, 0x00, 0x65, 0x00, 0x73, 0x00,
-    0x6f, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x01, 0x02, 0x01, 0x03,
-    0x01, 0x04, 0x00, 0x08, 0x00, 0x0d, 0x00, 0x0e, 0x01, 0x05, 0x01, 0x06,
-    0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0c,
-    0x01, 0x0d, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x10, 0x01, 0x11, 0x00, 0x22,
-    0x00, 0x23, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16,
-    0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c,
-    0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x20, 0x01, 0x21, 0x01, 0x22,
-    0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27, 0x01, 0x28,
-    0x01, 0x29, 0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e,
-    0x01, 0x2f, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34,
-    0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3a,
-    0x01, 0x3b, 0x01, 0x3c, 0x01, 0x3d, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40,
-    0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46,
-    0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c,
-    0x01, 0x4d, 0x01, 0x4e, 0x01, 0x4f, 0x01, 0x50, 0x01, 0x51, 0x01, 0x52,
-    0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58,
-    0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x01, 0x5c, 0x01, 0x5d, 0x01, 0x5e,
-    0x01, 0x5f, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64,
-    0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6a,
-    0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x01, 0x70,
-    0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76,
-    0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a, 0x01, 0x7b, 0x01, 0x7c,
-    0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x01, 0x81, 0x01, 0x82,
-    0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88,
-    0x01, 0x89, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d, 0x01, 0x8e,
-    0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93, 0x01, 0x94,
-    0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9a,
-    0x01, 0x9b, 0x01, 0x9c, 0x01, 0x9d, 0x01, 0x9e, 0x01, 0x9f, 0x01, 0xa0,
-    0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x01, 0xa4, 0x01, 0xa5, 0x01, 0xa6,
-    0x01, 0xa7, 0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xac,
-    0x01, 0xad, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2,
-    0x01, 0xb3, 0x01, 0xb4, 0x01, 0xb5, 0x01, 0xb6, 0x01, 0xb7, 0x01, 0xb8,
-    0x01, 0xb9, 0x01, 0xba, 0x01, 0xbb, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe,
-    0x01, 0xbf, 0x01, 0xc0, 0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4,
-    0x01, 0xc5, 0x01, 0xc6, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca,
-    0x01, 0xcb, 0x01, 0xcc, 0x01, 0xcd, 0x01, 0xce, 0x01, 0xcf, 0x0b, 0x65,
-    0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x07, 0x68,
-    0x61, 0x73, 0x68, 0x74, 0x61, 0x67, 0x0b, 0x64, 0x6f, 0x6c, 0x6c, 0x61,
-    0x72, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32,
-    0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38,
-    0x01, 0x39, 0x09, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61, 0x6e,
-    0x06, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x73, 0x0c, 0x67, 0x72, 0x65, 0x61,
-    0x74, 0x65, 0x72, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x01, 0x61, 0x01, 0x62,
-    0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67, 0x01, 0x68,
-    0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x01, 0x6c, 0x01, 0x6d, 0x01, 0x6e,
-    0x01, 0x6f, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74,
-    0x01, 0x75, 0x01, 0x76, 0x01, 0x77, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7a,
-    0x0d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x73,
-    0x65, 0x64, 0x06, 0x6e, 0x6f, 0x74, 0x64, 0x65, 0x66, 0x05, 0x68, 0x65,
-    0x61, 0x72, 0x74, 0x04, 0x73, 0x74, 0x61, 0x72, 0x04, 0x75, 0x73, 0x65,
-    0x72, 0x05, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x0e, 0x72, 0x65, 0x63, 0x74,
-    0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x04, 0x66,
-    0x6c, 0x61, 0x67, 0x08, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 0x61, 0x72, 0x6b,
-    0x05, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x0d, 0x70, 0x65, 0x6e, 0x2d, 0x74,
-    0x6f, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x0c, 0x63, 0x69, 0x72,
-    0x63, 0x6c, 0x65, 0x2d, 0x78, 0x6d, 0x61, 0x72, 0x6b, 0x0c, 0x63, 0x69,
-    0x72, 0x63, 0x6c, 0x65, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0f, 0x63,
-    0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69,
-    0x6f, 0x6e, 0x03, 0x65, 0x79, 0x65, 0x09, 0x65, 0x79, 0x65, 0x2d, 0x73,
-    0x6c, 0x61, 0x73, 0x68, 0x0d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61,
-    0x72, 0x2d, 0x64, 0x61, 0x79, 0x73, 0x07, 0x63, 0x6f, 0x6d, 0x6d, 0x65,
-    0x6e, 0x74, 0x06, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x0b, 0x66, 0x6f,
-    0x6c, 0x64, 0x65, 0x72, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x09, 0x63, 0x68,
-    0x61, 0x72, 0x74, 0x2d, 0x62, 0x61, 0x72, 0x08, 0x63, 0x6f, 0x6d, 0x6d,
-    0x65, 0x6e, 0x74, 0x73, 0x09, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x68, 0x61,
-    0x6c, 0x66, 0x05, 0x6c, 0x65, 0x6d, 0x6f, 0x6e, 0x0b, 0x63, 0x72, 0x65,
-    0x64, 0x69, 0x74, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x0a, 0x68, 0x61, 0x72,
-    0x64, 0x2d, 0x64, 0x72, 0x69, 0x76, 0x65, 0x10, 0x68, 0x61, 0x6e, 0x64,
-    0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-    0x0f, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d,
-    0x6c, 0x65, 0x66, 0x74, 0x0d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f,
-    0x69, 0x6e, 0x74, 0x2d, 0x75, 0x70, 0x0f, 0x68, 0x61, 0x6e, 0x64, 0x2d,
-    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x04, 0x63,
-    0x6f, 0x70, 0x79, 0x0b, 0x66, 0x6c, 0x6f, 0x70, 0x70, 0x79, 0x2d, 0x64,
-    0x69, 0x73, 0x6b, 0x06, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x08, 0x65,
-    0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x05, 0x70, 0x61, 0x73, 0x74,
-    0x65, 0x09, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x62, 0x75, 0x6c, 0x62, 0x04,
-    0x62, 0x65, 0x6c, 0x6c, 0x08, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74, 0x61,
-    0x6c, 0x0b, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x70, 0x6c, 0x75,
-    0x73, 0x06, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x0a, 0x66, 0x61, 0x63,
-    0x65, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x0a, 0x66, 0x61, 0x63, 0x65,
-    0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x08, 0x66, 0x61, 0x63, 0x65, 0x2d,
-    0x6d, 0x65, 0x68, 0x08, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64,
-    0x08, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x0b, 0x63, 0x69,
-    0x72, 0x63, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x0c, 0x73, 0x71,
-    0x75, 0x61, 0x72, 0x65, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x0c, 0x73,
-    0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x11,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x2d, 0x66, 0x72, 0x6f, 0x6d, 0x2d, 0x73,
-    0x71, 0x75, 0x61, 0x72, 0x65, 0x07, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73,
-    0x73, 0x11, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x63, 0x61, 0x72,
-    0x65, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x0f, 0x73, 0x71, 0x75, 0x61,
-    0x72, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x75, 0x70, 0x12,
-    0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74,
-    0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x04, 0x66, 0x69, 0x6c, 0x65, 0x0a,
-    0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x09, 0x74,
-    0x68, 0x75, 0x6d, 0x62, 0x73, 0x2d, 0x75, 0x70, 0x0b, 0x74, 0x68, 0x75,
-    0x6d, 0x62, 0x73, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x03, 0x73, 0x75, 0x6e,
-    0x04, 0x6d, 0x6f, 0x6f, 0x6e, 0x11, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-    0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x0a,
-    0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x74, 0x08, 0x62,
-    0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x08, 0x66, 0x69, 0x6c, 0x65,
-    0x2d, 0x70, 0x64, 0x66, 0x09, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x6f,
-    0x72, 0x64, 0x0a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x78, 0x63, 0x65,
-    0x6c, 0x0f, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70, 0x6f, 0x77, 0x65, 0x72,
-    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x0a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x69,
-    0x6d, 0x61, 0x67, 0x65, 0x0b, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x7a, 0x69,
-    0x70, 0x70, 0x65, 0x72, 0x0a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x75,
-    0x64, 0x69, 0x6f, 0x0a, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x76, 0x69, 0x64,
-    0x65, 0x6f, 0x09, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x63, 0x6f, 0x64, 0x65,
-    0x09, 0x6c, 0x69, 0x66, 0x65, 0x2d, 0x72, 0x69, 0x6e, 0x67, 0x0b, 0x70,
-    0x61, 0x70, 0x65, 0x72, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x06, 0x66,
-    0x75, 0x74, 0x62, 0x6f, 0x6c, 0x09, 0x6e, 0x65, 0x77, 0x73, 0x70, 0x61,
-    0x70, 0x65, 0x72, 0x0a, 0x62, 0x65, 0x6c, 0x6c, 0x2d, 0x73, 0x6c, 0x61,
-    0x73, 0x68, 0x09, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-    0x11, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x2d, 0x63, 0x61, 0x70, 0x74,
-    0x69, 0x6f, 0x6e, 0x69, 0x6e, 0x67, 0x0c, 0x6f, 0x62, 0x6a, 0x65, 0x63,
-    0x74, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x0e, 0x6f, 0x62, 0x6a, 0x65,
-    0x63, 0x74, 0x2d, 0x75, 0x6e, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x0b, 0x6e,
-    0x6f, 0x74, 0x65, 0x2d, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x79, 0x05, 0x63,
-    0x6c, 0x6f, 0x6e, 0x65, 0x0e, 0x68, 0x6f, 0x75, 0x72, 0x67, 0x6c, 0x61,
-    0x73, 0x73, 0x2d, 0x68, 0x61, 0x6c, 0x66, 0x09, 0x68, 0x6f, 0x75, 0x72,
-    0x67, 0x6c, 0x61, 0x73, 0x73, 0x0e, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x62,
-    0x61, 0x63, 0x6b, 0x2d, 0x66, 0x69, 0x73, 0x74, 0x04, 0x68, 0x61, 0x6e,
-    0x64, 0x0d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x73, 0x63, 0x69, 0x73, 0x73,
-    0x6f, 0x72, 0x73, 0x0b, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x7a,
-    0x61, 0x72, 0x64, 0x0a, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x73, 0x70, 0x6f,
-    0x63, 0x6b, 0x0c, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e,
-    0x74, 0x65, 0x72, 0x0a, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x65, 0x61,
-    0x63, 0x65, 0x0a, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65,
-    0x64, 0x0d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x70,
-    0x6c, 0x75, 0x73, 0x0e, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72,
-    0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x0e, 0x63, 0x61, 0x6c, 0x65, 0x6e,
-    0x64, 0x61, 0x72, 0x2d, 0x78, 0x6d, 0x61, 0x72, 0x6b, 0x0e, 0x63, 0x61,
-    0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b,
-    0x03, 0x6d, 0x61, 0x70, 0x07, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
-    0x0c, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x75, 0x73,
-    0x65, 0x0b, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x73, 0x74, 0x6f,
-    0x70, 0x0c, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f,
-    0x6d, 0x65, 0x09, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b, 0x65,
-    0x0d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x2d, 0x6f, 0x70,
-    0x65, 0x6e, 0x0c, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x62,
-    0x6f, 0x6f, 0x6b, 0x0c, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2d,
-    0x63, 0x61, 0x72, 0x64, 0x0b, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d,
-    0x75, 0x73, 0x65, 0x72, 0x08, 0x69, 0x64, 0x2d, 0x62, 0x61, 0x64, 0x67,
-    0x65, 0x07, 0x69, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x0f, 0x77, 0x69,
-    0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x69, 0x7a,
-    0x65, 0x0f, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x6d, 0x69, 0x6e,
-    0x69, 0x6d, 0x69, 0x7a, 0x65, 0x0e, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77,
-    0x2d, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x09, 0x73, 0x6e, 0x6f,
-    0x77, 0x66, 0x6c, 0x61, 0x6b, 0x65, 0x09, 0x74, 0x72, 0x61, 0x73, 0x68,
-    0x2d, 0x63, 0x61, 0x6e, 0x06, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x73, 0x09,
-    0x63, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x0b, 0x63, 0x69,
-    0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x0b, 0x63, 0x69,
-    0x72, 0x63, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x0c, 0x63, 0x69,
-    0x72, 0x63, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x09, 0x63,
-    0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x75, 0x70, 0x03, 0x67, 0x65, 0x6d,
-    0x0c, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x62, 0x69, 0x6c, 0x6c, 0x2d,
-    0x31, 0x0f, 0x72, 0x65, 0x63, 0x74, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d,
-    0x78, 0x6d, 0x61, 0x72, 0x6b, 0x0c, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-    0x62, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x0a, 0x63, 0x68, 0x65, 0x73, 0x73,
-    0x2d, 0x6b, 0x69, 0x6e, 0x67, 0x0c, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-    0x6b, 0x6e, 0x69, 0x67, 0x68, 0x74, 0x0a, 0x63, 0x68, 0x65, 0x73, 0x73,
-    0x2d, 0x70, 0x61, 0x77, 0x6e, 0x0b, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-    0x71, 0x75, 0x65, 0x65, 0x6e, 0x0a, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-    0x72, 0x6f, 0x6f, 0x6b, 0x0b, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d,
-    0x66, 0x75, 0x6c, 0x6c, 0x0c, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
-    0x2d, 0x64, 0x6f, 0x74, 0x73, 0x0f, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x73,
-    0x6d, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x0a, 0x66, 0x61,
-    0x63, 0x65, 0x2d, 0x61, 0x6e, 0x67, 0x72, 0x79, 0x0a, 0x66, 0x61, 0x63,
-    0x65, 0x2d, 0x64, 0x69, 0x7a, 0x7a, 0x79, 0x0c, 0x66, 0x61, 0x63, 0x65,
-    0x2d, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x65, 0x64, 0x0f, 0x66, 0x61, 0x63,
-    0x65, 0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x2d, 0x6f, 0x70, 0x65, 0x6e,
-    0x0c, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6d, 0x61, 0x63,
-    0x65, 0x09, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x0e,
-    0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x77, 0x69,
-    0x64, 0x65, 0x0e, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e,
-    0x2d, 0x62, 0x65, 0x61, 0x6d, 0x14, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67,
-    0x72, 0x69, 0x6e, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x77, 0x65,
-    0x61, 0x74, 0x10, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e,
-    0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x73, 0x10, 0x66, 0x61, 0x63, 0x65,
-    0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74,
-    0x16, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73,
-    0x71, 0x75, 0x69, 0x6e, 0x74, 0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x0f,
-    0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x74,
-    0x61, 0x72, 0x73, 0x0f, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69,
-    0x6e, 0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x10, 0x66, 0x61, 0x63, 0x65,
-    0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x6e, 0x67, 0x75, 0x65,
-    0x17, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74,
-    0x6f, 0x6e, 0x67, 0x75, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74,
-    0x15, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74,
-    0x6f, 0x6e, 0x67, 0x75, 0x65, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x0e, 0x66,
-    0x61, 0x63, 0x65, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x6e,
-    0x6b, 0x09, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x0e,
-    0x66, 0x61, 0x63, 0x65, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x2d, 0x62, 0x65,
-    0x61, 0x6d, 0x14, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x6b, 0x69, 0x73, 0x73,
-    0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x0a,
-    0x66, 0x61, 0x63, 0x65, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x0f, 0x66,
-    0x61, 0x63, 0x65, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x62, 0x65,
-    0x61, 0x6d, 0x11, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x6c, 0x61, 0x75, 0x67,
-    0x68, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x0f, 0x66, 0x61, 0x63,
-    0x65, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x77, 0x69, 0x6e, 0x6b,
-    0x0e, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x6d, 0x65, 0x68, 0x2d, 0x62, 0x6c,
-    0x61, 0x6e, 0x6b, 0x11, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x72, 0x6f, 0x6c,
-    0x6c, 0x69, 0x6e, 0x67, 0x2d, 0x65, 0x79, 0x65, 0x73, 0x0c, 0x66, 0x61,
-    0x63, 0x65, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x63, 0x72, 0x79, 0x0d, 0x66,
-    0x61, 0x63, 0x65, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x74, 0x65, 0x61, 0x72,
-    0x0f, 0x66, 0x61, 0x63, 0x65, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x2d,
-    0x62, 0x65, 0x61, 0x6d, 0x10, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x68, 0x61,
-    0x6c, 0x66, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x0d, 0x66, 0x61,
-    0x63, 0x65, 0x2d, 0x73, 0x75, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x0a,
-    0x66, 0x61, 0x63, 0x65, 0x2d, 0x74, 0x69, 0x72, 0x65, 0x64, 0x00, 0x00};
-unsigned int fa_regular_400_ttf_len = 67860;
-
-#endif
\ No newline at end of file
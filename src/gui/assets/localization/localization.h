@@ -58,6 +58,12 @@ static std::vector<std::string> out = {reinterpret_cast<const char*>(u8"输出")
                                        "Out"};
 static std::vector<std::string> loss_rate = {
     reinterpret_cast<const char*>(u8"丢包率"), "Loss Rate"};
+static std::vector<std::string> audio_buffer = {
+    reinterpret_cast<const char*>(u8"音频缓冲"), "Audio Buffer"};
+static std::vector<std::string> concealed = {
+    reinterpret_cast<const char*>(u8"补偿"), "Concealed"};
+static std::vector<std::string> av_skew = {
+    reinterpret_cast<const char*>(u8"音画偏差"), "A/V Skew"};
 static std::vector<std::string> exit_fullscreen = {
     reinterpret_cast<const char*>(u8"退出全屏"), "Exit fullscreen"};
 static std::vector<std::string> control_mouse = {
@@ -93,6 +99,10 @@ static std::vector<std::string> av1 = {reinterpret_cast<const char*>(u8"AV1"),
                                        "AV1"};
 static std::vector<std::string> h264 = {
     reinterpret_cast<const char*>(u8"H.264"), "H.264"};
+static std::vector<std::string> file_transfer_limit = {
+    reinterpret_cast<const char*>(u8"文件传输限速:"), "File Transfer Limit:"};
+static std::vector<std::string> unlimited = {
+    reinterpret_cast<const char*>(u8"不限速"), "Unlimited"};
 static std::vector<std::string> enable_hardware_video_codec = {
     reinterpret_cast<const char*>(u8"启用硬件编解码器:"),
     "Enable Hardware Video Codec:"};
@@ -167,6 +177,8 @@ static std::vector<std::string> new_version_available = {
     reinterpret_cast<const char*>(u8"新版本可用"), "New Version Available"};
 static std::vector<std::string> version = {
     reinterpret_cast<const char*>(u8"版本"), "Version"};
+static std::vector<std::string> startup_time = {
+    reinterpret_cast<const char*>(u8"启动耗时"), "Startup Time"};
 static std::vector<std::string> release_date = {
     reinterpret_cast<const char*>(u8"发布日期: "), "Release Date: "};
 static std::vector<std::string> access_website = {
@@ -187,6 +199,24 @@ static std::vector<std::string> takes_effect_after_restart = {
     "Takes effect after restart"};
 static std::vector<std::string> select_file = {
     reinterpret_cast<const char*>(u8"选择文件"), "Select File"};
+static std::vector<std::string> select_folder = {
+    reinterpret_cast<const char*>(u8"选择文件夹"), "Select Folder"};
+static std::vector<std::string> send_files = {
+    reinterpret_cast<const char*>(u8"发送文件"), "Send Files"};
+static std::vector<std::string> send_folder = {
+    reinterpret_cast<const char*>(u8"发送文件夹"), "Send Folder"};
+static std::vector<std::string> browse_remote_files = {
+    reinterpret_cast<const char*>(u8"浏览远程文件"), "Browse Remote Files"};
+static std::vector<std::string> remote_files = {
+    reinterpret_cast<const char*>(u8"远程文件"), "Remote Files"};
+static std::vector<std::string> download = {
+    reinterpret_cast<const char*>(u8"下载"), "Download"};
+static std::vector<std::string> loading = {
+    reinterpret_cast<const char*>(u8"加载中"), "Loading"};
+static std::vector<std::string> cannot_open_folder = {
+    reinterpret_cast<const char*>(u8"无法打开文件夹"), "Cannot open folder"};
+static std::vector<std::string> receiving = {
+    reinterpret_cast<const char*>(u8"正在接收"), "Receiving"};
 static std::vector<std::string> file_transfer_progress = {
     reinterpret_cast<const char*>(u8"文件传输进度"), "File Transfer Progress"};
 static std::vector<std::string> queued = {
@@ -0,0 +1,91 @@
+#include "font_data.h"
+
+#include <fstream>
+#include <iterator>
+#include <mutex>
+
+#include "OPPOSans_Regular.h"
+#include "fa_solid_900.h"
+#include "lz4.h"
+#include "rd_log.h"
+
+namespace crossdesk {
+
+namespace {
+std::vector<unsigned char> Inflate(const unsigned char* compressed,
+                                   unsigned int compressed_len,
+                                   unsigned int original_len,
+                                   const char* name) {
+  std::vector<unsigned char> data(original_len);
+  int ret = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed),
+                                reinterpret_cast<char*>(data.data()),
+                                static_cast<int>(compressed_len),
+                                static_cast<int>(original_len));
+  if (ret != static_cast<int>(original_len)) {
+    LOG_ERROR("Failed to inflate font [{}], ret={}", name, ret);
+    data.clear();
+  }
+  return data;
+}
+}  // namespace
+
+const std::vector<unsigned char>& TextFontData() {
+  static const std::vector<unsigned char> data =
+      Inflate(OPPOSans_Regular_ttf_lz4, OPPOSans_Regular_ttf_lz4_len,
+              OPPOSans_Regular_ttf_len, "OPPOSans_Regular");
+  return data;
+}
+
+const std::vector<unsigned char>& IconFontData() {
+  static const std::vector<unsigned char> data =
+      Inflate(fa_solid_900_ttf_lz4, fa_solid_900_ttf_lz4_len,
+              fa_solid_900_ttf_len, "fa_solid_900");
+  return data;
+}
+
+const std::vector<unsigned char>& SystemChineseFontData(std::string* path) {
+#if defined(_WIN32)
+  // Windows: Try Microsoft YaHei (微软雅黑) first, then SimSun (宋体)
+  static const char* font_paths[] = {"C:/Windows/Fonts/msyh.ttc",
+                                     "C:/Windows/Fonts/msyhbd.ttc",
+                                     "C:/Windows/Fonts/simsun.ttc", nullptr};
+#elif defined(__APPLE__)
+  // macOS: Try PingFang SC first, then STHeiti
+  static const char* font_paths[] = {"/System/Library/Fonts/PingFang.ttc",
+                                     "/System/Library/Fonts/STHeiti Light.ttc",
+                                     "/System/Library/Fonts/STHeiti Medium.ttc",
+                                     nullptr};
+#else
+  // Linux: Try common Chinese fonts
+  static const char* font_paths[] = {
+      "/usr/share/fonts/truetype/wqy/wqy-microhei.ttc",
+      "/usr/share/fonts/truetype/wqy/wqy-zenhei.ttc",
+      "/usr/share/fonts/truetype/arphic/uming.ttc",
+      "/usr/share/fonts/truetype/noto/NotoSansCJK-Regular.ttc", nullptr};
+#endif
+
+  static std::once_flag once;
+  static std::vector<unsigned char> data;
+  static std::string data_path;
+  std::call_once(once, []() {
+    for (int i = 0; font_paths[i] != nullptr; i++) {
+      std::ifstream font_file(font_paths[i], std::ios::binary);
+      if (!font_file.good()) {
+        continue;
+      }
+      data.assign(std::istreambuf_iterator<char>(font_file),
+                  std::istreambuf_iterator<char>());
+      if (!data.empty()) {
+        data_path = font_paths[i];
+        break;
+      }
+    }
+  });
+
+  if (path) {
+    *path = data_path;
+  }
+  return data;
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,33 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _FONT_DATA_H_
+#define _FONT_DATA_H_
+
+#include <string>
+#include <vector>
+
+namespace crossdesk {
+
+// TTF data the ImGui atlases rasterize glyphs from on demand. Each font is
+// loaded once, lives until exit and is shared by the main and stream window
+// contexts, so it must be added with FontDataOwnedByAtlas = false. Safe to
+// call from any thread.
+
+// the embedded text font, inflated on first use
+const std::vector<unsigned char>& TextFontData();
+
+// the embedded Font Awesome solid icons, inflated on first use
+const std::vector<unsigned char>& IconFontData();
+
+// the first installed system CJK font, empty when there is none; reads the
+// whole file on first use. `path` receives the file it came from
+const std::vector<unsigned char>& SystemChineseFontData(
+    std::string* path = nullptr);
+
+}  // namespace crossdesk
+
+#endif
@@ -129,9 +129,21 @@ int Render::ShowRecentConnections() {
         ImVec2(ImGui::GetCursorPosX() + recent_connection_image_width * 0.05f,
                ImGui::GetCursorPosY() + recent_connection_image_height * 0.08f);
     ImGui::SetCursorPos(image_pos);
-    ImGui::Image(
-        (ImTextureID)(intptr_t)it.second.texture,
-        ImVec2(recent_connection_image_width, recent_connection_image_height));
+    if (it.second.texture) {
+      ImGui::Image(
+          (ImTextureID)(intptr_t)it.second.texture,
+          ImVec2(recent_connection_image_width, recent_connection_image_height));
+    } else {
+      // placeholder until the thumbnail is decoded
+      ImVec2 placeholder_min = ImGui::GetCursorScreenPos();
+      ImVec2 placeholder_max =
+          ImVec2(placeholder_min.x + recent_connection_image_width,
+                 placeholder_min.y + recent_connection_image_height);
+      ImGui::GetWindowDrawList()->AddRectFilled(
+          placeholder_min, placeholder_max, IM_COL32(200, 200, 200, 255));
+      ImGui::Dummy(
+          ImVec2(recent_connection_image_width, recent_connection_image_height));
+    }
 
     // remote id display button
     {
@@ -194,7 +194,7 @@ int Render::ConnectTo(const std::string& remote_id, const char* password,
         props->control_window_height_ = title_bar_height_ * 1.3f;
         props->control_window_min_width_ = title_bar_height_ * 0.65f;
         props->control_window_min_height_ = title_bar_height_ * 1.3f;
-        props->control_window_max_width_ = title_bar_height_ * 9.0f;
+        props->control_window_max_width_ = title_bar_height_ * 9.9f;
         props->control_window_max_height_ = title_bar_height_ * 6.0f;
 
         if (!props->peer_) {
@@ -210,6 +210,26 @@ int Render::ConnectTo(const std::string& remote_id, const char* password,
         AddDataStream(props->peer_, props->file_label_.c_str(), true);
         AddDataStream(props->peer_, props->file_feedback_label_.c_str(), true);
         AddDataStream(props->peer_, props->clipboard_label_.c_str(), true);
+        AddDataStream(props->peer_, props->file_browse_label_.c_str(), true);
+
+        props->send_scheduler_ = CreateSendScheduler(&props->peer_);
+        props->send_scheduler_->SetBulkCap(
+            config_center_->GetFileTransferLimitBps());
+        SendScheduler* scheduler = props->send_scheduler_.get();
+        std::string clipboard_label = props->clipboard_label_;
+        props->clipboard_sync_ = std::make_unique<ClipboardSync>(
+            [scheduler, clipboard_label](SendPriority priority,
+                                         const char* data, size_t size) {
+              return scheduler->Send(priority, clipboard_label, data, size);
+            });
+
+        SubStreamWindowProperties* props_ptr = props.get();
+        props->file_browser_.SetSendFunc(
+            [props_ptr](const char* data, size_t size) -> int {
+              return props_ptr->send_scheduler_->Send(
+                  SendPriority::Interactive, props_ptr->file_browse_label_,
+                  data, size);
+            });
 
         props->connection_status_ = ConnectionStatus::Connecting;
 
@@ -2,18 +2,17 @@
 
 #include <libyuv.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <thread>
 
-#include "OPPOSans_Regular.h"
 #include "clipboard.h"
 #include "device_controller_factory.h"
-#include "fa_regular_400.h"
-#include "fa_solid_900.h"
 #include "file_transfer.h"
+#include "font_data.h"
 #include "layout_relative.h"
 #include "localization.h"
 #include "platform.h"
@@ -25,6 +24,16 @@
 
 namespace crossdesk {
 
+namespace {
+// minimized, hidden (e.g. in the tray) and fully covered windows are not
+// drawn at all
+bool IsWindowVisible(SDL_Window* window) {
+  return window && !(SDL_GetWindowFlags(window) &
+                     (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN |
+                      SDL_WINDOW_OCCLUDED));
+}
+}  // namespace
+
 std::vector<char> Render::SerializeRemoteAction(const RemoteAction& action) {
   std::vector<char> buffer;
   buffer.push_back(static_cast<char>(action.type));
@@ -245,6 +254,43 @@ int Render::SaveSettingsIntoCacheFile() {
   return 0;
 }
 
+void Render::SetConnectionPassword(const char* password) {
+  memset(&password_saved_, 0, sizeof(password_saved_));
+  strncpy(password_saved_, password, sizeof(password_saved_) - 1);
+  password_saved_[sizeof(password_saved_) - 1] = '\0';
+
+  // if self hosted
+  if (config_center_->IsSelfHosted()) {
+    std::string self_hosted_id_str;
+    if (strlen(self_hosted_id_) > 0) {
+      const char* at_pos = strchr(self_hosted_id_, '@');
+      if (at_pos != nullptr) {
+        self_hosted_id_str =
+            std::string(self_hosted_id_, at_pos - self_hosted_id_);
+      } else {
+        self_hosted_id_str = self_hosted_id_;
+      }
+    } else {
+      self_hosted_id_str = client_id_;
+    }
+
+    std::string new_self_hosted_id = self_hosted_id_str + "@" + password_saved_;
+    memset(&self_hosted_id_, 0, sizeof(self_hosted_id_));
+    strncpy(self_hosted_id_, new_self_hosted_id.c_str(),
+            sizeof(self_hosted_id_) - 1);
+    self_hosted_id_[sizeof(self_hosted_id_) - 1] = '\0';
+
+  } else {
+    std::string client_id_with_password =
+        std::string(client_id_) + "@" + password_saved_;
+    strncpy(client_id_with_password_, client_id_with_password.c_str(),
+            sizeof(client_id_with_password_) - 1);
+    client_id_with_password_[sizeof(client_id_with_password_) - 1] = '\0';
+  }
+
+  SaveSettingsIntoCacheFile();
+}
+
 int Render::LoadSettingsFromCacheFile() {
   cd_cache_mutex_.lock();
 
@@ -282,6 +328,7 @@ int Render::LoadSettingsFromCacheFile() {
 
       thumbnail_.reset();
       thumbnail_ = std::make_shared<Thumbnail>(cache_path_ + "/thumbnails/");
+      thumbnail_->SetOnDecoded([this]() { RequestRedraw(); });
       thumbnail_->GetKeyAndIv(aes128_key_, aes128_iv_);
       thumbnail_->DeleteAllFilesInDirectory();
 
@@ -345,12 +392,15 @@ int Render::LoadSettingsFromCacheFile() {
   thumbnail_.reset();
   thumbnail_ = std::make_shared<Thumbnail>(cache_path_ + "/thumbnails/",
                                            aes128_key_, aes128_iv_);
+  thumbnail_->SetOnDecoded([this]() { RequestRedraw(); });
 
   language_button_value_ = (int)config_center_->GetLanguage();
   video_quality_button_value_ = (int)config_center_->GetVideoQuality();
   video_frame_rate_button_value_ = (int)config_center_->GetVideoFrameRate();
   video_encode_format_button_value_ =
       (int)config_center_->GetVideoEncodeFormat();
+  file_transfer_limit_button_value_ =
+      (int)config_center_->GetFileTransferLimit();
   enable_hardware_video_codec_ = config_center_->IsHardwareVideoCodec();
   enable_turn_ = config_center_->IsEnableTurn();
   enable_srtp_ = config_center_->IsEnableSrtp();
@@ -362,6 +412,7 @@ int Render::LoadSettingsFromCacheFile() {
   language_button_value_last_ = language_button_value_;
   video_quality_button_value_last_ = video_quality_button_value_;
   video_encode_format_button_value_last_ = video_encode_format_button_value_;
+  file_transfer_limit_button_value_last_ = file_transfer_limit_button_value_;
   enable_hardware_video_codec_last_ = enable_hardware_video_codec_;
   enable_turn_last_ = enable_turn_;
   enable_srtp_last_ = enable_srtp_;
@@ -446,8 +497,22 @@ int Render::StartSpeakerCapturer() {
   if (!speaker_capturer_) {
     speaker_capturer_ = (SpeakerCapturer*)speaker_capturer_factory_->Create();
     int speaker_capturer_init_ret =
-        speaker_capturer_->Init([this](unsigned char* data, size_t size,
-                                       const char* audio_name) -> void {
+        speaker_capturer_->Init([this, warned = false](
+                                    unsigned char* data, size_t size,
+                                    const char* audio_name,
+                                    const AudioFormat& format,
+                                    int64_t timestamp_us) mutable -> void {
+          // SendAudioFrame takes no format, anything else would be encoded
+          // as if it were the wire format
+          if (format != kAudioWireFormat) {
+            if (!warned) {
+              warned = true;
+              LOG_ERROR("Dropping speaker frames: {} Hz, {} channels",
+                        format.sample_rate, format.channels);
+            }
+            return;
+          }
+          AnnounceAudioClock(timestamp_us);
           SendAudioFrame(peer_, (const char*)data, size, audio_label_.c_str());
         });
 
@@ -701,6 +766,14 @@ int Render::CreateConnectionPeer() {
   params_.user_data = this;
 
   peer_ = CreatePeer(&params_);
+  if (!send_scheduler_) {
+    send_scheduler_ = CreateSendScheduler(&peer_);
+    send_scheduler_->SetBulkCap(config_center_->GetFileTransferLimitBps());
+    clipboard_sync_ = std::make_unique<ClipboardSync>(
+        [this](SendPriority priority, const char* data, size_t size) -> int {
+          return send_scheduler_->Send(priority, clipboard_label_, data, size);
+        });
+  }
   if (peer_) {
     LOG_INFO("Create peer instance [{}] successful", client_id_);
     Init(peer_);
@@ -719,17 +792,99 @@ int Render::CreateConnectionPeer() {
     AddDataStream(peer_, file_label_.c_str(), true);
     AddDataStream(peer_, file_feedback_label_.c_str(), true);
     AddDataStream(peer_, clipboard_label_.c_str(), true);
+    AddDataStream(peer_, file_browse_label_.c_str(), true);
     return 0;
   } else {
     return -1;
   }
 }
 
+std::shared_ptr<SendScheduler> Render::CreateSendScheduler(PeerPtr** peer) {
+  return std::make_shared<SendScheduler>(
+      [peer](const std::string& label, const char* data, size_t size,
+             bool reliable) -> int {
+        PeerPtr* p = *peer;
+        if (!p) {
+          return -1;
+        }
+        return reliable ? SendReliableDataFrame(p, data, size, label.c_str())
+                        : SendDataFrame(p, data, size, label.c_str());
+      });
+}
+
+std::shared_ptr<FileReceiver> Render::GetFileReceiver(
+    const std::string& remote_id,
+    const std::weak_ptr<SendScheduler>& reply_scheduler,
+    const std::weak_ptr<SubStreamWindowProperties>& viewer_props) {
+  std::lock_guard<std::mutex> lock(file_receivers_mutex_);
+  std::shared_ptr<FileReceiver>& receiver = file_receivers_[remote_id];
+  if (receiver) {
+    return receiver;
+  }
+
+  receiver = std::make_shared<FileReceiver>();
+  receiver->SetOnSendAck([this, reply_scheduler, viewer_props](
+                             const FileTransferAck& ack) -> int {
+    if (auto props = viewer_props.lock()) {
+      props->file_browser_.OnLocalAck(ack);
+    }
+    auto scheduler = reply_scheduler.lock();
+    if (!scheduler) {
+      return -1;
+    }
+    return scheduler->Send(SendPriority::Interactive, file_feedback_label_,
+                           reinterpret_cast<const char*>(&ack),
+                           sizeof(FileTransferAck));
+  });
+  // delta signatures are sent from a background thread
+  receiver->SetOnSendFeedback(
+      [this, reply_scheduler](const char* buf, size_t sz) -> int {
+        auto scheduler = reply_scheduler.lock();
+        if (!scheduler) {
+          return -1;
+        }
+        return scheduler->Send(SendPriority::Interactive,
+                               file_feedback_label_, buf, sz);
+      });
+  return receiver;
+}
+
+void Render::DropFileTransfers(const std::string& remote_id) {
+  FileSender::DropRepairSources(remote_id);
+
+  std::shared_ptr<FileReceiver> receiver;
+  {
+    std::lock_guard<std::mutex> lock(file_receivers_mutex_);
+    auto it = file_receivers_.find(remote_id);
+    if (it == file_receivers_.end()) {
+      return;
+    }
+    receiver = std::move(it->second);
+    file_receivers_.erase(it);
+  }
+  // stops its signature jobs once the data thread is done with it too
+  receiver.reset();
+}
+
+void Render::ApplyFileTransferLimit() {
+  uint32_t bps = config_center_->GetFileTransferLimitBps();
+  if (send_scheduler_) {
+    send_scheduler_->SetBulkCap(bps);
+  }
+
+  // std::shared_lock lock(client_properties_mutex_);
+  for (auto& [remote_id, props] : client_properties_) {
+    if (props && props->send_scheduler_) {
+      props->send_scheduler_->SetBulkCap(bps);
+    }
+  }
+}
+
 int Render::AudioDeviceInit() {
   SDL_AudioSpec desired_out{};
-  desired_out.freq = 48000;
+  desired_out.freq = kAudioWireFormat.sample_rate;
   desired_out.format = SDL_AUDIO_S16;
-  desired_out.channels = 1;
+  desired_out.channels = kAudioWireFormat.channels;
 
   output_stream_ = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK,
                                              &desired_out, nullptr, nullptr);
@@ -743,6 +898,210 @@ int Render::AudioDeviceInit() {
   return 0;
 }
 
+void Render::AnnounceAudioClock(int64_t timestamp_us) {
+  auto now = std::chrono::steady_clock::now();
+  if (now - last_audio_clock_announce_ < std::chrono::milliseconds(250) ||
+      !send_scheduler_) {
+    return;
+  }
+
+  int64_t age_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                       now.time_since_epoch())
+                       .count() -
+                   timestamp_us;
+  RemoteAction remote_action;
+  remote_action.type = ControlType::audio_clock;
+  remote_action.t = GetSystemTimeMicros(peer_) - age_us;
+  std::string msg = remote_action.to_json();
+  if (0 == send_scheduler_->Send(SendPriority::Interactive, data_label_,
+                                 msg.data(), msg.size(), false)) {
+    last_audio_clock_announce_ = now;
+  }
+}
+
+void Render::SetMicrophoneEnabled(
+    std::shared_ptr<SubStreamWindowProperties> props, bool enabled) {
+  if (!props || props->microphone_button_pressed_ == enabled) {
+    return;
+  }
+  if (enabled && StartMicrophone() != 0) {
+    return;
+  }
+  props->microphone_button_pressed_ = enabled;
+
+  bool in_use = false;
+  {
+    std::lock_guard<std::mutex> lock(microphone_targets_mutex_);
+    auto it =
+        std::find(microphone_targets_.begin(), microphone_targets_.end(), props);
+    if (enabled && it == microphone_targets_.end()) {
+      microphone_targets_.push_back(props);
+    } else if (!enabled && it != microphone_targets_.end()) {
+      microphone_targets_.erase(it);
+    }
+    in_use = !microphone_targets_.empty();
+  }
+
+  if (props->send_scheduler_) {
+    RemoteAction remote_action;
+    remote_action.type = ControlType::microphone;
+    remote_action.f.sample_rate = microphone_format_.sample_rate;
+    remote_action.f.channels = enabled ? microphone_format_.channels : 0;
+    std::string msg = remote_action.to_json();
+    // the host keeps the microphone for this viewer until it hears the off
+    props->send_scheduler_->Send(SendPriority::Input, props->data_label_,
+                                 msg.c_str(), msg.size(), true);
+  }
+
+  if (!in_use) {
+    StopMicrophone();
+  }
+}
+
+int Render::StartMicrophone() {
+  if (microphone_stream_) {
+    return 0;
+  }
+
+  size_t frame_bytes = static_cast<size_t>(microphone_format_.sample_rate) /
+                       100 * microphone_format_.channels * sizeof(int16_t);
+  microphone_ring_.Reset(frame_bytes, 32, 10 * 1000);
+
+  SDL_AudioSpec desired_in{};
+  desired_in.freq = microphone_format_.sample_rate;
+  desired_in.format = SDL_AUDIO_S16;
+  desired_in.channels = microphone_format_.channels;
+  microphone_stream_ =
+      SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_RECORDING,
+                                &desired_in, SdlCaptureAudioIn, this);
+  if (!microphone_stream_) {
+    LOG_ERROR("Failed to open microphone: {}", SDL_GetError());
+    return -1;
+  }
+
+  microphone_running_ = true;
+  microphone_sender_ = std::thread(&Render::MicrophoneSendLoop, this);
+  SDL_ResumeAudioDevice(SDL_GetAudioStreamDevice(microphone_stream_));
+  LOG_INFO("Microphone started: {} Hz, {} channels",
+           microphone_format_.sample_rate, microphone_format_.channels);
+  return 0;
+}
+
+int Render::StopMicrophone() {
+  if (microphone_stream_) {
+    // no recording callback runs once the device is closed
+    SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(microphone_stream_));
+    SDL_DestroyAudioStream(microphone_stream_);
+    microphone_stream_ = nullptr;
+  }
+
+  microphone_running_ = false;
+  if (microphone_sender_.joinable()) {
+    microphone_sender_.join();
+    LOG_INFO("Microphone stopped, {} overruns", microphone_ring_.Overruns());
+  }
+  return 0;
+}
+
+void Render::MicrophoneSendLoop() {
+  constexpr auto kPeriod = std::chrono::milliseconds(10);
+  // a backlog longer than this drains at two frames per period
+  constexpr size_t kBacklogFrames = 4;
+  // frames older than this are skipped, the conversation has moved on
+  constexpr int64_t kMaxDelayUs = 150 * 1000;
+
+  auto next = std::chrono::steady_clock::now();
+  while (microphone_running_) {
+    next += kPeriod;
+    std::this_thread::sleep_until(next);
+    auto now = std::chrono::steady_clock::now();
+    if (now - next > 10 * kPeriod) {
+      // restart the schedule after a stall instead of bursting to catch up
+      next = now;
+    }
+
+    // SDL records in bursts of a few periods, they leave one frame per
+    // period so the host's queue stays shallow
+    int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                         now.time_since_epoch())
+                         .count();
+    while (microphone_ring_.Front() &&
+           now_us - microphone_ring_.FrontTimestamp() > kMaxDelayUs) {
+      microphone_ring_.Pop();
+    }
+
+    int budget = microphone_ring_.Size() > kBacklogFrames ? 2 : 1;
+    for (; budget > 0; --budget) {
+      uint8_t* frame = microphone_ring_.Front();
+      if (!frame) {
+        break;
+      }
+      {
+        std::lock_guard<std::mutex> lock(microphone_targets_mutex_);
+        for (const auto& props : microphone_targets_) {
+          if (props->peer_ && props->connection_established_) {
+            SendAudioFrame(props->peer_, (const char*)frame,
+                           microphone_ring_.FrameBytes(),
+                           props->audio_label_.c_str());
+          }
+        }
+      }
+      microphone_ring_.Pop();
+    }
+  }
+}
+
+int Render::StartVirtualMicrophone(const std::string& remote_id,
+                                   const AudioFormat& format) {
+  std::lock_guard<std::mutex> lock(virtual_microphone_mutex_);
+  if (!virtual_microphone_owner_.empty() &&
+      virtual_microphone_owner_ != remote_id) {
+    LOG_WARN("Virtual microphone is in use by [{}], ignoring [{}]",
+             virtual_microphone_owner_, remote_id);
+    return -1;
+  }
+
+  if (!virtual_microphone_) {
+    if (!virtual_microphone_factory_) {
+      return -1;
+    }
+    virtual_microphone_ = virtual_microphone_factory_->Create();
+    if (!virtual_microphone_) {
+      LOG_WARN("Virtual microphone is not supported on this platform");
+      return -1;
+    }
+    if (0 != virtual_microphone_->Init()) {
+      LOG_ERROR("Init virtual microphone failed");
+      virtual_microphone_->Destroy();
+      delete virtual_microphone_;
+      virtual_microphone_ = nullptr;
+      return -1;
+    }
+  }
+
+  // a viewer switching it on again may send another format
+  virtual_microphone_owner_.clear();
+  virtual_microphone_->Stop();
+  if (0 != virtual_microphone_->Start(format)) {
+    return -1;
+  }
+  virtual_microphone_owner_ = remote_id;
+  LOG_INFO("Virtual microphone plays [{}]", remote_id);
+  return 0;
+}
+
+int Render::StopVirtualMicrophone(const std::string& remote_id) {
+  std::lock_guard<std::mutex> lock(virtual_microphone_mutex_);
+  if (!remote_id.empty() && remote_id != virtual_microphone_owner_) {
+    return 0;
+  }
+  virtual_microphone_owner_.clear();
+  if (virtual_microphone_) {
+    virtual_microphone_->Stop();
+  }
+  return 0;
+}
+
 int Render::AudioDeviceDestroy() {
   if (output_stream_) {
     SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(output_stream_));
@@ -945,87 +1304,67 @@ int Render::SetupFontAndStyle(bool main_window) {
   ImGuiIO& io = ImGui::GetIO();
 
   io.IniFilename = NULL;  // disable imgui.ini
+  // a blinking cursor would need a redraw twice a second while idle
+  io.ConfigInputTextCursorBlink = false;
 
-  // Load Fonts
+  // Load Fonts, the atlas rasterizes glyphs on first use
   ImFontConfig config;
   config.FontDataOwnedByAtlas = false;
-  io.Fonts->AddFontFromMemoryTTF(OPPOSans_Regular_ttf, OPPOSans_Regular_ttf_len,
-                                 font_size, &config,
-                                 io.Fonts->GetGlyphRangesChineseFull());
+  const std::vector<unsigned char>& text_font = TextFontData();
+  if (text_font.empty()) {
+    io.Fonts->AddFontDefault(&config);
+  } else {
+    io.Fonts->AddFontFromMemoryTTF(const_cast<unsigned char*>(text_font.data()),
+                                   (int)text_font.size(), font_size, &config);
+  }
   config.MergeMode = true;
   static const ImWchar icon_ranges[] = {ICON_MIN_FA, ICON_MAX_FA, 0};
-  io.Fonts->AddFontFromMemoryTTF(fa_solid_900_ttf, fa_solid_900_ttf_len, 30.0f,
-                                 &config, icon_ranges);
+  const std::vector<unsigned char>& icon_font = IconFontData();
+  if (!icon_font.empty()) {
+    io.Fonts->AddFontFromMemoryTTF(const_cast<unsigned char*>(icon_font.data()),
+                                   (int)icon_font.size(), 30.0f, &config,
+                                   icon_ranges);
+  }
 
-  // Load system Chinese font as fallback
-  config.MergeMode = false;
-  config.FontDataOwnedByAtlas = false;
+  // the system Chinese font follows once the startup pool has read it
   if (main_window) {
     main_windows_system_chinese_font_ = nullptr;
-  } else {
-    stream_windows_system_chinese_font_ = nullptr;
-  }
-
-#if defined(_WIN32)
-  // Windows: Try Microsoft YaHei (微软雅黑) first, then SimSun (宋体)
-  const char* font_paths[] = {"C:/Windows/Fonts/msyh.ttc",
-                              "C:/Windows/Fonts/msyhbd.ttc",
-                              "C:/Windows/Fonts/simsun.ttc", nullptr};
-#elif defined(__APPLE__)
-  // macOS: Try PingFang SC first, then STHeiti
-  const char* font_paths[] = {"/System/Library/Fonts/PingFang.ttc",
-                              "/System/Library/Fonts/STHeiti Light.ttc",
-                              "/System/Library/Fonts/STHeiti Medium.ttc",
-                              nullptr};
-#else
-  // Linux: Try common Chinese fonts
-  const char* font_paths[] = {
-      "/usr/share/fonts/truetype/wqy/wqy-microhei.ttc",
-      "/usr/share/fonts/truetype/wqy/wqy-zenhei.ttc",
-      "/usr/share/fonts/truetype/arphic/uming.ttc",
-      "/usr/share/fonts/truetype/noto/NotoSansCJK-Regular.ttc", nullptr};
-#endif
+  }
 
-  for (int i = 0; font_paths[i] != nullptr; i++) {
-    std::ifstream font_file(font_paths[i], std::ios::binary);
-    if (font_file.good()) {
-      font_file.close();
-      if (main_window) {
-        main_windows_system_chinese_font_ =
-            io.Fonts->AddFontFromFileTTF(font_paths[i], font_size, &config,
-                                         io.Fonts->GetGlyphRangesChineseFull());
-        if (main_windows_system_chinese_font_ != nullptr) {
-          LOG_INFO("Loaded system Chinese font: {}", font_paths[i]);
-          break;
-        }
-      } else {
-        stream_windows_system_chinese_font_ =
-            io.Fonts->AddFontFromFileTTF(font_paths[i], font_size, &config,
-                                         io.Fonts->GetGlyphRangesChineseFull());
-        if (stream_windows_system_chinese_font_ != nullptr) {
-          LOG_INFO("Loaded system Chinese font: {}", font_paths[i]);
-          break;
-        }
-      }
-    }
+  ImGui::StyleColorsLight();
+
+  return 0;
+}
+
+void Render::AddSystemChineseFont() {
+  if (!main_ctx_) {
+    return;
+  }
+
+  ImGuiContext* current_ctx = ImGui::GetCurrentContext();
+  ImGui::SetCurrentContext(main_ctx_);
+  ImGuiIO& io = ImGui::GetIO();
+
+  float font_size = 32.0f;
+  ImFontConfig config;
+  config.FontDataOwnedByAtlas = false;
+  std::string font_path;
+  const std::vector<unsigned char>& font = SystemChineseFontData(&font_path);
+  if (!font.empty()) {
+    main_windows_system_chinese_font_ = io.Fonts->AddFontFromMemoryTTF(
+        const_cast<unsigned char*>(font.data()), (int)font.size(), font_size,
+        &config);
   }
 
   // If no system font found, use default font
-  if (main_window) {
-    if (main_windows_system_chinese_font_ == nullptr) {
-      main_windows_system_chinese_font_ = io.Fonts->AddFontDefault(&config);
-      LOG_WARN("System Chinese font not found, using default font");
-    }
+  if (main_windows_system_chinese_font_ != nullptr) {
+    LOG_INFO("Loaded system Chinese font: {}", font_path);
   } else {
-    if (stream_windows_system_chinese_font_ == nullptr) {
-      stream_windows_system_chinese_font_ = io.Fonts->AddFontDefault(&config);
-      LOG_WARN("System Chinese font not found, using default font");
-    }
+    main_windows_system_chinese_font_ = io.Fonts->AddFontDefault(&config);
+    LOG_WARN("System Chinese font not found, using default font");
   }
 
-  ImGui::StyleColorsLight();
-
-  return 0;
+  ImGui::SetCurrentContext(current_ctx);
 }
 
 int Render::DestroyMainWindowContext() {
@@ -1159,26 +1498,48 @@ int Render::DrawStreamWindow() {
 }
 
 int Render::Run() {
-  latest_version_info_ = CheckUpdate();
-  if (!latest_version_info_.empty() &&
-      latest_version_info_.contains("version") &&
-      latest_version_info_["version"].is_string()) {
-    latest_version_ = latest_version_info_["version"];
-    if (latest_version_info_.contains("releaseNotes") &&
-        latest_version_info_["releaseNotes"].is_string()) {
-      release_notes_ = latest_version_info_["releaseNotes"];
-    } else {
-      release_notes_ = "";
-    }
-    update_available_ = IsNewerVersion(CROSSDESK_VERSION, latest_version_);
-    if (update_available_) {
-      show_update_notification_window_ = true;
+  {
+    StartupTrace::Scope stage(startup_trace_, "paths and config");
+    if (0 != InitializePaths()) {
+      return -1;
     }
-  } else {
-    latest_version_ = "";
-    update_available_ = false;
   }
 
+  {
+    StartupTrace::Scope stage(startup_trace_, "logger");
+    InitializeLogger();
+  }
+  LOG_INFO("CrossDesk version: {}", CROSSDESK_VERSION);
+
+  StartBackgroundInit();
+  {
+    StartupTrace::Scope stage(startup_trace_, "settings");
+    InitializeSettings();
+  }
+  {
+    StartupTrace::Scope stage(startup_trace_, "sdl");
+    InitializeSDL();
+  }
+  {
+    StartupTrace::Scope stage(startup_trace_, "modules");
+    InitializeModules();
+  }
+  {
+    StartupTrace::Scope stage(startup_trace_, "main window");
+    InitializeMainWindow();
+  }
+
+  const int scaled_video_width_ = 160;
+  const int scaled_video_height_ = 90;
+
+  MainLoop();
+
+  Cleanup();
+
+  return 0;
+}
+
+int Render::InitializePaths() {
   path_manager_ = std::make_unique<PathManager>("CrossDesk");
   if (path_manager_) {
     cert_path_ =
@@ -1208,21 +1569,6 @@ int Render::Run() {
     return -1;
   }
 
-  InitializeLogger();
-  LOG_INFO("CrossDesk version: {}", CROSSDESK_VERSION);
-
-  InitializeSettings();
-  InitializeSDL();
-  InitializeModules();
-  InitializeMainWindow();
-
-  const int scaled_video_width_ = 160;
-  const int scaled_video_height_ = 90;
-
-  MainLoop();
-
-  Cleanup();
-
   return 0;
 }
 
@@ -1257,6 +1603,11 @@ void Render::InitializeSDL() {
     LOG_ERROR("Failed to register custom SDL event");
   }
 
+  REDRAW_EVENT = SDL_RegisterEvents(1);
+  if (REDRAW_EVENT == 0) {
+    LOG_ERROR("Failed to register redraw SDL event");
+  }
+
   LOG_INFO("Screen resolution: [{}x{}]", screen_width_, screen_height_);
 }
 
@@ -1264,43 +1615,59 @@ void Render::InitializeModules() {
   if (!modules_inited_) {
     AudioDeviceInit();
     screen_capturer_factory_ = new ScreenCapturerFactory();
-    speaker_capturer_factory_ = new SpeakerCapturerFactory();
+    virtual_microphone_factory_ = new VirtualMicrophoneFactory();
     device_controller_factory_ = new DeviceControllerFactory();
     keyboard_capturer_ = (KeyboardCapturer*)device_controller_factory_->Create(
         DeviceControllerFactory::Device::Keyboard);
-    CreateConnectionPeer();
-
-    // start clipboard monitoring with callback to send data to peers
-    Clipboard::StartMonitoring(
-        100, [this](const char* data, size_t size) -> int {
-          // send clipboard data to all connected peers
-          std::shared_lock lock(client_properties_mutex_);
-          int ret = -1;
-          for (const auto& [remote_id, props] : client_properties_) {
-            if (props && props->peer_ && props->connection_established_) {
-              ret = SendReliableDataFrame(props->peer_, data, size,
-                                          props->clipboard_label_.c_str());
-              if (ret != 0) {
-                LOG_WARN("Failed to send clipboard data to peer [{}], ret={}",
-                         remote_id.c_str(), ret);
-                return ret;
-              }
+
+    // nothing of this is needed to draw the first frame, MainLoop waits for
+    // it before touching peer_
+    peer_startup_ = startup_pool_->Submit([this]() {
+      {
+        StartupTrace::Scope stage(startup_trace_, "speaker capturer factory");
+        speaker_capturer_factory_ = new SpeakerCapturerFactory();
+      }
+      {
+        StartupTrace::Scope stage(startup_trace_, "connection peer");
+        CreateConnectionPeer();
+      }
+      StartClipboardMonitoring();
+    });
+
+    modules_inited_ = true;
+  }
+}
+
+void Render::StartClipboardMonitoring() {
+  // start clipboard monitoring with callback to send data to peers
+  Clipboard::StartMonitoring(
+      100, [this](const ClipboardContent& content) -> int {
+        // announce the copy to all connected peers
+        std::shared_lock lock(client_properties_mutex_);
+        int ret = 0;
+        for (const auto& [remote_id, props] : client_properties_) {
+          if (props && props->peer_ && props->connection_established_ &&
+              props->clipboard_sync_) {
+            int peer_ret = props->clipboard_sync_->Announce(content);
+            if (peer_ret != 0) {
+              LOG_WARN("Failed to send clipboard data to peer [{}], ret={}",
+                       remote_id.c_str(), peer_ret);
+              ret = peer_ret;
             }
           }
+        }
 
-          ret = SendReliableDataFrame(peer_, data, size,
-                                      clipboard_label_.c_str());
-          if (ret != 0) {
+        if (clipboard_sync_) {
+          int host_ret = clipboard_sync_->Announce(content);
+          if (host_ret != 0) {
             LOG_WARN("Failed to send clipboard data to peer [{}], ret={}",
-                     remote_id_display_, ret);
-            return ret;
+                     remote_id_display_, host_ret);
+            ret = host_ret;
           }
+        }
 
-          return 0;
-        });
-
-    modules_inited_ = true;
-  }
+        return ret;
+      });
 }
 
 void Render::InitializeMainWindow() {
@@ -1310,15 +1677,102 @@ void Render::InitializeMainWindow() {
   }
 }
 
+void Render::StartBackgroundInit() {
+  startup_pool_ = std::make_unique<ThreadPool>(2);
+  version_check_ = startup_pool_->Submit([this]() {
+    StartupTrace::Scope stage(startup_trace_, "version check");
+    return CheckUpdate();
+  });
+  system_font_ = startup_pool_->Submit([this]() {
+    StartupTrace::Scope stage(startup_trace_, "system font");
+    SystemChineseFontData();
+  });
+}
+
+void Render::PollBackgroundInit() {
+  if (version_check_.valid() &&
+      version_check_.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready) {
+    ApplyVersionInfo(version_check_.get());
+  }
+
+  if (peer_startup_.valid() &&
+      peer_startup_.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready) {
+    peer_startup_.get();
+  }
+
+  // added between frames, the atlas takes new fonts at any time
+  if (system_font_.valid() &&
+      system_font_.wait_for(std::chrono::seconds(0)) ==
+          std::future_status::ready) {
+    system_font_.get();
+    AddSystemChineseFont();
+  }
+}
+
+void Render::WaitForPeerStartup() {
+  if (peer_startup_.valid()) {
+    peer_startup_.get();
+  }
+}
+
+void Render::ApplyVersionInfo(const nlohmann::json& version_info) {
+  latest_version_info_ = version_info;
+  if (!latest_version_info_.empty() &&
+      latest_version_info_.contains("version") &&
+      latest_version_info_["version"].is_string()) {
+    latest_version_ = latest_version_info_["version"];
+    if (latest_version_info_.contains("releaseNotes") &&
+        latest_version_info_["releaseNotes"].is_string()) {
+      release_notes_ = latest_version_info_["releaseNotes"];
+    } else {
+      release_notes_ = "";
+    }
+    update_available_ = IsNewerVersion(CROSSDESK_VERSION, latest_version_);
+    if (update_available_) {
+      show_update_notification_window_ = true;
+    }
+  } else {
+    latest_version_ = "";
+    update_available_ = false;
+  }
+}
+
+void Render::RequestRedraw() {
+  redraw_until_ms_ = SDL_GetTicks() + redraw_hold_ms_;
+  // one queued event is enough to wake MainLoop
+  if (REDRAW_EVENT != 0 && !redraw_event_pending_.exchange(true)) {
+    SDL_Event event;
+    SDL_zero(event);
+    event.type = REDRAW_EVENT;
+    if (!SDL_PushEvent(&event)) {
+      redraw_event_pending_ = false;
+    }
+  }
+}
+
+bool Render::RedrawPending() { return SDL_GetTicks() < redraw_until_ms_; }
+
 void Render::MainLoop() {
+  redraw_until_ms_ = SDL_GetTicks() + redraw_hold_ms_;
+
   while (!exit_) {
-    if (!peer_) {
+    PollBackgroundInit();
+    if (!peer_ && !peer_startup_.valid()) {
       CreateConnectionPeer();
     }
 
+    // frame paced while something changes, otherwise asleep until an event
+    // or a state change arrives
     SDL_Event event;
-    if (SDL_WaitEventTimeout(&event, sdl_refresh_ms_)) {
+    int wait_ms = RedrawPending() || stream_refresh_pending_ ? sdl_refresh_ms_
+                                                             : idle_wait_ms_;
+    if (SDL_WaitEventTimeout(&event, wait_ms)) {
       ProcessSdlEvent(event);
+      while (SDL_PollEvent(&event)) {
+        ProcessSdlEvent(event);
+      }
     }
 
 #if _WIN32
@@ -1333,58 +1787,75 @@ void Render::MainLoop() {
     HandleRecentConnections();
     HandleStreamWindow();
 
-    DrawMainWindow();
-    if (stream_window_inited_) {
+    bool redraw = RedrawPending();
+    if (redraw && IsWindowVisible(main_window_)) {
+      DrawMainWindow();
+      if (!first_frame_drawn_) {
+        first_frame_drawn_ = true;
+        startup_trace_.MarkFirstFrame();
+      }
+    }
+    if (stream_window_inited_ && (redraw || stream_refresh_pending_) &&
+        IsWindowVisible(stream_window_)) {
       DrawStreamWindow();
     }
+    stream_refresh_pending_ = false;
 
     UpdateInteractions();
 
     if (need_to_send_host_info_) {
-      RemoteAction remote_action;
-      remote_action.i.display_num = display_info_list_.size();
-      remote_action.i.display_list =
-          (char**)malloc(remote_action.i.display_num * sizeof(char*));
-      remote_action.i.left =
-          (int*)malloc(remote_action.i.display_num * sizeof(int));
-      remote_action.i.top =
-          (int*)malloc(remote_action.i.display_num * sizeof(int));
-      remote_action.i.right =
-          (int*)malloc(remote_action.i.display_num * sizeof(int));
-      remote_action.i.bottom =
-          (int*)malloc(remote_action.i.display_num * sizeof(int));
-      for (int i = 0; i < remote_action.i.display_num; i++) {
-        LOG_INFO("Local display [{}:{}]", i + 1, display_info_list_[i].name);
-        remote_action.i.display_list[i] =
-            (char*)malloc(display_info_list_[i].name.length() + 1);
-        strncpy(remote_action.i.display_list[i],
-                display_info_list_[i].name.c_str(),
-                display_info_list_[i].name.length());
-        remote_action.i.display_list[i][display_info_list_[i].name.length()] =
-            '\0';
-        remote_action.i.left[i] = display_info_list_[i].left;
-        remote_action.i.top[i] = display_info_list_[i].top;
-        remote_action.i.right[i] = display_info_list_[i].right;
-        remote_action.i.bottom[i] = display_info_list_[i].bottom;
-      }
-
-      std::string host_name = GetHostName();
-      remote_action.type = ControlType::host_infomation;
-      memcpy(&remote_action.i.host_name, host_name.data(), host_name.size());
-      remote_action.i.host_name[host_name.size()] = '\0';
-      remote_action.i.host_name_size = host_name.size();
-
-      std::string msg = remote_action.to_json();
-      int ret =
-          SendDataFrame(peer_, msg.data(), msg.size(), data_label_.c_str());
-      FreeRemoteAction(remote_action);
-      if (0 == ret) {
-        need_to_send_host_info_ = false;
-      }
+      SendHostInfo();
     }
   }
 }
 
+void Render::SendHostInfo() {
+  RemoteAction remote_action;
+  remote_action.i.display_num = display_info_list_.size();
+  remote_action.i.display_list =
+      (char**)malloc(remote_action.i.display_num * sizeof(char*));
+  remote_action.i.left =
+      (int*)malloc(remote_action.i.display_num * sizeof(int));
+  remote_action.i.top = (int*)malloc(remote_action.i.display_num * sizeof(int));
+  remote_action.i.right =
+      (int*)malloc(remote_action.i.display_num * sizeof(int));
+  remote_action.i.bottom =
+      (int*)malloc(remote_action.i.display_num * sizeof(int));
+  for (int i = 0; i < remote_action.i.display_num; i++) {
+    LOG_INFO("Local display [{}:{}]", i + 1, display_info_list_[i].name);
+    remote_action.i.display_list[i] =
+        (char*)malloc(display_info_list_[i].name.length() + 1);
+    strncpy(remote_action.i.display_list[i], display_info_list_[i].name.c_str(),
+            display_info_list_[i].name.length());
+    remote_action.i.display_list[i][display_info_list_[i].name.length()] = '\0';
+    remote_action.i.left[i] = display_info_list_[i].left;
+    remote_action.i.top[i] = display_info_list_[i].top;
+    remote_action.i.right[i] = display_info_list_[i].right;
+    remote_action.i.bottom[i] = display_info_list_[i].bottom;
+  }
+
+  std::string host_name = GetHostName();
+  remote_action.type = ControlType::host_infomation;
+  memcpy(&remote_action.i.host_name, host_name.data(), host_name.size());
+  remote_action.i.host_name[host_name.size()] = '\0';
+  remote_action.i.host_name_size = host_name.size();
+
+  std::string msg = remote_action.to_json();
+  int ret = send_scheduler_->Send(SendPriority::Input, data_label_, msg.data(),
+                                  msg.size(), false);
+  FreeRemoteAction(remote_action);
+  if (0 == ret) {
+    need_to_send_host_info_ = false;
+
+    // let the controller know up front which file transfer features
+    // this side understands
+    FileTransferAck caps = FileReceiver::CapabilitiesAck();
+    send_scheduler_->Send(SendPriority::Interactive, file_feedback_label_,
+                          reinterpret_cast<const char*>(&caps),
+                          sizeof(FileTransferAck));
+  }
+}
+
 void Render::UpdateLabels() {
   if (!label_inited_ ||
       localization_language_index_last_ != localization_language_index_) {
@@ -1398,18 +1869,32 @@ void Render::UpdateLabels() {
 }
 
 void Render::HandleRecentConnections() {
-  if (reload_recent_connections_ && main_renderer_) {
+  // the first load waits for the first frame, the panel draws placeholders
+  // until the decoded thumbnails arrive
+  if (reload_recent_connections_ && main_renderer_ && first_frame_drawn_) {
     uint32_t now_time = SDL_GetTicks();
     if (now_time - recent_connection_image_save_time_ >= 50) {
+      auto load_start = std::chrono::steady_clock::now();
       int ret = thumbnail_->LoadThumbnail(main_renderer_, recent_connections_,
                                           &recent_connection_image_width_,
                                           &recent_connection_image_height_);
       if (!ret) {
         LOG_INFO("Load recent connection thumbnails");
       }
+      if (!thumbnails_traced_) {
+        startup_trace_.Record("recent connections", load_start,
+                              std::chrono::steady_clock::now());
+        thumbnails_traced_ = true;
+      }
       reload_recent_connections_ = false;
     }
   }
+
+  if (thumbnail_ && main_renderer_) {
+    thumbnail_->UploadDecodedThumbnails(main_renderer_, recent_connections_,
+                                        &recent_connection_image_width_,
+                                        &recent_connection_image_height_);
+  }
 }
 
 void Render::HandleStreamWindow() {
@@ -1430,6 +1915,8 @@ void Render::HandleStreamWindow() {
 }
 
 void Render::Cleanup() {
+  // finishes whatever startup work is still running
+  startup_pool_.reset();
   Clipboard::StopMonitoring();
 
   if (screen_capturer_) {
@@ -1444,6 +1931,8 @@ void Render::Cleanup() {
     speaker_capturer_ = nullptr;
   }
 
+  StopMicrophone();
+
   if (mouse_controller_) {
     mouse_controller_->Destroy();
     delete mouse_controller_;
@@ -1458,10 +1947,22 @@ void Render::Cleanup() {
   CleanupFactories();
   CleanupPeers();
 
+  // no audio arrives once the peers are gone
+  if (virtual_microphone_) {
+    virtual_microphone_->Destroy();
+    delete virtual_microphone_;
+    virtual_microphone_ = nullptr;
+  }
+
   WaitForThumbnailSaveTasks();
+  if (thumbnail_) {
+    thumbnail_->SetOnDecoded(nullptr);
+  }
 
   AudioDeviceDestroy();
-  DestroyMainWindowContext();
+  if (main_ctx_) {
+    DestroyMainWindowContext();
+  }
   DestroyMainWindow();
   SDL_Quit();
 }
@@ -1477,6 +1978,11 @@ void Render::CleanupFactories() {
     speaker_capturer_factory_ = nullptr;
   }
 
+  if (virtual_microphone_factory_) {
+    delete virtual_microphone_factory_;
+    virtual_microphone_factory_ = nullptr;
+  }
+
   if (device_controller_factory_) {
     delete device_controller_factory_;
     device_controller_factory_ = nullptr;
@@ -1486,32 +1992,15 @@ void Render::CleanupFactories() {
 void Render::CleanupPeer(std::shared_ptr<SubStreamWindowProperties> props) {
   SDL_FlushEvent(STREAM_REFRESH_EVENT);
 
-  if (props->dst_buffer_) {
-    size_t buffer_size = props->dst_buffer_capacity_;
-    std::vector<unsigned char> buffer_copy(buffer_size);
-    memcpy(buffer_copy.data(), props->dst_buffer_, buffer_size);
-
-    int video_width = props->video_width_;
-    int video_height = props->video_height_;
-    std::string remote_id = props->remote_id_;
-    std::string remote_host_name = props->remote_host_name_;
-    std::string password =
-        props->remember_password_ ? props->remote_password_ : "";
-
-    std::thread save_thread([buffer_copy, video_width, video_height, remote_id,
-                             remote_host_name, password,
-                             thumbnail = thumbnail_]() {
-      thumbnail->SaveToThumbnail((char*)buffer_copy.data(), video_width,
-                                 video_height, remote_id, remote_host_name,
-                                 password);
-    });
-
-    {
-      std::lock_guard<std::mutex> lock(thumbnail_save_threads_mutex_);
-      thumbnail_save_threads_.emplace_back(std::move(save_thread));
-    }
+  if (props->dst_buffer_ && thumbnail_) {
+    thumbnail_->SaveToThumbnailAsync(
+        (char*)props->dst_buffer_, props->video_width_, props->video_height_,
+        props->remote_id_, props->remote_host_name_,
+        props->remember_password_ ? props->remote_password_ : "");
   }
 
+  SetMicrophoneEnabled(props, false);
+  DropFileTransfers(props->remote_id_);
   if (props->peer_) {
     LOG_INFO("[{}] Leave connection [{}]", props->local_id_, props->remote_id_);
     LeaveConnection(props->peer_, props->remote_id_.c_str());
@@ -1524,9 +2013,15 @@ void Render::CleanupPeers() {
   if (peer_) {
     LOG_INFO("[{}] Leave connection [{}]", client_id_, client_id_);
     LeaveConnection(peer_, client_id_);
+    // pulls still running fail once the connection is gone
+    file_browser_host_.reset();
+    for (const auto& [remote_id, status] : connection_status_) {
+      DropFileTransfers(remote_id);
+    }
     is_client_mode_ = false;
     StopScreenCapturer();
     StopSpeakerCapturer();
+    StopVirtualMicrophone("");
     StopMouseController();
     StopKeyboardCapturer();
     LOG_INFO("Destroy peer [{}]", client_id_);
@@ -1548,21 +2043,8 @@ void Render::CleanupPeers() {
 }
 
 void Render::WaitForThumbnailSaveTasks() {
-  std::vector<std::thread> threads_to_join;
-
-  {
-    std::lock_guard<std::mutex> lock(thumbnail_save_threads_mutex_);
-    threads_to_join.swap(thumbnail_save_threads_);
-  }
-
-  if (threads_to_join.empty()) {
-    return;
-  }
-
-  for (auto& thread : threads_to_join) {
-    if (thread.joinable()) {
-      thread.join();
-    }
+  if (thumbnail_) {
+    thumbnail_->WaitForPendingSaves();
   }
 }
 
@@ -1597,11 +2079,10 @@ void Render::StartFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
     return;
   }
 
-  auto peer = props->peer_;
   auto props_weak = std::weak_ptr<SubStreamWindowProperties>(props);
   Render* render_ptr = this;
 
-  std::thread([peer, file_path, file_label, props_weak, render_ptr]() {
+  std::thread([file_path, file_label, props_weak, render_ptr]() {
     auto props_locked = props_weak.lock();
     if (!props_locked) {
       return;
@@ -1636,6 +2117,11 @@ void Render::StartFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
 
     FileSender sender;
     uint32_t file_id = FileSender::NextFileId();
+    // compression and checksums kick in once the receiver has advertised them
+    sender.SetPeerCapabilities([props = props_locked.get()]() -> uint32_t {
+      return props->file_peer_caps_.load();
+    });
+    sender.SetOwner(props_locked->remote_id_);
 
     {
       std::lock_guard<std::shared_mutex> lock(
@@ -1665,12 +2151,22 @@ void Render::StartFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
     props_locked->file_transfer_window_visible_ = true;
 
     // Progress will be updated via ACK from receiver
-    int ret = sender.SendFile(
-        file_path, file_path.filename().string(),
-        [peer, file_label](const char* buf, size_t sz) -> int {
-          return SendReliableDataFrame(peer, buf, sz, file_label.c_str());
-        },
-        64 * 1024, file_id);
+    // file data is paced by the remote's scheduler so input stays responsive
+    auto send = [props_weak, file_label](const char* buf, size_t sz) -> int {
+      auto props = props_weak.lock();
+      if (!props || !props->send_scheduler_) {
+        return -1;
+      }
+      return props->send_scheduler_->Send(SendPriority::Bulk, file_label, buf,
+                                          sz);
+    };
+    // a receiver that already has a file of that name gets only the changes
+    int ret =
+        (props_locked->file_peer_caps_.load() & kFileAckDelta)
+            ? sender.SendFileDelta(file_path, file_path.filename().string(),
+                                   send, 64 * 1024, file_id)
+            : sender.SendFile(file_path, file_path.filename().string(), send,
+                              64 * 1024, file_id);
 
     // file_sending_ should remain true until we receive the final ACK from
     // receiver
@@ -1714,6 +2210,186 @@ void Render::StartFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
   }).detach();
 }
 
+void Render::StartSessionTransfer(
+    std::shared_ptr<SubStreamWindowProperties> props,
+    const std::vector<SubStreamWindowProperties::QueuedFile>& items) {
+  if (!props || !props->peer_ || items.empty()) {
+    LOG_ERROR("StartSessionTransfer: invalid props, peer or empty session");
+    return;
+  }
+
+  bool expected = false;
+  if (!props->file_sending_.compare_exchange_strong(expected, true)) {
+    LOG_WARN("StartSessionTransfer called but file_sending_ is already true");
+    return;
+  }
+
+  auto props_weak = std::weak_ptr<SubStreamWindowProperties>(props);
+  Render* render_ptr = this;
+
+  std::thread([items, props_weak, render_ptr]() {
+    auto props_locked = props_weak.lock();
+    if (!props_locked) {
+      return;
+    }
+
+    std::vector<std::filesystem::path> paths;
+    for (const auto& item : items) {
+      paths.push_back(item.file_path);
+    }
+    // walking a large tree may take a while, keep it off the UI thread
+    std::vector<FileSender::SessionEntry> entries =
+        FileSender::CollectEntries(paths);
+    uint64_t total_size = 0;
+    for (const auto& entry : entries) {
+      total_size += entry.size;
+    }
+
+    props_locked->file_sent_bytes_ = 0;
+    props_locked->file_total_bytes_ = total_size;
+    props_locked->file_send_rate_bps_ = 0;
+    props_locked->file_transfer_window_visible_ = true;
+    {
+      std::lock_guard<std::mutex> lock(props_locked->file_transfer_mutex_);
+      props_locked->file_send_start_time_ = std::chrono::steady_clock::now();
+      props_locked->file_send_last_update_time_ =
+          props_locked->file_send_start_time_;
+      props_locked->file_send_last_bytes_ = 0;
+    }
+
+    FileSender sender;
+    uint32_t session_id = FileSender::NextFileId();
+    sender.SetPeerCapabilities([props = props_locked.get()]() -> uint32_t {
+      return props->file_peer_caps_.load();
+    });
+
+    {
+      std::lock_guard<std::shared_mutex> lock(
+          render_ptr->file_id_to_props_mutex_);
+      render_ptr->file_id_to_props_[session_id] = props_weak;
+    }
+
+    props_locked->current_file_id_ = session_id;
+
+    // the session acks as a whole, so its queued entries collapse into one
+    {
+      std::lock_guard<std::mutex> lock(props_locked->file_transfer_list_mutex_);
+      auto& list = props_locked->file_transfer_list_;
+      for (const auto& item : items) {
+        auto it = std::find_if(
+            list.begin(), list.end(),
+            [&item](const SubStreamWindowProperties::FileTransferInfo& info) {
+              return info.file_path == item.file_path &&
+                     info.status ==
+                         SubStreamWindowProperties::FileTransferStatus::Queued;
+            });
+        if (it != list.end()) {
+          list.erase(it);
+        }
+      }
+
+      SubStreamWindowProperties::FileTransferInfo info;
+      info.file_name = items.front().file_path.filename().string();
+      if (items.size() > 1) {
+        info.file_name += " (+" + std::to_string(items.size() - 1) + ")";
+      }
+      info.file_path = items.front().file_path;
+      info.file_size = total_size;
+      info.status = SubStreamWindowProperties::FileTransferStatus::Sending;
+      info.file_id = session_id;
+      list.push_back(info);
+    }
+
+    LOG_INFO("Session transfer started: {} items, {} entries ({} bytes)",
+             items.size(), entries.size(), total_size);
+
+    std::string file_label = items.front().file_label;
+    int ret = sender.SendSession(
+        entries,
+        [props_weak, file_label](const char* buf, size_t sz) -> int {
+          auto props = props_weak.lock();
+          if (!props || !props->send_scheduler_) {
+            return -1;
+          }
+          return props->send_scheduler_->Send(SendPriority::Bulk, file_label,
+                                              buf, sz);
+        },
+        64 * 1024, session_id);
+
+    auto props_locked_final = props_weak.lock();
+    if (props_locked_final && ret != 0) {
+      props_locked_final->file_sending_ = false;
+      props_locked_final->file_sent_bytes_ = 0;
+      props_locked_final->file_total_bytes_ = 0;
+      props_locked_final->file_send_rate_bps_ = 0;
+      props_locked_final->current_file_id_ = 0;
+
+      {
+        std::lock_guard<std::shared_mutex> lock(
+            render_ptr->file_id_to_props_mutex_);
+        render_ptr->file_id_to_props_.erase(session_id);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(
+            props_locked_final->file_transfer_list_mutex_);
+        for (auto& info : props_locked_final->file_transfer_list_) {
+          if (info.file_id == session_id) {
+            info.status = SubStreamWindowProperties::FileTransferStatus::Failed;
+            break;
+          }
+        }
+      }
+
+      LOG_ERROR("FileSender::SendSession failed, session_id={}, ret={}",
+                session_id, ret);
+
+      render_ptr->ProcessFileQueue(props_locked_final);
+    }
+  }).detach();
+}
+
+void Render::QueueFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
+                               const std::filesystem::path& path,
+                               bool is_directory) {
+  if (!props) {
+    return;
+  }
+
+  std::error_code ec;
+  uint64_t file_size =
+      is_directory ? 0 : std::filesystem::file_size(path, ec);
+  if (ec) {
+    LOG_ERROR("Failed to get file size: {}", ec.message().c_str());
+    file_size = 0;
+  }
+
+  // Add file to transfer list
+  {
+    std::lock_guard<std::mutex> lock(props->file_transfer_list_mutex_);
+    SubStreamWindowProperties::FileTransferInfo info;
+    info.file_name = path.filename().string();
+    info.file_path = path;  // Store full path for precise matching
+    info.file_size = file_size;
+    info.status = SubStreamWindowProperties::FileTransferStatus::Queued;
+    props->file_transfer_list_.push_back(info);
+  }
+  props->file_transfer_window_visible_ = true;
+
+  size_t queue_size = 0;
+  {
+    std::lock_guard<std::mutex> lock(props->file_queue_mutex_);
+    SubStreamWindowProperties::QueuedFile queued_file;
+    queued_file.file_path = path;
+    queued_file.file_label = file_label_;
+    queued_file.is_directory = is_directory;
+    props->file_send_queue_.push(queued_file);
+    queue_size = props->file_send_queue_.size();
+  }
+  LOG_INFO("File added to queue: {} ({} files in queue)",
+           path.filename().string().c_str(), queue_size);
+}
+
 void Render::ProcessFileQueue(
     std::shared_ptr<SubStreamWindowProperties> props) {
   if (!props) {
@@ -1724,14 +2400,44 @@ void Render::ProcessFileQueue(
     return;
   }
 
-  SubStreamWindowProperties::QueuedFile queued_file;
+  bool sessions = (props->file_peer_caps_.load() & kFileAckSessions) != 0;
+  std::vector<SubStreamWindowProperties::QueuedFile> queued_files;
   {
     std::lock_guard<std::mutex> lock(props->file_queue_mutex_);
     if (props->file_send_queue_.empty()) {
       return;
     }
-    queued_file = props->file_send_queue_.front();
-    props->file_send_queue_.pop();
+    // a peer that understands sessions gets everything queued so far in one
+    // go, older peers receive plain files one by one.
+    do {
+      queued_files.push_back(props->file_send_queue_.front());
+      props->file_send_queue_.pop();
+    } while (sessions && !props->file_send_queue_.empty());
+  }
+
+  if (sessions) {
+    LOG_INFO("Processing {} queued items as one session", queued_files.size());
+    StartSessionTransfer(props, queued_files);
+    return;
+  }
+
+  const auto& queued_file = queued_files.front();
+  if (queued_file.is_directory) {
+    LOG_ERROR("Remote peer cannot receive directories, skip [{}]",
+              queued_file.file_path.string().c_str());
+    {
+      std::lock_guard<std::mutex> lock(props->file_transfer_list_mutex_);
+      for (auto& info : props->file_transfer_list_) {
+        if (info.file_path == queued_file.file_path &&
+            info.status ==
+                SubStreamWindowProperties::FileTransferStatus::Queued) {
+          info.status = SubStreamWindowProperties::FileTransferStatus::Failed;
+          break;
+        }
+      }
+    }
+    ProcessFileQueue(props);
+    return;
   }
 
   LOG_INFO("Processing next file in queue: {}",
@@ -1789,6 +2495,19 @@ void Render::UpdateRenderRect() {
 }
 
 void Render::ProcessSdlEvent(const SDL_Event& event) {
+  if (event.type == REDRAW_EVENT) {
+    redraw_event_pending_ = false;
+    return;
+  }
+
+  // a new video frame only needs the stream window, anything else may
+  // change either window
+  if (event.type == STREAM_REFRESH_EVENT) {
+    stream_refresh_pending_ = true;
+  } else {
+    redraw_until_ms_ = SDL_GetTicks() + redraw_hold_ms_;
+  }
+
   if (main_ctx_) {
     ImGui::SetCurrentContext(main_ctx_);
     ImGui_ImplSDL3_ProcessEvent(&event);
@@ -1823,6 +2542,7 @@ void Render::ProcessSdlEvent(const SDL_Event& event) {
                 props->video_height_, host_name, props->remote_host_name_,
                 props->remember_password_ ? props->remote_password_ : "");
 
+            SetMicrophoneEnabled(props, false);
             if (props->peer_) {
               std::string client_id = (host_name == client_id_)
                                           ? "C-" + std::string(client_id_)
@@ -1842,7 +2562,6 @@ void Render::ProcessSdlEvent(const SDL_Event& event) {
                    sizeof(props->net_traffic_stats_));
             SDL_SetWindowFullscreen(main_window_, false);
             SDL_FlushEvents(STREAM_REFRESH_EVENT, STREAM_REFRESH_EVENT);
-            memset(audio_buffer_, 0, 720);
           }
         }
 
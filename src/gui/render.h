@@ -13,18 +13,25 @@
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <mutex>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <queue>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "IconsFontAwesome6.h"
+#include "audio_frame_ring.h"
+#include "audio_playout.h"
+#include "av_sync.h"
+#include "clipboard_sync.h"
 #include "config_center.h"
 #include "device_controller_factory.h"
+#include "file_browser.h"
 #include "imgui.h"
 #include "imgui_impl_sdl3.h"
 #include "imgui_impl_sdlrenderer3.h"
@@ -32,8 +39,12 @@
 #include "minirtc.h"
 #include "path_manager.h"
 #include "screen_capturer_factory.h"
+#include "send_scheduler.h"
 #include "speaker_capturer_factory.h"
+#include "startup_trace.h"
+#include "thread_pool.h"
 #include "thumbnail.h"
+#include "virtual_microphone_factory.h"
 
 #if _WIN32
 #include "win_tray.h"
@@ -50,6 +61,7 @@ class Render {
     std::string file_label_ = "file";
     std::string file_feedback_label_ = "file_feedback";
     std::string clipboard_label_ = "clipboard";
+    std::string file_browse_label_ = "file_browse";
     std::string local_id_ = "";
     std::string remote_id_ = "";
     bool exit_ = false;
@@ -61,6 +73,7 @@ class Render {
     bool mouse_control_button_pressed_ = true;
     bool mouse_controller_is_started_ = false;
     bool audio_capture_button_pressed_ = true;
+    bool microphone_button_pressed_ = false;
     bool control_mouse_ = true;
     bool streaming_ = false;
     bool is_control_bar_in_left_ = true;
@@ -127,6 +140,7 @@ class Render {
     int frame_count_ = 0;
     std::chrono::steady_clock::time_point last_time_;
     XNetTrafficStats net_traffic_stats_;
+    AvSync av_sync_;
 
     // File transfer progress
     std::atomic<bool> file_sending_ = false;
@@ -139,10 +153,13 @@ class Render {
     uint64_t file_send_last_bytes_ = 0;
     bool file_transfer_window_visible_ = false;
     std::atomic<uint32_t> current_file_id_{0};
+    // codec and feature bits advertised by the remote FileReceiver
+    std::atomic<uint32_t> file_peer_caps_{0};
 
     struct QueuedFile {
       std::filesystem::path file_path;
       std::string file_label;
+      bool is_directory = false;
     };
     std::queue<QueuedFile> file_send_queue_;
     std::mutex file_queue_mutex_;
@@ -160,6 +177,18 @@ class Render {
     };
     std::vector<FileTransferInfo> file_transfer_list_;
     std::mutex file_transfer_list_mutex_;
+
+    // remote file browser
+    FileBrowserClient file_browser_;
+    bool remote_file_browser_visible_ = false;
+    std::string remote_browse_path_ = "";
+    std::string remote_browse_selected_ = "";
+
+    // every data frame to this remote goes through here. Shared so that
+    // background file work can hold a weak reference to it.
+    std::shared_ptr<SendScheduler> send_scheduler_;
+    // sends through send_scheduler_, so it goes first
+    std::unique_ptr<ClipboardSync> clipboard_sync_;
   };
 
  public:
@@ -168,16 +197,32 @@ class Render {
 
  public:
   int Run();
+  // host only: no SDL video, windows or ImGui, status goes to the log
+  int RunHeadless();
 
  private:
+  int InitializePaths();
   void InitializeLogger();
   void InitializeSettings();
   void InitializeSDL();
   void InitializeModules();
+  void StartClipboardMonitoring();
   void InitializeMainWindow();
+  void StartBackgroundInit();
+  void PollBackgroundInit();
+  void WaitForPeerStartup();
+  void ApplyVersionInfo(const nlohmann::json& version_info);
+  // thread safe, wakes MainLoop to draw the windows again
+  void RequestRedraw();
+  bool RedrawPending();
   void MainLoop();
   void UpdateLabels();
   void UpdateInteractions();
+  void SendHostInfo();
+  void HeadlessLoop();
+  void LogHeadlessStatus();
+  // takes over headless_password_ once the server has assigned an id
+  void ApplyHeadlessPassword();
   void HandleRecentConnections();
   void HandleStreamWindow();
   void Cleanup();
@@ -211,6 +256,8 @@ class Render {
   void Hyperlink(const std::string& label, const std::string& url,
                  const float window_width);
   int FileTransferWindow(std::shared_ptr<SubStreamWindowProperties>& props);
+  int RemoteFileBrowserWindow(
+      std::shared_ptr<SubStreamWindowProperties>& props);
 
  private:
   int ConnectTo(const std::string& remote_id, const char* password,
@@ -220,6 +267,7 @@ class Render {
   int CreateStreamWindow();
   int DestroyStreamWindow();
   int SetupFontAndStyle(bool main_window);
+  void AddSystemChineseFont();
   int DestroyMainWindowContext();
   int DestroyStreamWindowContext();
   int DrawMainWindow();
@@ -275,16 +323,33 @@ class Render {
 
   static void FreeRemoteAction(RemoteAction& action);
 
+  // the sink reads *peer on every frame, so the scheduler survives the peer
+  // being destroyed and recreated
+  static std::shared_ptr<SendScheduler> CreateSendScheduler(PeerPtr** peer);
+  // receiver for files from `remote_id`, answering through `reply_scheduler`
+  std::shared_ptr<FileReceiver> GetFileReceiver(
+      const std::string& remote_id,
+      const std::weak_ptr<SendScheduler>& reply_scheduler,
+      const std::weak_ptr<SubStreamWindowProperties>& viewer_props);
+  // forget everything in flight for files to and from `remote_id`
+  void DropFileTransfers(const std::string& remote_id);
+
  private:
   int SendKeyCommand(int key_code, bool is_down);
   int ProcessMouseEvent(const SDL_Event& event);
 
-  static void SdlCaptureAudioIn(void* userdata, Uint8* stream, int len);
-  static void SdlCaptureAudioOut(void* userdata, Uint8* stream, int len);
+  // SDL's recording thread, copies the microphone into microphone_ring_
+  static void SDLCALL SdlCaptureAudioIn(void* userdata,
+                                        SDL_AudioStream* stream,
+                                        int additional_amount,
+                                        int total_amount);
 
  private:
   int SaveSettingsIntoCacheFile();
   int LoadSettingsFromCacheFile();
+  // 6 characters, saved into the cache along with the id. The peer has to
+  // be created again for the server to learn it.
+  void SetConnectionPassword(const char* password);
 
   int ScreenCapturerInit();
   int StartScreenCapturer();
@@ -305,10 +370,38 @@ class Render {
   void StartFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
                          const std::filesystem::path& file_path,
                          const std::string& file_label);
+  // send several files and directories as one session, the remote side
+  // recreates the tree under its download directory.
+  void StartSessionTransfer(
+      std::shared_ptr<SubStreamWindowProperties> props,
+      const std::vector<SubStreamWindowProperties::QueuedFile>& items);
+  void QueueFileTransfer(std::shared_ptr<SubStreamWindowProperties> props,
+                         const std::filesystem::path& path, bool is_directory);
   void ProcessFileQueue(std::shared_ptr<SubStreamWindowProperties> props);
+  // push the configured file transfer cap to every send scheduler
+  void ApplyFileTransferLimit();
 
   int AudioDeviceInit();
   int AudioDeviceDestroy();
+  // a few times a second, the capture time of the audio frame about to be
+  // sent, in the peer clock the video frames are stamped with
+  void AnnounceAudioClock(int64_t timestamp_us);
+
+  // switches the microphone to this remote on or off and tells its host.
+  // The device is open while any remote has it on. Must be switched off
+  // before the remote's peer is destroyed.
+  void SetMicrophoneEnabled(std::shared_ptr<SubStreamWindowProperties> props,
+                            bool enabled);
+  int StartMicrophone();
+  int StopMicrophone();
+  // hands microphone frames to the remotes one 10 ms period at a time
+  void MicrophoneSendLoop();
+  // host side, plays a viewer's microphone into the virtual source. One
+  // viewer at a time, the others are refused until it switches off or
+  // leaves. Stopping with an empty `remote_id` stops it for any viewer.
+  int StartVirtualMicrophone(const std::string& remote_id,
+                             const AudioFormat& format);
+  int StopVirtualMicrophone(const std::string& remote_id);
 
  private:
   struct CDCache {
@@ -356,6 +449,15 @@ class Render {
   int localization_language_index_ = -1;
   int localization_language_index_last_ = -1;
   bool modules_inited_ = false;
+  // startup: the main window comes first, the rest follows on startup_pool_
+  StartupTrace startup_trace_;
+  std::unique_ptr<ThreadPool> startup_pool_;
+  std::future<nlohmann::json> version_check_;
+  // speaker capturer factory, connection peer and clipboard monitoring
+  std::future<void> peer_startup_;
+  std::future<void> system_font_;
+  bool first_frame_drawn_ = false;
+  bool thumbnails_traced_ = false;
   /* ------ all windows property start ------ */
   float title_bar_width_ = 640;
   float title_bar_height_ = 30;
@@ -381,9 +483,25 @@ class Render {
   SDL_Renderer* main_renderer_ = nullptr;
   ImGuiContext* main_ctx_ = nullptr;
   ImFont* main_windows_system_chinese_font_ = nullptr;
-  ImFont* stream_windows_system_chinese_font_ = nullptr;
   bool exit_ = false;
   const int sdl_refresh_ms_ = 16;  // ~60 FPS
+  // damage-driven redraw: the windows are drawn only until redraw_until_ms_,
+  // which input, stream refreshes and state changes push forward. Long
+  // enough for ImGui hover delays and the fade animations to finish.
+  const uint64_t redraw_hold_ms_ = 1500;
+  // MainLoop still wakes this often when nothing happens
+  const int idle_wait_ms_ = 1000;
+  std::atomic<uint64_t> redraw_until_ms_{0};
+  // a REDRAW_EVENT is queued and not yet handled
+  std::atomic<bool> redraw_event_pending_{false};
+  bool stream_refresh_pending_ = false;
+  // how often the headless host checks its peer and state
+  const int headless_poll_ms_ = 100;
+  // the last status line LogHeadlessStatus wrote
+  std::string headless_status_;
+  // headless_password from config.ini, until ApplyHeadlessPassword has
+  // moved it into the cache
+  std::string headless_password_;
 #if _WIN32
   std::unique_ptr<WinTray> tray_;
 #endif
@@ -445,9 +563,6 @@ class Render {
   std::string random_password_ = "";
   char new_password_[7] = "";
   char remote_id_display_[12] = "";
-  unsigned char audio_buffer_[720];
-  int audio_len_ = 0;
-  bool audio_buffer_fresh_ = false;
   bool need_to_rejoin_ = false;
   std::chrono::steady_clock::time_point last_rejoin_check_time_;
   bool just_created_ = false;
@@ -456,7 +571,22 @@ class Render {
   bool need_to_send_host_info_ = false;
   SDL_Event last_mouse_event;
   SDL_AudioStream* output_stream_;
+  // the transport's audio track carries 48 kHz mono PCM in both directions
+  static constexpr AudioFormat kAudioWireFormat{48000, 1};
+  AudioPlayout audio_playout_;
+  // viewer side microphone, 10 ms frames from SDL's recording thread to
+  // microphone_sender_
+  SDL_AudioStream* microphone_stream_ = nullptr;
+  AudioFormat microphone_format_ = kAudioWireFormat;
+  AudioFrameRing microphone_ring_;
+  std::thread microphone_sender_;
+  std::atomic<bool> microphone_running_{false};
+  // remotes the microphone goes to, the sender holds the mutex while it
+  // sends so a remote taken off is not used afterwards
+  std::vector<std::shared_ptr<SubStreamWindowProperties>> microphone_targets_;
+  std::mutex microphone_targets_mutex_;
   uint32_t STREAM_REFRESH_EVENT = 0;
+  uint32_t REDRAW_EVENT = 0;
 
   // stream window render
   SDL_Window* stream_window_ = nullptr;
@@ -517,17 +647,36 @@ class Render {
   std::string file_label_ = "file";
   std::string file_feedback_label_ = "file_feedback";
   std::string clipboard_label_ = "clipboard";
+  std::string file_browse_label_ = "file_browse";
   Params params_;
+  // serves remote file browsing, created on the first request
+  std::unique_ptr<FileBrowserHost> file_browser_host_;
+  // shared by all viewers of this host, they use the same peer
+  std::shared_ptr<SendScheduler> send_scheduler_;
+  std::unique_ptr<ClipboardSync> clipboard_sync_;
   // Map file_id to props for tracking file transfer progress via ACK
   std::unordered_map<uint32_t, std::weak_ptr<SubStreamWindowProperties>>
       file_id_to_props_;
   std::shared_mutex file_id_to_props_mutex_;
+  // one receiver per remote id, dropped when that remote disconnects so its
+  // pending work stops
+  std::unordered_map<std::string, std::shared_ptr<FileReceiver>>
+      file_receivers_;
+  std::mutex file_receivers_mutex_;
   SDL_AudioDeviceID input_dev_;
   SDL_AudioDeviceID output_dev_;
   ScreenCapturerFactory* screen_capturer_factory_ = nullptr;
   ScreenCapturer* screen_capturer_ = nullptr;
   SpeakerCapturerFactory* speaker_capturer_factory_ = nullptr;
   SpeakerCapturer* speaker_capturer_ = nullptr;
+  std::chrono::steady_clock::time_point last_audio_clock_announce_;
+  VirtualMicrophoneFactory* virtual_microphone_factory_ = nullptr;
+  VirtualMicrophone* virtual_microphone_ = nullptr;
+  // the viewer the audio callback plays into virtual_microphone_, empty
+  // while it is stopped. The callback only tries the mutex, frames arriving
+  // while the device starts or stops are dropped.
+  std::string virtual_microphone_owner_;
+  std::mutex virtual_microphone_mutex_;
   DeviceControllerFactory* device_controller_factory_ = nullptr;
   MouseController* mouse_controller_ = nullptr;
   KeyboardCapturer* keyboard_capturer_ = nullptr;
@@ -550,6 +699,7 @@ class Render {
   int video_quality_button_value_ = 0;
   int video_frame_rate_button_value_ = 1;
   int video_encode_format_button_value_ = 0;
+  int file_transfer_limit_button_value_ = 0;
   bool enable_hardware_video_codec_ = false;
   bool enable_turn_ = true;
   bool enable_srtp_ = false;
@@ -562,6 +712,7 @@ class Render {
   int video_quality_button_value_last_ = 0;
   int video_frame_rate_button_value_last_ = 0;
   int video_encode_format_button_value_last_ = 0;
+  int file_transfer_limit_button_value_last_ = 0;
   bool enable_hardware_video_codec_last_ = false;
   bool enable_turn_last_ = true;
   bool enable_srtp_last_ = false;
@@ -590,8 +741,6 @@ class Render {
   /* ------ stream window property end ------ */
 
   /* ------ async thumbnail save tasks ------ */
-  std::vector<std::thread> thumbnail_save_threads_;
-  std::mutex thumbnail_save_threads_mutex_;
   void WaitForThumbnailSaveTasks();
 
   /* ------ server mode ------ */
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -6,7 +7,6 @@
 #include <fstream>
 #include <unordered_map>
 
-#include "clipboard.h"
 #include "device_controller.h"
 #include "file_transfer.h"
 #include "localization.h"
@@ -36,9 +36,9 @@ int Render::SendKeyCommand(int key_code, bool is_down) {
       auto props = client_properties_[controlled_remote_id_];
       if (props->connection_status_ == ConnectionStatus::Connected) {
         std::string msg = remote_action.to_json();
-        if (props->peer_) {
-          SendDataFrame(props->peer_, msg.c_str(), msg.size(),
-                        props->data_label_.c_str());
+        if (props->send_scheduler_) {
+          props->send_scheduler_->Send(SendPriority::Input, props->data_label_,
+                                       msg.c_str(), msg.size(), false);
         }
       }
     }
@@ -107,9 +107,9 @@ int Render::ProcessMouseEvent(const SDL_Event& event) {
       }
 
       std::string msg = remote_action.to_json();
-      if (props->peer_) {
-        SendDataFrame(props->peer_, msg.c_str(), msg.size(),
-                      props->data_label_.c_str());
+      if (props->send_scheduler_) {
+        props->send_scheduler_->Send(SendPriority::Input, props->data_label_,
+                                     msg.c_str(), msg.size(), false);
       }
     } else if (SDL_EVENT_MOUSE_WHEEL == event.type &&
                last_mouse_event.button.x >= props->stream_render_rect_.x &&
@@ -154,9 +154,9 @@ int Render::ProcessMouseEvent(const SDL_Event& event) {
           render_height;
 
       std::string msg = remote_action.to_json();
-      if (props->peer_) {
-        SendDataFrame(props->peer_, msg.c_str(), msg.size(),
-                      props->data_label_.c_str());
+      if (props->send_scheduler_) {
+        props->send_scheduler_->Send(SendPriority::Input, props->data_label_,
+                                     msg.c_str(), msg.size(), false);
       }
     }
   }
@@ -164,60 +164,31 @@ int Render::ProcessMouseEvent(const SDL_Event& event) {
   return 0;
 }
 
-void Render::SdlCaptureAudioIn(void* userdata, Uint8* stream, int len) {
+void SDLCALL Render::SdlCaptureAudioIn(void* userdata,
+                                       SDL_AudioStream* stream,
+                                       int additional_amount,
+                                       [[maybe_unused]] int total_amount) {
   Render* render = (Render*)userdata;
   if (!render) {
     return;
   }
 
-  if (1) {
-    // std::shared_lock lock(render->client_properties_mutex_);
-    for (const auto& it : render->client_properties_) {
-      auto props = it.second;
-      if (props->connection_status_ == ConnectionStatus::Connected) {
-        if (props->peer_) {
-          SendAudioFrame(props->peer_, (const char*)stream, len,
-                         render->audio_label_.c_str());
-        }
-      }
+  // the recording thread only copies, MicrophoneSendLoop does the sending
+  Uint8 buffer[1920];
+  while (additional_amount > 0) {
+    int len = SDL_GetAudioStreamData(
+        stream, buffer, (std::min)(additional_amount, (int)sizeof(buffer)));
+    if (len <= 0) {
+      break;
     }
-
-  } else {
-    memcpy(render->audio_buffer_, stream, len);
-    render->audio_len_ = len;
-    SDL_Delay(10);
-    render->audio_buffer_fresh_ = true;
+    additional_amount -= len;
+    int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+    render->microphone_ring_.Write(buffer, len, now_us);
   }
 }
 
-void Render::SdlCaptureAudioOut([[maybe_unused]] void* userdata,
-                                [[maybe_unused]] Uint8* stream,
-                                [[maybe_unused]] int len) {
-  // Render *render = (Render *)userdata;
-  // for (auto it : render->client_properties_) {
-  //   auto props = it.second;
-  //   if (props->connection_status_ == SignalStatus::SignalConnected) {
-  //     SendAudioFrame(props->peer_, (const char *)stream, len);
-  //   }
-  // }
-
-  // if (!render->audio_buffer_fresh_) {
-  //   return;
-  // }
-
-  // SDL_memset(stream, 0, len);
-
-  // if (render->audio_len_ == 0) {
-  //   return;
-  // } else {
-  // }
-
-  // len = (len > render->audio_len_ ? render->audio_len_ : len);
-  // SDL_MixAudioFormat(stream, render->audio_buffer_, AUDIO_S16LSB, len,
-  //                    SDL_MIX_MAXVOLUME);
-  // render->audio_buffer_fresh_ = false;
-}
-
 void Render::OnReceiveVideoBufferCb(const XVideoFrame* video_frame,
                                     const char* user_id, size_t user_id_size,
                                     const char* src_id, size_t src_id_size,
@@ -249,6 +220,8 @@ void Render::OnReceiveVideoBufferCb(const XVideoFrame* video_frame,
     }
 
     memcpy(props->dst_buffer_, video_frame->data, video_frame->size);
+    props->av_sync_.OnVideoFrame(video_frame->captured_timestamp,
+                                 GetSystemTimeMicros(props->peer_));
     bool need_to_update_render_rect = false;
     if (props->video_width_ != props->video_width_last_ ||
         props->video_height_ != props->video_height_last_) {
@@ -295,11 +268,38 @@ void Render::OnReceiveAudioBufferCb(const char* data, size_t size,
     return;
   }
 
-  render->audio_buffer_fresh_ = true;
+  std::string remote_id(user_id, user_id_size);
+  auto it = render->client_properties_.find(remote_id);
+  if (it == render->client_properties_.end()) {
+    // a viewer's microphone, it goes to the virtual source instead of the
+    // speakers
+    std::unique_lock<std::mutex> lock(render->virtual_microphone_mutex_,
+                                      std::try_to_lock);
+    if (lock.owns_lock() && render->virtual_microphone_owner_ == remote_id) {
+      render->virtual_microphone_->Play(
+          reinterpret_cast<const unsigned char*>(data), size);
+    }
+    return;
+  }
+  render->audio_playout_.SetTargetOffsetMs(
+      it->second->av_sync_.AudioOffsetMs());
 
   if (render->output_stream_) {
+    const AudioFormat& format = kAudioWireFormat;
+    int queued = SDL_GetAudioStreamQueued(render->output_stream_);
+    size_t out_frames = 0;
+    const int16_t* pcm = render->audio_playout_.Process(
+        reinterpret_cast<const int16_t*>(data),
+        size / (sizeof(int16_t) * format.channels), format.channels,
+        format.sample_rate, queued > 0 ? static_cast<size_t>(queued) : 0,
+        &out_frames);
+    if (out_frames == 0) {
+      return;
+    }
+
     int pushed = SDL_PutAudioStreamData(
-        render->output_stream_, (const Uint8*)data, static_cast<int>(size));
+        render->output_stream_, pcm,
+        static_cast<int>(out_frames * format.channels * sizeof(int16_t)));
     if (pushed < 0) {
       LOG_ERROR("Failed to push audio data: {}", SDL_GetError());
     }
@@ -319,24 +319,69 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
   if (source_id == render->file_label_) {
     std::string remote_user_id = std::string(user_id, user_id_size);
 
-    static FileReceiver receiver;
-    receiver.SetOnSendAck([render](const FileTransferAck& ack) -> int {
-      return SendReliableDataFrame(
-          render->peer_, reinterpret_cast<const char*>(&ack),
-          sizeof(FileTransferAck), render->file_feedback_label_.c_str());
-    });
+    // files pulled from a remote host arrive on the viewer's own peer, the
+    // feedback has to go back the same way
+    std::shared_ptr<SendScheduler> reply_scheduler = render->send_scheduler_;
+    std::weak_ptr<SubStreamWindowProperties> viewer_props;
+    auto props_it = render->client_properties_.find(remote_user_id);
+    if (props_it != render->client_properties_.end()) {
+      reply_scheduler = props_it->second->send_scheduler_;
+      viewer_props = props_it->second;
+    }
+    if (!reply_scheduler) {
+      return;
+    }
 
-    receiver.OnData(data, size);
+    std::shared_ptr<FileReceiver> receiver =
+        render->GetFileReceiver(remote_user_id, reply_scheduler, viewer_props);
+    receiver->OnData(data, size);
+    // receive progress
+    render->RequestRedraw();
     return;
   } else if (source_id == render->clipboard_label_) {
-    if (size > 0) {
-      std::string clipboard_text(data, size);
-      if (!Clipboard::SetText(clipboard_text)) {
-        LOG_ERROR("Failed to set clipboard content from remote");
-      }
+    // a host answers on the viewer's own peer, viewers share the host's
+    std::string remote_user_id(user_id, user_id_size);
+    ClipboardSync* clipboard_sync = render->clipboard_sync_.get();
+    auto props_it = render->client_properties_.find(remote_user_id);
+    if (props_it != render->client_properties_.end()) {
+      clipboard_sync = props_it->second->clipboard_sync_.get();
+    }
+    if (clipboard_sync) {
+      clipboard_sync->OnData(remote_user_id, data, size);
     }
     return;
+  } else if (source_id == render->file_browse_label_) {
+    std::string remote_id(user_id, user_id_size);
+    auto it = render->client_properties_.find(remote_id);
+    if (it != render->client_properties_.end()) {
+      it->second->file_browser_.OnData(data, size);
+      render->RequestRedraw();
+      return;
+    }
+
+    if (!render->file_browser_host_) {
+      render->file_browser_host_ = std::make_unique<FileBrowserHost>();
+      render->file_browser_host_->SetSendFunc(
+          [render](const char* buf, size_t sz) -> int {
+            return render->send_scheduler_->Send(SendPriority::Interactive,
+                                                 render->file_browse_label_,
+                                                 buf, sz);
+          });
+      render->file_browser_host_->SetFileSendFunc(
+          [render](const char* buf, size_t sz) -> int {
+            return render->send_scheduler_->Send(
+                SendPriority::Bulk, render->file_label_, buf, sz);
+          });
+    }
+    render->file_browser_host_->OnData(remote_id, data, size);
+    return;
   } else if (source_id == render->file_feedback_label_) {
+    // send progress and transfer state
+    render->RequestRedraw();
+    if (FileSender::OnFeedback(data, size)) {
+      return;
+    }
+
     if (size < sizeof(FileTransferAck)) {
       LOG_ERROR("FileTransferAck: buffer too small, size={}", size);
       return;
@@ -352,6 +397,23 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
       return;
     }
 
+    // acks of files the viewer pulled from this host
+    if (render->file_browser_host_ &&
+        render->file_browser_host_->OnTransferAck(ack)) {
+      return;
+    }
+
+    if (ack.file_id == 0) {
+      // capability hello sent by the remote host right after connecting
+      std::string remote_id(user_id, user_id_size);
+      auto it = render->client_properties_.find(remote_id);
+      if (it != render->client_properties_.end()) {
+        it->second->file_peer_caps_ =
+            ack.flags & (kFileAckCodecMask | kFileAckFeatureMask);
+      }
+      return;
+    }
+
     std::shared_ptr<SubStreamWindowProperties> props = nullptr;
     {
       std::shared_lock lock(render->file_id_to_props_mutex_);
@@ -366,6 +428,9 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
       return;
     }
 
+    props->file_peer_caps_ =
+        ack.flags & (kFileAckCodecMask | kFileAckFeatureMask);
+
     // Update progress based on ACK
     props->file_sent_bytes_ = ack.acked_offset;
     props->file_total_bytes_ = ack.total_size;
@@ -407,15 +472,18 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
     }
 
     // Check if transfer is completed
-    if ((ack.flags & 0x01) != 0) {
+    if ((ack.flags & kFileAckCompleted) != 0) {
       // Transfer completed - receiver has finished receiving the file
       // Reopen window if it was closed by user
       props->file_transfer_window_visible_ = true;
       props->file_sending_ = false;  // Mark sending as finished
+      // the receiver reports a digest mismatch or unrecoverable damage
+      bool failed = (ack.flags & kFileAckError) != 0;
       LOG_INFO(
           "File transfer completed via ACK, file_id={}, total_size={}, "
-          "acked_offset={}",
-          ack.file_id, ack.total_size, ack.acked_offset);
+          "acked_offset={}, verified={}, failed={}",
+          ack.file_id, ack.total_size, ack.acked_offset,
+          (ack.flags & kFileAckVerified) != 0, failed);
 
       // Update file transfer list: mark as completed
       {
@@ -423,8 +491,11 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
         for (auto& info : props->file_transfer_list_) {
           if (info.file_id == ack.file_id) {
             info.status =
-                SubStreamWindowProperties::FileTransferStatus::Completed;
-            info.sent_bytes = ack.total_size;
+                failed ? SubStreamWindowProperties::FileTransferStatus::Failed
+                       : SubStreamWindowProperties::FileTransferStatus::Completed;
+            if (!failed) {
+              info.sent_bytes = ack.total_size;
+            }
             break;
           }
         }
@@ -472,6 +543,11 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
                         remote_action.i.left[i], remote_action.i.top[i],
                         remote_action.i.right[i], remote_action.i.bottom[i]));
       }
+      render->RequestRedraw();
+    } else if (remote_action.type == ControlType::audio_clock) {
+      props->av_sync_.OnAudioClock(
+          remote_action.t, GetSystemTimeMicros(props->peer_),
+          render->audio_playout_.GetStats().depth_ms);
     }
     FreeRemoteAction(remote_action);
   } else {
@@ -493,6 +569,15 @@ void Render::OnReceiveDataBufferCb(const char* data, size_t size,
                render->screen_capturer_) {
       render->selected_display_ = remote_action.d;
       render->screen_capturer_->SwitchTo(remote_action.d);
+    } else if (remote_action.type == ControlType::microphone) {
+      if (remote_action.f.channels > 0) {
+        AudioFormat format;
+        format.sample_rate = remote_action.f.sample_rate;
+        format.channels = remote_action.f.channels;
+        render->StartVirtualMicrophone(remote_id, format);
+      } else {
+        render->StopVirtualMicrophone(remote_id);
+      }
     }
   }
 }
@@ -503,6 +588,7 @@ void Render::OnSignalStatusCb(SignalStatus status, const char* user_id,
   if (!render) {
     return;
   }
+  render->RequestRedraw();
 
   std::string client_id(user_id, user_id_size);
   if (client_id == render->client_id_) {
@@ -555,6 +641,7 @@ void Render::OnConnectionStatusCb(ConnectionStatus status, const char* user_id,
                                   const size_t user_id_size, void* user_data) {
   Render* render = (Render*)user_data;
   if (!render) return;
+  render->RequestRedraw();
 
   std::string remote_id(user_id, user_id_size);
   // std::shared_lock lock(render->client_properties_mutex_);
@@ -584,6 +671,8 @@ void Render::OnConnectionStatusCb(ConnectionStatus status, const char* user_id,
       case ConnectionStatus::Closed: {
         props->connection_established_ = false;
         props->mouse_control_button_pressed_ = false;
+        // a reconnect starts with the microphone off on both sides
+        render->SetMicrophoneEnabled(props, false);
         if (props->dst_buffer_ && props->stream_texture_) {
           memset(props->dst_buffer_, 0, props->dst_buffer_capacity_);
           SDL_UpdateTexture(props->stream_texture_, NULL, props->dst_buffer_,
@@ -660,6 +749,8 @@ void Render::OnConnectionStatusCb(ConnectionStatus status, const char* user_id,
 
           render->connection_status_.erase(remote_id);
         }
+        render->StopVirtualMicrophone(remote_id);
+        render->DropFileTransfers(remote_id);
 
         if (std::all_of(render->connection_status_.begin(),
                         render->connection_status_.end(), [](const auto& kv) {
@@ -685,6 +776,7 @@ void Render::NetStatusReport(const char* client_id, size_t client_id_size,
   if (!render) {
     return;
   }
+  render->RequestRedraw();
 
   if (strchr(client_id, '@') != nullptr && strchr(user_id, '-') == nullptr) {
     std::string id, password;
@@ -786,6 +878,14 @@ void Render::NetStatusReport(const char* client_id, size_t client_id_size,
     }
   }
 
+  // viewer peers are created with a "C-" user id, everything else is reported
+  // by the host peer, whose scheduler is shared by all of its viewers
+  bool from_viewer_peer = strstr(client_id, "C-") != nullptr;
+  if (!from_viewer_peer && net_traffic_stats && render->send_scheduler_) {
+    render->send_scheduler_->OnTransportStats(
+        net_traffic_stats->data_outbound_stats.bitrate);
+  }
+
   std::string remote_id(user_id, user_id_size);
   // std::shared_lock lock(render->client_properties_mutex_);
   if (render->client_properties_.find(remote_id) ==
@@ -802,6 +902,11 @@ void Render::NetStatusReport(const char* client_id, size_t client_id_size,
     return;
   }
 
+  if (from_viewer_peer && props->send_scheduler_) {
+    props->send_scheduler_->OnTransportStats(
+        net_traffic_stats->data_outbound_stats.bitrate);
+  }
+
   // only display client side net status if connected to itself
   if (!(render->peer_reserved_ && !strstr(client_id, "C-"))) {
     props->net_traffic_stats_ = *net_traffic_stats;
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <string>
+#include <thread>
+
+#include "rd_log.h"
+#include "render.h"
+
+namespace crossdesk {
+
+namespace {
+std::atomic<bool> headless_stop_requested{false};
+
+void OnHeadlessStopSignal(int) { headless_stop_requested = true; }
+
+const char* SignalStatusName(SignalStatus status) {
+  switch (status) {
+    case SignalStatus::SignalConnecting:
+      return "connecting";
+    case SignalStatus::SignalConnected:
+      return "connected";
+    case SignalStatus::SignalFailed:
+      return "failed";
+    case SignalStatus::SignalClosed:
+      return "closed";
+    case SignalStatus::SignalReconnecting:
+      return "reconnecting";
+    case SignalStatus::SignalServerClosed:
+      return "server closed";
+    default:
+      return "unknown";
+  }
+}
+}  // namespace
+
+int Render::RunHeadless() {
+  {
+    StartupTrace::Scope stage(startup_trace_, "paths and config");
+    if (0 != InitializePaths()) {
+      return -1;
+    }
+  }
+
+  {
+    StartupTrace::Scope stage(startup_trace_, "logger");
+    InitializeLogger();
+  }
+  LOG_INFO("CrossDesk version: {}, headless host", CROSSDESK_VERSION);
+
+  {
+    StartupTrace::Scope stage(startup_trace_, "settings");
+    InitializeSettings();
+  }
+
+  // there is no window to set the password in
+  headless_password_ = config_center_->GetHeadlessPassword();
+  if (!headless_password_.empty() && headless_password_.size() != 6) {
+    LOG_ERROR("Ignored headless_password in config.ini, it needs 6 characters");
+    headless_password_.clear();
+  }
+  if (headless_password_.empty()) {
+    LOG_INFO(
+        "Set headless_password in {}/config.ini to choose the connection "
+        "password",
+        cache_path_);
+  }
+  ApplyHeadlessPassword();
+
+  // what InitializeModules sets up for hosting, without the audio output a
+  // controller plays the remote sound through
+  {
+    StartupTrace::Scope stage(startup_trace_, "modules");
+    screen_capturer_factory_ = new ScreenCapturerFactory();
+    speaker_capturer_factory_ = new SpeakerCapturerFactory();
+    virtual_microphone_factory_ = new VirtualMicrophoneFactory();
+    device_controller_factory_ = new DeviceControllerFactory();
+    keyboard_capturer_ = (KeyboardCapturer*)device_controller_factory_->Create(
+        DeviceControllerFactory::Device::Keyboard);
+    modules_inited_ = true;
+  }
+  {
+    StartupTrace::Scope stage(startup_trace_, "connection peer");
+    CreateConnectionPeer();
+  }
+  StartClipboardMonitoring();
+
+  std::signal(SIGINT, OnHeadlessStopSignal);
+  std::signal(SIGTERM, OnHeadlessStopSignal);
+
+  HeadlessLoop();
+
+  Cleanup();
+
+  return 0;
+}
+
+void Render::HeadlessLoop() {
+  LOG_INFO("Headless host running, stop it with SIGINT or SIGTERM");
+
+  while (!exit_ && !headless_stop_requested) {
+    ApplyHeadlessPassword();
+
+    if (!peer_) {
+      CreateConnectionPeer();
+    }
+
+#if _WIN32
+    MSG msg;
+    while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)) {
+      TranslateMessage(&msg);
+      DispatchMessage(&msg);
+    }
+#endif
+
+    UpdateInteractions();
+
+    if (need_to_send_host_info_) {
+      SendHostInfo();
+    }
+
+    LogHeadlessStatus();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(headless_poll_ms_));
+  }
+
+  LOG_INFO("Headless host stopping");
+}
+
+void Render::ApplyHeadlessPassword() {
+  // a first start has no id until the server assigns one
+  if (headless_password_.empty() || client_id_[0] == '\0') {
+    return;
+  }
+
+  SetConnectionPassword(headless_password_.c_str());
+  config_center_->ClearHeadlessPassword();
+  headless_password_.clear();
+  LOG_INFO("Connection password set from config.ini");
+
+  if (peer_) {
+    // registered with the old password, the loop creates it again
+    LeaveConnection(peer_, client_id_);
+    DestroyPeer(&peer_);
+  }
+}
+
+void Render::LogHeadlessStatus() {
+  size_t connected =
+      std::count_if(connection_status_.begin(), connection_status_.end(),
+                    [](const auto& status) {
+                      return status.second == ConnectionStatus::Connected;
+                    });
+
+  std::string status = std::string("id [") + client_id_ + "], signal [" +
+                       SignalStatusName(signal_status_) + "], " +
+                       std::to_string(connected) + " controller(s) connected";
+  if (status != headless_status_) {
+    headless_status_ = status;
+    LOG_INFO("Headless host: {}", headless_status_);
+  }
+}
+
+}  // namespace crossdesk
@@ -15,15 +15,37 @@
 
 namespace crossdesk {
 
-std::string OpenFileDialog(std::string title) {
-  const char* path = tinyfd_openFileDialog(title.c_str(),
-                                           "",       // default path
-                                           0,        // number of filters
-                                           nullptr,  // filters
-                                           nullptr,  // filter description
-                                           0         // no multiple selection
+std::vector<std::string> OpenFileDialog(std::string title) {
+  const char* paths = tinyfd_openFileDialog(title.c_str(),
+                                            "",       // default path
+                                            0,        // number of filters
+                                            nullptr,  // filters
+                                            nullptr,  // filter description
+                                            1         // multiple selection
   );
 
+  // multiple selections come back separated by '|'
+  std::vector<std::string> result;
+  if (!paths) {
+    return result;
+  }
+  std::string selection = paths;
+  size_t start = 0;
+  while (start < selection.size()) {
+    size_t end = selection.find('|', start);
+    if (end == std::string::npos) {
+      end = selection.size();
+    }
+    if (end > start) {
+      result.push_back(selection.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+  return result;
+}
+
+std::string OpenFolderDialog(std::string title) {
+  const char* path = tinyfd_selectFolderDialog(title.c_str(), "");
   return path ? path : "";
 }
 
@@ -95,8 +117,9 @@ int Render::ControlBar(std::shared_ptr<SubStreamWindowProperties>& props) {
           remote_action.d = i;
           if (props->connection_status_ == ConnectionStatus::Connected) {
             std::string msg = remote_action.to_json();
-            SendDataFrame(props->peer_, msg.c_str(), msg.size(),
-                          props->data_label_.c_str());
+            props->send_scheduler_->Send(SendPriority::Input,
+                                         props->data_label_, msg.c_str(),
+                                         msg.size(), false);
           }
         }
         props->display_selectable_hovered_ = ImGui::IsWindowHovered();
@@ -176,8 +199,8 @@ int Render::ControlBar(std::shared_ptr<SubStreamWindowProperties>& props) {
         remote_action.type = ControlType::audio_capture;
         remote_action.a = props->audio_capture_button_pressed_;
         std::string msg = remote_action.to_json();
-        SendDataFrame(props->peer_, msg.c_str(), msg.size(),
-                      props->data_label_.c_str());
+        props->send_scheduler_->Send(SendPriority::Input, props->data_label_,
+                                     msg.c_str(), msg.size(), false);
       }
     }
 
@@ -197,78 +220,89 @@ int Render::ControlBar(std::shared_ptr<SubStreamWindowProperties>& props) {
           line_thickness);
     }
 
+    ImGui::SameLine();
+    // microphone button
+    float microphone_x = ImGui::GetCursorScreenPos().x;
+    float microphone_y = ImGui::GetCursorScreenPos().y;
+    float disable_microphone_x = microphone_x + line_padding;
+    float disable_microphone_y = microphone_y + line_padding;
+
+    std::string microphone = ICON_FA_MICROPHONE;
+    ImGui::SetWindowFontScale(0.5f);
+    if (ImGui::Button(microphone.c_str(),
+                      ImVec2(button_width, button_height))) {
+      if (props->connection_established_) {
+        SetMicrophoneEnabled(props, !props->microphone_button_pressed_);
+      }
+    }
+
+    if (!props->microphone_button_pressed_) {
+      draw_list->AddLine(ImVec2(disable_microphone_x, disable_microphone_y),
+                         ImVec2(microphone_x + button_width - line_padding,
+                                microphone_y + button_height - line_padding),
+                         IM_COL32(0, 0, 0, 255), line_thickness);
+      draw_list->AddLine(
+          ImVec2(disable_microphone_x - line_thickness * 0.7f,
+                 disable_microphone_y + line_thickness * 0.7f),
+          ImVec2(microphone_x + button_width - line_padding -
+                     line_thickness * 0.7f,
+                 microphone_y + button_height - line_padding +
+                     line_thickness * 0.7f),
+          ImGui::IsItemHovered() ? IM_COL32(66, 150, 250, 255)
+                                 : IM_COL32(179, 213, 253, 255),
+          line_thickness);
+    }
+
     ImGui::SameLine();
     std::string open_folder = ICON_FA_FOLDER_OPEN;
     if (ImGui::Button(open_folder.c_str(),
                       ImVec2(button_width, button_height))) {
-      std::string title =
-          localization::select_file[localization_language_index_];
-      std::string path = OpenFileDialog(title);
-      if (!path.empty()) {
-        LOG_INFO("Selected file: {}", path.c_str());
-
-        std::filesystem::path file_path = std::filesystem::path(path);
-        std::string file_label = file_label_;
-
-        // Get file size
-        std::error_code ec;
-        uint64_t file_size = std::filesystem::file_size(file_path, ec);
-        if (ec) {
-          LOG_ERROR("Failed to get file size: {}", ec.message().c_str());
-          file_size = 0;
-        }
+      ImGui::OpenPopup("file");
+    }
 
-        // Add file to transfer list
-        {
-          std::lock_guard<std::mutex> lock(props->file_transfer_list_mutex_);
-          SubStreamWindowProperties::FileTransferInfo info;
-          info.file_name = file_path.filename().string();
-          info.file_path = file_path;  // Store full path for precise matching
-          info.file_size = file_size;
-          info.status = SubStreamWindowProperties::FileTransferStatus::Queued;
-          info.sent_bytes = 0;
-          info.file_id = 0;
-          info.rate_bps = 0;
-          props->file_transfer_list_.push_back(info);
+    if (ImGui::BeginPopup("file")) {
+      ImGui::SetWindowFontScale(0.5f);
+      std::vector<std::filesystem::path> selected;
+      bool is_directory = false;
+      if (ImGui::Selectable(
+              localization::send_files[localization_language_index_]
+                  .c_str())) {
+        std::string title =
+            localization::select_file[localization_language_index_];
+        for (const auto& path : OpenFileDialog(title)) {
+          selected.emplace_back(path);
         }
-        props->file_transfer_window_visible_ = true;
-
-        if (props->file_sending_.load()) {
-          // Add to queue
-          size_t queue_size = 0;
-          {
-            std::lock_guard<std::mutex> lock(props->file_queue_mutex_);
-            SubStreamWindowProperties::QueuedFile queued_file;
-            queued_file.file_path = file_path;
-            queued_file.file_label = file_label;
-            props->file_send_queue_.push(queued_file);
-            queue_size = props->file_send_queue_.size();
-          }
-          LOG_INFO("File added to queue: {} ({} files in queue)",
-                   file_path.filename().string().c_str(), queue_size);
-        } else {
-          StartFileTransfer(props, file_path, file_label);
-
-          if (props->file_sending_.load()) {
-          } else {
-            // Failed to start (race condition: another file started between
-            // check and call) Add to queue
-            size_t queue_size = 0;
-            {
-              std::lock_guard<std::mutex> lock(props->file_queue_mutex_);
-              SubStreamWindowProperties::QueuedFile queued_file;
-              queued_file.file_path = file_path;
-              queued_file.file_label = file_label;
-              props->file_send_queue_.push(queued_file);
-              queue_size = props->file_send_queue_.size();
-            }
-            LOG_INFO(
-                "File added to queue after race condition: {} ({} files in "
-                "queue)",
-                file_path.filename().string().c_str(), queue_size);
-          }
+      }
+      if (ImGui::Selectable(
+              localization::send_folder[localization_language_index_]
+                  .c_str())) {
+        std::string title =
+            localization::select_folder[localization_language_index_];
+        std::string path = OpenFolderDialog(title);
+        if (!path.empty()) {
+          selected.emplace_back(path);
+          is_directory = true;
         }
       }
+      if (ImGui::Selectable(
+              localization::browse_remote_files[localization_language_index_]
+                  .c_str())) {
+        props->remote_file_browser_visible_ =
+            !props->remote_file_browser_visible_;
+      }
+      props->display_selectable_hovered_ = ImGui::IsWindowHovered();
+      ImGui::EndPopup();
+
+      for (const auto& path : selected) {
+        LOG_INFO("Selected {}: {}", is_directory ? "folder" : "file",
+                 path.string().c_str());
+        QueueFileTransfer(props, path, is_directory);
+      }
+      // items selected together leave in one session when the peer
+      // supports it
+      if (!selected.empty()) {
+        ProcessFileQueue(props);
+      }
     }
 
     ImGui::SameLine();
@@ -451,6 +485,37 @@ int Render::NetTrafficStats(std::shared_ptr<SubStreamWindowProperties>& props) {
     ImGui::TableNextColumn();
     ImGui::TableNextColumn();
 
+    AudioPlayout::Stats playout = audio_playout_.GetStats();
+    ImGui::TableNextColumn();
+    ImGui::Text(
+        "%s",
+        localization::audio_buffer[localization_language_index_].c_str());
+    ImGui::TableNextColumn();
+    ImGui::Text("%u/%u ms", playout.depth_ms, playout.target_ms);
+    ImGui::TableNextColumn();
+    ImGui::Text("%s %llu",
+                localization::concealed[localization_language_index_].c_str(),
+                static_cast<unsigned long long>(
+                    playout.stretched + playout.compressed + playout.dropped +
+                    playout.underruns));
+    ImGui::TableNextColumn();
+
+    AvSync::Stats av_sync = props->av_sync_.GetStats();
+    ImGui::TableNextColumn();
+    ImGui::Text("%s",
+                localization::av_skew[localization_language_index_].c_str());
+    ImGui::TableNextColumn();
+    if (av_sync.valid) {
+      ImGui::Text("%+d ms", av_sync.skew_ms);
+    } else {
+      ImGui::Text("-");
+    }
+    ImGui::TableNextColumn();
+    if (av_sync.valid) {
+      ImGui::Text("%+d ms", av_sync.audio_offset_ms);
+    }
+    ImGui::TableNextColumn();
+
     ImGui::EndTable();
   }
   ImGui::SetWindowFontScale(1.0f);
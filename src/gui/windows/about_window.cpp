@@ -39,8 +39,8 @@ int Render::AboutWindow() {
   if (show_about_window_) {
     float about_window_width = title_bar_button_width_ * 7.5f;
     float about_window_height = latest_version_.empty()
-                                    ? title_bar_button_width_ * 4.0f
-                                    : title_bar_button_width_ * 4.6f;
+                                    ? title_bar_button_width_ * 4.6f
+                                    : title_bar_button_width_ * 5.2f;
 
     const ImGuiViewport* viewport = ImGui::GetMainViewport();
     ImGui::SetNextWindowPos(ImVec2(
@@ -74,6 +74,15 @@ int Render::AboutWindow() {
     ImGui::SetCursorPosX(about_window_width * 0.1f);
     ImGui::Text("%s", text.c_str());
 
+    int64_t first_frame_ms = startup_trace_.TimeToFirstFrameMs();
+    if (first_frame_ms >= 0) {
+      std::string startup_text =
+          localization::startup_time[localization_language_index_] + ": " +
+          std::to_string(first_frame_ms) + " ms";
+      ImGui::SetCursorPosX(about_window_width * 0.1f);
+      ImGui::Text("%s", startup_text.c_str());
+    }
+
     if (update_available_) {
       std::string latest_version =
           localization::new_version_available[localization_language_index_] +
@@ -15,28 +15,28 @@ int Render::SettingWindow() {
       !defined(__arm__) && USE_CUDA) ||                                   \
      defined(__APPLE__))
         ImGui::SetNextWindowPos(
-            ImVec2(io.DisplaySize.x * 0.343f, io.DisplaySize.y * 0.07f));
+            ImVec2(io.DisplaySize.x * 0.343f, io.DisplaySize.y * 0.04f));
         ImGui::SetNextWindowSize(
-            ImVec2(io.DisplaySize.x * 0.315f, io.DisplaySize.y * 0.85f));
+            ImVec2(io.DisplaySize.x * 0.315f, io.DisplaySize.y * 0.91f));
 #else
         ImGui::SetNextWindowPos(
-            ImVec2(io.DisplaySize.x * 0.343f, io.DisplaySize.y * 0.1f));
+            ImVec2(io.DisplaySize.x * 0.343f, io.DisplaySize.y * 0.07f));
         ImGui::SetNextWindowSize(
-            ImVec2(io.DisplaySize.x * 0.315f, io.DisplaySize.y * 0.8f));
+            ImVec2(io.DisplaySize.x * 0.315f, io.DisplaySize.y * 0.86f));
 #endif
       } else {
 #if (((defined(_WIN32) || defined(__linux__)) && !defined(__aarch64__) && \
       !defined(__arm__) && USE_CUDA) ||                                   \
      defined(__APPLE__))
         ImGui::SetNextWindowPos(
-            ImVec2(io.DisplaySize.x * 0.297f, io.DisplaySize.y * 0.07f));
+            ImVec2(io.DisplaySize.x * 0.297f, io.DisplaySize.y * 0.04f));
         ImGui::SetNextWindowSize(
-            ImVec2(io.DisplaySize.x * 0.407f, io.DisplaySize.y * 0.85f));
+            ImVec2(io.DisplaySize.x * 0.407f, io.DisplaySize.y * 0.91f));
 #else
         ImGui::SetNextWindowPos(
-            ImVec2(io.DisplaySize.x * 0.297f, io.DisplaySize.y * 0.1f));
+            ImVec2(io.DisplaySize.x * 0.297f, io.DisplaySize.y * 0.07f));
         ImGui::SetNextWindowSize(
-            ImVec2(io.DisplaySize.x * 0.407f, io.DisplaySize.y * 0.8f));
+            ImVec2(io.DisplaySize.x * 0.407f, io.DisplaySize.y * 0.86f));
 #endif
       }
 
@@ -201,6 +201,42 @@ int Render::SettingWindow() {
         }
       }
 
+      ImGui::Separator();
+
+      {
+        const char* file_transfer_limit_items[] = {
+            localization::unlimited[localization_language_index_].c_str(),
+            "1 Mbps", "5 Mbps", "20 Mbps"};
+
+        settings_items_offset += settings_items_padding;
+        ImGui::SetCursorPosY(settings_items_offset);
+        ImGui::AlignTextToFramePadding();
+        ImGui::Text(
+            "%s",
+            localization::file_transfer_limit[localization_language_index_]
+                .c_str());
+        ImGui::SameLine();
+        if (ConfigCenter::LANGUAGE::CHINESE == localization_language_) {
+          ImGui::SetCursorPosX(title_bar_button_width_ * 3.0f);
+        } else {
+          ImGui::SetCursorPosX(title_bar_button_width_ * 4.5f);
+        }
+
+        ImGui::SetNextItemWidth(title_bar_button_width_ * 1.8f);
+        if (ImGui::BeginCombo(
+                "##file_transfer_limit",
+                file_transfer_limit_items[file_transfer_limit_button_value_])) {
+          ImGui::SetWindowFontScale(0.5f);
+          for (int i = 0; i < IM_ARRAYSIZE(file_transfer_limit_items); i++) {
+            bool selected = (i == file_transfer_limit_button_value_);
+            if (ImGui::Selectable(file_transfer_limit_items[i], selected))
+              file_transfer_limit_button_value_ = i;
+          }
+
+          ImGui::EndCombo();
+        }
+      }
+
 #if (((defined(_WIN32) || defined(__linux__)) && !defined(__aarch64__) && \
       !defined(__arm__) && USE_CUDA) ||                                   \
      defined(__APPLE__))
@@ -415,6 +451,14 @@ int Render::SettingWindow() {
         video_encode_format_button_value_last_ =
             video_encode_format_button_value_;
 
+        // File transfer limit
+        config_center_->SetFileTransferLimit(
+            static_cast<ConfigCenter::FILE_TRANSFER_LIMIT>(
+                file_transfer_limit_button_value_));
+        file_transfer_limit_button_value_last_ =
+            file_transfer_limit_button_value_;
+        ApplyFileTransferLimit();
+
         // Hardware video codec
         if (enable_hardware_video_codec_) {
           config_center_->SetHardwareVideoCodec(true);
@@ -472,6 +516,7 @@ int Render::SettingWindow() {
         settings_window_pos_reset_ = true;
 
         // Recreate peer instance
+        WaitForPeerStartup();
         LoadSettingsFromCacheFile();
 
         // Recreate peer instance
@@ -508,6 +553,12 @@ int Render::SettingWindow() {
               video_encode_format_button_value_last_;
         }
 
+        if (file_transfer_limit_button_value_ !=
+            file_transfer_limit_button_value_last_) {
+          file_transfer_limit_button_value_ =
+              file_transfer_limit_button_value_last_;
+        }
+
         if (enable_hardware_video_codec_ != enable_hardware_video_codec_last_) {
           enable_hardware_video_codec_ = enable_hardware_video_codec_last_;
         }
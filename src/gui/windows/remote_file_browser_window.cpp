@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "IconsFontAwesome6.h"
+#include "layout.h"
+#include "localization.h"
+#include "rd_log.h"
+#include "render.h"
+
+namespace crossdesk {
+
+namespace {
+void FormatSize(uint64_t size, char* out, size_t out_size) {
+  if (size < 1024) {
+    snprintf(out, out_size, "%llu B", (unsigned long long)size);
+  } else if (size < 1024 * 1024) {
+    snprintf(out, out_size, "%.1f KB", size / 1024.0f);
+  } else if (size < 1024ull * 1024 * 1024) {
+    snprintf(out, out_size, "%.1f MB", size / (1024.0f * 1024.0f));
+  } else {
+    snprintf(out, out_size, "%.2f GB", size / (1024.0f * 1024.0f * 1024.0f));
+  }
+}
+}  // namespace
+
+int Render::RemoteFileBrowserWindow(
+    std::shared_ptr<SubStreamWindowProperties>& props) {
+  if (!props->remote_file_browser_visible_) {
+    return 0;
+  }
+
+  FileBrowserClient& browser = props->file_browser_;
+  // an empty path lists the host's home directory, switch to the real path
+  // once the host resolved it
+  if (props->remote_browse_path_.empty()) {
+    std::string resolved = browser.Resolve("");
+    if (!resolved.empty()) {
+      props->remote_browse_path_ = resolved;
+    }
+  }
+  browser.Browse(props->remote_browse_path_);
+
+  float window_width = main_window_width_ * 0.6f;
+  float window_height = stream_window_height_ * 0.6f;
+  float pos_x = stream_window_width_ - window_width - window_width * 0.05f;
+  float pos_y = stream_window_height_ * 0.2f;
+
+  ImGui::SetNextWindowPos(ImVec2(pos_x, pos_y), ImGuiCond_Always);
+  ImGui::SetNextWindowSize(ImVec2(window_width, window_height),
+                           ImGuiCond_Always);
+
+  ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 3.0f);
+  ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 1.0f);
+  ImGui::PushStyleColor(ImGuiCol_WindowBg, ImVec4(1.0f, 1.0f, 1.0f, 0.9f));
+  ImGui::PushStyleColor(ImGuiCol_Border, ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+  ImGui::PushStyleColor(ImGuiCol_TitleBg, ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+  ImGui::PushStyleColor(ImGuiCol_TitleBgActive, ImVec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+  ImGui::SetWindowFontScale(0.5f);
+  bool window_opened = true;
+  if (!ImGui::Begin(
+          localization::remote_files[localization_language_index_].c_str(),
+          &window_opened,
+          ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize |
+              ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings |
+              ImGuiWindowFlags_NoScrollbar)) {
+    ImGui::PopStyleColor(4);
+    ImGui::PopStyleVar(2);
+    ImGui::End();
+    ImGui::SetWindowFontScale(1.0f);
+    return 0;
+  }
+  ImGui::SetWindowFontScale(1.0f);
+  ImGui::SetWindowFontScale(0.5f);
+  ImGui::PopStyleColor(4);
+  ImGui::PopStyleVar(2);
+
+  if (!window_opened) {
+    props->remote_file_browser_visible_ = false;
+    ImGui::End();
+    ImGui::SetWindowFontScale(1.0f);
+    return 0;
+  }
+
+  std::string navigate_to;
+  if (ImGui::Button(ICON_FA_ARROW_UP)) {
+    navigate_to = FileBrowserClient::ParentPath(props->remote_browse_path_);
+  }
+  ImGui::SameLine();
+  if (ImGui::Button(ICON_FA_ARROWS_ROTATE)) {
+    browser.Refresh(props->remote_browse_path_);
+  }
+  ImGui::SameLine();
+  ImGui::TextUnformatted(props->remote_browse_path_.c_str());
+
+  // only the visible rows are drawn, so huge directories stay cheap while
+  // the cache lock is held
+  float list_height = window_height * 0.62f;
+  ImGui::BeginChild("RemoteFileList", ImVec2(0, list_height),
+                    ImGuiChildFlags_Border);
+  ImGui::SetWindowFontScale(1.0f);
+  ImGui::SetWindowFontScale(0.5f);
+  bool listed = browser.View(
+      props->remote_browse_path_,
+      [&](const FileBrowserClient::Listing& listing) {
+        if (listing.error != FileListError::None) {
+          ImGui::TextColored(
+              ImVec4(1.0f, 0.2f, 0.2f, 1.0f), "%s",
+              localization::cannot_open_folder[localization_language_index_]
+                  .c_str());
+          return;
+        }
+
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(listing.entries.size()));
+        while (clipper.Step()) {
+          for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+            const FileListEntry& entry = listing.entries[i];
+            bool is_dir = entry.type == FileListEntryType::Directory;
+            std::string full_path =
+                FileBrowserClient::JoinPath(listing.path, entry.name);
+
+            ImGui::PushID(i);
+            std::string label = std::string(is_dir ? ICON_FA_FOLDER
+                                                   : ICON_FA_FILE) +
+                                " " + entry.name;
+            if (ImGui::Selectable(
+                    label.c_str(), props->remote_browse_selected_ == full_path,
+                    ImGuiSelectableFlags_AllowDoubleClick)) {
+              props->remote_browse_selected_ = full_path;
+              if (is_dir &&
+                  ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
+                navigate_to = full_path;
+              }
+            }
+            if (entry.type == FileListEntryType::File) {
+              char size_str[32];
+              FormatSize(entry.size, size_str, sizeof(size_str));
+              ImGui::SameLine(window_width * 0.75f);
+              ImGui::TextUnformatted(size_str);
+            }
+            ImGui::PopID();
+          }
+        }
+
+        if (!listing.complete) {
+          ImGui::Text("%s... %zu / %u",
+                      localization::loading[localization_language_index_]
+                          .c_str(),
+                      listing.entries.size(), listing.total_entries);
+        }
+      });
+  if (!listed) {
+    ImGui::Text("%s...",
+                localization::loading[localization_language_index_].c_str());
+  }
+  ImGui::SetWindowFontScale(1.0f);
+  ImGui::SetWindowFontScale(0.5f);
+  ImGui::EndChild();
+
+  bool has_selection = !props->remote_browse_selected_.empty();
+  ImGui::BeginDisabled(!has_selection);
+  std::string download_label =
+      std::string(ICON_FA_DOWNLOAD) + " " +
+      localization::download[localization_language_index_];
+  if (ImGui::Button(download_label.c_str())) {
+    uint32_t caps = FileReceiver::CapabilitiesAck().flags;
+    uint32_t transfer_id =
+        browser.Pull({props->remote_browse_selected_}, caps);
+    LOG_INFO("Pull [{}] from remote, transfer_id={}",
+             props->remote_browse_selected_, transfer_id);
+  }
+  ImGui::EndDisabled();
+
+  // most recent pulls
+  std::vector<FileBrowserClient::PullInfo> pulls = browser.Pulls();
+  size_t first = pulls.size() > 3 ? pulls.size() - 3 : 0;
+  for (size_t i = pulls.size(); i-- > first;) {
+    const auto& pull = pulls[i];
+    const char* status_icon = ICON_FA_CLOCK;
+    ImVec4 status_color(0.5f, 0.6f, 0.7f, 1.0f);
+    const char* status_text =
+        localization::queued[localization_language_index_].c_str();
+    switch (pull.status) {
+      case FileBrowserClient::PullStatus::Requested:
+        break;
+      case FileBrowserClient::PullStatus::Receiving:
+        status_icon = ICON_FA_ARROW_DOWN;
+        status_color = ImVec4(0.2f, 0.6f, 1.0f, 1.0f);
+        status_text =
+            localization::receiving[localization_language_index_].c_str();
+        break;
+      case FileBrowserClient::PullStatus::Completed:
+        status_icon = ICON_FA_CHECK;
+        status_color = ImVec4(0.0f, 0.8f, 0.0f, 1.0f);
+        status_text =
+            localization::completed[localization_language_index_].c_str();
+        break;
+      case FileBrowserClient::PullStatus::Failed:
+        status_icon = ICON_FA_XMARK;
+        status_color = ImVec4(1.0f, 0.2f, 0.2f, 1.0f);
+        status_text =
+            localization::failed[localization_language_index_].c_str();
+        break;
+    }
+
+    ImGui::TextColored(status_color, "%s", status_icon);
+    ImGui::SameLine();
+    ImGui::Text("%s", pull.label.c_str());
+    ImGui::SameLine();
+    ImGui::TextColored(status_color, "%s", status_text);
+    if (pull.status == FileBrowserClient::PullStatus::Receiving &&
+        pull.total > 0) {
+      float progress =
+          static_cast<float>(pull.received) / static_cast<float>(pull.total);
+      progress = (std::max)(0.0f, (std::min)(1.0f, progress));
+      ImGui::SameLine();
+      ImGui::Text("%.1f%%", progress * 100.0f);
+    }
+  }
+
+  ImGui::End();
+  ImGui::SetWindowFontScale(1.0f);
+
+  if (!navigate_to.empty() && navigate_to != props->remote_browse_path_) {
+    props->remote_browse_path_ = navigate_to;
+    props->remote_browse_selected_.clear();
+  }
+
+  return 0;
+}
+
+}  // namespace crossdesk
@@ -141,6 +141,7 @@ int Render::StreamWindow() {
           
           // Show file transfer window if needed
           FileTransferWindow(props);
+          RemoteFileBrowserWindow(props);
 
           focused_remote_id_ = props->remote_id_;
 
@@ -239,6 +240,7 @@ int Render::StreamWindow() {
         
         // Show file transfer window if needed
         FileTransferWindow(props);
+        RemoteFileBrowserWindow(props);
         
         ImGui::End();
 
@@ -0,0 +1,45 @@
+#include "audio_convert.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_CONVERT_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define AUDIO_CONVERT_NEON 1
+#endif
+
+namespace crossdesk {
+
+uint64_t SumOfSquaresS16(const int16_t* in, size_t samples) {
+  size_t i = 0;
+  uint64_t sum = 0;
+#if defined(AUDIO_CONVERT_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc = zero;
+  for (; i + 8 <= samples; i += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    // a pair of squares reaches 2^31, read the 32 bit sums as unsigned
+    __m128i pairs = _mm_madd_epi16(v, v);
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(pairs, zero));
+    acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(pairs, zero));
+  }
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  sum = lanes[0] + lanes[1];
+#elif defined(AUDIO_CONVERT_NEON)
+  int64x2_t acc = vdupq_n_s64(0);
+  for (; i + 8 <= samples; i += 8) {
+    int16x8_t v = vld1q_s16(in + i);
+    acc = vpadalq_s32(acc, vmull_s16(vget_low_s16(v), vget_low_s16(v)));
+    acc = vpadalq_s32(acc, vmull_s16(vget_high_s16(v), vget_high_s16(v)));
+  }
+  sum = static_cast<uint64_t>(vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1));
+#endif
+  for (; i < samples; ++i) {
+    sum += static_cast<uint64_t>(static_cast<int32_t>(in[i]) * in[i]);
+  }
+  return sum;
+}
+
+}  // namespace crossdesk
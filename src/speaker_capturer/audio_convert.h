@@ -0,0 +1,22 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _AUDIO_CONVERT_H_
+#define _AUDIO_CONVERT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crossdesk {
+
+// Sample kernels for the capture path, SSE2 or NEON where available.
+
+// sum of squared samples, for level metering.
+uint64_t SumOfSquaresS16(const int16_t* in, size_t samples);
+
+}  // namespace crossdesk
+
+#endif
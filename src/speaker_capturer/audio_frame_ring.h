@@ -0,0 +1,137 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _AUDIO_FRAME_RING_H_
+#define _AUDIO_FRAME_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace crossdesk {
+
+// Single producer, single consumer queue of fixed-size audio frames. The
+// producer (an audio thread) copies arbitrary-sized buffers straight into the
+// next free slot and publishes the slot once it holds a whole frame, the
+// consumer reads frames in place along with their capture time. Write, Front
+// and Pop never allocate, lock or wait. A frame that finds every slot taken
+// is dropped and counted as an overrun.
+class AudioFrameRing {
+ public:
+  AudioFrameRing() = default;
+  AudioFrameRing(const AudioFrameRing&) = delete;
+  AudioFrameRing& operator=(const AudioFrameRing&) = delete;
+
+  // allocates the slots, only while neither side is running.
+  void Reset(size_t frame_bytes, size_t slots, int64_t frame_duration_us) {
+    frame_bytes_ = frame_bytes;
+    frame_duration_us_ = frame_duration_us;
+    slots_ = (std::max)(slots, static_cast<size_t>(1));
+    storage_.assign(frame_bytes_ * slots_, 0);
+    timestamps_.assign(slots_, 0);
+    fill_ = 0;
+    dropping_ = false;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    overruns_.store(0, std::memory_order_relaxed);
+  }
+
+  // producer side, returns the number of frames published. end_time_us is
+  // when the last byte of data was captured.
+  size_t Write(const uint8_t* data, size_t size, int64_t end_time_us) {
+    size_t published = 0;
+    while (size > 0 && frame_bytes_ > 0) {
+      uint64_t head = head_.load(std::memory_order_relaxed);
+      if (fill_ == 0) {
+        // decide once per frame, a slot freed halfway through a dropped
+        // frame would only hold its tail
+        dropping_ = head - tail_.load(std::memory_order_acquire) >= slots_;
+      }
+
+      size_t n = (std::min)(size, frame_bytes_ - fill_);
+      if (!dropping_) {
+        memcpy(Slot(head) + fill_, data, n);
+      }
+      fill_ += n;
+      data += n;
+      size -= n;
+
+      if (fill_ == frame_bytes_) {
+        fill_ = 0;
+        if (dropping_) {
+          overruns_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          // the frame ends `size` bytes before the end of data
+          timestamps_[head % slots_] =
+              end_time_us - frame_duration_us_ -
+              static_cast<int64_t>(size) * frame_duration_us_ /
+                  static_cast<int64_t>(frame_bytes_);
+          head_.store(head + 1, std::memory_order_release);
+          ++published;
+        }
+      }
+    }
+    return published;
+  }
+
+  // consumer side, the oldest complete frame or nullptr. Stays valid until
+  // Pop().
+  uint8_t* Front() {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return Slot(tail);
+  }
+
+  // capture time of the first sample of Front().
+  int64_t FrontTimestamp() const {
+    return timestamps_[tail_.load(std::memory_order_relaxed) % slots_];
+  }
+
+  void Pop() {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+  }
+
+  size_t FrameBytes() const { return frame_bytes_; }
+
+  // frames waiting for the consumer.
+  size_t Size() const {
+    return static_cast<size_t>(head_.load(std::memory_order_acquire) -
+                               tail_.load(std::memory_order_acquire));
+  }
+
+  uint64_t Overruns() const {
+    return overruns_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  uint8_t* Slot(uint64_t index) {
+    return storage_.data() + (index % slots_) * frame_bytes_;
+  }
+
+ private:
+  std::vector<uint8_t> storage_;
+  std::vector<int64_t> timestamps_;
+  size_t frame_bytes_ = 0;
+  int64_t frame_duration_us_ = 0;
+  size_t slots_ = 1;
+
+  // producer only
+  size_t fill_ = 0;
+  bool dropping_ = false;
+
+  alignas(64) std::atomic<uint64_t> head_{0};
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  std::atomic<uint64_t> overruns_{0};
+};
+
+}  // namespace crossdesk
+
+#endif
@@ -3,24 +3,45 @@
 #include <pulse/error.h>
 #include <pulse/introspect.h>
 
-#include <condition_variable>
-#include <iostream>
+#include <time.h>
+
+#include <algorithm>
+#include <cerrno>
 #include <thread>
 
 #include "rd_log.h"
 
 namespace crossdesk {
 
-constexpr int kSampleRate = 48000;
-constexpr pa_sample_format_t kFormat = PA_SAMPLE_S16LE;
-constexpr int kChannels = 1;
-constexpr size_t kFrameSizeBytes = 480 * sizeof(int16_t);
+constexpr uint32_t kSampleRate = 48000;
+constexpr uint8_t kChannels = 1;
+constexpr size_t kFrameSizeBytes = kSampleRate / 100 * sizeof(int16_t);
+constexpr int64_t kFrameDurationUs = 10 * 1000;
+constexpr uint32_t kDefaultLatencyTargetMs = 10;
+// 320 ms of 10 ms frames between the PulseAudio thread and the sender
+constexpr size_t kRingFrames = 32;
+// no frame for this long while streaming counts as an underrun
+constexpr long kUnderrunTimeoutNs = 30 * 1000 * 1000;
+constexpr auto kStatsLogInterval = std::chrono::seconds(5);
 
 SpeakerCapturerLinux::SpeakerCapturerLinux()
-    : inited_(false), paused_(false), stop_flag_(false) {}
+    : inited_(false),
+      paused_(false),
+      stop_flag_(false),
+      latency_target_ms_(kDefaultLatencyTargetMs),
+      streaming_(false),
+      frames_(0),
+      underruns_(0),
+      suppressed_(0),
+      keepalives_(0),
+      latency_us_(0),
+      fragment_us_(0),
+      capture_spec_{PA_SAMPLE_S16LE, kSampleRate, kChannels} {
+  sem_init(&frames_ready_, 0, 0);
+}
 SpeakerCapturerLinux::~SpeakerCapturerLinux() {
-  Stop();
   Destroy();
+  sem_destroy(&frames_ready_);
 }
 
 int SpeakerCapturerLinux::Init(speaker_data_cb cb) {
@@ -31,232 +52,346 @@ int SpeakerCapturerLinux::Init(speaker_data_cb cb) {
 }
 
 int SpeakerCapturerLinux::Destroy() {
+  Stop();
+  std::lock_guard<std::mutex> lock(state_mtx_);
+  DestroyContext();
   inited_ = false;
   return 0;
 }
 
-std::string SpeakerCapturerLinux::GetDefaultMonitorSourceName() {
-  std::string monitor_name;
-  std::mutex mtx;
-  std::condition_variable cv;
-  bool ready = false;
+void SpeakerCapturerLinux::SetLatencyTarget(uint32_t latency_ms) {
+  std::lock_guard<std::mutex> lock(state_mtx_);
+  latency_target_ms_ = (std::max)(latency_ms, static_cast<uint32_t>(1));
+}
 
-  pa_mainloop* mainloop = pa_mainloop_new();
-  pa_mainloop_api* api = pa_mainloop_get_api(mainloop);
-  pa_context* context = pa_context_new(api, "GetMonitor");
+void SpeakerCapturerLinux::SetSourceName(const std::string& source_name) {
+  std::lock_guard<std::mutex> lock(state_mtx_);
+  source_name_ = source_name;
+}
 
-  struct CallbackState {
-    std::string* name;
-    std::mutex* mtx;
-    std::condition_variable* cv;
-    bool* ready;
-  } state{&monitor_name, &mtx, &cv, &ready};
+int SpeakerCapturerLinux::EnsureContextLocked() {
+  if (context_) {
+    if (pa_context_get_state(context_) == PA_CONTEXT_READY) {
+      return 0;
+    }
+    // the server went away since the last Start()
+    pa_context_disconnect(context_);
+    pa_context_unref(context_);
+    context_ = nullptr;
+  }
 
+  context_ =
+      pa_context_new(pa_threaded_mainloop_get_api(mainloop_), "CrossDesk");
   pa_context_set_state_callback(
-      context,
-      [](pa_context* c, void* userdata) {
-        auto* state = static_cast<CallbackState*>(userdata);
-        if (pa_context_get_state(c) == PA_CONTEXT_READY) {
-          pa_operation* operation = pa_context_get_server_info(
-              c,
-              [](pa_context*, const pa_server_info* info, void* userdata) {
-                auto* state = static_cast<CallbackState*>(userdata);
-                if (info && info->default_sink_name) {
-                  *(state->name) =
-                      std::string(info->default_sink_name) + ".monitor";
-                }
-                {
-                  std::lock_guard<std::mutex> lock(*(state->mtx));
-                  *(state->ready) = true;
-                }
-                state->cv->notify_one();
-              },
-              userdata);
-          if (operation) {
-            pa_operation_unref(operation);
-          }
-        }
+      context_,
+      [](pa_context*, void* userdata) {
+        auto self = static_cast<SpeakerCapturerLinux*>(userdata);
+        pa_threaded_mainloop_signal(self->mainloop_, 0);
       },
-      &state);
+      this);
 
-  pa_context_connect(context, nullptr, PA_CONTEXT_NOFLAGS, nullptr);
+  if (pa_context_connect(context_, nullptr, PA_CONTEXT_NOFLAGS, nullptr) < 0) {
+    LOG_ERROR("Failed to connect context: {}",
+              pa_strerror(pa_context_errno(context_)));
+    return -1;
+  }
 
-  std::thread loop_thread([&]() {
-    int ret = 0;
-    pa_mainloop_run(mainloop, &ret);
-  });
+  while (true) {
+    pa_context_state_t state = pa_context_get_state(context_);
+    if (state == PA_CONTEXT_READY) break;
+    if (!PA_CONTEXT_IS_GOOD(state)) {
+      LOG_ERROR("Failed to connect context: {}",
+                pa_strerror(pa_context_errno(context_)));
+      return -1;
+    }
+    pa_threaded_mainloop_wait(mainloop_);
+  }
+  return 0;
+}
 
-  {
-    std::unique_lock<std::mutex> lock(mtx);
-    cv.wait_for(lock, std::chrono::seconds(2), [&] { return ready; });
+void SpeakerCapturerLinux::WaitOperationLocked(pa_operation* operation) {
+  if (!operation) {
+    return;
   }
+  while (pa_operation_get_state(operation) == PA_OPERATION_RUNNING) {
+    pa_threaded_mainloop_wait(mainloop_);
+  }
+  pa_operation_unref(operation);
+}
 
-  pa_context_disconnect(context);
-  pa_context_unref(context);
-  pa_mainloop_quit(mainloop, 0);
-  loop_thread.join();
-  pa_mainloop_free(mainloop);
+std::string SpeakerCapturerLinux::GetMonitorSourceLocked() {
+  struct Query {
+    SpeakerCapturerLinux* self;
+    std::string name;
+  } query{this, source_name_};
 
-  return monitor_name;
+  if (query.name.empty()) {
+    WaitOperationLocked(pa_context_get_server_info(
+        context_,
+        [](pa_context*, const pa_server_info* info, void* userdata) {
+          auto* query = static_cast<Query*>(userdata);
+          if (info && info->default_sink_name) {
+            query->name = std::string(info->default_sink_name) + ".monitor";
+          }
+          pa_threaded_mainloop_signal(query->self->mainloop_, 0);
+        },
+        &query));
+  }
+  return query.name;
 }
 
 int SpeakerCapturerLinux::Start() {
-  if (!inited_ || mainloop_thread_.joinable()) return -1;
-  stop_flag_ = false;
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
+  if (!inited_ || stream_) return -1;
+  auto start_time = std::chrono::steady_clock::now();
 
-  mainloop_thread_ = std::thread([this]() {
-    std::string monitor_name = GetDefaultMonitorSourceName();
-    if (monitor_name.empty()) {
-      LOG_ERROR("Failed to get monitor source");
-      return;
-    }
+  stop_flag_ = false;
+  streaming_ = false;
+  frames_ = 0;
+  underruns_ = 0;
+  suppressed_ = 0;
+  keepalives_ = 0;
+  latency_us_ = 0;
+  fragment_us_ = 0;
+  gate_.Reset();
+  while (sem_trywait(&frames_ready_) == 0) {
+  }
 
+  if (!mainloop_) {
     mainloop_ = pa_threaded_mainloop_new();
-    pa_mainloop_api* api = pa_threaded_mainloop_get_api(mainloop_);
-    context_ = pa_context_new(api, "SpeakerCapturer");
-
-    pa_context_set_state_callback(
-        context_,
-        [](pa_context* c, void* userdata) {
-          auto self = static_cast<SpeakerCapturerLinux*>(userdata);
-          pa_context_state_t state = pa_context_get_state(c);
-          if (state == PA_CONTEXT_READY || state == PA_CONTEXT_FAILED ||
-              state == PA_CONTEXT_TERMINATED) {
-            pa_threaded_mainloop_signal(self->mainloop_, 0);
-          }
-        },
-        this);
-
     if (pa_threaded_mainloop_start(mainloop_) < 0) {
       LOG_ERROR("Failed to start mainloop");
-      Cleanup();
-      return;
+      pa_threaded_mainloop_free(mainloop_);
+      mainloop_ = nullptr;
+      return -1;
     }
+  }
 
-    pa_threaded_mainloop_lock(mainloop_);
+  pa_threaded_mainloop_lock(mainloop_);
+  if (EnsureContextLocked() != 0) {
+    pa_threaded_mainloop_unlock(mainloop_);
+    return -1;
+  }
 
-    if (pa_context_connect(context_, nullptr, PA_CONTEXT_NOFLAGS, nullptr) <
-        0) {
-      LOG_ERROR("Failed to connect context");
-      pa_threaded_mainloop_unlock(mainloop_);
-      Cleanup();
-      return;
-    }
+  std::string monitor_name = GetMonitorSourceLocked();
+  if (monitor_name.empty()) {
+    LOG_ERROR("Failed to get monitor source");
+    pa_threaded_mainloop_unlock(mainloop_);
+    return -1;
+  }
 
-    while (true) {
-      pa_context_state_t state = pa_context_get_state(context_);
-      if (state == PA_CONTEXT_READY) break;
-      if (!PA_CONTEXT_IS_GOOD(state) || stop_flag_) {
-        pa_threaded_mainloop_unlock(mainloop_);
-        Cleanup();
-        return;
-      }
-      pa_threaded_mainloop_wait(mainloop_);
-    }
+  // everything the read callback touches is allocated up front, the server
+  // resamples and downmixes the source to capture_spec_
+  ring_.Reset(kFrameSizeBytes, kRingFrames, kFrameDurationUs);
 
-    pa_sample_spec ss = {kFormat, kSampleRate, kChannels};
-    stream_ = pa_stream_new(context_, "Capture", &ss, nullptr);
-
-    pa_stream_set_read_callback(
-        stream_,
-        [](pa_stream* s, size_t len, void* u) {
-          auto self = static_cast<SpeakerCapturerLinux*>(u);
-          if (self->paused_ || self->stop_flag_) return;
-
-          const void* data = nullptr;
-          if (pa_stream_peek(s, &data, &len) < 0 || !data) return;
-
-          const uint8_t* p = static_cast<const uint8_t*>(data);
-          self->frame_cache_.insert(self->frame_cache_.end(), p, p + len);
-
-          while (self->frame_cache_.size() >= kFrameSizeBytes) {
-            std::vector<uint8_t> temp_frame(
-                self->frame_cache_.begin(),
-                self->frame_cache_.begin() + kFrameSizeBytes);
-            self->cb_(temp_frame.data(), kFrameSizeBytes, "audio");
-            self->frame_cache_.erase(
-                self->frame_cache_.begin(),
-                self->frame_cache_.begin() + kFrameSizeBytes);
+  stream_ = pa_stream_new(context_, "Capture", &capture_spec_, nullptr);
+  if (!stream_) {
+    LOG_ERROR("Failed to create stream: {}",
+              pa_strerror(pa_context_errno(context_)));
+    pa_threaded_mainloop_unlock(mainloop_);
+    return -1;
+  }
+  pa_stream_set_state_callback(
+      stream_,
+      [](pa_stream*, void* u) {
+        auto self = static_cast<SpeakerCapturerLinux*>(u);
+        pa_threaded_mainloop_signal(self->mainloop_, 0);
+      },
+      this);
+
+  pa_stream_set_read_callback(
+      stream_,
+      // runs on the PulseAudio realtime thread: no allocation, no locks,
+      // frames are only copied into the ring
+      [](pa_stream* s, size_t len, void* u) {
+        auto self = static_cast<SpeakerCapturerLinux*>(u);
+
+        const void* data = nullptr;
+        if (pa_stream_peek(s, &data, &len) < 0 || len == 0) return;
+
+        // data is null for a hole in the stream, which is dropped as well;
+        // while paused the data is discarded so the server side buffer
+        // does not fill up
+        if (data && !self->paused_ && !self->stop_flag_) {
+          int64_t end_us =
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now().time_since_epoch())
+                  .count();
+          // the first peeked byte was recorded `latency` ago
+          pa_usec_t latency = 0;
+          int negative = 0;
+          if (pa_stream_get_latency(s, &latency, &negative) == 0 &&
+              !negative) {
+            self->latency_us_.store(static_cast<int64_t>(latency),
+                                    std::memory_order_relaxed);
+            int64_t duration = static_cast<int64_t>(
+                pa_bytes_to_usec(len, &self->capture_spec_));
+            end_us -= (std::max)(static_cast<int64_t>(latency) - duration,
+                                 static_cast<int64_t>(0));
           }
+          if (self->ring_.Write(static_cast<const uint8_t*>(data), len,
+                                end_us) > 0) {
+            sem_post(&self->frames_ready_);
+          }
+        }
 
-          pa_stream_drop(s);
-        },
-        this);
-
-    pa_buffer_attr attr = {.maxlength = (uint32_t)-1,
-                           .tlength = 0,
-                           .prebuf = 0,
-                           .minreq = 0,
-                           .fragsize = (uint32_t)kFrameSizeBytes};
+        pa_stream_drop(s);
+      },
+      this);
+
+  // with ADJUST_LATENCY the server sizes the source buffer to fragsize too,
+  // so the target bounds the whole capture path, not just our reads
+  pa_buffer_attr attr = {
+      .maxlength = (uint32_t)-1,
+      .tlength = (uint32_t)-1,
+      .prebuf = (uint32_t)-1,
+      .minreq = (uint32_t)-1,
+      .fragsize = static_cast<uint32_t>(pa_usec_to_bytes(
+          static_cast<pa_usec_t>(latency_target_ms_) * 1000, &capture_spec_))};
+  pa_stream_flags_t flags = static_cast<pa_stream_flags_t>(
+      PA_STREAM_ADJUST_LATENCY | PA_STREAM_INTERPOLATE_TIMING |
+      PA_STREAM_AUTO_TIMING_UPDATE);
+
+  if (pa_stream_connect_record(stream_, monitor_name.c_str(), &attr, flags) <
+      0) {
+    LOG_ERROR("Failed to connect stream: {}",
+              pa_strerror(pa_context_errno(context_)));
+    pa_threaded_mainloop_unlock(mainloop_);
+    DisconnectStream();
+    return -1;
+  }
 
-    if (pa_stream_connect_record(stream_, monitor_name.c_str(), &attr,
-                                 PA_STREAM_ADJUST_LATENCY) < 0) {
-      LOG_ERROR("Failed to connect stream");
+  while (true) {
+    pa_stream_state_t s = pa_stream_get_state(stream_);
+    if (s == PA_STREAM_READY) break;
+    if (!PA_STREAM_IS_GOOD(s)) {
+      LOG_ERROR("Failed to connect stream: {}",
+                pa_strerror(pa_context_errno(context_)));
       pa_threaded_mainloop_unlock(mainloop_);
-      Cleanup();
-      return;
-    }
-
-    while (true) {
-      pa_stream_state_t s = pa_stream_get_state(stream_);
-      if (s == PA_STREAM_READY) break;
-      if (!PA_STREAM_IS_GOOD(s) || stop_flag_) {
-        pa_threaded_mainloop_unlock(mainloop_);
-        Cleanup();
-        return;
-      }
-      pa_threaded_mainloop_wait(mainloop_);
+      DisconnectStream();
+      return -1;
     }
+    pa_threaded_mainloop_wait(mainloop_);
+  }
 
-    pa_threaded_mainloop_unlock(mainloop_);
+  const pa_buffer_attr* granted = pa_stream_get_buffer_attr(stream_);
+  if (granted) {
+    fragment_us_ = static_cast<uint32_t>(
+        pa_bytes_to_usec(granted->fragsize, &capture_spec_));
+  }
+  streaming_ = true;
+  pa_threaded_mainloop_unlock(mainloop_);
 
-    while (!stop_flag_)
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-  });
+  sender_thread_ = std::thread(&SpeakerCapturerLinux::SenderLoop, this);
 
+  LOG_INFO("Speaker capture started on [{}] in {} us, fragment {} us",
+           monitor_name,
+           std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start_time)
+               .count(),
+           fragment_us_.load());
   return 0;
 }
 
 int SpeakerCapturerLinux::Stop() {
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
   stop_flag_ = true;
+  sem_post(&frames_ready_);
 
-  if (mainloop_) {
-    pa_threaded_mainloop_lock(mainloop_);
-    pa_threaded_mainloop_signal(mainloop_, 0);
-    pa_threaded_mainloop_unlock(mainloop_);
+  if (sender_thread_.joinable()) {
+    sender_thread_.join();
   }
 
-  if (mainloop_thread_.joinable()) {
-    mainloop_thread_.join();
-  }
-
-  Cleanup();
+  DisconnectStream();
   return 0;
 }
 
-void SpeakerCapturerLinux::Cleanup() {
-  if (mainloop_) {
-    pa_threaded_mainloop_stop(mainloop_);
-    pa_threaded_mainloop_lock(mainloop_);
+void SpeakerCapturerLinux::SenderLoop() {
+  uint64_t reported_overruns = 0;
+  uint64_t reported_underruns = 0;
+  auto last_report = std::chrono::steady_clock::now();
+
+  while (!stop_flag_) {
+    timespec deadline{};
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += kUnderrunTimeoutNs;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec += 1;
+      deadline.tv_nsec -= 1000000000L;
+    }
+
+    if (sem_timedwait(&frames_ready_, &deadline) != 0) {
+      if (errno == ETIMEDOUT && streaming_ && !paused_ && !stop_flag_) {
+        underruns_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
 
-    if (stream_) {
-      pa_stream_disconnect(stream_);
-      pa_stream_unref(stream_);
-      stream_ = nullptr;
+    while (uint8_t* frame = ring_.Front()) {
+      if (cb_ && !stop_flag_) {
+        const int16_t* pcm = reinterpret_cast<const int16_t*>(frame);
+        AudioFormat format;
+        format.sample_rate = static_cast<int>(kSampleRate);
+        format.channels = kChannels;
+        size_t samples = kFrameSizeBytes / sizeof(int16_t);
+        // silent frames stop here, short of the encoder and the network
+        int64_t timestamp_us = ring_.FrontTimestamp();
+        gate_.Process(pcm, samples, [&](const int16_t* out, int age) {
+          cb_(reinterpret_cast<unsigned char*>(const_cast<int16_t*>(out)),
+              samples * sizeof(int16_t), "audio", format,
+              timestamp_us - age * kFrameDurationUs);
+        });
+        SilenceGate::Stats gate_stats = gate_.GetStats();
+        suppressed_.store(gate_stats.suppressed, std::memory_order_relaxed);
+        keepalives_.store(gate_stats.keepalives, std::memory_order_relaxed);
+      }
+      ring_.Pop();
+      frames_.fetch_add(1, std::memory_order_relaxed);
     }
 
-    if (context_) {
-      pa_context_disconnect(context_);
-      pa_context_unref(context_);
-      context_ = nullptr;
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_report >= kStatsLogInterval) {
+      uint64_t overruns = ring_.Overruns();
+      uint64_t underruns = underruns_.load(std::memory_order_relaxed);
+      if (overruns != reported_overruns || underruns != reported_underruns) {
+        LOG_WARN("Speaker capture: {} overruns, {} underruns in the last {}s",
+                 overruns - reported_overruns, underruns - reported_underruns,
+                 kStatsLogInterval.count());
+        reported_overruns = overruns;
+        reported_underruns = underruns;
+      }
+      last_report = now;
     }
+  }
+}
 
+void SpeakerCapturerLinux::DisconnectStream() {
+  if (mainloop_ && stream_) {
+    pa_threaded_mainloop_lock(mainloop_);
+    pa_stream_disconnect(stream_);
+    pa_stream_unref(stream_);
+    stream_ = nullptr;
     pa_threaded_mainloop_unlock(mainloop_);
-    pa_threaded_mainloop_free(mainloop_);
-    mainloop_ = nullptr;
   }
 
-  frame_cache_.clear();
+  streaming_ = false;
+}
+
+void SpeakerCapturerLinux::DestroyContext() {
+  if (!mainloop_) {
+    return;
+  }
+
+  pa_threaded_mainloop_lock(mainloop_);
+  if (context_) {
+    pa_context_disconnect(context_);
+    pa_context_unref(context_);
+    context_ = nullptr;
+  }
+  pa_threaded_mainloop_unlock(mainloop_);
+
+  pa_threaded_mainloop_stop(mainloop_);
+  pa_threaded_mainloop_free(mainloop_);
+  mainloop_ = nullptr;
 }
 
 int SpeakerCapturerLinux::Pause() {
@@ -268,4 +403,16 @@ int SpeakerCapturerLinux::Resume() {
   paused_ = false;
   return 0;
 }
+
+SpeakerCapturerLinux::Stats SpeakerCapturerLinux::GetStats() const {
+  Stats stats;
+  stats.frames = frames_.load(std::memory_order_relaxed);
+  stats.overruns = ring_.Overruns();
+  stats.underruns = underruns_.load(std::memory_order_relaxed);
+  stats.suppressed = suppressed_.load(std::memory_order_relaxed);
+  stats.keepalives = keepalives_.load(std::memory_order_relaxed);
+  stats.latency_us = latency_us_.load(std::memory_order_relaxed);
+  stats.fragment_us = fragment_us_.load(std::memory_order_relaxed);
+  return stats;
+}
 }  // namespace crossdesk
\ No newline at end of file
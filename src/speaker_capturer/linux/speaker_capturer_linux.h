@@ -8,19 +8,35 @@
 #define _SPEAKER_CAPTURER_LINUX_H_
 
 #include <pulse/pulseaudio.h>
+#include <semaphore.h>
 
 #include <atomic>
 #include <functional>
 #include <mutex>
 #include <string>
 #include <thread>
-#include <vector>
 
+#include "audio_frame_ring.h"
+#include "silence_gate.h"
 #include "speaker_capturer.h"
 
 namespace crossdesk {
 
+// Records the monitor of the default sink (or of a chosen source). The
+// PulseAudio context lives from the first Start() until Destroy(), so a
+// Stop()/Start() cycle only recreates the record stream.
 class SpeakerCapturerLinux : public SpeakerCapturer {
+ public:
+  struct Stats {
+    uint64_t frames = 0;     // frames handed to the callback
+    uint64_t overruns = 0;   // frames dropped, the sender fell behind
+    uint64_t underruns = 0;  // frame periods the stream delivered nothing
+    uint64_t suppressed = 0;  // silent frames held back by the gate
+    uint64_t keepalives = 0;  // silent frames sent instead while gated
+    int64_t latency_us = 0;   // capture to read, last reported by the server
+    uint32_t fragment_us = 0;  // fragment size the server granted
+  };
+
  public:
   SpeakerCapturerLinux();
   ~SpeakerCapturerLinux();
@@ -33,9 +49,26 @@ class SpeakerCapturerLinux : public SpeakerCapturer {
   int Pause();
   int Resume();
 
+  // fragment size requested from the server, applies from the next Start().
+  void SetLatencyTarget(uint32_t latency_ms);
+  // source to record, empty for the monitor of the default sink. Applies
+  // from the next Start().
+  void SetSourceName(const std::string& source_name);
+
+  Stats GetStats() const;
+
  private:
-  std::string GetDefaultMonitorSourceName();
-  void Cleanup();
+  // connects the context unless it is connected already, mainloop locked
+  int EnsureContextLocked();
+  // runs the operation to completion, mainloop locked
+  void WaitOperationLocked(pa_operation* operation);
+  // source_name_, or the monitor of the default sink, mainloop locked
+  std::string GetMonitorSourceLocked();
+  // stream only, the context stays
+  void DisconnectStream();
+  void DestroyContext();
+  // drains ring_ and calls cb_, so the PulseAudio thread never runs it
+  void SenderLoop();
 
  private:
   speaker_data_cb cb_ = nullptr;
@@ -44,13 +77,31 @@ class SpeakerCapturerLinux : public SpeakerCapturer {
   std::atomic<bool> paused_;
   std::atomic<bool> stop_flag_;
 
-  std::thread mainloop_thread_;
   pa_threaded_mainloop* mainloop_ = nullptr;
   pa_context* context_ = nullptr;
   pa_stream* stream_ = nullptr;
 
+  // serializes Start, Stop and Destroy
   std::mutex state_mtx_;
-  std::vector<uint8_t> frame_cache_;
+  uint32_t latency_target_ms_;
+  std::string source_name_;
+
+  // the read callback assembles frames here, SenderLoop drains them
+  AudioFrameRing ring_;
+  sem_t frames_ready_;
+  std::thread sender_thread_;
+  std::atomic<bool> streaming_;
+  std::atomic<uint64_t> frames_;
+  std::atomic<uint64_t> underruns_;
+  // sender thread only
+  SilenceGate gate_;
+  std::atomic<uint64_t> suppressed_;
+  std::atomic<uint64_t> keepalives_;
+  std::atomic<int64_t> latency_us_;
+  std::atomic<uint32_t> fragment_us_;
+
+  // 48 kHz mono S16, the only format the audio track takes
+  const pa_sample_spec capture_spec_;
 };
 }  // namespace crossdesk
 #endif
\ No newline at end of file
@@ -2,6 +2,8 @@
 #import <Foundation/Foundation.h>
 #import <ScreenCaptureKit/ScreenCaptureKit.h>
 
+#include <chrono>
+
 #include "rd_log.h"
 #include "speaker_capturer_macosx.h"
 
@@ -85,8 +87,14 @@ class SpeakerCapturerMacosx;
     size_t frame_bytes = 960;  // 480 * 2
     size_t total_bytes = out_pcm16.size() * sizeof(short);
     unsigned char* p = (unsigned char*)out_pcm16.data();
+    // downmixed to 48 kHz mono above, the buffer ends now
+    crossdesk::AudioFormat format;
+    int64_t end_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
     for (size_t offset = 0; offset + frame_bytes <= total_bytes; offset += frame_bytes) {
-      _owner->cb_(p + offset, frame_bytes, "audio");
+      int64_t timestamp_us = end_us - (int64_t)(total_bytes - offset) * 1000 / 96;
+      _owner->cb_(p + offset, frame_bytes, "audio", format, timestamp_us);
     }
   }
 }
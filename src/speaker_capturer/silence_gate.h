@@ -0,0 +1,120 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _SILENCE_GATE_H_
+#define _SILENCE_GATE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "audio_convert.h"
+
+namespace crossdesk {
+
+// Discontinuous transmission for captured audio. Frames are 10 ms of S16.
+// Sound passes straight through and keeps the gate open for a hangover period
+// after it stops. Once closed, frames are held back except for a silent
+// keepalive frame every so often, so the viewer's decoder and jitter buffer
+// keep running. The last few held frames are replayed when sound returns, so
+// the start of a sound is never clipped.
+class SilenceGate {
+ public:
+  struct Stats {
+    uint64_t passed = 0;
+    uint64_t suppressed = 0;
+    uint64_t keepalives = 0;
+  };
+
+ public:
+  // about -60 dBFS
+  static constexpr uint64_t kThresholdMeanSquare = 33 * 33;
+  static constexpr int kHangoverFrames = 30;
+  static constexpr int kKeepaliveFrames = 100;
+  static constexpr int kPrerollFrames = 2;
+
+ public:
+  // forgets the state and the stats, the next frame sizes the buffers.
+  void Reset() {
+    stats_ = Stats();
+    frame_samples_ = 0;
+    silent_frames_ = kHangoverFrames;
+    since_keepalive_ = 0;
+    preroll_next_ = 0;
+    preroll_count_ = 0;
+  }
+
+  // emit(const int16_t* pcm, int age) is called for every frame that goes
+  // out, in order, zero or more times per call. age is how many frames
+  // before the current one it was captured.
+  template <typename Emit>
+  void Process(const int16_t* pcm, size_t samples, Emit&& emit) {
+    if (samples != frame_samples_) {
+      // whatever is held is in the old layout
+      frame_samples_ = samples;
+      preroll_.assign(samples * kPrerollFrames, 0);
+      zeros_.assign(samples, 0);
+      preroll_next_ = 0;
+      preroll_count_ = 0;
+    }
+
+    bool sound = samples > 0 &&
+                 SumOfSquaresS16(pcm, samples) / samples > kThresholdMeanSquare;
+    if (sound) {
+      for (size_t i = 0; i < preroll_count_; ++i) {
+        emit(PrerollSlot(preroll_next_ + kPrerollFrames - preroll_count_ + i),
+             static_cast<int>(preroll_count_ - i));
+        ++stats_.passed;
+        --stats_.suppressed;
+      }
+      preroll_count_ = 0;
+      silent_frames_ = 0;
+    } else if (silent_frames_ < kHangoverFrames) {
+      ++silent_frames_;
+    } else {
+      memcpy(PrerollSlot(preroll_next_), pcm, samples * sizeof(int16_t));
+      preroll_next_ = (preroll_next_ + 1) % kPrerollFrames;
+      if (preroll_count_ < kPrerollFrames) {
+        ++preroll_count_;
+      }
+      ++stats_.suppressed;
+      if (++since_keepalive_ >= kKeepaliveFrames) {
+        since_keepalive_ = 0;
+        ++stats_.keepalives;
+        emit(zeros_.data(), 0);
+      }
+      return;
+    }
+
+    since_keepalive_ = 0;
+    ++stats_.passed;
+    emit(pcm, 0);
+  }
+
+  bool Open() const { return silent_frames_ < kHangoverFrames; }
+
+  Stats GetStats() const { return stats_; }
+
+ private:
+  int16_t* PrerollSlot(size_t index) {
+    return preroll_.data() + (index % kPrerollFrames) * frame_samples_;
+  }
+
+ private:
+  size_t frame_samples_ = 0;
+  // starts closed, a capture of silence sends nothing but keepalives
+  int silent_frames_ = kHangoverFrames;
+  int since_keepalive_ = 0;
+  std::vector<int16_t> preroll_;
+  size_t preroll_next_ = 0;
+  size_t preroll_count_ = 0;
+  std::vector<int16_t> zeros_;
+  Stats stats_;
+};
+
+}  // namespace crossdesk
+
+#endif
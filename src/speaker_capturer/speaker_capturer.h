@@ -7,13 +7,28 @@
 #ifndef _SPEAKER_CAPTURER_H_
 #define _SPEAKER_CAPTURER_H_
 
+#include <cstdint>
 #include <functional>
 
 namespace crossdesk {
 
+// interleaved S16LE, one callback carries 10 ms.
+struct AudioFormat {
+  int sample_rate = 48000;
+  int channels = 1;
+
+  bool operator==(const AudioFormat& other) const {
+    return sample_rate == other.sample_rate && channels == other.channels;
+  }
+  bool operator!=(const AudioFormat& other) const { return !(*this == other); }
+};
+
 class SpeakerCapturer {
  public:
-  typedef std::function<void(unsigned char*, size_t, const char*)>
+  // data, size, name, format, and the capture time of the first sample in
+  // std::chrono::steady_clock microseconds
+  typedef std::function<void(unsigned char*, size_t, const char*,
+                             const AudioFormat&, int64_t)>
       speaker_data_cb;
 
  public:
@@ -14,15 +14,23 @@
 #elif __APPLE__
 #include "speaker_capturer_macosx.h"
 #endif
+#include "speaker_capturer_synthetic.h"
 
 namespace crossdesk {
 
 class SpeakerCapturerFactory {
+ public:
+  // Synthetic generates test signals without a sound device
+  enum Backend { Native = 0, Synthetic };
+
  public:
   virtual ~SpeakerCapturerFactory() {}
 
  public:
-  SpeakerCapturer* Create() {
+  SpeakerCapturer* Create(Backend backend = Native) {
+    if (backend == Synthetic) {
+      return new SpeakerCapturerSynthetic();
+    }
 #ifdef _WIN32
     return new SpeakerCapturerWasapi();
 #elif __linux__
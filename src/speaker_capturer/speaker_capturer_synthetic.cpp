@@ -0,0 +1,135 @@
+#include "speaker_capturer_synthetic.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace crossdesk {
+
+namespace {
+constexpr int kFramesPerSecond = 100;
+constexpr double kPi = 3.14159265358979323846;
+}  // namespace
+
+SpeakerCapturerSynthetic::SpeakerCapturerSynthetic() : running_(false) {}
+
+SpeakerCapturerSynthetic::~SpeakerCapturerSynthetic() { Stop(); }
+
+int SpeakerCapturerSynthetic::Init(speaker_data_cb cb) {
+  cb_ = cb;
+  return 0;
+}
+
+int SpeakerCapturerSynthetic::Destroy() {
+  Stop();
+  cb_ = nullptr;
+  return 0;
+}
+
+int SpeakerCapturerSynthetic::Start() {
+  if (!cb_ || thread_.joinable()) {
+    return -1;
+  }
+  {
+    std::lock_guard<std::mutex> lock(events_mutex_);
+    event_times_.clear();
+  }
+  running_ = true;
+  thread_ = std::thread(&SpeakerCapturerSynthetic::GenerateLoop, this);
+  return 0;
+}
+
+int SpeakerCapturerSynthetic::Stop() {
+  running_ = false;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  return 0;
+}
+
+void SpeakerCapturerSynthetic::Configure(const Config& config) {
+  config_ = config;
+  config_.sample_rate = (std::max)(config_.sample_rate, kFramesPerSecond);
+  config_.channels = std::clamp(config_.channels, 1, 2);
+  config_.period_ms = (std::max)(config_.period_ms, 10);
+}
+
+std::vector<int64_t> SpeakerCapturerSynthetic::EventTimes() {
+  std::lock_guard<std::mutex> lock(events_mutex_);
+  return event_times_;
+}
+
+void SpeakerCapturerSynthetic::GenerateLoop() {
+  using Clock = std::chrono::steady_clock;
+  const int64_t frame_samples = config_.sample_rate / kFramesPerSecond;
+  const int64_t period_samples =
+      static_cast<int64_t>(config_.sample_rate) * config_.period_ms / 1000;
+  std::vector<int16_t> frame(frame_samples * config_.channels);
+
+  Clock::time_point start = Clock::now();
+  int64_t start_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                         start.time_since_epoch())
+                         .count();
+
+  for (int64_t index = 0; running_; ++index) {
+    int64_t first = index * frame_samples;
+    // a frame is handed over once its last sample is captured
+    std::this_thread::sleep_until(
+        start + std::chrono::microseconds((first + frame_samples) * 1000000 /
+                                          config_.sample_rate));
+    if (!running_) {
+      break;
+    }
+
+    int channels = config_.channels;
+    Render(frame.data(), first, channels);
+
+    // onsets inside this frame
+    int64_t next_event = (first + period_samples - 1) / period_samples;
+    for (int64_t event = next_event * period_samples;
+         event < first + frame_samples; event += period_samples) {
+      std::lock_guard<std::mutex> lock(events_mutex_);
+      event_times_.push_back(start_us +
+                             event * 1000000 / config_.sample_rate);
+    }
+
+    AudioFormat format;
+    format.sample_rate = config_.sample_rate;
+    format.channels = channels;
+    cb_(reinterpret_cast<unsigned char*>(frame.data()),
+        frame_samples * channels * sizeof(int16_t), "audio", format,
+        start_us + first * 1000000 / config_.sample_rate);
+  }
+}
+
+void SpeakerCapturerSynthetic::Render(int16_t* out, int64_t first,
+                                      int channels) {
+  const int64_t frame_samples = config_.sample_rate / kFramesPerSecond;
+  const int64_t period_samples =
+      static_cast<int64_t>(config_.sample_rate) * config_.period_ms / 1000;
+  const int64_t burst_samples =
+      config_.signal == Signal::Impulse
+          ? 1
+          : static_cast<int64_t>(config_.sample_rate) * config_.burst_ms /
+                1000;
+
+  for (int64_t i = 0; i < frame_samples; ++i) {
+    int64_t phase = (first + i) % period_samples;
+    int16_t value = 0;
+    if (phase < burst_samples) {
+      if (config_.signal == Signal::Impulse) {
+        value = config_.amplitude;
+      } else {
+        // starts at the peak so the onset is the first sample
+        value = static_cast<int16_t>(
+            config_.amplitude * std::cos(2 * kPi * config_.tone_hz * phase /
+                                         config_.sample_rate));
+      }
+    }
+    for (int c = 0; c < channels; ++c) {
+      out[i * channels + c] = value;
+    }
+  }
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,69 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _SPEAKER_CAPTURER_SYNTHETIC_H_
+#define _SPEAKER_CAPTURER_SYNTHETIC_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "speaker_capturer.h"
+
+namespace crossdesk {
+
+// A capturer without a sound device. It generates 10 ms frames in real time
+// on its own thread: silence with an impulse or a tone burst every period.
+// Every frame carries the exact time its first sample was "captured", and
+// the onset time of every event is kept, so a harness can tell how long each
+// event takes to come out at the other end.
+class SpeakerCapturerSynthetic : public SpeakerCapturer {
+ public:
+  enum class Signal { Impulse = 0, ToneBurst };
+
+  struct Config {
+    Signal signal = Signal::Impulse;
+    int sample_rate = 48000;
+    int channels = 2;
+    int period_ms = 250;
+    int burst_ms = 20;  // tone bursts only
+    int tone_hz = 1000;
+    int16_t amplitude = 20000;
+  };
+
+ public:
+  SpeakerCapturerSynthetic();
+  ~SpeakerCapturerSynthetic();
+
+  int Init(speaker_data_cb cb) override;
+  int Destroy() override;
+  int Start() override;
+  int Stop() override;
+
+  // applies from the next Start().
+  void Configure(const Config& config);
+
+  // steady_clock microseconds of the event onsets generated since Start().
+  std::vector<int64_t> EventTimes();
+
+ private:
+  void GenerateLoop();
+  // fills one frame of `channels` starting at absolute sample `first`
+  void Render(int16_t* out, int64_t first, int channels);
+
+ private:
+  speaker_data_cb cb_ = nullptr;
+  Config config_;
+  std::atomic<bool> running_;
+  std::thread thread_;
+
+  std::mutex events_mutex_;
+  std::vector<int64_t> event_times_;
+};
+}  // namespace crossdesk
+#endif
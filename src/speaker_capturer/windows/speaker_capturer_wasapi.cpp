@@ -1,5 +1,7 @@
 #include "speaker_capturer_wasapi.h"
 
+#include <chrono>
+
 #include "rd_log.h"
 
 #define MINIAUDIO_IMPLEMENTATION
@@ -25,9 +27,18 @@ void data_callback(ma_device* pDevice, void* pOutput, const void* pInput,
              fp_);
     }
 
+    AudioFormat format;
+    format.sample_rate = static_cast<int>(sample_rate_);
+    format.channels = static_cast<int>(channels_);
+    // the period ends now
+    int64_t timestamp_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count() -
+        static_cast<int64_t>(frameCount) * 1000000 / sample_rate_;
     ptr->GetCallback()((unsigned char*)pInput,
                        frameCount * ma_get_bytes_per_frame(format_, channels_),
-                       "audio");
+                       "audio", format, timestamp_us);
   }
 
   (void)pOutput;
@@ -0,0 +1,156 @@
+#include "nv12_scale.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NV12_SCALE_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NV12_SCALE_NEON 1
+#endif
+
+namespace crossdesk {
+
+namespace {
+// source rows averaged per output row at most, 8 * 255 still fits 16 bit
+constexpr int kMaxRowTaps = 8;
+
+// acc[i] += row[i]
+void AccumulateRow(uint16_t* acc, const uint8_t* row, int n) {
+  int i = 0;
+#if defined(NV12_SCALE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+    __m128i* lo = reinterpret_cast<__m128i*>(acc + i);
+    __m128i* hi = reinterpret_cast<__m128i*>(acc + i + 8);
+    _mm_storeu_si128(lo, _mm_add_epi16(_mm_loadu_si128(lo),
+                                       _mm_unpacklo_epi8(v, zero)));
+    _mm_storeu_si128(hi, _mm_add_epi16(_mm_loadu_si128(hi),
+                                       _mm_unpackhi_epi8(v, zero)));
+  }
+#elif defined(NV12_SCALE_NEON)
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t v = vld1q_u8(row + i);
+    vst1q_u16(acc + i, vaddw_u8(vld1q_u16(acc + i), vget_low_u8(v)));
+    vst1q_u16(acc + i + 8, vaddw_u8(vld1q_u16(acc + i + 8), vget_high_u8(v)));
+  }
+#endif
+  for (; i < n; ++i) {
+    acc[i] = static_cast<uint16_t>(acc[i] + row[i]);
+  }
+}
+
+// [begin, end) of box `i` out of `count` over `size` source samples, never
+// empty so that upscaling repeats samples instead of reading nothing
+void BoxRange(int i, int count, int size, int* begin, int* end) {
+  *begin = static_cast<int>(static_cast<int64_t>(i) * size / count);
+  *end = static_cast<int>(static_cast<int64_t>(i + 1) * size / count);
+  *begin = std::min(*begin, size - 1);
+  *end = std::max(*end, *begin + 1);
+}
+
+// sums `taps` evenly spread rows of [begin, end) into acc
+int AccumulateRows(uint16_t* acc, const uint8_t* plane, int stride, int n,
+                   int begin, int end) {
+  int rows = end - begin;
+  int taps = std::min(rows, kMaxRowTaps);
+  memset(acc, 0, sizeof(uint16_t) * n);
+  for (int k = 0; k < taps; ++k) {
+    int row = begin + (2 * k + 1) * rows / (2 * taps);
+    AccumulateRow(acc, plane + static_cast<size_t>(row) * stride, n);
+  }
+  return taps;
+}
+
+inline uint8_t Clamp255(int v) {
+  return static_cast<uint8_t>(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+void FillBlack(uint8_t* dst, size_t pixels) {
+  for (size_t i = 0; i < pixels; ++i) {
+    dst[i * 4 + 0] = 0;
+    dst[i * 4 + 1] = 0;
+    dst[i * 4 + 2] = 0;
+    dst[i * 4 + 3] = 0xFF;
+  }
+}
+}  // namespace
+
+void ScaleNv12ToRgba(const uint8_t* src, int src_w, int src_h, uint8_t* dst,
+                     int dst_w, int dst_h) {
+  float src_aspect = float(src_w) / src_h;
+  float dst_aspect = float(dst_w) / dst_h;
+  int fit_w = dst_w, fit_h = dst_h;
+  if (src_aspect > dst_aspect) {
+    fit_h = std::max(1, int(dst_w / src_aspect));
+  } else {
+    fit_w = std::max(1, int(dst_h * src_aspect));
+  }
+  int left = (dst_w - fit_w) / 2;
+  int top = (dst_h - fit_h) / 2;
+
+  const uint8_t* src_uv = src + static_cast<size_t>(src_w) * src_h;
+  int chroma_w = (src_w + 1) / 2;
+  int chroma_h = (src_h + 1) / 2;
+
+  // column boxes in luma samples and in chroma pairs
+  std::vector<int> y_begin(fit_w), y_end(fit_w);
+  std::vector<int> c_begin(fit_w), c_end(fit_w);
+  for (int x = 0; x < fit_w; ++x) {
+    BoxRange(x, fit_w, src_w, &y_begin[x], &y_end[x]);
+    BoxRange(x, fit_w, chroma_w, &c_begin[x], &c_end[x]);
+  }
+
+  std::vector<uint16_t> y_acc(src_w);
+  std::vector<uint16_t> uv_acc(chroma_w * 2);
+
+  FillBlack(dst, static_cast<size_t>(dst_w) * top);
+  for (int y = 0; y < fit_h; ++y) {
+    uint8_t* out = dst + (static_cast<size_t>(top + y) * dst_w) * 4;
+    FillBlack(out, left);
+    FillBlack(out + static_cast<size_t>(left + fit_w) * 4,
+              dst_w - fit_w - left);
+    out += static_cast<size_t>(left) * 4;
+
+    int row_begin = 0;
+    int row_end = 0;
+    BoxRange(y, fit_h, src_h, &row_begin, &row_end);
+    int y_taps = AccumulateRows(y_acc.data(), src, src_w, src_w, row_begin,
+                                row_end);
+    BoxRange(y, fit_h, chroma_h, &row_begin, &row_end);
+    int c_taps = AccumulateRows(uv_acc.data(), src_uv, src_w, chroma_w * 2,
+                                row_begin, row_end);
+
+    for (int x = 0; x < fit_w; ++x) {
+      uint32_t y_sum = 0;
+      for (int i = y_begin[x]; i < y_end[x]; ++i) {
+        y_sum += y_acc[i];
+      }
+      uint32_t u_sum = 0;
+      uint32_t v_sum = 0;
+      for (int i = c_begin[x]; i < c_end[x]; ++i) {
+        u_sum += uv_acc[2 * i];
+        v_sum += uv_acc[2 * i + 1];
+      }
+      uint32_t y_count = static_cast<uint32_t>(y_end[x] - y_begin[x]) * y_taps;
+      uint32_t c_count = static_cast<uint32_t>(c_end[x] - c_begin[x]) * c_taps;
+
+      int c = static_cast<int>((y_sum + y_count / 2) / y_count) - 16;
+      int d = static_cast<int>((u_sum + c_count / 2) / c_count) - 128;
+      int e = static_cast<int>((v_sum + c_count / 2) / c_count) - 128;
+      out[x * 4 + 0] = Clamp255((298 * c + 409 * e + 128) >> 8);
+      out[x * 4 + 1] = Clamp255((298 * c - 100 * d - 208 * e + 128) >> 8);
+      out[x * 4 + 2] = Clamp255((298 * c + 516 * d + 128) >> 8);
+      out[x * 4 + 3] = 0xFF;
+    }
+  }
+  FillBlack(dst + (static_cast<size_t>(top + fit_h) * dst_w) * 4,
+            static_cast<size_t>(dst_w) * (dst_h - fit_h - top));
+}
+
+}  // namespace crossdesk
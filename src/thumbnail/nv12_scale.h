@@ -0,0 +1,24 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _NV12_SCALE_H_
+#define _NV12_SCALE_H_
+
+#include <cstdint>
+
+namespace crossdesk {
+
+// Downscales an NV12 frame (stride = width) straight into dst_w x dst_h RGBA,
+// keeping the aspect ratio and filling the bars with opaque black. Each
+// output pixel is the box average of its source area, sampled on at most a
+// few rows per box, and converted with BT.601 limited range like libyuv's
+// I420ToABGR. The row accumulation uses SSE2 or NEON where available.
+void ScaleNv12ToRgba(const uint8_t* src, int src_w, int src_h, uint8_t* dst,
+                     int dst_w, int dst_h);
+
+}  // namespace crossdesk
+
+#endif
@@ -5,15 +5,17 @@
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
-#include "libyuv.h"
+#include "nv12_scale.h"
 #include "rd_log.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -23,110 +25,35 @@
 
 namespace crossdesk {
 
-bool LoadTextureFromMemory(const void* data, size_t data_size,
-                           SDL_Renderer* renderer, SDL_Texture** out_texture,
-                           int* out_width, int* out_height) {
-  int image_width = 0;
-  int image_height = 0;
-  int channels = 4;
-  unsigned char* image_data =
-      stbi_load_from_memory((const unsigned char*)data, (int)data_size,
-                            &image_width, &image_height, NULL, 4);
-  if (image_data == nullptr) {
-    LOG_ERROR("Failed to load image: [{}]", stbi_failure_reason());
-    return false;
-  }
-
-  // ABGR
-  int pitch = image_width * channels;
-  SDL_Surface* surface =
-      SDL_CreateSurfaceFrom(image_width, image_height, SDL_PIXELFORMAT_RGBA32,
-                            (void*)image_data, pitch);
-  if (surface == nullptr) {
-    LOG_ERROR("Failed to create SDL surface: [{}]", SDL_GetError());
-    return false;
-  }
-
-  SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-  if (texture == nullptr) {
-    LOG_ERROR("Failed to create SDL texture: [{}]", SDL_GetError());
-  }
-
-  *out_texture = texture;
-  *out_width = image_width;
-  *out_height = image_height;
-
-  SDL_DestroySurface(surface);
-  stbi_image_free(image_data);
-
-  return true;
-}
+namespace {
+// decoding is short and bursty, a few workers keep startup off the UI thread
+constexpr size_t kMaxDecodeThreads = 4;
+// saves waiting for the worker, the oldest is dropped beyond this
+constexpr size_t kMaxPendingSaves = 8;
 
-bool LoadTextureFromFile(const char* file_name, SDL_Renderer* renderer,
-                         SDL_Texture** out_texture, int* out_width,
-                         int* out_height) {
-  std::filesystem::path file_path(file_name);
-  if (!std::filesystem::exists(file_path)) return false;
-  std::ifstream file(file_path, std::ios::binary);
-  if (!file) return false;
-  file.seekg(0, std::ios::end);
-  size_t file_size = file.tellg();
-  file.seekg(0, std::ios::beg);
-  if (file_size == -1) return false;
-  char* file_data = new char[file_size];
-  if (!file_data) return false;
-  file.read(file_data, file_size);
-  bool ret = LoadTextureFromMemory(file_data, file_size, renderer, out_texture,
-                                   out_width, out_height);
-  delete[] file_data;
-
-  return ret;
+size_t DecodeThreadCount() {
+  size_t hardware = std::thread::hardware_concurrency();
+  return std::max<size_t>(1, std::min(kMaxDecodeThreads, hardware));
 }
 
-void ScaleNv12ToABGR(char* src, int src_w, int src_h, int dst_w, int dst_h,
-                     char* dst_rgba) {
-  uint8_t* y = reinterpret_cast<uint8_t*>(src);
-  uint8_t* uv = y + src_w * src_h;
-
-  float src_aspect = float(src_w) / src_h;
-  float dst_aspect = float(dst_w) / dst_h;
-  int fit_w = dst_w, fit_h = dst_h;
-  if (src_aspect > dst_aspect) {
-    fit_h = int(dst_w / src_aspect);
-  } else {
-    fit_w = int(dst_h * src_aspect);
-  }
-
-  std::vector<uint8_t> y_i420(src_w * src_h);
-  std::vector<uint8_t> u_i420((src_w / 2) * (src_h / 2));
-  std::vector<uint8_t> v_i420((src_w / 2) * (src_h / 2));
-  libyuv::NV12ToI420(y, src_w, uv, src_w, y_i420.data(), src_w, u_i420.data(),
-                     src_w / 2, v_i420.data(), src_w / 2, src_w, src_h);
-
-  std::vector<uint8_t> y_fit(fit_w * fit_h);
-  std::vector<uint8_t> u_fit((fit_w + 1) / 2 * (fit_h + 1) / 2);
-  std::vector<uint8_t> v_fit((fit_w + 1) / 2 * (fit_h + 1) / 2);
-  libyuv::I420Scale(y_i420.data(), src_w, u_i420.data(), src_w / 2,
-                    v_i420.data(), src_w / 2, src_w, src_h, y_fit.data(), fit_w,
-                    u_fit.data(), (fit_w + 1) / 2, v_fit.data(),
-                    (fit_w + 1) / 2, fit_w, fit_h, libyuv::kFilterBilinear);
-
-  std::vector<uint8_t> abgr(fit_w * fit_h * 4);
-  libyuv::I420ToABGR(y_fit.data(), fit_w, u_fit.data(), (fit_w + 1) / 2,
-                     v_fit.data(), (fit_w + 1) / 2, abgr.data(), fit_w * 4,
-                     fit_w, fit_h);
-
-  memset(dst_rgba, 0, dst_w * dst_h * 4);
-  for (int i = 0; i < dst_w * dst_h; ++i) {
-    dst_rgba[i * 4 + 3] = static_cast<char>(0xFF);
+SDL_Texture* CreateTextureFromRgba(SDL_Renderer* renderer,
+                                   const unsigned char* rgba, int width,
+                                   int height) {
+  SDL_Texture* texture =
+      SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32,
+                        SDL_TEXTUREACCESS_STATIC, width, height);
+  if (texture == nullptr) {
+    LOG_ERROR("Failed to create SDL texture: [{}]", SDL_GetError());
+    return nullptr;
   }
-
-  for (int row = 0; row < fit_h; ++row) {
-    int dst_offset =
-        ((row + (dst_h - fit_h) / 2) * dst_w + (dst_w - fit_w) / 2) * 4;
-    memcpy(dst_rgba + dst_offset, abgr.data() + row * fit_w * 4, fit_w * 4);
+  if (!SDL_UpdateTexture(texture, nullptr, rgba, width * 4)) {
+    LOG_ERROR("Failed to update SDL texture: [{}]", SDL_GetError());
+    SDL_DestroyTexture(texture);
+    return nullptr;
   }
+  return texture;
 }
+}  // namespace
 
 Thumbnail::Thumbnail(std::string save_path) {
   if (!save_path.empty()) {
@@ -136,6 +63,11 @@ Thumbnail::Thumbnail(std::string save_path) {
   RAND_bytes(aes128_key_, sizeof(aes128_key_));
   RAND_bytes(aes128_iv_, sizeof(aes128_iv_));
   std::filesystem::create_directories(save_path_);
+  store_ = std::make_unique<ThumbnailStore>(save_path_);
+  if (store_->Open() != 0) {
+    ImportLegacyThumbnails();
+  }
+  decode_pool_ = std::make_unique<ThreadPool>(DecodeThreadCount());
 }
 
 Thumbnail::Thumbnail(std::string save_path, unsigned char* aes128_key,
@@ -147,12 +79,22 @@ Thumbnail::Thumbnail(std::string save_path, unsigned char* aes128_key,
   memcpy(aes128_key_, aes128_key, sizeof(aes128_key_));
   memcpy(aes128_iv_, aes128_iv, sizeof(aes128_iv_));
   std::filesystem::create_directories(save_path_);
+  store_ = std::make_unique<ThumbnailStore>(save_path_);
+  if (store_->Open() != 0) {
+    ImportLegacyThumbnails();
+  }
+  decode_pool_ = std::make_unique<ThreadPool>(DecodeThreadCount());
 }
 
 Thumbnail::~Thumbnail() {
-  if (rgba_buffer_) {
-    delete[] rgba_buffer_;
-    rgba_buffer_ = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(save_mutex_);
+    save_stopped_ = true;
+  }
+  save_cv_.notify_all();
+  // the worker writes what is still queued before it exits
+  if (save_thread_.joinable()) {
+    save_thread_.join();
   }
 }
 
@@ -166,37 +108,131 @@ int Thumbnail::SaveToThumbnail(const char* yuv420p, int width, int height,
                                const std::string& remote_id,
                                const std::string& host_name,
                                const std::string& password) {
-  if (!rgba_buffer_) {
-    rgba_buffer_ = new char[thumbnail_width_ * thumbnail_height_ * 4];
+  if (password.empty()) {
+    return 0;
   }
 
+  SaveJob job;
+  job.remote_id = remote_id;
+  job.host_name = host_name;
+  job.password = password;
+  job.width = thumbnail_width_;
+  job.height = thumbnail_height_;
+  ScaleToThumbnail(yuv420p, width, height, job.rgba);
+  return WriteThumbnail(job);
+}
+
+int Thumbnail::SaveToThumbnailAsync(const char* yuv420p, int width,
+                                    int height, const std::string& remote_id,
+                                    const std::string& host_name,
+                                    const std::string& password) {
+  if (password.empty()) {
+    return 0;
+  }
+
+  SaveJob job;
+  job.remote_id = remote_id;
+  job.host_name = host_name;
+  job.password = password;
+  job.width = thumbnail_width_;
+  job.height = thumbnail_height_;
+  ScaleToThumbnail(yuv420p, width, height, job.rgba);
+
+  {
+    std::lock_guard<std::mutex> lock(save_mutex_);
+    if (save_stopped_) {
+      return -1;
+    }
+
+    auto pending =
+        std::find_if(save_queue_.begin(), save_queue_.end(),
+                     [&](const SaveJob& queued) {
+                       return queued.remote_id == job.remote_id;
+                     });
+    if (pending != save_queue_.end()) {
+      *pending = std::move(job);
+    } else {
+      if (save_queue_.size() >= kMaxPendingSaves) {
+        LOG_WARN("Thumbnail save queue full, drop [{}]",
+                 save_queue_.front().remote_id);
+        save_queue_.pop_front();
+      }
+      save_queue_.push_back(std::move(job));
+    }
+
+    if (!save_thread_.joinable()) {
+      save_thread_ = std::thread(&Thumbnail::SaveLoop, this);
+    }
+  }
+  save_cv_.notify_all();
+  return 0;
+}
+
+void Thumbnail::WaitForPendingSaves() {
+  std::unique_lock<std::mutex> lock(save_mutex_);
+  save_cv_.wait(lock, [this]() { return save_queue_.empty() && !save_busy_; });
+}
+
+void Thumbnail::SaveLoop() {
+  std::unique_lock<std::mutex> lock(save_mutex_);
+  while (true) {
+    save_cv_.wait(lock,
+                  [this]() { return save_stopped_ || !save_queue_.empty(); });
+    if (save_queue_.empty()) {
+      return;
+    }
+
+    SaveJob job = std::move(save_queue_.front());
+    save_queue_.pop_front();
+    save_busy_ = true;
+    lock.unlock();
+
+    WriteThumbnail(job);
+
+    lock.lock();
+    save_busy_ = false;
+    save_cv_.notify_all();
+  }
+}
+
+void Thumbnail::ScaleToThumbnail(const char* yuv420p, int width, int height,
+                                 std::vector<unsigned char>& rgba) {
+  rgba.resize(static_cast<size_t>(thumbnail_width_) * thumbnail_height_ * 4);
+
   if (yuv420p) {
-    ScaleNv12ToABGR((char*)yuv420p, width, height, thumbnail_width_,
-                    thumbnail_height_, rgba_buffer_);
+    ScaleNv12ToRgba(reinterpret_cast<const uint8_t*>(yuv420p), width, height,
+                    rgba.data(), thumbnail_width_, thumbnail_height_);
   } else {
     // If yuv420p is null, fill the buffer with black pixels
-    memset(rgba_buffer_, 0x00, thumbnail_width_ * thumbnail_height_ * 4);
+    memset(rgba.data(), 0x00, rgba.size());
     for (int i = 0; i < thumbnail_width_ * thumbnail_height_; ++i) {
       // Set alpha channel to opaque
-      rgba_buffer_[i * 4 + 3] = static_cast<char>(0xFF);
+      rgba[i * 4 + 3] = 0xFF;
     }
   }
+}
 
-  std::string image_file_name;
-  if (password.empty()) {
-    return 0;
-  } else {
-    // delete the old thumbnail
-    std::string filename_with_remote_id = remote_id;
-    DeleteThumbnail(filename_with_remote_id);
-  }
+int Thumbnail::WriteThumbnail(SaveJob& job) {
+  std::string cipher_password =
+      AES_encrypt(job.password, aes128_key_, aes128_iv_);
+  // the hex string keeps its terminator
+  cipher_password.resize(strlen(cipher_password.c_str()));
 
-  std::string cipher_password = AES_encrypt(password, aes128_key_, aes128_iv_);
-  image_file_name = remote_id + 'Y' + host_name + '@' + cipher_password;
-  std::string file_path = save_path_ + image_file_name;
-  stbi_write_png(file_path.data(), thumbnail_width_, thumbnail_height_, 4,
-                 rgba_buffer_, thumbnail_width_ * 4);
+  uint64_t sequence = 0;
+  if (store_->Put(job.remote_id, job.host_name, cipher_password, job.width,
+                  job.height, job.rgba.data(), &sequence) != 0) {
+    LOG_ERROR("Failed to write thumbnail [{}]", job.remote_id);
+    return -1;
+  }
 
+  // the next LoadThumbnail finds it without reading it back
+  auto image = std::make_shared<DecodedImage>();
+  image->sequence = sequence;
+  image->width = job.width;
+  image->height = job.height;
+  image->rgba = std::move(job.rgba);
+  std::lock_guard<std::mutex> lock(decode_mutex_);
+  image_cache_[job.remote_id] = std::move(image);
   return 0;
 }
 
@@ -213,106 +249,251 @@ int Thumbnail::LoadThumbnail(
   }
   recent_connections.clear();
 
-  std::vector<std::filesystem::path> image_paths =
-      FindThumbnailPath(save_path_);
+  std::vector<ThumbnailEntry> entries = store_->Entries();
 
-  if (image_paths.size() == 0) {
+  if (entries.size() == 0) {
     return -1;
-  } else {
-    for (int i = 0; i < image_paths.size(); i++) {
-      // size_t pos1 = image_paths[i].string().find('/') + 1;
-      std::string cipher_image_name = image_paths[i].filename().string();
-      std::string remote_id;
-      std::string cipher_password;
-      std::string remote_host_name;
-      std::string original_image_name;
-
-      if ('Y' == cipher_image_name[9] && cipher_image_name.size() >= 16) {
-        size_t pos_y = cipher_image_name.find('Y');
-        size_t pos_at = cipher_image_name.find('@');
-
-        if (pos_y == std::string::npos || pos_at == std::string::npos ||
-            pos_y >= pos_at) {
-          LOG_ERROR("Invalid filename");
-          continue;
-        }
-
-        remote_id = cipher_image_name.substr(0, pos_y);
-        remote_host_name =
-            cipher_image_name.substr(pos_y + 1, pos_at - pos_y - 1);
-        cipher_password = cipher_image_name.substr(pos_at + 1);
-
-        original_image_name =
-            remote_id + 'Y' + remote_host_name + "@" +
-            AES_decrypt(cipher_password, aes128_key_, aes128_iv_);
-      } else {
-        size_t pos_n = cipher_image_name.find('N');
-        // size_t pos_at = cipher_image_name.find('@');
-
-        if (pos_n == std::string::npos) {
-          LOG_ERROR("Invalid filename");
-          continue;
-        }
+  }
 
-        remote_id = cipher_image_name.substr(0, pos_n);
-        remote_host_name = cipher_image_name.substr(pos_n + 1);
+  std::unordered_set<std::string> present;
+  std::unordered_set<std::string> present_passwords;
+  for (const ThumbnailEntry& entry : entries) {
+    std::string original_image_name;
+    if (!entry.cipher_password.empty()) {
+      original_image_name = entry.remote_id + 'Y' + entry.host_name + "@" +
+                            DecryptedPassword(entry.cipher_password);
+      present_passwords.insert(entry.cipher_password);
+    } else {
+      original_image_name = entry.remote_id + 'N' + entry.host_name + "@";
+    }
 
-        original_image_name =
-            remote_id + 'N' + remote_host_name + "@" +
-            AES_decrypt(cipher_password, aes128_key_, aes128_iv_);
+    present.insert(entry.remote_id);
+    recent_connections.emplace_back(
+        std::make_pair(original_image_name, Thumbnail::RecentConnection()));
+    Thumbnail::RecentConnection& connection = recent_connections.back().second;
+    connection.thumbnail_id = entry.remote_id;
+
+    std::shared_ptr<const DecodedImage> image;
+    {
+      std::lock_guard<std::mutex> lock(decode_mutex_);
+      auto cached = image_cache_.find(entry.remote_id);
+      if (cached != image_cache_.end() &&
+          cached->second->sequence == entry.sequence) {
+        image = cached->second;
       }
-
-      std::string image_path = save_path_ + cipher_image_name;
-      recent_connections.emplace_back(
-          std::make_pair(original_image_name, Thumbnail::RecentConnection()));
-      LoadTextureFromFile(image_path.c_str(), renderer,
-                          &(recent_connections[i].second.texture), width,
-                          height);
     }
-    return 0;
+    if (image) {
+      connection.texture = CreateTextureFromRgba(renderer, image->rgba.data(),
+                                                 image->width, image->height);
+      *width = image->width;
+      *height = image->height;
+    } else {
+      DecodeAsync(entry);
+    }
+  }
+
+  // forget deleted connections
+  std::lock_guard<std::mutex> lock(decode_mutex_);
+  for (auto it = image_cache_.begin(); it != image_cache_.end();) {
+    it = present.count(it->first) ? std::next(it) : image_cache_.erase(it);
+  }
+  for (auto it = password_cache_.begin(); it != password_cache_.end();) {
+    it = present_passwords.count(it->first) ? std::next(it)
+                                            : password_cache_.erase(it);
   }
   return 0;
 }
 
-int Thumbnail::DeleteThumbnail(const std::string& filename_keyword) {
-  for (const auto& entry : std::filesystem::directory_iterator(save_path_)) {
-    if (entry.is_regular_file()) {
-      const std::string filename = entry.path().filename().string();
-      std::string id_hostname = filename_keyword.substr(0, filename.find('@'));
-      if (filename.find(id_hostname) != std::string::npos) {
-        std::filesystem::remove(entry.path());
+int Thumbnail::UploadDecodedThumbnails(
+    SDL_Renderer* renderer,
+    std::vector<std::pair<std::string, Thumbnail::RecentConnection>>&
+        recent_connections,
+    int* width, int* height) {
+  std::vector<std::pair<std::string, std::shared_ptr<const DecodedImage>>>
+      ready;
+  {
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    if (decoded_ready_.empty()) {
+      return 0;
+    }
+    for (const std::string& thumbnail_id : decoded_ready_) {
+      auto cached = image_cache_.find(thumbnail_id);
+      if (cached != image_cache_.end()) {
+        ready.emplace_back(thumbnail_id, cached->second);
       }
     }
+    decoded_ready_.clear();
   }
 
-  return 0;
+  int uploaded = 0;
+  for (const auto& [thumbnail_id, image] : ready) {
+    for (auto& it : recent_connections) {
+      if (it.second.thumbnail_id != thumbnail_id ||
+          it.second.texture != nullptr) {
+        continue;
+      }
+      it.second.texture = CreateTextureFromRgba(renderer, image->rgba.data(),
+                                                image->width, image->height);
+      *width = image->width;
+      *height = image->height;
+      ++uploaded;
+    }
+  }
+  return uploaded;
 }
 
-std::vector<std::filesystem::path> Thumbnail::FindThumbnailPath(
-    const std::filesystem::path& directory) {
-  std::vector<std::filesystem::path> thumbnails_path;
+void Thumbnail::DecodeAsync(const ThumbnailEntry& entry) {
+  {
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    if (!decoding_.insert(entry.remote_id).second) {
+      return;
+    }
+  }
 
-  if (!std::filesystem::is_directory(directory)) {
-    LOG_ERROR("No such directory [{}]", directory.string());
-    return thumbnails_path;
+  decode_pool_->Submit(
+      [this, remote_id = entry.remote_id, sequence = entry.sequence]() {
+        auto image = std::make_shared<DecodedImage>();
+        image->sequence = sequence;
+        if (store_->Read(remote_id, sequence, &image->width, &image->height,
+                         image->rgba) != 0) {
+          image.reset();
+        }
+
+        std::function<void()> on_decoded;
+        {
+          std::lock_guard<std::mutex> lock(decode_mutex_);
+          decoding_.erase(remote_id);
+          if (image) {
+            image_cache_[remote_id] = std::move(image);
+            decoded_ready_.push_back(remote_id);
+            on_decoded = on_decoded_;
+          }
+        }
+        if (on_decoded) {
+          on_decoded();
+        }
+      });
+}
+
+void Thumbnail::SetOnDecoded(std::function<void()> on_decoded) {
+  std::lock_guard<std::mutex> lock(decode_mutex_);
+  on_decoded_ = std::move(on_decoded);
+}
+
+std::string Thumbnail::DecryptedPassword(const std::string& cipher_password) {
+  {
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    auto cached = password_cache_.find(cipher_password);
+    if (cached != password_cache_.end()) {
+      return cached->second;
+    }
+  }
+  std::string password = AES_decrypt(cipher_password, aes128_key_, aes128_iv_);
+  std::lock_guard<std::mutex> lock(decode_mutex_);
+  password_cache_[cipher_password] = password;
+  return password;
+}
+
+int Thumbnail::DeleteThumbnail(const std::string& filename_keyword) {
+  std::string remote_id =
+      filename_keyword.substr(0, filename_keyword.find_first_of("YN"));
+
+  {
+    // a queued save would bring the thumbnail back
+    std::lock_guard<std::mutex> lock(save_mutex_);
+    save_queue_.erase(std::remove_if(save_queue_.begin(), save_queue_.end(),
+                                     [&](const SaveJob& queued) {
+                                       return queued.remote_id == remote_id;
+                                     }),
+                      save_queue_.end());
   }
 
-  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-    if (entry.is_regular_file()) {
-      thumbnails_path.push_back(entry.path());
+  {
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    image_cache_.erase(remote_id);
+  }
+  return store_->Remove(remote_id);
+}
+
+void Thumbnail::ImportLegacyThumbnails() {
+  struct LegacyFile {
+    std::filesystem::path path;
+    std::filesystem::file_time_type write_time;
+  };
+
+  std::vector<LegacyFile> legacy_files;
+  std::error_code ec;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(save_path_, ec)) {
+    std::error_code entry_ec;
+    if (entry.is_regular_file(entry_ec) &&
+        !ThumbnailStore::IsStoreFile(entry.path())) {
+      legacy_files.push_back(
+          {entry.path(), entry.last_write_time(entry_ec)});
     }
   }
+  if (legacy_files.empty()) {
+    return;
+  }
 
-  std::sort(thumbnails_path.begin(), thumbnails_path.end(),
-            [](const std::filesystem::path& a, const std::filesystem::path& b) {
-              return std::filesystem::last_write_time(a) >
-                     std::filesystem::last_write_time(b);
+  // oldest first, the store orders by insertion
+  std::sort(legacy_files.begin(), legacy_files.end(),
+            [](const LegacyFile& a, const LegacyFile& b) {
+              return a.write_time < b.write_time;
             });
 
-  return thumbnails_path;
+  size_t imported = 0;
+  for (const LegacyFile& file : legacy_files) {
+    std::string cipher_image_name = file.path.filename().string();
+    std::string remote_id;
+    std::string remote_host_name;
+    std::string cipher_password;
+
+    if (cipher_image_name.size() >= 16 && 'Y' == cipher_image_name[9]) {
+      size_t pos_y = cipher_image_name.find('Y');
+      size_t pos_at = cipher_image_name.find('@');
+      if (pos_y == std::string::npos || pos_at == std::string::npos ||
+          pos_y >= pos_at) {
+        continue;
+      }
+      remote_id = cipher_image_name.substr(0, pos_y);
+      remote_host_name =
+          cipher_image_name.substr(pos_y + 1, pos_at - pos_y - 1);
+      cipher_password = cipher_image_name.substr(pos_at + 1);
+    } else {
+      size_t pos_n = cipher_image_name.find('N');
+      if (pos_n == std::string::npos) {
+        continue;
+      }
+      remote_id = cipher_image_name.substr(0, pos_n);
+      remote_host_name = cipher_image_name.substr(pos_n + 1);
+    }
+
+    int image_width = 0;
+    int image_height = 0;
+    unsigned char* pixels = stbi_load(file.path.string().c_str(), &image_width,
+                                      &image_height, nullptr, 4);
+    if (pixels == nullptr) {
+      continue;
+    }
+    int ret = store_->Put(remote_id, remote_host_name, cipher_password,
+                          image_width, image_height, pixels, nullptr);
+    stbi_image_free(pixels);
+    if (ret == 0) {
+      std::filesystem::remove(file.path, ec);
+      ++imported;
+    }
+  }
+  LOG_INFO("Imported {} thumbnails into the store", imported);
 }
 
 int Thumbnail::DeleteAllFilesInDirectory() {
+  {
+    std::lock_guard<std::mutex> lock(decode_mutex_);
+    image_cache_.clear();
+  }
+  store_->Clear();
+
   if (std::filesystem::exists(save_path_) &&
       std::filesystem::is_directory(save_path_)) {
     for (const auto& entry : std::filesystem::directory_iterator(save_path_)) {
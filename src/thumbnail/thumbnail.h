@@ -9,11 +9,22 @@
 
 #include <SDL3/SDL.h>
 
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "thread_pool.h"
+#include "thumbnail_store.h"
+
 namespace crossdesk {
 
 class Thumbnail {
@@ -24,6 +35,8 @@ class Thumbnail {
     std::string remote_host_name;
     std::string password;
     bool remember_password = false;
+    // stored thumbnail the texture comes from
+    std::string thumbnail_id;
   };
 
  public:
@@ -40,12 +53,38 @@ class Thumbnail {
                       const std::string& host_name,
                       const std::string& password);
 
+  // downscales the frame on the calling thread and leaves the store write to
+  // the save worker, so only the thumbnail-sized pixels are kept. A pending
+  // save for the same remote id is replaced by the newer frame.
+  int SaveToThumbnailAsync(const char* yuv420p, int width, int height,
+                           const std::string& remote_id,
+                           const std::string& host_name,
+                           const std::string& password);
+
+  // blocks until every queued save is written
+  void WaitForPendingSaves();
+
+  // lists the saved connections at once. Thumbnails already decoded get their
+  // texture right away, the others keep a null texture until
+  // UploadDecodedThumbnails hands it over.
   int LoadThumbnail(
       SDL_Renderer* renderer,
       std::vector<std::pair<std::string, Thumbnail::RecentConnection>>&
           recent_connections,
       int* width, int* height);
 
+  // creates textures for thumbnails the decode pool has finished, call it
+  // every frame on the render thread. Returns the number of textures created.
+  int UploadDecodedThumbnails(
+      SDL_Renderer* renderer,
+      std::vector<std::pair<std::string, Thumbnail::RecentConnection>>&
+          recent_connections,
+      int* width, int* height);
+
+  // called on a decode worker whenever a thumbnail is ready for
+  // UploadDecodedThumbnails
+  void SetOnDecoded(std::function<void()> on_decoded);
+
   int DeleteThumbnail(const std::string& filename_keyword);
 
   int DeleteAllFilesInDirectory();
@@ -67,8 +106,36 @@ class Thumbnail {
   }
 
  private:
-  std::vector<std::filesystem::path> FindThumbnailPath(
-      const std::filesystem::path& directory);
+  struct DecodedImage {
+    uint64_t sequence = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> rgba;
+  };
+
+  struct SaveJob {
+    std::string remote_id;
+    std::string host_name;
+    std::string password;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> rgba;
+  };
+
+ private:
+  // moves the PNG files older versions kept per connection into the store
+  void ImportLegacyThumbnails();
+
+  void ScaleToThumbnail(const char* yuv420p, int width, int height,
+                        std::vector<unsigned char>& rgba);
+
+  int WriteThumbnail(SaveJob& job);
+
+  void SaveLoop();
+
+  void DecodeAsync(const ThumbnailEntry& entry);
+
+  std::string DecryptedPassword(const std::string& cipher_password);
 
   std::string AES_encrypt(const std::string& plaintext, unsigned char* key,
                           unsigned char* iv);
@@ -79,13 +146,35 @@ class Thumbnail {
  private:
   int thumbnail_width_ = 160;
   int thumbnail_height_ = 90;
-  char* rgba_buffer_ = nullptr;
   std::string save_path_ = "thumbnails/";
 
   unsigned char aes128_key_[16];
   unsigned char aes128_iv_[16];
   unsigned char ciphertext_[64];
   unsigned char decryptedtext_[64];
+
+  std::unique_ptr<ThumbnailStore> store_;
+
+  // decoded thumbnails by remote id, kept across reloads
+  std::mutex decode_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const DecodedImage>>
+      image_cache_;
+  std::unordered_set<std::string> decoding_;
+  std::vector<std::string> decoded_ready_;
+  std::function<void()> on_decoded_;
+  // cipher to decrypted password
+  std::unordered_map<std::string, std::string> password_cache_;
+
+  // one worker writes the queued thumbnails in order
+  std::mutex save_mutex_;
+  std::condition_variable save_cv_;
+  std::deque<SaveJob> save_queue_;
+  bool save_busy_ = false;
+  bool save_stopped_ = false;
+  std::thread save_thread_;
+
+  // last, its workers use the members above until it is joined
+  std::unique_ptr<ThreadPool> decode_pool_;
 };
 }  // namespace crossdesk
 #endif
\ No newline at end of file
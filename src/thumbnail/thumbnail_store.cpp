@@ -0,0 +1,495 @@
+#include "thumbnail_store.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "crc32c.h"
+#include "lz4.h"
+#include "rd_log.h"
+
+namespace crossdesk {
+
+namespace {
+constexpr char kIndexFileName[] = "thumbnails.idx";
+constexpr char kIndexTempFileName[] = "thumbnails.idx.tmp";
+constexpr char kDataFilePrefix[] = "thumbnails.";
+constexpr char kDataFileSuffix[] = ".dat";
+// replaced tiles are only reclaimed once they exceed the live ones and this
+constexpr uint64_t kMinCompactBytes = 1024 * 1024;
+
+template <typename T>
+void Append(std::vector<char>& out, const T& value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void Append(std::vector<char>& out, const std::string& value) {
+  out.insert(out.end(), value.begin(), value.end());
+}
+}  // namespace
+
+// read-only view of a whole file
+class ThumbnailStore::MappedFile {
+ public:
+  ~MappedFile() { Close(); }
+
+  bool Open(const std::filesystem::path& path) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileW(
+        path.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+      CloseHandle(file);
+      return false;
+    }
+    HANDLE mapping =
+        CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+      return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+      return false;
+    }
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+      close(fd);
+      return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                      MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+      return false;
+    }
+    data_ = static_cast<const uint8_t*>(view);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+    return true;
+  }
+
+  void Close() {
+    if (data_) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+ThumbnailStore::ThumbnailStore(const std::filesystem::path& directory)
+    : directory_(directory), mapped_(std::make_unique<MappedFile>()) {}
+
+ThumbnailStore::~ThumbnailStore() {}
+
+int ThumbnailStore::Open() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  mapped_->Close();
+
+  std::ifstream file(IndexPath(), std::ios::binary);
+  if (!file) {
+    return -1;
+  }
+  std::vector<char> index((std::istreambuf_iterator<char>(file)),
+                          std::istreambuf_iterator<char>());
+  if (index.size() < sizeof(ThumbnailIndexHeader) + sizeof(uint32_t)) {
+    LOG_ERROR("Thumbnail index too short");
+    return -1;
+  }
+
+  size_t body_size = index.size() - sizeof(uint32_t);
+  uint32_t crc = 0;
+  memcpy(&crc, index.data() + body_size, sizeof(crc));
+  ThumbnailIndexHeader header;
+  memcpy(&header, index.data(), sizeof(header));
+  if (crc != Crc32c(0, index.data(), body_size) ||
+      header.magic != kThumbnailIndexMagic ||
+      header.version != kThumbnailIndexVersion) {
+    LOG_ERROR("Thumbnail index damaged, start empty");
+    return -1;
+  }
+
+  // a tile appended without its index update is garbage
+  std::error_code ec;
+  uint64_t data_file_size =
+      std::filesystem::file_size(DataPath(header.generation), ec);
+  if (ec) {
+    data_file_size = 0;
+  }
+  if (data_file_size > header.data_size) {
+    std::filesystem::resize_file(DataPath(header.generation), header.data_size,
+                                 ec);
+    data_file_size = ec ? data_file_size : header.data_size;
+  }
+
+  generation_ = header.generation;
+  data_size_ = header.data_size;
+  next_sequence_ = header.next_sequence;
+  live_size_ = 0;
+
+  size_t pos = sizeof(header);
+  for (uint32_t i = 0; i < header.entry_count; ++i) {
+    ThumbnailIndexEntry record;
+    if (pos + sizeof(record) > body_size) {
+      break;
+    }
+    memcpy(&record, index.data() + pos, sizeof(record));
+    pos += sizeof(record);
+    size_t strings_size = static_cast<size_t>(record.remote_id_len) +
+                          record.host_name_len + record.password_len;
+    if (pos + strings_size > body_size) {
+      break;
+    }
+
+    ThumbnailEntry entry;
+    entry.remote_id.assign(index.data() + pos, record.remote_id_len);
+    pos += record.remote_id_len;
+    entry.host_name.assign(index.data() + pos, record.host_name_len);
+    pos += record.host_name_len;
+    entry.cipher_password.assign(index.data() + pos, record.password_len);
+    pos += record.password_len;
+    entry.sequence = record.sequence;
+    entry.offset = record.offset;
+    entry.tile_size = record.tile_size;
+
+    if (entry.offset + entry.tile_size > data_file_size) {
+      LOG_WARN("Thumbnail of [{}] missing from the data file",
+               entry.remote_id);
+      continue;
+    }
+    live_size_ += entry.tile_size;
+    std::string remote_id = entry.remote_id;
+    entries_[remote_id] = std::move(entry);
+  }
+
+  return 0;
+}
+
+std::vector<ThumbnailEntry> ThumbnailStore::Entries() {
+  std::vector<ThumbnailEntry> entries;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries.reserve(entries_.size());
+    for (const auto& [remote_id, entry] : entries_) {
+      entries.push_back(entry);
+    }
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const ThumbnailEntry& a, const ThumbnailEntry& b) {
+              return a.sequence > b.sequence;
+            });
+  return entries;
+}
+
+int ThumbnailStore::Put(const std::string& remote_id,
+                        const std::string& host_name,
+                        const std::string& cipher_password, int width,
+                        int height, const unsigned char* rgba,
+                        uint64_t* sequence) {
+  int raw_size = width * height * 4;
+  std::vector<char> tile(sizeof(ThumbnailTileHeader) +
+                         LZ4_compressBound(raw_size));
+  ThumbnailTileHeader header;
+  header.magic = kThumbnailTileMagic;
+  header.width = static_cast<uint16_t>(width);
+  header.height = static_cast<uint16_t>(height);
+  header.flags = 0;
+
+  char* payload = tile.data() + sizeof(header);
+  int compressed =
+      LZ4_compress_default(reinterpret_cast<const char*>(rgba), payload,
+                           raw_size, LZ4_compressBound(raw_size));
+  if (compressed > 0 && compressed < raw_size) {
+    header.flags = kThumbnailTileLz4;
+    header.payload_size = static_cast<uint32_t>(compressed);
+  } else {
+    memcpy(payload, rgba, raw_size);
+    header.payload_size = static_cast<uint32_t>(raw_size);
+  }
+  header.crc = Crc32c(0, payload, header.payload_size);
+  memcpy(tile.data(), &header, sizeof(header));
+  tile.resize(sizeof(header) + header.payload_size);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  {
+    std::ofstream data(DataPath(generation_),
+                       std::ios::binary | std::ios::app);
+    data.write(tile.data(), static_cast<std::streamsize>(tile.size()));
+    data.flush();
+    if (!data) {
+      LOG_ERROR("Failed to append thumbnail of [{}]", remote_id);
+      return -1;
+    }
+  }
+
+  ThumbnailEntry& entry = entries_[remote_id];
+  if (entry.tile_size) {
+    live_size_ -= entry.tile_size;
+  }
+  entry.remote_id = remote_id;
+  entry.host_name = host_name;
+  entry.cipher_password = cipher_password;
+  entry.sequence = next_sequence_++;
+  entry.offset = data_size_;
+  entry.tile_size = static_cast<uint32_t>(tile.size());
+  data_size_ += tile.size();
+  live_size_ += tile.size();
+  if (sequence) {
+    *sequence = entry.sequence;
+  }
+
+  if (WriteIndex() != 0) {
+    return -1;
+  }
+  return CompactIfNeeded();
+}
+
+int ThumbnailStore::Read(const std::string& remote_id, uint64_t sequence,
+                         int* width, int* height,
+                         std::vector<unsigned char>& rgba) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(remote_id);
+  if (it == entries_.end() || it->second.sequence != sequence) {
+    return -1;
+  }
+
+  const uint8_t* tile = MapTile(it->second.offset, it->second.tile_size);
+  if (!tile) {
+    return -1;
+  }
+  ThumbnailTileHeader header;
+  memcpy(&header, tile, sizeof(header));
+  const char* payload = reinterpret_cast<const char*>(tile + sizeof(header));
+  if (header.magic != kThumbnailTileMagic ||
+      sizeof(header) + header.payload_size > it->second.tile_size ||
+      header.crc != Crc32c(0, payload, header.payload_size)) {
+    LOG_ERROR("Thumbnail of [{}] damaged", remote_id);
+    return -1;
+  }
+
+  int raw_size = header.width * header.height * 4;
+  rgba.resize(raw_size);
+  if (header.flags & kThumbnailTileLz4) {
+    int decompressed =
+        LZ4_decompress_safe(payload, reinterpret_cast<char*>(rgba.data()),
+                            static_cast<int>(header.payload_size), raw_size);
+    if (decompressed != raw_size) {
+      LOG_ERROR("Failed to decompress thumbnail of [{}]", remote_id);
+      return -1;
+    }
+  } else if (header.payload_size == static_cast<uint32_t>(raw_size)) {
+    memcpy(rgba.data(), payload, raw_size);
+  } else {
+    return -1;
+  }
+
+  *width = header.width;
+  *height = header.height;
+  return 0;
+}
+
+int ThumbnailStore::Remove(const std::string& remote_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(remote_id);
+  if (it == entries_.end()) {
+    return 0;
+  }
+  live_size_ -= it->second.tile_size;
+  entries_.erase(it);
+
+  if (WriteIndex() != 0) {
+    return -1;
+  }
+  return CompactIfNeeded();
+}
+
+int ThumbnailStore::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  mapped_->Close();
+  entries_.clear();
+
+  std::error_code ec;
+  std::filesystem::remove(IndexPath(), ec);
+  std::filesystem::remove(DataPath(generation_), ec);
+  data_size_ = 0;
+  live_size_ = 0;
+  return 0;
+}
+
+bool ThumbnailStore::IsStoreFile(const std::filesystem::path& path) {
+  std::string name = path.filename().string();
+  return name == kIndexFileName || name == kIndexTempFileName ||
+         (name.rfind(kDataFilePrefix, 0) == 0 &&
+          path.extension() == kDataFileSuffix);
+}
+
+std::filesystem::path ThumbnailStore::DataPath(uint32_t generation) const {
+  return directory_ / (std::string(kDataFilePrefix) +
+                       std::to_string(generation) + kDataFileSuffix);
+}
+
+std::filesystem::path ThumbnailStore::IndexPath() const {
+  return directory_ / kIndexFileName;
+}
+
+int ThumbnailStore::WriteIndex() {
+  std::vector<char> index;
+  ThumbnailIndexHeader header;
+  header.magic = kThumbnailIndexMagic;
+  header.version = kThumbnailIndexVersion;
+  header.generation = generation_;
+  header.entry_count = static_cast<uint32_t>(entries_.size());
+  header.data_size = data_size_;
+  header.next_sequence = next_sequence_;
+  Append(index, header);
+
+  for (const auto& [remote_id, entry] : entries_) {
+    ThumbnailIndexEntry record;
+    record.sequence = entry.sequence;
+    record.offset = entry.offset;
+    record.tile_size = entry.tile_size;
+    record.remote_id_len = static_cast<uint16_t>(entry.remote_id.size());
+    record.host_name_len = static_cast<uint16_t>(entry.host_name.size());
+    record.password_len = static_cast<uint16_t>(entry.cipher_password.size());
+    Append(index, record);
+    Append(index, entry.remote_id);
+    Append(index, entry.host_name);
+    Append(index, entry.cipher_password);
+  }
+  Append(index, Crc32c(0, index.data(), index.size()));
+
+  std::filesystem::path temp_path = directory_ / kIndexTempFileName;
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    file.write(index.data(), static_cast<std::streamsize>(index.size()));
+    file.flush();
+    if (!file) {
+      LOG_ERROR("Failed to write thumbnail index");
+      return -1;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(temp_path, IndexPath(), ec);
+  if (ec) {
+    LOG_ERROR("Failed to replace thumbnail index: [{}]", ec.message());
+    return -1;
+  }
+  return 0;
+}
+
+int ThumbnailStore::CompactIfNeeded() {
+  uint64_t dead_size = data_size_ - live_size_;
+  if (dead_size < kMinCompactBytes || dead_size <= live_size_) {
+    return 0;
+  }
+
+  uint32_t generation = generation_ + 1;
+  std::vector<std::pair<ThumbnailEntry*, uint64_t>> moved;
+  uint64_t size = 0;
+  {
+    std::ofstream data(DataPath(generation), std::ios::binary | std::ios::trunc);
+    for (auto& [remote_id, entry] : entries_) {
+      const uint8_t* tile = MapTile(entry.offset, entry.tile_size);
+      if (!tile) {
+        continue;
+      }
+      data.write(reinterpret_cast<const char*>(tile), entry.tile_size);
+      moved.emplace_back(&entry, size);
+      size += entry.tile_size;
+    }
+    data.flush();
+    if (!data) {
+      LOG_ERROR("Failed to compact thumbnails");
+      data.close();
+      std::error_code ec;
+      std::filesystem::remove(DataPath(generation), ec);
+      return -1;
+    }
+  }
+
+  uint32_t old_generation = generation_;
+  uint64_t old_data_size = data_size_;
+  std::vector<uint64_t> old_offsets;
+  for (auto& [entry, offset] : moved) {
+    old_offsets.push_back(entry->offset);
+    entry->offset = offset;
+  }
+  generation_ = generation;
+  data_size_ = size;
+  live_size_ = size;
+
+  if (WriteIndex() != 0) {
+    // the old index and data file still hold
+    for (size_t i = 0; i < moved.size(); ++i) {
+      moved[i].first->offset = old_offsets[i];
+    }
+    generation_ = old_generation;
+    data_size_ = old_data_size;
+    std::error_code ec;
+    std::filesystem::remove(DataPath(generation), ec);
+    return -1;
+  }
+
+  mapped_->Close();
+  std::error_code ec;
+  std::filesystem::remove(DataPath(old_generation), ec);
+  LOG_INFO("Compacted thumbnails to {} bytes", size);
+  return 0;
+}
+
+const uint8_t* ThumbnailStore::MapTile(uint64_t offset, uint32_t tile_size) {
+  // tiles appended since the mapping was made need a new one
+  if (offset + tile_size > mapped_->size() &&
+      !mapped_->Open(DataPath(generation_))) {
+    LOG_ERROR("Failed to map thumbnail data");
+    return nullptr;
+  }
+  if (offset + tile_size > mapped_->size() ||
+      tile_size < sizeof(ThumbnailTileHeader)) {
+    return nullptr;
+  }
+  return mapped_->data() + offset;
+}
+
+}  // namespace crossdesk
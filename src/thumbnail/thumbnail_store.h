@@ -0,0 +1,131 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _THUMBNAIL_STORE_H_
+#define _THUMBNAIL_STORE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace crossdesk {
+
+constexpr uint32_t kThumbnailTileMagic = 0x4A4E5454;   // 'JNTT'
+constexpr uint32_t kThumbnailIndexMagic = 0x4A4E5449;  // 'JNTI'
+constexpr uint32_t kThumbnailIndexVersion = 1;
+
+// ThumbnailTileHeader.flags
+constexpr uint8_t kThumbnailTileLz4 = 0x01;
+
+#pragma pack(push, 1)
+// one tile in the data file, followed by payload_size bytes of RGBA
+struct ThumbnailTileHeader {
+  uint32_t magic;
+  uint16_t width;
+  uint16_t height;
+  uint8_t flags;
+  uint32_t payload_size;
+  uint32_t crc;  // Crc32c of the payload
+};
+
+// the index file: the header, entry_count entries each followed by its
+// remote id, host name and cipher password, then the Crc32c of all of it
+struct ThumbnailIndexHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t generation;  // names the data file, thumbnails.<generation>.dat
+  uint32_t entry_count;
+  uint64_t data_size;  // bytes of the data file the index accounts for
+  uint64_t next_sequence;
+};
+
+struct ThumbnailIndexEntry {
+  uint64_t sequence;
+  uint64_t offset;
+  uint32_t tile_size;  // header and payload
+  uint16_t remote_id_len;
+  uint16_t host_name_len;
+  uint16_t password_len;
+};
+#pragma pack(pop)
+
+struct ThumbnailEntry {
+  std::string remote_id;
+  std::string host_name;
+  std::string cipher_password;
+  // grows with every Put, the newest thumbnail has the largest
+  uint64_t sequence = 0;
+  uint64_t offset = 0;
+  uint32_t tile_size = 0;
+};
+
+// All saved thumbnails in two files: an append-only data file of RGBA tiles,
+// LZ4 compressed when that pays, and a small index with the metadata of
+// every connection. A change appends its tile first and then replaces the
+// index through a temporary file and a rename, so a crash leaves either the
+// old or the new state. Tiles are read through a memory mapping of the data
+// file. Once replaced and removed tiles outweigh the live ones the live
+// tiles are copied into a new data file.
+class ThumbnailStore {
+ public:
+  explicit ThumbnailStore(const std::filesystem::path& directory);
+  ~ThumbnailStore();
+
+  ThumbnailStore(const ThumbnailStore&) = delete;
+  ThumbnailStore& operator=(const ThumbnailStore&) = delete;
+
+  // reads the index, -1 when there is none or it is damaged and the store
+  // starts empty
+  int Open();
+
+  // newest first
+  std::vector<ThumbnailEntry> Entries();
+
+  // replaces the thumbnail of `remote_id`, `sequence` receives its new
+  // sequence
+  int Put(const std::string& remote_id, const std::string& host_name,
+          const std::string& cipher_password, int width, int height,
+          const unsigned char* rgba, uint64_t* sequence);
+
+  // pixels of `remote_id` while it still has `sequence`
+  int Read(const std::string& remote_id, uint64_t sequence, int* width,
+           int* height, std::vector<unsigned char>& rgba);
+
+  int Remove(const std::string& remote_id);
+
+  // drops every entry and both files
+  int Clear();
+
+  // true for the files the store keeps in its directory
+  static bool IsStoreFile(const std::filesystem::path& path);
+
+ private:
+  class MappedFile;
+
+  std::filesystem::path DataPath(uint32_t generation) const;
+  std::filesystem::path IndexPath() const;
+  int WriteIndex();
+  int CompactIfNeeded();
+  const uint8_t* MapTile(uint64_t offset, uint32_t tile_size);
+
+ private:
+  std::mutex mutex_;
+  std::filesystem::path directory_;
+  uint32_t generation_ = 0;
+  uint64_t data_size_ = 0;
+  uint64_t live_size_ = 0;
+  uint64_t next_sequence_ = 1;
+  std::unordered_map<std::string, ThumbnailEntry> entries_;
+  std::unique_ptr<MappedFile> mapped_;
+};
+
+}  // namespace crossdesk
+
+#endif
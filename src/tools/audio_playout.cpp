@@ -0,0 +1,147 @@
+#include "audio_playout.h"
+
+#include <algorithm>
+
+namespace crossdesk {
+
+namespace {
+constexpr double kMinTargetMs = 30;
+constexpr double kMaxTargetMs = 250;
+// no adjustment while the queue is this close to the target
+constexpr double kToleranceMs = 15;
+// further above the target than this, frames are dropped whole
+constexpr double kDropAboveMs = 200;
+// share of a frame added or removed per frame
+constexpr int kStretchDivisor = 20;
+// per frame decay of the jitter peak, about 3 s to halve at 10 ms frames
+constexpr double kJitterDecay = 0.9977;
+// a longer gap is a pause in the stream (the host gates silence), not jitter
+constexpr auto kSpurtGap = std::chrono::milliseconds(200);
+}  // namespace
+
+AudioPlayout::AudioPlayout() { Reset(); }
+
+void AudioPlayout::Reset() {
+  has_arrival_ = false;
+  jitter_ms_ = 0;
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = Stats();
+  stats_.target_ms = static_cast<uint32_t>(kMinTargetMs);
+}
+
+const int16_t* AudioPlayout::Process(const int16_t* pcm, size_t frames,
+                                     int channels, int sample_rate,
+                                     size_t queued_bytes, size_t* out_frames) {
+  *out_frames = 0;
+  out_.clear();
+  if (!pcm || frames == 0 || channels <= 0 || sample_rate <= 0) {
+    return out_.data();
+  }
+
+  Clock::time_point now = Clock::now();
+  bool spurt_start = !has_arrival_ || now - last_arrival_ > kSpurtGap;
+  double frame_ms = frames * 1000.0 / sample_rate;
+  if (!spurt_start) {
+    UpdateJitter(now, frame_ms);
+  }
+  last_arrival_ = now;
+  has_arrival_ = true;
+
+  size_t bytes_per_ms = static_cast<size_t>(sample_rate) * channels *
+                        sizeof(int16_t) / 1000;
+  double depth_ms =
+      bytes_per_ms > 0 ? static_cast<double>(queued_bytes) / bytes_per_ms : 0;
+  double target_ms =
+      std::clamp(kMinTargetMs + 2 * jitter_ms_ + target_offset_ms_.load(),
+                 kMinTargetMs, kMaxTargetMs);
+
+  int max_delta = static_cast<int>(frames / kStretchDivisor);
+  bool underrun = false;
+  bool dropped = false;
+  int delta = 0;
+
+  if (queued_bytes == 0) {
+    // start over from the target, the silence absorbs the jitter
+    underrun = !spurt_start;
+    size_t pad = static_cast<size_t>(target_ms * sample_rate / 1000) *
+                 static_cast<size_t>(channels);
+    out_.assign(pad, 0);
+  } else if (depth_ms > target_ms + kDropAboveMs) {
+    dropped = true;
+  } else if (depth_ms > target_ms + kToleranceMs) {
+    delta = -max_delta;
+  } else if (depth_ms < target_ms - kToleranceMs) {
+    delta = max_delta;
+  }
+
+  if (!dropped) {
+    AppendStretched(pcm, frames, channels, delta);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.depth_ms = static_cast<uint32_t>(depth_ms);
+    stats_.target_ms = static_cast<uint32_t>(target_ms);
+    stats_.jitter_ms = static_cast<uint32_t>(jitter_ms_);
+    stats_.underruns += underrun ? 1 : 0;
+    stats_.dropped += dropped ? 1 : 0;
+    stats_.stretched += delta > 0 ? 1 : 0;
+    stats_.compressed += delta < 0 ? 1 : 0;
+  }
+
+  *out_frames = out_.size() / channels;
+  return out_.data();
+}
+
+void AudioPlayout::SetTargetOffsetMs(int offset_ms) {
+  target_offset_ms_ = offset_ms;
+}
+
+AudioPlayout::Stats AudioPlayout::GetStats() {
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  return stats_;
+}
+
+void AudioPlayout::UpdateJitter(Clock::time_point now, double frame_ms) {
+  double interval_ms =
+      std::chrono::duration<double, std::milli>(now - last_arrival_).count();
+  double deviation = interval_ms > frame_ms ? interval_ms - frame_ms
+                                            : frame_ms - interval_ms;
+  jitter_ms_ = (std::max)(deviation, jitter_ms_ * kJitterDecay);
+}
+
+void AudioPlayout::AppendStretched(const int16_t* pcm, size_t frames,
+                                   int channels, int delta) {
+  size_t k = static_cast<size_t>(delta < 0 ? -delta : delta);
+  if (k == 0 || 2 * k > frames) {
+    out_.insert(out_.end(), pcm, pcm + frames * channels);
+    return;
+  }
+
+  auto crossfade = [&](size_t from, size_t to) {
+    // fades from the segment at `from` into the one at `to`, k frames long
+    for (size_t j = 0; j < k; ++j) {
+      float w = static_cast<float>(j + 1) / static_cast<float>(k + 1);
+      for (int c = 0; c < channels; ++c) {
+        float a = pcm[(from + j) * channels + c];
+        float b = pcm[(to + j) * channels + c];
+        out_.push_back(static_cast<int16_t>(a + (b - a) * w));
+      }
+    }
+  };
+
+  if (delta < 0) {
+    // x[0, n-2k) then x[n-2k, n-k) fading into x[n-k, n): k frames fewer
+    out_.insert(out_.end(), pcm, pcm + (frames - 2 * k) * channels);
+    crossfade(frames - 2 * k, frames - k);
+  } else {
+    // x[0, n-k), x[n-k, n) fading back into x[n-2k, n-k), then x[n-k, n)
+    // again: k frames more
+    out_.insert(out_.end(), pcm, pcm + (frames - k) * channels);
+    crossfade(frames - k, frames - 2 * k);
+    out_.insert(out_.end(), pcm + (frames - k) * channels,
+                pcm + frames * channels);
+  }
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,80 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _AUDIO_PLAYOUT_H_
+#define _AUDIO_PLAYOUT_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace crossdesk {
+
+// Keeps the audio output queue of the viewer near a target latency. Every
+// received frame passes through Process together with what the output still
+// holds, and comes out stretched or compressed by a few percent (a short
+// crossfade, the pitch stays put) until the queue converges on the target.
+// A queue far above it drops whole frames, an empty one is padded with
+// silence up to the target.
+//
+// The target follows the arrival jitter: the minimum plus twice the peak
+// deviation of the inter-arrival time, decaying over a few seconds.
+class AudioPlayout {
+ public:
+  struct Stats {
+    uint32_t depth_ms = 0;
+    uint32_t target_ms = 0;
+    uint32_t jitter_ms = 0;
+    uint64_t stretched = 0;   // frames lengthened
+    uint64_t compressed = 0;  // frames shortened
+    uint64_t dropped = 0;     // frames discarded, the queue was far behind
+    uint64_t underruns = 0;   // the queue ran dry mid-stream
+  };
+
+ public:
+  AudioPlayout();
+  ~AudioPlayout() = default;
+
+  // pcm is interleaved S16, queued_bytes what the output holds in the same
+  // format. Returns the samples to queue, out_frames may be 0; valid until
+  // the next call.
+  const int16_t* Process(const int16_t* pcm, size_t frames, int channels,
+                         int sample_rate, size_t queued_bytes,
+                         size_t* out_frames);
+
+  void Reset();
+
+  // shifts the target, positive delays the audio. Used for lip sync.
+  void SetTargetOffsetMs(int offset_ms);
+
+  Stats GetStats();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  void UpdateJitter(Clock::time_point now, double frame_ms);
+  // append pcm to out_ with `delta` frames removed (< 0) or added (> 0)
+  void AppendStretched(const int16_t* pcm, size_t frames, int channels,
+                       int delta);
+
+ private:
+  std::vector<int16_t> out_;
+
+  Clock::time_point last_arrival_;
+  bool has_arrival_ = false;
+  double jitter_ms_ = 0;
+  std::atomic<int> target_offset_ms_{0};
+
+  std::mutex stats_mutex_;
+  Stats stats_;
+};
+
+}  // namespace crossdesk
+
+#endif
@@ -0,0 +1,83 @@
+#include "av_sync.h"
+
+#include <algorithm>
+
+namespace crossdesk {
+
+namespace {
+// smoothing of the per frame latencies
+constexpr double kVideoAlpha = 0.05;
+constexpr double kAudioAlpha = 0.25;
+// skew nobody notices, left alone so the offset does not hunt
+constexpr double kDeadZoneMs = 20;
+// share of the skew corrected per audio clock update
+constexpr double kGain = 0.5;
+}  // namespace
+
+void AvSync::OnVideoFrame(int64_t capture_us, int64_t arrival_us) {
+  if (capture_us <= 0) {
+    return;
+  }
+  double latency_ms = (arrival_us - capture_us) / 1000.0;
+  std::lock_guard<std::mutex> lock(mutex_);
+  video_latency_ms_ =
+      has_video_ ? video_latency_ms_ + (latency_ms - video_latency_ms_) *
+                                           kVideoAlpha
+                 : latency_ms;
+  has_video_ = true;
+}
+
+void AvSync::OnAudioClock(int64_t capture_us, int64_t arrival_us,
+                          uint32_t playout_ms) {
+  if (capture_us <= 0) {
+    return;
+  }
+  double latency_ms = (arrival_us - capture_us) / 1000.0 + playout_ms;
+  std::lock_guard<std::mutex> lock(mutex_);
+  audio_latency_ms_ =
+      has_audio_ ? audio_latency_ms_ + (latency_ms - audio_latency_ms_) *
+                                           kAudioAlpha
+                 : latency_ms;
+  has_audio_ = true;
+  UpdateLocked();
+}
+
+int AvSync::AudioOffsetMs() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(audio_offset_ms_);
+}
+
+void AvSync::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  has_video_ = false;
+  has_audio_ = false;
+  audio_offset_ms_ = 0;
+  skew_ms_ = 0;
+}
+
+AvSync::Stats AvSync::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats;
+  stats.valid = has_video_ && has_audio_;
+  stats.video_latency_ms = static_cast<int32_t>(video_latency_ms_);
+  stats.audio_latency_ms = static_cast<int32_t>(audio_latency_ms_);
+  stats.skew_ms = static_cast<int32_t>(skew_ms_);
+  stats.audio_offset_ms = static_cast<int32_t>(audio_offset_ms_);
+  return stats;
+}
+
+void AvSync::UpdateLocked() {
+  if (!has_video_ || !has_audio_) {
+    return;
+  }
+  // the audio latency already contains the current offset, so this is a
+  // plain feedback loop
+  skew_ms_ = audio_latency_ms_ - video_latency_ms_;
+  if (skew_ms_ > kDeadZoneMs || skew_ms_ < -kDeadZoneMs) {
+    audio_offset_ms_ = std::clamp(audio_offset_ms_ - skew_ms_ * kGain,
+                                  -static_cast<double>(kWindowMs),
+                                  static_cast<double>(kWindowMs));
+  }
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,64 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _AV_SYNC_H_
+#define _AV_SYNC_H_
+
+#include <cstdint>
+#include <mutex>
+
+namespace crossdesk {
+
+// Lip sync on the viewer. Both streams are stamped with the host's capture
+// time, the controller compares how long each takes from capture to playout
+// and turns the difference (the skew) into a playout offset for the audio:
+// audio that is ahead is delayed, audio that is behind is played earlier
+// (down to what the playout buffer allows). The offset stays within
+// +-kWindowMs.
+//
+// Capture and arrival times only need to come from the same pair of clocks,
+// any constant offset between host and viewer clocks cancels out.
+class AvSync {
+ public:
+  static constexpr int kWindowMs = 150;
+
+  struct Stats {
+    int32_t video_latency_ms = 0;
+    int32_t audio_latency_ms = 0;
+    int32_t skew_ms = 0;  // positive while audio lags video
+    int32_t audio_offset_ms = 0;
+    bool valid = false;
+  };
+
+ public:
+  void OnVideoFrame(int64_t capture_us, int64_t arrival_us);
+  // playout_ms is how long audio arriving now waits before it is heard.
+  void OnAudioClock(int64_t capture_us, int64_t arrival_us,
+                    uint32_t playout_ms);
+
+  // to add to the audio playout target.
+  int AudioOffsetMs();
+
+  void Reset();
+
+  Stats GetStats();
+
+ private:
+  void UpdateLocked();
+
+ private:
+  std::mutex mutex_;
+  double video_latency_ms_ = 0;
+  double audio_latency_ms_ = 0;
+  bool has_video_ = false;
+  bool has_audio_ = false;
+  double audio_offset_ms_ = 0;
+  double skew_ms_ = 0;
+};
+
+}  // namespace crossdesk
+
+#endif
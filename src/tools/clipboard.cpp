@@ -1,6 +1,9 @@
 
 #include "clipboard.h"
 
+#include <xxhash.h>
+
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <mutex>
@@ -11,13 +14,18 @@
 
 #ifdef _WIN32
 #include <windows.h>
-#elif __linux__
-#include <X11/Xatom.h>
-#include <X11/Xlib.h>
-#include <X11/extensions/Xfixes.h>
+#include <shellapi.h>
 
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <memory>
+
+#include "clipboard_image.h"
+#elif __linux__
+#include <condition_variable>
+
+#include "clipboard_x11.h"
 #endif
 
 namespace crossdesk {
@@ -25,24 +33,42 @@ namespace crossdesk {
 std::atomic<bool> g_monitoring{false};
 std::thread g_monitor_thread;
 std::mutex g_monitor_mutex;
-std::string g_last_clipboard_text;
+uint64_t g_last_clipboard_hash = 0;
 int g_check_interval_ms = 100;
 Clipboard::OnClipboardChanged g_on_clipboard_changed;
 
 #ifdef _WIN32
 HWND g_clipboard_wnd = nullptr;
 const char* g_clipboard_class_name = "CrossDeskClipboardMonitor";
+// sequence number of the last change made by SetContent
+DWORD g_own_clipboard_sequence = 0;
 #endif
 
 #ifdef __linux__
-Display* g_x11_display = nullptr;
-Atom g_clipboard_atom = None;
-Atom g_xfixes_selection_notify = None;
+std::mutex g_owner_changed_mutex;
+std::condition_variable g_owner_changed_cv;
+bool g_owner_changed = false;
 #endif
+
 }  // namespace crossdesk
 
 namespace crossdesk {
 
+uint64_t ClipboardContentHash(const ClipboardContent& content) {
+  std::vector<uint64_t> hashes;
+  hashes.reserve(content.size());
+  for (const ClipboardFormat& format : content) {
+    uint64_t seed = XXH3_64bits(format.mime_type.data(),
+                                format.mime_type.size());
+    hashes.push_back(format.data ? XXH3_64bits_withSeed(format.data->data(),
+                                                        format.data->size(),
+                                                        seed)
+                                 : seed);
+  }
+  std::sort(hashes.begin(), hashes.end());
+  return XXH3_64bits(hashes.data(), hashes.size() * sizeof(uint64_t));
+}
+
 #ifdef _WIN32
 std::string Clipboard::GetText() {
   if (!OpenClipboard(nullptr)) {
@@ -132,170 +158,393 @@ bool Clipboard::HasText() {
   return has_text;
 }
 
-#elif __APPLE__
-// macOS implementation is in clipboard_mac.mm
-#elif __linux__
+static UINT HtmlClipboardFormat() {
+  static UINT format = RegisterClipboardFormatA("HTML Format");
+  return format;
+}
 
-std::string Clipboard::GetText() {
-  Display* display = XOpenDisplay(nullptr);
-  if (display == nullptr) {
-    LOG_ERROR("Clipboard::GetText: failed to open X display");
+static UINT PngClipboardFormat() {
+  static UINT format = RegisterClipboardFormatA("PNG");
+  return format;
+}
+
+// expects the clipboard to be open
+static std::shared_ptr<const std::string> ReadClipboardBytes(UINT format) {
+  HANDLE handle = GetClipboardData(format);
+  if (handle == nullptr) {
+    return nullptr;
+  }
+  const char* bytes = static_cast<const char*>(GlobalLock(handle));
+  if (bytes == nullptr) {
+    return nullptr;
+  }
+  auto data = std::make_shared<const std::string>(bytes, GlobalSize(handle));
+  GlobalUnlock(handle);
+  return data;
+}
+
+// expects the clipboard to be open and emptied
+static bool WriteClipboardBytes(UINT format, const char* data, size_t size) {
+  HGLOBAL mem = GlobalAlloc(GMEM_MOVEABLE, size);
+  if (mem == nullptr) {
+    return false;
+  }
+  void* dst = GlobalLock(mem);
+  if (dst == nullptr) {
+    GlobalFree(mem);
+    return false;
+  }
+  memcpy(dst, data, size);
+  GlobalUnlock(mem);
+  if (SetClipboardData(format, mem) == nullptr) {
+    GlobalFree(mem);
+    return false;
+  }
+  return true;
+}
+
+static std::string WideToUtf8(const wchar_t* text) {
+  int size_needed =
+      WideCharToMultiByte(CP_UTF8, 0, text, -1, nullptr, 0, nullptr, nullptr);
+  if (size_needed <= 1) {
     return "";
   }
+  std::string result(size_needed - 1, '\0');
+  WideCharToMultiByte(CP_UTF8, 0, text, -1, &result[0], size_needed, nullptr,
+                      nullptr);
+  return result;
+}
 
-  std::string result;
-  Window owner = XGetSelectionOwner(display, XA_PRIMARY);
-  if (owner == None) {
-    // Try using CLIPBOARD
-    owner =
-        XGetSelectionOwner(display, XInternAtom(display, "CLIPBOARD", False));
-    if (owner == None) {
-      XCloseDisplay(display);
-      return "";
+static long CfHtmlOffset(const std::string& cf_html, const char* key) {
+  size_t pos = cf_html.find(key);
+  if (pos == std::string::npos) {
+    return -1;
+  }
+  return strtol(cf_html.c_str() + pos + strlen(key), nullptr, 10);
+}
+
+// CF_HTML carries byte offsets of the markup in a text header
+static std::string HtmlFromCfHtml(const std::string& cf_html) {
+  long start = CfHtmlOffset(cf_html, "StartHTML:");
+  long end = CfHtmlOffset(cf_html, "EndHTML:");
+  if (start < 0 || end <= start) {
+    start = CfHtmlOffset(cf_html, "StartFragment:");
+    end = CfHtmlOffset(cf_html, "EndFragment:");
+  }
+  if (start < 0 || end <= start || static_cast<size_t>(end) > cf_html.size()) {
+    return "";
+  }
+  return cf_html.substr(start, end - start);
+}
+
+static std::string CfHtmlFromHtml(const std::string& html) {
+  const char kHeader[] =
+      "Version:0.9\r\nStartHTML:%010zu\r\nEndHTML:%010zu\r\n"
+      "StartFragment:%010zu\r\nEndFragment:%010zu\r\n";
+  const std::string prefix = "<html><body>\r\n<!--StartFragment-->";
+  const std::string suffix = "<!--EndFragment-->\r\n</body></html>";
+
+  char header[160];
+  // the offsets are fixed width, so the header length does not depend on them
+  size_t header_size = static_cast<size_t>(
+      snprintf(header, sizeof(header), kHeader, size_t(0), size_t(0),
+               size_t(0), size_t(0)));
+  size_t start_fragment = header_size + prefix.size();
+  size_t end_fragment = start_fragment + html.size();
+  size_t end_html = end_fragment + suffix.size();
+  snprintf(header, sizeof(header), kHeader, header_size, end_html,
+           start_fragment, end_fragment);
+  return std::string(header, header_size) + prefix + html + suffix;
+}
+
+// a packed DIB as a .bmp file
+static std::string BmpFromDib(const std::string& dib) {
+  if (dib.size() < sizeof(BITMAPINFOHEADER)) {
+    return "";
+  }
+  BITMAPINFOHEADER info;
+  memcpy(&info, dib.data(), sizeof(info));
+  DWORD colors = info.biClrUsed;
+  if (colors == 0 && info.biBitCount <= 8) {
+    colors = 1u << info.biBitCount;
+  }
+  DWORD masks = info.biSize == sizeof(BITMAPINFOHEADER) &&
+                        info.biCompression == BI_BITFIELDS
+                    ? 3 * sizeof(DWORD)
+                    : 0;
+
+  BITMAPFILEHEADER file = {};
+  file.bfType = 0x4D42;  // 'BM'
+  file.bfSize = static_cast<DWORD>(sizeof(file) + dib.size());
+  file.bfOffBits = static_cast<DWORD>(sizeof(file) + info.biSize + masks +
+                                      colors * sizeof(RGBQUAD));
+  return std::string(reinterpret_cast<const char*>(&file), sizeof(file)) + dib;
+}
+
+static std::string FileUriFromPath(const std::string& path) {
+  static const char kHex[] = "0123456789ABCDEF";
+  std::string uri = "file:///";
+  for (unsigned char c : path) {
+    if (c == '\\') {
+      uri.push_back('/');
+    } else if (isalnum(c) || strchr("-._~/:", c)) {
+      uri.push_back(static_cast<char>(c));
+    } else {
+      uri.push_back('%');
+      uri.push_back(kHex[c >> 4]);
+      uri.push_back(kHex[c & 0x0F]);
     }
   }
+  return uri;
+}
 
-  Atom selection = XA_PRIMARY;
-  Atom target = XInternAtom(display, "UTF8_STRING", False);
-  if (target == None) {
-    target = XA_STRING;
-  }
-
-  XEvent event;
-  Window window = XCreateSimpleWindow(display, DefaultRootWindow(display), 0, 0,
-                                      1, 1, 0, 0, 0);
-  XSelectInput(display, window, PropertyChangeMask);
-
-  XConvertSelection(display, selection, target, XA_PRIMARY, window,
-                    CurrentTime);
-
-  // Wait for selection conversion to complete
-  bool done = false;
-  while (!done) {
-    XNextEvent(display, &event);
-    if (event.type == SelectionNotify) {
-      if (event.xselection.property == None) {
-        // Try using CLIPBOARD
-        if (selection == XA_PRIMARY) {
-          selection = XInternAtom(display, "CLIPBOARD", False);
-          XConvertSelection(display, selection, target, XA_PRIMARY, window,
-                            CurrentTime);
-          continue;
-        }
-        break;
-      }
+ClipboardContent Clipboard::GetContent() {
+  if (!OpenClipboard(nullptr)) {
+    LOG_ERROR("Clipboard::GetContent: failed to open clipboard");
+    return {};
+  }
+
+  ClipboardContent content;
+  HANDLE drop = GetClipboardData(CF_HDROP);
+  if (drop != nullptr) {
+    HDROP files = static_cast<HDROP>(drop);
+    UINT count = DragQueryFileW(files, 0xFFFFFFFF, nullptr, 0);
+    std::string uri_list;
+    for (UINT i = 0; i < count; ++i) {
+      UINT length = DragQueryFileW(files, i, nullptr, 0);
+      std::wstring path(length + 1, L'\0');
+      DragQueryFileW(files, i, &path[0], length + 1);
+      uri_list += FileUriFromPath(WideToUtf8(path.c_str())) + "\r\n";
+    }
+    if (!uri_list.empty()) {
+      content.push_back({kClipboardUriList,
+                         std::make_shared<const std::string>(uri_list)});
+    }
+  }
 
-      Atom actual_type;
-      int actual_format;
-      unsigned long nitems;
-      unsigned long bytes_after;
-      unsigned char* data = nullptr;
-
-      if (XGetWindowProperty(display, window, XA_PRIMARY, 0, LONG_MAX / 4,
-                             False, AnyPropertyType, &actual_type,
-                             &actual_format, &nitems, &bytes_after,
-                             &data) == Success) {
-        if (data != nullptr) {
-          result = std::string(reinterpret_cast<char*>(data), nitems);
-          XFree(data);
-        }
-        done = true;
+  // browsers put PNG next to the DIB, it keeps transparency
+  std::shared_ptr<const std::string> png =
+      ReadClipboardBytes(PngClipboardFormat());
+  if (png) {
+    content.push_back({kClipboardPng, png});
+  } else if (std::shared_ptr<const std::string> dib =
+                 ReadClipboardBytes(CF_DIB)) {
+    std::string bmp = BmpFromDib(*dib);
+    if (!bmp.empty()) {
+      content.push_back(
+          {kClipboardBmp, std::make_shared<const std::string>(bmp)});
+    }
+  }
+
+  if (std::shared_ptr<const std::string> cf_html =
+          ReadClipboardBytes(HtmlClipboardFormat())) {
+    std::string html = HtmlFromCfHtml(*cf_html);
+    if (!html.empty()) {
+      content.push_back(
+          {kClipboardHtml, std::make_shared<const std::string>(html)});
+    }
+  }
+
+  HANDLE text = GetClipboardData(CF_UNICODETEXT);
+  if (text != nullptr) {
+    const wchar_t* chars = static_cast<const wchar_t*>(GlobalLock(text));
+    if (chars != nullptr) {
+      std::string utf8 = WideToUtf8(chars);
+      GlobalUnlock(text);
+      if (!utf8.empty()) {
+        content.push_back(
+            {kClipboardText, std::make_shared<const std::string>(utf8)});
       }
     }
   }
 
-  XDestroyWindow(display, window);
-  XCloseDisplay(display);
-  return result;
+  CloseClipboard();
+  return content;
 }
 
-bool Clipboard::SetText(const std::string& text) {
-  Display* display = XOpenDisplay(nullptr);
-  if (display == nullptr) {
-    LOG_ERROR("Clipboard::SetText: failed to open X display");
+bool Clipboard::SetContent(const ClipboardContent& content) {
+  if (!OpenClipboard(nullptr)) {
+    LOG_ERROR("Clipboard::SetContent: failed to open clipboard");
     return false;
   }
-
-  Window window = XCreateSimpleWindow(display, DefaultRootWindow(display), 0, 0,
-                                      1, 1, 0, 0, 0);
-  Atom clipboard = XInternAtom(display, "CLIPBOARD", False);
-  Atom utf8_string = XInternAtom(display, "UTF8_STRING", False);
-  Atom targets = XInternAtom(display, "TARGETS", False);
-  Atom xa_string = XA_STRING;
-
-  XSetSelectionOwner(display, clipboard, window, CurrentTime);
-  if (XGetSelectionOwner(display, clipboard) != window) {
-    LOG_ERROR("Clipboard::SetText: failed to set selection owner");
-    XDestroyWindow(display, window);
-    XCloseDisplay(display);
+  if (!EmptyClipboard()) {
+    LOG_ERROR("Clipboard::SetContent: failed to empty clipboard");
+    CloseClipboard();
     return false;
   }
 
-  XChangeProperty(display, window, XA_PRIMARY, utf8_string, 8, PropModeReplace,
-                  reinterpret_cast<const unsigned char*>(text.c_str()),
-                  static_cast<int>(text.length()));
-
-  XEvent event;
-  while (true) {
-    XNextEvent(display, &event);
-    if (event.type == SelectionRequest) {
-      XSelectionRequestEvent* req = &event.xselectionrequest;
-      XSelectionEvent se;
-      se.type = SelectionNotify;
-      se.display = req->display;
-      se.requestor = req->requestor;
-      se.selection = req->selection;
-      se.time = req->time;
-      se.target = req->target;
-      se.property = req->property;
-
-      if (req->target == targets) {
-        // Return supported formats
-        Atom supported[] = {utf8_string, xa_string, targets};
-        XChangeProperty(display, req->requestor, req->property, XA_ATOM, 32,
-                        PropModeReplace,
-                        reinterpret_cast<unsigned char*>(supported), 3);
-        se.property = req->property;
-      } else if (req->target == utf8_string || req->target == xa_string) {
-        // Return text data
-        XChangeProperty(display, req->requestor, req->property, req->target, 8,
-                        PropModeReplace,
-                        reinterpret_cast<const unsigned char*>(text.c_str()),
-                        static_cast<int>(text.length()));
-        se.property = req->property;
+  bool ok = true;
+  bool has_dib = false;
+  for (const ClipboardFormat& format : content) {
+    if (!format.data) {
+      continue;
+    }
+    const std::string& data = *format.data;
+    if (format.mime_type == kClipboardText) {
+      int size_needed = MultiByteToWideChar(CP_UTF8, 0, data.data(),
+                                            static_cast<int>(data.size()),
+                                            nullptr, 0);
+      std::wstring wide(size_needed + 1, L'\0');
+      MultiByteToWideChar(CP_UTF8, 0, data.data(),
+                          static_cast<int>(data.size()), &wide[0],
+                          size_needed);
+      ok = WriteClipboardBytes(CF_UNICODETEXT,
+                               reinterpret_cast<const char*>(wide.data()),
+                               wide.size() * sizeof(wchar_t)) &&
+           ok;
+    } else if (format.mime_type == kClipboardHtml) {
+      std::string cf_html = CfHtmlFromHtml(data);
+      ok = WriteClipboardBytes(HtmlClipboardFormat(), cf_html.c_str(),
+                               cf_html.size() + 1) &&
+           ok;
+    } else if (format.mime_type == kClipboardPng ||
+               format.mime_type == kClipboardBmp) {
+      std::string bmp;
+      if (format.mime_type == kClipboardPng) {
+        ok = WriteClipboardBytes(PngClipboardFormat(), data.data(),
+                                 data.size()) &&
+             ok;
+        ClipboardPngToBmp(data, &bmp);
       } else {
-        se.property = None;
+        bmp = data;
+      }
+      // most applications only paste DIBs
+      if (!has_dib && bmp.size() > sizeof(BITMAPFILEHEADER)) {
+        has_dib = WriteClipboardBytes(CF_DIB,
+                                      bmp.data() + sizeof(BITMAPFILEHEADER),
+                                      bmp.size() - sizeof(BITMAPFILEHEADER));
       }
-
-      XSendEvent(display, req->requestor, False, 0,
-                 reinterpret_cast<XEvent*>(&se));
-      XSync(display, False);
-    } else if (event.type == SelectionClear) {
-      break;
     }
   }
 
-  XDestroyWindow(display, window);
-  XCloseDisplay(display);
+  CloseClipboard();
+  g_own_clipboard_sequence = GetClipboardSequenceNumber();
+  {
+    std::lock_guard<std::mutex> lock(g_monitor_mutex);
+    g_last_clipboard_hash = ClipboardContentHash(content);
+  }
+  if (!ok) {
+    LOG_ERROR("Clipboard::SetContent: failed to set clipboard data");
+  }
+  return ok;
+}
+
+bool Clipboard::CanOfferLazily() { return false; }
+
+bool Clipboard::OfferContent(const std::vector<std::string>& mime_types,
+                             Fetch fetch) {
+  return false;
+}
+
+static bool IsOwnClipboardChange() {
+  return GetClipboardSequenceNumber() == g_own_clipboard_sequence;
+}
+
+#elif __APPLE__
+// macOS implementation is in clipboard_mac.mm
+extern bool IsOwnClipboardChange();
+#elif __linux__
+
+std::string Clipboard::GetText() {
+  if (!X11Clipboard::Instance().Start()) {
+    LOG_ERROR("Clipboard::GetText: failed to open X display");
+    return "";
+  }
+  return X11Clipboard::Instance().GetText();
+}
+
+bool Clipboard::SetText(const std::string& text) {
+  if (!X11Clipboard::Instance().Start()) {
+    LOG_ERROR("Clipboard::SetText: failed to open X display");
+    return false;
+  }
+  if (!X11Clipboard::Instance().SetText(text)) {
+    LOG_ERROR("Clipboard::SetText: failed to set selection owner");
+    return false;
+  }
   return true;
 }
 
 bool Clipboard::HasText() {
-  Display* display = XOpenDisplay(nullptr);
-  if (display == nullptr) {
+  if (!X11Clipboard::Instance().Start()) {
     return false;
   }
+  return X11Clipboard::Instance().HasOwner();
+}
 
-  Atom clipboard = XInternAtom(display, "CLIPBOARD", False);
-  Window owner = XGetSelectionOwner(display, clipboard);
-  if (owner == None) {
-    owner = XGetSelectionOwner(display, XA_PRIMARY);
+ClipboardContent Clipboard::GetContent() {
+  X11Clipboard& clipboard = X11Clipboard::Instance();
+  if (!clipboard.Start()) {
+    LOG_ERROR("Clipboard::GetContent: failed to open X display");
+    return {};
   }
 
-  XCloseDisplay(display);
-  return owner != None;
+  std::vector<std::string> targets = clipboard.GetTargets();
+  auto offers = [&targets](const char* target) {
+    return std::find(targets.begin(), targets.end(), target) != targets.end();
+  };
+
+  ClipboardContent content;
+  auto add = [&](const char* mime_type, const char* target) {
+    X11Clipboard::Data data = clipboard.GetData(target);
+    if (data && !data->empty()) {
+      content.push_back({mime_type, data});
+    }
+  };
+  if (offers(kClipboardUriList)) {
+    add(kClipboardUriList, kClipboardUriList);
+  }
+  if (offers(kClipboardPng)) {
+    add(kClipboardPng, kClipboardPng);
+  } else if (offers(kClipboardBmp)) {
+    add(kClipboardBmp, kClipboardBmp);
+  }
+  if (offers(kClipboardHtml)) {
+    add(kClipboardHtml, kClipboardHtml);
+  }
+  // owners without TARGETS may still convert to text
+  if (targets.empty() || offers("UTF8_STRING") || offers("STRING")) {
+    add(kClipboardText, "UTF8_STRING");
+  }
+  return content;
+}
+
+bool Clipboard::SetContent(const ClipboardContent& content) {
+  auto formats = std::make_shared<const ClipboardContent>(content);
+  std::vector<std::string> mime_types;
+  for (const ClipboardFormat& format : content) {
+    mime_types.push_back(format.mime_type);
+  }
+  return OfferContent(
+      mime_types, [formats](const std::string& mime_type, FetchDone done) {
+        for (const ClipboardFormat& format : *formats) {
+          if (format.mime_type == mime_type) {
+            done(format.data);
+            return;
+          }
+        }
+        done(nullptr);
+      });
 }
 
+bool Clipboard::CanOfferLazily() { return true; }
+
+bool Clipboard::OfferContent(const std::vector<std::string>& mime_types,
+                             Fetch fetch) {
+  if (!X11Clipboard::Instance().Start()) {
+    LOG_ERROR("Clipboard::OfferContent: failed to open X display");
+    return false;
+  }
+  if (!X11Clipboard::Instance().Offer(mime_types, std::move(fetch))) {
+    LOG_ERROR("Clipboard::OfferContent: failed to set selection owner");
+    return false;
+  }
+  return true;
+}
+
+// the owner answers for itself, the monitor only follows other clients
+static bool IsOwnClipboardChange() { return X11Clipboard::Instance().IsOwner(); }
+
 #else
 
 std::string Clipboard::GetText() {
@@ -313,34 +562,49 @@ bool Clipboard::HasText() {
   return false;
 }
 
+ClipboardContent Clipboard::GetContent() {
+  LOG_ERROR("Clipboard::GetContent: unsupported platform");
+  return {};
+}
+
+bool Clipboard::SetContent(const ClipboardContent& content) {
+  LOG_ERROR("Clipboard::SetContent: unsupported platform");
+  return false;
+}
+
+bool Clipboard::CanOfferLazily() { return false; }
+
+bool Clipboard::OfferContent(const std::vector<std::string>& mime_types,
+                             Fetch fetch) {
+  return false;
+}
+
+static bool IsOwnClipboardChange() { return false; }
+
 #endif
 
 void HandleClipboardChange() {
-  if (!Clipboard::HasText()) {
-    std::lock_guard<std::mutex> lock(g_monitor_mutex);
-    if (!g_last_clipboard_text.empty()) {
-      g_last_clipboard_text.clear();
-      LOG_INFO("Clipboard content cleared");
-    }
+  if (IsOwnClipboardChange()) {
     return;
   }
 
-  std::string current_text = Clipboard::GetText();
+  ClipboardContent content = Clipboard::GetContent();
+  uint64_t hash = content.empty() ? 0 : ClipboardContentHash(content);
 
   // Check if the content has changed
-  {
-    std::lock_guard<std::mutex> lock(g_monitor_mutex);
-    if (current_text != g_last_clipboard_text) {
-      g_last_clipboard_text = current_text;
-      if (!current_text.empty()) {
-        if (g_on_clipboard_changed) {
-          int ret = g_on_clipboard_changed(current_text.c_str(),
-                                           current_text.length());
-          if (ret != 0) {
-            LOG_WARN("Clipboard callback returned error: {}", ret);
-          }
-        }
-      }
+  std::lock_guard<std::mutex> lock(g_monitor_mutex);
+  if (hash == g_last_clipboard_hash) {
+    return;
+  }
+  g_last_clipboard_hash = hash;
+  if (content.empty()) {
+    LOG_INFO("Clipboard content cleared");
+    return;
+  }
+  if (g_on_clipboard_changed) {
+    int ret = g_on_clipboard_changed(content);
+    if (ret != 0) {
+      LOG_WARN("Clipboard callback returned error: {}", ret);
     }
   }
 }
@@ -409,60 +673,44 @@ static void MonitorThreadFunc() { StartMacOSClipboardMonitoring(); }
 
 #elif __linux__
 static void MonitorThreadFunc() {
-  g_x11_display = XOpenDisplay(nullptr);
-  if (!g_x11_display) {
+  X11Clipboard& clipboard = X11Clipboard::Instance();
+  if (!clipboard.Start()) {
     LOG_ERROR("Failed to open X display for clipboard monitoring");
     g_monitoring.store(false);
     return;
   }
 
-  // Check if XFixes extension is available
-  int event_base, error_base;
-  if (!XFixesQueryExtension(g_x11_display, &event_base, &error_base)) {
+  bool events = clipboard.HasChangeEvents();
+  if (events) {
+    // only wakes this thread, reading the new content blocks on the
+    // clipboard thread
+    clipboard.SetOnOwnerChanged([]() {
+      std::lock_guard<std::mutex> lock(g_owner_changed_mutex);
+      g_owner_changed = true;
+      g_owner_changed_cv.notify_one();
+    });
+    LOG_INFO("Clipboard event monitoring started (Linux XFixes)");
+  } else {
     LOG_WARN("XFixes extension not available, falling back to polling");
-    XCloseDisplay(g_x11_display);
-    g_x11_display = nullptr;
-    // fallback to polling mode
-    while (g_monitoring.load()) {
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(g_check_interval_ms));
-      if (!g_monitoring.load()) {
-        break;
-      }
-      HandleClipboardChange();
-    }
-    return;
   }
 
-  g_clipboard_atom = XInternAtom(g_x11_display, "CLIPBOARD", False);
-  g_xfixes_selection_notify =
-      XInternAtom(g_x11_display, "XFIXES_SELECTION_NOTIFY", False);
-
-  // Create event window
-  Window root = DefaultRootWindow(g_x11_display);
-  Window event_window =
-      XCreateSimpleWindow(g_x11_display, root, 0, 0, 1, 1, 0, 0, 0);
-
-  // Select events to monitor
-  XFixesSelectSelectionInput(g_x11_display, event_window, g_clipboard_atom,
-                             XFixesSetSelectionOwnerNotifyMask |
-                                 XFixesSelectionWindowDestroyNotifyMask |
-                                 XFixesSelectionClientCloseNotifyMask);
-
-  LOG_INFO("Clipboard event monitoring started (Linux XFixes)");
-
-  XEvent event;
   while (g_monitoring.load()) {
-    XNextEvent(g_x11_display, &event);
-    if (event.type == event_base + XFixesSelectionNotify) {
-      HandleClipboardChange();
+    if (events) {
+      std::unique_lock<std::mutex> lock(g_owner_changed_mutex);
+      g_owner_changed_cv.wait(lock, []() {
+        return g_owner_changed || !g_monitoring.load();
+      });
+      g_owner_changed = false;
+    } else {
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(g_check_interval_ms));
     }
+    if (!g_monitoring.load()) {
+      break;
+    }
+    HandleClipboardChange();
   }
-
-  XFixesSelectSelectionInput(g_x11_display, event_window, g_clipboard_atom, 0);
-  XDestroyWindow(g_x11_display, event_window);
-  XCloseDisplay(g_x11_display);
-  g_x11_display = nullptr;
+  clipboard.SetOnOwnerChanged(nullptr);
 }
 
 #else
@@ -489,11 +737,9 @@ void Clipboard::StartMonitoring(int check_interval_ms,
   {
     std::lock_guard<std::mutex> lock(g_monitor_mutex);
     g_on_clipboard_changed = on_changed;
-    if (HasText()) {
-      g_last_clipboard_text = GetText();
-    } else {
-      g_last_clipboard_text.clear();
-    }
+    ClipboardContent content = GetContent();
+    g_last_clipboard_hash =
+        content.empty() ? 0 : ClipboardContentHash(content);
   }
   g_monitoring.store(true);
 
@@ -514,6 +760,11 @@ void Clipboard::StopMonitoring() {
   }
 #elif __APPLE__
   StopMacOSClipboardMonitoring();
+#elif __linux__
+  {
+    std::lock_guard<std::mutex> lock(g_owner_changed_mutex);
+    g_owner_changed_cv.notify_one();
+  }
 #endif
 
   if (g_monitor_thread.joinable()) {
@@ -522,7 +773,7 @@ void Clipboard::StopMonitoring() {
 
   {
     std::lock_guard<std::mutex> lock(g_monitor_mutex);
-    g_last_clipboard_text.clear();
+    g_last_clipboard_hash = 0;
     g_on_clipboard_changed = nullptr;
   }
 
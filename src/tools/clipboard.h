@@ -7,14 +7,38 @@
 #ifndef _CLIPBOARD_H_
 #define _CLIPBOARD_H_
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace crossdesk {
 
+// mime types exchanged between peers, platform formats are mapped to these
+constexpr char kClipboardText[] = "text/plain;charset=utf-8";
+constexpr char kClipboardHtml[] = "text/html";
+constexpr char kClipboardPng[] = "image/png";
+constexpr char kClipboardBmp[] = "image/bmp";
+constexpr char kClipboardUriList[] = "text/uri-list";
+
+struct ClipboardFormat {
+  std::string mime_type;
+  std::shared_ptr<const std::string> data;
+};
+
+// the formats of one copy, best first
+using ClipboardContent = std::vector<ClipboardFormat>;
+
+// hash over mime types and data, independent of the format order
+uint64_t ClipboardContentHash(const ClipboardContent& content);
+
 class Clipboard {
  public:
-  using OnClipboardChanged = std::function<int(const char* data, size_t size)>;
+  using OnClipboardChanged = std::function<int(const ClipboardContent&)>;
+  using FetchDone = std::function<void(std::shared_ptr<const std::string>)>;
+  using Fetch =
+      std::function<void(const std::string& mime_type, FetchDone done)>;
 
   Clipboard() = default;
   ~Clipboard() = default;
@@ -25,6 +49,20 @@ class Clipboard {
 
   static bool HasText();
 
+  // every supported format the clipboard currently holds
+  static ClipboardContent GetContent();
+
+  static bool SetContent(const ClipboardContent& content);
+
+  // true where the platform can announce formats and fetch their data only
+  // when an application pastes them
+  static bool CanOfferLazily();
+
+  // takes the clipboard announcing `mime_types`, `fetch` is called on paste.
+  // Fails where CanOfferLazily() is false.
+  static bool OfferContent(const std::vector<std::string>& mime_types,
+                           Fetch fetch);
+
   static void StartMonitoring(int check_interval_ms = 100,
                               OnClipboardChanged on_changed = nullptr);
 
@@ -0,0 +1,61 @@
+#include "clipboard_image.h"
+
+#include "rd_log.h"
+
+// private copies, the thumbnail target owns the exported ones
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+namespace crossdesk {
+
+namespace {
+void AppendToString(void* context, void* data, int size) {
+  static_cast<std::string*>(context)->append(static_cast<const char*>(data),
+                                             static_cast<size_t>(size));
+}
+
+// decodes and re-encodes through `write`, keeping the channel count
+template <typename WriteFunc>
+bool Transcode(const std::string& in, std::string* out, WriteFunc write) {
+  int width = 0;
+  int height = 0;
+  int channels = 0;
+  stbi_uc* pixels = stbi_load_from_memory(
+      reinterpret_cast<const stbi_uc*>(in.data()), static_cast<int>(in.size()),
+      &width, &height, &channels, 0);
+  if (!pixels) {
+    LOG_ERROR("Clipboard image: failed to decode [{}]", stbi_failure_reason());
+    return false;
+  }
+
+  out->clear();
+  bool ok = write(out, width, height, channels, pixels) != 0;
+  stbi_image_free(pixels);
+  return ok && !out->empty();
+}
+}  // namespace
+
+bool ClipboardBmpToPng(const std::string& bmp, std::string* png) {
+  return Transcode(bmp, png,
+                   [](std::string* out, int width, int height, int channels,
+                      const stbi_uc* pixels) {
+                     return stbi_write_png_to_func(AppendToString, out, width,
+                                                   height, channels, pixels,
+                                                   width * channels);
+                   });
+}
+
+bool ClipboardPngToBmp(const std::string& png, std::string* bmp) {
+  return Transcode(png, bmp,
+                   [](std::string* out, int width, int height, int channels,
+                      const stbi_uc* pixels) {
+                     return stbi_write_bmp_to_func(AppendToString, out, width,
+                                                   height, channels, pixels);
+                   });
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,22 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _CLIPBOARD_IMAGE_H_
+#define _CLIPBOARD_IMAGE_H_
+
+#include <string>
+
+namespace crossdesk {
+
+// clipboard images cross the network as PNG, Windows keeps them as DIBs.
+// `bmp` is a complete .bmp file, a DIB is the same without its 14 byte file
+// header.
+bool ClipboardBmpToPng(const std::string& bmp, std::string* png);
+bool ClipboardPngToBmp(const std::string& png, std::string* bmp);
+
+}  // namespace crossdesk
+
+#endif
@@ -19,10 +19,36 @@ namespace crossdesk {
 
 extern std::atomic<bool> g_monitoring;
 extern std::mutex g_monitor_mutex;
-extern std::string g_last_clipboard_text;
+extern uint64_t g_last_clipboard_hash;
 extern Clipboard::OnClipboardChanged g_on_clipboard_changed;
 
 static CFRunLoopRef g_monitor_runloop = nullptr;
+// changeCount after the last SetContent
+static std::atomic<NSInteger> g_own_change_count{-1};
+
+static std::shared_ptr<const std::string> BytesFromData(NSData* data) {
+  if (data == nil || data.length == 0) {
+    return nullptr;
+  }
+  return std::make_shared<const std::string>(
+      static_cast<const char*>(data.bytes), data.length);
+}
+
+static std::shared_ptr<const std::string> BytesFromString(NSString* string) {
+  if (string == nil || string.length == 0) {
+    return nullptr;
+  }
+  return std::make_shared<const std::string>([string UTF8String]);
+}
+
+static NSData* PngFromImageData(NSData* data) {
+  NSBitmapImageRep* image = [NSBitmapImageRep imageRepWithData:data];
+  if (image == nil) {
+    return nil;
+  }
+  return [image representationUsingType:NSBitmapImageFileTypePNG
+                             properties:@{}];
+}
 
 std::string Clipboard::GetText() {
   @autoreleasepool {
@@ -57,6 +83,104 @@ bool Clipboard::HasText() {
   }
 }
 
+ClipboardContent Clipboard::GetContent() {
+  @autoreleasepool {
+    NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+    ClipboardContent content;
+
+    NSArray<NSURL*>* urls =
+        [pasteboard readObjectsForClasses:@[ [NSURL class] ]
+                                  options:@{
+                                    NSPasteboardURLReadingFileURLsOnlyKey : @YES
+                                  }];
+    if (urls.count > 0) {
+      std::string uri_list;
+      for (NSURL* url in urls) {
+        uri_list += [[url absoluteString] UTF8String];
+        uri_list += "\r\n";
+      }
+      content.push_back({kClipboardUriList,
+                         std::make_shared<const std::string>(uri_list)});
+    }
+
+    NSData* png = [pasteboard dataForType:NSPasteboardTypePNG];
+    if (png == nil) {
+      // screenshots and most native applications copy TIFF
+      NSData* tiff = [pasteboard dataForType:NSPasteboardTypeTIFF];
+      png = tiff != nil ? PngFromImageData(tiff) : nil;
+    }
+    if (auto data = BytesFromData(png)) {
+      content.push_back({kClipboardPng, data});
+    }
+
+    if (auto data = BytesFromString(
+            [pasteboard stringForType:NSPasteboardTypeHTML])) {
+      content.push_back({kClipboardHtml, data});
+    }
+    if (auto data = BytesFromString(
+            [pasteboard stringForType:NSPasteboardTypeString])) {
+      content.push_back({kClipboardText, data});
+    }
+    return content;
+  }
+}
+
+bool Clipboard::SetContent(const ClipboardContent& content) {
+  @autoreleasepool {
+    NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+    [pasteboard clearContents];
+
+    bool ok = true;
+    for (const ClipboardFormat& format : content) {
+      if (!format.data) {
+        continue;
+      }
+      NSData* data = [NSData dataWithBytes:format.data->data()
+                                    length:format.data->size()];
+      if (format.mime_type == kClipboardText ||
+          format.mime_type == kClipboardHtml) {
+        NSString* string = [[NSString alloc] initWithData:data
+                                                 encoding:NSUTF8StringEncoding];
+        NSPasteboardType type = format.mime_type == kClipboardText
+                                    ? NSPasteboardTypeString
+                                    : NSPasteboardTypeHTML;
+        ok = string != nil && [pasteboard setString:string forType:type] && ok;
+      } else if (format.mime_type == kClipboardPng ||
+                 format.mime_type == kClipboardBmp) {
+        NSData* png = format.mime_type == kClipboardPng
+                          ? data
+                          : PngFromImageData(data);
+        ok = png != nil && [pasteboard setData:png
+                                       forType:NSPasteboardTypePNG] &&
+             ok;
+      }
+    }
+
+    g_own_change_count = [pasteboard changeCount];
+    {
+      std::lock_guard<std::mutex> lock(g_monitor_mutex);
+      g_last_clipboard_hash = ClipboardContentHash(content);
+    }
+    if (!ok) {
+      LOG_ERROR("Clipboard::SetContent: failed to set pasteboard data");
+    }
+    return ok;
+  }
+}
+
+bool Clipboard::CanOfferLazily() { return false; }
+
+bool Clipboard::OfferContent(const std::vector<std::string>& mime_types,
+                             Fetch fetch) {
+  return false;
+}
+
+bool IsOwnClipboardChange() {
+  @autoreleasepool {
+    return [[NSPasteboard generalPasteboard] changeCount] == g_own_change_count;
+  }
+}
+
 extern void HandleClipboardChange();
 
 void StartMacOSClipboardMonitoring() {
@@ -0,0 +1,653 @@
+#include "clipboard_sync.h"
+
+#include <lz4.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "clipboard_image.h"
+#include "rd_log.h"
+
+namespace crossdesk {
+
+namespace {
+std::atomic<uint32_t> g_next_item_id{1};
+
+// formats above this are not offered at all
+constexpr uint64_t kMaxFormatSize = 256ull * 1024 * 1024;
+// data of one announcement, formats past it are requested
+constexpr size_t kInlineBudget = 64 * 1024;
+constexpr size_t kChunkSize = 64 * 1024;
+// chunks smaller than this are not worth a codec round trip.
+constexpr size_t kMinCompressSize = 4 * 1024;
+// keep the compressed form only when it saves at least this much.
+constexpr double kMaxCompressRatio = 0.9;
+
+bool IsCompressed(const std::string& mime_type) {
+  return mime_type == kClipboardPng;
+}
+
+// compress `data` into `out`, return false when it is not worth sending the
+// encoded form.
+bool CompressPayload(const char* data, size_t data_size, std::string& out) {
+  if (data_size < kMinCompressSize) {
+    return false;
+  }
+
+  int bound = LZ4_compressBound(static_cast<int>(data_size));
+  out.resize(static_cast<size_t>(bound));
+  int encoded_size = LZ4_compress_default(
+      data, &out[0], static_cast<int>(data_size), bound);
+  if (encoded_size <= 0 || encoded_size > data_size * kMaxCompressRatio) {
+    return false;
+  }
+
+  out.resize(static_cast<size_t>(encoded_size));
+  return true;
+}
+
+bool DecompressPayload(const char* payload, size_t payload_size,
+                       size_t raw_size, std::string& out) {
+  size_t start = out.size();
+  out.resize(start + raw_size);
+  int decoded = LZ4_decompress_safe(payload, &out[start],
+                                    static_cast<int>(payload_size),
+                                    static_cast<int>(raw_size));
+  if (decoded < 0 || static_cast<size_t>(decoded) != raw_size) {
+    out.resize(start);
+    return false;
+  }
+  return true;
+}
+
+int HexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// the remote paths of a file list as text, the files themselves only exist
+// on the other side
+std::string PathsFromUriList(const std::string& uri_list) {
+  std::string text;
+  size_t begin = 0;
+  while (begin < uri_list.size()) {
+    size_t end = uri_list.find('\n', begin);
+    if (end == std::string::npos) {
+      end = uri_list.size();
+    }
+    std::string line = uri_list.substr(begin, end - begin);
+    begin = end + 1;
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    const char kScheme[] = "file://";
+    if (line.compare(0, sizeof(kScheme) - 1, kScheme) == 0) {
+      size_t path = line.find('/', sizeof(kScheme) - 1);
+      line = path == std::string::npos ? "" : line.substr(path);
+      // file:///C:/dir keeps no leading slash before the drive
+      if (line.size() > 2 && line[2] == ':') {
+        line.erase(0, 1);
+      }
+    }
+    std::string decoded;
+    for (size_t i = 0; i < line.size(); ++i) {
+      if (line[i] == '%' && i + 2 < line.size() &&
+          HexValue(line[i + 1]) >= 0 && HexValue(line[i + 2]) >= 0) {
+        decoded.push_back(
+            static_cast<char>(HexValue(line[i + 1]) * 16 + HexValue(line[i + 2])));
+        i += 2;
+      } else {
+        decoded.push_back(line[i]);
+      }
+    }
+
+    if (!text.empty()) {
+      text += "\n";
+    }
+    text += decoded;
+  }
+  return text;
+}
+
+// what goes on the wire: images as PNG, nothing oversized
+ClipboardContent PrepareContent(const ClipboardContent& content) {
+  bool has_png = std::any_of(
+      content.begin(), content.end(),
+      [](const ClipboardFormat& format) {
+        return format.mime_type == kClipboardPng;
+      });
+
+  ClipboardContent prepared;
+  for (const ClipboardFormat& format : content) {
+    if (!format.data || format.data->empty()) {
+      continue;
+    }
+    if (format.data->size() > kMaxFormatSize) {
+      LOG_WARN("Clipboard: {} of {} bytes is too large to share",
+               format.mime_type, format.data->size());
+      continue;
+    }
+    if (format.mime_type == kClipboardBmp) {
+      std::string png;
+      if (!has_png && ClipboardBmpToPng(*format.data, &png)) {
+        prepared.push_back({kClipboardPng, std::make_shared<const std::string>(
+                                               std::move(png))});
+        has_png = true;
+      }
+      continue;
+    }
+    prepared.push_back(format);
+    if (prepared.size() == UINT8_MAX) {
+      break;
+    }
+  }
+  return prepared;
+}
+}  // namespace
+
+ClipboardSync::ClipboardSync(SendFunc send) : send_(std::move(send)) {}
+
+ClipboardSync::~ClipboardSync() {
+  std::unordered_map<std::string, std::shared_ptr<Incoming>> incoming;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    incoming.swap(incoming_);
+  }
+  cv_.notify_all();
+  if (streamer_.joinable()) {
+    streamer_.join();
+  }
+
+  // an offered copy may still be pasted, it gets nothing from now on
+  for (auto& [source, item] : incoming) {
+    std::vector<Clipboard::FetchDone> waiters;
+    {
+      std::lock_guard<std::mutex> lock(item->mutex);
+      item->closed = true;
+      item->send = nullptr;
+      for (IncomingFormat& format : item->formats) {
+        waiters.insert(waiters.end(), format.waiters.begin(),
+                       format.waiters.end());
+        format.waiters.clear();
+      }
+    }
+    for (auto& done : waiters) {
+      done(nullptr);
+    }
+  }
+}
+
+int ClipboardSync::Announce(const ClipboardContent& content) {
+  ClipboardContent prepared = PrepareContent(content);
+  if (prepared.empty()) {
+    return 0;
+  }
+  uint64_t content_hash = ClipboardContentHash(prepared);
+
+  auto outgoing = std::make_shared<Outgoing>();
+  outgoing->item_id = g_next_item_id.fetch_add(1);
+  outgoing->content = prepared;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (content_hash == last_announced_hash_ ||
+        content_hash == last_applied_hash_) {
+      return 0;
+    }
+    last_announced_hash_ = content_hash;
+    // requests for the previous copy are answered with kClipboardGone
+    outgoing_ = outgoing;
+  }
+
+  ClipboardAnnounceHeader header{};
+  header.magic = kClipboardAnnounceMagic;
+  header.item_id = outgoing->item_id;
+  header.content_hash = content_hash;
+  header.format_count = static_cast<uint8_t>(prepared.size());
+
+  std::string message(reinterpret_cast<const char*>(&header), sizeof(header));
+  size_t budget = kInlineBudget;
+  for (const ClipboardFormat& format : prepared) {
+    const std::string& data = *format.data;
+    ClipboardFormatEntry entry{};
+    entry.size = data.size();
+    entry.hash = XXH3_64bits(data.data(), data.size());
+    entry.mime_len = static_cast<uint16_t>(format.mime_type.size());
+
+    std::string compressed;
+    const std::string* payload = &data;
+    if (data.size() <= budget * 4 && !IsCompressed(format.mime_type) &&
+        CompressPayload(data.data(), data.size(), compressed)) {
+      payload = &compressed;
+      entry.flags |= kClipboardLz4;
+    }
+    if (payload->size() <= budget) {
+      entry.payload_size = static_cast<uint32_t>(payload->size());
+      budget -= payload->size();
+    } else {
+      entry.flags = 0;
+    }
+
+    message.append(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    message.append(format.mime_type);
+    if (entry.payload_size > 0) {
+      message.append(*payload);
+    }
+  }
+
+  LOG_INFO("Clipboard: announce item {} with {} formats, {} bytes inline",
+           header.item_id, prepared.size(), kInlineBudget - budget);
+  return send_(SendPriority::Interactive, message.data(), message.size());
+}
+
+void ClipboardSync::OnData(const std::string& source, const char* data,
+                           size_t size) {
+  if (!data || size == 0) {
+    return;
+  }
+
+  uint32_t magic = 0;
+  if (size >= sizeof(magic)) {
+    memcpy(&magic, data, sizeof(magic));
+  }
+  if (magic == kClipboardAnnounceMagic) {
+    OnAnnounce(source, data, size);
+  } else if (magic == kClipboardRequestMagic &&
+             size >= sizeof(ClipboardRequest)) {
+    ClipboardRequest request;
+    memcpy(&request, data, sizeof(request));
+    OnRequest(request);
+  } else if (magic == kClipboardChunkMagic) {
+    OnChunk(source, data, size);
+  } else {
+    // peers before the announce protocol send the text as is
+    ClipboardContent content = {
+        {kClipboardText, std::make_shared<const std::string>(data, size)}};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      last_applied_hash_ = ClipboardContentHash(content);
+    }
+    if (!Clipboard::SetContent(content)) {
+      LOG_ERROR("Failed to set clipboard content from remote");
+    }
+  }
+}
+
+void ClipboardSync::OnAnnounce(const std::string& source, const char* data,
+                               size_t size) {
+  if (size < sizeof(ClipboardAnnounceHeader)) {
+    return;
+  }
+  ClipboardAnnounceHeader header;
+  memcpy(&header, data, sizeof(header));
+
+  auto incoming = std::make_shared<Incoming>();
+  incoming->send = send_;
+  incoming->item_id = header.item_id;
+  incoming->content_hash = header.content_hash;
+
+  size_t pos = sizeof(header);
+  for (uint8_t i = 0; i < header.format_count; ++i) {
+    ClipboardFormatEntry entry;
+    if (size - pos < sizeof(entry)) {
+      LOG_ERROR("Clipboard: truncated announcement");
+      return;
+    }
+    memcpy(&entry, data + pos, sizeof(entry));
+    pos += sizeof(entry);
+    if (size - pos < static_cast<size_t>(entry.mime_len) + entry.payload_size ||
+        entry.size > kMaxFormatSize) {
+      LOG_ERROR("Clipboard: malformed announcement");
+      return;
+    }
+
+    IncomingFormat format;
+    format.mime_type.assign(data + pos, entry.mime_len);
+    pos += entry.mime_len;
+    format.size = entry.size;
+    format.hash = entry.hash;
+    if (entry.payload_size > 0) {
+      bool decoded =
+          (entry.flags & kClipboardLz4)
+              ? DecompressPayload(data + pos, entry.payload_size, entry.size,
+                                  format.data)
+              : (format.data.assign(data + pos, entry.payload_size), true);
+      if (!decoded || format.data.size() != entry.size ||
+          XXH3_64bits(format.data.data(), format.data.size()) != entry.hash) {
+        LOG_ERROR("Clipboard: damaged inline {}", format.mime_type);
+        return;
+      }
+      format.complete = true;
+      pos += entry.payload_size;
+    }
+    incoming->formats.push_back(std::move(format));
+  }
+
+  std::shared_ptr<Incoming> replaced;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // our own copy coming back, or the same copy again
+    if (header.content_hash == last_announced_hash_ ||
+        header.content_hash == last_applied_hash_) {
+      return;
+    }
+    last_applied_hash_ = header.content_hash;
+    replaced = incoming_[source];
+    incoming_[source] = incoming;
+  }
+  if (replaced) {
+    std::lock_guard<std::mutex> lock(replaced->mutex);
+    replaced->closed = true;
+  }
+
+  Apply(incoming);
+}
+
+void ClipboardSync::Apply(const std::shared_ptr<Incoming>& incoming) {
+  std::vector<std::string> mime_types;
+  {
+    std::lock_guard<std::mutex> lock(incoming->mutex);
+    std::vector<IncomingFormat>& formats = incoming->formats;
+    auto uri_list = std::find_if(
+        formats.begin(), formats.end(), [](const IncomingFormat& format) {
+          return format.mime_type == kClipboardUriList;
+        });
+    bool has_text = std::any_of(
+        formats.begin(), formats.end(), [](const IncomingFormat& format) {
+          return format.mime_type == kClipboardText;
+        });
+    if (uri_list != formats.end()) {
+      if (!has_text && uri_list->complete) {
+        IncomingFormat text;
+        text.mime_type = kClipboardText;
+        text.data = PathsFromUriList(uri_list->data);
+        text.size = text.data.size();
+        text.complete = true;
+        formats.push_back(std::move(text));
+      }
+      // never requested, local file managers would look for remote paths
+      uri_list = std::find_if(
+          formats.begin(), formats.end(), [](const IncomingFormat& format) {
+            return format.mime_type == kClipboardUriList;
+          });
+      formats.erase(uri_list);
+    }
+
+    for (const IncomingFormat& format : formats) {
+      mime_types.push_back(format.mime_type);
+    }
+  }
+  if (mime_types.empty()) {
+    return;
+  }
+
+  if (Clipboard::CanOfferLazily()) {
+    std::weak_ptr<Incoming> weak_incoming = incoming;
+    bool offered = Clipboard::OfferContent(
+        mime_types, [weak_incoming](const std::string& mime_type,
+                                    Clipboard::FetchDone done) {
+          std::shared_ptr<Incoming> item = weak_incoming.lock();
+          if (!item) {
+            done(nullptr);
+            return;
+          }
+          std::shared_ptr<const std::string> data;
+          {
+            std::lock_guard<std::mutex> lock(item->mutex);
+            auto format = std::find_if(
+                item->formats.begin(), item->formats.end(),
+                [&](const IncomingFormat& f) { return f.mime_type == mime_type; });
+            if (item->closed || format == item->formats.end()) {
+              data = nullptr;
+            } else if (format->complete) {
+              data = FormatData(*format);
+            } else {
+              format->waiters.push_back(std::move(done));
+              Request(*item,
+                      static_cast<uint8_t>(format - item->formats.begin()));
+              return;
+            }
+          }
+          done(data);
+        });
+    if (!offered) {
+      LOG_ERROR("Failed to offer clipboard content from remote");
+    }
+    return;
+  }
+
+  // everything has to be here before the platform takes it
+  ClipboardContent content;
+  {
+    std::lock_guard<std::mutex> lock(incoming->mutex);
+    bool complete = true;
+    for (size_t i = 0; i < incoming->formats.size(); ++i) {
+      if (!incoming->formats[i].complete) {
+        Request(*incoming, static_cast<uint8_t>(i));
+        complete = false;
+      }
+    }
+    if (!complete) {
+      return;
+    }
+    for (const IncomingFormat& format : incoming->formats) {
+      content.push_back({format.mime_type, FormatData(format)});
+    }
+  }
+  if (!Clipboard::SetContent(content)) {
+    LOG_ERROR("Failed to set clipboard content from remote");
+  }
+}
+
+void ClipboardSync::Request(Incoming& incoming, uint8_t format_index) {
+  IncomingFormat& format = incoming.formats[format_index];
+  if (format.requested || incoming.closed || !incoming.send) {
+    return;
+  }
+  format.requested = true;
+
+  ClipboardRequest request{};
+  request.magic = kClipboardRequestMagic;
+  request.item_id = incoming.item_id;
+  request.format_index = format_index;
+  if (incoming.send(SendPriority::Interactive,
+                    reinterpret_cast<const char*>(&request),
+                    sizeof(request)) != 0) {
+    LOG_WARN("Clipboard: failed to request {}", format.mime_type);
+    format.requested = false;
+  }
+}
+
+std::shared_ptr<const std::string> ClipboardSync::FormatData(
+    const IncomingFormat& format) {
+  return std::make_shared<const std::string>(format.data);
+}
+
+void ClipboardSync::OnRequest(const ClipboardRequest& request) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      return;
+    }
+    auto key = std::make_pair(request.item_id, request.format_index);
+    if (std::find(requests_.begin(), requests_.end(), key) ==
+        requests_.end()) {
+      requests_.push_back(key);
+    }
+    if (!streamer_.joinable()) {
+      streamer_ = std::thread(&ClipboardSync::StreamLoop, this);
+    }
+  }
+  cv_.notify_all();
+}
+
+void ClipboardSync::StreamLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this]() { return stopped_ || !requests_.empty(); });
+    if (stopped_) {
+      return;
+    }
+    std::pair<uint32_t, uint8_t> request = requests_.front();
+    requests_.pop_front();
+    std::shared_ptr<Outgoing> outgoing = outgoing_;
+    lock.unlock();
+    Stream(outgoing, request.first, request.second);
+    lock.lock();
+  }
+}
+
+void ClipboardSync::Stream(const std::shared_ptr<Outgoing>& outgoing,
+                           uint32_t item_id, uint8_t format_index) {
+  if (!outgoing || outgoing->item_id != item_id ||
+      format_index >= outgoing->content.size()) {
+    SendGone(item_id, format_index);
+    return;
+  }
+
+  const ClipboardFormat& format = outgoing->content[format_index];
+  const std::string& data = *format.data;
+  bool compress = !IsCompressed(format.mime_type);
+  std::string compressed;
+  std::string message;
+  for (size_t offset = 0; offset < data.size(); offset += kChunkSize) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return;
+      }
+      // a newer copy makes the rest useless
+      if (outgoing_ != outgoing) {
+        SendGone(item_id, format_index);
+        return;
+      }
+    }
+
+    size_t raw_size = std::min(kChunkSize, data.size() - offset);
+    ClipboardChunkHeader header{};
+    header.magic = kClipboardChunkMagic;
+    header.item_id = item_id;
+    header.format_index = format_index;
+    header.offset = offset;
+    header.raw_size = static_cast<uint32_t>(raw_size);
+
+    const char* payload = data.data() + offset;
+    size_t payload_size = raw_size;
+    if (compress && CompressPayload(payload, raw_size, compressed)) {
+      payload = compressed.data();
+      payload_size = compressed.size();
+      header.flags |= kClipboardLz4;
+    }
+    header.payload_size = static_cast<uint32_t>(payload_size);
+
+    message.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+    message.append(payload, payload_size);
+    // paced behind input and interactive frames
+    if (send_(SendPriority::Bulk, message.data(), message.size()) != 0) {
+      LOG_WARN("Clipboard: streaming {} stopped at {} of {} bytes",
+               format.mime_type, offset, data.size());
+      return;
+    }
+  }
+}
+
+int ClipboardSync::SendGone(uint32_t item_id, uint8_t format_index) {
+  ClipboardChunkHeader header{};
+  header.magic = kClipboardChunkMagic;
+  header.item_id = item_id;
+  header.format_index = format_index;
+  header.flags = kClipboardGone;
+  return send_(SendPriority::Interactive,
+               reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+void ClipboardSync::OnChunk(const std::string& source, const char* data,
+                            size_t size) {
+  if (size < sizeof(ClipboardChunkHeader)) {
+    return;
+  }
+  ClipboardChunkHeader header;
+  memcpy(&header, data, sizeof(header));
+  const char* payload = data + sizeof(header);
+  size_t payload_size = size - sizeof(header);
+
+  std::shared_ptr<Incoming> incoming;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = incoming_.find(source);
+    if (it != incoming_.end()) {
+      incoming = it->second;
+    }
+  }
+  if (!incoming) {
+    return;
+  }
+
+  std::vector<Clipboard::FetchDone> waiters;
+  std::shared_ptr<const std::string> result;
+  bool apply = false;
+  {
+    std::lock_guard<std::mutex> lock(incoming->mutex);
+    if (incoming->closed || header.item_id != incoming->item_id ||
+        header.format_index >= incoming->formats.size()) {
+      return;
+    }
+    IncomingFormat& format = incoming->formats[header.format_index];
+    if (format.complete) {
+      return;
+    }
+
+    bool failed = (header.flags & kClipboardGone) != 0;
+    if (!failed) {
+      if (header.offset != format.data.size() ||
+          header.offset + header.raw_size > format.size ||
+          payload_size != header.payload_size) {
+        LOG_ERROR("Clipboard: chunk at {} does not continue {} at {}",
+                  header.offset, format.mime_type, format.data.size());
+        failed = true;
+      } else if (header.flags & kClipboardLz4) {
+        failed = !DecompressPayload(payload, payload_size, header.raw_size,
+                                    format.data);
+      } else {
+        format.data.append(payload, payload_size);
+      }
+    }
+    if (!failed && format.data.size() < format.size) {
+      return;
+    }
+    if (!failed &&
+        XXH3_64bits(format.data.data(), format.data.size()) != format.hash) {
+      LOG_ERROR("Clipboard: {} failed verification", format.mime_type);
+      failed = true;
+    }
+
+    waiters.swap(format.waiters);
+    if (failed) {
+      format.data.clear();
+      format.requested = false;
+    } else {
+      format.complete = true;
+      result = FormatData(format);
+      apply = !Clipboard::CanOfferLazily() &&
+              std::all_of(incoming->formats.begin(), incoming->formats.end(),
+                          [](const IncomingFormat& f) { return f.complete; });
+    }
+  }
+
+  for (auto& done : waiters) {
+    done(result);
+  }
+  if (apply) {
+    Apply(incoming);
+  }
+}
+
+}  // namespace crossdesk
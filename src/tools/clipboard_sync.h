@@ -0,0 +1,155 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _CLIPBOARD_SYNC_H_
+#define _CLIPBOARD_SYNC_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "clipboard.h"
+#include "send_scheduler.h"
+
+namespace crossdesk {
+
+constexpr uint32_t kClipboardAnnounceMagic = 0x4A4E4341;  // 'JNCA'
+constexpr uint32_t kClipboardRequestMagic = 0x4A4E4351;   // 'JNCQ'
+constexpr uint32_t kClipboardChunkMagic = 0x4A4E4344;     // 'JNCD'
+
+// ClipboardFormatEntry.flags and ClipboardChunkHeader.flags
+constexpr uint8_t kClipboardLz4 = 0x01;
+// ClipboardChunkHeader.flags: the item was replaced, nothing more comes
+constexpr uint8_t kClipboardGone = 0x02;
+
+#pragma pack(push, 1)
+// one copy: the header, then format_count entries each followed by its mime
+// type and, when payload_size > 0, the data itself
+struct ClipboardAnnounceHeader {
+  uint32_t magic;
+  uint32_t item_id;
+  uint64_t content_hash;  // ClipboardContentHash of the announced formats
+  uint8_t format_count;
+};
+
+struct ClipboardFormatEntry {
+  uint64_t size;          // raw size
+  uint64_t hash;          // XXH3 of the raw data
+  uint32_t payload_size;  // inline bytes, 0 when the data is requested
+  uint16_t mime_len;
+  uint8_t flags;
+};
+
+struct ClipboardRequest {
+  uint32_t magic;
+  uint32_t item_id;
+  uint8_t format_index;
+};
+
+struct ClipboardChunkHeader {
+  uint32_t magic;
+  uint32_t item_id;
+  uint8_t format_index;
+  uint8_t flags;
+  uint64_t offset;        // raw offset of this chunk
+  uint32_t raw_size;      // raw bytes in this chunk
+  uint32_t payload_size;  // bytes following the header
+};
+#pragma pack(pop)
+
+// Clipboard exchange with one peer. Copies are announced with their formats
+// and content hash; small formats travel inside the announcement, large ones
+// are streamed as bulk chunks when the other side asks for them. Where the
+// platform supports it the receiver only asks once a local application
+// pastes, elsewhere right after the announcement.
+//
+// A copy is not announced again when its hash matches the last one sent or
+// received, so repeated copies and copies bounced back by the peer stay
+// local. Messages without a magic are raw UTF-8 text from older peers.
+class ClipboardSync {
+ public:
+  using SendFunc =
+      std::function<int(SendPriority priority, const char* data, size_t size)>;
+
+ public:
+  explicit ClipboardSync(SendFunc send);
+  ~ClipboardSync();
+
+  ClipboardSync(const ClipboardSync&) = delete;
+  ClipboardSync& operator=(const ClipboardSync&) = delete;
+
+  // 0 when sent or skipped as a duplicate
+  int Announce(const ClipboardContent& content);
+
+  // `source` is the remote user, several peers may share one channel
+  void OnData(const std::string& source, const char* data, size_t size);
+
+ private:
+  struct Outgoing {
+    uint32_t item_id = 0;
+    ClipboardContent content;
+  };
+
+  struct IncomingFormat {
+    std::string mime_type;
+    uint64_t size = 0;
+    uint64_t hash = 0;
+    std::string data;
+    bool complete = false;
+    bool requested = false;
+    std::vector<Clipboard::FetchDone> waiters;
+  };
+
+  // shared with lazy fetches, which may outlive this object
+  struct Incoming {
+    std::mutex mutex;
+    bool closed = false;
+    SendFunc send;
+    uint32_t item_id = 0;
+    uint64_t content_hash = 0;
+    std::vector<IncomingFormat> formats;
+  };
+
+ private:
+  void OnAnnounce(const std::string& source, const char* data, size_t size);
+  void OnRequest(const ClipboardRequest& request);
+  void OnChunk(const std::string& source, const char* data, size_t size);
+  void Apply(const std::shared_ptr<Incoming>& incoming);
+
+  static void Request(Incoming& incoming, uint8_t format_index);
+  static std::shared_ptr<const std::string> FormatData(
+      const IncomingFormat& format);
+
+  void StreamLoop();
+  void Stream(const std::shared_ptr<Outgoing>& outgoing, uint32_t item_id,
+              uint8_t format_index);
+  int SendGone(uint32_t item_id, uint8_t format_index);
+
+ private:
+  SendFunc send_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopped_ = false;
+  uint64_t last_announced_hash_ = 0;
+  uint64_t last_applied_hash_ = 0;
+  std::shared_ptr<Outgoing> outgoing_;
+  std::deque<std::pair<uint32_t, uint8_t>> requests_;
+  std::thread streamer_;
+  std::unordered_map<std::string, std::shared_ptr<Incoming>> incoming_;
+};
+
+}  // namespace crossdesk
+
+#endif
@@ -0,0 +1,859 @@
+#ifdef __linux__
+
+#include "clipboard_x11.h"
+
+#include <X11/Xatom.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/Xfixes.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "rd_log.h"
+
+namespace crossdesk {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr char kTextMime[] = "text/plain;charset=utf-8";
+// INCR chunk, far below the request size limit of any server
+constexpr size_t kIncrChunk = 64 * 1024;
+// a paste or an INCR transfer that stalls this long is given up
+constexpr auto kTransferTimeout = std::chrono::seconds(5);
+// offered data may have to cross the network first
+constexpr auto kFetchTimeout = std::chrono::seconds(30);
+// upper bound for a poll, timeouts are checked at this granularity
+constexpr int kPollIntervalMs = 100;
+
+// UTF-8 to ISO 8859-1 for the STRING target, other code points become '?'
+std::string Utf8ToLatin1(const std::string& utf8) {
+  std::string out;
+  out.reserve(utf8.size());
+  for (size_t i = 0; i < utf8.size();) {
+    unsigned char c = static_cast<unsigned char>(utf8[i]);
+    if (c < 0x80) {
+      out.push_back(static_cast<char>(c));
+      i += 1;
+    } else if ((c & 0xE0) == 0xC0 && i + 1 < utf8.size()) {
+      unsigned int cp = ((c & 0x1F) << 6) | (utf8[i + 1] & 0x3F);
+      out.push_back(cp < 0x100 ? static_cast<char>(cp) : '?');
+      i += 2;
+    } else {
+      out.push_back('?');
+      i += (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+    }
+  }
+  return out;
+}
+}  // namespace
+
+class X11Clipboard::Impl {
+ public:
+  // posts to the service thread, false when it is not running
+  bool Post(std::function<void()> command) {
+    if (!running_) {
+      return false;
+    }
+    {
+      std::lock_guard<std::mutex> lock(commands_mutex_);
+      commands_.push_back(std::move(command));
+    }
+    uint64_t one = 1;
+    ssize_t n = write(wake_fd_, &one, sizeof(one));
+    (void)n;
+    return true;
+  }
+
+  bool OnServiceThread() const {
+    return std::this_thread::get_id() == thread_.get_id();
+  }
+
+ public:
+  struct OfferState {
+    std::vector<std::string> mime_types;
+    Fetch fetch;
+    // fetched formats, kept while we own the selection
+    std::unordered_map<std::string, Data> cache;
+    // pastes waiting for a fetch, by mime type
+    std::unordered_map<std::string, std::vector<XSelectionRequestEvent>>
+        waiting;
+    Clock::time_point fetch_deadline;
+  };
+
+  // an INCR transfer to a requestor
+  struct Outgoing {
+    Window requestor;
+    Atom property;
+    Atom type;
+    Data data;
+    size_t offset;
+    Clock::time_point deadline;
+  };
+
+  // a conversion of another client's selection into our window
+  struct Conversion {
+    Atom target;
+    bool started = false;
+    bool incr = false;
+    std::string data;
+    std::function<void(Data)> done;
+    Clock::time_point deadline;
+  };
+
+  bool Open() {
+    display_ = XOpenDisplay(nullptr);
+    if (!display_) {
+      LOG_ERROR("Clipboard: failed to open X display");
+      return false;
+    }
+
+    window_ = XCreateSimpleWindow(display_, DefaultRootWindow(display_), 0, 0,
+                                  1, 1, 0, 0, 0);
+    XSelectInput(display_, window_, PropertyChangeMask);
+
+    clipboard_ = XInternAtom(display_, "CLIPBOARD", False);
+    targets_ = XInternAtom(display_, "TARGETS", False);
+    timestamp_ = XInternAtom(display_, "TIMESTAMP", False);
+    incr_ = XInternAtom(display_, "INCR", False);
+    utf8_string_ = XInternAtom(display_, "UTF8_STRING", False);
+    text_ = XInternAtom(display_, "TEXT", False);
+    text_plain_ = XInternAtom(display_, "text/plain", False);
+    text_plain_utf8_ = XInternAtom(display_, kTextMime, False);
+    property_ = XInternAtom(display_, "CROSSDESK_SELECTION", False);
+    time_probe_ = XInternAtom(display_, "CROSSDESK_TIME", False);
+
+    int error_base = 0;
+    has_xfixes_ =
+        XFixesQueryExtension(display_, &xfixes_event_base_, &error_base);
+    if (has_xfixes_) {
+      XFixesSelectSelectionInput(display_, window_, clipboard_,
+                                 XFixesSetSelectionOwnerNotifyMask |
+                                     XFixesSelectionWindowDestroyNotifyMask |
+                                     XFixesSelectionClientCloseNotifyMask);
+    }
+    XFlush(display_);
+
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wake_fd_ < 0) {
+      LOG_ERROR("Clipboard: failed to create eventfd");
+      Close();
+      return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&Impl::Run, this);
+    return true;
+  }
+
+  void Close() {
+    running_ = false;
+    if (thread_.joinable()) {
+      uint64_t one = 1;
+      ssize_t n = write(wake_fd_, &one, sizeof(one));
+      (void)n;
+      thread_.join();
+    }
+    if (wake_fd_ >= 0) {
+      close(wake_fd_);
+      wake_fd_ = -1;
+    }
+    if (display_) {
+      XDestroyWindow(display_, window_);
+      XCloseDisplay(display_);
+      display_ = nullptr;
+    }
+    is_owner_ = false;
+    {
+      std::lock_guard<std::mutex> lock(owned_text_mutex_);
+      owned_text_.reset();
+    }
+    // whoever still waits learns that nothing comes
+    for (auto& conversion : conversions_) {
+      conversion.done(nullptr);
+    }
+    conversions_.clear();
+    if (pending_offer_done_) {
+      pending_offer_done_(false);
+      pending_offer_done_ = nullptr;
+    }
+    pending_offer_.reset();
+    offer_.reset();
+    outgoing_.clear();
+  }
+
+  // service thread ---------------------------------------------------------
+
+  void Run() {
+    int fd = ConnectionNumber(display_);
+    while (running_) {
+      RunCommands();
+      while (XPending(display_) > 0) {
+        XEvent event;
+        XNextEvent(display_, &event);
+        HandleEvent(event);
+      }
+      ExpireTransfers();
+      XFlush(display_);
+
+      pollfd fds[2] = {{fd, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+      poll(fds, 2, kPollIntervalMs);
+      if (fds[1].revents & POLLIN) {
+        uint64_t count = 0;
+        ssize_t n = read(wake_fd_, &count, sizeof(count));
+        (void)n;
+      }
+    }
+  }
+
+  void RunCommands() {
+    std::deque<std::function<void()>> commands;
+    {
+      std::lock_guard<std::mutex> lock(commands_mutex_);
+      commands.swap(commands_);
+    }
+    for (auto& command : commands) {
+      command();
+    }
+  }
+
+  void HandleEvent(const XEvent& event) {
+    switch (event.type) {
+      case SelectionRequest:
+        Serve(event.xselectionrequest);
+        break;
+      case SelectionClear:
+        if (event.xselectionclear.selection == clipboard_) {
+          LoseOwnership();
+        }
+        break;
+      case SelectionNotify:
+        OnSelectionNotify(event.xselection);
+        break;
+      case PropertyNotify:
+        OnPropertyNotify(event.xproperty);
+        break;
+      default:
+        if (has_xfixes_ &&
+            event.type == xfixes_event_base_ + XFixesSelectionNotify) {
+          OnSelectionOwner(
+              reinterpret_cast<const XFixesSelectionNotifyEvent&>(event));
+        }
+        break;
+    }
+  }
+
+  // ownership: a server timestamp first, as the ICCCM asks
+  void BeginOffer(std::shared_ptr<OfferState> offer,
+                  std::function<void(bool)> done) {
+    if (pending_offer_done_) {
+      pending_offer_done_(false);
+    }
+    pending_offer_ = std::move(offer);
+    pending_offer_done_ = std::move(done);
+    XChangeProperty(display_, window_, time_probe_, XA_STRING, 8,
+                    PropModeAppend, nullptr, 0);
+  }
+
+  void CompleteOffer(Time time) {
+    std::shared_ptr<OfferState> offer = std::move(pending_offer_);
+    std::function<void(bool)> done = std::move(pending_offer_done_);
+    pending_offer_done_ = nullptr;
+
+    XSetSelectionOwner(display_, clipboard_, window_, time);
+    bool owned = XGetSelectionOwner(display_, clipboard_) == window_;
+    if (owned) {
+      // the previous offer's pastes cannot be answered any more
+      if (offer_) {
+        RefuseWaiting(*offer_);
+      }
+      offer_ = std::move(offer);
+      owned_since_ = time;
+      is_owner_ = true;
+      std::lock_guard<std::mutex> lock(owned_text_mutex_);
+      auto it = offer_->cache.find(kTextMime);
+      owned_text_ = it != offer_->cache.end() ? it->second : nullptr;
+    } else {
+      LOG_ERROR("Clipboard: failed to take the selection");
+    }
+    done(owned);
+  }
+
+  void LoseOwnership() {
+    if (offer_) {
+      RefuseWaiting(*offer_);
+    }
+    offer_.reset();
+    is_owner_ = false;
+    std::lock_guard<std::mutex> lock(owned_text_mutex_);
+    owned_text_.reset();
+  }
+
+  void RefuseWaiting(OfferState& offer) {
+    for (auto& [mime_type, requests] : offer.waiting) {
+      for (auto& request : requests) {
+        Notify(request, None);
+      }
+    }
+    offer.waiting.clear();
+  }
+
+  // serving ------------------------------------------------------------------
+
+  bool IsTextTarget(Atom target) const {
+    return target == utf8_string_ || target == XA_STRING ||
+           target == text_ || target == text_plain_ ||
+           target == text_plain_utf8_;
+  }
+
+  // the offered mime type a target asks for, empty if none
+  std::string MimeForTarget(Atom target) {
+    bool offers_text = std::find(offer_->mime_types.begin(),
+                                 offer_->mime_types.end(),
+                                 kTextMime) != offer_->mime_types.end();
+    if (offers_text && IsTextTarget(target)) {
+      return kTextMime;
+    }
+    char* name = XGetAtomName(display_, target);
+    if (!name) {
+      return "";
+    }
+    std::string mime_type = name;
+    XFree(name);
+    if (std::find(offer_->mime_types.begin(), offer_->mime_types.end(),
+                  mime_type) == offer_->mime_types.end()) {
+      return "";
+    }
+    return mime_type;
+  }
+
+  void Serve(XSelectionRequestEvent request) {
+    // obsolete clients leave the property to us
+    if (request.property == None) {
+      request.property = request.target;
+    }
+    if (!offer_ || request.selection != clipboard_ ||
+        (request.time != CurrentTime && request.time < owned_since_)) {
+      Notify(request, None);
+      return;
+    }
+
+    if (request.target == targets_) {
+      std::vector<Atom> atoms = {targets_, timestamp_};
+      for (const std::string& mime_type : offer_->mime_types) {
+        if (mime_type == kTextMime) {
+          atoms.insert(atoms.end(), {utf8_string_, text_plain_utf8_,
+                                     text_plain_, XA_STRING, text_});
+        } else {
+          atoms.push_back(XInternAtom(display_, mime_type.c_str(), False));
+        }
+      }
+      XChangeProperty(display_, request.requestor, request.property, XA_ATOM,
+                      32, PropModeReplace,
+                      reinterpret_cast<unsigned char*>(atoms.data()),
+                      static_cast<int>(atoms.size()));
+      Notify(request, request.property);
+      return;
+    }
+
+    if (request.target == timestamp_) {
+      long time = static_cast<long>(owned_since_);
+      XChangeProperty(display_, request.requestor, request.property,
+                      XA_INTEGER, 32, PropModeReplace,
+                      reinterpret_cast<unsigned char*>(&time), 1);
+      Notify(request, request.property);
+      return;
+    }
+
+    std::string mime_type = MimeForTarget(request.target);
+    if (mime_type.empty()) {
+      Notify(request, None);
+      return;
+    }
+
+    auto cached = offer_->cache.find(mime_type);
+    if (cached != offer_->cache.end()) {
+      Reply(request, cached->second);
+      return;
+    }
+
+    // the first paste of this format fetches it, later ones wait along
+    auto& waiting = offer_->waiting[mime_type];
+    waiting.push_back(request);
+    if (waiting.size() > 1) {
+      return;
+    }
+    offer_->fetch_deadline = Clock::now() + kFetchTimeout;
+    std::weak_ptr<OfferState> weak_offer = offer_;
+    offer_->fetch(mime_type, [this, weak_offer, mime_type](Data data) {
+      Post([this, weak_offer, mime_type, data]() {
+        OnFetched(weak_offer, mime_type, data);
+      });
+    });
+  }
+
+  void OnFetched(const std::weak_ptr<OfferState>& weak_offer,
+                 const std::string& mime_type, Data data) {
+    std::shared_ptr<OfferState> offer = weak_offer.lock();
+    // ownership moved on, the pastes were refused already
+    if (!offer || offer != offer_) {
+      return;
+    }
+    std::vector<XSelectionRequestEvent> requests =
+        std::move(offer->waiting[mime_type]);
+    offer->waiting.erase(mime_type);
+    if (data) {
+      offer->cache[mime_type] = data;
+      if (mime_type == kTextMime) {
+        std::lock_guard<std::mutex> lock(owned_text_mutex_);
+        owned_text_ = data;
+      }
+    }
+    for (auto& request : requests) {
+      if (data) {
+        Reply(request, data);
+      } else {
+        Notify(request, None);
+      }
+    }
+  }
+
+  void Reply(const XSelectionRequestEvent& request, Data data) {
+    Atom type = request.target == text_ ? utf8_string_ : request.target;
+    if (request.target == XA_STRING) {
+      // converted per request, few clients still ask for it
+      data = std::make_shared<const std::string>(Utf8ToLatin1(*data));
+    }
+
+    if (data->size() > kIncrChunk) {
+      // the requestor deletes the property for every chunk it has read
+      XSelectInput(display_, request.requestor, PropertyChangeMask);
+      long size = static_cast<long>(data->size());
+      XChangeProperty(display_, request.requestor, request.property, incr_,
+                      32, PropModeReplace,
+                      reinterpret_cast<unsigned char*>(&size), 1);
+      outgoing_.push_back({request.requestor, request.property, type, data, 0,
+                           Clock::now() + kTransferTimeout});
+    } else {
+      XChangeProperty(
+          display_, request.requestor, request.property, type, 8,
+          PropModeReplace,
+          reinterpret_cast<const unsigned char*>(data->data()),
+          static_cast<int>(data->size()));
+    }
+    Notify(request, request.property);
+  }
+
+  void Notify(const XSelectionRequestEvent& request, Atom property) {
+    XSelectionEvent notify{};
+    notify.type = SelectionNotify;
+    notify.display = request.display;
+    notify.requestor = request.requestor;
+    notify.selection = request.selection;
+    notify.target = request.target;
+    notify.property = property;
+    notify.time = request.time;
+    XSendEvent(display_, request.requestor, False, NoEventMask,
+               reinterpret_cast<XEvent*>(&notify));
+  }
+
+  void ContinueOutgoing(const XPropertyEvent& event) {
+    auto it = std::find_if(outgoing_.begin(), outgoing_.end(),
+                           [&](const Outgoing& transfer) {
+                             return transfer.requestor == event.window &&
+                                    transfer.property == event.atom;
+                           });
+    if (it == outgoing_.end()) {
+      return;
+    }
+
+    // a zero-length chunk ends the transfer
+    size_t n = (std::min)(kIncrChunk, it->data->size() - it->offset);
+    XChangeProperty(
+        display_, it->requestor, it->property, it->type, 8, PropModeReplace,
+        reinterpret_cast<const unsigned char*>(it->data->data() + it->offset),
+        static_cast<int>(n));
+    it->offset += n;
+    it->deadline = Clock::now() + kTransferTimeout;
+    if (n == 0) {
+      Window requestor = it->requestor;
+      outgoing_.erase(it);
+      StopWatching(requestor);
+    }
+  }
+
+  void StopWatching(Window requestor) {
+    bool busy = std::any_of(
+        outgoing_.begin(), outgoing_.end(),
+        [&](const Outgoing& other) { return other.requestor == requestor; });
+    if (!busy) {
+      XSelectInput(display_, requestor, NoEventMask);
+    }
+  }
+
+  // converting ---------------------------------------------------------------
+
+  void Convert(Atom target, std::function<void(Data)> done) {
+    Conversion conversion;
+    conversion.target = target;
+    conversion.done = std::move(done);
+    conversions_.push_back(std::move(conversion));
+    StartConversion();
+  }
+
+  void StartConversion() {
+    if (conversions_.empty() || conversions_.front().started) {
+      return;
+    }
+    Conversion& conversion = conversions_.front();
+    conversion.started = true;
+    conversion.deadline = Clock::now() + kTransferTimeout;
+    XDeleteProperty(display_, window_, property_);
+    XConvertSelection(display_, clipboard_, conversion.target, property_,
+                      window_, CurrentTime);
+  }
+
+  void FinishConversion(Data data) {
+    Conversion conversion = std::move(conversions_.front());
+    conversions_.pop_front();
+    conversion.done(data);
+    StartConversion();
+  }
+
+  void OnSelectionNotify(const XSelectionEvent& event) {
+    if (conversions_.empty() || !conversions_.front().started ||
+        event.requestor != window_) {
+      return;
+    }
+    Conversion& conversion = conversions_.front();
+    if (event.property == None) {
+      // owners that predate UTF8_STRING still have STRING
+      if (conversion.target == utf8_string_) {
+        conversion.target = XA_STRING;
+        conversion.started = false;
+        StartConversion();
+      } else {
+        FinishConversion(nullptr);
+      }
+      return;
+    }
+
+    Atom type = None;
+    std::string chunk;
+    if (!ReadProperty(&type, &chunk)) {
+      FinishConversion(nullptr);
+      return;
+    }
+    if (type == incr_) {
+      // deleting the INCR property (done by the read) asks for the first
+      // chunk
+      conversion.incr = true;
+      conversion.deadline = Clock::now() + kTransferTimeout;
+      return;
+    }
+    FinishConversion(std::make_shared<const std::string>(std::move(chunk)));
+  }
+
+  // reads and deletes our property
+  bool ReadProperty(Atom* type, std::string* out) {
+    int format = 0;
+    unsigned long items = 0;
+    unsigned long bytes_after = 0;
+    unsigned char* data = nullptr;
+    if (XGetWindowProperty(display_, window_, property_, 0, LONG_MAX / 4, True,
+                           AnyPropertyType, type, &format, &items,
+                           &bytes_after, &data) != Success) {
+      return false;
+    }
+    if (data) {
+      size_t bytes = items * (format == 32   ? sizeof(long)
+                              : format == 16 ? sizeof(short)
+                                             : 1);
+      out->assign(reinterpret_cast<char*>(data), bytes);
+      XFree(data);
+    }
+    return true;
+  }
+
+  void OnPropertyNotify(const XPropertyEvent& event) {
+    if (event.window == window_) {
+      if (event.atom == time_probe_ && pending_offer_) {
+        CompleteOffer(event.time);
+      } else if (event.atom == property_ && event.state == PropertyNewValue &&
+                 !conversions_.empty() && conversions_.front().incr) {
+        Atom type = None;
+        std::string chunk;
+        if (!ReadProperty(&type, &chunk)) {
+          FinishConversion(nullptr);
+          return;
+        }
+        Conversion& conversion = conversions_.front();
+        if (chunk.empty()) {
+          FinishConversion(
+              std::make_shared<const std::string>(std::move(conversion.data)));
+          return;
+        }
+        conversion.data += chunk;
+        conversion.deadline = Clock::now() + kTransferTimeout;
+      }
+      return;
+    }
+    if (event.state == PropertyDelete) {
+      ContinueOutgoing(event);
+    }
+  }
+
+  void OnSelectionOwner(const XFixesSelectionNotifyEvent& event) {
+    // our own copies are not news
+    if (event.owner == window_ || event.selection != clipboard_) {
+      return;
+    }
+    OnOwnerChanged on_owner_changed;
+    {
+      std::lock_guard<std::mutex> lock(on_owner_changed_mutex_);
+      on_owner_changed = on_owner_changed_;
+    }
+    if (on_owner_changed) {
+      on_owner_changed();
+    }
+  }
+
+  // the owner's TARGETS as names
+  std::vector<std::string> TargetNames(const Data& data) {
+    std::vector<std::string> names;
+    if (!data) {
+      return names;
+    }
+    size_t count = data->size() / sizeof(long);
+    const long* atoms = reinterpret_cast<const long*>(data->data());
+    for (size_t i = 0; i < count; ++i) {
+      char* name = XGetAtomName(display_, static_cast<Atom>(atoms[i]));
+      if (name) {
+        names.push_back(name);
+        XFree(name);
+      }
+    }
+    return names;
+  }
+
+  void ExpireTransfers() {
+    Clock::time_point now = Clock::now();
+    while (!conversions_.empty() && conversions_.front().started &&
+           now > conversions_.front().deadline) {
+      LOG_WARN("Clipboard: the selection owner did not answer");
+      FinishConversion(nullptr);
+    }
+
+    for (auto it = outgoing_.begin(); it != outgoing_.end();) {
+      if (now > it->deadline) {
+        LOG_WARN("Clipboard: a paste stopped reading, {} of {} bytes sent",
+                 it->offset, it->data->size());
+        Window requestor = it->requestor;
+        it = outgoing_.erase(it);
+        StopWatching(requestor);
+      } else {
+        ++it;
+      }
+    }
+
+    if (offer_ && !offer_->waiting.empty() && now > offer_->fetch_deadline) {
+      LOG_WARN("Clipboard: fetching the offered data timed out");
+      RefuseWaiting(*offer_);
+    }
+  }
+
+ public:
+  Display* display_ = nullptr;
+  Window window_ = None;
+  int wake_fd_ = -1;
+  int xfixes_event_base_ = 0;
+  bool has_xfixes_ = false;
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+
+  std::mutex commands_mutex_;
+  std::deque<std::function<void()>> commands_;
+
+  // GetText answers from here without a round trip while we own the
+  // selection
+  std::atomic<bool> is_owner_{false};
+  std::mutex owned_text_mutex_;
+  Data owned_text_;
+
+  std::mutex on_owner_changed_mutex_;
+  OnOwnerChanged on_owner_changed_;
+
+ private:
+  Atom clipboard_ = None;
+  Atom targets_ = None;
+  Atom timestamp_ = None;
+  Atom incr_ = None;
+  Atom utf8_string_ = None;
+  Atom text_ = None;
+  Atom text_plain_ = None;
+  Atom text_plain_utf8_ = None;
+  Atom property_ = None;
+  Atom time_probe_ = None;
+
+  // service thread only
+  std::shared_ptr<OfferState> offer_;
+  Time owned_since_ = CurrentTime;
+  std::shared_ptr<OfferState> pending_offer_;
+  std::function<void(bool)> pending_offer_done_;
+  std::vector<Outgoing> outgoing_;
+  std::deque<Conversion> conversions_;
+
+  friend class X11Clipboard;
+};
+
+X11Clipboard& X11Clipboard::Instance() {
+  static X11Clipboard instance;
+  return instance;
+}
+
+X11Clipboard::X11Clipboard() : impl_(std::make_unique<Impl>()) {}
+
+X11Clipboard::~X11Clipboard() { Stop(); }
+
+static std::mutex g_x11_clipboard_start_mutex;
+
+bool X11Clipboard::Start() {
+  std::lock_guard<std::mutex> lock(g_x11_clipboard_start_mutex);
+  if (impl_->running_) {
+    return true;
+  }
+  return impl_->Open();
+}
+
+void X11Clipboard::Stop() {
+  std::lock_guard<std::mutex> lock(g_x11_clipboard_start_mutex);
+  impl_->Close();
+}
+
+bool X11Clipboard::Offer(const std::vector<std::string>& mime_types,
+                         Fetch fetch) {
+  auto offer = std::make_shared<Impl::OfferState>();
+  offer->mime_types = mime_types;
+  offer->fetch = std::move(fetch);
+
+  if (impl_->OnServiceThread()) {
+    impl_->BeginOffer(offer, [](bool) {});
+    return true;
+  }
+  auto result = std::make_shared<std::promise<bool>>();
+  std::future<bool> owned = result->get_future();
+  if (!impl_->Post([this, offer, result]() {
+        impl_->BeginOffer(offer,
+                          [result](bool ok) { result->set_value(ok); });
+      })) {
+    return false;
+  }
+  return owned.wait_for(kTransferTimeout) == std::future_status::ready &&
+         owned.get();
+}
+
+bool X11Clipboard::SetText(const std::string& text) {
+  Data data = std::make_shared<const std::string>(text);
+  // known up front, so it is in the cache the moment we own the selection
+  bool ok = Offer({kTextMime}, [data](const std::string&, FetchDone done) {
+    done(data);
+  });
+  if (ok) {
+    std::lock_guard<std::mutex> lock(impl_->owned_text_mutex_);
+    impl_->owned_text_ = data;
+  }
+  return ok;
+}
+
+std::string X11Clipboard::GetText(int timeout_ms) {
+  if (impl_->is_owner_) {
+    std::lock_guard<std::mutex> lock(impl_->owned_text_mutex_);
+    return impl_->owned_text_ ? *impl_->owned_text_ : "";
+  }
+  Data data = GetData("UTF8_STRING", timeout_ms);
+  return data ? *data : "";
+}
+
+std::vector<std::string> X11Clipboard::GetTargets(int timeout_ms) {
+  Data data = GetData("TARGETS", timeout_ms);
+  if (!data) {
+    return {};
+  }
+  auto result = std::make_shared<std::promise<std::vector<std::string>>>();
+  std::future<std::vector<std::string>> names = result->get_future();
+  if (!impl_->Post([this, data, result]() {
+        result->set_value(impl_->TargetNames(data));
+      })) {
+    return {};
+  }
+  return names.wait_for(kTransferTimeout) == std::future_status::ready
+             ? names.get()
+             : std::vector<std::string>();
+}
+
+X11Clipboard::Data X11Clipboard::GetData(const std::string& target,
+                                         int timeout_ms) {
+  if (impl_->OnServiceThread()) {
+    LOG_WARN("Clipboard: GetData on the clipboard thread");
+    return nullptr;
+  }
+
+  auto result = std::make_shared<std::promise<Data>>();
+  std::future<Data> data = result->get_future();
+  if (!impl_->Post([this, target, result]() {
+        Atom atom = XInternAtom(impl_->display_, target.c_str(), False);
+        impl_->Convert(atom, [result](Data data) { result->set_value(data); });
+      })) {
+    return nullptr;
+  }
+  if (data.wait_for(std::chrono::milliseconds(timeout_ms)) !=
+      std::future_status::ready) {
+    return nullptr;
+  }
+  return data.get();
+}
+
+bool X11Clipboard::HasOwner() {
+  if (impl_->is_owner_) {
+    return true;
+  }
+  if (impl_->OnServiceThread()) {
+    return XGetSelectionOwner(impl_->display_, impl_->clipboard_) != None;
+  }
+
+  auto result = std::make_shared<std::promise<bool>>();
+  std::future<bool> has_owner = result->get_future();
+  if (!impl_->Post([this, result]() {
+        result->set_value(XGetSelectionOwner(impl_->display_,
+                                             impl_->clipboard_) != None);
+      })) {
+    return false;
+  }
+  return has_owner.wait_for(kTransferTimeout) == std::future_status::ready &&
+         has_owner.get();
+}
+
+bool X11Clipboard::IsOwner() { return impl_->is_owner_; }
+
+bool X11Clipboard::HasChangeEvents() {
+  return impl_->running_ && impl_->has_xfixes_;
+}
+
+void X11Clipboard::SetOnOwnerChanged(OnOwnerChanged on_owner_changed) {
+  std::lock_guard<std::mutex> lock(impl_->on_owner_changed_mutex_);
+  impl_->on_owner_changed_ = std::move(on_owner_changed);
+}
+
+}  // namespace crossdesk
+
+#endif
@@ -0,0 +1,81 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _CLIPBOARD_X11_H_
+#define _CLIPBOARD_X11_H_
+
+#ifdef __linux__
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace crossdesk {
+
+// The X11 side of the clipboard. One service thread owns a display
+// connection and a window for the life of the process and does everything
+// on them: it answers SelectionRequests while we own CLIPBOARD, converts the
+// selection when we need another owner's data, and watches owner changes
+// through XFixes. Other threads post to it and never open a connection of
+// their own.
+//
+// Offered content is lazy: taking ownership only announces the formats, the
+// data of a format is fetched the first time a local application pastes it
+// and kept until the ownership is lost. Payloads above one chunk go out and
+// come in with the INCR protocol.
+class X11Clipboard {
+ public:
+  using Data = std::shared_ptr<const std::string>;
+  // completes a fetch from any thread, nullptr if the data cannot be had
+  using FetchDone = std::function<void(Data)>;
+  using Fetch =
+      std::function<void(const std::string& mime_type, FetchDone done)>;
+  using OnOwnerChanged = std::function<void()>;
+
+ public:
+  static X11Clipboard& Instance();
+  ~X11Clipboard();
+
+  // opens the connection and starts the thread once, false without a
+  // display
+  bool Start();
+  void Stop();
+
+  // takes CLIPBOARD ownership offering `mime_types`. "text/plain;charset=utf-8"
+  // is also served as UTF8_STRING, STRING, TEXT and text/plain.
+  bool Offer(const std::vector<std::string>& mime_types, Fetch fetch);
+  bool SetText(const std::string& text);
+
+  // our own text while we own the clipboard, otherwise converted from the
+  // owner. Empty on timeout.
+  std::string GetText(int timeout_ms = 1000);
+  // target names (mime types and X atoms) the current owner offers
+  std::vector<std::string> GetTargets(int timeout_ms = 1000);
+  // converts the selection to `target`, nullptr if the owner refuses or does
+  // not answer in time
+  Data GetData(const std::string& target, int timeout_ms = 5000);
+  bool HasOwner();
+  bool IsOwner();
+
+  // false when the server lacks XFixes and changes have to be polled
+  bool HasChangeEvents();
+  // runs on the service thread whenever another client takes or drops the
+  // clipboard. It must not call back into X11Clipboard synchronously.
+  void SetOnOwnerChanged(OnOwnerChanged on_owner_changed);
+
+ private:
+  X11Clipboard();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace crossdesk
+
+#endif
+#endif
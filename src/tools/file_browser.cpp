@@ -0,0 +1,1227 @@
+#include "file_browser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <thread>
+
+#include "rd_log.h"
+#include "thread_pool.h"
+
+#ifdef _WIN32
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#endif
+
+namespace crossdesk {
+
+namespace {
+// directories whose listing the host keeps (and watches) at once.
+constexpr size_t kMaxHostListings = 32;
+// directories whose listing the viewer keeps.
+constexpr size_t kMaxClientListings = 16;
+// listing pages stay below the 64 KB file chunks used on the same channels.
+constexpr size_t kListPageBytes = 48 * 1024;
+constexpr size_t kMaxPathLen = 4096;
+// bursts of changes (an unpacked archive) are reported once per this delay.
+constexpr auto kWatchDebounce = std::chrono::milliseconds(200);
+// listings of unwatched directories are re-read after this long.
+constexpr auto kUnwatchedTtl = std::chrono::seconds(5);
+constexpr size_t kMaxPulls = 32;
+
+void PutVarint(std::vector<char>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+bool GetVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    uint8_t byte = *p++;
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string HomePath() {
+#ifdef _WIN32
+  const char* home_env = std::getenv("USERPROFILE");
+#else
+  const char* home_env = std::getenv("HOME");
+#endif
+  if (!home_env) {
+    return "/";
+  }
+  return std::filesystem::path(home_env).generic_string();
+}
+
+// '/' separated, no trailing separator except for roots ("/", "C:/").
+std::string NormalizePath(const std::string& path) {
+  std::string normal =
+      std::filesystem::path(path).lexically_normal().generic_string();
+  while (normal.size() > 1 && normal.back() == '/' &&
+         !(normal.size() == 3 && normal[1] == ':')) {
+    normal.pop_back();
+  }
+  return normal;
+}
+
+#ifdef _WIN32
+// C++17 has no clock_cast, convert through the current time of both clocks.
+int64_t ToUnixSeconds(std::filesystem::file_time_type time) {
+  auto system_time =
+      std::chrono::system_clock::now() +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          time - std::filesystem::file_time_type::clock::now());
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             system_time.time_since_epoch())
+      .count();
+}
+#endif
+
+#ifndef _WIN32
+// directories with at least this many entries are stat'ed in parallel.
+constexpr size_t kParallelStatThreshold = 4096;
+
+ThreadPool& ListPool() {
+  static ThreadPool pool(
+      std::max(2u, std::thread::hardware_concurrency() / 2));
+  return pool;
+}
+#endif
+
+// list requests are served by a few threads of their own, not by ListPool:
+// a request waits on the stat slices it queues there.
+constexpr size_t kListRequestThreads = 2;
+// distinct paths waiting to be listed, further requests are refused.
+constexpr size_t kMaxQueuedListPaths = 64;
+
+ThreadPool& ListRequestPool() {
+  static ThreadPool pool(kListRequestThreads);
+  return pool;
+}
+
+void AppendPath(std::vector<char>& out, const std::string& path) {
+  out.insert(out.end(), path.begin(), path.end());
+}
+}  // namespace
+
+// Reports changed directories. Only implemented with inotify, elsewhere the
+// viewer falls back to re-reading listings after kUnwatchedTtl.
+class FileBrowserHost::Watcher {
+ public:
+  using ChangeFunc = std::function<void(const std::string& path)>;
+
+  explicit Watcher(ChangeFunc on_change) : on_change_(std::move(on_change)) {
+#ifdef __linux__
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd_ < 0 || wake_fd_ < 0) {
+      LOG_WARN("FileBrowserHost: inotify unavailable, errno={}", errno);
+      Close();
+      return;
+    }
+    thread_ = std::thread(&Watcher::Run, this);
+#endif
+  }
+
+  ~Watcher() {
+#ifdef __linux__
+    if (thread_.joinable()) {
+      stop_ = true;
+      uint64_t one = 1;
+      ssize_t ret = write(wake_fd_, &one, sizeof(one));
+      (void)ret;
+      thread_.join();
+    }
+    Close();
+#endif
+  }
+
+  bool Available() const {
+#ifdef __linux__
+    return fd_ >= 0;
+#else
+    return false;
+#endif
+  }
+
+  bool Add(const std::string& path) {
+#ifdef __linux__
+    if (fd_ < 0) {
+      return false;
+    }
+    int wd = inotify_add_watch(fd_, path.c_str(),
+                               IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                   IN_MOVED_TO | IN_ATTRIB | IN_CLOSE_WRITE |
+                                   IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+    if (wd < 0) {
+      LOG_WARN("FileBrowserHost: cannot watch [{}], errno={}", path, errno);
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    wd_to_path_[wd] = path;
+    path_to_wd_[path] = wd;
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+  }
+
+  void Remove(const std::string& path) {
+#ifdef __linux__
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = path_to_wd_.find(path);
+    if (it == path_to_wd_.end()) {
+      return;
+    }
+    inotify_rm_watch(fd_, it->second);
+    wd_to_path_.erase(it->second);
+    path_to_wd_.erase(it);
+#else
+    (void)path;
+#endif
+  }
+
+ private:
+#ifdef __linux__
+  void Close() {
+    if (fd_ >= 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+    if (wake_fd_ >= 0) {
+      close(wake_fd_);
+      wake_fd_ = -1;
+    }
+  }
+
+  void Run() {
+    alignas(struct inotify_event) char buffer[16 * 1024];
+    std::unordered_set<std::string> dirty;
+    auto deadline = std::chrono::steady_clock::time_point::max();
+
+    while (!stop_) {
+      int timeout = -1;
+      if (!dirty.empty()) {
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        timeout = static_cast<int>((std::max)(wait.count(), int64_t{0}));
+      }
+
+      struct pollfd fds[2] = {{fd_, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+      int ret = poll(fds, 2, timeout);
+      if (ret < 0 && errno != EINTR) {
+        LOG_ERROR("FileBrowserHost: watcher poll failed, errno={}", errno);
+        return;
+      }
+
+      if (ret > 0 && (fds[0].revents & POLLIN)) {
+        ssize_t len;
+        while ((len = read(fd_, buffer, sizeof(buffer))) > 0) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          for (char* p = buffer; p < buffer + len;) {
+            auto* event = reinterpret_cast<struct inotify_event*>(p);
+            p += sizeof(struct inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) {
+              // events were lost, every watched directory may have changed
+              for (const auto& entry : wd_to_path_) {
+                dirty.insert(entry.second);
+              }
+              continue;
+            }
+            auto it = wd_to_path_.find(event->wd);
+            if (it == wd_to_path_.end()) {
+              continue;
+            }
+            dirty.insert(it->second);
+            if (event->mask & IN_IGNORED) {
+              // the directory is gone, the kernel already dropped the watch
+              path_to_wd_.erase(it->second);
+              wd_to_path_.erase(it);
+            }
+          }
+        }
+        if (!dirty.empty() &&
+            deadline == std::chrono::steady_clock::time_point::max()) {
+          deadline = std::chrono::steady_clock::now() + kWatchDebounce;
+        }
+      }
+
+      if (!dirty.empty() && std::chrono::steady_clock::now() >= deadline) {
+        for (const auto& path : dirty) {
+          on_change_(path);
+        }
+        dirty.clear();
+        deadline = std::chrono::steady_clock::time_point::max();
+      }
+    }
+  }
+
+  int fd_ = -1;
+  int wake_fd_ = -1;
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+  std::mutex mutex_;
+  std::unordered_map<int, std::string> wd_to_path_;
+  std::unordered_map<std::string, int> path_to_wd_;
+#endif
+  ChangeFunc on_change_;
+};
+
+FileBrowserHost::FileBrowserHost() {
+  // versions of a previous host instance must not look current
+  std::random_device rd;
+  version_base_ = static_cast<uint64_t>(rd()) << 32;
+  watcher_ = std::make_unique<Watcher>(
+      [this](const std::string& path) { OnDirectoryChanged(path); });
+}
+
+FileBrowserHost::~FileBrowserHost() {
+  // a running list job takes list_jobs_mutex_ to pick up its requests
+  std::vector<std::future<void>> list_jobs;
+  {
+    std::lock_guard<std::mutex> lock(list_jobs_mutex_);
+    list_jobs.swap(list_jobs_);
+  }
+  for (auto& job : list_jobs) {
+    job.wait();
+  }
+  watcher_.reset();
+  std::lock_guard<std::mutex> lock(pulls_mutex_);
+  for (auto& job : pull_jobs_) {
+    job.wait();
+  }
+}
+
+bool FileBrowserHost::OnData(const std::string& remote_id, const char* data,
+                             size_t size) {
+  if (!data || size < sizeof(uint32_t)) {
+    LOG_ERROR("FileBrowserHost::OnData: invalid buffer");
+    return false;
+  }
+
+  uint32_t magic = 0;
+  memcpy(&magic, data, sizeof(magic));
+  if (magic == kFileListRequestMagic) {
+    return HandleListRequest(data, size) == 0;
+  } else if (magic == kFilePullRequestMagic) {
+    return HandlePullRequest(remote_id, data, size) == 0;
+  }
+
+  LOG_ERROR("FileBrowserHost::OnData: unknown magic 0x{:08X}", magic);
+  return false;
+}
+
+FileListError FileBrowserHost::ReadDirectory(
+    const std::string& path, std::vector<FileListEntry>& entries) {
+  entries.clear();
+
+#ifdef _WIN32
+  // the directory entries of MSVC keep the size and time returned by
+  // FindNextFile, so this walk needs no extra system call per entry.
+  std::error_code ec;
+  std::filesystem::path dir(path);
+  auto status = std::filesystem::status(dir, ec);
+  if (ec || !std::filesystem::exists(status)) {
+    return FileListError::NotFound;
+  }
+  if (!std::filesystem::is_directory(status)) {
+    return FileListError::NotDirectory;
+  }
+
+  std::filesystem::directory_iterator it(dir, ec), end;
+  if (ec) {
+    return ec == std::errc::permission_denied ? FileListError::Denied
+                                              : FileListError::Failed;
+  }
+  for (; it != end; it.increment(ec)) {
+    if (ec) {
+      break;
+    }
+    FileListEntry entry;
+    entry.name = it->path().filename().string();
+    std::error_code entry_ec;
+    if (it->is_directory(entry_ec)) {
+      entry.type = FileListEntryType::Directory;
+    } else if (it->is_regular_file(entry_ec)) {
+      entry.type = FileListEntryType::File;
+      entry.size = it->file_size(entry_ec);
+    } else {
+      entry.type = FileListEntryType::Other;
+    }
+    auto mtime = it->last_write_time(entry_ec);
+    if (!entry_ec) {
+      entry.mtime = ToUnixSeconds(mtime);
+    }
+    entries.push_back(std::move(entry));
+  }
+#else
+  // readdir + fstatat relative to the open directory avoids building and
+  // resolving a full path per entry, which dominates on huge directories.
+  DIR* dir = opendir(path.c_str());
+  if (!dir) {
+    switch (errno) {
+      case ENOENT:
+        return FileListError::NotFound;
+      case ENOTDIR:
+        return FileListError::NotDirectory;
+      case EACCES:
+      case EPERM:
+        return FileListError::Denied;
+      default:
+        return FileListError::Failed;
+    }
+  }
+
+  int dir_fd = dirfd(dir);
+  while (struct dirent* ent = readdir(dir)) {
+    const char* name = ent->d_name;
+    if (name[0] == '.' &&
+        (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+      continue;
+    }
+    FileListEntry entry;
+    entry.name = name;
+    entries.push_back(std::move(entry));
+  }
+
+  auto stat_range = [dir_fd, &entries](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      FileListEntry& entry = entries[i];
+      struct stat st;
+      if (fstatat(dir_fd, entry.name.c_str(), &st, 0) != 0 &&
+          fstatat(dir_fd, entry.name.c_str(), &st, AT_SYMLINK_NOFOLLOW) !=
+              0) {
+        entry.type = FileListEntryType::Other;
+        continue;
+      }
+      if (S_ISDIR(st.st_mode)) {
+        entry.type = FileListEntryType::Directory;
+      } else if (S_ISREG(st.st_mode)) {
+        entry.type = FileListEntryType::File;
+        entry.size = static_cast<uint64_t>(st.st_size);
+      } else {
+        entry.type = FileListEntryType::Other;
+      }
+      entry.mtime = static_cast<int64_t>(st.st_mtime);
+    }
+  };
+
+  // one stat per entry dominates the listing of huge directories, spread
+  // them over a few threads
+  if (entries.size() < kParallelStatThreshold) {
+    stat_range(0, entries.size());
+  } else {
+    size_t slices = ListPool().Size() * 4;
+    size_t per_slice = (entries.size() + slices - 1) / slices;
+    std::vector<std::future<void>> jobs;
+    for (size_t begin = 0; begin < entries.size(); begin += per_slice) {
+      size_t end = (std::min)(begin + per_slice, entries.size());
+      jobs.push_back(
+          ListPool().Submit([&stat_range, begin, end]() {
+            stat_range(begin, end);
+          }));
+    }
+    for (auto& job : jobs) {
+      job.wait();
+    }
+  }
+  closedir(dir);
+#endif
+
+  std::sort(entries.begin(), entries.end(),
+            [](const FileListEntry& a, const FileListEntry& b) {
+              bool a_dir = a.type == FileListEntryType::Directory;
+              bool b_dir = b.type == FileListEntryType::Directory;
+              if (a_dir != b_dir) {
+                return a_dir;
+              }
+              return a.name < b.name;
+            });
+  return FileListError::None;
+}
+
+int FileBrowserHost::EncodePages(uint32_t request_id, uint64_t version,
+                                 const std::string& path,
+                                 const std::vector<FileListEntry>& entries,
+                                 uint32_t start, uint32_t count, uint8_t flags,
+                                 size_t page_bytes, const SendFunc& send) {
+  if (!send) {
+    return -1;
+  }
+
+  uint32_t total = static_cast<uint32_t>(entries.size());
+  start = (std::min)(start, total);
+  uint32_t end = (count == 0 || count > total - start) ? total : start + count;
+
+  std::vector<char> page;
+  page.reserve(page_bytes + 512);
+  uint32_t page_start = start;
+  uint32_t index = start;
+
+  while (true) {
+    page.assign(sizeof(FileListPageHeader), 0);
+    AppendPath(page, path);
+    size_t body_offset = page.size();
+    const std::string* prev = nullptr;
+
+    for (; index < end; ++index) {
+      if (page.size() - body_offset >= page_bytes) {
+        break;
+      }
+      const FileListEntry& entry = entries[index];
+      size_t shared = 0;
+      if (prev) {
+        size_t limit = (std::min)(prev->size(), entry.name.size());
+        while (shared < limit && (*prev)[shared] == entry.name[shared]) {
+          ++shared;
+        }
+      }
+      PutVarint(page, shared);
+      PutVarint(page, entry.name.size() - shared);
+      page.insert(page.end(), entry.name.begin() + shared, entry.name.end());
+      page.push_back(static_cast<char>(entry.type));
+      PutVarint(page, entry.size);
+      PutVarint(page, static_cast<uint64_t>((std::max)(entry.mtime,
+                                                       int64_t{0})));
+      prev = &entry.name;
+    }
+
+    FileListPageHeader header{};
+    header.magic = kFileListPageMagic;
+    header.request_id = request_id;
+    header.version = version;
+    header.start_index = page_start;
+    header.entry_count = index - page_start;
+    header.total_entries = total;
+    header.body_size = static_cast<uint32_t>(page.size() - body_offset);
+    header.path_len = static_cast<uint16_t>(path.size());
+    header.flags = flags | (index == end ? kFileListLast : 0);
+    header.error = static_cast<uint8_t>(FileListError::None);
+    memcpy(page.data(), &header, sizeof(header));
+
+    int ret = send(page.data(), page.size());
+    if (ret != 0) {
+      LOG_ERROR("FileBrowserHost: failed to send listing page, ret={}", ret);
+      return ret;
+    }
+    if (index == end) {
+      return 0;
+    }
+    page_start = index;
+  }
+}
+
+int FileBrowserHost::HandleListRequest(const char* data, size_t size) {
+  if (size < sizeof(FileListRequest)) {
+    LOG_ERROR("FileBrowserHost: list request too small, size={}", size);
+    return -1;
+  }
+  FileListRequest request{};
+  memcpy(&request, data, sizeof(request));
+  if (request.path_len > kMaxPathLen ||
+      sizeof(request) + request.path_len > size) {
+    LOG_ERROR("FileBrowserHost: invalid list request path length {}",
+              request.path_len);
+    return -1;
+  }
+
+  std::string path(data + sizeof(request), request.path_len);
+  path = path.empty() ? HomePath() : NormalizePath(path);
+
+  {
+    std::lock_guard<std::mutex> lock(list_jobs_mutex_);
+    // a path already waiting for a job is answered by that job
+    auto queued = queued_lists_.find(path);
+    if (queued != queued_lists_.end()) {
+      queued->second.push_back(request);
+      return 0;
+    }
+
+    list_jobs_.erase(
+        std::remove_if(list_jobs_.begin(), list_jobs_.end(),
+                       [](std::future<void>& job) {
+                         return job.wait_for(std::chrono::seconds(0)) ==
+                                std::future_status::ready;
+                       }),
+        list_jobs_.end());
+    if (queued_lists_.size() < kMaxQueuedListPaths) {
+      queued_lists_[path].push_back(request);
+      list_jobs_.push_back(ListRequestPool().Submit([this, path]() {
+        std::vector<FileListRequest> requests;
+        {
+          std::lock_guard<std::mutex> lock(list_jobs_mutex_);
+          auto it = queued_lists_.find(path);
+          requests = std::move(it->second);
+          queued_lists_.erase(it);
+        }
+        for (const auto& queued_request : requests) {
+          ServeListRequest(queued_request, path);
+        }
+      }));
+      return 0;
+    }
+  }
+
+  LOG_WARN("FileBrowserHost: too many pending listings, refusing [{}]", path);
+  return SendError(request.request_id, path, FileListError::Failed);
+}
+
+int FileBrowserHost::ServeListRequest(const FileListRequest& request,
+                                      const std::string& path) {
+  FileListError error = FileListError::None;
+  std::shared_ptr<const Listing> listing = GetListing(path, error);
+  if (!listing) {
+    return SendError(request.request_id, path, error);
+  }
+
+  uint8_t flags = watcher_->Available() ? kFileListWatched : 0;
+  if (request.known_version != 0 && request.known_version == listing->version) {
+    std::vector<char> page(sizeof(FileListPageHeader), 0);
+    AppendPath(page, listing->path);
+    FileListPageHeader header{};
+    header.magic = kFileListPageMagic;
+    header.request_id = request.request_id;
+    header.version = listing->version;
+    header.total_entries = static_cast<uint32_t>(listing->entries.size());
+    header.path_len = static_cast<uint16_t>(listing->path.size());
+    header.flags = flags | kFileListLast | kFileListNotModified;
+    memcpy(page.data(), &header, sizeof(header));
+    return send_ ? send_(page.data(), page.size()) : -1;
+  }
+
+  return EncodePages(request.request_id, listing->version, listing->path,
+                     listing->entries, request.start_index,
+                     request.max_entries, flags, kListPageBytes, send_);
+}
+
+int FileBrowserHost::SendError(uint32_t request_id, const std::string& path,
+                               FileListError error) {
+  if (!send_) {
+    return -1;
+  }
+  std::string echoed = path.substr(0, kMaxPathLen);
+  std::vector<char> page(sizeof(FileListPageHeader), 0);
+  AppendPath(page, echoed);
+  FileListPageHeader header{};
+  header.magic = kFileListPageMagic;
+  header.request_id = request_id;
+  header.path_len = static_cast<uint16_t>(echoed.size());
+  header.flags = kFileListLast;
+  header.error = static_cast<uint8_t>(error);
+  memcpy(page.data(), &header, sizeof(header));
+  return send_(page.data(), page.size());
+}
+
+std::shared_ptr<const FileBrowserHost::Listing> FileBrowserHost::GetListing(
+    const std::string& path, FileListError& error) {
+  {
+    std::lock_guard<std::mutex> lock(listings_mutex_);
+    for (auto it = listings_.begin(); it != listings_.end(); ++it) {
+      if ((*it)->path == path) {
+        listings_.splice(listings_.begin(), listings_, it);
+        return listings_.front();
+      }
+    }
+  }
+
+  // watch before reading so that changes made meanwhile are not missed
+  bool watched = watcher_->Add(path);
+
+  auto listing = std::make_shared<Listing>();
+  listing->path = path;
+  auto start = std::chrono::steady_clock::now();
+  error = ReadDirectory(path, listing->entries);
+  if (error != FileListError::None) {
+    if (watched) {
+      watcher_->Remove(path);
+    }
+    return nullptr;
+  }
+  LOG_INFO("FileBrowserHost: listed [{}], {} entries in {} ms", path,
+           listing->entries.size(),
+           std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+               .count());
+
+  std::vector<std::string> evicted;
+  {
+    std::lock_guard<std::mutex> lock(listings_mutex_);
+    listing->version = version_base_ | next_version_++;
+    listings_.remove_if([&path](const std::shared_ptr<const Listing>& l) {
+      return l->path == path;
+    });
+    listings_.push_front(listing);
+    while (listings_.size() > kMaxHostListings) {
+      evicted.push_back(listings_.back()->path);
+      listings_.pop_back();
+    }
+  }
+  for (const auto& old_path : evicted) {
+    watcher_->Remove(old_path);
+  }
+  return listing;
+}
+
+void FileBrowserHost::OnDirectoryChanged(const std::string& path) {
+  bool cached = false;
+  {
+    std::lock_guard<std::mutex> lock(listings_mutex_);
+    auto it = std::find_if(
+        listings_.begin(), listings_.end(),
+        [&path](const std::shared_ptr<const Listing>& l) {
+          return l->path == path;
+        });
+    if (it != listings_.end()) {
+      listings_.erase(it);
+      cached = true;
+    }
+  }
+  // the next request reads the directory again and watches it anew
+  watcher_->Remove(path);
+  if (!cached || !send_) {
+    return;
+  }
+
+  std::vector<char> event(sizeof(FileWatchEvent), 0);
+  AppendPath(event, path);
+  FileWatchEvent header{};
+  header.magic = kFileWatchEventMagic;
+  header.path_len = static_cast<uint16_t>(path.size());
+  memcpy(event.data(), &header, sizeof(header));
+  int ret = send_(event.data(), event.size());
+  if (ret != 0) {
+    LOG_WARN("FileBrowserHost: failed to send watch event, ret={}", ret);
+  }
+}
+
+int FileBrowserHost::HandlePullRequest(const std::string& remote_id,
+                                       const char* data, size_t size) {
+  if (size < sizeof(FilePullRequest)) {
+    LOG_ERROR("FileBrowserHost: pull request too small, size={}", size);
+    return -1;
+  }
+  FilePullRequest request{};
+  memcpy(&request, data, sizeof(request));
+
+  std::vector<std::filesystem::path> paths;
+  size_t offset = sizeof(request);
+  for (uint16_t i = 0; i < request.path_count; ++i) {
+    uint16_t len = 0;
+    if (offset + sizeof(len) > size) {
+      LOG_ERROR("FileBrowserHost: truncated pull request");
+      return -1;
+    }
+    memcpy(&len, data + offset, sizeof(len));
+    offset += sizeof(len);
+    if (len == 0 || len > kMaxPathLen || offset + len > size) {
+      LOG_ERROR("FileBrowserHost: invalid pull path length {}", len);
+      return -1;
+    }
+    paths.emplace_back(NormalizePath(std::string(data + offset, len)));
+    offset += len;
+  }
+  if (paths.empty() || !file_send_) {
+    return -1;
+  }
+
+  std::error_code ec;
+  bool single_file =
+      paths.size() == 1 && std::filesystem::is_regular_file(paths[0], ec);
+  if (!single_file && !(request.caps & kFileAckSessions)) {
+    LOG_ERROR("FileBrowserHost: viewer cannot receive folders or batches");
+    return -1;
+  }
+
+  uint32_t transfer_id = FileSender::NextFileId();
+  uint32_t caps = request.caps;
+  SendFunc file_send = file_send_;
+
+  FilePullStarted started{};
+  started.magic = kFilePullStartedMagic;
+  started.transfer_id = request.transfer_id;
+  started.file_id = transfer_id;
+  if (!send_ || send_(reinterpret_cast<const char*>(&started),
+                      sizeof(started)) != 0) {
+    LOG_ERROR("FileBrowserHost: failed to answer pull request {}",
+              request.transfer_id);
+    return -1;
+  }
+
+  std::lock_guard<std::mutex> lock(pulls_mutex_);
+  pull_jobs_.erase(
+      std::remove_if(pull_jobs_.begin(), pull_jobs_.end(),
+                     [](std::future<void>& job) {
+                       return job.wait_for(std::chrono::seconds(0)) ==
+                              std::future_status::ready;
+                     }),
+      pull_jobs_.end());
+  active_pulls_.insert(transfer_id);
+
+  LOG_INFO("FileBrowserHost: pull {} of {} item(s), first [{}]", transfer_id,
+           paths.size(), paths[0].string().c_str());
+  pull_jobs_.push_back(std::async(std::launch::async, [this, remote_id, paths,
+                                                       caps, transfer_id,
+                                                       file_send,
+                                                       single_file]() {
+    FileSender sender;
+    sender.SetPeerCapabilities([caps]() { return caps; });
+    sender.SetOwner(remote_id);
+    int ret = 0;
+    if (single_file) {
+      std::string label = paths[0].filename().string();
+      ret = (caps & kFileAckDelta)
+                ? sender.SendFileDelta(paths[0], label, file_send, 64 * 1024,
+                                       transfer_id)
+                : sender.SendFile(paths[0], label, file_send, 64 * 1024,
+                                  transfer_id);
+    } else {
+      ret = sender.SendSession(FileSender::CollectEntries(paths), file_send,
+                               64 * 1024, transfer_id);
+    }
+    if (ret != 0) {
+      LOG_ERROR("FileBrowserHost: pull {} failed, ret={}", transfer_id, ret);
+      std::lock_guard<std::mutex> lock(pulls_mutex_);
+      active_pulls_.erase(transfer_id);
+    }
+  }));
+  return 0;
+}
+
+bool FileBrowserHost::OnTransferAck(const FileTransferAck& ack) {
+  std::lock_guard<std::mutex> lock(pulls_mutex_);
+  auto it = active_pulls_.find(ack.file_id);
+  if (it == active_pulls_.end()) {
+    return false;
+  }
+  if (ack.flags & kFileAckCompleted) {
+    LOG_INFO("FileBrowserHost: pull {} completed, size={}, failed={}",
+             ack.file_id, ack.total_size, (ack.flags & kFileAckError) != 0);
+    active_pulls_.erase(it);
+  }
+  return true;
+}
+
+void FileBrowserClient::Browse(const std::string& requested) {
+  std::vector<char> request;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto alias = aliases_.find(requested);
+    const std::string& path =
+        alias != aliases_.end() ? alias->second : requested;
+    for (const auto& entry : in_flight_) {
+      if (entry.second == path) {
+        return;
+      }
+    }
+
+    uint64_t known_version = 0;
+    auto it = std::find_if(cache_.begin(), cache_.end(),
+                           [&path](const Listing& l) { return l.path == path; });
+    if (it != cache_.end() && it->complete) {
+      bool fresh = it->watched ? true
+                               : std::chrono::steady_clock::now() -
+                                         it->fetched <
+                                     kUnwatchedTtl;
+      if (!it->stale && fresh) {
+        return;
+      }
+      if (it->error == FileListError::None) {
+        known_version = it->version;
+      }
+    }
+
+    if (!send_ || path.size() > kMaxPathLen) {
+      return;
+    }
+    uint32_t request_id = next_request_id_++;
+    in_flight_[request_id] = path;
+
+    FileListRequest header{};
+    header.magic = kFileListRequestMagic;
+    header.request_id = request_id;
+    header.known_version = known_version;
+    header.path_len = static_cast<uint16_t>(path.size());
+    request.resize(sizeof(header));
+    memcpy(request.data(), &header, sizeof(header));
+    AppendPath(request, path);
+  }
+
+  int ret = send_(request.data(), request.size());
+  if (ret != 0) {
+    LOG_ERROR("FileBrowserClient: failed to send list request, ret={}", ret);
+    FileListRequest header{};
+    memcpy(&header, request.data(), sizeof(header));
+    std::lock_guard<std::mutex> lock(mutex_);
+    in_flight_.erase(header.request_id);
+  }
+}
+
+void FileBrowserClient::Refresh(const std::string& path) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string resolved = ResolveLocked(path);
+    for (auto& listing : cache_) {
+      if (listing.path == resolved) {
+        listing.stale = true;
+        listing.version = 0;
+      }
+    }
+  }
+  Browse(path);
+}
+
+bool FileBrowserClient::OnData(const char* data, size_t size) {
+  if (!data || size < sizeof(uint32_t)) {
+    LOG_ERROR("FileBrowserClient::OnData: invalid buffer");
+    return false;
+  }
+
+  uint32_t magic = 0;
+  memcpy(&magic, data, sizeof(magic));
+  if (magic == kFileListPageMagic) {
+    HandlePage(data, size);
+    return true;
+  } else if (magic == kFileWatchEventMagic) {
+    HandleWatchEvent(data, size);
+    return true;
+  } else if (magic == kFilePullStartedMagic) {
+    HandlePullStarted(data, size);
+    return true;
+  }
+
+  LOG_ERROR("FileBrowserClient::OnData: unknown magic 0x{:08X}", magic);
+  return false;
+}
+
+bool FileBrowserClient::DecodePage(const char* data, size_t size,
+                                   FileListPageHeader& header,
+                                   std::string& path,
+                                   std::vector<FileListEntry>& entries) {
+  if (size < sizeof(FileListPageHeader)) {
+    return false;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != kFileListPageMagic ||
+      sizeof(header) + header.path_len + header.body_size != size) {
+    return false;
+  }
+  path.assign(data + sizeof(header), header.path_len);
+
+  const uint8_t* p =
+      reinterpret_cast<const uint8_t*>(data) + sizeof(header) + header.path_len;
+  const uint8_t* end = p + header.body_size;
+  entries.clear();
+  entries.reserve(header.entry_count);
+  std::string prev;
+  for (uint32_t i = 0; i < header.entry_count; ++i) {
+    uint64_t shared = 0;
+    uint64_t length = 0;
+    if (!GetVarint(p, end, shared) || !GetVarint(p, end, length) ||
+        shared > prev.size() || length > static_cast<uint64_t>(end - p)) {
+      return false;
+    }
+    FileListEntry entry;
+    entry.name.reserve(shared + length);
+    entry.name.assign(prev, 0, shared);
+    entry.name.append(reinterpret_cast<const char*>(p), length);
+    p += length;
+    if (p >= end) {
+      return false;
+    }
+    uint8_t type = *p++;
+    entry.type = type <= static_cast<uint8_t>(FileListEntryType::Other)
+                     ? static_cast<FileListEntryType>(type)
+                     : FileListEntryType::Other;
+    uint64_t mtime = 0;
+    if (!GetVarint(p, end, entry.size) || !GetVarint(p, end, mtime)) {
+      return false;
+    }
+    entry.mtime = static_cast<int64_t>(mtime);
+    prev = entry.name;
+    entries.push_back(std::move(entry));
+  }
+  return p == end;
+}
+
+FileBrowserClient::Listing& FileBrowserClient::Slot(const std::string& path) {
+  auto it = std::find_if(cache_.begin(), cache_.end(),
+                         [&path](const Listing& l) { return l.path == path; });
+  if (it != cache_.end()) {
+    cache_.splice(cache_.begin(), cache_, it);
+    return cache_.front();
+  }
+  cache_.emplace_front();
+  cache_.front().path = path;
+  while (cache_.size() > kMaxClientListings) {
+    cache_.pop_back();
+  }
+  return cache_.front();
+}
+
+void FileBrowserClient::HandlePage(const char* data, size_t size) {
+  FileListPageHeader header{};
+  std::string path;
+  std::vector<FileListEntry> entries;
+  if (!DecodePage(data, size, header, path, entries)) {
+    LOG_ERROR("FileBrowserClient: malformed listing page, size={}", size);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto request = in_flight_.find(header.request_id);
+  if (request == in_flight_.end()) {
+    return;
+  }
+  // pages carry the resolved path, e.g. the home directory for an empty one
+  if (request->second != path) {
+    if (aliases_.size() >= kMaxClientListings) {
+      aliases_.clear();
+    }
+    aliases_[request->second] = path;
+  }
+  Listing& listing = Slot(path);
+  bool last = (header.flags & kFileListLast) != 0;
+  listing.watched = (header.flags & kFileListWatched) != 0;
+
+  if (header.error != static_cast<uint8_t>(FileListError::None)) {
+    listing.entries.clear();
+    listing.total_entries = 0;
+    listing.version = 0;
+    listing.error = static_cast<FileListError>(header.error);
+    listing.complete = true;
+  } else if (header.flags & kFileListNotModified) {
+    listing.complete = true;
+  } else {
+    if (header.start_index == 0) {
+      listing.entries.clear();
+      listing.entries.reserve(header.total_entries);
+      listing.version = header.version;
+      listing.error = FileListError::None;
+      listing.complete = false;
+    }
+    if (header.start_index != listing.entries.size()) {
+      LOG_WARN("FileBrowserClient: listing page out of order for [{}]", path);
+      listing.stale = true;
+      in_flight_.erase(request);
+      return;
+    }
+    listing.total_entries = header.total_entries;
+    listing.entries.insert(listing.entries.end(),
+                           std::make_move_iterator(entries.begin()),
+                           std::make_move_iterator(entries.end()));
+    listing.complete = last;
+  }
+
+  if (last) {
+    listing.stale = false;
+    listing.fetched = std::chrono::steady_clock::now();
+    in_flight_.erase(request);
+  }
+}
+
+void FileBrowserClient::HandleWatchEvent(const char* data, size_t size) {
+  FileWatchEvent event{};
+  if (size < sizeof(event)) {
+    return;
+  }
+  memcpy(&event, data, sizeof(event));
+  if (sizeof(event) + event.path_len != size) {
+    LOG_ERROR("FileBrowserClient: malformed watch event");
+    return;
+  }
+  std::string path(data + sizeof(event), event.path_len);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& listing : cache_) {
+    if (listing.path == path) {
+      listing.stale = true;
+    }
+  }
+}
+
+bool FileBrowserClient::View(const std::string& requested,
+                             const std::function<void(const Listing&)>& fn) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string path = ResolveLocked(requested);
+  for (const auto& listing : cache_) {
+    if (listing.path == path) {
+      fn(listing);
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string FileBrowserClient::Resolve(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ResolveLocked(path);
+}
+
+std::string FileBrowserClient::ResolveLocked(const std::string& path) const {
+  auto it = aliases_.find(path);
+  return it != aliases_.end() ? it->second : path;
+}
+
+uint32_t FileBrowserClient::Pull(const std::vector<std::string>& paths,
+                                 uint32_t caps) {
+  if (!send_ || paths.empty()) {
+    return 0;
+  }
+
+  FilePullRequest header{};
+  header.magic = kFilePullRequestMagic;
+  header.transfer_id = FileSender::NextFileId();
+  header.caps = caps;
+  header.path_count = static_cast<uint16_t>(
+      (std::min)(paths.size(), size_t{UINT16_MAX}));
+
+  std::vector<char> request(sizeof(header));
+  memcpy(request.data(), &header, sizeof(header));
+  for (uint16_t i = 0; i < header.path_count; ++i) {
+    uint16_t len = static_cast<uint16_t>(paths[i].size());
+    const char* len_bytes = reinterpret_cast<const char*>(&len);
+    request.insert(request.end(), len_bytes, len_bytes + sizeof(len));
+    AppendPath(request, paths[i]);
+  }
+
+  PullInfo pull;
+  pull.transfer_id = header.transfer_id;
+  size_t slash = paths[0].find_last_of('/');
+  pull.label =
+      slash == std::string::npos ? paths[0] : paths[0].substr(slash + 1);
+  if (paths.size() > 1) {
+    pull.label += " (+" + std::to_string(paths.size() - 1) + ")";
+  }
+
+  // recorded first, the host's answer may arrive before send_ returns
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pulls_.push_back(std::move(pull));
+    if (pulls_.size() > kMaxPulls) {
+      pulls_.erase(pulls_.begin());
+    }
+  }
+
+  int ret = send_(request.data(), request.size());
+  if (ret != 0) {
+    LOG_ERROR("FileBrowserClient: failed to send pull request, ret={}", ret);
+    std::lock_guard<std::mutex> lock(mutex_);
+    pulls_.erase(std::remove_if(pulls_.begin(), pulls_.end(),
+                                [&header](const PullInfo& p) {
+                                  return p.transfer_id == header.transfer_id;
+                                }),
+                 pulls_.end());
+    return 0;
+  }
+  return header.transfer_id;
+}
+
+void FileBrowserClient::HandlePullStarted(const char* data, size_t size) {
+  if (size < sizeof(FilePullStarted)) {
+    LOG_ERROR("FileBrowserClient: pull answer too small, size={}", size);
+    return;
+  }
+  FilePullStarted started{};
+  memcpy(&started, data, sizeof(started));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& pull : pulls_) {
+    if (pull.transfer_id != started.transfer_id) {
+      continue;
+    }
+    pull.file_id = started.file_id;
+    auto early = early_acks_.find(started.file_id);
+    if (early != early_acks_.end()) {
+      ApplyAck(pull, early->second);
+      early_acks_.erase(early);
+    }
+    return;
+  }
+}
+
+void FileBrowserClient::ApplyAck(PullInfo& pull, const FileTransferAck& ack) {
+  pull.received = ack.acked_offset;
+  pull.total = ack.total_size;
+  if (ack.flags & kFileAckCompleted) {
+    pull.status = (ack.flags & kFileAckError) ? PullStatus::Failed
+                                              : PullStatus::Completed;
+  } else {
+    pull.status = PullStatus::Receiving;
+  }
+}
+
+void FileBrowserClient::OnLocalAck(const FileTransferAck& ack) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& pull : pulls_) {
+    if (pull.file_id == 0 || pull.file_id != ack.file_id) {
+      continue;
+    }
+    ApplyAck(pull, ack);
+    return;
+  }
+
+  // the file channel may overtake the browse channel, keep the latest ack
+  // until the pull it belongs to is known
+  bool awaited = std::any_of(pulls_.begin(), pulls_.end(),
+                             [](const PullInfo& pull) {
+                               return pull.file_id == 0 &&
+                                      pull.status == PullStatus::Requested;
+                             });
+  if (!awaited) {
+    early_acks_.clear();
+  } else if (early_acks_.size() < kMaxPulls ||
+             early_acks_.count(ack.file_id) > 0) {
+    early_acks_[ack.file_id] = ack;
+  }
+}
+
+std::vector<FileBrowserClient::PullInfo> FileBrowserClient::Pulls() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pulls_;
+}
+
+std::string FileBrowserClient::ParentPath(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  if (slash == std::string::npos) {
+    return path;
+  }
+  if (slash == 0) {
+    return "/";
+  }
+  if (slash == 2 && path[1] == ':') {
+    return path.substr(0, 3);
+  }
+  return path.substr(0, slash);
+}
+
+std::string FileBrowserClient::JoinPath(const std::string& dir,
+                                        const std::string& name) {
+  if (dir.empty() || dir.back() == '/') {
+    return dir + name;
+  }
+  return dir + "/" + name;
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,284 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-01-12
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _FILE_BROWSER_H_
+#define _FILE_BROWSER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "file_transfer.h"
+
+namespace crossdesk {
+
+// Remote file browsing runs on its own data channel. The viewer asks for a
+// directory listing, the host answers with listing pages and later tells the
+// viewer when a listed directory changed. Files picked by the viewer are
+// pulled: the host streams them back with FileSender on the file channel.
+constexpr uint32_t kFileListRequestMagic = 0x4A4E4C51;  // 'JNLQ'
+constexpr uint32_t kFileListPageMagic = 0x4A4E4C50;     // 'JNLP'
+constexpr uint32_t kFileWatchEventMagic = 0x4A4E4C57;   // 'JNLW'
+constexpr uint32_t kFilePullRequestMagic = 0x4A4E5052;  // 'JNPR'
+constexpr uint32_t kFilePullStartedMagic = 0x4A4E5053;  // 'JNPS'
+
+// FileListPageHeader.flags
+constexpr uint8_t kFileListLast = 0x01;
+// the viewer's copy (FileListRequest.known_version) is still current.
+constexpr uint8_t kFileListNotModified = 0x02;
+// the host watches this directory and sends a FileWatchEvent on change.
+constexpr uint8_t kFileListWatched = 0x04;
+
+// FileListPageHeader.error
+enum class FileListError : uint8_t {
+  None = 0,
+  NotFound = 1,
+  NotDirectory = 2,
+  Denied = 3,
+  Failed = 4
+};
+
+enum class FileListEntryType : uint8_t { File = 0, Directory = 1, Other = 2 };
+
+#pragma pack(push, 1)
+struct FileListRequest {
+  uint32_t magic;
+  uint32_t request_id;
+  uint64_t known_version;  // version of the viewer's cached copy, 0 if none
+  uint32_t start_index;    // first entry wanted
+  uint32_t max_entries;    // 0 means up to the end of the listing
+  uint16_t path_len;       // followed by the UTF-8 path, empty for home
+};
+
+// followed by the resolved directory path (path_len bytes), then body_size
+// bytes of entries. Entries are sorted, directories first, and front coded
+// against the previous entry of the same page:
+//   varint shared  - bytes of the previous name reused
+//   varint length  - bytes of name that follow
+//   bytes  suffix
+//   u8     FileListEntryType
+//   varint size    - bytes, 0 for directories
+//   varint mtime   - seconds since the unix epoch, clamped at 0
+struct FileListPageHeader {
+  uint32_t magic;
+  uint32_t request_id;
+  uint64_t version;        // changes whenever the host re-reads the directory
+  uint32_t start_index;    // index of the first entry in this page
+  uint32_t entry_count;    // entries in this page
+  uint32_t total_entries;  // entries in the whole directory
+  uint32_t body_size;
+  uint16_t path_len;
+  uint8_t flags;
+  uint8_t error;  // FileListError
+};
+
+// followed by the UTF-8 path (path_len bytes) of a directory whose listing
+// the viewer may have cached.
+struct FileWatchEvent {
+  uint32_t magic;
+  uint16_t path_len;
+};
+
+// followed by path_count times (u16 length + UTF-8 path). The host answers
+// with FilePullStarted and sends the files back under an id of its own.
+struct FilePullRequest {
+  uint32_t magic;
+  uint32_t transfer_id;  // chosen by the viewer, only echoed back
+  uint32_t caps;         // FileTransferAck feature/codec bits of the viewer
+  uint16_t path_count;
+};
+
+// the pull `transfer_id` arrives as file_id (or session_id) `file_id`, which
+// the host allocated so it can not collide with its other transfers.
+struct FilePullStarted {
+  uint32_t magic;
+  uint32_t transfer_id;
+  uint32_t file_id;
+};
+#pragma pack(pop)
+
+struct FileListEntry {
+  std::string name;
+  FileListEntryType type = FileListEntryType::File;
+  uint64_t size = 0;
+  int64_t mtime = 0;  // seconds since the unix epoch
+};
+
+// Host side: serves listings from a small cache and answers pull requests.
+class FileBrowserHost {
+ public:
+  using SendFunc = FileSender::SendFunc;
+
+ public:
+  FileBrowserHost();
+  ~FileBrowserHost();
+
+  // `send` writes to the browse channel, `file_send` to the file channel.
+  void SetSendFunc(SendFunc send) { send_ = send; }
+  void SetFileSendFunc(SendFunc send) { file_send_ = send; }
+
+  // feed a message received on the browse channel from viewer `remote_id`.
+  bool OnData(const std::string& remote_id, const char* data, size_t size);
+
+  // returns true when `ack` belongs to a pull started here, the ack is then
+  // fully handled.
+  bool OnTransferAck(const FileTransferAck& ack);
+
+  // read and sort a directory. Exposed for benchmarks.
+  static FileListError ReadDirectory(const std::string& path,
+                                     std::vector<FileListEntry>& entries);
+
+  // encode entries [start, start + count) of `entries` into pages of at
+  // most `page_bytes` and pass each one to `send`.
+  static int EncodePages(uint32_t request_id, uint64_t version,
+                         const std::string& path,
+                         const std::vector<FileListEntry>& entries,
+                         uint32_t start, uint32_t count, uint8_t flags,
+                         size_t page_bytes, const SendFunc& send);
+
+ private:
+  struct Listing {
+    std::string path;
+    uint64_t version = 0;
+    std::vector<FileListEntry> entries;
+  };
+
+  class Watcher;
+
+  int HandleListRequest(const char* data, size_t size);
+  int ServeListRequest(const FileListRequest& request, const std::string& path);
+  // the pull's repair sources are tagged with `remote_id`, see
+  // FileSender::DropRepairSources.
+  int HandlePullRequest(const std::string& remote_id, const char* data,
+                        size_t size);
+  std::shared_ptr<const Listing> GetListing(const std::string& path,
+                                            FileListError& error);
+  void OnDirectoryChanged(const std::string& path);
+  int SendError(uint32_t request_id, const std::string& path,
+                FileListError error);
+
+ private:
+  SendFunc send_ = nullptr;
+  SendFunc file_send_ = nullptr;
+  std::unique_ptr<Watcher> watcher_;
+
+  std::mutex listings_mutex_;
+  // most recently used first
+  std::list<std::shared_ptr<const Listing>> listings_;
+  uint64_t version_base_ = 0;
+  uint64_t next_version_ = 1;
+
+  std::mutex pulls_mutex_;
+  std::unordered_set<uint32_t> active_pulls_;
+  std::vector<std::future<void>> pull_jobs_;
+
+  // reading a huge directory must not stall the browse channel callback
+  std::mutex list_jobs_mutex_;
+  std::vector<std::future<void>> list_jobs_;
+  // path -> requests waiting for its list job
+  std::unordered_map<std::string, std::vector<FileListRequest>> queued_lists_;
+};
+
+// Viewer side: requests listings, caches them per directory and tracks
+// pulls requested from the host.
+class FileBrowserClient {
+ public:
+  using SendFunc = FileSender::SendFunc;
+
+  struct Listing {
+    std::string path;
+    uint64_t version = 0;
+    std::vector<FileListEntry> entries;
+    uint32_t total_entries = 0;
+    FileListError error = FileListError::None;
+    bool complete = false;
+    bool watched = false;
+    bool stale = false;
+    std::chrono::steady_clock::time_point fetched;
+  };
+
+  enum class PullStatus { Requested, Receiving, Completed, Failed };
+
+  struct PullInfo {
+    uint32_t transfer_id = 0;
+    // id the host sends the pull under, 0 until FilePullStarted arrived
+    uint32_t file_id = 0;
+    std::string label;
+    uint64_t received = 0;
+    uint64_t total = 0;
+    PullStatus status = PullStatus::Requested;
+  };
+
+ public:
+  FileBrowserClient() = default;
+
+  void SetSendFunc(SendFunc send) { send_ = send; }
+
+  // make sure `path` is listed. Does nothing while the cached copy is
+  // current or a request for it is in flight.
+  void Browse(const std::string& path);
+  // drop the cached copy of `path` and list it again.
+  void Refresh(const std::string& path);
+
+  // feed a message received on the browse channel.
+  bool OnData(const char* data, size_t size);
+
+  // the path the host resolved `path` to (e.g. the home directory for an
+  // empty one), `path` itself until known.
+  std::string Resolve(const std::string& path);
+
+  // call `fn` with the cached listing of `path` under the cache lock, returns
+  // false when nothing is cached yet.
+  bool View(const std::string& path,
+            const std::function<void(const Listing&)>& fn);
+
+  // ask the host to send `paths` back, `caps` are the local receiver's.
+  uint32_t Pull(const std::vector<std::string>& paths, uint32_t caps);
+  // update pull progress from an ack our FileReceiver sends to the host.
+  void OnLocalAck(const FileTransferAck& ack);
+  std::vector<PullInfo> Pulls();
+
+  static std::string ParentPath(const std::string& path);
+  static std::string JoinPath(const std::string& dir, const std::string& name);
+
+  static bool DecodePage(const char* data, size_t size,
+                         FileListPageHeader& header, std::string& path,
+                         std::vector<FileListEntry>& entries);
+
+ private:
+  void HandlePage(const char* data, size_t size);
+  void HandleWatchEvent(const char* data, size_t size);
+  void HandlePullStarted(const char* data, size_t size);
+  void ApplyAck(PullInfo& pull, const FileTransferAck& ack);
+  Listing& Slot(const std::string& path);
+  std::string ResolveLocked(const std::string& path) const;
+
+ private:
+  SendFunc send_ = nullptr;
+
+  std::mutex mutex_;
+  std::list<Listing> cache_;  // most recently used first
+  // request id -> requested path
+  std::unordered_map<uint32_t, std::string> in_flight_;
+  // requested path -> path resolved by the host
+  std::unordered_map<std::string, std::string> aliases_;
+  uint32_t next_request_id_ = 1;
+  std::vector<PullInfo> pulls_;
+  // acks that arrived on the file channel before their FilePullStarted
+  std::unordered_map<uint32_t, FileTransferAck> early_acks_;
+};
+
+}  // namespace crossdesk
+
+#endif
@@ -1,306 +1,2709 @@
 #include "file_transfer.h"
 
+#include <lz4.h>
+#include <xxhash.h>
+
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <mutex>
 
+#include "crc32c.h"
 #include "rd_log.h"
+#include "thread_pool.h"
 
 namespace crossdesk {
 
 namespace {
 std::atomic<uint32_t> g_next_file_id{1};
-}  // namespace
 
-uint32_t FileSender::NextFileId() { return g_next_file_id.fetch_add(1); }
+// chunks smaller than this are not worth a codec round trip.
+constexpr uint32_t kMinCompressSize = 4 * 1024;
+// only the first kProbeSize bytes are compressed to decide whether the whole
+// chunk is worth compressing, already-compressed media fails this quickly.
+constexpr uint32_t kProbeSize = 4 * 1024;
+constexpr int kProbeAcceleration = 8;
+// encoded payload must be below this fraction of the raw one to be sent.
+constexpr double kMaxProbeRatio = 0.90;
+constexpr double kMaxCompressRatio = 0.95;
+// upper bound of a decoded chunk accepted by the receiver.
+constexpr uint32_t kMaxRawChunkSize = 16 * 1024 * 1024;
 
-int FileSender::SendFile(const std::filesystem::path& path,
-                         const std::string& label, const SendFunc& send,
-                         std::size_t chunk_size, uint32_t file_id) {
-  if (!send) {
-    LOG_ERROR("FileSender::SendFile: send function is empty");
-    return -1;
+// delta block size is about sqrt(file size), like rsync, within these bounds.
+constexpr uint32_t kMinDeltaBlockSize = 2 * 1024;
+constexpr uint32_t kMaxDeltaBlockSize = 128 * 1024;
+// a copy with more blocks than this, 128 GB at the largest block size, is
+// sent in full.
+constexpr uint32_t kMaxDeltaBlocks = 1024 * 1024;
+// bytes of the receiver's copy hashed by one signature task.
+constexpr uint64_t kSignatureTaskBytes = 4 * 1024 * 1024;
+// the sender gives up on a delta if no signature page arrives for this long.
+constexpr std::chrono::seconds kSignatureIdleTimeout(15);
+// a damaged range is requested this many times before the transfer fails.
+constexpr int kMaxRepairAttempts = 3;
+// recently sent files kept around to answer NACKs.
+constexpr size_t kMaxRepairSources = 64;
+
+// shared by chunk compression and signature hashing.
+ThreadPool& TransferPool() {
+  static ThreadPool pool(
+      std::max(2u, std::thread::hardware_concurrency() / 2));
+  return pool;
+}
+
+// StreamFileChunks could not read the announced size, the file shrank or is
+// not readable.
+constexpr int kFileReadError = -2;
+
+// session files up to this fraction of the chunk size are packed together.
+constexpr std::size_t kPackedFileDivisor = 2;
+constexpr std::size_t kMaxPackEntries = 1024;
+constexpr uint32_t kMaxManifestPageEntries = 4096;
+// failed session files remembered to drop their late chunks.
+constexpr size_t kMaxFailedSessionFiles = 1024;
+
+uint32_t CodecBit(FileChunkCodec codec) {
+  return 1u << (kFileAckCodecShift + static_cast<uint32_t>(codec));
+}
+
+uint32_t LocalCapabilities() {
+  return FileSender::SupportedCodecs() | kFileAckSessions | kFileAckDelta |
+         kFileAckIntegrity;
+}
+
+// CRC of a message header and the fields after it, FileChunkIntegrity itself
+// excluded. `message` must hold at least all of them.
+uint32_t HeaderCrc(const char* message, size_t head_size,
+                   size_t integrity_size, size_t trailer_size) {
+  uint32_t crc = Crc32c(0, message, head_size);
+  return Crc32c(crc, message + head_size + integrity_size, trailer_size);
+}
+
+uint32_t ChunkHeaderCrc(const char* chunk, size_t codec_size,
+                        size_t integrity_size, size_t trailer_size) {
+  return HeaderCrc(chunk, sizeof(FileChunkHeader) + codec_size,
+                   integrity_size, trailer_size);
+}
+
+// compress `data` into `out`, return false when it is not worth sending the
+// encoded form.
+bool CompressPayload(const char* data, uint32_t data_size,
+                     FileChunkCodec codec, std::vector<char>& out) {
+  if (codec != FileChunkCodec::Lz4 || data_size < kMinCompressSize ||
+      data_size > kMaxRawChunkSize || !data) {
+    return false;
   }
 
-  std::error_code ec;
-  if (!std::filesystem::exists(path, ec) ||
-      !std::filesystem::is_regular_file(path, ec)) {
-    LOG_ERROR("FileSender::SendFile: file [{}] not found or not regular",
-              path.string().c_str());
-    return -1;
+  int bound = LZ4_compressBound(static_cast<int>(data_size));
+  out.resize(static_cast<size_t>(bound));
+
+  int probe_size = static_cast<int>(std::min(data_size, kProbeSize));
+  int probe_encoded = LZ4_compress_fast(data, out.data(), probe_size, bound,
+                                        kProbeAcceleration);
+  if (probe_encoded <= 0 || probe_encoded > probe_size * kMaxProbeRatio) {
+    return false;
   }
 
-  uint64_t total_size = std::filesystem::file_size(path, ec);
-  if (ec) {
-    LOG_ERROR("FileSender::SendFile: failed to get size of [{}]: {}",
-              path.string().c_str(), ec.message().c_str());
-    return -1;
+  int encoded_size = LZ4_compress_default(
+      data, out.data(), static_cast<int>(data_size), bound);
+  if (encoded_size <= 0 || encoded_size > data_size * kMaxCompressRatio) {
+    return false;
   }
 
-  std::ifstream ifs(path, std::ios::binary);
-  if (!ifs.is_open()) {
-    LOG_ERROR("FileSender::SendFile: failed to open [{}]",
-              path.string().c_str());
-    return -1;
+  out.resize(static_cast<size_t>(encoded_size));
+  return true;
+}
+
+// keeps chunks in submission order while they are encoded on the compression
+// pool, bounded so the reader cannot run far ahead of the link.
+class ChunkPipeline {
+ public:
+  explicit ChunkPipeline(const FileSender::SendFunc& send)
+      : send_(send), max_inflight_(TransferPool().Size() * 2) {}
+
+  template <typename F>
+  int Submit(F&& build) {
+    inflight_.push_back(TransferPool().Submit(std::forward<F>(build)));
+    return Drain(max_inflight_ - 1);
   }
-  LOG_INFO("FileSender send file {}, total size {}, file_id={}",
-           path.string().c_str(), total_size, file_id);
 
-  if (file_id == 0) {
-    file_id = NextFileId();
+  int Push(std::vector<char> chunk) {
+    if (inflight_.empty()) {
+      return send_(chunk.data(), chunk.size());
+    }
+
+    std::promise<std::vector<char>> ready;
+    ready.set_value(std::move(chunk));
+    inflight_.push_back(ready.get_future());
+    return Drain(max_inflight_ - 1);
+  }
+
+  int Flush() { return Drain(0); }
+
+ private:
+  int Drain(size_t keep) {
+    while (inflight_.size() > keep) {
+      std::vector<char> chunk = inflight_.front().get();
+      inflight_.pop_front();
+      int ret = send_(chunk.data(), chunk.size());
+      if (ret != 0) {
+        return ret;
+      }
+    }
+    return 0;
   }
-  const uint32_t final_file_id = file_id;
+
+ private:
+  const FileSender::SendFunc& send_;
+  size_t max_inflight_;
+  std::deque<std::future<std::vector<char>>> inflight_;
+};
+
+// stream `total_size` bytes of `ifs` as FileChunkHeader chunks, returns
+// kFileReadError when fewer bytes can be read. With `integrity` every chunk carries a CRC and the last one the digest of
+// everything read, hashed here on the reading thread so there is no second
+// pass over the file.
+int StreamFileChunks(std::ifstream& ifs, uint32_t file_id, uint64_t total_size,
+                     const std::string* file_name, std::size_t chunk_size,
+                     const std::function<FileChunkCodec()>& negotiated_codec,
+                     ChunkPipeline& pipeline, bool integrity) {
   uint64_t offset = 0;
   bool is_first = true;
-  std::string file_name = label.empty() ? path.filename().string() : label;
-
-  std::vector<char> buffer;
-  buffer.resize(chunk_size);
+  FileDigest digest;
 
-  while (ifs && offset < total_size) {
+  // an empty file still needs one first+last chunk to be created remotely
+  while (offset < total_size || (is_first && total_size == 0)) {
     uint64_t remaining = total_size - offset;
     uint32_t to_read =
         static_cast<uint32_t>(std::min<uint64_t>(remaining, chunk_size));
 
-    ifs.read(buffer.data(), static_cast<std::streamsize>(to_read));
-    std::streamsize bytes_read = ifs.gcount();
-    if (bytes_read <= 0) {
-      break;
+    std::vector<char> buffer(to_read);
+    std::streamsize bytes_read = 0;
+    if (ifs) {
+      ifs.read(buffer.data(), static_cast<std::streamsize>(to_read));
+      bytes_read = ifs.gcount();
+    }
+    if (bytes_read < static_cast<std::streamsize>(to_read)) {
+      LOG_ERROR("FileSender: file_id={} shrank or failed to read at offset {}",
+                file_id, offset);
+      return kFileReadError;
     }
 
-    bool is_last = (offset + static_cast<uint64_t>(bytes_read) >= total_size);
-    const std::string* name_ptr = is_first ? &file_name : nullptr;
+    bool is_last = (offset + buffer.size() >= total_size);
+    const std::string* name_ptr = is_first ? file_name : nullptr;
 
-    std::vector<char> chunk = BuildChunk(
-        final_file_id, offset, total_size, buffer.data(),
-        static_cast<uint32_t>(bytes_read), name_ptr, is_first, is_last);
+    FileChunkDigest file_digest{};
+    if (integrity) {
+      digest.Update(buffer.data(), buffer.size());
+      if (is_last) {
+        file_digest = digest.Final();
+      }
+    }
 
-    int ret = send(chunk.data(), chunk.size());
+    int ret = 0;
+    FileChunkCodec codec = negotiated_codec();
+    if (codec == FileChunkCodec::None && !integrity) {
+      ret = pipeline.Push(FileSender::BuildChunk(
+          file_id, offset, total_size, buffer.data(),
+          static_cast<uint32_t>(buffer.size()), name_ptr, is_first, is_last));
+    } else {
+      // compression and CRC run on the pool
+      std::string name = name_ptr ? *name_ptr : std::string();
+      bool has_name = name_ptr != nullptr;
+      bool has_digest = integrity && is_last;
+      ret = pipeline.Submit([file_id, offset, total_size,
+                             data = std::move(buffer), name = std::move(name),
+                             has_name, is_first, is_last, codec, integrity,
+                             has_digest, file_digest]() {
+        return FileSender::BuildCompressedChunk(
+            file_id, offset, total_size, data.data(),
+            static_cast<uint32_t>(data.size()), has_name ? &name : nullptr,
+            is_first, is_last, codec, integrity,
+            has_digest ? &file_digest : nullptr);
+      });
+    }
     if (ret != 0) {
-      LOG_ERROR("FileSender::SendFile: send failed for [{}], ret={}",
-                path.string().c_str(), ret);
       return ret;
     }
 
-    offset += static_cast<uint64_t>(bytes_read);
+    offset += to_read;
     is_first = false;
   }
 
   return 0;
 }
 
-std::vector<char> FileSender::BuildChunk(uint32_t file_id, uint64_t offset,
-                                         uint64_t total_size, const char* data,
-                                         uint32_t data_size,
-                                         const std::string* file_name,
-                                         bool is_first, bool is_last) {
+std::vector<char> BuildAbortChunk(uint32_t file_id, uint64_t total_size) {
   FileChunkHeader header{};
   header.magic = kFileChunkMagic;
   header.file_id = file_id;
-  header.offset = offset;
   header.total_size = total_size;
-  header.chunk_size = data_size;
-  header.name_len =
-      (file_name && is_first) ? static_cast<uint16_t>(file_name->size()) : 0;
-  header.flags = 0;
-  if (is_first) header.flags |= 0x01;
-  if (is_last) header.flags |= 0x02;
-
-  std::size_t total_size_bytes =
-      sizeof(FileChunkHeader) + header.name_len + header.chunk_size;
+  header.flags = kFileChunkFirst | kFileChunkLast | kFileChunkAbort;
 
-  std::vector<char> buffer;
-  buffer.resize(total_size_bytes);
-
-  std::size_t offset_bytes = 0;
-  memcpy(buffer.data() + offset_bytes, &header, sizeof(FileChunkHeader));
-  offset_bytes += sizeof(FileChunkHeader);
+  std::vector<char> buffer(sizeof(FileChunkHeader));
+  memcpy(buffer.data(), &header, sizeof(FileChunkHeader));
+  return buffer;
+}
 
-  if (header.name_len > 0 && file_name) {
-    memcpy(buffer.data() + offset_bytes, file_name->data(), header.name_len);
-    offset_bytes += header.name_len;
-  }
+std::vector<char> BuildManifestPage(uint32_t session_id, uint32_t first_entry,
+                                    uint32_t entry_count,
+                                    uint32_t total_entries, uint64_t total_size,
+                                    const std::vector<char>& entries,
+                                    bool is_last) {
+  FileManifestHeader header{};
+  header.magic = kFileManifestMagic;
+  header.session_id = session_id;
+  header.first_entry = first_entry;
+  header.entry_count = entry_count;
+  header.total_entries = total_entries;
+  header.total_size = total_size;
+  header.payload_size = static_cast<uint32_t>(entries.size());
+  header.flags = is_last ? kFileManifestLast : 0;
 
-  if (header.chunk_size > 0 && data) {
-    memcpy(buffer.data() + offset_bytes, data, header.chunk_size);
+  std::vector<char> buffer(sizeof(FileManifestHeader) + entries.size());
+  memcpy(buffer.data(), &header, sizeof(FileManifestHeader));
+  if (!entries.empty()) {
+    memcpy(buffer.data() + sizeof(FileManifestHeader), entries.data(),
+           entries.size());
   }
-
   return buffer;
 }
 
-// ---------- FileReceiver ----------
+// C++17 has no clock_cast, convert through the current time of both clocks.
+int64_t ToUnixMicros(std::filesystem::file_time_type time) {
+  auto system_time =
+      std::chrono::system_clock::now() +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          time - std::filesystem::file_time_type::clock::now());
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             system_time.time_since_epoch())
+      .count();
+}
 
-FileReceiver::FileReceiver() : output_dir_(GetDefaultDesktopPath()) {}
+std::filesystem::file_time_type FromUnixMicros(int64_t micros) {
+  std::chrono::system_clock::time_point system_time(
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::microseconds(micros)));
+  return std::filesystem::file_time_type::clock::now() +
+         std::chrono::duration_cast<std::filesystem::file_time_type::duration>(
+             system_time - std::chrono::system_clock::now());
+}
 
-FileReceiver::FileReceiver(const std::filesystem::path& output_dir)
-    : output_dir_(output_dir) {
+void ApplyMetadata(const std::filesystem::path& path, uint32_t mode,
+                   int64_t mtime_us) {
   std::error_code ec;
-  if (!output_dir_.empty()) {
-    std::filesystem::create_directories(output_dir_, ec);
-    if (ec) {
-      LOG_ERROR("FileReceiver: failed to create output dir [{}]: {}",
-                output_dir_.string().c_str(), ec.message().c_str());
-    }
+  // only the rwx bits are taken from the peer, never setuid, setgid or sticky
+  if (mode != 0) {
+    std::filesystem::permissions(
+        path, static_cast<std::filesystem::perms>(mode) &
+                  std::filesystem::perms::all,
+        ec);
+  }
+  std::filesystem::last_write_time(path, FromUnixMicros(mtime_us), ec);
+  if (ec) {
+    LOG_WARN("FileReceiver: failed to restore mtime of [{}]: {}",
+             path.string().c_str(), ec.message().c_str());
   }
 }
 
-std::filesystem::path FileReceiver::GetDefaultDesktopPath() {
-#ifdef _WIN32
-  const char* home_env = std::getenv("USERPROFILE");
-#else
-  const char* home_env = std::getenv("HOME");
-#endif
-  if (!home_env) {
-    return std::filesystem::path{};
+std::filesystem::path UniquePath(const std::filesystem::path& path) {
+  std::error_code ec;
+  if (!std::filesystem::exists(path, ec)) {
+    return path;
   }
 
-  std::filesystem::path desktop_path =
-      std::filesystem::path(home_env) / "Desktop";
+  auto now = std::chrono::system_clock::now();
+  auto ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now.time_since_epoch())
+                .count();
+  return path.parent_path() / (path.stem().string() + "_" + std::to_string(ts) +
+                               path.extension().string());
+}
 
-  std::error_code ec;
-  std::filesystem::create_directories(desktop_path, ec);
-  if (ec) {
-    LOG_ERROR("FileReceiver: failed to create desktop directory [{}]: {}",
-              desktop_path.string().c_str(), ec.message().c_str());
+// rsync style weak checksum, can be rolled forward one byte at a time.
+class RollingChecksum {
+ public:
+  void Init(const unsigned char* data, size_t size) {
+    a_ = 0;
+    b_ = 0;
+    size_ = static_cast<uint32_t>(size);
+    for (size_t i = 0; i < size; ++i) {
+      a_ += data[i];
+      b_ += static_cast<uint32_t>(size - i) * data[i];
+    }
   }
 
-  return desktop_path;
+  void Roll(unsigned char out, unsigned char in) {
+    a_ += static_cast<uint32_t>(in) - out;
+    b_ += a_ - size_ * out;
+  }
+
+  uint32_t Value() const { return (a_ & 0xFFFF) | (b_ << 16); }
+
+ private:
+  uint32_t a_ = 0;
+  uint32_t b_ = 0;
+  uint32_t size_ = 0;
+};
+
+uint32_t DeltaBlockSize(uint64_t file_size) {
+  uint64_t block = static_cast<uint64_t>(std::sqrt(static_cast<double>(file_size)));
+  block = (block + 1023) & ~static_cast<uint64_t>(1023);
+  return static_cast<uint32_t>(std::clamp<uint64_t>(block, kMinDeltaBlockSize,
+                                                    kMaxDeltaBlockSize));
 }
 
-bool FileReceiver::OnData(const char* data, size_t size) {
-  if (!data || size < sizeof(FileChunkHeader)) {
-    LOG_ERROR("FileReceiver::OnData: invalid buffer");
-    return false;
-  }
+// only a plain file name is accepted for a single file or a delta target.
+bool IsPlainFileName(const std::string& name) {
+  return !name.empty() && name != "." && name != ".." &&
+         name.find_first_of("/\\") == std::string::npos
+#ifdef _WIN32
+         && name.find(':') == std::string::npos
+#endif
+      ;
+}
 
-  FileChunkHeader header{};
-  memcpy(&header, data, sizeof(FileChunkHeader));
+struct BlockSignatures {
+  uint32_t block_size = 0;
+  uint64_t basis_size = 0;
+  std::vector<FileBlockSignature> blocks;
+};
 
-  if (header.magic != kFileChunkMagic) {
+// the page continues `signatures` and describes the same copy the first one
+// did, every size in it comes from the peer.
+bool IsValidSignaturePage(const FileSignatureHeader& header,
+                          const BlockSignatures& signatures) {
+  if (header.block_size < kMinDeltaBlockSize ||
+      header.block_size > kMaxDeltaBlockSize ||
+      header.total_blocks > kMaxDeltaBlocks ||
+      header.total_blocks != (header.basis_size + header.block_size - 1) /
+                                 header.block_size) {
     return false;
   }
-
-  std::size_t header_and_name =
-      sizeof(FileChunkHeader) + static_cast<std::size_t>(header.name_len);
-  if (size < header_and_name ||
-      size < header_and_name + static_cast<std::size_t>(header.chunk_size)) {
-    LOG_ERROR("FileReceiver::OnData: buffer too small for header + payload");
+  if (!signatures.blocks.empty() &&
+      (header.block_size != signatures.block_size ||
+       header.basis_size != signatures.basis_size)) {
     return false;
   }
+  return header.first_block == signatures.blocks.size() &&
+         header.block_count <= header.total_blocks - header.first_block;
+}
 
-  const char* name_ptr = data + sizeof(FileChunkHeader);
-  std::string file_name;
-  const std::string* file_name_ptr = nullptr;
-  if (header.name_len > 0) {
-    file_name.assign(name_ptr,
-                     name_ptr + static_cast<std::size_t>(header.name_len));
-    file_name_ptr = &file_name;
+// signature pages arrive on the feedback channel, which is read by another
+// thread than the one sending the file.
+struct SignatureWait {
+  std::mutex mutex;
+  std::condition_variable cv;
+  BlockSignatures signatures;
+  bool done = false;
+  std::chrono::steady_clock::time_point last_update;
+};
+
+std::mutex g_signature_mutex;
+std::unordered_map<uint32_t, std::shared_ptr<SignatureWait>> g_signature_waits;
+
+// hash blocks [first_block, first_block + block_count) of `path`.
+std::vector<FileBlockSignature> HashBlocks(const std::filesystem::path& path,
+                                           uint32_t block_size,
+                                           uint64_t basis_size,
+                                           uint32_t first_block,
+                                           uint32_t block_count) {
+  std::vector<FileBlockSignature> blocks;
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) {
+    return blocks;
   }
+  ifs.seekg(static_cast<std::streamoff>(first_block) * block_size,
+            std::ios::beg);
 
-  const char* payload = data + header_and_name;
-  std::size_t payload_size =
-      static_cast<std::size_t>(header.chunk_size);  // may be 0
+  blocks.reserve(block_count);
+  std::vector<char> buffer(block_size);
+  for (uint32_t i = 0; i < block_count; ++i) {
+    uint64_t offset = static_cast<uint64_t>(first_block + i) * block_size;
+    size_t size = static_cast<size_t>(
+        std::min<uint64_t>(block_size, basis_size - offset));
+    ifs.read(buffer.data(), static_cast<std::streamsize>(size));
+    if (ifs.gcount() != static_cast<std::streamsize>(size)) {
+      blocks.clear();
+      return blocks;
+    }
 
-  return HandleChunk(header, payload, payload_size, file_name_ptr);
+    RollingChecksum weak;
+    weak.Init(reinterpret_cast<const unsigned char*>(buffer.data()), size);
+    FileBlockSignature block{};
+    block.weak = weak.Value();
+    block.strong = XXH3_64bits(buffer.data(), size);
+    blocks.push_back(block);
+  }
+  return blocks;
 }
 
-bool FileReceiver::HandleChunk(const FileChunkHeader& header,
-                               const char* payload, size_t payload_size,
-                               const std::string* file_name) {
-  auto it = contexts_.find(header.file_id);
-  if (it == contexts_.end()) {
-    // new file context must start with first chunk.
-    if ((header.flags & 0x01) == 0) {
-      LOG_ERROR("FileReceiver: received non-first chunk for unknown file_id={}",
-                header.file_id);
-      return false;
+std::vector<char> BuildSignaturePage(uint32_t file_id, uint32_t block_size,
+                                     uint64_t basis_size, uint32_t first_block,
+                                     uint32_t total_blocks,
+                                     const std::vector<FileBlockSignature>& blocks,
+                                     bool is_last) {
+  FileSignatureHeader header{};
+  header.magic = kFileSignatureMagic;
+  header.file_id = file_id;
+  header.block_size = block_size;
+  header.basis_size = basis_size;
+  header.first_block = first_block;
+  header.block_count = static_cast<uint32_t>(blocks.size());
+  header.total_blocks = total_blocks;
+  header.flags = is_last ? kFileSignatureLast : 0;
+
+  size_t blocks_size = blocks.size() * sizeof(FileBlockSignature);
+  std::vector<char> buffer(sizeof(FileSignatureHeader) + blocks_size);
+  memcpy(buffer.data(), &header, sizeof(FileSignatureHeader));
+  if (blocks_size > 0) {
+    memcpy(buffer.data() + sizeof(FileSignatureHeader), blocks.data(),
+           blocks_size);
+  }
+  return buffer;
+}
+
+// hash the receiver's copy on the transfer pool, a bounded number of tasks
+// ahead, and send the signature pages in order as they complete. Stops early
+// once `cancelled` is set or a page can not be sent.
+void SendSignatures(const std::filesystem::path& path, uint32_t file_id,
+                    uint32_t block_size, uint64_t basis_size,
+                    const FileReceiver::OnSendFeedback& send,
+                    const std::atomic<bool>& cancelled) {
+  const uint32_t total_blocks =
+      static_cast<uint32_t>((basis_size + block_size - 1) / block_size);
+  const uint32_t task_blocks = static_cast<uint32_t>(
+      std::max<uint64_t>(1, kSignatureTaskBytes / block_size));
+  const uint32_t page_blocks = static_cast<uint32_t>(
+      (64 * 1024 - sizeof(FileSignatureHeader)) / sizeof(FileBlockSignature));
+  const size_t max_inflight = TransferPool().Size() * 2;
+
+  if (total_blocks == 0) {
+    std::vector<char> buffer = BuildSignaturePage(file_id, block_size,
+                                                  basis_size, 0, 0, {}, true);
+    send(buffer.data(), buffer.size());
+    return;
+  }
+
+  std::deque<std::future<std::vector<FileBlockSignature>>> inflight;
+  std::vector<FileBlockSignature> page;
+  uint32_t next_task_block = 0;
+  uint32_t done_blocks = 0;
+  uint32_t page_first = 0;
+
+  while (done_blocks < total_blocks) {
+    while (next_task_block < total_blocks && inflight.size() < max_inflight) {
+      uint32_t count = std::min(task_blocks, total_blocks - next_task_block);
+      inflight.push_back(TransferPool().Submit(
+          [path, block_size, basis_size, first = next_task_block, count]() {
+            return HashBlocks(path, block_size, basis_size, first, count);
+          }));
+      next_task_block += count;
     }
 
-    FileContext ctx;
-    ctx.total_size = header.total_size;
+    uint32_t expected = std::min(task_blocks, total_blocks - done_blocks);
+    std::vector<FileBlockSignature> blocks = inflight.front().get();
+    inflight.pop_front();
+    if (cancelled) {
+      for (auto& job : inflight) {
+        job.wait();
+      }
+      return;
+    }
+    if (blocks.size() != expected) {
+      // the copy changed underneath, block size 0 makes the sender fall back
+      // to a full transfer.
+      LOG_ERROR("FileReceiver: failed to hash [{}]", path.string().c_str());
+      for (auto& job : inflight) {
+        job.wait();
+      }
+      std::vector<char> buffer =
+          BuildSignaturePage(file_id, 0, 0, 0, 0, {}, true);
+      send(buffer.data(), buffer.size());
+      return;
+    }
+    done_blocks += expected;
 
-    std::string filename;
-    if (file_name && !file_name->empty()) {
-      filename = *file_name;
-    } else {
-      filename = "received_" + std::to_string(header.file_id);
+    for (const auto& block : blocks) {
+      page.push_back(block);
+      bool is_last = page_first + page.size() >= total_blocks;
+      if (page.size() >= page_blocks || is_last) {
+        std::vector<char> buffer =
+            BuildSignaturePage(file_id, block_size, basis_size, page_first,
+                               total_blocks, page, is_last);
+        if (send(buffer.data(), buffer.size()) != 0) {
+          LOG_WARN("FileReceiver: feedback channel closed, stop hashing [{}]",
+                   path.string().c_str());
+          for (auto& job : inflight) {
+            job.wait();
+          }
+          return;
+        }
+        page_first += static_cast<uint32_t>(page.size());
+        page.clear();
+      }
     }
+  }
+}
 
-    ctx.file_name = filename;
+// accumulates delta ops into FileDeltaHeader messages of about one chunk.
+class DeltaWriter {
+ public:
+  DeltaWriter(uint32_t file_id, uint64_t total_size, std::size_t chunk_size,
+              const std::function<FileChunkCodec()>& negotiated_codec,
+              ChunkPipeline& pipeline)
+      : file_id_(file_id),
+        total_size_(total_size),
+        chunk_size_(chunk_size),
+        negotiated_codec_(negotiated_codec),
+        pipeline_(pipeline) {}
 
-    std::filesystem::path save_path = output_dir_.empty()
-                                          ? std::filesystem::path(filename)
-                                          : output_dir_ / filename;
+  int Literal(const char* data, size_t size) {
+    while (size > 0) {
+      uint32_t part =
+          static_cast<uint32_t>(std::min<size_t>(size, chunk_size_));
+      AppendOp(FileDeltaOpType::Literal, 0, part);
+      ops_.insert(ops_.end(), data, data + part);
+      output_ += part;
+      data += part;
+      size -= part;
+      int ret = MaybeFlush();
+      if (ret != 0) {
+        return ret;
+      }
+    }
+    return 0;
+  }
 
-    // if file exists, append timestamp.
-    std::error_code ec;
-    if (std::filesystem::exists(save_path, ec)) {
-      auto now = std::chrono::system_clock::now();
-      auto ts = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    now.time_since_epoch())
-                    .count();
-      save_path = save_path.parent_path() /
-                  (save_path.stem().string() + "_" + std::to_string(ts) +
-                   save_path.extension().string());
+  int Copy(uint32_t block, uint64_t length) {
+    // extend the previous copy when blocks are consecutive
+    if (last_copy_op_ != SIZE_MAX && last_copy_end_ == block) {
+      FileDeltaOp op{};
+      memcpy(&op, ops_.data() + last_copy_op_, sizeof(FileDeltaOp));
+      ++op.length;
+      memcpy(ops_.data() + last_copy_op_, &op, sizeof(FileDeltaOp));
+    } else {
+      AppendOp(FileDeltaOpType::Copy, block, 1);
+      last_copy_op_ = ops_.size() - sizeof(FileDeltaOp);
     }
+    last_copy_end_ = block + 1;
+    output_ += length;
+    return MaybeFlush();
+  }
 
-    ctx.ofs.open(save_path, std::ios::binary | std::ios::trunc);
-    if (!ctx.ofs.is_open()) {
-      LOG_ERROR("FileReceiver: failed to open [{}] for writing",
-                save_path.string().c_str());
-      return false;
+  int Finish(const FileChunkDigest* digest) {
+    if (digest) {
+      digest_ = *digest;
+      has_digest_ = true;
     }
+    return Flush(true);
+  }
 
-    contexts_.emplace(header.file_id, std::move(ctx));
-    it = contexts_.find(header.file_id);
+ private:
+  void AppendOp(FileDeltaOpType type, uint32_t first_block, uint32_t length) {
+    FileDeltaOp op{};
+    op.type = static_cast<uint8_t>(type);
+    op.first_block = first_block;
+    op.length = length;
+    const char* ptr = reinterpret_cast<const char*>(&op);
+    ops_.insert(ops_.end(), ptr, ptr + sizeof(FileDeltaOp));
+    last_copy_op_ = SIZE_MAX;
   }
 
-  FileContext& ctx = it->second;
+  int MaybeFlush() { return ops_.size() >= chunk_size_ ? Flush(false) : 0; }
 
-  if (payload_size > 0 && payload) {
-    ctx.ofs.seekp(static_cast<std::streamoff>(header.offset), std::ios::beg);
-    ctx.ofs.write(payload, static_cast<std::streamsize>(payload_size));
-    if (!ctx.ofs.good()) {
-      LOG_ERROR("FileReceiver: write failed for file_id={}", header.file_id);
-      return false;
+  int Flush(bool is_last) {
+    if (ops_.empty() && !is_last) {
+      return 0;
     }
-    ctx.received += static_cast<uint64_t>(payload_size);
+
+    bool has_digest = is_last && has_digest_;
+    auto build = [file_id = file_id_, offset = message_offset_,
+                  total_size = total_size_, ops = std::move(ops_), is_last,
+                  codec = negotiated_codec_(), has_digest,
+                  digest = digest_]() {
+      std::vector<char> encoded;
+      bool compressed = CompressPayload(
+          ops.data(), static_cast<uint32_t>(ops.size()), codec, encoded);
+      const std::vector<char>& payload = compressed ? encoded : ops;
+
+      FileDeltaHeader header{};
+      header.magic = kFileDeltaMagic;
+      header.file_id = file_id;
+      header.offset = offset;
+      header.total_size = total_size;
+      header.payload_size = static_cast<uint32_t>(payload.size());
+      header.flags = (is_last ? kFileChunkLast : 0) |
+                     (compressed ? kFileChunkCompressed : 0) |
+                     (has_digest ? kFileChunkDigest : 0);
+
+      size_t codec_size = compressed ? sizeof(FileChunkCodecHeader) : 0;
+      size_t digest_size = has_digest ? sizeof(FileChunkDigest) : 0;
+      std::vector<char> buffer(sizeof(FileDeltaHeader) + codec_size +
+                               digest_size + payload.size());
+      char* ptr = buffer.data();
+      memcpy(ptr, &header, sizeof(FileDeltaHeader));
+      ptr += sizeof(FileDeltaHeader);
+      if (compressed) {
+        FileChunkCodecHeader codec_header{};
+        codec_header.codec = static_cast<uint8_t>(codec);
+        codec_header.raw_size = static_cast<uint32_t>(ops.size());
+        memcpy(ptr, &codec_header, codec_size);
+        ptr += codec_size;
+      }
+      if (has_digest) {
+        memcpy(ptr, &digest, digest_size);
+        ptr += digest_size;
+      }
+      if (!payload.empty()) {
+        memcpy(ptr, payload.data(), payload.size());
+      }
+      return buffer;
+    };
+
+    ops_.clear();
+    last_copy_op_ = SIZE_MAX;
+    message_offset_ = output_;
+    return pipeline_.Submit(std::move(build));
   }
 
-  // Send ACK after processing chunk
-  if (on_send_ack_) {
-    FileTransferAck ack{};
-    ack.magic = kFileAckMagic;
-    ack.file_id = header.file_id;
-    ack.acked_offset = header.offset + static_cast<uint64_t>(payload_size);
-    ack.total_size = header.total_size;
-    ack.flags = 0;
+ private:
+  uint32_t file_id_;
+  uint64_t total_size_;
+  std::size_t chunk_size_;
+  const std::function<FileChunkCodec()>& negotiated_codec_;
+  ChunkPipeline& pipeline_;
+  std::vector<char> ops_;
+  uint64_t output_ = 0;
+  uint64_t message_offset_ = 0;
+  size_t last_copy_op_ = SIZE_MAX;
+  uint32_t last_copy_end_ = 0;
+  FileChunkDigest digest_{};
+  bool has_digest_ = false;
+};
 
-    bool is_last = (header.flags & 0x02) != 0;
-    if (is_last || ctx.received >= ctx.total_size) {
-      ack.flags |= 0x01;  // completed
-    }
+// files and sessions recently sent with checksums, so NACKed ranges can be
+// resent after SendFile or SendSession returned. Dropped on the completion
+// ACK.
+struct RepairSource {
+  std::shared_ptr<const FileSender::RepairFiles> files;
+  FileSender::SendFunc send;
+  uint64_t sequence = 0;
+  std::string owner;
+};
 
-    int ret = on_send_ack_(ack);
-    if (ret != 0) {
-      LOG_ERROR("FileReceiver: failed to send ACK for file_id={}, ret={}",
-                header.file_id, ret);
+std::mutex g_repair_mutex;
+std::unordered_map<uint32_t, RepairSource> g_repair_sources;
+uint64_t g_repair_sequence = 0;
+
+void ResendRange(uint32_t file_id, const FileChunkNack& nack) {
+  RepairSource source;
+  {
+    std::lock_guard<std::mutex> lock(g_repair_mutex);
+    // files of a session are registered under the session id
+    auto it = g_repair_sources.find(file_id);
+    if (it == g_repair_sources.end()) {
+      it = std::find_if(g_repair_sources.begin(), g_repair_sources.end(),
+                        [file_id](const auto& entry) {
+                          return entry.second.files->count(file_id) > 0;
+                        });
+    }
+    if (it == g_repair_sources.end()) {
+      LOG_WARN("FileSender: NACK for unknown file_id={}", file_id);
+      return;
     }
+    source = it->second;
   }
 
-  bool is_last = (header.flags & 0x02) != 0;
-  if (is_last || ctx.received >= ctx.total_size) {
-    ctx.ofs.close();
+  const auto& [path, total_size] = source.files->at(file_id);
+  if (nack.offset >= total_size) {
+    return;
+  }
+  uint32_t length = static_cast<uint32_t>(
+      std::min<uint64_t>(std::min<uint64_t>(nack.length, kMaxRawChunkSize),
+                         total_size - nack.offset));
 
-    std::filesystem::path saved_path =
-        output_dir_.empty() ? std::filesystem::path(ctx.file_name)
-                            : output_dir_ / ctx.file_name;
+  std::ifstream ifs(path, std::ios::binary);
+  std::vector<char> buffer(length);
+  ifs.seekg(static_cast<std::streamoff>(nack.offset), std::ios::beg);
+  ifs.read(buffer.data(), static_cast<std::streamsize>(length));
+  if (ifs.gcount() != static_cast<std::streamsize>(length)) {
+    LOG_ERROR("FileSender: failed to reread [{}] for repair",
+              path.string().c_str());
+    return;
+  }
+
+  LOG_WARN("FileSender: resending damaged range, file_id={}, offset={}, "
+           "length={}",
+           file_id, nack.offset, length);
+  std::vector<char> chunk = FileSender::BuildCompressedChunk(
+      file_id, nack.offset, total_size, buffer.data(), length, nullptr,
+      false, false, FileChunkCodec::None, true);
+  source.send(chunk.data(), chunk.size());
+}
+}  // namespace
 
-    LOG_INFO("FileReceiver: file received complete, file_id={}, size={}",
-             header.file_id, ctx.received);
+uint32_t FileSender::NextFileId() { return g_next_file_id.fetch_add(1); }
 
-    contexts_.erase(header.file_id);
+struct FileDigest::State {
+  XXH3_state_t* state = nullptr;
+};
+
+FileDigest::FileDigest() : state_(std::make_unique<State>()) {
+  state_->state = XXH3_createState();
+  XXH3_128bits_reset(state_->state);
+}
+
+FileDigest::~FileDigest() {
+  if (state_) {
+    XXH3_freeState(state_->state);
+  }
+}
+
+FileDigest::FileDigest(FileDigest&& other) noexcept = default;
+FileDigest& FileDigest::operator=(FileDigest&& other) noexcept = default;
+
+void FileDigest::Update(const void* data, size_t size) {
+  XXH3_128bits_update(state_->state, data, size);
+}
+
+FileChunkDigest FileDigest::Final() const {
+  XXH128_hash_t hash = XXH3_128bits_digest(state_->state);
+  FileChunkDigest digest{};
+  digest.low64 = hash.low64;
+  digest.high64 = hash.high64;
+  return digest;
+}
+
+uint32_t FileSender::SupportedCodecs() {
+  return CodecBit(FileChunkCodec::Lz4);
+}
+
+FileChunkCodec FileSender::NegotiatedCodec() const {
+  if (!compression_enabled_ || !peer_caps_) {
+    return FileChunkCodec::None;
+  }
+
+  uint32_t codecs = peer_caps_() & SupportedCodecs();
+  if (codecs & CodecBit(FileChunkCodec::Lz4)) {
+    return FileChunkCodec::Lz4;
   }
+  return FileChunkCodec::None;
+}
 
+bool FileSender::NegotiatedIntegrity() const {
+  return peer_caps_ && (peer_caps_() & kFileAckIntegrity) != 0;
+}
+
+void FileSender::RegisterRepairSource(uint32_t file_id,
+                                      const std::filesystem::path& path,
+                                      uint64_t total_size, const SendFunc& send,
+                                      const std::string& owner) {
+  RepairFiles files;
+  files.emplace(file_id, std::make_pair(path, total_size));
+  RegisterRepairSource(file_id, std::move(files), send, owner);
+}
+
+void FileSender::RegisterRepairSource(uint32_t session_id, RepairFiles files,
+                                      const SendFunc& send,
+                                      const std::string& owner) {
+  auto shared_files = std::make_shared<const RepairFiles>(std::move(files));
+  std::lock_guard<std::mutex> lock(g_repair_mutex);
+  if (g_repair_sources.size() >= kMaxRepairSources) {
+    // transfers that never completed, forget the oldest
+    auto oldest = std::min_element(
+        g_repair_sources.begin(), g_repair_sources.end(),
+        [](const auto& a, const auto& b) {
+          return a.second.sequence < b.second.sequence;
+        });
+    g_repair_sources.erase(oldest);
+  }
+  g_repair_sources[session_id] = {std::move(shared_files), send,
+                                  ++g_repair_sequence, owner};
+}
+
+void FileSender::DropRepairSources(const std::string& owner) {
+  std::lock_guard<std::mutex> lock(g_repair_mutex);
+  for (auto it = g_repair_sources.begin(); it != g_repair_sources.end();) {
+    if (it->second.owner == owner) {
+      it = g_repair_sources.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+int FileSender::SendFile(const std::filesystem::path& path,
+                         const std::string& label, const SendFunc& send,
+                         std::size_t chunk_size, uint32_t file_id) {
+  if (!send) {
+    LOG_ERROR("FileSender::SendFile: send function is empty");
+    return -1;
+  }
+
+  std::error_code ec;
+  if (!std::filesystem::exists(path, ec) ||
+      !std::filesystem::is_regular_file(path, ec)) {
+    LOG_ERROR("FileSender::SendFile: file [{}] not found or not regular",
+              path.string().c_str());
+    return -1;
+  }
+
+  uint64_t total_size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    LOG_ERROR("FileSender::SendFile: failed to get size of [{}]: {}",
+              path.string().c_str(), ec.message().c_str());
+    return -1;
+  }
+
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) {
+    LOG_ERROR("FileSender::SendFile: failed to open [{}]",
+              path.string().c_str());
+    return -1;
+  }
+  LOG_INFO("FileSender send file {}, total size {}, file_id={}",
+           path.string().c_str(), total_size, file_id);
+
+  if (file_id == 0) {
+    file_id = NextFileId();
+  }
+  std::string file_name = label.empty() ? path.filename().string() : label;
+
+  bool integrity = NegotiatedIntegrity();
+  if (integrity) {
+    RegisterRepairSource(file_id, path, total_size, send, owner_);
+  }
+
+  ChunkPipeline pipeline(send);
+  int ret = StreamFileChunks(
+      ifs, file_id, total_size, &file_name, chunk_size,
+      [this]() { return NegotiatedCodec(); }, pipeline, integrity);
+  if (ret == 0) {
+    ret = pipeline.Flush();
+  }
+  if (ret != 0) {
+    LOG_ERROR("FileSender::SendFile: send failed for [{}], ret={}",
+              path.string().c_str(), ret);
+    return ret;
+  }
+
+  return 0;
+}
+
+int FileSender::SendFileDelta(const std::filesystem::path& path,
+                              const std::string& label, const SendFunc& send,
+                              std::size_t chunk_size, uint32_t file_id) {
+  if (!send) {
+    LOG_ERROR("FileSender::SendFileDelta: send function is empty");
+    return -1;
+  }
+
+  std::error_code ec;
+  uint64_t total_size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    LOG_ERROR("FileSender::SendFileDelta: failed to get size of [{}]: {}",
+              path.string().c_str(), ec.message().c_str());
+    return -1;
+  }
+
+  if (file_id == 0) {
+    file_id = NextFileId();
+  }
+  std::string file_name = label.empty() ? path.filename().string() : label;
+
+  auto wait = std::make_shared<SignatureWait>();
+  wait->last_update = std::chrono::steady_clock::now();
+  {
+    std::lock_guard<std::mutex> lock(g_signature_mutex);
+    g_signature_waits[file_id] = wait;
+  }
+
+  FileDeltaRequest request{};
+  request.magic = kFileDeltaRequestMagic;
+  request.file_id = file_id;
+  request.total_size = total_size;
+  request.name_len = static_cast<uint16_t>(file_name.size());
+  std::vector<char> request_buffer(sizeof(FileDeltaRequest) + request.name_len);
+  memcpy(request_buffer.data(), &request, sizeof(FileDeltaRequest));
+  memcpy(request_buffer.data() + sizeof(FileDeltaRequest), file_name.data(),
+         request.name_len);
+  int ret = send(request_buffer.data(), request_buffer.size());
+
+  // the receiver may take a while to hash a large copy, only give up when
+  // it stops making progress.
+  if (ret == 0) {
+    std::unique_lock<std::mutex> lock(wait->mutex);
+    while (!wait->done) {
+      auto deadline = wait->last_update + kSignatureIdleTimeout;
+      if (wait->cv.wait_until(lock, deadline) == std::cv_status::timeout &&
+          std::chrono::steady_clock::now() >= wait->last_update +
+                                                  kSignatureIdleTimeout) {
+        break;
+      }
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(g_signature_mutex);
+    g_signature_waits.erase(file_id);
+  }
+  if (ret != 0) {
+    LOG_ERROR("FileSender::SendFileDelta: failed to send request, ret={}",
+              ret);
+    return ret;
+  }
+
+  // a feedback thread may still hold `wait`, so the lock is not kept while
+  // streaming. Late pages are ignored once done is set.
+  BlockSignatures signatures;
+  bool signatures_done = false;
+  {
+    std::lock_guard<std::mutex> lock(wait->mutex);
+    signatures_done = wait->done;
+    signatures = std::move(wait->signatures);
+    wait->done = true;
+  }
+  if (!signatures_done || signatures.block_size == 0) {
+    LOG_INFO("FileSender: no usable copy of [{}] on the receiver, sending it "
+             "in full",
+             file_name.c_str());
+    return SendFile(path, label, send, chunk_size, file_id);
+  }
+
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs.is_open()) {
+    LOG_ERROR("FileSender::SendFileDelta: failed to open [{}]",
+              path.string().c_str());
+    return -1;
+  }
+
+  // only full blocks are matched, a short tail block is sent as literal data
+  const uint32_t block_size = signatures.block_size;
+  const uint32_t full_blocks =
+      static_cast<uint32_t>(signatures.basis_size / block_size);
+  std::unordered_map<uint32_t, std::vector<uint32_t>> weak_index;
+  weak_index.reserve(full_blocks);
+  for (uint32_t i = 0; i < full_blocks; ++i) {
+    weak_index[signatures.blocks[i].weak].push_back(i);
+  }
+
+  LOG_INFO("FileSender send delta {}, total size {}, basis size {}, block {}",
+           path.string().c_str(), total_size, signatures.basis_size,
+           block_size);
+
+  ChunkPipeline pipeline(send);
+  std::function<FileChunkCodec()> negotiated_codec = [this]() {
+    return NegotiatedCodec();
+  };
+  DeltaWriter writer(file_id, total_size, chunk_size, negotiated_codec,
+                     pipeline);
+
+  bool integrity = NegotiatedIntegrity();
+  FileDigest digest;
+
+  // [begin, pos) is pending literal data, [pos, pos + block_size) the window
+  // being matched, [pos, end) what has been read ahead.
+  std::vector<char> buffer(chunk_size * 2 + block_size * 2);
+  size_t begin = 0;
+  size_t pos = 0;
+  size_t end = 0;
+  bool eof = false;
+  RollingChecksum rolling;
+  bool rolling_valid = false;
+  uint32_t next_block = UINT32_MAX;
+  uint64_t literal_bytes = 0;
+  uint64_t copied_bytes = 0;
+
+  auto data_at = [&buffer](size_t i) {
+    return reinterpret_cast<const unsigned char*>(buffer.data()) + i;
+  };
+
+  while (true) {
+    if (end - pos < static_cast<size_t>(block_size) + 1 && !eof) {
+      if (begin > 0) {
+        memmove(buffer.data(), buffer.data() + begin, end - begin);
+        pos -= begin;
+        end -= begin;
+        begin = 0;
+      }
+      ifs.read(buffer.data() + end,
+               static_cast<std::streamsize>(buffer.size() - end));
+      size_t bytes_read = static_cast<size_t>(ifs.gcount());
+      if (integrity) {
+        digest.Update(buffer.data() + end, bytes_read);
+      }
+      end += bytes_read;
+      eof = !ifs;
+      continue;
+    }
+    if (end - pos < block_size) {
+      break;
+    }
+
+    if (!rolling_valid) {
+      rolling.Init(data_at(pos), block_size);
+      rolling_valid = true;
+    }
+
+    uint32_t matched = UINT32_MAX;
+    auto it = weak_index.find(rolling.Value());
+    if (it != weak_index.end()) {
+      uint64_t strong = XXH3_64bits(data_at(pos), block_size);
+      for (uint32_t candidate : it->second) {
+        if (signatures.blocks[candidate].strong == strong) {
+          matched = candidate;
+          // staying on the next block keeps copies contiguous
+          if (candidate == next_block) {
+            break;
+          }
+        }
+      }
+    }
+
+    if (matched != UINT32_MAX) {
+      if (pos > begin) {
+        ret = writer.Literal(buffer.data() + begin, pos - begin);
+        literal_bytes += pos - begin;
+      }
+      if (ret == 0) {
+        ret = writer.Copy(matched, block_size);
+      }
+      if (ret != 0) {
+        break;
+      }
+      copied_bytes += block_size;
+      pos += block_size;
+      begin = pos;
+      rolling_valid = false;
+      next_block = matched + 1;
+      continue;
+    }
+
+    if (end - pos > block_size) {
+      rolling.Roll(*data_at(pos), *data_at(pos + block_size));
+    } else {
+      rolling_valid = false;
+    }
+    ++pos;
+
+    if (pos - begin >= chunk_size) {
+      ret = writer.Literal(buffer.data() + begin, pos - begin);
+      if (ret != 0) {
+        break;
+      }
+      literal_bytes += pos - begin;
+      begin = pos;
+    }
+  }
+
+  if (ret == 0 && end > begin) {
+    ret = writer.Literal(buffer.data() + begin, end - begin);
+    literal_bytes += end - begin;
+  }
+  if (ret == 0) {
+    FileChunkDigest file_digest = digest.Final();
+    ret = writer.Finish(integrity ? &file_digest : nullptr);
+  }
+  if (ret == 0) {
+    ret = pipeline.Flush();
+  }
+  if (ret != 0) {
+    LOG_ERROR("FileSender::SendFileDelta: send failed for [{}], ret={}",
+              path.string().c_str(), ret);
+    return ret;
+  }
+
+  LOG_INFO("FileSender delta of {} done, literal {} bytes, copied {} bytes",
+           file_name.c_str(), literal_bytes, copied_bytes);
+  return 0;
+}
+
+bool FileSender::OnFeedback(const char* data, size_t size) {
+  if (!data || size < sizeof(uint32_t)) {
+    return false;
+  }
+
+  uint32_t magic = 0;
+  memcpy(&magic, data, sizeof(uint32_t));
+  if (magic == kFileChunkNackMagic && size >= sizeof(FileChunkNack)) {
+    FileChunkNack nack{};
+    memcpy(&nack, data, sizeof(FileChunkNack));
+    ResendRange(nack.file_id, nack);
+    return true;
+  }
+  if (magic == kFileAckMagic && size >= sizeof(FileTransferAck)) {
+    FileTransferAck ack{};
+    memcpy(&ack, data, sizeof(FileTransferAck));
+    if (ack.flags & kFileAckCompleted) {
+      std::lock_guard<std::mutex> lock(g_repair_mutex);
+      g_repair_sources.erase(ack.file_id);
+    }
+    // the caller still handles the ack itself
+    return false;
+  }
+
+  if (size < sizeof(FileSignatureHeader)) {
+    return false;
+  }
+
+  FileSignatureHeader header{};
+  memcpy(&header, data, sizeof(FileSignatureHeader));
+  if (header.magic != kFileSignatureMagic) {
+    return false;
+  }
+
+  size_t blocks_size =
+      static_cast<size_t>(header.block_count) * sizeof(FileBlockSignature);
+  if (size < sizeof(FileSignatureHeader) + blocks_size) {
+    LOG_ERROR("FileSender: signature page too small, file_id={}",
+              header.file_id);
+    return true;
+  }
+
+  std::shared_ptr<SignatureWait> wait;
+  {
+    std::lock_guard<std::mutex> lock(g_signature_mutex);
+    auto it = g_signature_waits.find(header.file_id);
+    if (it != g_signature_waits.end()) {
+      wait = it->second;
+    }
+  }
+  if (!wait) {
+    // the sender already gave up waiting
+    return true;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(wait->mutex);
+    BlockSignatures& signatures = wait->signatures;
+    if (!wait->done && !IsValidSignaturePage(header, signatures)) {
+      // block_size 0 is the receiver saying it has no copy
+      if (header.block_size != 0) {
+        LOG_ERROR("FileSender: invalid signature page, file_id={}",
+                  header.file_id);
+      }
+      signatures.block_size = 0;
+      signatures.blocks.clear();
+      wait->done = true;
+    } else if (!wait->done) {
+      signatures.block_size = header.block_size;
+      signatures.basis_size = header.basis_size;
+      signatures.blocks.reserve(header.total_blocks);
+      const char* ptr = data + sizeof(FileSignatureHeader);
+      for (uint32_t i = 0; i < header.block_count; ++i) {
+        FileBlockSignature block{};
+        memcpy(&block, ptr + i * sizeof(FileBlockSignature),
+               sizeof(FileBlockSignature));
+        signatures.blocks.push_back(block);
+      }
+      wait->done = (header.flags & kFileSignatureLast) != 0;
+      if (wait->done && signatures.blocks.size() != header.total_blocks) {
+        signatures.block_size = 0;
+      }
+    }
+    wait->last_update = std::chrono::steady_clock::now();
+  }
+  wait->cv.notify_all();
+  return true;
+}
+
+std::vector<FileSender::SessionEntry> FileSender::CollectEntries(
+    const std::vector<std::filesystem::path>& paths) {
+  std::vector<SessionEntry> entries;
+
+  auto add_entry = [&entries](const std::filesystem::path& local_path,
+                              const std::string& relative_path,
+                              bool is_directory) {
+    std::error_code ec;
+    SessionEntry entry;
+    entry.local_path = local_path;
+    entry.relative_path = relative_path;
+    entry.type = is_directory ? FileEntryType::Directory : FileEntryType::File;
+    entry.size = is_directory ? 0 : std::filesystem::file_size(local_path, ec);
+    if (ec) {
+      LOG_WARN("FileSender: skip [{}]: {}", local_path.string().c_str(),
+               ec.message().c_str());
+      return;
+    }
+    entry.mode = static_cast<uint32_t>(
+        std::filesystem::status(local_path, ec).permissions());
+    entry.mtime_us =
+        ToUnixMicros(std::filesystem::last_write_time(local_path, ec));
+    entries.push_back(std::move(entry));
+  };
+
+  for (const auto& path : paths) {
+    std::error_code ec;
+    std::string root = path.filename().string();
+    if (std::filesystem::is_regular_file(path, ec)) {
+      add_entry(path, root, false);
+      continue;
+    }
+    if (!std::filesystem::is_directory(path, ec)) {
+      LOG_WARN("FileSender: skip [{}], not a file or directory",
+               path.string().c_str());
+      continue;
+    }
+
+    add_entry(path, root, true);
+    for (std::filesystem::recursive_directory_iterator
+             it(path,
+                std::filesystem::directory_options::skip_permission_denied,
+                ec),
+         end;
+         it != end; it.increment(ec)) {
+      if (ec) {
+        LOG_WARN("FileSender: error walking [{}]: {}", path.string().c_str(),
+                 ec.message().c_str());
+        break;
+      }
+      const std::filesystem::path& entry_path = it->path();
+      std::string relative =
+          root + "/" +
+          std::filesystem::relative(entry_path, path, ec).generic_string();
+      if (it->is_directory(ec)) {
+        add_entry(entry_path, relative, true);
+      } else if (it->is_regular_file(ec)) {
+        add_entry(entry_path, relative, false);
+      }
+    }
+  }
+
+  return entries;
+}
+
+int FileSender::SendSession(const std::vector<SessionEntry>& entries,
+                            const SendFunc& send, std::size_t chunk_size,
+                            uint32_t session_id) {
+  if (!send) {
+    LOG_ERROR("FileSender::SendSession: send function is empty");
+    return -1;
+  }
+
+  if (session_id == 0) {
+    session_id = NextFileId();
+  }
+
+  std::vector<uint32_t> file_ids(entries.size(), 0);
+  uint64_t total_size = 0;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (entries[i].type == FileEntryType::File) {
+      file_ids[i] = NextFileId();
+      total_size += entries[i].size;
+    }
+  }
+
+  LOG_INFO("FileSender send session {}, {} entries, total size {}",
+           session_id, entries.size(), total_size);
+
+  bool integrity = NegotiatedIntegrity();
+  if (integrity) {
+    RepairFiles files;
+    for (size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].type == FileEntryType::File && entries[i].size > 0) {
+        files.emplace(file_ids[i],
+                      std::make_pair(entries[i].local_path, entries[i].size));
+      }
+    }
+    RegisterRepairSource(session_id, std::move(files), send, owner_);
+  }
+
+  ChunkPipeline pipeline(send);
+  auto fail = [session_id](int ret) {
+    LOG_ERROR("FileSender::SendSession: send failed for session {}, ret={}",
+              session_id, ret);
+    return ret;
+  };
+
+  // manifest pages
+  const uint32_t total_entries = static_cast<uint32_t>(entries.size());
+  std::vector<char> page;
+  uint32_t first_entry = 0;
+  for (uint32_t i = 0; i <= total_entries; ++i) {
+    if (i < total_entries) {
+      const SessionEntry& entry = entries[i];
+      FileManifestEntry record{};
+      record.file_id = file_ids[i];
+      record.size = entry.size;
+      record.mtime_us = entry.mtime_us;
+      record.mode = entry.mode;
+      record.type = static_cast<uint8_t>(entry.type);
+      record.path_len = static_cast<uint16_t>(entry.relative_path.size());
+
+      const char* record_ptr = reinterpret_cast<const char*>(&record);
+      page.insert(page.end(), record_ptr, record_ptr + sizeof(record));
+      page.insert(page.end(), entry.relative_path.begin(),
+                  entry.relative_path.begin() + record.path_len);
+    }
+
+    uint32_t entry_count = (i < total_entries ? i + 1 : i) - first_entry;
+    bool is_last = i + 1 >= total_entries;
+    if (page.size() >= chunk_size || entry_count >= kMaxManifestPageEntries ||
+        is_last) {
+      int ret = pipeline.Push(BuildManifestPage(session_id, first_entry,
+                                                entry_count, total_entries,
+                                                total_size, page, is_last));
+      if (ret != 0) {
+        return fail(ret);
+      }
+      page.clear();
+      first_entry += entry_count;
+      if (is_last) {
+        break;
+      }
+    }
+  }
+
+  // contents
+  std::vector<std::pair<uint32_t, std::vector<char>>> pack;
+  std::size_t pack_bytes = 0;
+  auto flush_pack = [&]() -> int {
+    if (pack.empty()) {
+      return 0;
+    }
+
+    int ret = 0;
+    FileChunkCodec codec = NegotiatedCodec();
+    if (codec == FileChunkCodec::None && !integrity) {
+      ret = pipeline.Push(BuildPack(session_id, pack, codec));
+    } else {
+      // compression, CRC and digests run on the pool
+      ret = pipeline.Submit(
+          [session_id, files = std::move(pack), codec, integrity]() {
+            return BuildPack(session_id, files, codec, integrity);
+          });
+    }
+    pack.clear();
+    pack_bytes = 0;
+    return ret;
+  };
+
+  // a file that cannot be read as announced in the manifest is dropped by the
+  // receiver, the rest of the session is still sent.
+  size_t files_aborted = 0;
+  auto abort_file = [&](size_t i) {
+    LOG_ERROR("FileSender::SendSession: failed to read [{}], dropping it",
+              entries[i].local_path.string().c_str());
+    ++files_aborted;
+    return pipeline.Push(BuildAbortChunk(file_ids[i], entries[i].size));
+  };
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const SessionEntry& entry = entries[i];
+    if (entry.type != FileEntryType::File || entry.size == 0) {
+      continue;
+    }
+
+    std::ifstream ifs(entry.local_path, std::ios::binary);
+    if (!ifs.is_open()) {
+      int ret = abort_file(i);
+      if (ret != 0) {
+        return fail(ret);
+      }
+      continue;
+    }
+
+    if (entry.size <= chunk_size / kPackedFileDivisor) {
+      std::vector<char> content(static_cast<size_t>(entry.size));
+      ifs.read(content.data(), static_cast<std::streamsize>(content.size()));
+      if (ifs.gcount() != static_cast<std::streamsize>(content.size())) {
+        int ret = abort_file(i);
+        if (ret != 0) {
+          return fail(ret);
+        }
+        continue;
+      }
+
+      if (pack_bytes + content.size() > chunk_size ||
+          pack.size() >= kMaxPackEntries) {
+        int ret = flush_pack();
+        if (ret != 0) {
+          return fail(ret);
+        }
+      }
+      pack_bytes += content.size();
+      pack.emplace_back(file_ids[i], std::move(content));
+      continue;
+    }
+
+    int ret = StreamFileChunks(
+        ifs, file_ids[i], entry.size, nullptr, chunk_size,
+        [this]() { return NegotiatedCodec(); }, pipeline, integrity);
+    if (ret == kFileReadError) {
+      ret = abort_file(i);
+    }
+    if (ret != 0) {
+      return fail(ret);
+    }
+  }
+
+  int ret = flush_pack();
+  if (ret == 0) {
+    ret = pipeline.Flush();
+  }
+  if (ret != 0) {
+    return fail(ret);
+  }
+
+  if (files_aborted > 0) {
+    LOG_WARN("FileSender::SendSession: session {} sent without {} unreadable "
+             "files",
+             session_id, files_aborted);
+  }
+  return 0;
+}
+
+std::vector<char> FileSender::BuildChunk(uint32_t file_id, uint64_t offset,
+                                         uint64_t total_size, const char* data,
+                                         uint32_t data_size,
+                                         const std::string* file_name,
+                                         bool is_first, bool is_last,
+                                         const FileChunkCodecHeader* codec,
+                                         const FileChunkIntegrity* integrity,
+                                         const FileChunkDigest* digest) {
+  FileChunkHeader header{};
+  header.magic = kFileChunkMagic;
+  header.file_id = file_id;
+  header.offset = offset;
+  header.total_size = total_size;
+  header.chunk_size = data_size;
+  header.name_len =
+      (file_name && is_first) ? static_cast<uint16_t>(file_name->size()) : 0;
+  header.flags = 0;
+  if (is_first) header.flags |= kFileChunkFirst;
+  if (is_last) header.flags |= kFileChunkLast;
+  if (codec) header.flags |= kFileChunkCompressed;
+  if (integrity) header.flags |= kFileChunkChecksum;
+  if (digest) header.flags |= kFileChunkDigest;
+
+  std::size_t codec_size = codec ? sizeof(FileChunkCodecHeader) : 0;
+  std::size_t integrity_size = integrity ? sizeof(FileChunkIntegrity) : 0;
+  std::size_t digest_size = digest ? sizeof(FileChunkDigest) : 0;
+  std::size_t total_size_bytes = sizeof(FileChunkHeader) + codec_size +
+                                 integrity_size + digest_size +
+                                 header.name_len + header.chunk_size;
+
+  std::vector<char> buffer;
+  buffer.resize(total_size_bytes);
+
+  std::size_t offset_bytes = 0;
+  memcpy(buffer.data() + offset_bytes, &header, sizeof(FileChunkHeader));
+  offset_bytes += sizeof(FileChunkHeader);
+
+  if (codec) {
+    memcpy(buffer.data() + offset_bytes, codec, codec_size);
+    offset_bytes += codec_size;
+  }
+
+  if (integrity) {
+    memcpy(buffer.data() + offset_bytes, integrity, integrity_size);
+    offset_bytes += integrity_size;
+  }
+
+  if (digest) {
+    memcpy(buffer.data() + offset_bytes, digest, digest_size);
+    offset_bytes += digest_size;
+  }
+
+  if (header.name_len > 0 && file_name) {
+    memcpy(buffer.data() + offset_bytes, file_name->data(), header.name_len);
+    offset_bytes += header.name_len;
+  }
+
+  if (header.chunk_size > 0 && data) {
+    memcpy(buffer.data() + offset_bytes, data, header.chunk_size);
+  }
+
+  if (integrity) {
+    FileChunkIntegrity checked = *integrity;
+    checked.header_crc32c = ChunkHeaderCrc(buffer.data(), codec_size,
+                                           integrity_size,
+                                           digest_size + header.name_len);
+    memcpy(buffer.data() + sizeof(FileChunkHeader) + codec_size, &checked,
+           integrity_size);
+  }
+
+  return buffer;
+}
+
+std::vector<char> FileSender::BuildCompressedChunk(
+    uint32_t file_id, uint64_t offset, uint64_t total_size, const char* data,
+    uint32_t data_size, const std::string* file_name, bool is_first,
+    bool is_last, FileChunkCodec codec, bool checksum,
+    const FileChunkDigest* digest) {
+  FileChunkIntegrity integrity{};
+  if (checksum) {
+    integrity.crc32c = Crc32c(0, data, data_size);
+  }
+  const FileChunkIntegrity* integrity_ptr = checksum ? &integrity : nullptr;
+
+  std::vector<char> encoded;
+  if (!CompressPayload(data, data_size, codec, encoded)) {
+    return BuildChunk(file_id, offset, total_size, data, data_size, file_name,
+                      is_first, is_last, nullptr, integrity_ptr, digest);
+  }
+
+  FileChunkCodecHeader codec_header{};
+  codec_header.codec = static_cast<uint8_t>(codec);
+  codec_header.raw_size = data_size;
+
+  return BuildChunk(file_id, offset, total_size, encoded.data(),
+                    static_cast<uint32_t>(encoded.size()), file_name, is_first,
+                    is_last, &codec_header, integrity_ptr, digest);
+}
+
+std::vector<char> FileSender::BuildPack(
+    uint32_t session_id,
+    const std::vector<std::pair<uint32_t, std::vector<char>>>& files,
+    FileChunkCodec codec, bool integrity) {
+  std::vector<char> contents;
+  std::vector<FilePackEntry> records;
+  std::vector<FileChunkDigest> digests;
+  records.reserve(files.size());
+  for (const auto& [file_id, content] : files) {
+    records.push_back({file_id, static_cast<uint32_t>(content.size())});
+    contents.insert(contents.end(), content.begin(), content.end());
+    if (integrity) {
+      FileDigest digest;
+      digest.Update(content.data(), content.size());
+      digests.push_back(digest.Final());
+    }
+  }
+
+  std::vector<char> encoded;
+  bool compressed = CompressPayload(
+      contents.data(), static_cast<uint32_t>(contents.size()), codec, encoded);
+  const std::vector<char>& payload = compressed ? encoded : contents;
+
+  FilePackHeader header{};
+  header.magic = kFilePackMagic;
+  header.session_id = session_id;
+  header.entry_count = static_cast<uint16_t>(records.size());
+  header.payload_size = static_cast<uint32_t>(payload.size());
+  header.flags = compressed ? kFileChunkCompressed : 0;
+  if (integrity) {
+    header.flags |= kFileChunkChecksum | kFileChunkDigest;
+  }
+
+  std::size_t codec_size = compressed ? sizeof(FileChunkCodecHeader) : 0;
+  std::size_t integrity_size = integrity ? sizeof(FileChunkIntegrity) : 0;
+  std::size_t records_size = records.size() * sizeof(FilePackEntry);
+  std::size_t digests_size = digests.size() * sizeof(FileChunkDigest);
+  std::vector<char> buffer(sizeof(FilePackHeader) + codec_size +
+                           integrity_size + records_size + digests_size +
+                           payload.size());
+
+  char* ptr = buffer.data();
+  memcpy(ptr, &header, sizeof(FilePackHeader));
+  ptr += sizeof(FilePackHeader);
+  if (compressed) {
+    FileChunkCodecHeader codec_header{};
+    codec_header.codec = static_cast<uint8_t>(codec);
+    codec_header.raw_size = static_cast<uint32_t>(contents.size());
+    memcpy(ptr, &codec_header, codec_size);
+    ptr += codec_size;
+  }
+  char* integrity_ptr = ptr;
+  ptr += integrity_size;
+  if (records_size > 0) {
+    memcpy(ptr, records.data(), records_size);
+    ptr += records_size;
+  }
+  if (digests_size > 0) {
+    memcpy(ptr, digests.data(), digests_size);
+    ptr += digests_size;
+  }
+  if (!payload.empty()) {
+    memcpy(ptr, payload.data(), payload.size());
+  }
+
+  if (integrity) {
+    FileChunkIntegrity checked{};
+    checked.crc32c = Crc32c(0, contents.data(), contents.size());
+    checked.header_crc32c =
+        HeaderCrc(buffer.data(), sizeof(FilePackHeader) + codec_size,
+                  integrity_size, records_size + digests_size);
+    memcpy(integrity_ptr, &checked, integrity_size);
+  }
+
+  return buffer;
+}
+
+// ---------- FileReceiver ----------
+
+FileReceiver::FileReceiver() : output_dir_(GetDefaultDesktopPath()) {}
+
+FileReceiver::FileReceiver(const std::filesystem::path& output_dir)
+    : output_dir_(output_dir) {
+  std::error_code ec;
+  if (!output_dir_.empty()) {
+    std::filesystem::create_directories(output_dir_, ec);
+    if (ec) {
+      LOG_ERROR("FileReceiver: failed to create output dir [{}]: {}",
+                output_dir_.string().c_str(), ec.message().c_str());
+    }
+  }
+}
+
+FileReceiver::~FileReceiver() {
+  *cancelled_ = true;
+  for (auto& job : signature_jobs_) {
+    job.wait();
+  }
+}
+
+std::filesystem::path FileReceiver::GetDefaultDesktopPath() {
+#ifdef _WIN32
+  const char* home_env = std::getenv("USERPROFILE");
+#else
+  const char* home_env = std::getenv("HOME");
+#endif
+  if (!home_env) {
+    return std::filesystem::path{};
+  }
+
+  std::filesystem::path desktop_path =
+      std::filesystem::path(home_env) / "Desktop";
+
+  std::error_code ec;
+  std::filesystem::create_directories(desktop_path, ec);
+  if (ec) {
+    LOG_ERROR("FileReceiver: failed to create desktop directory [{}]: {}",
+              desktop_path.string().c_str(), ec.message().c_str());
+  }
+
+  return desktop_path;
+}
+
+FileTransferAck FileReceiver::CapabilitiesAck() {
+  FileTransferAck ack{};
+  ack.magic = kFileAckMagic;
+  ack.flags = LocalCapabilities();
+  return ack;
+}
+
+bool FileReceiver::OnData(const char* data, size_t size) {
+  if (!data || size < sizeof(uint32_t)) {
+    LOG_ERROR("FileReceiver::OnData: invalid buffer");
+    return false;
+  }
+
+  uint32_t magic = 0;
+  memcpy(&magic, data, sizeof(uint32_t));
+  if (magic == kFileManifestMagic) {
+    return HandleManifest(data, size);
+  }
+  if (magic == kFilePackMagic) {
+    return HandlePack(data, size);
+  }
+  if (magic == kFileDeltaRequestMagic) {
+    return HandleDeltaRequest(data, size);
+  }
+  if (magic == kFileDeltaMagic) {
+    return HandleDelta(data, size);
+  }
+
+  if (size < sizeof(FileChunkHeader)) {
+    LOG_ERROR("FileReceiver::OnData: invalid buffer");
+    return false;
+  }
+
+  FileChunkHeader header{};
+  memcpy(&header, data, sizeof(FileChunkHeader));
+
+  if (header.magic != kFileChunkMagic) {
+    return false;
+  }
+
+  std::size_t codec_size = (header.flags & kFileChunkCompressed)
+                               ? sizeof(FileChunkCodecHeader)
+                               : 0;
+  std::size_t integrity_size = (header.flags & kFileChunkChecksum)
+                                   ? sizeof(FileChunkIntegrity)
+                                   : 0;
+  std::size_t digest_size =
+      (header.flags & kFileChunkDigest) ? sizeof(FileChunkDigest) : 0;
+  std::size_t extra_size = codec_size + integrity_size + digest_size;
+  std::size_t header_and_name = sizeof(FileChunkHeader) + extra_size +
+                                static_cast<std::size_t>(header.name_len);
+  if (size < header_and_name ||
+      size < header_and_name + static_cast<std::size_t>(header.chunk_size)) {
+    LOG_ERROR("FileReceiver::OnData: buffer too small for header + payload");
+    return false;
+  }
+
+  // with a damaged header none of its fields can be trusted, not even the
+  // file id a repair would be asked for
+  if (integrity_size > 0) {
+    FileChunkIntegrity integrity{};
+    memcpy(&integrity, data + sizeof(FileChunkHeader) + codec_size,
+           integrity_size);
+    if (ChunkHeaderCrc(data, codec_size, integrity_size,
+                       digest_size + header.name_len) !=
+        integrity.header_crc32c) {
+      LOG_ERROR("FileReceiver::OnData: damaged chunk header, dropping chunk");
+      return false;
+    }
+  }
+
+  const char* name_ptr = data + sizeof(FileChunkHeader) + extra_size;
+  std::string file_name;
+  const std::string* file_name_ptr = nullptr;
+  if (header.name_len > 0) {
+    file_name.assign(name_ptr,
+                     name_ptr + static_cast<std::size_t>(header.name_len));
+    file_name_ptr = &file_name;
+  }
+
+  const char* payload = data + header_and_name;
+  std::size_t payload_size =
+      static_cast<std::size_t>(header.chunk_size);  // may be 0
+
+  // a chunk that fails decoding or its CRC can be requested again when the
+  // sender added a checksum, otherwise it is fatal.
+  bool intact = true;
+  if (codec_size > 0) {
+    FileChunkCodecHeader codec_header{};
+    memcpy(&codec_header, data + sizeof(FileChunkHeader),
+           sizeof(FileChunkCodecHeader));
+    payload = DecodePayload(codec_header, payload, payload_size);
+    if (!payload && integrity_size == 0) {
+      LOG_ERROR("FileReceiver::OnData: failed to decode chunk, file_id={}",
+                header.file_id);
+      return false;
+    }
+    intact = payload != nullptr;
+    payload_size = codec_header.raw_size;
+  }
+
+  if (intact && integrity_size > 0) {
+    FileChunkIntegrity integrity{};
+    memcpy(&integrity, data + sizeof(FileChunkHeader) + codec_size,
+           integrity_size);
+    intact = Crc32c(0, payload, payload_size) == integrity.crc32c;
+  }
+
+  FileChunkDigest digest{};
+  if (digest_size > 0) {
+    memcpy(&digest,
+           data + sizeof(FileChunkHeader) + codec_size + integrity_size,
+           digest_size);
+  }
+
+  return HandleChunk(header, intact ? payload : nullptr, payload_size,
+                     file_name_ptr, intact,
+                     digest_size > 0 ? &digest : nullptr);
+}
+
+const char* FileReceiver::DecodePayload(
+    const FileChunkCodecHeader& codec_header, const char* payload,
+    size_t payload_size) {
+  if (codec_header.codec != static_cast<uint8_t>(FileChunkCodec::Lz4) ||
+      codec_header.raw_size > kMaxRawChunkSize) {
+    LOG_ERROR("FileReceiver: unsupported codec {} or raw size {}",
+              codec_header.codec, codec_header.raw_size);
+    return nullptr;
+  }
+
+  if (decode_buffer_.size() < codec_header.raw_size) {
+    decode_buffer_.resize(codec_header.raw_size);
+  }
+
+  int decoded = LZ4_decompress_safe(payload, decode_buffer_.data(),
+                                    static_cast<int>(payload_size),
+                                    static_cast<int>(codec_header.raw_size));
+  if (decoded < 0 || static_cast<uint32_t>(decoded) != codec_header.raw_size) {
+    return nullptr;
+  }
+
+  return decode_buffer_.data();
+}
+
+bool FileReceiver::HandleChunk(const FileChunkHeader& header,
+                               const char* payload, size_t payload_size,
+                               const std::string* file_name, bool intact,
+                               const FileChunkDigest* digest) {
+  if (session_files_.count(header.file_id) > 0) {
+    return HandleSessionChunk(header, payload, payload_size, intact, digest);
+  }
+  if (std::find(failed_session_files_.begin(), failed_session_files_.end(),
+                header.file_id) != failed_session_files_.end()) {
+    return true;
+  }
+
+  // the sender gave up on a delta and sends the whole file instead
+  if (header.flags & kFileChunkFirst) {
+    auto delta_it = deltas_.find(header.file_id);
+    if (delta_it != deltas_.end()) {
+      std::error_code ec;
+      delta_it->second.ofs.close();
+      std::filesystem::remove(delta_it->second.temp_path, ec);
+      deltas_.erase(delta_it);
+    }
+  }
+
+  auto it = contexts_.find(header.file_id);
+  if (it == contexts_.end()) {
+    // new file context must start with first chunk.
+    if ((header.flags & kFileChunkFirst) == 0) {
+      LOG_ERROR("FileReceiver: received non-first chunk for unknown file_id={}",
+                header.file_id);
+      return false;
+    }
+
+    FileContext ctx;
+    ctx.total_size = header.total_size;
+
+    std::string filename;
+    if (file_name && !file_name->empty()) {
+      // pulled files are named by the host, the peer must not be able to
+      // write outside of output_dir_.
+      if (!IsPlainFileName(*file_name)) {
+        LOG_ERROR("FileReceiver: rejected file name [{}], file_id={}",
+                  file_name->c_str(), header.file_id);
+        return false;
+      }
+      filename = *file_name;
+    } else {
+      filename = "received_" + std::to_string(header.file_id);
+    }
+
+    ctx.file_name = filename;
+
+    std::filesystem::path save_path = output_dir_.empty()
+                                          ? std::filesystem::path(filename)
+                                          : output_dir_ / filename;
+
+    // if file exists, append timestamp.
+    save_path = UniquePath(save_path);
+
+    ctx.ofs.open(save_path, std::ios::binary | std::ios::trunc);
+    if (!ctx.ofs.is_open()) {
+      LOG_ERROR("FileReceiver: failed to open [{}] for writing",
+                save_path.string().c_str());
+      return false;
+    }
+    ctx.save_path = save_path;
+
+    contexts_.emplace(header.file_id, std::move(ctx));
+    it = contexts_.find(header.file_id);
+  }
+
+  FileContext& ctx = it->second;
+  if (header.flags & kFileChunkLast) {
+    ctx.last_seen = true;
+  }
+  if (digest) {
+    ctx.has_peer_digest = true;
+    ctx.peer_digest = *digest;
+  }
+
+  bool failed = false;
+  if (!intact) {
+    LOG_WARN("FileReceiver: damaged chunk, file_id={}, offset={}",
+             header.file_id, header.offset);
+    failed = !RequestRepair(header.file_id, ctx.damaged, header.offset,
+                            static_cast<uint32_t>(payload_size));
+    if (!failed) {
+      // progress is acked once the range arrives intact
+      return true;
+    }
+  } else if (payload_size > 0 && payload) {
+    ctx.ofs.seekp(static_cast<std::streamoff>(header.offset), std::ios::beg);
+    ctx.ofs.write(payload, static_cast<std::streamsize>(payload_size));
+    if (!ctx.ofs.good()) {
+      LOG_ERROR("FileReceiver: write failed for file_id={}", header.file_id);
+      return false;
+    }
+    ctx.received += static_cast<uint64_t>(payload_size);
+    ctx.damaged.erase(header.offset);
+
+    // hash in order while writing, data behind a damaged range is hashed
+    // from disk once the range has been repaired
+    if (header.offset == ctx.hashed) {
+      ctx.digest.Update(payload, payload_size);
+      ctx.hashed += payload_size;
+    }
+  }
+
+  bool completed = failed || ((ctx.last_seen || ctx.received >= ctx.total_size) &&
+                              ctx.damaged.empty());
+  bool verified = false;
+  if (completed) {
+    ctx.ofs.close();
+    if (!failed && ctx.has_peer_digest) {
+      verified = VerifyFile(ctx.save_path, ctx.digest, ctx.hashed,
+                            ctx.received, ctx.peer_digest);
+      failed = !verified;
+    }
+  }
+
+  // Send ACK after processing chunk
+  if (on_send_ack_) {
+    FileTransferAck ack{};
+    ack.magic = kFileAckMagic;
+    ack.file_id = header.file_id;
+    ack.acked_offset = ctx.received;
+    ack.total_size = header.total_size;
+    ack.flags = LocalCapabilities();
+    if (completed) {
+      ack.flags |= kFileAckCompleted;
+    }
+    if (verified) {
+      ack.flags |= kFileAckVerified;
+    }
+    if (failed) {
+      ack.flags |= kFileAckError;
+    }
+
+    int ret = on_send_ack_(ack);
+    if (ret != 0) {
+      LOG_ERROR("FileReceiver: failed to send ACK for file_id={}, ret={}",
+                header.file_id, ret);
+    }
+  }
+
+  if (completed) {
+    if (failed) {
+      LOG_ERROR("FileReceiver: file [{}] is corrupt, removing it, file_id={}",
+                ctx.save_path.string().c_str(), header.file_id);
+      std::error_code ec;
+      std::filesystem::remove(ctx.save_path, ec);
+    } else {
+      LOG_INFO("FileReceiver: file received complete, file_id={}, size={}, "
+               "verified={}",
+               header.file_id, ctx.received, verified);
+    }
+
+    contexts_.erase(header.file_id);
+  }
+
+  return !failed;
+}
+
+bool FileReceiver::RequestRepair(uint32_t file_id, DamagedRanges& damaged,
+                                 uint64_t offset, uint32_t length) {
+  auto& [damaged_length, attempts] = damaged[offset];
+  damaged_length = length;
+  if (++attempts > kMaxRepairAttempts || !on_send_feedback_) {
+    return false;
+  }
+
+  FileChunkNack nack{};
+  nack.magic = kFileChunkNackMagic;
+  nack.file_id = file_id;
+  nack.offset = offset;
+  nack.length = length;
+  return on_send_feedback_(reinterpret_cast<const char*>(&nack),
+                           sizeof(FileChunkNack)) == 0;
+}
+
+bool FileReceiver::VerifyFile(const std::filesystem::path& path,
+                              FileDigest& digest, uint64_t hashed,
+                              uint64_t size,
+                              const FileChunkDigest& peer_digest) {
+  if (hashed < size) {
+    std::ifstream ifs(path, std::ios::binary);
+    ifs.seekg(static_cast<std::streamoff>(hashed), std::ios::beg);
+    std::vector<char> buffer(1024 * 1024);
+    while (ifs) {
+      ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      std::streamsize bytes_read = ifs.gcount();
+      if (bytes_read <= 0) {
+        break;
+      }
+      digest.Update(buffer.data(), static_cast<size_t>(bytes_read));
+    }
+  }
+
+  FileChunkDigest final_digest = digest.Final();
+  return final_digest.low64 == peer_digest.low64 &&
+         final_digest.high64 == peer_digest.high64;
+}
+
+bool FileReceiver::ResolveSessionPath(SessionContext& session,
+                                      const std::string& relative_path,
+                                      std::filesystem::path& out) {
+  // only plain relative components are accepted, the peer must not be able
+  // to write outside of output_dir_.
+  std::vector<std::string> parts;
+  size_t start = 0;
+  while (start <= relative_path.size()) {
+    size_t end = relative_path.find('/', start);
+    if (end == std::string::npos) {
+      end = relative_path.size();
+    }
+    std::string part = relative_path.substr(start, end - start);
+    if (part.empty() || part == "." || part == ".." ||
+        part.find('\\') != std::string::npos
+#ifdef _WIN32
+        || part.find(':') != std::string::npos
+#endif
+    ) {
+      return false;
+    }
+    parts.push_back(std::move(part));
+    start = end + 1;
+  }
+  if (parts.empty()) {
+    return false;
+  }
+
+  // a top level entry that already exists on disk is renamed once, every
+  // entry below it follows the new name.
+  auto root_it = session.roots.find(parts[0]);
+  if (root_it == session.roots.end()) {
+    std::filesystem::path root_path = output_dir_ / parts[0];
+    std::string root_name = UniquePath(root_path).filename().string();
+    root_it = session.roots.emplace(parts[0], root_name).first;
+  }
+
+  out = output_dir_ / root_it->second;
+  for (size_t i = 1; i < parts.size(); ++i) {
+    out /= parts[i];
+  }
+  return true;
+}
+
+bool FileReceiver::HandleManifest(const char* data, size_t size) {
+  if (size < sizeof(FileManifestHeader)) {
+    LOG_ERROR("FileReceiver: manifest too small");
+    return false;
+  }
+
+  FileManifestHeader header{};
+  memcpy(&header, data, sizeof(FileManifestHeader));
+  if (size < sizeof(FileManifestHeader) + header.payload_size) {
+    LOG_ERROR("FileReceiver: manifest buffer too small for payload");
+    return false;
+  }
+
+  SessionContext& session = sessions_[header.session_id];
+  session.total_size = header.total_size;
+  session.total_entries = header.total_entries;
+
+  const char* ptr = data + sizeof(FileManifestHeader);
+  const char* end = ptr + header.payload_size;
+  for (uint32_t i = 0; i < header.entry_count; ++i) {
+    FileManifestEntry entry{};
+    if (end - ptr < static_cast<std::ptrdiff_t>(sizeof(FileManifestEntry))) {
+      LOG_ERROR("FileReceiver: truncated manifest entry");
+      return false;
+    }
+    memcpy(&entry, ptr, sizeof(FileManifestEntry));
+    ptr += sizeof(FileManifestEntry);
+    if (end - ptr < static_cast<std::ptrdiff_t>(entry.path_len)) {
+      LOG_ERROR("FileReceiver: truncated manifest path");
+      return false;
+    }
+    std::string relative_path(ptr, ptr + entry.path_len);
+    ptr += entry.path_len;
+    ++session.entries_seen;
+
+    std::filesystem::path path;
+    bool valid = ResolveSessionPath(session, relative_path, path);
+    if (!valid) {
+      LOG_ERROR("FileReceiver: rejected session path [{}]",
+                relative_path.c_str());
+    }
+
+    std::error_code ec;
+    if (entry.type == static_cast<uint8_t>(FileEntryType::Directory)) {
+      if (valid) {
+        std::filesystem::create_directories(path, ec);
+        if (ec) {
+          LOG_ERROR("FileReceiver: failed to create [{}]: {}",
+                    path.string().c_str(), ec.message().c_str());
+        } else {
+          session.directories.emplace_back(path, entry);
+        }
+      }
+      continue;
+    }
+
+    if (valid) {
+      std::filesystem::create_directories(path.parent_path(), ec);
+    }
+
+    // rejected files keep an empty path so their contents are still counted
+    // and the session can complete.
+    SessionFile file;
+    file.session_id = header.session_id;
+    file.path = valid ? path : std::filesystem::path();
+    file.size = entry.size;
+    file.mtime_us = entry.mtime_us;
+    file.mode = entry.mode;
+    session_files_[entry.file_id] = std::move(file);
+    ++session.files_pending;
+
+    if (entry.size == 0) {
+      if (valid) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc);
+      }
+      FinishSessionFile(entry.file_id);
+    }
+  }
+
+  if (header.flags & kFileManifestLast) {
+    session.manifest_complete = true;
+  }
+
+  UpdateSession(header.session_id);
+  return true;
+}
+
+bool FileReceiver::HandlePack(const char* data, size_t size) {
+  if (size < sizeof(FilePackHeader)) {
+    LOG_ERROR("FileReceiver: pack too small");
+    return false;
+  }
+
+  FilePackHeader header{};
+  memcpy(&header, data, sizeof(FilePackHeader));
+
+  std::size_t codec_size =
+      (header.flags & kFileChunkCompressed) ? sizeof(FileChunkCodecHeader) : 0;
+  std::size_t integrity_size =
+      (header.flags & kFileChunkChecksum) ? sizeof(FileChunkIntegrity) : 0;
+  std::size_t records_size = header.entry_count * sizeof(FilePackEntry);
+  std::size_t digests_size = (header.flags & kFileChunkDigest)
+                                 ? header.entry_count * sizeof(FileChunkDigest)
+                                 : 0;
+  std::size_t head_size = sizeof(FilePackHeader) + codec_size;
+  std::size_t prefix = head_size + integrity_size + records_size + digests_size;
+  if (size < prefix + header.payload_size) {
+    LOG_ERROR("FileReceiver: pack buffer too small for payload");
+    return false;
+  }
+
+  // like a chunk, a damaged header makes the whole pack unusable
+  FileChunkIntegrity integrity{};
+  if (integrity_size > 0) {
+    memcpy(&integrity, data + head_size, integrity_size);
+    if (HeaderCrc(data, head_size, integrity_size,
+                  records_size + digests_size) != integrity.header_crc32c) {
+      LOG_ERROR("FileReceiver: damaged pack header, session_id={}",
+                header.session_id);
+      return false;
+    }
+  }
+
+  const char* payload = data + prefix;
+  std::size_t payload_size = header.payload_size;
+  if (codec_size > 0) {
+    FileChunkCodecHeader codec_header{};
+    memcpy(&codec_header, data + sizeof(FilePackHeader), codec_size);
+    payload = DecodePayload(codec_header, payload, payload_size);
+    if (!payload && integrity_size == 0) {
+      LOG_ERROR("FileReceiver: failed to decode pack, session_id={}",
+                header.session_id);
+      return false;
+    }
+    payload_size = codec_header.raw_size;
+  }
+  bool intact = payload != nullptr;
+  if (intact && integrity_size > 0) {
+    intact = Crc32c(0, payload, payload_size) == integrity.crc32c;
+  }
+
+  const char* records = data + head_size + integrity_size;
+  const char* digests = records + records_size;
+  std::size_t consumed = 0;
+  for (uint16_t i = 0; i < header.entry_count; ++i) {
+    FilePackEntry record{};
+    memcpy(&record, records + i * sizeof(FilePackEntry),
+           sizeof(FilePackEntry));
+    auto file_it = session_files_.find(record.file_id);
+    if (digests_size > 0 && file_it != session_files_.end()) {
+      file_it->second.has_peer_digest = true;
+      memcpy(&file_it->second.peer_digest,
+             digests + i * sizeof(FileChunkDigest), sizeof(FileChunkDigest));
+    }
+
+    // every file of a damaged pack is asked for again on its own
+    if (!intact) {
+      if (file_it != session_files_.end()) {
+        RepairSessionFile(record.file_id, 0, record.size);
+      }
+      continue;
+    }
+    if (payload_size - consumed < record.size) {
+      LOG_ERROR("FileReceiver: pack entry exceeds payload");
+      return false;
+    }
+    if (!WriteSessionFile(record.file_id, 0, payload + consumed,
+                          record.size)) {
+      return false;
+    }
+    consumed += record.size;
+  }
+
+  if (!intact) {
+    LOG_WARN("FileReceiver: damaged pack, session_id={}, files={}",
+             header.session_id, header.entry_count);
+  }
+  UpdateSession(header.session_id);
+  return true;
+}
+
+bool FileReceiver::HandleSessionChunk(const FileChunkHeader& header,
+                                      const char* payload,
+                                      size_t payload_size, bool intact,
+                                      const FileChunkDigest* digest) {
+  SessionFile& file = session_files_[header.file_id];
+  uint32_t session_id = file.session_id;
+  if (header.flags & kFileChunkAbort) {
+    LOG_ERROR("FileReceiver: sender could not read session file_id={}",
+              header.file_id);
+    FinishSessionFile(header.file_id, true);
+    UpdateSession(session_id);
+    return true;
+  }
+
+  if (digest) {
+    file.has_peer_digest = true;
+    file.peer_digest = *digest;
+  }
+  if (!intact) {
+    LOG_WARN("FileReceiver: damaged session chunk, file_id={}, offset={}",
+             header.file_id, header.offset);
+    // progress is acked once the range arrives intact
+    if (RepairSessionFile(header.file_id, header.offset,
+                          static_cast<uint32_t>(payload_size))) {
+      return true;
+    }
+    UpdateSession(session_id);
+    return false;
+  }
+
+  if (!WriteSessionFile(header.file_id, header.offset, payload,
+                        payload_size)) {
+    return false;
+  }
+
+  UpdateSession(session_id);
+  return true;
+}
+
+bool FileReceiver::RepairSessionFile(uint32_t file_id, uint64_t offset,
+                                     uint32_t length) {
+  auto file_it = session_files_.find(file_id);
+  if (file_it == session_files_.end()) {
+    return false;
+  }
+  if (RequestRepair(file_id, file_it->second.damaged, offset, length)) {
+    return true;
+  }
+
+  LOG_ERROR("FileReceiver: session file_id={} damaged beyond repair",
+            file_id);
+  FinishSessionFile(file_id, true);
+  return false;
+}
+
+bool FileReceiver::WriteSessionFile(uint32_t file_id, uint64_t offset,
+                                    const char* data, size_t size) {
+  auto file_it = session_files_.find(file_id);
+  if (file_it == session_files_.end()) {
+    LOG_ERROR("FileReceiver: data for unknown session file_id={}", file_id);
+    return false;
+  }
+  SessionFile& file = file_it->second;
+  SessionContext& session = sessions_[file.session_id];
+
+  if (!file.path.empty() && size > 0) {
+    if (session.open_file_id != file_id) {
+      session.ofs.close();
+      session.ofs.clear();
+      // the first write creates the file, later ones must not truncate it
+      std::ios::openmode mode =
+          file.received == 0 ? std::ios::binary | std::ios::trunc
+                             : std::ios::binary | std::ios::in | std::ios::out;
+      session.ofs.open(file.path, mode);
+      if (!session.ofs.is_open()) {
+        LOG_ERROR("FileReceiver: failed to open [{}] for writing",
+                  file.path.string().c_str());
+        return false;
+      }
+      session.open_file_id = file_id;
+    }
+
+    session.ofs.seekp(static_cast<std::streamoff>(offset), std::ios::beg);
+    session.ofs.write(data, static_cast<std::streamsize>(size));
+    if (!session.ofs.good()) {
+      LOG_ERROR("FileReceiver: write failed for file_id={}", file_id);
+      return false;
+    }
+  }
+
+  file.damaged.erase(offset);
+  // hash in order while writing, data behind a damaged range is hashed from
+  // disk once the range has been repaired
+  if (offset == file.hashed) {
+    file.digest.Update(data, size);
+    file.hashed += size;
+  }
+
+  file.received += size;
+  session.received += size;
+  if (file.received >= file.size && file.damaged.empty()) {
+    FinishSessionFile(file_id);
+  }
+  return true;
+}
+
+void FileReceiver::FinishSessionFile(uint32_t file_id, bool failed) {
+  auto file_it = session_files_.find(file_id);
+  if (file_it == session_files_.end()) {
+    return;
+  }
+  SessionFile file = std::move(file_it->second);
+  session_files_.erase(file_it);
+
+  SessionContext& session = sessions_[file.session_id];
+  if (session.open_file_id == file_id) {
+    session.ofs.close();
+    session.open_file_id = 0;
+  }
+  bool verified = false;
+  if (!failed && file.has_peer_digest && !file.path.empty()) {
+    verified = VerifyFile(file.path, file.digest, file.hashed, file.size,
+                          file.peer_digest);
+    if (!verified) {
+      LOG_ERROR("FileReceiver: session file [{}] does not match its digest",
+                file.path.string().c_str());
+      failed = true;
+    }
+  }
+
+  if (failed) {
+    ++session.files_failed;
+    failed_session_files_.push_back(file_id);
+    if (failed_session_files_.size() > kMaxFailedSessionFiles) {
+      failed_session_files_.pop_front();
+    }
+    if (!file.path.empty()) {
+      std::error_code ec;
+      std::filesystem::remove(file.path, ec);
+    }
+  } else {
+    if (verified) {
+      ++session.files_verified;
+    } else if (file.size > 0) {
+      ++session.files_unverified;
+    }
+    if (!file.path.empty()) {
+      ApplyMetadata(file.path, file.mode, file.mtime_us);
+    }
+  }
+  if (session.files_pending > 0) {
+    --session.files_pending;
+  }
+}
+
+void FileReceiver::UpdateSession(uint32_t session_id) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) {
+    return;
+  }
+  SessionContext& session = it->second;
+  bool completed = session.manifest_complete && session.files_pending == 0;
+
+  if (on_send_ack_) {
+    FileTransferAck ack{};
+    ack.magic = kFileAckMagic;
+    ack.file_id = session_id;
+    ack.acked_offset = session.received;
+    ack.total_size = session.total_size;
+    ack.flags = LocalCapabilities() | (completed ? kFileAckCompleted : 0);
+    if (completed && session.files_failed > 0) {
+      ack.flags |= kFileAckError;
+    } else if (completed && session.files_verified > 0 &&
+               session.files_unverified == 0) {
+      ack.flags |= kFileAckVerified;
+    }
+
+    int ret = on_send_ack_(ack);
+    if (ret != 0) {
+      LOG_ERROR("FileReceiver: failed to send ACK for session_id={}, ret={}",
+                session_id, ret);
+    }
+  }
+
+  if (!completed) {
+    return;
+  }
+
+  // deepest directories first, so restoring a parent is not undone by a child
+  std::sort(session.directories.begin(), session.directories.end(),
+            [](const auto& a, const auto& b) {
+              return a.first.string().size() > b.first.string().size();
+            });
+  for (const auto& [path, entry] : session.directories) {
+    ApplyMetadata(path, entry.mode, entry.mtime_us);
+  }
+
+  LOG_INFO("FileReceiver: session received complete, session_id={}, "
+           "entries={}, size={}, failed={}, verified={}",
+           session_id, session.entries_seen, session.received,
+           session.files_failed, session.files_verified);
+  sessions_.erase(it);
+}
+
+bool FileReceiver::HandleDeltaRequest(const char* data, size_t size) {
+  if (size < sizeof(FileDeltaRequest)) {
+    LOG_ERROR("FileReceiver: delta request too small");
+    return false;
+  }
+
+  FileDeltaRequest request{};
+  memcpy(&request, data, sizeof(FileDeltaRequest));
+  if (size < sizeof(FileDeltaRequest) + request.name_len) {
+    LOG_ERROR("FileReceiver: delta request buffer too small for name");
+    return false;
+  }
+  std::string name(data + sizeof(FileDeltaRequest),
+                   data + sizeof(FileDeltaRequest) + request.name_len);
+
+  signature_jobs_.erase(
+      std::remove_if(signature_jobs_.begin(), signature_jobs_.end(),
+                     [](const std::future<void>& job) {
+                       return job.wait_for(std::chrono::seconds(0)) ==
+                              std::future_status::ready;
+                     }),
+      signature_jobs_.end());
+
+  std::error_code ec;
+  std::filesystem::path target = output_dir_ / name;
+  uint32_t block_size = 0;
+  uint64_t basis_size = 0;
+  if (IsPlainFileName(name) && std::filesystem::is_regular_file(target, ec)) {
+    basis_size = std::filesystem::file_size(target, ec);
+    if (!ec) {
+      block_size = DeltaBlockSize(basis_size);
+    }
+    if (block_size != 0 &&
+        (basis_size + block_size - 1) / block_size > kMaxDeltaBlocks) {
+      block_size = 0;
+    }
+  }
+
+  if (!on_send_feedback_) {
+    LOG_ERROR("FileReceiver: no feedback channel for delta request");
+    return false;
+  }
+
+  if (block_size == 0) {
+    LOG_INFO("FileReceiver: no copy of [{}] for delta, file_id={}",
+             name.c_str(), request.file_id);
+    std::vector<char> page =
+        BuildSignaturePage(request.file_id, 0, 0, 0, 0, {}, true);
+    on_send_feedback_(page.data(), page.size());
+    return true;
+  }
+
+  DeltaContext ctx;
+  ctx.target_path = target;
+  ctx.temp_path = output_dir_ / (name + ".crossdesk-part");
+  ctx.block_size = block_size;
+  ctx.basis_size = basis_size;
+  ctx.total_blocks =
+      static_cast<uint32_t>((basis_size + block_size - 1) / block_size);
+  ctx.total_size = request.total_size;
+  deltas_.erase(request.file_id);
+  deltas_.emplace(request.file_id, std::move(ctx));
+
+  LOG_INFO("FileReceiver: hashing [{}] for delta, size {}, block {}",
+           target.string().c_str(), basis_size, block_size);
+
+  // hashing a large copy must not stall the data channel callback
+  signature_jobs_.push_back(std::async(
+      std::launch::async,
+      [target, file_id = request.file_id, block_size, basis_size,
+       send = on_send_feedback_, cancelled = cancelled_]() {
+        SendSignatures(target, file_id, block_size, basis_size, send,
+                       *cancelled);
+      }));
+  return true;
+}
+
+bool FileReceiver::HandleDelta(const char* data, size_t size) {
+  if (size < sizeof(FileDeltaHeader)) {
+    LOG_ERROR("FileReceiver: delta message too small");
+    return false;
+  }
+
+  FileDeltaHeader header{};
+  memcpy(&header, data, sizeof(FileDeltaHeader));
+
+  std::size_t codec_size =
+      (header.flags & kFileChunkCompressed) ? sizeof(FileChunkCodecHeader) : 0;
+  if (size < sizeof(FileDeltaHeader) + codec_size + header.payload_size) {
+    LOG_ERROR("FileReceiver: delta buffer too small for payload");
+    return false;
+  }
+
+  auto it = deltas_.find(header.file_id);
+  if (it == deltas_.end()) {
+    LOG_ERROR("FileReceiver: delta for unknown file_id={}", header.file_id);
+    return false;
+  }
+  DeltaContext& ctx = it->second;
+
+  std::size_t digest_size =
+      (header.flags & kFileChunkDigest) ? sizeof(FileChunkDigest) : 0;
+  if (size < sizeof(FileDeltaHeader) + codec_size + digest_size +
+                 header.payload_size) {
+    LOG_ERROR("FileReceiver: delta buffer too small for digest");
+    return false;
+  }
+
+  const char* ops = data + sizeof(FileDeltaHeader) + codec_size + digest_size;
+  std::size_t ops_size = header.payload_size;
+  if (codec_size > 0) {
+    FileChunkCodecHeader codec_header{};
+    memcpy(&codec_header, data + sizeof(FileDeltaHeader), codec_size);
+    ops = DecodePayload(codec_header, ops, ops_size);
+    ops_size = codec_header.raw_size;
+  }
+
+  bool ok = ops != nullptr && header.offset == ctx.written;
+  if (ok && !ctx.ofs.is_open()) {
+    ctx.basis.open(ctx.target_path, std::ios::binary);
+    ctx.ofs.open(ctx.temp_path, std::ios::binary | std::ios::trunc);
+    ok = ctx.basis.is_open() && ctx.ofs.is_open();
+  }
+  if (ok) {
+    ok = ApplyDeltaOps(ctx, ops, ops_size);
+  }
+
+  bool is_last = (header.flags & kFileChunkLast) != 0;
+  if (ok && is_last && ctx.written != ctx.total_size) {
+    LOG_ERROR("FileReceiver: delta rebuilt {} of {} bytes, file_id={}",
+              ctx.written, ctx.total_size, header.file_id);
+    ok = false;
+  }
+  bool verified = false;
+  if (ok && is_last && digest_size > 0) {
+    FileChunkDigest peer_digest{};
+    memcpy(&peer_digest, data + sizeof(FileDeltaHeader) + codec_size,
+           digest_size);
+    FileChunkDigest digest = ctx.digest.Final();
+    verified = digest.low64 == peer_digest.low64 &&
+               digest.high64 == peer_digest.high64;
+    ok = verified;
+  }
+
+  std::error_code ec;
+  if (ok && is_last) {
+    ctx.ofs.close();
+    ctx.basis.close();
+    // a rebuild that matches the sender's digest replaces the copy, so the
+    // next push diffs against it. Without a digest the copy is kept and the
+    // new content saved next to it, like a full transfer.
+    ctx.saved_path = verified ? ctx.target_path : UniquePath(ctx.target_path);
+    std::filesystem::rename(ctx.temp_path, ctx.saved_path, ec);
+    ok = !ec;
+  }
+
+  if (on_send_ack_) {
+    FileTransferAck ack{};
+    ack.magic = kFileAckMagic;
+    ack.file_id = header.file_id;
+    ack.acked_offset = ctx.written;
+    ack.total_size = header.total_size;
+    ack.flags = LocalCapabilities();
+    if (is_last || !ok) {
+      ack.flags |= kFileAckCompleted;
+    }
+    if (ok && verified) {
+      ack.flags |= kFileAckVerified;
+    }
+    if (!ok) {
+      ack.flags |= kFileAckError;
+    }
+
+    int ret = on_send_ack_(ack);
+    if (ret != 0) {
+      LOG_ERROR("FileReceiver: failed to send ACK for file_id={}, ret={}",
+                header.file_id, ret);
+    }
+  }
+
+  if (!ok) {
+    LOG_ERROR("FileReceiver: failed to apply delta to [{}]",
+              ctx.target_path.string().c_str());
+    ctx.ofs.close();
+    std::filesystem::remove(ctx.temp_path, ec);
+    deltas_.erase(it);
+    return false;
+  }
+
+  if (is_last) {
+    LOG_INFO("FileReceiver: delta applied, file_id={}, size={}, saved to [{}]",
+             header.file_id, ctx.written, ctx.saved_path.string().c_str());
+    deltas_.erase(it);
+  }
+  return true;
+}
+
+bool FileReceiver::ApplyDeltaOps(DeltaContext& ctx, const char* ops,
+                                 size_t size) {
+  std::vector<char> copy_buffer;
+  size_t pos = 0;
+  while (pos < size) {
+    if (size - pos < sizeof(FileDeltaOp)) {
+      return false;
+    }
+    FileDeltaOp op{};
+    memcpy(&op, ops + pos, sizeof(FileDeltaOp));
+    pos += sizeof(FileDeltaOp);
+
+    if (op.type == static_cast<uint8_t>(FileDeltaOpType::Literal)) {
+      if (size - pos < op.length) {
+        return false;
+      }
+      ctx.ofs.write(ops + pos, static_cast<std::streamsize>(op.length));
+      ctx.digest.Update(ops + pos, op.length);
+      pos += op.length;
+      ctx.written += op.length;
+    } else if (op.type == static_cast<uint8_t>(FileDeltaOpType::Copy)) {
+      if (op.first_block >= ctx.total_blocks ||
+          op.length > ctx.total_blocks - op.first_block) {
+        return false;
+      }
+      uint64_t offset = static_cast<uint64_t>(op.first_block) * ctx.block_size;
+      uint64_t remaining = std::min<uint64_t>(
+          static_cast<uint64_t>(op.length) * ctx.block_size,
+          ctx.basis_size - offset);
+      ctx.basis.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
+      copy_buffer.resize(
+          static_cast<size_t>(std::min<uint64_t>(remaining, 1024 * 1024)));
+      while (remaining > 0) {
+        size_t part = static_cast<size_t>(
+            std::min<uint64_t>(remaining, copy_buffer.size()));
+        ctx.basis.read(copy_buffer.data(), static_cast<std::streamsize>(part));
+        if (ctx.basis.gcount() != static_cast<std::streamsize>(part)) {
+          return false;
+        }
+        ctx.ofs.write(copy_buffer.data(), static_cast<std::streamsize>(part));
+        ctx.digest.Update(copy_buffer.data(), part);
+        remaining -= part;
+        ctx.written += part;
+      }
+    } else {
+      return false;
+    }
+
+    if (!ctx.ofs.good()) {
+      return false;
+    }
+  }
   return true;
 }
 
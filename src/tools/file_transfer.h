@@ -7,10 +7,15 @@
 #ifndef _FILE_TRANSFER_H_
 #define _FILE_TRANSFER_H_
 
+#include <atomic>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -20,6 +25,50 @@ namespace crossdesk {
 // Magic constants for file transfer protocol
 constexpr uint32_t kFileChunkMagic = 0x4A4E544D;  // 'JNTM'
 constexpr uint32_t kFileAckMagic = 0x4A4E5443;    // 'JNTC'
+constexpr uint32_t kFileManifestMagic = 0x4A4E4D46;  // 'JNMF'
+constexpr uint32_t kFilePackMagic = 0x4A4E504B;      // 'JNPK'
+constexpr uint32_t kFileDeltaRequestMagic = 0x4A4E4451;  // 'JNDQ'
+constexpr uint32_t kFileSignatureMagic = 0x4A4E5347;     // 'JNSG'
+constexpr uint32_t kFileDeltaMagic = 0x4A4E444C;         // 'JNDL'
+constexpr uint32_t kFileChunkNackMagic = 0x4A4E4E4B;     // 'JNNK'
+
+// FileChunkHeader.flags
+constexpr uint8_t kFileChunkFirst = 0x01;
+constexpr uint8_t kFileChunkLast = 0x02;
+constexpr uint8_t kFileChunkCompressed = 0x04;  // FileChunkCodecHeader follows
+constexpr uint8_t kFileChunkChecksum = 0x08;    // FileChunkIntegrity follows
+constexpr uint8_t kFileChunkDigest = 0x10;      // FileChunkDigest follows
+// empty chunk ending a session file the sender could not read in full, the
+// receiver drops the file and the session completes with an error.
+constexpr uint8_t kFileChunkAbort = 0x20;
+
+// FileTransferAck.flags
+constexpr uint32_t kFileAckCompleted = 0x01;
+constexpr uint32_t kFileAckError = 0x02;
+// completed and the content digest matched the sender's.
+constexpr uint32_t kFileAckVerified = 0x04;
+// bits 8..15 advertise protocol features supported by the receiver.
+constexpr uint32_t kFileAckSessions = 0x00000100;  // manifest + pack messages
+constexpr uint32_t kFileAckDelta = 0x00000200;     // signature + delta messages
+constexpr uint32_t kFileAckIntegrity = 0x00000400;  // chunk CRC, digest, NACK
+constexpr uint32_t kFileAckFeatureMask = 0x0000FF00;
+// bits 16..23 advertise the codecs the receiver can decode, one bit per
+// FileChunkCodec value. Senders only compress once the peer has advertised it,
+// so old receivers keep getting raw chunks.
+constexpr uint32_t kFileAckCodecShift = 16;
+constexpr uint32_t kFileAckCodecMask = 0x00FF0000;
+
+enum class FileChunkCodec : uint8_t { None = 0, Lz4 = 1 };
+
+// FileManifestHeader.flags
+constexpr uint8_t kFileManifestLast = 0x01;
+
+enum class FileEntryType : uint8_t { File = 0, Directory = 1 };
+
+// FileSignatureHeader.flags
+constexpr uint8_t kFileSignatureLast = 0x01;
+
+enum class FileDeltaOpType : uint8_t { Literal = 0, Copy = 1 };
 
 #pragma pack(push, 1)
 struct FileChunkHeader {
@@ -29,7 +78,39 @@ struct FileChunkHeader {
   uint64_t total_size;  // total file size
   uint32_t chunk_size;  // payload size in this chunk
   uint16_t name_len;    // filename length (bytes), only set on first chunk
-  uint8_t flags;        // bit0: is_first, bit1: is_last, others reserved
+  uint8_t flags;        // bit0: is_first, bit1: is_last, bit2: compressed,
+                        // bit3: checksum, bit4: digest, bit5: abort
+};
+
+// present right after FileChunkHeader when kFileChunkCompressed is set,
+// chunk_size is then the encoded payload size.
+struct FileChunkCodecHeader {
+  uint8_t codec;      // FileChunkCodec
+  uint32_t raw_size;  // payload size after decoding
+};
+
+// present after the codec header when kFileChunkChecksum is set.
+struct FileChunkIntegrity {
+  uint32_t crc32c;  // CRC-32C of the decoded payload
+  // CRC-32C of everything else but this struct: FileChunkHeader, codec
+  // header, digest and file name
+  uint32_t header_crc32c;
+};
+
+// present after FileChunkIntegrity when kFileChunkDigest is set, on the last
+// chunk of a file only: XXH3-128 of the whole file content.
+struct FileChunkDigest {
+  uint64_t low64;
+  uint64_t high64;
+};
+
+// sent by the receiver on the feedback channel for a chunk whose checksum did
+// not match, the sender resends that range from the file.
+struct FileChunkNack {
+  uint32_t magic;    // kFileChunkNackMagic
+  uint32_t file_id;  // FileChunkHeader.file_id
+  uint64_t offset;   // offset of the damaged range
+  uint32_t length;   // length of the damaged range
 };
 
 struct FileTransferAck {
@@ -37,13 +118,140 @@ struct FileTransferAck {
   uint32_t file_id;       // must match FileChunkHeader.file_id
   uint64_t acked_offset;  // received offset
   uint64_t total_size;    // total file size
-  uint32_t flags;         // bit0: completed, bit1: error
+  uint32_t flags;  // bit0: completed, bit1: error, bit2: verified,
+                   // bit8-15: features, bit16-23: codecs
+};
+
+// A session streams several files (e.g. a directory tree) as one transfer:
+// manifest pages first, then file contents. Contents of large files use
+// FileChunkHeader with the file_id announced in the manifest, small files are
+// packed together into FilePackHeader messages. The receiver acks the session
+// as a whole, using the session id as FileTransferAck.file_id. With
+// kFileAckIntegrity chunks and packs carry CRCs and a digest per file, damaged
+// ranges are NACKed by file id, and the session ack is verified once every
+// file matched its digest.
+struct FileManifestHeader {
+  uint32_t magic;          // kFileManifestMagic
+  uint32_t session_id;     // unique id per session, shares the file id space
+  uint32_t first_entry;    // index of the first entry in this page
+  uint32_t entry_count;    // entries in this page
+  uint32_t total_entries;  // entries in the whole manifest
+  uint64_t total_size;     // sum of all file sizes in the session
+  uint32_t payload_size;   // bytes of entries following this header
+  uint8_t flags;           // bit0: last manifest page
+};
+
+// followed by `path_len` bytes of '/' separated path relative to the
+// receiver's output directory.
+struct FileManifestEntry {
+  uint32_t file_id;   // id used by the file contents, 0 for directories
+  uint64_t size;      // file size in bytes
+  int64_t mtime_us;   // last write time, microseconds since unix epoch
+  uint32_t mode;      // std::filesystem::perms bits
+  uint8_t type;       // FileEntryType
+  uint16_t path_len;  // path length (bytes)
+};
+
+// followed by [FileChunkCodecHeader], [FileChunkIntegrity], `entry_count`
+// FilePackEntry records, [`entry_count` FileChunkDigest records] and the
+// concatenated file contents. The CRCs cover the decoded contents and the
+// rest of the message.
+struct FilePackHeader {
+  uint32_t magic;         // kFilePackMagic
+  uint32_t session_id;    // session the packed files belong to
+  uint16_t entry_count;   // packed files
+  uint32_t payload_size;  // contents size, encoded size when compressed
+  uint8_t flags;          // bit2: compressed, bit3: checksum, bit4: digests
+};
+
+struct FilePackEntry {
+  uint32_t file_id;  // file id announced in the manifest
+  uint32_t size;     // file size in bytes
+};
+
+// Delta transfer of a file the receiver already has a copy of:
+//   sender   -> FileDeltaRequest (file label)
+//   receiver -> FileSignatureHeader pages (feedback label), block checksums of
+//               its copy, or a single empty page when it has none
+//   sender   -> FileDeltaHeader messages, literal data and block copies
+// The receiver rebuilds the file next to its copy, replaces the copy once the
+// last message arrived and acks like a regular transfer.
+struct FileDeltaRequest {
+  uint32_t magic;       // kFileDeltaRequestMagic
+  uint32_t file_id;     // id used by the following delta messages
+  uint64_t total_size;  // size of the sender's file
+  uint16_t name_len;    // filename length (bytes), the name follows
+};
+
+// followed by `block_count` FileBlockSignature records.
+struct FileSignatureHeader {
+  uint32_t magic;         // kFileSignatureMagic
+  uint32_t file_id;       // FileDeltaRequest.file_id
+  uint32_t block_size;    // bytes per block, the last block may be shorter
+  uint64_t basis_size;    // size of the receiver's copy, 0 if it has none
+  uint32_t first_block;   // index of the first block in this page
+  uint32_t block_count;   // blocks in this page
+  uint32_t total_blocks;  // blocks of the whole copy
+  uint8_t flags;          // bit0: last page
+};
+
+struct FileBlockSignature {
+  uint32_t weak;    // rolling checksum
+  uint64_t strong;  // XXH3 64-bit hash
+};
+
+// followed by [FileChunkCodecHeader], [FileChunkDigest] and `payload_size`
+// bytes of FileDeltaOp records, each literal op followed by its data.
+struct FileDeltaHeader {
+  uint32_t magic;         // kFileDeltaMagic
+  uint32_t file_id;       // FileDeltaRequest.file_id
+  uint64_t offset;        // output offset of the first op in this message
+  uint64_t total_size;    // size of the rebuilt file
+  uint32_t payload_size;  // ops size, encoded size when compressed
+  uint8_t flags;          // bit1: last message, bit2: compressed, bit4: digest
+};
+
+struct FileDeltaOp {
+  uint8_t type;          // FileDeltaOpType
+  uint32_t first_block;  // copy: first block of the receiver's copy
+  uint32_t length;       // copy: block count, literal: data bytes following
 };
 #pragma pack(pop)
 
+// incremental XXH3-128 of a file content, hashed as it is read or written.
+class FileDigest {
+ public:
+  FileDigest();
+  ~FileDigest();
+  FileDigest(FileDigest&& other) noexcept;
+  FileDigest& operator=(FileDigest&& other) noexcept;
+
+  void Update(const void* data, size_t size);
+  FileChunkDigest Final() const;
+
+ private:
+  struct State;
+  std::unique_ptr<State> state_;
+};
+
 class FileSender {
  public:
+  struct SessionEntry {
+    std::filesystem::path local_path;
+    std::string relative_path;  // '/' separated
+    FileEntryType type = FileEntryType::File;
+    uint64_t size = 0;
+    int64_t mtime_us = 0;
+    uint32_t mode = 0;
+  };
+
   using SendFunc = std::function<int(const char* data, size_t size)>;
+  // file id -> path and size of the files a repair source can resend.
+  using RepairFiles =
+      std::unordered_map<uint32_t, std::pair<std::filesystem::path, uint64_t>>;
+  // returns the FileTransferAck codec and feature bits last advertised by the
+  // receiver.
+  using PeerCapsFunc = std::function<uint32_t()>;
 
  public:
   FileSender() = default;
@@ -51,6 +259,16 @@ class FileSender {
   // generate a new file id
   static uint32_t NextFileId();
 
+  // codec bits (FileTransferAck layout) this build is able to decode.
+  static uint32_t SupportedCodecs();
+
+  // chunks are only compressed when `cb` reports a codec both sides support,
+  // and only carry checksums when it reports kFileAckIntegrity.
+  void SetPeerCapabilities(PeerCapsFunc cb) { peer_caps_ = cb; }
+  void SetCompressionEnabled(bool enable) { compression_enabled_ = enable; }
+  // tags the repair sources of this sender's files, see DropRepairSources.
+  void SetOwner(const std::string& owner) { owner_ = owner; }
+
   // synchronously send a file using the provided send function.
   // `path`  : full path to the local file.
   // `label` : logical filename to send (usually path.filename()).
@@ -61,26 +279,159 @@ class FileSender {
                const SendFunc& send, std::size_t chunk_size = 64 * 1024,
                uint32_t file_id = 0);
 
+  // like SendFile, but first asks the receiver for block signatures of its
+  // copy of `label` and only sends what changed. Falls back to SendFile when
+  // the receiver has no copy or does not answer in time.
+  int SendFileDelta(const std::filesystem::path& path,
+                    const std::string& label, const SendFunc& send,
+                    std::size_t chunk_size = 64 * 1024, uint32_t file_id = 0);
+
+  // feed a message received on the feedback channel. Signature pages go to a
+  // waiting SendFileDelta and NACKs resend the damaged range of a recently
+  // sent file, both return true. Other messages (ACKs) return false.
+  static bool OnFeedback(const char* data, size_t size);
+
+  // forget the repair sources of files sent by senders tagged `owner`, their
+  // send functions must not outlive the peer they send through.
+  static void DropRepairSources(const std::string& owner);
+
+  // list files and directories for a session. Directories are walked
+  // recursively and keep their own name as the top level component.
+  static std::vector<SessionEntry> CollectEntries(
+      const std::vector<std::filesystem::path>& paths);
+
+  // synchronously stream `entries` as one session: manifest, then contents,
+  // small files packed together. Return 0 on success, <0 on error.
+  int SendSession(const std::vector<SessionEntry>& entries,
+                  const SendFunc& send, std::size_t chunk_size = 64 * 1024,
+                  uint32_t session_id = 0);
+
   // build a single encoded chunk buffer according to FileChunkHeader protocol.
-  static std::vector<char> BuildChunk(uint32_t file_id, uint64_t offset,
-                                      uint64_t total_size, const char* data,
-                                      uint32_t data_size,
-                                      const std::string* file_name,
-                                      bool is_first, bool is_last);
+  // `codec` marks `data` as already encoded, nullptr for raw chunks.
+  // `integrity` and `digest` are appended when not nullptr.
+  static std::vector<char> BuildChunk(
+      uint32_t file_id, uint64_t offset, uint64_t total_size, const char* data,
+      uint32_t data_size, const std::string* file_name, bool is_first,
+      bool is_last, const FileChunkCodecHeader* codec = nullptr,
+      const FileChunkIntegrity* integrity = nullptr,
+      const FileChunkDigest* digest = nullptr);
+
+  // same as BuildChunk, but tries to compress the payload with `codec` and
+  // falls back to a raw chunk when the data does not shrink. With `checksum`
+  // the CRC of the raw payload is added.
+  static std::vector<char> BuildCompressedChunk(
+      uint32_t file_id, uint64_t offset, uint64_t total_size, const char* data,
+      uint32_t data_size, const std::string* file_name, bool is_first,
+      bool is_last, FileChunkCodec codec, bool checksum = false,
+      const FileChunkDigest* digest = nullptr);
+
+  // build a pack message from `files` (file id + content) according to
+  // FilePackHeader protocol, compressing the contents with `codec` if useful.
+  // `integrity` adds the CRCs and a digest per file.
+  static std::vector<char> BuildPack(
+      uint32_t session_id,
+      const std::vector<std::pair<uint32_t, std::vector<char>>>& files,
+      FileChunkCodec codec, bool integrity = false);
+
+ private:
+  FileChunkCodec NegotiatedCodec() const;
+  bool NegotiatedIntegrity() const;
+  // keep `path` around so NACKed ranges of `file_id` can be resent.
+  static void RegisterRepairSource(uint32_t file_id,
+                                   const std::filesystem::path& path,
+                                   uint64_t total_size, const SendFunc& send,
+                                   const std::string& owner);
+  // same for all files of a session, released by the session's ack.
+  static void RegisterRepairSource(uint32_t session_id, RepairFiles files,
+                                   const SendFunc& send,
+                                   const std::string& owner);
+
+ private:
+  PeerCapsFunc peer_caps_ = nullptr;
+  bool compression_enabled_ = true;
+  std::string owner_;
 };
 
 class FileReceiver {
  public:
+  // offset -> length and attempts of ranges whose checksum failed
+  using DamagedRanges = std::map<uint64_t, std::pair<uint32_t, int>>;
+
   struct FileContext {
     std::string file_name;
+    std::filesystem::path save_path;
+    uint64_t total_size = 0;
+    uint64_t received = 0;
+    std::ofstream ofs;
+    // content hashed in order while writing, up to `hashed`
+    FileDigest digest;
+    uint64_t hashed = 0;
+    bool last_seen = false;
+    bool has_peer_digest = false;
+    FileChunkDigest peer_digest{};
+    DamagedRanges damaged;
+  };
+
+  struct SessionFile {
+    uint32_t session_id = 0;
+    std::filesystem::path path;
+    uint64_t size = 0;
+    uint64_t received = 0;
+    int64_t mtime_us = 0;
+    uint32_t mode = 0;
+    // same integrity state as FileContext
+    FileDigest digest;
+    uint64_t hashed = 0;
+    bool has_peer_digest = false;
+    FileChunkDigest peer_digest{};
+    DamagedRanges damaged;
+  };
+
+  struct SessionContext {
     uint64_t total_size = 0;
     uint64_t received = 0;
+    uint32_t total_entries = 0;
+    uint32_t entries_seen = 0;
+    uint32_t files_pending = 0;
+    // files dropped because the sender could not read them, they were
+    // damaged beyond repair or did not match their digest
+    uint32_t files_failed = 0;
+    // files with content, by whether they matched a digest
+    uint32_t files_verified = 0;
+    uint32_t files_unverified = 0;
+    bool manifest_complete = false;
+    // contents arrive file after file, only one of them is open at a time
+    uint32_t open_file_id = 0;
     std::ofstream ofs;
+    // directory metadata is applied last, writing files changes their mtime
+    std::vector<std::pair<std::filesystem::path, FileManifestEntry>>
+        directories;
+    // top level name sent by the peer -> name used on disk
+    std::unordered_map<std::string, std::string> roots;
   };
 
   using OnFileComplete =
       std::function<void(const std::filesystem::path& saved_path)>;
+  struct DeltaContext {
+    // the receiver's copy the delta is applied to, only replaced by a
+    // rebuild that matches the sender's digest
+    std::filesystem::path target_path;
+    std::filesystem::path temp_path;
+    std::filesystem::path saved_path;
+    uint32_t block_size = 0;
+    uint64_t basis_size = 0;
+    uint32_t total_blocks = 0;
+    uint64_t total_size = 0;
+    uint64_t written = 0;
+    std::ifstream basis;
+    std::ofstream ofs;
+    FileDigest digest;
+  };
+
   using OnSendAck = std::function<int(const FileTransferAck& ack)>;
+  // sends a raw message back on the feedback channel, may be called from a
+  // background thread.
+  using OnSendFeedback = std::function<int(const char* data, size_t size)>;
 
  public:
   // save to default desktop directory.
@@ -89,24 +440,79 @@ class FileReceiver {
   // save to a specified directory.
   explicit FileReceiver(const std::filesystem::path& output_dir);
 
+  // stops and waits for pending signature jobs.
+  ~FileReceiver();
+
   // process one received data buffer (one chunk).
   // return true if parsed and processed successfully, false otherwise.
   bool OnData(const char* data, size_t size);
 
   void SetOnSendAck(OnSendAck cb) { on_send_ack_ = cb; }
+  void SetOnSendFeedback(OnSendFeedback cb) { on_send_feedback_ = cb; }
+
+  // ack with file_id 0 that only advertises what this receiver supports,
+  // sent once when a peer connects so senders can pick a protocol up front.
+  static FileTransferAck CapabilitiesAck();
 
   const std::filesystem::path& OutputDir() const { return output_dir_; }
 
  private:
   static std::filesystem::path GetDefaultDesktopPath();
 
+  // `intact` is false when the payload failed its checksum or decoding.
   bool HandleChunk(const FileChunkHeader& header, const char* payload,
-                   size_t payload_size, const std::string* file_name);
+                   size_t payload_size, const std::string* file_name,
+                   bool intact = true, const FileChunkDigest* digest = nullptr);
+  // ask the sender for a damaged range again, false once out of attempts.
+  bool RequestRepair(uint32_t file_id, DamagedRanges& damaged, uint64_t offset,
+                     uint32_t length);
+  // hash whatever of `path` was not hashed while streaming, from `hashed`
+  // on, return true if the digest matches the sender's.
+  static bool VerifyFile(const std::filesystem::path& path, FileDigest& digest,
+                         uint64_t hashed, uint64_t size,
+                         const FileChunkDigest& peer_digest);
+
+  bool HandleManifest(const char* data, size_t size);
+  bool HandlePack(const char* data, size_t size);
+  bool HandleSessionChunk(const FileChunkHeader& header, const char* payload,
+                          size_t payload_size, bool intact,
+                          const FileChunkDigest* digest);
+  // NACK a damaged range of a session file, the file fails once out of
+  // attempts.
+  bool RepairSessionFile(uint32_t file_id, uint64_t offset, uint32_t length);
+  bool WriteSessionFile(uint32_t file_id, uint64_t offset, const char* data,
+                        size_t size);
+  // `failed` removes what was written instead of keeping the file.
+  void FinishSessionFile(uint32_t file_id, bool failed = false);
+  // ack session progress and finish the session once everything arrived.
+  void UpdateSession(uint32_t session_id);
+  bool HandleDeltaRequest(const char* data, size_t size);
+  bool HandleDelta(const char* data, size_t size);
+  bool ApplyDeltaOps(DeltaContext& ctx, const char* ops, size_t size);
+  bool ResolveSessionPath(SessionContext& session,
+                          const std::string& relative_path,
+                          std::filesystem::path& out);
+
+  // decode a compressed payload into decode_buffer_, return nullptr on error.
+  const char* DecodePayload(const FileChunkCodecHeader& codec_header,
+                            const char* payload, size_t payload_size);
 
  private:
   std::filesystem::path output_dir_;
+  std::vector<char> decode_buffer_;
   std::unordered_map<uint32_t, FileContext> contexts_;
+  std::unordered_map<uint32_t, SessionContext> sessions_;
+  std::unordered_map<uint32_t, SessionFile> session_files_;
+  // recently failed session files, chunks and repairs still on their way
+  // for them are dropped
+  std::deque<uint32_t> failed_session_files_;
+  std::unordered_map<uint32_t, DeltaContext> deltas_;
+  std::vector<std::future<void>> signature_jobs_;
+  // set on destruction, signature jobs stop hashing
+  std::shared_ptr<std::atomic<bool>> cancelled_ =
+      std::make_shared<std::atomic<bool>>(false);
   OnSendAck on_send_ack_ = nullptr;
+  OnSendFeedback on_send_feedback_ = nullptr;
 };
 
 }  // namespace crossdesk
@@ -0,0 +1,200 @@
+#include "send_scheduler.h"
+
+#include <algorithm>
+
+namespace crossdesk {
+
+namespace {
+constexpr double kMinBulkBps = 256.0 * 1000;
+// additive increase per report while bulk data is waiting for budget.
+constexpr double kIncreaseFraction = 0.10;
+constexpr double kMinIncreaseBps = 256.0 * 1000;
+constexpr double kUsedFraction = 0.8;
+// offered above delivered by this factor means the transport is queueing.
+constexpr double kOverloadFactor = 1.15;
+constexpr double kDecreaseFactor = 0.90;
+// the unthrottled start leaves the transport queue full, half the delivered
+// rate drains it quickly and additive increase finds the link rate again.
+constexpr double kStartDecreaseFactor = 0.5;
+// bulk runs at this share of its budget while the user is moving the mouse or
+// typing, so input never waits behind a full transport queue.
+constexpr double kInputActiveShare = 0.5;
+constexpr auto kInputActiveWindow = std::chrono::milliseconds(100);
+// the bucket holds at most this much time worth of budget, a full 64 KB file
+// chunk always fits.
+constexpr double kBurstSeconds = 0.02;
+constexpr double kMinBurstBytes = 72 * 1024;
+// reports closer together than this are merged.
+constexpr auto kMinReportInterval = std::chrono::milliseconds(200);
+}  // namespace
+
+SendScheduler::SendScheduler(SinkFunc sink)
+    : sink_(std::move(sink)),
+      bulk_budget_bps_(kMinBulkBps),
+      tokens_(kMinBurstBytes),
+      last_refill_(Clock::now()),
+      interval_start_(Clock::now()) {}
+
+SendScheduler::~SendScheduler() { Stop(); }
+
+int SendScheduler::Send(SendPriority priority, const std::string& label,
+                        const char* data, size_t size, bool reliable) {
+  if (!sink_) {
+    return -1;
+  }
+
+  if (priority != SendPriority::Bulk) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_) {
+        return -1;
+      }
+      interval_other_bytes_ += size;
+      if (priority == SendPriority::Input) {
+        ++stats_.input_frames;
+      } else {
+        ++stats_.interactive_frames;
+      }
+    }
+    if (priority == SendPriority::Input) {
+      last_input_us_ = std::chrono::duration_cast<std::chrono::microseconds>(
+                           Clock::now().time_since_epoch())
+                           .count();
+    }
+    return sink_(label, data, size, reliable);
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool waited = false;
+    while (!stopped_) {
+      if (bulk_unthrottled_ && bulk_cap_bps_ == 0) {
+        break;
+      }
+      Clock::time_point now = Clock::now();
+      RefillLocked(now);
+      // a frame may overdraw the bucket as long as some budget is left, the
+      // debt delays the next one
+      if (tokens_ > 0) {
+        break;
+      }
+      if (!waited) {
+        waited = true;
+        ++stats_.bulk_waits;
+      }
+      interval_backlogged_ = true;
+      double rate = BulkRateLocked(now) / 8.0;
+      auto wait = std::chrono::duration<double>((-tokens_ + 1) / rate);
+      ++waiting_;
+      cv_.wait_for(lock, std::min<std::chrono::duration<double>>(
+                             wait, std::chrono::milliseconds(50)));
+      --waiting_;
+    }
+    if (stopped_) {
+      return -1;
+    }
+    tokens_ -= static_cast<double>(size);
+    interval_bulk_bytes_ += size;
+    ++stats_.bulk_frames;
+  }
+
+  return sink_(label, data, size, reliable);
+}
+
+void SendScheduler::SetBulkCap(uint32_t bps) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  bulk_cap_bps_ = bps;
+  if (bps > 0) {
+    bulk_budget_bps_ = (std::min)(bulk_budget_bps_, static_cast<double>(bps));
+  }
+  cv_.notify_all();
+}
+
+void SendScheduler::OnTransportStats(uint32_t data_outbound_bps) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Clock::time_point now = Clock::now();
+  double seconds = std::chrono::duration<double>(now - interval_start_).count();
+  if (now - interval_start_ < kMinReportInterval) {
+    return;
+  }
+
+  double offered_bulk_bps = interval_bulk_bytes_ * 8.0 / seconds;
+  double other_bps = interval_other_bytes_ * 8.0 / seconds;
+  // the transport does not split its data bitrate per label, whatever is not
+  // input or interactive traffic is file data
+  double delivered_bulk_bps =
+      (std::max)(0.0, static_cast<double>(data_outbound_bps) - other_bps);
+
+  bool overloaded = offered_bulk_bps > delivered_bulk_bps * kOverloadFactor &&
+                    offered_bulk_bps > kMinBulkBps;
+  double budget = bulk_budget_bps_;
+  if (bulk_unthrottled_) {
+    if (overloaded) {
+      // pace from here on, without the debt of the unthrottled frames
+      bulk_unthrottled_ = false;
+      budget = delivered_bulk_bps * kStartDecreaseFactor;
+      tokens_ = kMinBurstBytes;
+      last_refill_ = now;
+    }
+  } else if (overloaded) {
+    budget = (std::min)(budget, delivered_bulk_bps * kDecreaseFactor);
+  } else if (interval_backlogged_ &&
+             offered_bulk_bps >= BulkRateLocked(now) * kUsedFraction) {
+    // only grow a budget that is actually used
+    budget += (std::max)(budget * kIncreaseFraction, kMinIncreaseBps);
+  }
+  budget = (std::max)(budget, kMinBulkBps);
+  if (bulk_cap_bps_ > 0) {
+    budget = (std::min)(budget, static_cast<double>(bulk_cap_bps_));
+  }
+  bulk_budget_bps_ = budget;
+
+  interval_start_ = now;
+  interval_bulk_bytes_ = 0;
+  interval_other_bytes_ = 0;
+  interval_backlogged_ = waiting_ > 0;
+  cv_.notify_all();
+}
+
+void SendScheduler::Stop() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stopped_ = true;
+  cv_.notify_all();
+}
+
+SendScheduler::Stats SendScheduler::GetStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats = stats_;
+  stats.bulk_budget_bps =
+      bulk_unthrottled_ ? 0 : static_cast<uint32_t>(bulk_budget_bps_);
+  stats.bulk_cap_bps = bulk_cap_bps_;
+  return stats;
+}
+
+double SendScheduler::BulkRateLocked(Clock::time_point now) const {
+  double rate = bulk_budget_bps_;
+  if (bulk_unthrottled_) {
+    rate = static_cast<double>(bulk_cap_bps_);
+  } else if (bulk_cap_bps_ > 0) {
+    rate = (std::min)(rate, static_cast<double>(bulk_cap_bps_));
+  }
+  int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                       now.time_since_epoch())
+                       .count();
+  if (now_us - last_input_us_.load() <
+      std::chrono::duration_cast<std::chrono::microseconds>(kInputActiveWindow)
+          .count()) {
+    rate *= kInputActiveShare;
+  }
+  return (std::max)(rate, kMinBulkBps * kInputActiveShare);
+}
+
+void SendScheduler::RefillLocked(Clock::time_point now) {
+  double seconds = std::chrono::duration<double>(now - last_refill_).count();
+  last_refill_ = now;
+  double rate = BulkRateLocked(now) / 8.0;
+  double burst = (std::max)(rate * kBurstSeconds, kMinBurstBytes);
+  tokens_ = (std::min)(tokens_ + rate * seconds, burst);
+}
+
+}  // namespace crossdesk
@@ -0,0 +1,107 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-01-20
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _SEND_SCHEDULER_H_
+#define _SEND_SCHEDULER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace crossdesk {
+
+enum class SendPriority : uint8_t {
+  Input = 0,        // mouse, keyboard and other control actions
+  Interactive = 1,  // clipboard, file acks, browse requests
+  Bulk = 2          // file contents
+};
+
+// Every data frame of one peer goes through a SendScheduler. Input and
+// interactive frames leave right away on the caller's thread, bulk frames are
+// paced to the budget left over by everything else so the transport queue
+// stays short and input is never stuck behind file data.
+//
+// Bulk starts unthrottled, so a fast link is used from the first frame. Once
+// the transport falls behind, the bulk budget follows the outbound data
+// bitrate it reports (AIMD): it grows while everything offered is delivered
+// and drops back to the delivered rate once the transport queues again.
+class SendScheduler {
+ public:
+  using SinkFunc = std::function<int(const std::string& label,
+                                     const char* data, size_t size,
+                                     bool reliable)>;
+
+  struct Stats {
+    uint32_t bulk_budget_bps = 0;  // 0 while bulk is still unthrottled
+    uint32_t bulk_cap_bps = 0;
+    uint64_t input_frames = 0;
+    uint64_t interactive_frames = 0;
+    uint64_t bulk_frames = 0;
+    uint64_t bulk_waits = 0;  // bulk frames that had to wait for budget
+  };
+
+ public:
+  explicit SendScheduler(SinkFunc sink);
+  ~SendScheduler();
+
+  SendScheduler(const SendScheduler&) = delete;
+  SendScheduler& operator=(const SendScheduler&) = delete;
+
+  // Bulk frames block the caller until the budget allows them, which also
+  // back-pressures the file reader. Returns the sink's result, or -1 after
+  // Stop().
+  int Send(SendPriority priority, const std::string& label, const char* data,
+           size_t size, bool reliable = true);
+
+  // upper bound of the bulk rate, 0 means no cap.
+  void SetBulkCap(uint32_t bps);
+
+  // feed the transport's measured outbound data bitrate (all labels).
+  void OnTransportStats(uint32_t data_outbound_bps);
+
+  // wake and fail every waiting bulk sender, later sends of any kind fail.
+  void Stop();
+
+  Stats GetStats();
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  void RefillLocked(Clock::time_point now);
+  double BulkRateLocked(Clock::time_point now) const;
+
+ private:
+  SinkFunc sink_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopped_ = false;
+
+  uint32_t bulk_cap_bps_ = 0;
+  // until the first report that shows the transport queueing
+  bool bulk_unthrottled_ = true;
+  double bulk_budget_bps_;
+  double tokens_;  // bytes
+  Clock::time_point last_refill_;
+  std::atomic<int64_t> last_input_us_{0};
+
+  // accounting between two transport reports
+  Clock::time_point interval_start_;
+  uint64_t interval_bulk_bytes_ = 0;
+  uint64_t interval_other_bytes_ = 0;
+  bool interval_backlogged_ = false;
+  int waiting_ = 0;
+
+  Stats stats_;
+};
+
+}  // namespace crossdesk
+
+#endif
@@ -0,0 +1,393 @@
+#include "virtual_microphone_linux.h"
+
+#include <pulse/error.h>
+#include <pulse/introspect.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "rd_log.h"
+
+namespace crossdesk {
+
+constexpr char kSinkName[] = "crossdesk_mic_sink";
+constexpr char kSourceName[] = "crossdesk_mic";
+// part of every module argument we load, marks leftovers of a crash
+constexpr char kModuleTag[] = "crossdesk_mic";
+constexpr int64_t kFrameDurationUs = 10 * 1000;
+// 320 ms of 10 ms frames between the network thread and PulseAudio
+constexpr size_t kRingFrames = 32;
+// a frame queued longer than this is behind the conversation and skipped
+constexpr int64_t kMaxQueueDelayUs = 120 * 1000;
+// what the server holds ahead of the sink, and how much it asks for at once
+constexpr pa_usec_t kTargetLengthUs = 40 * 1000;
+constexpr pa_usec_t kMinRequestUs = 10 * 1000;
+
+namespace {
+int64_t NowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+}  // namespace
+
+VirtualMicrophoneLinux::VirtualMicrophoneLinux()
+    : sink_module_(PA_INVALID_INDEX),
+      source_module_(PA_INVALID_INDEX),
+      spec_{PA_SAMPLE_S16LE, 48000, 1},
+      playing_(false),
+      frames_(0),
+      stale_(0),
+      underruns_(0) {}
+
+VirtualMicrophoneLinux::~VirtualMicrophoneLinux() { Destroy(); }
+
+int VirtualMicrophoneLinux::Init() {
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
+  if (mainloop_) return 0;
+
+  mainloop_ = pa_threaded_mainloop_new();
+  if (pa_threaded_mainloop_start(mainloop_) < 0) {
+    LOG_ERROR("Failed to start mainloop");
+    pa_threaded_mainloop_free(mainloop_);
+    mainloop_ = nullptr;
+    return -1;
+  }
+
+  pa_threaded_mainloop_lock(mainloop_);
+  int ret = ConnectContextLocked();
+  if (ret == 0) {
+    UnloadStaleModulesLocked();
+    sink_module_ = LoadModuleLocked(
+        "module-null-sink",
+        std::string("sink_name=") + kSinkName +
+            " format=s16le rate=48000 channels=1 "
+            "sink_properties='device.description=\"CrossDesk Microphone "
+            "Sink\"'");
+    if (sink_module_ != PA_INVALID_INDEX) {
+      // applications hide monitors, a remapped source is listed like any
+      // other microphone
+      source_module_ = LoadModuleLocked(
+          "module-remap-source",
+          std::string("master=") + kSinkName + ".monitor source_name=" +
+              kSourceName +
+              " source_properties='device.description=\"CrossDesk "
+              "Microphone\"'");
+    }
+    if (source_module_ == PA_INVALID_INDEX) {
+      ret = -1;
+    }
+  }
+  pa_threaded_mainloop_unlock(mainloop_);
+
+  if (ret != 0) {
+    DestroyContext();
+    return -1;
+  }
+  LOG_INFO("Virtual microphone [{}] created", kSourceName);
+  return 0;
+}
+
+int VirtualMicrophoneLinux::Destroy() {
+  Stop();
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
+  DestroyContext();
+  return 0;
+}
+
+int VirtualMicrophoneLinux::ConnectContextLocked() {
+  context_ =
+      pa_context_new(pa_threaded_mainloop_get_api(mainloop_), "CrossDesk");
+  pa_context_set_state_callback(
+      context_,
+      [](pa_context*, void* userdata) {
+        auto self = static_cast<VirtualMicrophoneLinux*>(userdata);
+        pa_threaded_mainloop_signal(self->mainloop_, 0);
+      },
+      this);
+
+  if (pa_context_connect(context_, nullptr, PA_CONTEXT_NOFLAGS, nullptr) < 0) {
+    LOG_ERROR("Failed to connect context: {}",
+              pa_strerror(pa_context_errno(context_)));
+    return -1;
+  }
+
+  while (true) {
+    pa_context_state_t state = pa_context_get_state(context_);
+    if (state == PA_CONTEXT_READY) break;
+    if (!PA_CONTEXT_IS_GOOD(state)) {
+      LOG_ERROR("Failed to connect context: {}",
+                pa_strerror(pa_context_errno(context_)));
+      return -1;
+    }
+    pa_threaded_mainloop_wait(mainloop_);
+  }
+  return 0;
+}
+
+void VirtualMicrophoneLinux::WaitOperationLocked(pa_operation* operation) {
+  if (!operation) {
+    return;
+  }
+  while (pa_operation_get_state(operation) == PA_OPERATION_RUNNING) {
+    pa_threaded_mainloop_wait(mainloop_);
+  }
+  pa_operation_unref(operation);
+}
+
+void VirtualMicrophoneLinux::UnloadStaleModulesLocked() {
+  struct Query {
+    VirtualMicrophoneLinux* self;
+    std::vector<uint32_t> stale;
+  } query{this, {}};
+
+  WaitOperationLocked(pa_context_get_module_info_list(
+      context_,
+      [](pa_context*, const pa_module_info* info, int eol, void* userdata) {
+        auto* query = static_cast<Query*>(userdata);
+        if (eol) {
+          pa_threaded_mainloop_signal(query->self->mainloop_, 0);
+          return;
+        }
+        if (info && info->argument &&
+            std::string(info->argument).find(kModuleTag) !=
+                std::string::npos) {
+          query->stale.push_back(info->index);
+        }
+      },
+      &query));
+
+  // the source depends on the sink, unload it first
+  std::sort(query.stale.rbegin(), query.stale.rend());
+  for (uint32_t index : query.stale) {
+    LOG_WARN("Unloading stale virtual microphone module {}", index);
+    UnloadModuleLocked(index);
+  }
+}
+
+uint32_t VirtualMicrophoneLinux::LoadModuleLocked(const char* name,
+                                                  const std::string& args) {
+  struct Query {
+    VirtualMicrophoneLinux* self;
+    uint32_t index;
+  } query{this, PA_INVALID_INDEX};
+
+  WaitOperationLocked(pa_context_load_module(
+      context_, name, args.c_str(),
+      [](pa_context*, uint32_t index, void* userdata) {
+        auto* query = static_cast<Query*>(userdata);
+        query->index = index;
+        pa_threaded_mainloop_signal(query->self->mainloop_, 0);
+      },
+      &query));
+  if (query.index == PA_INVALID_INDEX) {
+    LOG_ERROR("Failed to load {}: {}", name,
+              pa_strerror(pa_context_errno(context_)));
+  }
+  return query.index;
+}
+
+void VirtualMicrophoneLinux::UnloadModuleLocked(uint32_t index) {
+  WaitOperationLocked(pa_context_unload_module(
+      context_, index,
+      [](pa_context*, int, void* userdata) {
+        auto self = static_cast<VirtualMicrophoneLinux*>(userdata);
+        pa_threaded_mainloop_signal(self->mainloop_, 0);
+      },
+      this));
+}
+
+int VirtualMicrophoneLinux::Start(const AudioFormat& format) {
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
+  if (!mainloop_ || stream_ || format.sample_rate <= 0 ||
+      format.channels <= 0) {
+    return -1;
+  }
+
+  spec_ = {PA_SAMPLE_S16LE, static_cast<uint32_t>(format.sample_rate),
+           static_cast<uint8_t>(format.channels)};
+  size_t frame_bytes =
+      static_cast<size_t>(format.sample_rate) / 100 * format.channels *
+      sizeof(int16_t);
+  // everything the write callback touches is allocated up front
+  {
+    std::lock_guard<std::mutex> play_lock(play_mtx_);
+    ring_.Reset(frame_bytes, kRingFrames, kFrameDurationUs);
+  }
+  silence_.assign(frame_bytes, 0);
+  frames_ = 0;
+  stale_ = 0;
+  underruns_ = 0;
+
+  pa_threaded_mainloop_lock(mainloop_);
+  if (!context_ || pa_context_get_state(context_) != PA_CONTEXT_READY) {
+    LOG_ERROR("Virtual microphone context is gone");
+    pa_threaded_mainloop_unlock(mainloop_);
+    return -1;
+  }
+
+  stream_ = pa_stream_new(context_, "Microphone", &spec_, nullptr);
+  if (!stream_) {
+    LOG_ERROR("Failed to create stream: {}",
+              pa_strerror(pa_context_errno(context_)));
+    pa_threaded_mainloop_unlock(mainloop_);
+    return -1;
+  }
+  pa_stream_set_state_callback(
+      stream_,
+      [](pa_stream*, void* u) {
+        auto self = static_cast<VirtualMicrophoneLinux*>(u);
+        pa_threaded_mainloop_signal(self->mainloop_, 0);
+      },
+      this);
+  pa_stream_set_write_callback(
+      stream_,
+      [](pa_stream* s, size_t nbytes, void* u) {
+        static_cast<VirtualMicrophoneLinux*>(u)->OnWriteRequest(s, nbytes);
+      },
+      this);
+
+  pa_buffer_attr attr = {
+      .maxlength = (uint32_t)-1,
+      .tlength =
+          static_cast<uint32_t>(pa_usec_to_bytes(kTargetLengthUs, &spec_)),
+      .prebuf = (uint32_t)-1,
+      .minreq = static_cast<uint32_t>(pa_usec_to_bytes(kMinRequestUs, &spec_)),
+      .fragsize = (uint32_t)-1};
+  if (pa_stream_connect_playback(stream_, kSinkName, &attr,
+                                 PA_STREAM_ADJUST_LATENCY, nullptr,
+                                 nullptr) < 0) {
+    LOG_ERROR("Failed to connect stream: {}",
+              pa_strerror(pa_context_errno(context_)));
+    pa_threaded_mainloop_unlock(mainloop_);
+    DisconnectStream();
+    return -1;
+  }
+
+  while (true) {
+    pa_stream_state_t s = pa_stream_get_state(stream_);
+    if (s == PA_STREAM_READY) break;
+    if (!PA_STREAM_IS_GOOD(s)) {
+      LOG_ERROR("Failed to connect stream: {}",
+                pa_strerror(pa_context_errno(context_)));
+      pa_threaded_mainloop_unlock(mainloop_);
+      DisconnectStream();
+      return -1;
+    }
+    pa_threaded_mainloop_wait(mainloop_);
+  }
+  playing_ = true;
+  pa_threaded_mainloop_unlock(mainloop_);
+
+  LOG_INFO("Virtual microphone started: {} Hz, {} channels",
+           format.sample_rate, format.channels);
+  return 0;
+}
+
+int VirtualMicrophoneLinux::Stop() {
+  std::lock_guard<std::mutex> state_lock(state_mtx_);
+  if (!stream_) return 0;
+  {
+    // waits out a Play() that saw playing_ set
+    std::lock_guard<std::mutex> play_lock(play_mtx_);
+    playing_ = false;
+  }
+  DisconnectStream();
+
+  Stats stats = GetStats();
+  LOG_INFO(
+      "Virtual microphone stopped: {} frames, {} overruns, {} stale, {} "
+      "underruns",
+      stats.frames, stats.overruns, stats.stale, stats.underruns);
+  return 0;
+}
+
+int VirtualMicrophoneLinux::Play(const unsigned char* data, size_t size) {
+  std::unique_lock<std::mutex> play_lock(play_mtx_, std::try_to_lock);
+  if (!play_lock.owns_lock() || !playing_ || !data) {
+    return -1;
+  }
+  ring_.Write(data, size, NowUs());
+  return 0;
+}
+
+void VirtualMicrophoneLinux::OnWriteRequest(pa_stream* stream,
+                                            size_t nbytes) {
+  // frames come in at the viewer's pace, those that waited too long are
+  // dropped so the delay cannot creep up
+  int64_t now_us = NowUs();
+  while (ring_.Front() && now_us - ring_.FrontTimestamp() > kMaxQueueDelayUs) {
+    ring_.Pop();
+    stale_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  size_t written = 0;
+  while (written < nbytes) {
+    uint8_t* frame = ring_.Front();
+    if (!frame) break;
+    pa_stream_write(stream, frame, ring_.FrameBytes(), nullptr, 0,
+                    PA_SEEK_RELATIVE);
+    ring_.Pop();
+    written += ring_.FrameBytes();
+    frames_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (written < nbytes) {
+    // nothing from the viewer yet, the source keeps running on silence
+    underruns_.fetch_add(1, std::memory_order_relaxed);
+    while (written < nbytes) {
+      size_t n = (std::min)(nbytes - written, silence_.size());
+      pa_stream_write(stream, silence_.data(), n, nullptr, 0,
+                      PA_SEEK_RELATIVE);
+      written += n;
+    }
+  }
+}
+
+void VirtualMicrophoneLinux::DisconnectStream() {
+  if (mainloop_ && stream_) {
+    pa_threaded_mainloop_lock(mainloop_);
+    pa_stream_disconnect(stream_);
+    pa_stream_unref(stream_);
+    stream_ = nullptr;
+    pa_threaded_mainloop_unlock(mainloop_);
+  }
+}
+
+void VirtualMicrophoneLinux::DestroyContext() {
+  if (!mainloop_) {
+    return;
+  }
+
+  pa_threaded_mainloop_lock(mainloop_);
+  if (context_) {
+    if (pa_context_get_state(context_) == PA_CONTEXT_READY) {
+      if (source_module_ != PA_INVALID_INDEX) {
+        UnloadModuleLocked(source_module_);
+      }
+      if (sink_module_ != PA_INVALID_INDEX) {
+        UnloadModuleLocked(sink_module_);
+      }
+    }
+    pa_context_disconnect(context_);
+    pa_context_unref(context_);
+    context_ = nullptr;
+  }
+  source_module_ = PA_INVALID_INDEX;
+  sink_module_ = PA_INVALID_INDEX;
+  pa_threaded_mainloop_unlock(mainloop_);
+
+  pa_threaded_mainloop_stop(mainloop_);
+  pa_threaded_mainloop_free(mainloop_);
+  mainloop_ = nullptr;
+}
+
+VirtualMicrophoneLinux::Stats VirtualMicrophoneLinux::GetStats() const {
+  Stats stats;
+  stats.frames = frames_.load(std::memory_order_relaxed);
+  stats.overruns = ring_.Overruns();
+  stats.stale = stale_.load(std::memory_order_relaxed);
+  stats.underruns = underruns_.load(std::memory_order_relaxed);
+  return stats;
+}
+}  // namespace crossdesk
@@ -0,0 +1,88 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _VIRTUAL_MICROPHONE_LINUX_H_
+#define _VIRTUAL_MICROPHONE_LINUX_H_
+
+#include <pulse/pulseaudio.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "audio_frame_ring.h"
+#include "virtual_microphone.h"
+
+namespace crossdesk {
+
+// A null sink and a source remapped from its monitor, loaded into the
+// PulseAudio (or PipeWire) server from Init() until Destroy(). Received
+// frames go into the ring and the playback stream into the sink pulls them
+// from the PulseAudio thread, so the network thread never waits on the
+// server. Applications record the viewer from the "CrossDesk Microphone"
+// source.
+class VirtualMicrophoneLinux : public VirtualMicrophone {
+ public:
+  struct Stats {
+    uint64_t frames = 0;     // frames written to the sink
+    uint64_t overruns = 0;   // frames dropped, every slot was taken
+    uint64_t stale = 0;      // frames dropped, queued for too long
+    uint64_t underruns = 0;  // requests filled with silence
+  };
+
+ public:
+  VirtualMicrophoneLinux();
+  ~VirtualMicrophoneLinux();
+
+  int Init() override;
+  int Destroy() override;
+  int Start(const AudioFormat& format) override;
+  int Stop() override;
+
+  int Play(const unsigned char* data, size_t size) override;
+
+  Stats GetStats() const;
+
+ private:
+  // mainloop locked for all of these
+  int ConnectContextLocked();
+  void WaitOperationLocked(pa_operation* operation);
+  // modules a crashed instance left behind
+  void UnloadStaleModulesLocked();
+  uint32_t LoadModuleLocked(const char* name, const std::string& args);
+  void UnloadModuleLocked(uint32_t index);
+  // PulseAudio thread, writes `nbytes` from the ring or silence
+  void OnWriteRequest(pa_stream* stream, size_t nbytes);
+
+  void DisconnectStream();
+  void DestroyContext();
+
+ private:
+  pa_threaded_mainloop* mainloop_ = nullptr;
+  pa_context* context_ = nullptr;
+  pa_stream* stream_ = nullptr;
+  uint32_t sink_module_;
+  uint32_t source_module_;
+
+  // serializes Init, Destroy, Start and Stop
+  std::mutex state_mtx_;
+
+  // Play() writes, OnWriteRequest() reads
+  AudioFrameRing ring_;
+  // held by Play() while it writes, Start() and Stop() take it so the ring
+  // is never reset under a writer. Play() only tries it and drops the frame.
+  std::mutex play_mtx_;
+  std::vector<uint8_t> silence_;
+  pa_sample_spec spec_;
+  std::atomic<bool> playing_;
+
+  std::atomic<uint64_t> frames_;
+  std::atomic<uint64_t> stale_;
+  std::atomic<uint64_t> underruns_;
+};
+}  // namespace crossdesk
+#endif
@@ -0,0 +1,36 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _VIRTUAL_MICROPHONE_H_
+#define _VIRTUAL_MICROPHONE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "speaker_capturer.h"
+
+namespace crossdesk {
+
+// A microphone on the host that plays what a viewer records, so applications
+// on the host can pick it as their input.
+class VirtualMicrophone {
+ public:
+  virtual ~VirtualMicrophone() {}
+
+ public:
+  // creates the device, it stays until Destroy()
+  virtual int Init() = 0;
+  virtual int Destroy() = 0;
+  // starts playing frames of `format`, 10 ms each
+  virtual int Start(const AudioFormat& format) = 0;
+  virtual int Stop() = 0;
+
+  // called from the network thread, never blocks. Frames that pile up
+  // because the viewer's clock runs fast are dropped.
+  virtual int Play(const unsigned char* data, size_t size) = 0;
+};
+}  // namespace crossdesk
+#endif
@@ -0,0 +1,33 @@
+/*
+ * @Author: DI JUNKUN
+ * @Date: 2026-10-19
+ * Copyright (c) 2026 by DI JUNKUN, All Rights Reserved.
+ */
+
+#ifndef _VIRTUAL_MICROPHONE_FACTORY_H_
+#define _VIRTUAL_MICROPHONE_FACTORY_H_
+
+#ifdef __linux__
+#include "virtual_microphone_linux.h"
+#endif
+#include "virtual_microphone.h"
+
+namespace crossdesk {
+
+class VirtualMicrophoneFactory {
+ public:
+  virtual ~VirtualMicrophoneFactory() {}
+
+ public:
+  // nullptr where a virtual device needs a driver of its own (Windows,
+  // macOS)
+  VirtualMicrophone* Create() {
+#ifdef __linux__
+    return new VirtualMicrophoneLinux();
+#else
+    return nullptr;
+#endif
+  }
+};
+}  // namespace crossdesk
+#endif
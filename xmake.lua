@@ -34,6 +34,7 @@ add_requires("openssl3 3.3.2", {system = false})
 add_requires("nlohmann_json 3.11.3")
 add_requires("cpp-httplib v0.26.0", {configs = {ssl = true}})
 add_requires("tinyfiledialogs 3.15.1")
+add_requires("lz4", "xxhash")
 
 if is_os("windows") then
     add_requires("libyuv", "miniaudio 0.11.21")
@@ -100,6 +101,7 @@ target("screen_capturer")
 target("speaker_capturer")
     set_kind("object")
     add_deps("rd_log")
+    add_files("src/speaker_capturer/*.cpp")
     add_includedirs("src/speaker_capturer", {public = true})
     if is_os("windows") then
         add_packages("miniaudio")
@@ -114,6 +116,15 @@ target("speaker_capturer")
         add_includedirs("src/speaker_capturer/linux", {public = true})
     end
 
+target("virtual_microphone")
+    set_kind("object")
+    add_deps("rd_log", "speaker_capturer")
+    add_includedirs("src/virtual_microphone", {public = true})
+    if is_os("linux") then
+        add_files("src/virtual_microphone/linux/*.cpp")
+        add_includedirs("src/virtual_microphone/linux", {public = true})
+    end
+
 target("device_controller")
     set_kind("object")
     add_deps("rd_log", "common")
@@ -137,7 +148,7 @@ target("device_controller")
 
 target("thumbnail")
     set_kind("object")
-    add_packages("libyuv", "openssl3")
+    add_packages("libyuv", "openssl3", "lz4")
     add_deps("rd_log", "common")
     add_files("src/thumbnail/*.cpp")
     add_includedirs("src/thumbnail", {public = true})
@@ -171,20 +182,24 @@ target("version_checker")
 
 target("tools")
     set_kind("object")
-    add_deps("rd_log")
+    add_packages("lz4", "xxhash")
+    add_deps("rd_log", "common")
     add_files("src/tools/*.cpp")
     if is_os("macosx") then
         add_files("src/tools/*.mm")
     end
+    -- stb headers for clipboard images
+    add_includedirs("src/thumbnail")
     add_includedirs("src/tools", {public = true})
 
 target("gui")
     set_kind("object")
-    add_packages("libyuv", "tinyfiledialogs")
+    add_packages("libyuv", "tinyfiledialogs", "lz4")
     add_defines("CROSSDESK_VERSION=\"" .. (get_config("CROSSDESK_VERSION") or "Unknown") .. "\"")
     add_deps("rd_log", "common", "assets", "config_center", "minirtc", 
         "path_manager", "screen_capturer", "speaker_capturer", 
-        "device_controller", "thumbnail", "version_checker", "tools")
+        "virtual_microphone", "device_controller", "thumbnail",
+        "version_checker", "tools")
     add_files("src/gui/*.cpp", "src/gui/panels/*.cpp", "src/gui/toolbars/*.cpp",
         "src/gui/windows/*.cpp")
     add_includedirs("src/gui", "src/gui/panels", "src/gui/toolbars",
@@ -200,4 +215,41 @@ target("crossdesk")
     set_kind("binary")
     add_deps("rd_log", "common", "gui")
     add_files("src/app/*.cpp")
-    add_includedirs("src/app", {public = true})
\ No newline at end of file
+    add_includedirs("src/app", {public = true})
+
+target("file_transfer_bench")
+    set_kind("binary")
+    set_default(false)
+    add_packages("lz4", "xxhash")
+    add_deps("rd_log", "common", "tools")
+    add_files("src/benchmark/file_transfer_bench.cpp")
+
+target("file_transfer_fault_bench")
+    set_kind("binary")
+    set_default(false)
+    add_packages("lz4", "xxhash")
+    add_deps("rd_log", "common", "tools")
+    add_files("src/benchmark/file_transfer_fault_bench.cpp")
+
+target("audio_pipeline_bench")
+    set_kind("binary")
+    set_default(false)
+    add_packages("lz4", "xxhash")
+    add_deps("rd_log", "speaker_capturer", "tools")
+    add_files("src/benchmark/audio_pipeline_bench.cpp")
+
+target("thumbnail_scale_bench")
+    set_kind("binary")
+    set_default(false)
+    add_packages("libyuv")
+    add_includedirs("src/thumbnail")
+    add_files("src/benchmark/thumbnail_scale_bench.cpp",
+        "src/thumbnail/nv12_scale.cpp")
+
+if is_os("linux") then
+    target("audio_latency_probe")
+        set_kind("binary")
+        set_default(false)
+        add_deps("rd_log", "speaker_capturer")
+        add_files("src/benchmark/audio_latency_probe.cpp")
+end